@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/print_per_char.dir/print_per_char.cpp.o"
+  "CMakeFiles/print_per_char.dir/print_per_char.cpp.o.d"
+  "print_per_char"
+  "print_per_char.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/print_per_char.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
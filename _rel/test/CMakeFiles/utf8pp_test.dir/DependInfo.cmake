@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/cjk.cpp" "test/CMakeFiles/utf8pp_test.dir/cjk.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/cjk.cpp.o.d"
+  "/root/repo/test/codepage.cpp" "test/CMakeFiles/utf8pp_test.dir/codepage.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/codepage.cpp.o.d"
+  "/root/repo/test/codepoint_set.cpp" "test/CMakeFiles/utf8pp_test.dir/codepoint_set.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/codepoint_set.cpp.o.d"
+  "/root/repo/test/collation.cpp" "test/CMakeFiles/utf8pp_test.dir/collation.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/collation.cpp.o.d"
+  "/root/repo/test/detect.cpp" "test/CMakeFiles/utf8pp_test.dir/detect.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/detect.cpp.o.d"
+  "/root/repo/test/edit_distance.cpp" "test/CMakeFiles/utf8pp_test.dir/edit_distance.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/edit_distance.cpp.o.d"
+  "/root/repo/test/idna.cpp" "test/CMakeFiles/utf8pp_test.dir/idna.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/idna.cpp.o.d"
+  "/root/repo/test/json.cpp" "test/CMakeFiles/utf8pp_test.dir/json.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/json.cpp.o.d"
+  "/root/repo/test/keyword_matcher.cpp" "test/CMakeFiles/utf8pp_test.dir/keyword_matcher.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/keyword_matcher.cpp.o.d"
+  "/root/repo/test/latin1.cpp" "test/CMakeFiles/utf8pp_test.dir/latin1.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/latin1.cpp.o.d"
+  "/root/repo/test/line_index.cpp" "test/CMakeFiles/utf8pp_test.dir/line_index.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/line_index.cpp.o.d"
+  "/root/repo/test/main.cpp" "test/CMakeFiles/utf8pp_test.dir/main.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/main.cpp.o.d"
+  "/root/repo/test/natural_compare.cpp" "test/CMakeFiles/utf8pp_test.dir/natural_compare.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/natural_compare.cpp.o.d"
+  "/root/repo/test/parse.cpp" "test/CMakeFiles/utf8pp_test.dir/parse.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/parse.cpp.o.d"
+  "/root/repo/test/partition.cpp" "test/CMakeFiles/utf8pp_test.dir/partition.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/partition.cpp.o.d"
+  "/root/repo/test/percent.cpp" "test/CMakeFiles/utf8pp_test.dir/percent.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/percent.cpp.o.d"
+  "/root/repo/test/regex.cpp" "test/CMakeFiles/utf8pp_test.dir/regex.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/regex.cpp.o.d"
+  "/root/repo/test/rope.cpp" "test/CMakeFiles/utf8pp_test.dir/rope.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/rope.cpp.o.d"
+  "/root/repo/test/search.cpp" "test/CMakeFiles/utf8pp_test.dir/search.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/search.cpp.o.d"
+  "/root/repo/test/surrogate_escape.cpp" "test/CMakeFiles/utf8pp_test.dir/surrogate_escape.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/surrogate_escape.cpp.o.d"
+  "/root/repo/test/validate.cpp" "test/CMakeFiles/utf8pp_test.dir/validate.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/validate.cpp.o.d"
+  "/root/repo/test/variant.cpp" "test/CMakeFiles/utf8pp_test.dir/variant.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/variant.cpp.o.d"
+  "/root/repo/test/write.cpp" "test/CMakeFiles/utf8pp_test.dir/write.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/write.cpp.o.d"
+  "/root/repo/test/xml.cpp" "test/CMakeFiles/utf8pp_test.dir/xml.cpp.o" "gcc" "test/CMakeFiles/utf8pp_test.dir/xml.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utf8pp_test.dir/cjk.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/cjk.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/codepage.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/codepage.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/codepoint_set.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/codepoint_set.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/collation.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/collation.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/detect.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/detect.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/edit_distance.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/edit_distance.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/idna.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/idna.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/json.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/json.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/keyword_matcher.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/keyword_matcher.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/latin1.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/latin1.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/line_index.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/line_index.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/main.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/main.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/natural_compare.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/natural_compare.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/parse.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/parse.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/partition.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/partition.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/percent.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/percent.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/regex.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/regex.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/rope.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/rope.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/search.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/search.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/surrogate_escape.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/surrogate_escape.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/validate.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/validate.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/variant.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/variant.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/write.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/write.cpp.o.d"
+  "CMakeFiles/utf8pp_test.dir/xml.cpp.o"
+  "CMakeFiles/utf8pp_test.dir/xml.cpp.o.d"
+  "utf8pp_test"
+  "utf8pp_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utf8pp_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -4,10 +4,65 @@ generate.py
 Author: Peter Lenkefi
 Date: 2019-02-11
 Description: This python script generates the data mappings from the official
-unicode character databases.
+unicode character databases. It has to be run from the directory containing the
+database files, and it writes utf8pp_tables.hpp, utf8pp_cjk_tables.hpp and
+utf8pp_collation_tables.hpp next to itself.
 """
 
+import os
+
+OUTPUT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# The multi-byte (CJK) encodings as (C++ name, WHATWG index file, if the
+# index is used for encoding)
+CJK_INDICES = [
+    ('jis0208', 'index-jis0208.txt', True),
+    ('jis0212', 'index-jis0212.txt', False),
+    ('euc_kr', 'index-euc-kr.txt', True),
+    ('big5', 'index-big5.txt', True),
+    ('gb18030', 'index-gb18030.txt', True),
+]
+
+# One past the largest codepoint
+CODEPOINT_LIMIT = 0x110000
+
+# The number of codepoints in a block of a reverse index
+REVERSE_BLOCK_SIZE = 64
+
+# The single-byte codepages as (C++ name, Unicode mapping file)
+CODEPAGES = [
+    ('iso_8859_2', '8859-2.TXT'),
+    ('iso_8859_3', '8859-3.TXT'),
+    ('iso_8859_4', '8859-4.TXT'),
+    ('iso_8859_5', '8859-5.TXT'),
+    ('iso_8859_6', '8859-6.TXT'),
+    ('iso_8859_7', '8859-7.TXT'),
+    ('iso_8859_8', '8859-8.TXT'),
+    ('iso_8859_9', '8859-9.TXT'),
+    ('iso_8859_10', '8859-10.TXT'),
+    ('iso_8859_11', '8859-11.TXT'),
+    ('iso_8859_13', '8859-13.TXT'),
+    ('iso_8859_14', '8859-14.TXT'),
+    ('iso_8859_15', '8859-15.TXT'),
+    ('iso_8859_16', '8859-16.TXT'),
+    ('koi8_r', 'KOI8-R.TXT'),
+    ('koi8_u', 'KOI8-U.TXT'),
+    ('windows_1250', 'CP1250.TXT'),
+    ('windows_1251', 'CP1251.TXT'),
+    ('windows_1252', 'CP1252.TXT'),
+    ('windows_1253', 'CP1253.TXT'),
+    ('windows_1254', 'CP1254.TXT'),
+    ('windows_1255', 'CP1255.TXT'),
+    ('windows_1256', 'CP1256.TXT'),
+    ('windows_1257', 'CP1257.TXT'),
+    ('windows_1258', 'CP1258.TXT'),
+    ('cp437', 'CP437.TXT'),
+    ('cp850', 'CP850.TXT'),
+    ('cp866', 'CP866.TXT'),
+]
+
 # Process UnicodeData.txt
+# Returns a dictionary from codepoints to the list of fields
 def process_unicode_data():
     # Indicies
     CODEPOINT             = 0
@@ -28,21 +83,581 @@ def process_unicode_data():
 
     file = open('UnicodeData.txt', 'r')
 
-    print("Longest mapping is: ", end = '', flush = True)
-    longest_decomp = 0
-    longest_line = None
+    result = {}
+    range_start = None
+    for line in file:
+        sections = line.rstrip('\n').split(';')
+        cp = int(sections[CODEPOINT], 16)
+        name = sections[NAME]
+        # Large blocks are given as a <..., First> and <..., Last> pair
+        if name.endswith(', First>'):
+            range_start = cp
+            continue
+        if name.endswith(', Last>'):
+            for c in range(range_start, cp + 1):
+                result[c] = sections
+            continue
+        result[cp] = sections
+
+    return result
+
+# Process a property file in the UCD format (like Scripts.txt), where every
+# line is a codepoint or a range of codepoints and the property value
+# Returns a dictionary from codepoints to property values
+def process_property_file(filename, only_value = None):
+    file = open(filename, 'r')
+
+    result = {}
+    for line in file:
+        line = line.split('#')[0].strip()
+        if not line:
+            continue
+
+        sections = [s.strip() for s in line.split(';')]
+        value = sections[1]
+        if only_value is not None and value != only_value:
+            continue
+
+        cps = sections[0].split('..')
+        start = int(cps[0], 16)
+        end = int(cps[-1], 16)
+        for cp in range(start, end + 1):
+            result[cp] = value
+
+    return result
+
+# Process a mapping file in the format of the unicode.org MAPPINGS directory,
+# where every line is a byte sequence and the codepoint it maps to
+# Returns a dictionary from the codes to codepoints
+def process_mapping_file(filename):
+    file = open(filename, 'r')
+
+    result = {}
+    for line in file:
+        sections = line.split('#')[0].split()
+        # Undefined codes have no codepoint
+        if len(sections) < 2:
+            continue
+        result[int(sections[0], 16)] = int(sections[1], 16)
+
+    return result
+
+# Process an index file in the format of the WHATWG encoding standard, where
+# every line is a pointer and the codepoint it maps to
+# Returns a dictionary from pointers to codepoints
+def process_index_file(filename):
+    file = open(filename, 'r', encoding = 'utf-8')
 
+    result = {}
     for line in file:
-        sections = line.split(';')
+        sections = line.split('#')[0].split()
+        if len(sections) < 2:
+            continue
+        result[int(sections[0])] = int(sections[1], 16)
+
+    return result
+
+# Converts an identifier to snake_case
+def snake_case(name):
+    result = ''
+    for i, c in enumerate(name):
+        if c.isupper() and i > 0 and name[i - 1].islower():
+            result += '_'
+        result += c.lower()
+    return result
+
+# Returns the smallest unsigned C++ type that can hold the given value
+def smallest_type(max_value):
+    if max_value < 1 << 8:
+        return 'std::uint8_t'
+    if max_value < 1 << 16:
+        return 'std::uint16_t'
+    return 'std::uint32_t'
+
+# Writes a C++ array definition
+def write_array(out, ctype, name, values, per_line = 16):
+    out.write('inline constexpr %s %s[] = {\n' % (ctype, name))
+    for i in range(0, len(values), per_line):
+        line = ', '.join(str(v) for v in values[i:i + per_line])
+        out.write('    %s,\n' % line)
+    out.write('};\n\n')
+
+# Writes an enumeration of property values
+def write_enum(out, name, values):
+    out.write('enum class %s : std::uint8_t {\n' % name)
+    for v in values:
+        out.write('    %s,\n' % snake_case(v))
+    out.write('};\n\n')
+
+# Writes a range table for a property that maps every codepoint to a small
+# integer. The table is a sorted array of range starts, and an array of the
+# values of each range, so lookup is a binary search.
+def write_ranges(out, name, values):
+    starts = []
+    range_values = []
+    for cp, value in enumerate(values):
+        if not range_values or range_values[-1] != value:
+            starts.append(cp)
+            range_values.append(value)
+
+    write_array(out, 'std::uint32_t', name + '_starts', starts, 8)
+    write_array(out, smallest_type(max(range_values)), name + '_values',
+        range_values)
+
+# Writes a reverse index from codepoints to codes of a legacy encoding. The
+# first level maps blocks of codepoints to unique second-level blocks, where
+# zero means unmapped. Codepoints at or above the limit are all unmapped.
+def write_reverse_index(out, name, mapping):
+    limit = max(mapping) // REVERSE_BLOCK_SIZE * REVERSE_BLOCK_SIZE \
+        + REVERSE_BLOCK_SIZE
+
+    # The first block is the empty one
+    blocks = { (0,) * REVERSE_BLOCK_SIZE: 0 }
+    stage1 = []
+    stage2 = [0] * REVERSE_BLOCK_SIZE
+    for start in range(0, limit, REVERSE_BLOCK_SIZE):
+        block = tuple(mapping.get(cp, 0)
+            for cp in range(start, start + REVERSE_BLOCK_SIZE))
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2 += block
+        stage1.append(blocks[block])
+
+    out.write('inline constexpr std::uint32_t %s_limit = %d;\n\n'
+        % (name, limit))
+    write_array(out, smallest_type(len(blocks)), name + '_stage1', stage1)
+    write_array(out, smallest_type(max(stage2)), name + '_stage2', stage2)
+
+# Process the single-byte codepage mapping files
+def process_codepages(out):
+    for name, filename in CODEPAGES:
+        mapping = process_mapping_file(filename)
+        for b in range(0x80):
+            assert mapping.get(b) == b, 'The lower half must be ASCII!'
+
+        # Unmapped bytes decode to zero
+        decode = [mapping.get(b, 0) for b in range(0x80, 0x100)]
+        encode = { cp: b for b, cp in mapping.items() if b >= 0x80 }
+
+        out.write('/**\n * %s, generated from %s.\n */\n' % (name, filename))
+        write_array(out, 'std::uint16_t', name + '_decode', decode, 8)
+        write_reverse_index(out, name + '_encode', encode)
+
+# Writes the codepage descriptors, that refer to the tables of each codepage
+def write_codepage_descriptors(out):
+    out.write('namespace codepage {\n\n')
+    for name, filename in CODEPAGES:
+        out.write('struct %s {\n' % name)
+        for table in ['decode', 'encode_limit', 'encode_stage1',
+            'encode_stage2']:
+            out.write('    static constexpr auto const& %s = tables::%s_%s;\n'
+                % (table, name, table))
+        out.write('};\n\n')
+    out.write('} /* namespace codepage */\n\n')
+
+# Process the multi-byte encoding indices
+def process_cjk_indices(out):
+    for name, filename, encoded in CJK_INDICES:
+        index = process_index_file(filename)
+        assert max(index) < 0x10000, 'Pointers must fit 16 bits!'
+
+        # Unmapped pointers map to zero, Big5 has astral codepoints
+        forward = [index.get(p, 0) for p in range(max(index) + 1)]
+
+        out.write('/**\n * %s, generated from %s.\n */\n' % (name, filename))
+        write_array(out, smallest_type(max(forward)), name + '_index',
+            forward, 10)
+        if encoded:
+            # All pointers sorted by codepoint, then pointer, for binary
+            # searching when encoding. Encoders pick among the duplicates.
+            reverse = sorted(index, key = lambda p: (index[p], p))
+            write_array(out, 'std::uint16_t', name + '_by_codepoint',
+                reverse, 10)
+
+    # The four-byte GB18030 sequences are ranges of consecutive codepoints
+    ranges = process_index_file('index-gb18030-ranges.txt')
+    # Encoding binary searches the codepoints too
+    assert sorted(ranges.values()) == [ranges[p] for p in sorted(ranges)]
+    out.write('/**\n * gb18030 four-byte ranges, generated from '
+        'index-gb18030-ranges.txt.\n */\n')
+    write_array(out, 'std::uint16_t', 'gb18030_ranges_pointer',
+        sorted(ranges), 10)
+    write_array(out, 'std::uint16_t', 'gb18030_ranges_codepoint',
+        [ranges[p] for p in sorted(ranges)], 10)
+
+# Process GraphemeBreakProperty.txt and emoji-data.txt
+def process_grapheme_break(out):
+    # The order is the order of the enumeration, Other must be first
+    NAMES = [
+        'Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'RegionalIndicator',
+        'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT',
+        'ExtendedPictographic',
+    ]
+
+    props = process_property_file('GraphemeBreakProperty.txt')
+    pictographic = process_property_file('emoji-data.txt',
+        'Extended_Pictographic')
+
+    values = [0] * CODEPOINT_LIMIT
+    for cp, value in props.items():
+        values[cp] = NAMES.index(value.replace('_', ''))
+    for cp in pictographic:
+        # Extended_Pictographic codepoints are all Other otherwise
+        if values[cp] == 0:
+            values[cp] = NAMES.index('ExtendedPictographic')
+
+    out.write('/**\n * Grapheme_Cluster_Break property values.\n */\n')
+    write_enum(out, 'grapheme_break', NAMES)
+    write_ranges(out, 'grapheme_break', values)
+
+# The general categories as (short name, long name), Unassigned must be first
+GENERAL_CATEGORIES = [
+    ('Cn', 'Unassigned'),
+    ('Lu', 'UppercaseLetter'), ('Ll', 'LowercaseLetter'),
+    ('Lt', 'TitlecaseLetter'), ('Lm', 'ModifierLetter'),
+    ('Lo', 'OtherLetter'),
+    ('Mn', 'NonspacingMark'), ('Mc', 'SpacingMark'), ('Me', 'EnclosingMark'),
+    ('Nd', 'DecimalNumber'), ('Nl', 'LetterNumber'), ('No', 'OtherNumber'),
+    ('Pc', 'ConnectorPunctuation'), ('Pd', 'DashPunctuation'),
+    ('Ps', 'OpenPunctuation'), ('Pe', 'ClosePunctuation'),
+    ('Pi', 'InitialPunctuation'), ('Pf', 'FinalPunctuation'),
+    ('Po', 'OtherPunctuation'),
+    ('Sm', 'MathSymbol'), ('Sc', 'CurrencySymbol'), ('Sk', 'ModifierSymbol'),
+    ('So', 'OtherSymbol'),
+    ('Zs', 'SpaceSeparator'), ('Zl', 'LineSeparator'),
+    ('Zp', 'ParagraphSeparator'),
+    ('Cc', 'Control'), ('Cf', 'Format'), ('Cs', 'Surrogate'),
+    ('Co', 'PrivateUse'),
+]
+
+# Process the General_Category field of UnicodeData.txt
+def process_general_category(out, unicode_data):
+    GENERAL_CATEGORY = 2
+    short_names = [short for short, _ in GENERAL_CATEGORIES]
+
+    values = [0] * CODEPOINT_LIMIT
+    for cp, sections in unicode_data.items():
+        values[cp] = short_names.index(sections[GENERAL_CATEGORY])
+
+    out.write('/**\n * General_Category property values.\n */\n')
+    write_enum(out, 'general_category',
+        [name for _, name in GENERAL_CATEGORIES])
+    write_ranges(out, 'general_category', values)
+    write_array(out, 'char const*', 'general_category_short_names',
+        ['"%s"' % short for short, _ in GENERAL_CATEGORIES], 8)
+    write_array(out, 'char const*', 'general_category_long_names',
+        ['"%s"' % name for _, name in GENERAL_CATEGORIES], 4)
+
+# Process the decimal digits (General_Category Nd), which come in runs of ten
+# consecutive codepoints from zero to nine, so only the zeros are written.
+def process_decimal_digits(out, unicode_data):
+    DECIMAL_DIGIT_VALUE = 6
+
+    zeros = []
+    for cp, sections in sorted(unicode_data.items()):
+        value = sections[DECIMAL_DIGIT_VALUE]
+        if value == '':
+            continue
+        if value == '0':
+            zeros.append(cp)
+        assert zeros and cp - zeros[-1] == int(value)
+
+    write_array(out, 'std::uint32_t', 'decimal_digit_zeros', zeros, 8)
+
+# Process IdnaMappingTable.txt (UTS #46). Deviations are valid, as in
+# nontransitional processing, and the STD3 statuses are disallowed, as with
+# UseSTD3ASCIIRules.
+def process_idna(out):
+    NAMES = ['Disallowed', 'Valid', 'Ignored', 'Mapped']
+    STATUSES = {
+        'valid': 'Valid',
+        'deviation': 'Valid',
+        'ignored': 'Ignored',
+        'mapped': 'Mapped',
+        'disallowed': 'Disallowed',
+        'disallowed_STD3_valid': 'Disallowed',
+        'disallowed_STD3_mapped': 'Disallowed',
+    }
+    # Mappings to more than one codepoint are offsets into the sequences,
+    # flagged with this bit
+    SEQUENCE_FLAG = 0x80000000
+
+    status = [0] * CODEPOINT_LIMIT
+    mapping = [None] * CODEPOINT_LIMIT
+    for line in open('IdnaMappingTable.txt', 'r'):
+        line = line.split('#')[0].strip()
+        if not line:
+            continue
+
+        sections = [s.strip() for s in line.split(';')]
+        cps = sections[0].split('..')
+        value = NAMES.index(STATUSES[sections[1]])
+        target = None
+        if value == NAMES.index('Mapped'):
+            target = tuple(int(c, 16) for c in sections[2].split())
+        for cp in range(int(cps[0], 16), int(cps[-1], 16) + 1):
+            status[cp] = value
+            mapping[cp] = target
+
+    # Single codepoint mappings are merged into ranges that map to
+    # consecutive codepoints, like A-Z
+    starts = []
+    range_status = []
+    range_mapping = []
+    sequences = []
+    offsets = {}
+    for cp in range(CODEPOINT_LIMIT):
+        target = mapping[cp]
+        if starts and range_status[-1] == status[cp]:
+            prev = mapping[cp - 1]
+            if target is None and prev is None:
+                continue
+            if target is not None and prev is not None and target == prev:
+                continue
+            if target is not None and prev is not None and len(target) == 1 \
+                and len(prev) == 1 and target[0] == prev[0] + 1 \
+                and range_mapping[-1] < SEQUENCE_FLAG:
+                continue
+
+        starts.append(cp)
+        range_status.append(status[cp])
+        if target is None:
+            range_mapping.append(0)
+        elif len(target) == 1:
+            range_mapping.append(target[0])
+        else:
+            # Sequences are stored as UTF8, prefixed by their length
+            encoded = ''.join(chr(c) for c in target).encode('utf-8')
+            if encoded not in offsets:
+                offsets[encoded] = len(sequences)
+                sequences += [len(encoded)] + list(encoded)
+            range_mapping.append(SEQUENCE_FLAG | offsets[encoded])
+
+    out.write('/**\n * IDNA (UTS #46) mapping statuses.\n */\n')
+    write_enum(out, 'idna_status', NAMES)
+    out.write('inline constexpr std::uint32_t idna_sequence_flag = 0x%X;\n\n'
+        % SEQUENCE_FLAG)
+    write_array(out, 'std::uint32_t', 'idna_starts', starts, 8)
+    write_array(out, 'std::uint8_t', 'idna_values', range_status)
+    write_array(out, 'std::uint32_t', 'idna_mapping', range_mapping, 8)
+    write_array(out, 'std::uint8_t', 'idna_sequences', sequences)
+
+# Process CaseFolding.txt, with the common and full foldings (statuses C and
+# F). Folded codepoints are stored in a sorted key array for binary search.
+def process_case_folding(out):
+    # Foldings to more than one codepoint are offsets into the sequences,
+    # flagged with this bit
+    SEQUENCE_FLAG = 0x80000000
+
+    keys = []
+    values = []
+    sequences = []
+    # The ASCII codepoints in the foldings of non-ASCII codepoints, like k for
+    # U+212A KELVIN SIGN, as a 128-bit set
+    ascii_targets = [0, 0]
+    for line in open('CaseFolding.txt', 'r'):
+        line = line.split('#')[0].strip()
+        if not line:
+            continue
+
+        sections = [s.strip() for s in line.split(';')]
+        if sections[1] not in ('C', 'F'):
+            continue
+        target = [int(c, 16) for c in sections[2].split()]
+        keys.append(int(sections[0], 16))
+        if len(target) == 1:
+            values.append(target[0])
+        else:
+            # Sequences are prefixed by their length
+            values.append(SEQUENCE_FLAG | len(sequences))
+            sequences += [len(target)] + target
+        if keys[-1] >= 0x80:
+            for cp in target:
+                if cp < 0x80:
+                    ascii_targets[cp // 64] |= 1 << cp % 64
+
+    assert keys == sorted(keys)
+    out.write('inline constexpr std::uint32_t case_fold_sequence_flag = '
+        '0x%X;\n\n' % SEQUENCE_FLAG)
+    write_array(out, 'std::uint32_t', 'case_fold_keys', keys, 8)
+    write_array(out, 'std::uint32_t', 'case_fold_values', values, 8)
+    write_array(out, 'std::uint32_t', 'case_fold_sequences', sequences, 8)
+    write_array(out, 'std::uint64_t', 'case_fold_ascii_targets',
+        ascii_targets)
+
+# Process Scripts.txt. Scripts are numbered by their position in the sorted
+# list of names, after Unknown for the unlisted codepoints.
+def process_scripts(out):
+    scripts = process_property_file('Scripts.txt')
+    names = ['Unknown'] + sorted(set(scripts.values()) - {'Unknown'})
+
+    values = [0] * CODEPOINT_LIMIT
+    for cp, name in scripts.items():
+        values[cp] = names.index(name)
+
+    write_ranges(out, 'script', values)
+    write_array(out, 'char const*', 'script_names',
+        ['"%s"' % name for name in names], 4)
+
+# Process allkeys.txt, the DUCET of UTS #10, and the Unified_Ideograph ranges
+# of PropList.txt for the implicit weights of Han. A collation element is
+# packed as primary << 16 | secondary << 6 | tertiary << 1 | variable.
+# Codepoints map to their elements as offset << 5 | count, or to their
+# contractions with the contraction flag set. The contractions of a starter
+# are the elements of the starter alone, their count, then each one as the
+# length of the rest, the rest, and its elements, longest first.
+def process_collation(out):
+    CONTRACTION_FLAG = 0x80000000
+    SECONDARY_BIAS = 0x1E
+
+    elements = []
+    sequences = {}
+    def reference(ces):
+        if ces not in sequences:
+            sequences[ces] = len(elements) << 5 | len(ces)
+            elements.extend(ces)
+        return sequences[ces]
+
+    singles = {}
+    contractions = {}
+    implicit = []
+    for line in open('allkeys.txt', 'r'):
+        line = line.split('#')[0].strip()
+        if line.startswith('@implicitweights'):
+            cps, base = line[len('@implicitweights'):].split(';')
+            cps = cps.strip().split('..')
+            implicit.append((int(cps[0], 16), int(cps[1], 16),
+                int(base, 16)))
+            continue
+        if not line or line.startswith('@'):
+            continue
+
+        key, weights = line.split(';')
+        key = [int(c, 16) for c in key.split()]
+        ces = []
+        for ce in weights.strip()[1:-1].split(']['):
+            variable = ce[0] == '*'
+            p, s, t = (int(w, 16) for w in ce[1:].split('.'))
+            assert s == 0 or 0x20 <= s <= 0xFF + SECONDARY_BIAS
+            assert t < 0x20
+            ces.append(p << 16 | s << 6 | t << 1 | int(variable))
+        ces = tuple(ces)
+        assert len(ces) < 32
+        if len(key) == 1:
+            singles[key[0]] = ces
+        else:
+            contractions.setdefault(key[0], []).append((key[1:], ces))
+
+    mapping = { cp: reference(ces) for cp, ces in singles.items() }
+    contraction_table = []
+    members = set()
+    for starter, items in sorted(contractions.items()):
+        alone = mapping.get(starter, 0)
+        mapping[starter] = CONTRACTION_FLAG | len(contraction_table)
+        contraction_table += [alone, len(items)]
+        for rest, ces in sorted(items, key = lambda i: -len(i[0])):
+            contraction_table += [len(rest)] + rest + [reference(ces)]
+            members.update(rest)
+
+    # The implicit weights of Tangut, Nushu and Khitan count from the start
+    # of their first range, Han and unassigned codepoints from zero
+    origins = {}
+    for first, last, base in implicit:
+        origins.setdefault(base, first)
+    ranges = [(first, last, base, origins[base])
+        for first, last, base in implicit]
+    # Han characters count from zero too, the core ones are in the CJK
+    # Unified Ideographs and CJK Compatibility Ideographs blocks
+    ideographs = process_property_file('PropList.txt', 'Unified_Ideograph')
+    for cp in sorted(ideographs):
+        core = 0x4E00 <= cp <= 0x9FFF or 0xF900 <= cp <= 0xFAFF
+        base = 0xFB40 if core else 0xFB80
+        if ranges and ranges[-1][1] == cp - 1 and ranges[-1][2] == base:
+            ranges[-1] = (ranges[-1][0], cp, base, 0)
+        else:
+            ranges.append((cp, cp, base, 0))
+    ranges.sort()
+
+    out.write('inline constexpr std::uint32_t collation_contraction_flag = '
+        '0x%X;\n' % CONTRACTION_FLAG)
+    out.write('inline constexpr std::uint32_t collation_secondary_bias = '
+        '0x%X;\n' % SECONDARY_BIAS)
+    out.write('inline constexpr std::uint32_t collation_contraction_length = '
+        '%d;\n\n' % max(len(rest) for items in contractions.values()
+            for rest, _ in items))
+    write_reverse_index(out, 'collation', mapping)
+    write_array(out, 'std::uint32_t', 'collation_elements', elements, 8)
+    write_array(out, 'std::uint32_t', 'collation_contractions',
+        contraction_table, 8)
+    write_array(out, 'std::uint32_t', 'collation_contraction_members',
+        sorted(members), 8)
+    write_array(out, 'std::uint32_t', 'collation_implicit_firsts',
+        [r[0] for r in ranges], 8)
+    write_array(out, 'std::uint32_t', 'collation_implicit_lasts',
+        [r[1] for r in ranges], 8)
+    write_array(out, 'std::uint32_t', 'collation_implicit_bases',
+        [r[2] for r in ranges], 8)
+    write_array(out, 'std::uint32_t', 'collation_implicit_origins',
+        [r[3] for r in ranges], 8)
+
+# Writes the beginning of a generated header
+def write_prologue(out, filename):
+    guard = 'PETER_LENKEFI_' + filename.replace('.', '_').upper()
+
+    out.write('/**\n')
+    out.write(' * %s\n' % filename)
+    out.write(' *\n')
+    out.write(' * @description This file is generated by generate.py from the '
+        'unicode character\n')
+    out.write(' * databases, do not edit it by hand.\n')
+    out.write(' * @license MIT\n')
+    out.write(' */\n\n')
+    out.write('#ifndef %s\n' % guard)
+    out.write('#define %s\n\n' % guard)
+    out.write('#include <cstdint>\n\n')
+    out.write('namespace utf8pp {\n')
+    out.write('namespace tables {\n\n')
+
+# Writes the end of a generated header
+def write_epilogue(out, filename):
+    guard = 'PETER_LENKEFI_' + filename.replace('.', '_').upper()
+
+    out.write('} /* namespace utf8pp */\n\n')
+    out.write('#endif /* %s */\n' % guard)
+
+def main():
+    filename = 'utf8pp_tables.hpp'
+    out = open(os.path.join(OUTPUT_DIR, filename), 'w', newline = '\n')
+    write_prologue(out, filename)
+
+    out.write('inline constexpr std::uint32_t reverse_block_size = %d;\n\n'
+        % REVERSE_BLOCK_SIZE)
+
+    process_grapheme_break(out)
+    unicode_data = process_unicode_data()
+    process_general_category(out, unicode_data)
+    process_decimal_digits(out, unicode_data)
+    process_idna(out)
+    process_case_folding(out)
+    process_scripts(out)
+    process_codepages(out)
 
-        decomp = sections[DECOMPOSITION_MAPPING]
+    out.write('} /* namespace tables */\n\n')
+    write_codepage_descriptors(out)
+    write_epilogue(out, filename)
 
-        dc = decomp.split(' ')
-        if longest_decomp < len(dc):
-            longest_decomp = len(dc)
-            longest_line = decomp
+    filename = 'utf8pp_cjk_tables.hpp'
+    out = open(os.path.join(OUTPUT_DIR, filename), 'w', newline = '\n')
+    write_prologue(out, filename)
+    process_cjk_indices(out)
+    out.write('} /* namespace tables */\n\n')
+    write_epilogue(out, filename)
 
-    print(longest_decomp)
-    print(longest_line)
+    filename = 'utf8pp_collation_tables.hpp'
+    out = open(os.path.join(OUTPUT_DIR, filename), 'w', newline = '\n')
+    write_prologue(out, filename)
+    process_collation(out)
+    out.write('} /* namespace tables */\n\n')
+    write_epilogue(out, filename)
 
-process_unicode_data()
+main()
@@ -11,11 +11,22 @@
 #ifndef PETER_LENKEFI_UTF8PP_HPP
 #define PETER_LENKEFI_UTF8PP_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <map>
+#include <memory>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utf8pp_cjk_tables.hpp"
+#include "utf8pp_collation_tables.hpp"
+#include "utf8pp_tables.hpp"
 
 /**
  * Shortcuts for OSes.
@@ -39,6 +50,30 @@
 
 #if UTF8PP_WINDOWS
 #   include <Windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+/**
+ * Shortcuts for instruction sets.
+ */
+#define UTF8PP_SSE2 0
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) \
+ || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   undef UTF8PP_SSE2
+#   define UTF8PP_SSE2 1
+#endif
+
+#if UTF8PP_SSE2
+#   include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#   include <intrin.h>
 #endif
 
 namespace utf8pp {
@@ -74,15 +109,49 @@ inline constexpr utf8_ssize invalid_utf8 = -1;
  */
 inline constexpr utf8_ssize invalid_codepoint = -2;
 
+/**
+ * The codepoint has no representation in the target encoding.
+ */
+inline constexpr utf8_ssize unmappable = -3;
+
+/**
+ * The source ends in the middle of a sequence. When converting a stream, the
+ * unconsumed bytes should be prepended to the next chunk.
+ */
+inline constexpr utf8_ssize incomplete = -4;
+
+/**
+ * The source contains a byte sequence that is invalid in its encoding.
+ */
+inline constexpr utf8_ssize invalid_sequence = -5;
+
+/**
+ * A domain name label breaks the IDNA rules: it has disallowed characters,
+ * misplaced hyphens, or it is empty or too long.
+ */
+inline constexpr utf8_ssize invalid_label = -6;
+
+/**
+ * A pattern has a syntax error, or uses a feature that isn't supported.
+ */
+inline constexpr utf8_ssize invalid_pattern = -7;
+
 } /* namespace error */
 
 namespace detail {
 
+/**
+ * Checks if a byte is a continuation byte (0b10xxxxxx).
+ */
+inline constexpr bool is_continuation(utf8_byte b) noexcept {
+    return b >= 0x80 && b <= 0xbf;
+}
+
 /**
  * Used to check the range of the second, third and fourth bytes.
  */
 inline constexpr bool next_byte_bad(utf8_byte b) noexcept {
-    return b < 0x80 || b > 0xbf;
+    return !is_continuation(b);
 }
 
 /**
@@ -117,6 +186,69 @@ calc_codepoint(utf8_byte const* src, utf8_usize len) noexcept {
     return utf8_cp(0);
 }
 
+/**
+ * Counts the trailing zero bits of a non-zero mask.
+ */
+inline unsigned ctz(std::uint32_t x) noexcept {
+    utf8pp_assert(x != 0, "The mask must not be zero!");
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, x);
+    return unsigned(idx);
+#else
+    return unsigned(__builtin_ctz(x));
+#endif
+}
+
+/**
+ * Finds the index of the highest set bit of a non-zero mask.
+ */
+inline unsigned bsr(std::uint32_t x) noexcept {
+    utf8pp_assert(x != 0, "The mask must not be zero!");
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanReverse(&idx, x);
+    return unsigned(idx);
+#else
+    return 31 - unsigned(__builtin_clz(x));
+#endif
+}
+
+/**
+ * Counts the set bits of a mask.
+ */
+inline unsigned popcount(std::uint32_t x) noexcept {
+#if defined(_MSC_VER)
+    return unsigned(__popcnt(x));
+#else
+    return unsigned(__builtin_popcount(x));
+#endif
+}
+
+/**
+ * Calls a function with a pointer to every occurrence of the given byte in
+ * [src, end), in order.
+ */
+template <typename Fn>
+inline void for_each_byte(utf8_byte const* src, utf8_byte const* end,
+    utf8_byte b, Fn&& fn) {
+#if UTF8PP_SSE2
+    auto needle = _mm_set1_epi8(char(b));
+    for (; end - src >= 16; src += 16) {
+        auto chunk = _mm_loadu_si128((__m128i const*)src);
+        auto mask = std::uint32_t(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        while (mask != 0) {
+            fn(src + ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; src != end; ++src) {
+        if (*src == b) fn(src);
+    }
+}
+
 } /* namespace detail */
 
 /**
@@ -172,6 +304,45 @@ read_next(utf8_byte const* src, utf8_cp& dest) noexcept {
     return result;
 }
 
+/**
+ * Same as @see parse_next, but the source is bounded by an end pointer instead
+ * of a null-terminator, so a '\0' byte is an ordinary single-byte character.
+ * @param src The pointer to the parse position.
+ * @param end The pointer to the end of the source string.
+ * @return Zero, if src == end, otherwise @see parse_next. Sequences cut off by
+ * the end of the source are reported as error::invalid_utf8.
+ */
+inline /* constexpr */ utf8_ssize
+parse_next(utf8_byte const* src, utf8_byte const* end) noexcept {
+    if (src == end) return 0;
+    if (src[0] < 0b10000000) return 1;
+    if (src[0] < 0b11000000 || src[0] > 0b11110111) return error::invalid_utf8;
+    auto avail = end - src;
+    // 2-byte encoding
+    if (avail < 2 || detail::next_byte_bad(src[1])) return error::invalid_utf8;
+    if (src[0] < 0b11100000) return 2;
+    // 3-byte encoding
+    if (avail < 3 || detail::next_byte_bad(src[2])) return error::invalid_utf8;
+    if (src[0] < 0b11110000) return 3;
+    // 4-byte encoding
+    if (avail < 4 || detail::next_byte_bad(src[3])) return error::invalid_utf8;
+    return 4;
+}
+
+/**
+ * Same as @see read_next but with the bounded @see parse_next.
+ */
+inline /* constexpr */ utf8_ssize
+read_next(utf8_byte const* src, utf8_byte const* end, utf8_cp& dest) noexcept {
+    dest = '\0';
+
+    auto result = parse_next(src, end);
+    if (result <= 0) return result;
+
+    dest = detail::calc_codepoint(src, result);
+    return result;
+}
+
 /**
  * Same as @see parse_next, but parses backwards the first UTF8 character
  * *before* the parse position.
@@ -224,6 +395,18 @@ read_prev(utf8_byte const* src_start, utf8_byte const* src,
     return result;
 }
 
+namespace detail {
+
+/**
+ * Encodes a codepoint in the range [0x80, 0x800) into 2 bytes.
+ */
+inline void encode_2byte(utf8_byte* dst, utf8_cp cp) noexcept {
+    dst[0] = utf8_byte((cp & 0b11111000000) >> 6) | 0b11000000;
+    dst[1] = utf8_byte(cp & 0b111111) | 0b10000000;
+}
+
+} /* namespace detail */
+
 /**
  * Encode a codepoint into UTF8.
  * @param dst The destination buffer where the encoded character will be
@@ -242,8 +425,7 @@ encode_cp(utf8_byte* dst, utf8_cp cp) noexcept {
     }
     // 2-byte
     if (cp < 0x800) {
-        dst[0] = utf8_byte((cp & 0b11111000000) >> 6) | 0b11000000;
-        dst[1] = utf8_byte(cp & 0b111111) | 0b10000000;
+        detail::encode_2byte(dst, cp);
         return 2;
     }
     // 3-byte
@@ -264,6 +446,7135 @@ encode_cp(utf8_byte* dst, utf8_cp cp) noexcept {
     return error::invalid_codepoint;
 }
 
+/**
+ * The direction to search in.
+ */
+enum class direction {
+    backward,
+    forward,
+};
+
+namespace detail {
+
+/**
+ * Checks if ptr is on a codepoint boundary: it is begin or end, it is not on
+ * a continuation byte, or the 3 bytes before it are all continuation bytes.
+ * The last case is a stray byte of an invalid run, no valid sequence extends
+ * that far. Only the bytes near ptr are looked at.
+ */
+inline bool is_boundary(utf8_byte const* begin, utf8_byte const* end,
+    utf8_byte const* ptr) noexcept {
+    if (ptr == begin || ptr == end || !is_continuation(*ptr)) return true;
+    if (ptr - begin < 3) return false;
+    return is_continuation(ptr[-1]) && is_continuation(ptr[-2])
+        && is_continuation(ptr[-3]);
+}
+
+} /* namespace detail */
+
+/**
+ * Moves a pointer onto the nearest codepoint boundary in the given direction.
+ * At most 3 continuation bytes are skipped, as no valid sequence has more. In
+ * an invalid run of continuation bytes every byte after the first 3 is on a
+ * boundary, so the result only depends on the bytes near the pointer, and
+ * aligning an aligned pointer does not move it.
+ * @param begin The start of the buffer.
+ * @param end The end of the buffer.
+ * @param ptr The pointer to align, begin <= ptr <= end.
+ * @param dir The direction to move the pointer in.
+ * @return The aligned pointer, ptr itself if it already is on a boundary.
+ */
+inline utf8_byte const* align_to_boundary(utf8_byte const* begin,
+    utf8_byte const* end, utf8_byte const* ptr, direction dir) noexcept {
+    utf8pp_assert(begin <= ptr && ptr <= end, "Pointer out of range!");
+
+    while (!detail::is_boundary(begin, end, ptr)) {
+        if (dir == direction::forward) ++ptr;
+        else --ptr;
+    }
+    return ptr;
+}
+
+namespace detail {
+
+/**
+ * Validates [src, end) until the first codepoint boundary at or after stop.
+ * A sequence starting before stop may be read until end.
+ * @return The position of the first error, or the boundary where validation
+ * stopped.
+ */
+inline utf8_byte const* validate_until(utf8_byte const* src,
+    utf8_byte const* stop, utf8_byte const* end) noexcept {
+    while (src < stop) {
+#if UTF8PP_SSE2
+        // Skip whole blocks of ASCII
+        if (stop - src >= 16) {
+            auto chunk = _mm_loadu_si128((__m128i const*)src);
+            if (_mm_movemask_epi8(chunk) == 0) {
+                src += 16;
+                continue;
+            }
+        }
+#endif
+        auto n = parse_next(src, end);
+        if (n < 0) return src;
+        src += n;
+    }
+    return src;
+}
+
+} /* namespace detail */
+
+/**
+ * Validates a UTF8 buffer. '\0' bytes are valid, single-byte characters.
+ * @param src The pointer to the start of the buffer.
+ * @param len The length of the buffer.
+ * @return The length of the valid prefix, which is len for a valid buffer.
+ */
+inline utf8_usize validate(utf8_byte const* src, utf8_usize len) noexcept {
+    return utf8_usize(detail::validate_until(src, src + len, src + len) - src);
+}
+
+/**
+ * Counts the codepoints in a UTF8 buffer. The buffer is not validated, every
+ * byte that is not a continuation byte is counted as one codepoint.
+ * @param src The pointer to the start of the buffer.
+ * @param len The length of the buffer.
+ * @return The number of codepoints.
+ */
+inline utf8_usize
+count_codepoints(utf8_byte const* src, utf8_usize len) noexcept {
+    utf8_usize result = 0;
+    auto end = src + len;
+#if UTF8PP_SSE2
+    // Continuation bytes are the signed bytes below -64
+    auto limit = _mm_set1_epi8(-65);
+    for (; end - src >= 16; src += 16) {
+        auto chunk = _mm_loadu_si128((__m128i const*)src);
+        auto mask = _mm_movemask_epi8(_mm_cmpgt_epi8(chunk, limit));
+        result += detail::popcount(std::uint32_t(mask));
+    }
+#endif
+    for (; src != end; ++src) result += !detail::is_continuation(*src);
+    return result;
+}
+
+/**
+ * A B-tree rope for editing large UTF8 documents. Insertion, deletion and
+ * seeking by codepoint or line are all O(log n). Every node caches the
+ * metrics of the text below it, and leaf boundaries are always kept on
+ * codepoint boundaries (as long as the stored text is valid UTF8).
+ * All offsets are byte offsets that must fall on codepoint boundaries.
+ */
+class rope {
+public:
+    /**
+     * The cached metrics of a piece of text. All of them are additive, so the
+     * metrics of a node are simply the sum of the metrics of its children.
+     */
+    struct metrics {
+        utf8_usize bytes = 0;
+        utf8_usize codepoints = 0;
+        utf8_usize newlines = 0;
+        utf8_usize utf16 = 0;
+
+        /**
+         * Calculates the metrics of the given bytes. Codepoints are counted as
+         * the non-continuation bytes, so invalid bytes count as one each.
+         */
+        static metrics of(utf8_byte const* src, utf8_usize len) noexcept {
+            metrics m;
+            m.bytes = len;
+            for (utf8_usize i = 0; i < len; ++i) {
+                auto b = src[i];
+                if (!detail::is_continuation(b)) ++m.codepoints;
+                if (b == '\n') ++m.newlines;
+                // 4-byte sequences need a surrogate pair in UTF16
+                if (b >= 0b11110000 && b <= 0b11110111) ++m.utf16;
+            }
+            m.utf16 += m.codepoints;
+            return m;
+        }
+
+        metrics& operator+=(metrics const& o) noexcept {
+            bytes += o.bytes;
+            codepoints += o.codepoints;
+            newlines += o.newlines;
+            utf16 += o.utf16;
+            return *this;
+        }
+    };
+
+    rope() : root(std::make_unique<node>()) { }
+
+    rope(utf8_byte const* src, utf8_usize len) : rope() {
+        insert(0, src, len);
+    }
+
+    rope(rope const& o) : root(clone(*o.root)) { }
+
+    /**
+     * Takes the text of another rope, which is left empty.
+     */
+    rope(rope&& o) : rope() { root.swap(o.root); }
+
+    rope& operator=(rope const& o) {
+        if (this != &o) root = clone(*o.root);
+        return *this;
+    }
+
+    /**
+     * Takes the text of another rope, which is left empty.
+     */
+    rope& operator=(rope&& o) {
+        if (this != &o) {
+            auto empty = std::make_unique<node>();
+            root = std::move(o.root);
+            o.root = std::move(empty);
+        }
+        return *this;
+    }
+
+    /**
+     * @return The metrics of the whole text.
+     */
+    metrics const& summary() const noexcept { return root->sum; }
+
+    /**
+     * @return The length of the text in bytes.
+     */
+    utf8_usize size() const noexcept { return root->sum.bytes; }
+
+    /**
+     * Inserts text at the given position.
+     * @param offset The byte offset to insert at.
+     * @param src The bytes to insert. Should be valid UTF8.
+     * @param len The number of bytes to insert.
+     */
+    void insert(utf8_usize offset, utf8_byte const* src, utf8_usize len) {
+        utf8pp_assert(offset <= size(), "Insertion offset out of range!");
+        utf8pp_assert(is_boundary(offset),
+            "Insertion offset must be on a codepoint boundary!");
+        if (len == 0) return;
+
+        std::vector<std::unique_ptr<node>> overflow;
+        insert_at(*root, offset, src, len, overflow);
+        // Grow the tree while the root overflows
+        while (!overflow.empty()) {
+            auto new_root = std::make_unique<node>();
+            new_root->children.push_back(std::move(root));
+            for (auto& n : overflow) new_root->children.push_back(std::move(n));
+            overflow.clear();
+            split_branch(*new_root, overflow);
+            root = std::move(new_root);
+        }
+    }
+
+    /**
+     * Removes a range of text.
+     * @param offset The byte offset of the start of the range.
+     * @param len The number of bytes to remove.
+     */
+    void erase(utf8_usize offset, utf8_usize len) {
+        utf8pp_assert(offset + len <= size(), "Erased range out of range!");
+        utf8pp_assert(is_boundary(offset) && is_boundary(offset + len),
+            "Erased range must be on codepoint boundaries!");
+        if (len == 0) return;
+
+        erase_at(*root, offset, len);
+        // Shrink the tree while the root has a single child
+        while (!root->is_leaf() && root->children.size() == 1) {
+            auto child = std::move(root->children.front());
+            root = std::move(child);
+        }
+    }
+
+    /**
+     * @param index The codepoint index. Can be the number of codepoints.
+     * @return The byte offset of the codepoint with the given index.
+     */
+    utf8_usize codepoint_to_byte(utf8_usize index) const noexcept {
+        utf8pp_assert(index <= summary().codepoints,
+            "Codepoint index out of range!");
+        if (index == summary().codepoints) return size();
+
+        utf8_usize base = 0;
+        node const* n = root.get();
+        while (!n->is_leaf()) {
+            for (auto const& c : n->children) {
+                if (index < c->sum.codepoints) {
+                    n = c.get();
+                    break;
+                }
+                index -= c->sum.codepoints;
+                base += c->sum.bytes;
+            }
+        }
+        for (utf8_usize i = 0; i < n->text.size(); ++i) {
+            if (detail::is_continuation(n->text[i])) continue;
+            if (index-- == 0) return base + i;
+        }
+        utf8pp_panic("Unreachable!");
+        return size();
+    }
+
+    /**
+     * @param line The zero-based line index. Can be the number of newlines.
+     * @return The byte offset of the start of the given line.
+     */
+    utf8_usize line_to_byte(utf8_usize line) const noexcept {
+        utf8pp_assert(line <= summary().newlines, "Line index out of range!");
+        if (line == 0) return 0;
+
+        utf8_usize base = 0;
+        node const* n = root.get();
+        while (!n->is_leaf()) {
+            for (auto const& c : n->children) {
+                if (line <= c->sum.newlines) {
+                    n = c.get();
+                    break;
+                }
+                line -= c->sum.newlines;
+                base += c->sum.bytes;
+            }
+        }
+        for (utf8_usize i = 0; i < n->text.size(); ++i) {
+            if (n->text[i] == '\n' && --line == 0) return base + i + 1;
+        }
+        utf8pp_panic("Unreachable!");
+        return size();
+    }
+
+    /**
+     * @param offset The byte offset.
+     * @return The metrics of the text before the given byte offset, so the
+     * codepoint index is .codepoints and the line index is .newlines.
+     */
+    metrics prefix(utf8_usize offset) const noexcept {
+        utf8pp_assert(offset <= size(), "Offset out of range!");
+
+        metrics result;
+        node const* n = root.get();
+        while (!n->is_leaf()) {
+            auto const& ch = n->children;
+            utf8_usize i = 0;
+            for (; i + 1 < ch.size() && offset >= ch[i]->sum.bytes; ++i) {
+                offset -= ch[i]->sum.bytes;
+                result += ch[i]->sum;
+            }
+            n = ch[i].get();
+        }
+        result += metrics::of(n->text.data(), offset);
+        return result;
+    }
+
+    /**
+     * Copies a range of the text into a buffer.
+     * @param offset The byte offset of the start of the range.
+     * @param len The number of bytes to copy.
+     * @param dst The destination buffer, must have room for len bytes.
+     */
+    void copy(utf8_usize offset, utf8_usize len, utf8_byte* dst) const {
+        utf8pp_assert(offset + len <= size(), "Copied range out of range!");
+        copy_at(*root, offset, len, dst);
+    }
+
+    /**
+     * Calls a function with every leaf chunk of the text in order.
+     * @param fn The function to call with (utf8_byte const*, utf8_usize).
+     */
+    template <typename Fn>
+    void for_each_chunk(Fn&& fn) const {
+        visit(*root, fn);
+    }
+
+private:
+    static constexpr utf8_usize leaf_max = 1024;
+    static constexpr utf8_usize leaf_min = leaf_max / 4;
+    static constexpr utf8_usize branch_max = 16;
+    static constexpr utf8_usize branch_min = branch_max / 4;
+
+    struct node {
+        metrics sum;
+        // Only for leaves
+        std::vector<utf8_byte> text;
+        // Only for branches, a branch always has at least one child
+        std::vector<std::unique_ptr<node>> children;
+
+        bool is_leaf() const noexcept { return children.empty(); }
+
+        bool is_underfull() const noexcept {
+            return is_leaf() ? text.size() < leaf_min
+                             : children.size() < branch_min;
+        }
+
+        void update() noexcept {
+            if (is_leaf()) {
+                sum = metrics::of(text.data(), text.size());
+                return;
+            }
+            sum = metrics();
+            for (auto const& c : children) sum += c->sum;
+        }
+    };
+
+    std::unique_ptr<node> root;
+
+    static std::unique_ptr<node> clone(node const& n) {
+        auto result = std::make_unique<node>();
+        result->sum = n.sum;
+        result->text = n.text;
+        for (auto const& c : n.children) result->children.push_back(clone(*c));
+        return result;
+    }
+
+    template <typename Fn>
+    static void visit(node const& n, Fn& fn) {
+        if (n.is_leaf()) {
+            if (!n.text.empty()) fn(n.text.data(), n.text.size());
+            return;
+        }
+        for (auto const& c : n.children) visit(*c, fn);
+    }
+
+    static void copy_at(node const& n, utf8_usize offset, utf8_usize len,
+        utf8_byte*& dst) noexcept {
+        if (n.is_leaf()) {
+            std::memcpy(dst, n.text.data() + offset, len);
+            dst += len;
+            return;
+        }
+        for (auto const& c : n.children) {
+            if (len == 0) break;
+            if (offset >= c->sum.bytes) {
+                offset -= c->sum.bytes;
+                continue;
+            }
+            auto cnt = std::min(c->sum.bytes - offset, len);
+            copy_at(*c, offset, cnt, dst);
+            len -= cnt;
+            offset = 0;
+        }
+    }
+
+    bool is_boundary(utf8_usize offset) const noexcept {
+        if (offset == size()) return true;
+        utf8_byte b = 0;
+        copy(offset, 1, &b);
+        return !detail::is_continuation(b);
+    }
+
+    /**
+     * Splits an oversized leaf, the pieces after the first one are appended to
+     * overflow.
+     */
+    static void split_leaf(node& n,
+        std::vector<std::unique_ptr<node>>& overflow) {
+        auto& text = n.text;
+        std::vector<utf8_usize> cuts;
+        utf8_usize pos = 0;
+        while (text.size() - pos > leaf_max) {
+            auto cut = text.data() + pos + leaf_max / 2;
+            pos = utf8_usize(align_to_boundary(text.data(),
+                text.data() + text.size(), cut, direction::backward)
+                - text.data());
+            cuts.push_back(pos);
+        }
+        for (utf8_usize i = 0; i < cuts.size(); ++i) {
+            auto end = i + 1 < cuts.size() ? cuts[i + 1] : text.size();
+            auto piece = std::make_unique<node>();
+            piece->text.assign(text.begin() + cuts[i], text.begin() + end);
+            piece->update();
+            overflow.push_back(std::move(piece));
+        }
+        if (!cuts.empty()) text.resize(cuts.front());
+        n.update();
+    }
+
+    /**
+     * Splits an oversized branch, the branches after the first one are
+     * appended to overflow.
+     */
+    static void split_branch(node& n,
+        std::vector<std::unique_ptr<node>>& overflow) {
+        auto& ch = n.children;
+        if (ch.size() > branch_max) {
+            auto groups = (ch.size() + branch_max - 1) / branch_max;
+            auto per_group = (ch.size() + groups - 1) / groups;
+            for (auto i = per_group; i < ch.size(); i += per_group) {
+                auto piece = std::make_unique<node>();
+                auto end = std::min(i + per_group, ch.size());
+                for (auto j = i; j < end; ++j) {
+                    piece->children.push_back(std::move(ch[j]));
+                }
+                piece->update();
+                overflow.push_back(std::move(piece));
+            }
+            ch.resize(per_group);
+        }
+        n.update();
+    }
+
+    static void insert_at(node& n, utf8_usize offset,
+        utf8_byte const* src, utf8_usize len,
+        std::vector<std::unique_ptr<node>>& overflow) {
+        if (n.is_leaf()) {
+            n.text.insert(n.text.begin() + offset, src, src + len);
+            split_leaf(n, overflow);
+            return;
+        }
+
+        auto& ch = n.children;
+        utf8_usize i = 0;
+        for (; i + 1 < ch.size() && offset > ch[i]->sum.bytes; ++i) {
+            offset -= ch[i]->sum.bytes;
+        }
+        std::vector<std::unique_ptr<node>> child_overflow;
+        insert_at(*ch[i], offset, src, len, child_overflow);
+        ch.insert(ch.begin() + i + 1,
+            std::make_move_iterator(child_overflow.begin()),
+            std::make_move_iterator(child_overflow.end()));
+        split_branch(n, overflow);
+    }
+
+    /**
+     * Merges the underfull child at index i with one of its neighbors.
+     * @return The index of the merged child.
+     */
+    static utf8_usize merge_child(node& n, utf8_usize i) {
+        auto& ch = n.children;
+        if (i + 1 == ch.size()) --i;
+
+        auto& left = *ch[i];
+        auto& right = *ch[i + 1];
+        std::vector<std::unique_ptr<node>> overflow;
+        if (left.is_leaf()) {
+            left.text.insert(left.text.end(),
+                right.text.begin(), right.text.end());
+            split_leaf(left, overflow);
+        }
+        else {
+            for (auto& c : right.children) {
+                left.children.push_back(std::move(c));
+            }
+            split_branch(left, overflow);
+        }
+        ch.erase(ch.begin() + i + 1);
+        ch.insert(ch.begin() + i + 1,
+            std::make_move_iterator(overflow.begin()),
+            std::make_move_iterator(overflow.end()));
+        return i;
+    }
+
+    static void erase_at(node& n, utf8_usize offset, utf8_usize len) {
+        if (n.is_leaf()) {
+            n.text.erase(n.text.begin() + offset,
+                n.text.begin() + offset + len);
+            n.update();
+            return;
+        }
+
+        auto& ch = n.children;
+        for (utf8_usize i = 0; i < ch.size() && len > 0; ++i) {
+            auto csize = ch[i]->sum.bytes;
+            if (offset >= csize) {
+                offset -= csize;
+                continue;
+            }
+            auto cnt = csize - offset < len ? csize - offset : len;
+            erase_at(*ch[i], offset, cnt);
+            len -= cnt;
+            offset = 0;
+        }
+        // Drop the emptied children and merge the underfull ones
+        for (utf8_usize i = 0; i < ch.size();) {
+            if (ch[i]->sum.bytes == 0) ch.erase(ch.begin() + i);
+            else if (ch.size() > 1 && ch[i]->is_underfull()) {
+                i = merge_child(n, i);
+                if (!ch[i]->is_underfull() || ch.size() == 1) ++i;
+            }
+            else ++i;
+        }
+        // Keep the branch invariant of having at least one child
+        if (ch.empty()) ch.push_back(std::make_unique<node>());
+        n.update();
+    }
+};
+
+/**
+ * The units a column can be measured in. Language servers usually count in
+ * UTF16 code units.
+ */
+enum class column_unit {
+    bytes,
+    codepoints,
+    utf16,
+};
+
+/**
+ * A zero-based line and column pair.
+ */
+struct text_position {
+    utf8_usize line = 0;
+    utf8_usize column = 0;
+};
+
+/**
+ * An index of line starts in a UTF8 text, for converting between byte offsets
+ * and line-column positions. Lines are terminated by '\n', a '\r' right before
+ * it is not counted as part of the line. The index does not own the text, so
+ * the conversions take the text as a parameter, and only decode the target
+ * line. Invalid bytes count as a single unit in every column unit.
+ */
+class line_index {
+public:
+    line_index() : starts{ 0 } { }
+
+    line_index(utf8_byte const* src, utf8_usize len) : line_index() {
+        scan(src, 0, len, starts);
+    }
+
+    /**
+     * @return The number of lines, which is the number of newlines plus one.
+     */
+    utf8_usize line_count() const noexcept { return starts.size(); }
+
+    /**
+     * @return The byte offset of the start of the given line.
+     */
+    utf8_usize line_start(utf8_usize line) const noexcept {
+        utf8pp_assert(line < line_count(), "Line index out of range!");
+        return starts[line];
+    }
+
+    /**
+     * @return The index of the line containing the given byte offset.
+     */
+    utf8_usize line_of(utf8_usize offset) const noexcept {
+        auto it = std::upper_bound(starts.begin(), starts.end(), offset);
+        return utf8_usize(it - starts.begin()) - 1;
+    }
+
+    /**
+     * Converts a byte offset into a line-column position.
+     * @param src The indexed text.
+     * @param len The length of the indexed text.
+     * @param offset The byte offset, should be on a codepoint boundary.
+     * @param unit The unit to measure the column in.
+     * @return The position of the offset.
+     */
+    text_position to_position(utf8_byte const* src, utf8_usize len,
+        utf8_usize offset, column_unit unit) const noexcept {
+        utf8pp_assert(offset <= len, "Offset out of range!");
+        (void)len;
+
+        text_position result;
+        result.line = line_of(offset);
+        auto start = starts[result.line];
+        if (unit == column_unit::bytes) {
+            result.column = offset - start;
+            return result;
+        }
+        measure(src + start, src + offset, unit, ~utf8_usize(0),
+            result.column);
+        return result;
+    }
+
+    /**
+     * Converts a line-column position into a byte offset. Like in the language
+     * server protocol, columns past the end of the line are clamped to the end
+     * of the line, and columns in the middle of a character are moved back to
+     * its start.
+     * @param src The indexed text.
+     * @param len The length of the indexed text.
+     * @param pos The position to convert. The line must be in range.
+     * @param unit The unit the column is measured in.
+     * @return The byte offset of the position.
+     */
+    utf8_usize to_offset(utf8_byte const* src, utf8_usize len,
+        text_position pos, column_unit unit) const noexcept {
+        utf8pp_assert(pos.line < line_count(), "Line index out of range!");
+
+        auto start = starts[pos.line];
+        auto end = line_end(src, len, pos.line);
+        if (unit == column_unit::bytes) {
+            auto line_len = end - start;
+            return start + (pos.column < line_len ? pos.column : line_len);
+        }
+        utf8_usize column = 0;
+        return start + measure(src + start, src + end, unit, pos.column,
+            column);
+    }
+
+    /**
+     * Updates the index after the text has been edited, without rescanning
+     * anything but the inserted bytes.
+     * @param src The text after the edit.
+     * @param len The length of the text after the edit.
+     * @param offset The byte offset of the edit.
+     * @param removed The number of bytes removed at offset.
+     * @param inserted The number of bytes inserted at offset.
+     */
+    void update(utf8_byte const* src, utf8_usize len, utf8_usize offset,
+        utf8_usize removed, utf8_usize inserted) {
+        utf8pp_assert(offset + inserted <= len, "Edit out of range!");
+        (void)len;
+
+        // Line starts right after a removed newline are gone
+        auto first = std::upper_bound(starts.begin(), starts.end(), offset);
+        auto last = std::upper_bound(first, starts.end(), offset + removed);
+        auto at = starts.erase(first, last);
+        for (auto it = at; it != starts.end(); ++it) {
+            *it = *it - removed + inserted;
+        }
+        std::vector<utf8_usize> added;
+        scan(src, offset, offset + inserted, added);
+        starts.insert(at, added.begin(), added.end());
+    }
+
+private:
+    // The byte offsets of the line starts, starts[0] is always 0
+    std::vector<utf8_usize> starts;
+
+    static void scan(utf8_byte const* src, utf8_usize from, utf8_usize to,
+        std::vector<utf8_usize>& out) {
+        detail::for_each_byte(src + from, src + to, '\n',
+            [&](utf8_byte const* p) {
+                out.push_back(utf8_usize(p - src) + 1);
+            });
+    }
+
+    utf8_usize line_end(utf8_byte const* src, utf8_usize len,
+        utf8_usize line) const noexcept {
+        if (line + 1 == line_count()) return len;
+        auto end = starts[line + 1] - 1;
+        if (end > starts[line] && src[end - 1] == '\r') --end;
+        return end;
+    }
+
+    /**
+     * Decodes [src, end) until either the end or the column limit is reached.
+     * @return The number of bytes consumed, the measured column is written
+     * to column.
+     */
+    static utf8_usize measure(utf8_byte const* src, utf8_byte const* end,
+        column_unit unit, utf8_usize limit, utf8_usize& column) noexcept {
+        auto it = src;
+        column = 0;
+        while (it != end) {
+            utf8_cp cp = 0;
+            auto n = read_next(it, end, cp);
+            utf8_usize width = 1;
+            if (n < 0) n = 1;
+            else if (unit == column_unit::utf16 && cp >= 0x10000) width = 2;
+            if (column + width > limit) break;
+            column += width;
+            it += n;
+        }
+        return utf8_usize(it - src);
+    }
+};
+
+/**
+ * A read-only memory-mapped file. The mapping is advised for sequential
+ * access and huge pages where the platform supports it.
+ */
+class mapped_file {
+public:
+    mapped_file() noexcept = default;
+
+    /**
+     * Maps the file at the given path. @see is_open to check the result.
+     */
+    explicit mapped_file(char const* path) noexcept {
+        open(path);
+    }
+
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    mapped_file(mapped_file&& o) noexcept {
+        *this = std::move(o);
+    }
+
+    mapped_file& operator=(mapped_file&& o) noexcept {
+        if (this != &o) {
+            close();
+            ptr = o.ptr;
+            len = o.len;
+            opened = o.opened;
+            o.ptr = nullptr;
+            o.len = 0;
+            o.opened = false;
+        }
+        return *this;
+    }
+
+    ~mapped_file() {
+        close();
+    }
+
+    /**
+     * Maps the file at the given path, closing the previous mapping.
+     * @param path The path of the file.
+     * @return True, if the file was mapped successfully.
+     */
+    bool open(char const* path) noexcept {
+        close();
+#if UTF8PP_WINDOWS
+        auto file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size)) {
+            CloseHandle(file);
+            return false;
+        }
+        len = utf8_usize(file_size.QuadPart);
+        if (len > 0) {
+            auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY,
+                0, 0, nullptr);
+            if (mapping != nullptr) {
+                ptr = (utf8_byte const*)MapViewOfFile(mapping, FILE_MAP_READ,
+                    0, 0, 0);
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        len = utf8_usize(st.st_size);
+        if (len > 0) {
+            auto p = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                ptr = (utf8_byte const*)p;
+                madvise(p, len, MADV_SEQUENTIAL);
+#   ifdef MADV_HUGEPAGE
+                madvise(p, len, MADV_HUGEPAGE);
+#   endif
+            }
+        }
+        ::close(fd);
+#endif
+        if (len > 0 && ptr == nullptr) {
+            len = 0;
+            return false;
+        }
+        opened = true;
+        return true;
+    }
+
+    /**
+     * Unmaps the file.
+     */
+    void close() noexcept {
+        if (ptr != nullptr) {
+#if UTF8PP_WINDOWS
+            UnmapViewOfFile(ptr);
+#else
+            munmap((void*)ptr, len);
+#endif
+        }
+        ptr = nullptr;
+        len = 0;
+        opened = false;
+    }
+
+    bool is_open() const noexcept { return opened; }
+    utf8_byte const* data() const noexcept { return ptr; }
+    utf8_usize size() const noexcept { return len; }
+    utf8_byte const* begin() const noexcept { return ptr; }
+    utf8_byte const* end() const noexcept { return ptr + len; }
+
+private:
+    utf8_byte const* ptr = nullptr;
+    utf8_usize len = 0;
+    bool opened = false;
+};
+
+namespace detail {
+
+/**
+ * Buffers smaller than this are not worth splitting between threads.
+ */
+inline constexpr utf8_usize min_parallel_chunk = 1 << 16;
+
+/**
+ * Splits a buffer into at most the given number of chunks that start on
+ * codepoint boundaries.
+ * @param threads The number of chunks, zero means one per core.
+ * @return The chunk starts, with the end of the buffer appended.
+ */
+inline std::vector<utf8_byte const*>
+split_chunks(utf8_byte const* src, utf8_usize len, utf8_usize threads) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (len / min_parallel_chunk < threads) threads = len / min_parallel_chunk;
+    if (threads == 0) threads = 1;
+
+    std::vector<utf8_byte const*> starts;
+    starts.push_back(src);
+    for (utf8_usize i = 1; i < threads; ++i) {
+        auto p = align_to_boundary(src, src + len, src + len / threads * i,
+            direction::forward);
+        if (p > starts.back()) starts.push_back(p);
+    }
+    starts.push_back(src + len);
+    return starts;
+}
+
+/**
+ * Runs a function for each chunk in a separate thread.
+ * @param starts The chunk starts, @see split_chunks.
+ * @param fn The function to call with (chunk index, chunk start, chunk end).
+ */
+template <typename Fn>
+inline void
+run_parallel(std::vector<utf8_byte const*> const& starts, Fn&& fn) {
+    std::vector<std::thread> workers;
+    for (utf8_usize i = 1; i + 1 < starts.size(); ++i) {
+        workers.emplace_back([&fn, &starts, i]() {
+            fn(i, starts[i], starts[i + 1]);
+        });
+    }
+    fn(utf8_usize(0), starts[0], starts[1]);
+    for (auto& w : workers) w.join();
+}
+
+} /* namespace detail */
+
+/**
+ * Same as @see validate, but splits the buffer between multiple threads.
+ * @param threads The number of threads to use, zero means one per core.
+ */
+inline utf8_usize
+parallel_validate(utf8_byte const* src, utf8_usize len,
+    utf8_usize threads = 0) {
+    auto starts = detail::split_chunks(src, len, threads);
+    std::vector<utf8_byte const*> reached(starts.size() - 1);
+    detail::run_parallel(starts,
+        [&](utf8_usize i, utf8_byte const* begin, utf8_byte const* stop) {
+            reached[i] = detail::validate_until(begin, stop, src + len);
+        });
+    // Fix-up: a chunk that did not end exactly where the next one starts
+    // either had an error, or the next one started with continuation bytes
+    // that no sequence of this chunk covered
+    for (utf8_usize i = 0; i + 1 < starts.size(); ++i) {
+        if (reached[i] != starts[i + 1]) return utf8_usize(reached[i] - src);
+    }
+    return len;
+}
+
+/**
+ * Same as @see count_codepoints, but splits the buffer between multiple
+ * threads.
+ * @param threads The number of threads to use, zero means one per core.
+ */
+inline utf8_usize parallel_count_codepoints(utf8_byte const* src,
+    utf8_usize len, utf8_usize threads = 0) {
+    auto starts = detail::split_chunks(src, len, threads);
+    std::vector<utf8_usize> counts(starts.size() - 1);
+    detail::run_parallel(starts,
+        [&](utf8_usize i, utf8_byte const* begin, utf8_byte const* stop) {
+            counts[i] = count_codepoints(begin, utf8_usize(stop - begin));
+        });
+    utf8_usize result = 0;
+    for (auto c : counts) result += c;
+    return result;
+}
+
+using tables::grapheme_break;
+
+namespace detail {
+
+/**
+ * Looks up the value of a codepoint in a generated range table.
+ */
+template <typename T, std::size_t N>
+inline T lookup_range(std::uint32_t const (&starts)[N], T const* values,
+    utf8_cp cp) noexcept {
+    auto it = std::upper_bound(starts, starts + N, cp);
+    return values[(it - starts) - 1];
+}
+
+} /* namespace detail */
+
+/**
+ * @return The Grapheme_Cluster_Break property of a codepoint.
+ */
+inline grapheme_break get_grapheme_break(utf8_cp cp) noexcept {
+    return grapheme_break(detail::lookup_range(tables::grapheme_break_starts,
+        tables::grapheme_break_values, cp));
+}
+
+using tables::general_category;
+
+/**
+ * @return The General_Category property of a codepoint.
+ */
+inline general_category get_general_category(utf8_cp cp) noexcept {
+    return general_category(detail::lookup_range(
+        tables::general_category_starts, tables::general_category_values, cp));
+}
+
+/**
+ * Checks if there is an extended grapheme cluster boundary between two
+ * codepoints, by the rules of UAX #29. Only the two codepoints are looked at,
+ * so the rules that need more context (emoji ZWJ sequences and regional
+ * indicator pairs) are treated as no boundary. GB9c is not applied, as the
+ * tables have no Indic_Conjunct_Break property, so a boundary is reported
+ * between a virama and a following consonant. Apart from that, a reported
+ * boundary is always a real boundary, but not the other way around.
+ * @param prev The property of the codepoint before the position.
+ * @param next The property of the codepoint after the position.
+ * @return True, if the position is a boundary.
+ */
+inline bool
+is_grapheme_boundary(grapheme_break prev, grapheme_break next) noexcept {
+    using gb = grapheme_break;
+
+    auto is_control = [](gb g) {
+        return g == gb::cr || g == gb::lf || g == gb::control;
+    };
+
+    // GB3
+    if (prev == gb::cr && next == gb::lf) return false;
+    // GB4, GB5
+    if (is_control(prev) || is_control(next)) return true;
+    // GB6
+    if (prev == gb::l && (next == gb::l || next == gb::v || next == gb::lv
+        || next == gb::lvt)) return false;
+    // GB7
+    if ((prev == gb::lv || prev == gb::v) && (next == gb::v || next == gb::t)) {
+        return false;
+    }
+    // GB8
+    if ((prev == gb::lvt || prev == gb::t) && next == gb::t) return false;
+    // GB9, GB9a
+    if (next == gb::extend || next == gb::zwj || next == gb::spacing_mark) {
+        return false;
+    }
+    // GB9b
+    if (prev == gb::prepend) return false;
+    // GB11, without checking the start of the sequence
+    if (prev == gb::zwj && next == gb::extended_pictographic) return false;
+    // GB12, GB13, without counting the preceding indicators
+    if (prev == gb::regional_indicator && next == gb::regional_indicator) {
+        return false;
+    }
+    // GB999
+    return true;
+}
+
+/**
+ * The kinds of boundaries text can be split at.
+ */
+enum class boundary_kind {
+    codepoint,
+    grapheme,
+    line,
+};
+
+/**
+ * A contiguous piece of a buffer.
+ */
+struct text_span {
+    utf8_byte const* begin = nullptr;
+    utf8_byte const* end = nullptr;
+};
+
+/**
+ * Finds the first boundary of the given kind at or after a pointer. Invalid
+ * bytes are treated as separate codepoints, and lines end after a '\n'.
+ * Grapheme boundaries are conservative except for Indic conjuncts (GB9c),
+ * which may be split, @see is_grapheme_boundary.
+ * @param begin The start of the buffer.
+ * @param end The end of the buffer.
+ * @param ptr The pointer to start the search at, begin <= ptr <= end.
+ * @param kind The kind of boundary to find.
+ * @return The pointer to the boundary, or end.
+ */
+inline utf8_byte const* next_boundary(utf8_byte const* begin,
+    utf8_byte const* end, utf8_byte const* ptr, boundary_kind kind) noexcept {
+    if (kind == boundary_kind::line) {
+        if (ptr == begin || ptr[-1] == '\n') return ptr;
+        auto nl = std::memchr(ptr, '\n', utf8_usize(end - ptr));
+        return nl == nullptr ? end : (utf8_byte const*)nl + 1;
+    }
+
+    ptr = align_to_boundary(begin, end, ptr, direction::forward);
+    if (kind == boundary_kind::codepoint) return ptr;
+
+    while (ptr != begin && ptr != end) {
+        utf8_cp prev = 0;
+        utf8_cp next = 0;
+        auto prev_len = read_prev(begin, ptr, prev);
+        auto next_len = read_next(ptr, end, next);
+        if (prev_len <= 0 || next_len < 0) break;
+        if (is_grapheme_boundary(get_grapheme_break(prev),
+            get_grapheme_break(next))) {
+            break;
+        }
+        ptr += next_len;
+    }
+    return ptr;
+}
+
+/**
+ * Splits a buffer into at most n chunks of roughly equal size, that all start
+ * and end on the given kind of boundary. The result is a plain random-access
+ * sequence, so it can be handed to any executor. For recursive splitting,
+ * @see next_boundary can be used directly.
+ * @param src The pointer to the start of the buffer.
+ * @param len The length of the buffer.
+ * @param n The desired number of chunks.
+ * @param kind The kind of boundary to split at.
+ * @return The non-empty chunks in order, covering the whole buffer.
+ */
+inline std::vector<text_span> partition(utf8_byte const* src, utf8_usize len,
+    utf8_usize n, boundary_kind kind) {
+    std::vector<text_span> result;
+    if (n == 0) n = 1;
+
+    auto end = src + len;
+    auto prev = src;
+    for (utf8_usize i = 1; i <= n; ++i) {
+        auto cut = end;
+        if (i < n) cut = next_boundary(src, end, src + len / n * i, kind);
+        if (cut <= prev) continue;
+        result.push_back({ prev, cut });
+        prev = cut;
+    }
+    return result;
+}
+
+/**
+ * The result of a bulk conversion.
+ */
+struct convert_result {
+    /**
+     * Zero on success, or a negative error code.
+     */
+    utf8_ssize error = 0;
+
+    /**
+     * The number of source bytes consumed. On error, this is the offset of
+     * the offending sequence.
+     */
+    utf8_usize read = 0;
+
+    /**
+     * The number of bytes written to the destination.
+     */
+    utf8_usize written = 0;
+};
+
+namespace detail {
+
+/**
+ * Copies the leading 16-byte blocks of ASCII.
+ * @tparam StopAtNul True, if blocks containing '\0' should not be copied.
+ * @return The number of bytes copied.
+ */
+template <bool StopAtNul = false>
+inline utf8_usize
+copy_ascii(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    utf8_usize i = 0;
+#if UTF8PP_SSE2
+    for (; len - i >= 16; i += 16) {
+        auto chunk = _mm_loadu_si128((__m128i const*)(src + i));
+        auto mask = _mm_movemask_epi8(chunk);
+        if constexpr (StopAtNul) {
+            mask |= _mm_movemask_epi8(
+                _mm_cmpeq_epi8(chunk, _mm_setzero_si128()));
+        }
+        if (mask != 0) break;
+        _mm_storeu_si128((__m128i*)(dst + i), chunk);
+    }
+#else
+    (void)src;
+    (void)len;
+    (void)dst;
+#endif
+    return i;
+}
+
+/**
+ * Converts UTF8 into a single-byte encoding.
+ * @param encode The function mapping a codepoint to a byte, or -1.
+ */
+template <typename Encode>
+inline convert_result utf8_to_single_byte(utf8_byte const* src,
+    utf8_usize len, utf8_byte* dst, Encode&& encode) noexcept {
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        auto ascii = copy_ascii(src + result.read, len - result.read,
+            dst + result.written);
+        result.read += ascii;
+        result.written += ascii;
+        if (result.read == len) break;
+
+        utf8_cp cp = 0;
+        auto n = read_next(src + result.read, end, cp);
+        if (n < 0) {
+            result.error = error::invalid_utf8;
+            return result;
+        }
+        int b = encode(cp);
+        if (b < 0) {
+            result.error = error::unmappable;
+            return result;
+        }
+        dst[result.written++] = utf8_byte(b);
+        result.read += utf8_usize(n);
+    }
+    return result;
+}
+
+} /* namespace detail */
+
+/**
+ * Converts ISO-8859-1 (Latin-1) text to UTF8. This never fails, as Latin-1
+ * maps byte by byte to the first 256 codepoints.
+ * @param src The Latin-1 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 2 * len bytes.
+ * @return The number of bytes written.
+ */
+inline utf8_usize
+latin1_to_utf8(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    utf8_usize i = 0;
+    utf8_usize written = 0;
+    while (i < len) {
+#if UTF8PP_SSE2
+        if (len - i >= 16) {
+            auto chunk = _mm_loadu_si128((__m128i const*)(src + i));
+            auto mask = _mm_movemask_epi8(chunk);
+            if (mask == 0) {
+                _mm_storeu_si128((__m128i*)(dst + written), chunk);
+                i += 16;
+                written += 16;
+                continue;
+            }
+            if (mask == 0xffff) {
+                // Every byte expands to 2, interleave the leads with the
+                // continuation bytes
+                auto lead = _mm_or_si128(
+                    _mm_and_si128(_mm_srli_epi16(chunk, 6), _mm_set1_epi8(1)),
+                    _mm_set1_epi8(char(0b11000010)));
+                auto cont = _mm_or_si128(
+                    _mm_and_si128(chunk, _mm_set1_epi8(0b00111111)),
+                    _mm_set1_epi8(char(0b10000000)));
+                _mm_storeu_si128((__m128i*)(dst + written),
+                    _mm_unpacklo_epi8(lead, cont));
+                _mm_storeu_si128((__m128i*)(dst + written + 16),
+                    _mm_unpackhi_epi8(lead, cont));
+                i += 16;
+                written += 32;
+                continue;
+            }
+        }
+#endif
+        auto b = src[i++];
+        if (b < 0x80) {
+            dst[written++] = b;
+        }
+        else {
+            detail::encode_2byte(dst + written, b);
+            written += 2;
+        }
+    }
+    return written;
+}
+
+/**
+ * Checks if a UTF8 buffer is valid and only contains codepoints below 0x100,
+ * so it can be converted to Latin-1.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @return True, if the buffer fits in Latin-1.
+ */
+inline bool fits_in_latin1(utf8_byte const* src, utf8_usize len) noexcept {
+    // Leads above 0xC3 encode codepoints above 0xFF
+    utf8_usize i = 0;
+#if UTF8PP_SSE2
+    auto max = _mm_setzero_si128();
+    for (; len - i >= 16; i += 16) {
+        max = _mm_max_epu8(max,
+            _mm_loadu_si128((__m128i const*)(src + i)));
+    }
+    auto over = _mm_cmpeq_epi8(_mm_max_epu8(max, _mm_set1_epi8(char(0xc3))),
+        _mm_set1_epi8(char(0xc3)));
+    if (_mm_movemask_epi8(over) != 0xffff) return false;
+#endif
+    for (; i < len; ++i) {
+        if (src[i] > 0xc3) return false;
+    }
+    return validate(src, len) == len;
+}
+
+/**
+ * Converts UTF8 text to ISO-8859-1 (Latin-1).
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @return The conversion result, the error is error::invalid_utf8 or
+ * error::unmappable for codepoints above 0xFF.
+ */
+inline convert_result
+utf8_to_latin1(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    return detail::utf8_to_single_byte(src, len, dst,
+        [](utf8_cp cp) { return cp < 0x100 ? int(cp) : -1; });
+}
+
+namespace detail {
+
+/**
+ * Looks up a codepoint in a generated reverse index.
+ * @return The code the codepoint maps to, or zero if it is unmapped.
+ */
+template <std::size_t N1, typename T1, std::size_t N2, typename T2>
+inline T2 lookup_reverse(std::uint32_t limit, T1 const (&stage1)[N1],
+    T2 const (&stage2)[N2], utf8_cp cp) noexcept {
+    constexpr auto block_size = tables::reverse_block_size;
+    if (cp >= limit) return 0;
+    return stage2[stage1[cp / block_size] * block_size + cp % block_size];
+}
+
+} /* namespace detail */
+
+/**
+ * Converts text in a single-byte legacy codepage to UTF8.
+ * @tparam Codepage The codepage descriptor, one of the types in the codepage
+ * namespace (like codepage::iso_8859_2).
+ * @param src The source text.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 3 * len bytes.
+ * @return The conversion result, the error is error::unmappable for bytes the
+ * codepage leaves undefined.
+ */
+template <typename Codepage>
+inline convert_result codepage_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    convert_result result;
+    while (result.read < len) {
+        auto ascii = detail::copy_ascii(src + result.read, len - result.read,
+            dst + result.written);
+        result.read += ascii;
+        result.written += ascii;
+        if (result.read == len) break;
+
+        utf8_cp cp = src[result.read];
+        if (cp >= 0x80) cp = Codepage::decode[cp - 0x80];
+        if (cp == 0 && src[result.read] != 0) {
+            result.error = error::unmappable;
+            return result;
+        }
+        result.written += utf8_usize(encode_cp(dst + result.written, cp));
+        ++result.read;
+    }
+    return result;
+}
+
+/**
+ * Converts UTF8 text to a single-byte legacy codepage.
+ * @tparam Codepage The codepage descriptor, @see codepage_to_utf8.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @return The conversion result, the error is error::invalid_utf8 or
+ * error::unmappable.
+ */
+template <typename Codepage>
+inline convert_result utf8_to_codepage(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::utf8_to_single_byte(src, len, dst, [](utf8_cp cp) {
+        if (cp < 0x80) return int(cp);
+        auto b = detail::lookup_reverse(Codepage::encode_limit,
+            Codepage::encode_stage1, Codepage::encode_stage2, cp);
+        return b == 0 ? -1 : int(b);
+    });
+}
+
+/**
+ * Converts Windows-1252 text to UTF8, the same as
+ * codepage_to_utf8<codepage::windows_1252>.
+ * @param src The Windows-1252 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 3 * len bytes.
+ * @return The conversion result, the error is error::unmappable for the 5
+ * bytes Windows-1252 leaves undefined.
+ */
+inline convert_result
+cp1252_to_utf8(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    return codepage_to_utf8<codepage::windows_1252>(src, len, dst);
+}
+
+/**
+ * Converts UTF8 text to Windows-1252, the same as
+ * utf8_to_codepage<codepage::windows_1252>.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @return The conversion result, the error is error::invalid_utf8 or
+ * error::unmappable.
+ */
+inline convert_result
+utf8_to_cp1252(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    return utf8_to_codepage<codepage::windows_1252>(src, len, dst);
+}
+
+namespace detail {
+
+inline constexpr bool is_surrogate(utf8_cp cp) noexcept {
+    return cp >= 0xd800 && cp < 0xe000;
+}
+
+/**
+ * Same as the bounded @see parse_next, but also rejects overlong sequences,
+ * surrogates and codepoints above U+10FFFF.
+ */
+inline utf8_ssize
+parse_strict(utf8_byte const* src, utf8_byte const* end) noexcept {
+    auto n = parse_next(src, end);
+    if (n <= 1) return n;
+    auto cp = calc_codepoint(src, utf8_usize(n));
+    bool shortest = n == 2 ? cp >= 0x80 : n == 3 ? cp >= 0x800 : cp >= 0x10000;
+    if (!shortest || is_surrogate(cp) || cp > 0x10ffff) {
+        return error::invalid_utf8;
+    }
+    return n;
+}
+
+/**
+ * Checks if the source ends in a truncated, but otherwise valid UTF8 sequence.
+ */
+inline bool
+is_truncated_utf8(utf8_byte const* src, utf8_byte const* end) noexcept {
+    if (src[0] < 0b11000000 || src[0] > 0b11110111) return false;
+    auto need = src[0] < 0b11100000 ? 2 : src[0] < 0b11110000 ? 3 : 4;
+    if (end - src >= need) return false;
+    for (auto it = src + 1; it != end; ++it) {
+        if (!is_continuation(*it)) return false;
+    }
+    return true;
+}
+
+/**
+ * Looks up the codepoint of a pointer in a generated index.
+ * @return The codepoint, or zero if the pointer is unmapped.
+ */
+template <typename T, std::size_t N>
+inline utf8_cp index_codepoint(T const (&index)[N],
+    utf8_usize pointer) noexcept {
+    return pointer < N ? utf8_cp(index[pointer]) : 0;
+}
+
+/**
+ * Looks up the pointers of a codepoint in a generated index, by binary
+ * searching the pointers sorted by codepoint.
+ * @return The range of the pointers mapping to the codepoint, ascending.
+ */
+template <typename T, std::size_t N, std::size_t M>
+inline std::pair<std::uint16_t const*, std::uint16_t const*>
+index_pointers(T const (&index)[N], std::uint16_t const (&by_codepoint)[M],
+    utf8_cp cp) noexcept {
+    auto first = std::lower_bound(by_codepoint, by_codepoint + M, cp,
+        [&](std::uint16_t p, utf8_cp c) { return index[p] < c; });
+    auto last = std::upper_bound(first, by_codepoint + M, cp,
+        [&](utf8_cp c, std::uint16_t p) { return c < index[p]; });
+    return { first, last };
+}
+
+/**
+ * Looks up the first pointer of a codepoint in a generated index.
+ * @return The pointer, or -1 if the codepoint is not in the index.
+ */
+template <typename T, std::size_t N, std::size_t M>
+inline std::int32_t index_pointer(T const (&index)[N],
+    std::uint16_t const (&by_codepoint)[M], utf8_cp cp) noexcept {
+    auto pointers = index_pointers(index, by_codepoint, cp);
+    return pointers.first == pointers.second ? -1 : *pointers.first;
+}
+
+/**
+ * Converts a multi-byte legacy encoding with an ASCII lower half to UTF8.
+ * @param decode The function decoding a non-ASCII character, called with
+ * (src, end, utf8_cp&). Returns the number of bytes consumed, or a negative
+ * error code.
+ */
+template <typename Decode>
+inline convert_result multi_byte_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst, Decode&& decode) noexcept {
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        auto ascii = copy_ascii(src + result.read, len - result.read,
+            dst + result.written);
+        result.read += ascii;
+        result.written += ascii;
+        if (result.read == len) break;
+
+        if (src[result.read] < 0x80) {
+            dst[result.written++] = src[result.read++];
+            continue;
+        }
+        utf8_cp cp = 0;
+        auto n = decode(src + result.read, end, cp);
+        if (n < 0) {
+            result.error = n;
+            return result;
+        }
+        result.written += utf8_usize(encode_cp(dst + result.written, cp));
+        result.read += utf8_usize(n);
+    }
+    return result;
+}
+
+/**
+ * Converts UTF8 to a multi-byte legacy encoding with an ASCII lower half.
+ * Overlongs, surrogates and codepoints above U+10FFFF are invalid UTF8.
+ * @param encode The function encoding a non-ASCII codepoint, called with
+ * (utf8_cp, utf8_byte*). Returns the number of bytes written, or -1 if the
+ * codepoint is unmappable.
+ */
+template <typename Encode>
+inline convert_result utf8_to_multi_byte(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst, Encode&& encode) noexcept {
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        auto ascii = copy_ascii(src + result.read, len - result.read,
+            dst + result.written);
+        result.read += ascii;
+        result.written += ascii;
+        if (result.read == len) break;
+
+        auto n = parse_strict(src + result.read, end);
+        if (n < 0) {
+            result.error = is_truncated_utf8(src + result.read, end)
+                ? error::incomplete : error::invalid_utf8;
+            return result;
+        }
+        auto cp = calc_codepoint(src + result.read, utf8_usize(n));
+        int written = 1;
+        if (cp < 0x80) dst[result.written] = utf8_byte(cp);
+        else written = encode(cp, dst + result.written);
+        if (written < 0) {
+            result.error = error::unmappable;
+            return result;
+        }
+        result.written += utf8_usize(written);
+        result.read += utf8_usize(n);
+    }
+    return result;
+}
+
+// Shift_JIS
+
+inline utf8_ssize decode_shift_jis(utf8_byte const* src, utf8_byte const* end,
+    utf8_cp& cp) noexcept {
+    auto lead = src[0];
+    if (lead == 0x80) {
+        cp = 0x80;
+        return 1;
+    }
+    // Half-width katakana
+    if (lead >= 0xa1 && lead <= 0xdf) {
+        cp = 0xff61 + lead - 0xa1;
+        return 1;
+    }
+    if (lead < 0x81 || (lead > 0x9f && lead < 0xe0) || lead > 0xfc) {
+        return error::invalid_sequence;
+    }
+    if (end - src < 2) return error::incomplete;
+    auto trail = src[1];
+    if (trail < 0x40 || trail == 0x7f || trail > 0xfc) {
+        return error::invalid_sequence;
+    }
+    utf8_usize pointer = (lead - (lead < 0xa0 ? 0x81 : 0xc1)) * 188
+        + trail - (trail < 0x7f ? 0x40 : 0x41);
+    // User-defined area
+    if (pointer >= 8836 && pointer <= 10715) {
+        cp = utf8_cp(0xe000 + pointer - 8836);
+        return 2;
+    }
+    cp = index_codepoint(tables::jis0208_index, pointer);
+    return cp == 0 ? error::unmappable : 2;
+}
+
+inline int encode_shift_jis(utf8_cp cp, utf8_byte* dst) noexcept {
+    // The yen sign and overline take the places of \\ and ~ in JIS X 0201
+    if (cp == 0x80 || cp == 0xa5 || cp == 0x203e) {
+        dst[0] = utf8_byte(cp == 0x80 ? 0x80 : cp == 0xa5 ? 0x5c : 0x7e);
+        return 1;
+    }
+    if (cp >= 0xff61 && cp <= 0xff9f) {
+        dst[0] = utf8_byte(cp - 0xff61 + 0xa1);
+        return 1;
+    }
+    if (cp == 0x2212) cp = 0xff0d;
+    std::int32_t pointer = -1;
+    if (cp >= 0xe000 && cp <= 0xe000 + 10715 - 8836) {
+        pointer = std::int32_t(cp - 0xe000 + 8836);
+    }
+    else {
+        // Like WHATWG, skip the NEC selected IBM extensions, which are
+        // duplicates of the IBM extensions or of JIS X 0208
+        auto pointers = index_pointers(tables::jis0208_index,
+            tables::jis0208_by_codepoint, cp);
+        auto found = std::find_if(pointers.first, pointers.second,
+            [](std::uint16_t p) { return p < 8272 || p > 8835; });
+        if (found != pointers.second) pointer = *found;
+    }
+    if (pointer < 0) return -1;
+    auto lead = pointer / 188;
+    auto trail = pointer % 188;
+    dst[0] = utf8_byte(lead + (lead < 0x1f ? 0x81 : 0xc1));
+    dst[1] = utf8_byte(trail + (trail < 0x3f ? 0x40 : 0x41));
+    return 2;
+}
+
+// EUC-JP
+
+inline utf8_ssize decode_euc_jp(utf8_byte const* src, utf8_byte const* end,
+    utf8_cp& cp) noexcept {
+    auto lead = src[0];
+    auto in_row = [](utf8_byte b) { return b >= 0xa1 && b <= 0xfe; };
+    if (lead == 0x8e) {
+        // Half-width katakana
+        if (end - src < 2) return error::incomplete;
+        if (src[1] < 0xa1 || src[1] > 0xdf) return error::invalid_sequence;
+        cp = 0xff61 + src[1] - 0xa1;
+        return 2;
+    }
+    if (lead == 0x8f) {
+        // JIS X 0212
+        if (end - src < 3) return error::incomplete;
+        if (!in_row(src[1]) || !in_row(src[2])) return error::invalid_sequence;
+        cp = index_codepoint(tables::jis0212_index,
+            (src[1] - 0xa1) * 94 + src[2] - 0xa1);
+        return cp == 0 ? error::unmappable : 3;
+    }
+    if (!in_row(lead)) return error::invalid_sequence;
+    if (end - src < 2) return error::incomplete;
+    if (!in_row(src[1])) return error::invalid_sequence;
+    cp = index_codepoint(tables::jis0208_index,
+        (lead - 0xa1) * 94 + src[1] - 0xa1);
+    return cp == 0 ? error::unmappable : 2;
+}
+
+inline int encode_euc_jp(utf8_cp cp, utf8_byte* dst) noexcept {
+    // Like WHATWG and Shift_JIS, the yen sign and overline take the places
+    // of \\ and ~, and JIS X 0212 is only decoded
+    if (cp == 0xa5 || cp == 0x203e) {
+        dst[0] = utf8_byte(cp == 0xa5 ? 0x5c : 0x7e);
+        return 1;
+    }
+    if (cp >= 0xff61 && cp <= 0xff9f) {
+        dst[0] = 0x8e;
+        dst[1] = utf8_byte(cp - 0xff61 + 0xa1);
+        return 2;
+    }
+    if (cp == 0x2212) cp = 0xff0d;
+    auto pointer = index_pointer(tables::jis0208_index,
+        tables::jis0208_by_codepoint, cp);
+    if (pointer < 0) return -1;
+    dst[0] = utf8_byte(pointer / 94 + 0xa1);
+    dst[1] = utf8_byte(pointer % 94 + 0xa1);
+    return 2;
+}
+
+// EUC-KR (the unified Hangul code superset)
+
+inline utf8_ssize decode_euc_kr(utf8_byte const* src, utf8_byte const* end,
+    utf8_cp& cp) noexcept {
+    auto lead = src[0];
+    if (lead < 0x81 || lead > 0xfe) return error::invalid_sequence;
+    if (end - src < 2) return error::incomplete;
+    auto trail = src[1];
+    if (trail < 0x41 || trail > 0xfe) return error::invalid_sequence;
+    cp = index_codepoint(tables::euc_kr_index,
+        (lead - 0x81) * 190 + trail - 0x41);
+    return cp == 0 ? error::unmappable : 2;
+}
+
+inline int encode_euc_kr(utf8_cp cp, utf8_byte* dst) noexcept {
+    auto pointer = index_pointer(tables::euc_kr_index,
+        tables::euc_kr_by_codepoint, cp);
+    if (pointer < 0) return -1;
+    dst[0] = utf8_byte(pointer / 190 + 0x81);
+    dst[1] = utf8_byte(pointer % 190 + 0x41);
+    return 2;
+}
+
+// Big5
+
+inline utf8_ssize decode_big5(utf8_byte const* src, utf8_byte const* end,
+    utf8_cp& cp) noexcept {
+    auto lead = src[0];
+    if (lead < 0x81 || lead > 0xfe) return error::invalid_sequence;
+    if (end - src < 2) return error::incomplete;
+    auto trail = src[1];
+    if (trail < 0x40 || (trail > 0x7e && trail < 0xa1) || trail > 0xfe) {
+        return error::invalid_sequence;
+    }
+    cp = index_codepoint(tables::big5_index,
+        (lead - 0x81) * 157 + trail - (trail < 0x7f ? 0x40 : 0x62));
+    return cp == 0 ? error::unmappable : 2;
+}
+
+inline int encode_big5(utf8_cp cp, utf8_byte* dst) noexcept {
+    // Like WHATWG, the HKSCS leads below 0xa1 are not encoded, and a few
+    // codepoints encode to their last duplicate
+    auto pointers = index_pointers(tables::big5_index,
+        tables::big5_by_codepoint, cp);
+    auto first = std::lower_bound(pointers.first, pointers.second,
+        std::uint16_t((0xa1 - 0x81) * 157));
+    if (first == pointers.second) return -1;
+    bool last = cp == 0x2550 || cp == 0x255e || cp == 0x2561 || cp == 0x256a
+        || cp == 0x5341 || cp == 0x5345;
+    auto pointer = last ? pointers.second[-1] : *first;
+    auto trail = pointer % 157;
+    dst[0] = utf8_byte(pointer / 157 + 0x81);
+    dst[1] = utf8_byte(trail + (trail < 0x3f ? 0x40 : 0x62));
+    return 2;
+}
+
+// GB18030
+
+inline utf8_ssize decode_gb18030(utf8_byte const* src, utf8_byte const* end,
+    utf8_cp& cp) noexcept {
+    auto is_digit = [](utf8_byte b) { return b >= 0x30 && b <= 0x39; };
+    auto is_lead = [](utf8_byte b) { return b >= 0x81 && b <= 0xfe; };
+
+    auto lead = src[0];
+    if (lead == 0x80) {
+        cp = 0x20ac;
+        return 1;
+    }
+    if (!is_lead(lead)) return error::invalid_sequence;
+    if (end - src < 2) return error::incomplete;
+    auto second = src[1];
+    if (!is_digit(second)) {
+        // Two-byte sequence
+        if (second < 0x40 || second == 0x7f || second == 0xff) {
+            return error::invalid_sequence;
+        }
+        cp = index_codepoint(tables::gb18030_index,
+            (lead - 0x81) * 190 + second - (second < 0x7f ? 0x40 : 0x41));
+        return cp == 0 ? error::unmappable : 2;
+    }
+
+    // Four-byte sequence
+    if (end - src < 4) {
+        if (end - src == 3 && !is_lead(src[2])) return error::invalid_sequence;
+        return error::incomplete;
+    }
+    if (!is_lead(src[2]) || !is_digit(src[3])) return error::invalid_sequence;
+    utf8_usize pointer = (((lead - 0x81) * 10 + second - 0x30) * 126
+        + src[2] - 0x81) * 10 + src[3] - 0x30;
+    // Supplementary planes are linear
+    if (pointer >= 189000 && pointer < 189000 + 0x100000) {
+        cp = utf8_cp(0x10000 + pointer - 189000);
+        return 4;
+    }
+    auto const& starts = tables::gb18030_ranges_pointer;
+    if (pointer > 39419) return error::unmappable;
+    // GB18030-2005 swapped U+E7C7 with U+1E3F, which is two bytes now
+    if (pointer == 7457) {
+        cp = 0xe7c7;
+        return 4;
+    }
+    auto i = utf8_usize(std::upper_bound(std::begin(starts), std::end(starts),
+        pointer) - std::begin(starts)) - 1;
+    cp = utf8_cp(tables::gb18030_ranges_codepoint[i] + pointer - starts[i]);
+    return 4;
+}
+
+inline int encode_gb18030(utf8_cp cp, utf8_byte* dst) noexcept {
+    auto pointer = index_pointer(tables::gb18030_index,
+        tables::gb18030_by_codepoint, cp);
+    if (pointer >= 0) {
+        auto trail = pointer % 190;
+        dst[0] = utf8_byte(pointer / 190 + 0x81);
+        dst[1] = utf8_byte(trail + (trail < 0x3f ? 0x40 : 0x41));
+        return 2;
+    }
+    if (is_surrogate(cp) || cp > 0x10ffff) return -1;
+
+    utf8_usize linear = 0;
+    if (cp >= 0x10000) {
+        linear = 189000 + cp - 0x10000;
+    }
+    else if (cp == 0xe7c7) {
+        linear = 7457;
+    }
+    else {
+        auto const& starts = tables::gb18030_ranges_codepoint;
+        auto i = utf8_usize(std::upper_bound(std::begin(starts),
+            std::end(starts), cp) - std::begin(starts)) - 1;
+        linear = tables::gb18030_ranges_pointer[i] + cp - starts[i];
+    }
+    dst[3] = utf8_byte(linear % 10 + 0x30);
+    linear /= 10;
+    dst[2] = utf8_byte(linear % 126 + 0x81);
+    linear /= 126;
+    dst[1] = utf8_byte(linear % 10 + 0x30);
+    dst[0] = utf8_byte(linear / 10 + 0x81);
+    return 4;
+}
+
+} /* namespace detail */
+
+/**
+ * Converters between UTF8 and the multi-byte CJK legacy encodings. They never
+ * allocate, and they can convert streams chunk by chunk: when a chunk ends in
+ * the middle of a sequence, the error is error::incomplete and the result
+ * tells how many bytes were consumed. Structurally invalid input is reported
+ * as error::invalid_sequence (or error::invalid_utf8), and characters with no
+ * mapping as error::unmappable.
+ * Decoding needs room for 3 * len bytes in the destination (4 * len for
+ * GB18030), encoding needs room for 2 * len bytes.
+ */
+
+inline convert_result shift_jis_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::multi_byte_to_utf8(src, len, dst, detail::decode_shift_jis);
+}
+
+inline convert_result utf8_to_shift_jis(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::utf8_to_multi_byte(src, len, dst, detail::encode_shift_jis);
+}
+
+inline convert_result euc_jp_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::multi_byte_to_utf8(src, len, dst, detail::decode_euc_jp);
+}
+
+inline convert_result utf8_to_euc_jp(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::utf8_to_multi_byte(src, len, dst, detail::encode_euc_jp);
+}
+
+inline convert_result euc_kr_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::multi_byte_to_utf8(src, len, dst, detail::decode_euc_kr);
+}
+
+inline convert_result utf8_to_euc_kr(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::utf8_to_multi_byte(src, len, dst, detail::encode_euc_kr);
+}
+
+inline convert_result big5_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::multi_byte_to_utf8(src, len, dst, detail::decode_big5);
+}
+
+inline convert_result utf8_to_big5(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::utf8_to_multi_byte(src, len, dst, detail::encode_big5);
+}
+
+inline convert_result gb18030_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::multi_byte_to_utf8(src, len, dst, detail::decode_gb18030);
+}
+
+inline convert_result utf8_to_gb18030(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    return detail::utf8_to_multi_byte(src, len, dst, detail::encode_gb18030);
+}
+
+/**
+ * The encodings detect_encoding can recognize.
+ */
+enum class encoding {
+    unknown,
+    utf8,
+    utf16le,
+    utf16be,
+    utf32le,
+    utf32be,
+    windows_1252,
+    shift_jis,
+    euc_jp,
+    euc_kr,
+    big5,
+    gb18030,
+};
+
+/**
+ * The result of detect_encoding.
+ */
+struct detection_result {
+    /**
+     * The most likely encoding, or encoding::unknown for binary data.
+     */
+    encoding detected = encoding::unknown;
+
+    /**
+     * A rough score of how certain the guess is, between 0 and 1.
+     */
+    float confidence = 0;
+
+    /**
+     * The length of the byte order mark to skip, or zero.
+     */
+    utf8_usize bom = 0;
+};
+
+namespace detail {
+
+/**
+ * Byte statistics of a sample.
+ */
+struct byte_stats {
+    utf8_usize non_ascii = 0;
+    utf8_usize even_zeros = 0;
+    utf8_usize odd_zeros = 0;
+};
+
+inline byte_stats count_bytes(utf8_byte const* src, utf8_usize len) noexcept {
+    byte_stats stats;
+    utf8_usize i = 0;
+#if UTF8PP_SSE2
+    auto zero = _mm_setzero_si128();
+    for (; len - i >= 16; i += 16) {
+        auto chunk = _mm_loadu_si128((__m128i const*)(src + i));
+        auto high = std::uint32_t(_mm_movemask_epi8(chunk));
+        auto zeros = std::uint32_t(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero)));
+        stats.non_ascii += popcount(high);
+        stats.even_zeros += popcount(zeros & 0x5555);
+        stats.odd_zeros += popcount(zeros & 0xaaaa);
+    }
+#endif
+    for (; i < len; ++i) {
+        stats.non_ascii += src[i] >= 0x80;
+        if (src[i] == 0) {
+            if (i % 2 == 0) ++stats.even_zeros;
+            else ++stats.odd_zeros;
+        }
+    }
+    return stats;
+}
+
+/**
+ * Scores how plausible a legacy multi-byte encoding is for a sample.
+ * @param decode The decoder of the encoding.
+ * @param weigh The function weighing a decoded character, called with the
+ * sequence and the codepoint. Frequent characters of the language weigh more.
+ * @return The average weight of the non-ASCII characters, or -1 if the sample
+ * is invalid in the encoding.
+ */
+template <typename Decode, typename Weigh>
+inline float score_encoding(utf8_byte const* src, utf8_usize len,
+    Decode&& decode, Weigh&& weigh) noexcept {
+    auto end = src + len;
+    float total = 0;
+    utf8_usize chars = 0;
+    for (auto it = src; it != end;) {
+        if (*it < 0x80) {
+            ++it;
+            continue;
+        }
+        utf8_cp cp = 0;
+        auto n = decode(it, end, cp);
+        // The sample may cut the last character
+        if (n == error::incomplete) break;
+        if (n < 0) return -1;
+        total += weigh(it, cp);
+        ++chars;
+        it += n;
+    }
+    return chars == 0 ? 0 : total / float(chars);
+}
+
+/**
+ * Scores Windows-1252 like score_encoding. Accented letters in Western text
+ * are mostly surrounded by ASCII letters, while the bytes of multi-byte
+ * encodings come in runs.
+ */
+inline float score_windows_1252(utf8_byte const* src, utf8_usize len) noexcept {
+    auto is_letter = [](utf8_byte b) {
+        return (b | 0x20) >= 'a' && (b | 0x20) <= 'z';
+    };
+    float total = 0;
+    utf8_usize chars = 0;
+    for (utf8_usize i = 0; i < len; ++i) {
+        auto b = src[i];
+        if (b < 0x80) continue;
+        if (tables::windows_1252_decode[b - 0x80] == 0) return -1;
+        bool beside_letter = (i > 0 && is_letter(src[i - 1]))
+            || (i + 1 < len && is_letter(src[i + 1]));
+        bool beside_ascii = (i > 0 && src[i - 1] < 0x80)
+            || (i + 1 < len && src[i + 1] < 0x80);
+        bool letter = (b >= 0xc0 && b != 0xd7 && b != 0xf7)
+            || b == 0x8a || b == 0x8c || b == 0x8e || b == 0x9a || b == 0x9c
+            || b == 0x9e || b == 0x9f;
+        if (letter && beside_letter) total += 2;
+        else if (beside_ascii) total += 1;
+        ++chars;
+    }
+    return chars == 0 ? 0 : total / float(chars);
+}
+
+inline bool is_cjk_punctuation(utf8_cp cp) noexcept {
+    return (cp >= 0x3000 && cp <= 0x303f) || (cp >= 0xff01 && cp <= 0xff60);
+}
+
+inline bool is_cjk_ideograph(utf8_cp cp) noexcept {
+    return cp >= 0x4e00 && cp <= 0x9fff;
+}
+
+template <std::size_t N>
+inline bool is_frequent(utf8_cp const (&frequent)[N], utf8_cp cp) noexcept {
+    return std::find(std::begin(frequent), std::end(frequent), cp)
+        != std::end(frequent);
+}
+
+// Frequent characters of running text, which separate real text from text
+// decoded with a different encoding of the same byte structure.
+
+inline constexpr utf8_cp frequent_japanese[] = {
+    0x306e, 0x306b, 0x306f, 0x3092, 0x305f, 0x304c, 0x3067, 0x3066,
+    0x3068, 0x3057, 0x3044, 0x308b, 0x3059, 0x307e, 0x306a, 0x3063,
+};
+
+inline constexpr utf8_cp frequent_korean[] = {
+    0xc774, 0xb2e4, 0xb294, 0xc758, 0xc5d0, 0xac00, 0xc744, 0xd558,
+    0xace0, 0xc9c0, 0xc11c, 0xae30, 0xb97c, 0xd55c, 0xb85c, 0xb3c4,
+};
+
+inline constexpr utf8_cp frequent_simplified[] = {
+    0x7684, 0x4e00, 0x662f, 0x4e0d, 0x4e86, 0x5728, 0x4eba, 0x6709,
+    0x6211, 0x4ed6, 0x8fd9, 0x4e2a, 0x4eec, 0x4e2d, 0x6765, 0x4e0a,
+};
+
+inline constexpr utf8_cp frequent_traditional[] = {
+    0x7684, 0x4e00, 0x662f, 0x4e0d, 0x4e86, 0x5728, 0x4eba, 0x6709,
+    0x6211, 0x4ed6, 0x9019, 0x500b, 0x5011, 0x4e2d, 0x4f86, 0x4e0a,
+};
+
+inline float weigh_japanese(utf8_byte const*, utf8_cp cp) noexcept {
+    float weight = is_frequent(frequent_japanese, cp) ? 2.0f : 0.0f;
+    if (cp >= 0x3041 && cp <= 0x30ff) return weight + 2;
+    if (is_cjk_ideograph(cp) || is_cjk_punctuation(cp)) return weight + 1;
+    return weight;
+}
+
+inline float weigh_korean(utf8_byte const*, utf8_cp cp) noexcept {
+    float weight = is_frequent(frequent_korean, cp) ? 2.0f : 0.0f;
+    if (cp >= 0xac00 && cp <= 0xd7a3) return weight + 2;
+    if (is_cjk_punctuation(cp)) return weight + 1;
+    return weight;
+}
+
+inline float weigh_gb18030(utf8_byte const* seq, utf8_cp cp) noexcept {
+    float weight = is_frequent(frequent_simplified, cp) ? 2.0f : 0.0f;
+    // The first level of GB2312 holds the frequent hanzi
+    bool level1 = seq[0] >= 0xb0 && seq[0] <= 0xd7 && seq[1] >= 0xa1;
+    if (level1 && is_cjk_ideograph(cp)) return weight + 2;
+    if (is_cjk_ideograph(cp) || is_cjk_punctuation(cp)) return weight + 1;
+    return weight;
+}
+
+inline float weigh_big5(utf8_byte const* seq, utf8_cp cp) noexcept {
+    float weight = is_frequent(frequent_traditional, cp) ? 2.0f : 0.0f;
+    // Big5 orders the hanzi by frequency, A440-C67E are the frequent ones
+    auto code = seq[0] << 8 | seq[1];
+    if (code >= 0xa440 && code <= 0xc67e) return weight + 2;
+    if (is_cjk_ideograph(cp) || is_cjk_punctuation(cp)) return weight + 1;
+    return weight;
+}
+
+} /* namespace detail */
+
+/**
+ * Guesses the encoding of a text. A byte order mark is trusted, then valid
+ * UTF8 is recognized with the bulk validator, and UTF16 by the position of
+ * its zero bytes. Otherwise, every legacy encoding that can decode the sample
+ * is scored by how frequent its decoded characters are in the language of the
+ * encoding.
+ * Pure ASCII is reported as UTF8.
+ * @param src The pointer to the start of the text.
+ * @param len The length of the text.
+ * @param limit The size of the prefix to sample.
+ * @return The guess.
+ */
+inline detection_result detect_encoding(utf8_byte const* src, utf8_usize len,
+    utf8_usize limit = 1 << 16) noexcept {
+    auto starts_with = [&](char const* bom, utf8_usize n) {
+        return len >= n && std::memcmp(src, bom, n) == 0;
+    };
+    if (starts_with("\xef\xbb\xbf", 3)) return { encoding::utf8, 1, 3 };
+    if (starts_with("\xff\xfe\x00\x00", 4)) return { encoding::utf32le, 1, 4 };
+    if (starts_with("\x00\x00\xfe\xff", 4)) return { encoding::utf32be, 1, 4 };
+    if (starts_with("\xff\xfe", 2)) return { encoding::utf16le, 1, 2 };
+    if (starts_with("\xfe\xff", 2)) return { encoding::utf16be, 1, 2 };
+
+    auto n = std::min(len, limit);
+    auto stats = detail::count_bytes(src, n);
+
+    // Zero bytes are mostly the high halves of ASCII in UTF16
+    auto zeros = stats.even_zeros + stats.odd_zeros;
+    if (zeros > 0) {
+        auto units = float(n / 2 + 1);
+        if (stats.odd_zeros > 4 * stats.even_zeros) {
+            return { encoding::utf16le,
+                std::min(1.0f, float(stats.odd_zeros) / units * 2), 0 };
+        }
+        if (stats.even_zeros > 4 * stats.odd_zeros) {
+            return { encoding::utf16be,
+                std::min(1.0f, float(stats.even_zeros) / units * 2), 0 };
+        }
+        return {};
+    }
+
+    if (stats.non_ascii == 0) return { encoding::utf8, 1, 0 };
+
+    auto valid = validate(src, n);
+    if (valid == n || (n < len && detail::is_truncated_utf8(src + valid,
+        src + n))) {
+        // Each continuation byte of legacy text has about a 1 in 4 chance of
+        // looking right
+        auto continuations = n - count_codepoints(src, n);
+        float chance = 1;
+        for (utf8_usize i = 0; i < continuations && chance > 1e-6f; ++i) {
+            chance /= 4;
+        }
+        return { encoding::utf8, 1 - chance, 0 };
+    }
+
+    struct candidate {
+        encoding enc;
+        float score;
+    };
+    candidate candidates[] = {
+        { encoding::windows_1252, detail::score_windows_1252(src, n) },
+        { encoding::shift_jis, detail::score_encoding(src, n,
+            detail::decode_shift_jis, detail::weigh_japanese) },
+        { encoding::euc_jp, detail::score_encoding(src, n,
+            detail::decode_euc_jp, detail::weigh_japanese) },
+        { encoding::euc_kr, detail::score_encoding(src, n,
+            detail::decode_euc_kr, detail::weigh_korean) },
+        { encoding::big5, detail::score_encoding(src, n,
+            detail::decode_big5, detail::weigh_big5) },
+        { encoding::gb18030, detail::score_encoding(src, n,
+            detail::decode_gb18030, detail::weigh_gb18030) },
+    };
+    candidate best = { encoding::unknown, 0 };
+    float second = 0;
+    for (auto const& c : candidates) {
+        if (c.score > best.score) {
+            second = best.score;
+            best = c;
+        }
+        else if (c.score > second) {
+            second = c.score;
+        }
+    }
+    if (best.enc == encoding::unknown) return {};
+
+    // Scale by how typical the score is and by the margin to the runner-up
+    auto confidence = std::min(1.0f, best.score / 2)
+        * (1 - second / best.score / 2);
+    return { best.enc, confidence, 0 };
+}
+
+/**
+ * The codec policies of the UTF8 variants, for the templated read_next,
+ * encode_cp and the bulk converters.
+ * A policy tells if NUL is encoded as the overlong C0 80, if supplementary
+ * codepoints are encoded as a pair of 3-byte surrogates, and if unpaired
+ * surrogates are allowed.
+ */
+namespace variant {
+
+/**
+ * Standard UTF8, which goes through the non-templated functions.
+ */
+struct utf8 {
+    static constexpr bool nul_as_overlong = false;
+    static constexpr bool surrogate_pairs = false;
+    static constexpr bool lone_surrogates = false;
+};
+
+/**
+ * CESU-8, used by some databases for UTF16 data.
+ */
+struct cesu8 {
+    static constexpr bool nul_as_overlong = false;
+    static constexpr bool surrogate_pairs = true;
+    static constexpr bool lone_surrogates = false;
+};
+
+/**
+ * The modified UTF8 of Java serialization and JNI. It encodes arbitrary UTF16
+ * strings, so unpaired surrogates are allowed. A raw '\0' byte is accepted
+ * when decoding, but never written.
+ */
+struct mutf8 {
+    static constexpr bool nul_as_overlong = true;
+    static constexpr bool surrogate_pairs = true;
+    static constexpr bool lone_surrogates = true;
+};
+
+/**
+ * WTF-8, which encodes potentially ill-formed UTF16 (like Windows file paths).
+ * Unpaired surrogates are allowed, but paired ones must be written as a single
+ * 4-byte sequence.
+ */
+struct wtf8 {
+    static constexpr bool nul_as_overlong = false;
+    static constexpr bool surrogate_pairs = false;
+    static constexpr bool lone_surrogates = true;
+};
+
+} /* namespace variant */
+
+namespace detail {
+
+inline constexpr bool is_high_surrogate(utf8_cp cp) noexcept {
+    return cp >= 0xd800 && cp < 0xdc00;
+}
+
+/**
+ * Checks if the source ends in a high surrogate, whose low half is cut off.
+ */
+inline bool
+is_truncated_pair(utf8_byte const* src, utf8_byte const* end) noexcept {
+    // High surrogates are ED A0 80 - ED AF BF
+    auto avail = end - src;
+    if (avail < 3 || avail >= 6) return false;
+    if (src[0] != 0xed || src[1] < 0xa0 || src[1] > 0xaf) return false;
+    return avail == 3 || is_truncated_utf8(src + 3, end);
+}
+
+/**
+ * Same as @see parse_strict, but leaves surrogates to the caller, and accepts
+ * the overlong C0 80 if the variant encodes NUL that way.
+ */
+template <typename Variant>
+inline utf8_ssize
+parse_variant(utf8_byte const* src, utf8_byte const* end) noexcept {
+    auto n = parse_next(src, end);
+    if (n <= 1) return n;
+    auto cp = calc_codepoint(src, utf8_usize(n));
+    if (Variant::nul_as_overlong && n == 2 && cp == 0) return n;
+    bool shortest = n == 2 ? cp >= 0x80 : n == 3 ? cp >= 0x800 : cp >= 0x10000;
+    if (!shortest || cp > 0x10ffff) return error::invalid_utf8;
+    return n;
+}
+
+} /* namespace detail */
+
+/**
+ * Same as the bounded @see read_next, but decodes a UTF8 variant.
+ * @tparam Variant The variant policy, @see variant.
+ * @return @see read_next. A surrogate pair counts as a single codepoint of 6
+ * bytes. Sequences the variant forbids are reported as error::invalid_utf8.
+ */
+template <typename Variant>
+inline utf8_ssize
+read_next(utf8_byte const* src, utf8_byte const* end, utf8_cp& dest) noexcept {
+    if constexpr (!Variant::surrogate_pairs && !Variant::lone_surrogates) {
+        return read_next(src, end, dest);
+    }
+    else {
+        dest = '\0';
+        auto result = detail::parse_variant<Variant>(src, end);
+        if (result <= 0) return result;
+        dest = detail::calc_codepoint(src, utf8_usize(result));
+        // Supplementary codepoints must be written as pairs
+        if (Variant::surrogate_pairs && result == 4) {
+            dest = '\0';
+            return error::invalid_utf8;
+        }
+        if (!detail::is_surrogate(dest)) return result;
+
+        if (detail::is_high_surrogate(dest)) {
+            utf8_cp low = 0;
+            auto next = read_next(src + result, end, low);
+            if (next == 3 && detail::is_surrogate(low)
+                && !detail::is_high_surrogate(low)) {
+                if (!Variant::surrogate_pairs) {
+                    dest = '\0';
+                    return error::invalid_utf8;
+                }
+                dest = 0x10000 + ((dest - 0xd800) << 10) + (low - 0xdc00);
+                return 6;
+            }
+        }
+        if (!Variant::lone_surrogates) {
+            dest = '\0';
+            return error::invalid_utf8;
+        }
+        return result;
+    }
+}
+
+/**
+ * Same as @see encode_cp, but encodes in a UTF8 variant.
+ * @tparam Variant The variant policy, @see variant.
+ * @return @see encode_cp. Writes at most 6 bytes.
+ */
+template <typename Variant>
+inline utf8_ssize encode_cp(utf8_byte* dst, utf8_cp cp) noexcept {
+    if constexpr (Variant::nul_as_overlong) {
+        if (cp == 0) {
+            dst[0] = 0b11000000;
+            dst[1] = 0b10000000;
+            return 2;
+        }
+    }
+    if constexpr (Variant::surrogate_pairs) {
+        if (cp >= 0x10000 && cp < 0x110000) {
+            cp -= 0x10000;
+            encode_cp(dst, 0xd800 + (cp >> 10));
+            encode_cp(dst + 3, 0xdc00 + (cp & 0x3ff));
+            return 6;
+        }
+    }
+    return encode_cp(dst, cp);
+}
+
+/**
+ * Converts text in a UTF8 variant to standard UTF8.
+ * @tparam Variant The variant policy, @see variant.
+ * @param src The source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @return The conversion result, the error is error::invalid_utf8,
+ * error::incomplete, or error::invalid_codepoint for unpaired surrogates.
+ */
+template <typename Variant>
+inline convert_result variant_to_utf8(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        auto ascii = detail::copy_ascii(src + result.read, len - result.read,
+            dst + result.written);
+        result.read += ascii;
+        result.written += ascii;
+        if (result.read == len) break;
+
+        utf8_cp cp = 0;
+        auto it = src + result.read;
+        auto n = read_next<Variant>(it, end, cp);
+        if (n < 0) {
+            bool cut = detail::is_truncated_utf8(it, end);
+            if constexpr (Variant::surrogate_pairs) {
+                cut = cut || detail::is_truncated_pair(it, end);
+            }
+            result.error = cut ? error::incomplete : n;
+            return result;
+        }
+        if (detail::is_surrogate(cp)) {
+            // A high surrogate whose low half is in the next chunk
+            bool cut = false;
+            if constexpr (Variant::surrogate_pairs) {
+                cut = detail::is_truncated_pair(it, end);
+            }
+            result.error = cut ? error::incomplete : error::invalid_codepoint;
+            return result;
+        }
+        result.written += utf8_usize(encode_cp(dst + result.written, cp));
+        result.read += utf8_usize(n);
+    }
+    return result;
+}
+
+/**
+ * Converts standard UTF8 text to a UTF8 variant.
+ * @tparam Variant The variant policy, @see variant.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 2 * len bytes.
+ * @return The conversion result, the error is error::invalid_utf8 (which
+ * includes encoded surrogates) or error::incomplete.
+ */
+template <typename Variant>
+inline convert_result utf8_to_variant(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        auto ascii = detail::copy_ascii<Variant::nul_as_overlong>(
+            src + result.read, len - result.read, dst + result.written);
+        result.read += ascii;
+        result.written += ascii;
+        if (result.read == len) break;
+
+        auto it = src + result.read;
+        auto n = detail::parse_strict(it, end);
+        if (n < 0) {
+            result.error = detail::is_truncated_utf8(it, end)
+                ? error::incomplete : error::invalid_utf8;
+            return result;
+        }
+        auto cp = detail::calc_codepoint(it, utf8_usize(n));
+        result.written += utf8_usize(
+            encode_cp<Variant>(dst + result.written, cp));
+        result.read += utf8_usize(n);
+    }
+    return result;
+}
+
+/**
+ * Reads the next codepoint like the bounded @see read_next, but never fails.
+ * A byte that does not start a valid, shortest-form sequence is decoded on its
+ * own as U+DC80-U+DCFF (the surrogate escape of PEP 383), so arbitrary bytes
+ * round-trip through @see encode_cp_escaped.
+ * @param src The pointer to the parse position.
+ * @param end The pointer to the end of the source.
+ * @param dest The reference to write the codepoint to.
+ * @return The number of bytes consumed, or zero if src == end.
+ */
+inline utf8_ssize read_next_escaped(utf8_byte const* src, utf8_byte const* end,
+    utf8_cp& dest) noexcept {
+    dest = '\0';
+
+    auto result = detail::parse_strict(src, end);
+    if (result == 0) return 0;
+    if (result < 0) {
+        dest = 0xdc00 + src[0];
+        return 1;
+    }
+    dest = detail::calc_codepoint(src, utf8_usize(result));
+    return result;
+}
+
+/**
+ * Same as @see encode_cp, but writes the escaped codepoints U+DC80-U+DCFF
+ * back as the original bytes.
+ */
+inline utf8_ssize encode_cp_escaped(utf8_byte* dst, utf8_cp cp) noexcept {
+    if (cp >= 0xdc80 && cp <= 0xdcff) {
+        dst[0] = utf8_byte(cp - 0xdc00);
+        return 1;
+    }
+    return encode_cp(dst, cp);
+}
+
+/**
+ * Converts arbitrary bytes to UTF8, escaping every byte that is not part of
+ * a valid sequence as U+DC80-U+DCFF, @see read_next_escaped. Valid runs are
+ * copied as they are.
+ * @param src The source bytes.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 3 * len bytes.
+ * @return The number of bytes written.
+ */
+inline utf8_usize surrogate_escape(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    auto end = src + len;
+    utf8_usize written = 0;
+    while (src != end) {
+        // Find the end of the valid run
+        auto run = src;
+        while (run != end) {
+#if UTF8PP_SSE2
+            if (end - run >= 16) {
+                auto chunk = _mm_loadu_si128((__m128i const*)run);
+                if (_mm_movemask_epi8(chunk) == 0) {
+                    run += 16;
+                    continue;
+                }
+            }
+#endif
+            auto n = detail::parse_strict(run, end);
+            if (n < 0) break;
+            run += n;
+        }
+        std::memcpy(dst + written, src, utf8_usize(run - src));
+        written += utf8_usize(run - src);
+        src = run;
+        if (src == end) break;
+
+        written += utf8_usize(encode_cp(dst + written, 0xdc00 + *src++));
+    }
+    return written;
+}
+
+/**
+ * Restores the original bytes of text produced by @see surrogate_escape.
+ * Everything but the escaped codepoints is copied as it is.
+ * @param src The escaped UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @return The number of bytes written.
+ */
+inline utf8_usize surrogate_unescape(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst) noexcept {
+    auto end = src + len;
+    auto copied = src;
+    utf8_usize written = 0;
+    // U+DC80-U+DCFF are encoded as ED B2 80 - ED B3 BF
+    detail::for_each_byte(src, end, 0xed, [&](utf8_byte const* it) {
+        if (it < copied || end - it < 3) return;
+        if ((it[1] != 0xb2 && it[1] != 0xb3)
+            || !detail::is_continuation(it[2])) return;
+        std::memcpy(dst + written, copied, utf8_usize(it - copied));
+        written += utf8_usize(it - copied);
+        dst[written++] = utf8_byte(0x80 | (it[1] & 1) << 6 | (it[2] & 0x3f));
+        copied = it + 3;
+    });
+    std::memcpy(dst + written, copied, utf8_usize(end - copied));
+    return written + utf8_usize(end - copied);
+}
+
+namespace detail {
+
+/**
+ * Finds the first byte of a 16-byte block that JSON strings can't hold as it
+ * is: a quote, a backslash, a control character or a non-ASCII byte (that
+ * has to be validated).
+ * @return The offset of the byte, or 16 if there is none.
+ */
+inline unsigned json_special(utf8_byte const* src) noexcept {
+#if UTF8PP_SSE2
+    auto chunk = _mm_loadu_si128((__m128i const*)src);
+    // Non-ASCII bytes are negative, so they are below 0x20 too
+    auto special = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+            _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))),
+        _mm_cmplt_epi8(chunk, _mm_set1_epi8(0x20)));
+    auto mask = std::uint32_t(_mm_movemask_epi8(special));
+    return mask == 0 ? 16 : ctz(mask);
+#else
+    unsigned i = 0;
+    for (; i < 16; ++i) {
+        auto b = src[i];
+        if (b == '"' || b == '\\' || b < 0x20 || b >= 0x80) break;
+    }
+    return i;
+#endif
+}
+
+inline int hex_value(utf8_byte b) noexcept {
+    if (b >= '0' && b <= '9') return b - '0';
+    b |= 0x20;
+    if (b >= 'a' && b <= 'f') return b - 'a' + 10;
+    return -1;
+}
+
+/**
+ * Parses the 4 hex digits of a \u escape.
+ * @return The UTF16 code unit, or -1.
+ */
+inline std::int32_t parse_hex4(utf8_byte const* src) noexcept {
+    std::int32_t result = 0;
+    for (int i = 0; i < 4; ++i) {
+        auto digit = hex_value(src[i]);
+        if (digit < 0) return -1;
+        result = result << 4 | digit;
+    }
+    return result;
+}
+
+} /* namespace detail */
+
+/**
+ * Escapes UTF8 text for the inside of a JSON string. Quotes, backslashes and
+ * control characters are escaped, the rest is validated and copied as it is.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 6 * len bytes.
+ * @return The conversion result, the error is error::invalid_utf8 or
+ * error::incomplete.
+ */
+inline convert_result
+json_escape(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    static constexpr char hex[] = "0123456789abcdef";
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        if (len - result.read >= 16) {
+            // Copy the whole block, but only keep the part before the first
+            // special byte
+            auto clean = detail::json_special(src + result.read);
+            std::memcpy(dst + result.written, src + result.read, 16);
+            result.read += clean;
+            result.written += clean;
+            if (clean == 16) continue;
+        }
+
+        auto b = src[result.read];
+        auto out = dst + result.written;
+        if (b >= 0x80) {
+            auto n = detail::parse_strict(src + result.read, end);
+            if (n < 0) {
+                result.error = detail::is_truncated_utf8(src + result.read, end)
+                    ? error::incomplete : error::invalid_utf8;
+                return result;
+            }
+            std::memcpy(out, src + result.read, utf8_usize(n));
+            result.read += utf8_usize(n);
+            result.written += utf8_usize(n);
+            continue;
+        }
+
+        char short_escape = 0;
+        switch (b) {
+        case '"': short_escape = '"'; break;
+        case '\\': short_escape = '\\'; break;
+        case '\b': short_escape = 'b'; break;
+        case '\f': short_escape = 'f'; break;
+        case '\n': short_escape = 'n'; break;
+        case '\r': short_escape = 'r'; break;
+        case '\t': short_escape = 't'; break;
+        }
+        ++result.read;
+        if (short_escape != 0) {
+            out[0] = '\\';
+            out[1] = utf8_byte(short_escape);
+            result.written += 2;
+        }
+        else if (b < 0x20) {
+            std::memcpy(out, "\\u00", 4);
+            out[4] = utf8_byte(hex[b >> 4]);
+            out[5] = utf8_byte(hex[b & 0xf]);
+            result.written += 6;
+        }
+        else {
+            out[0] = b;
+            ++result.written;
+        }
+    }
+    return result;
+}
+
+/**
+ * Unescapes the inside of a JSON string into UTF8. \u escapes are decoded
+ * with surrogate pairs joined, and the raw text is validated in the same pass.
+ * @param src The escaped source, without the surrounding quotes.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @return The conversion result. The error is error::invalid_sequence for
+ * malformed escapes and raw quotes or control characters, and
+ * error::invalid_codepoint for unpaired surrogates. It is error::invalid_utf8
+ * for invalid UTF8, and error::incomplete if the source ends inside an escape
+ * or a sequence.
+ */
+inline convert_result
+json_unescape(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    static constexpr utf8_byte short_escapes[][2] = {
+        { '"', '"' }, { '\\', '\\' }, { '/', '/' }, { 'b', '\b' },
+        { 'f', '\f' }, { 'n', '\n' }, { 'r', '\r' }, { 't', '\t' },
+    };
+    convert_result result;
+    auto end = src + len;
+    auto fail = [&](utf8_ssize error) {
+        result.error = error;
+        return result;
+    };
+    while (result.read < len) {
+        if (len - result.read >= 16) {
+            // Escapes only shrink, so the block always fits
+            auto clean = detail::json_special(src + result.read);
+            std::memcpy(dst + result.written, src + result.read, 16);
+            result.read += clean;
+            result.written += clean;
+            if (clean == 16) continue;
+        }
+
+        auto it = src + result.read;
+        if (*it >= 0x80) {
+            auto n = detail::parse_strict(it, end);
+            if (n < 0) {
+                return fail(detail::is_truncated_utf8(it, end)
+                    ? error::incomplete : error::invalid_utf8);
+            }
+            std::memcpy(dst + result.written, it, utf8_usize(n));
+            result.read += utf8_usize(n);
+            result.written += utf8_usize(n);
+            continue;
+        }
+        if (*it == '"' || *it < 0x20) return fail(error::invalid_sequence);
+        if (*it != '\\') {
+            dst[result.written++] = *it;
+            ++result.read;
+            continue;
+        }
+
+        if (end - it < 2) return fail(error::incomplete);
+        if (it[1] != 'u') {
+            auto found = std::find_if(std::begin(short_escapes),
+                std::end(short_escapes),
+                [&](utf8_byte const (&e)[2]) { return e[0] == it[1]; });
+            if (found == std::end(short_escapes)) {
+                return fail(error::invalid_sequence);
+            }
+            dst[result.written++] = (*found)[1];
+            result.read += 2;
+            continue;
+        }
+
+        if (end - it < 6) return fail(error::incomplete);
+        auto unit = detail::parse_hex4(it + 2);
+        if (unit < 0) return fail(error::invalid_sequence);
+        auto cp = utf8_cp(unit);
+        utf8_usize consumed = 6;
+        if (detail::is_high_surrogate(cp)) {
+            // The low half must follow right away
+            if (end - it < 12) {
+                bool cut = (end - it == 6 || it[6] == '\\')
+                    && (end - it <= 7 || it[7] == 'u');
+                return fail(cut ? error::incomplete : error::invalid_codepoint);
+            }
+            auto low = it[6] == '\\' && it[7] == 'u'
+                ? detail::parse_hex4(it + 8) : -1;
+            if (low < 0xdc00 || low >= 0xe000) {
+                return fail(error::invalid_codepoint);
+            }
+            cp = 0x10000 + ((cp - 0xd800) << 10) + (utf8_cp(low) - 0xdc00);
+            consumed = 12;
+        }
+        else if (detail::is_surrogate(cp)) {
+            return fail(error::invalid_codepoint);
+        }
+        result.written += utf8_usize(encode_cp(dst + result.written, cp));
+        result.read += consumed;
+    }
+    return result;
+}
+
+namespace detail {
+
+inline constexpr std::uint32_t punycode_base = 36;
+inline constexpr std::uint32_t punycode_tmin = 1;
+inline constexpr std::uint32_t punycode_tmax = 26;
+
+inline utf8_byte punycode_digit(std::uint32_t d) noexcept {
+    return utf8_byte(d < 26 ? 'a' + d : '0' + d - 26);
+}
+
+inline int punycode_value(utf8_byte b) noexcept {
+    if (b >= '0' && b <= '9') return b - '0' + 26;
+    b |= 0x20;
+    if (b >= 'a' && b <= 'z') return b - 'a';
+    return -1;
+}
+
+inline std::uint32_t
+punycode_threshold(std::uint32_t k, std::uint32_t bias) noexcept {
+    if (k <= bias) return punycode_tmin;
+    if (k >= bias + punycode_tmax) return punycode_tmax;
+    return k - bias;
+}
+
+/**
+ * The bias adaptation function of RFC 3492.
+ */
+inline std::uint32_t punycode_adapt(std::uint32_t delta, std::uint32_t points,
+    bool first) noexcept {
+    delta = first ? delta / 700 : delta / 2;
+    delta += delta / points;
+    std::uint32_t k = 0;
+    while (delta > (punycode_base - punycode_tmin) * punycode_tmax / 2) {
+        delta /= punycode_base - punycode_tmin;
+        k += punycode_base;
+    }
+    return k + (punycode_base - punycode_tmin + 1) * delta / (delta + 38);
+}
+
+} /* namespace detail */
+
+/**
+ * Encodes a UTF8 string with Punycode (RFC 3492), without the "xn--" prefix.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 5 * len + 1 bytes.
+ * @return The conversion result, the error is error::invalid_utf8,
+ * error::incomplete or error::invalid_codepoint if the deltas overflow.
+ */
+inline convert_result
+punycode_encode(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    using namespace detail;
+    convert_result result;
+    auto end = src + len;
+
+    // Copy the basic codepoints first
+    std::uint32_t total = 0;
+    for (auto it = src; it != end; ++total) {
+        auto n = parse_strict(it, end);
+        if (n < 0) {
+            result.read = utf8_usize(it - src);
+            result.error = is_truncated_utf8(it, end)
+                ? error::incomplete : error::invalid_utf8;
+            return result;
+        }
+        if (*it < 0x80) dst[result.written++] = *it;
+        it += n;
+    }
+    auto basic = std::uint32_t(result.written);
+    if (basic > 0) dst[result.written++] = '-';
+
+    std::uint32_t next = 0x80;
+    std::uint32_t bias = 72;
+    std::uint64_t delta = 0;
+    for (auto handled = basic; handled < total; ++delta, ++next) {
+        // The smallest codepoint not handled yet
+        utf8_cp min = 0x110000;
+        utf8_cp cp = 0;
+        for (auto it = src; it != end;) {
+            it += read_next(it, end, cp);
+            if (cp >= next && cp < min) min = cp;
+        }
+        delta += std::uint64_t(min - next) * (handled + 1);
+        next = min;
+
+        for (auto it = src; it != end;) {
+            it += read_next(it, end, cp);
+            if (cp < next) ++delta;
+            if (delta > 0xffffffff) {
+                result.error = error::invalid_codepoint;
+                return result;
+            }
+            if (cp != next) continue;
+
+            // Write delta as a variable-length integer
+            auto q = std::uint32_t(delta);
+            for (auto k = punycode_base;; k += punycode_base) {
+                auto t = punycode_threshold(k, bias);
+                if (q < t) break;
+                dst[result.written++] =
+                    punycode_digit(t + (q - t) % (punycode_base - t));
+                q = (q - t) / (punycode_base - t);
+            }
+            dst[result.written++] = punycode_digit(q);
+            bias = punycode_adapt(std::uint32_t(delta), handled + 1,
+                handled == basic);
+            delta = 0;
+            ++handled;
+        }
+    }
+    result.read = len;
+    return result;
+}
+
+/**
+ * Decodes a Punycode string (RFC 3492), without the "xn--" prefix, to UTF8.
+ * @param src The Punycode source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 4 * len bytes.
+ * @return The conversion result, the error is error::invalid_sequence for
+ * malformed input, or error::invalid_codepoint if it decodes to basic,
+ * surrogate or out of range codepoints.
+ */
+inline convert_result
+punycode_decode(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    using namespace detail;
+    convert_result result;
+    auto fail = [&](utf8_ssize error) {
+        result.error = error;
+        return result;
+    };
+
+    // Everything before the last delimiter is basic
+    auto delimiter = std::find(std::make_reverse_iterator(src + len),
+        std::make_reverse_iterator(src), '-').base();
+    auto basic = delimiter == src ? 0 : utf8_usize(delimiter - src - 1);
+    for (utf8_usize i = 0; i < basic; ++i) {
+        if (src[i] >= 0x80) return fail(error::invalid_sequence);
+        dst[i] = src[i];
+    }
+    result.written = basic;
+    result.read = basic == 0 ? 0 : basic + 1;
+
+    std::uint32_t count = std::uint32_t(basic);
+    std::uint32_t next = 0x80;
+    std::uint32_t bias = 72;
+    std::uint64_t i = 0;
+    while (result.read < len) {
+        auto old_i = i;
+        std::uint64_t w = 1;
+        for (auto k = punycode_base;; k += punycode_base) {
+            if (result.read == len) return fail(error::invalid_sequence);
+            auto digit = punycode_value(src[result.read++]);
+            if (digit < 0) return fail(error::invalid_sequence);
+            i += std::uint64_t(digit) * w;
+            auto t = punycode_threshold(k, bias);
+            if (std::uint32_t(digit) < t) break;
+            w *= punycode_base - t;
+            if (i > 0xffffffff || w > 0xffffffff) {
+                return fail(error::invalid_sequence);
+            }
+        }
+        if (i > 0xffffffff) return fail(error::invalid_sequence);
+        bias = punycode_adapt(std::uint32_t(i - old_i), count + 1, old_i == 0);
+        auto cp = next + i / (count + 1);
+        i %= count + 1;
+        if (cp < 0x80 || cp >= 0x110000 || is_surrogate(utf8_cp(cp))) {
+            return fail(error::invalid_codepoint);
+        }
+        next = std::uint32_t(cp);
+
+        // Insert the codepoint before the i-th codepoint
+        utf8_usize offset = 0;
+        for (std::uint64_t skip = i; skip > 0; --skip) {
+            do ++offset;
+            while (offset < result.written && is_continuation(dst[offset]));
+        }
+        utf8_byte encoded[4];
+        auto n = utf8_usize(encode_cp(encoded, next));
+        std::memmove(dst + offset + n, dst + offset, result.written - offset);
+        std::memcpy(dst + offset, encoded, n);
+        result.written += n;
+        ++count;
+        ++i;
+    }
+    return result;
+}
+
+/**
+ * The longest domain name in its ASCII form, without the trailing dot.
+ */
+inline constexpr utf8_usize max_domain_length = 253;
+
+/**
+ * The longest label of a domain name in its ASCII form.
+ */
+inline constexpr utf8_usize max_label_length = 63;
+
+using tables::idna_status;
+
+namespace detail {
+
+/**
+ * Writes the UTS #46 mapping of a non-ASCII codepoint.
+ * @return The number of bytes written (at most 64), or error::invalid_label
+ * for disallowed codepoints.
+ */
+inline utf8_ssize idna_map(utf8_cp cp, utf8_byte* dst) noexcept {
+    auto const& starts = tables::idna_starts;
+    auto i = utf8_usize(std::upper_bound(std::begin(starts), std::end(starts),
+        cp) - std::begin(starts)) - 1;
+    switch (idna_status(tables::idna_values[i])) {
+    case idna_status::valid:
+        return encode_cp(dst, cp);
+
+    case idna_status::ignored:
+        return 0;
+
+    case idna_status::mapped: {
+        auto mapping = tables::idna_mapping[i];
+        if ((mapping & tables::idna_sequence_flag) == 0) {
+            return encode_cp(dst, mapping + cp - starts[i]);
+        }
+        auto seq = tables::idna_sequences
+            + (mapping & ~tables::idna_sequence_flag);
+        std::memcpy(dst, seq + 1, seq[0]);
+        return seq[0];
+    }
+
+    default:
+        return error::invalid_label;
+    }
+}
+
+/**
+ * Checks the UTS #46 validity criteria of a label in Unicode form.
+ */
+inline bool idna_valid_label(utf8_byte const* label, utf8_usize len) noexcept {
+    if (len == 0 || label[0] == '-' || label[len - 1] == '-') return false;
+    auto end = label + len;
+    utf8_cp cp = 0;
+    utf8_usize index = 0;
+    for (auto it = label; it != end; ++index) {
+        auto n = read_next(it, end, cp);
+        if (n <= 0) return false;
+        // No "--" in the third and fourth positions
+        if (index == 2 && cp == '-' && it + 1 != end && it[1] == '-') {
+            return false;
+        }
+        if (index == 0) {
+            auto category = get_general_category(cp);
+            if (category == general_category::nonspacing_mark
+                || category == general_category::spacing_mark
+                || category == general_category::enclosing_mark) {
+                return false;
+            }
+        }
+        // Decoded Punycode must be made of valid codepoints only
+        if (cp < 0x80) {
+            bool lower = cp >= 'a' && cp <= 'z';
+            bool digit = cp >= '0' && cp <= '9';
+            if (!lower && !digit && cp != '-') return false;
+        }
+        else {
+            auto const& starts = tables::idna_starts;
+            auto i = std::upper_bound(std::begin(starts), std::end(starts), cp)
+                - std::begin(starts) - 1;
+            if (idna_status(tables::idna_values[i]) != idna_status::valid) {
+                return false;
+            }
+        }
+        it += n;
+    }
+    return true;
+}
+
+/**
+ * Converts a mapped label to its ASCII form.
+ * @param dst The destination, must have room for max_label_length bytes.
+ * @return The length of the ASCII form, or error::invalid_label.
+ */
+inline utf8_ssize idna_label_to_ascii(utf8_byte const* label, utf8_usize len,
+    bool ascii, utf8_byte* dst) noexcept {
+    if (ascii) {
+        if (len > max_label_length) return error::invalid_label;
+        if (len >= 4 && std::memcmp(label, "xn--", 4) == 0) {
+            // Punycode must decode to a valid, non-ASCII label
+            utf8_byte decoded[4 * max_label_length];
+            auto res = punycode_decode(label + 4, len - 4, decoded);
+            if (res.error != 0 || res.written == 0
+                || count_codepoints(decoded, res.written) == res.written
+                || !idna_valid_label(decoded, res.written)) {
+                return error::invalid_label;
+            }
+        }
+        else if (!idna_valid_label(label, len)) {
+            return error::invalid_label;
+        }
+        std::memcpy(dst, label, len);
+        return utf8_ssize(len);
+    }
+
+    if (!idna_valid_label(label, len)) return error::invalid_label;
+    utf8_byte encoded[5 * 4 * max_label_length + 1];
+    auto res = punycode_encode(label, len, encoded);
+    if (res.error != 0 || res.written + 4 > max_label_length) {
+        return error::invalid_label;
+    }
+    std::memcpy(dst, "xn--", 4);
+    std::memcpy(dst + 4, encoded, res.written);
+    return utf8_ssize(res.written + 4);
+}
+
+} /* namespace detail */
+
+/**
+ * Converts a domain name to its ASCII form, by UTS #46 nontransitional
+ * processing with the STD3 rules, and with DNS length verification. Labels are
+ * mapped (case folded), checked and encoded with Punycode. ASCII codepoints
+ * never touch the mapping tables, and nothing is allocated.
+ * The bidi and joiner rules are not checked, and labels are not normalized to
+ * NFC, which the input is expected to be.
+ * @param src The UTF8 domain name.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for max_domain_length + 1
+ * bytes.
+ * @return The conversion result, the error is error::invalid_utf8,
+ * error::incomplete or error::invalid_label. On error, read is the offset of
+ * the offending label.
+ */
+inline convert_result
+idna_to_ascii(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    convert_result result;
+    auto end = src + len;
+    // The current label, mapped
+    utf8_byte label[4 * max_label_length];
+    utf8_usize label_len = 0;
+    bool ascii = true;
+
+    auto fail = [&](utf8_ssize error) {
+        result.error = error;
+        return result;
+    };
+    auto finish_label = [&]() {
+        utf8_byte encoded[max_label_length];
+        auto n = detail::idna_label_to_ascii(label, label_len, ascii, encoded);
+        if (n < 0) return false;
+        if (result.written + utf8_usize(n) > max_domain_length) return false;
+        std::memcpy(dst + result.written, encoded, utf8_usize(n));
+        result.written += utf8_usize(n);
+        label_len = 0;
+        ascii = true;
+        return true;
+    };
+
+    for (auto it = src; it != end;) {
+        auto n = detail::parse_strict(it, end);
+        if (n < 0) {
+            result.read = utf8_usize(it - src);
+            return fail(detail::is_truncated_utf8(it, end)
+                ? error::incomplete : error::invalid_utf8);
+        }
+        auto cp = detail::calc_codepoint(it, utf8_usize(n));
+        it += n;
+
+        utf8_byte mapped[64];
+        utf8_ssize mapped_len = 1;
+        if (cp < 0x80) {
+            // The STD3 rules, uppercase letters are mapped
+            if (cp >= 'A' && cp <= 'Z') cp |= 0x20;
+            bool lower = cp >= 'a' && cp <= 'z';
+            bool digit = cp >= '0' && cp <= '9';
+            if (!lower && !digit && cp != '-' && cp != '.') {
+                return fail(error::invalid_label);
+            }
+            mapped[0] = utf8_byte(cp);
+        }
+        else {
+            mapped_len = detail::idna_map(cp, mapped);
+            if (mapped_len < 0) return fail(error::invalid_label);
+        }
+
+        for (utf8_ssize i = 0; i < mapped_len; ++i) {
+            if (mapped[i] != '.') {
+                if (label_len == sizeof(label)) {
+                    return fail(error::invalid_label);
+                }
+                ascii = ascii && mapped[i] < 0x80;
+                label[label_len++] = mapped[i];
+                continue;
+            }
+            if (!finish_label()) return fail(error::invalid_label);
+            dst[result.written++] = '.';
+            result.read = utf8_usize(it - src);
+        }
+    }
+    // A trailing dot is the root, otherwise the last label must not be empty
+    if (label_len > 0 || result.written == 0) {
+        if (!finish_label()) return fail(error::invalid_label);
+    }
+    result.read = len;
+    return result;
+}
+
+/**
+ * Converts a domain name to its Unicode form, by mapping and checking it like
+ * @see idna_to_ascii, and then decoding its Punycode labels.
+ * @param src The UTF8 domain name.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for
+ * 4 * (max_domain_length + 1) bytes.
+ * @return @see idna_to_ascii
+ */
+inline convert_result
+idna_to_unicode(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    utf8_byte ascii[max_domain_length + 1];
+    auto result = idna_to_ascii(src, len, ascii);
+    if (result.error != 0) return result;
+
+    auto end = ascii + result.written;
+    result.written = 0;
+    for (auto it = ascii; it != end;) {
+        auto dot = std::find(it, end, '.');
+        auto label_len = utf8_usize(dot - it);
+        if (label_len >= 4 && std::memcmp(it, "xn--", 4) == 0) {
+            // Already checked to be valid
+            result.written += punycode_decode(it + 4, label_len - 4,
+                dst + result.written).written;
+        }
+        else {
+            std::memcpy(dst + result.written, it, label_len);
+            result.written += label_len;
+        }
+        if (dot == end) break;
+        dst[result.written++] = '.';
+        it = dot + 1;
+    }
+    return result;
+}
+
+/**
+ * A set of ASCII bytes for percent_encode to escape, besides the non-ASCII
+ * bytes that are always escaped. The predefined sets are in percent_sets.
+ */
+class percent_encode_set {
+public:
+    /**
+     * Creates the set of C0 controls and DEL, which every set contains.
+     */
+    constexpr percent_encode_set() noexcept = default;
+
+    /**
+     * @param chars The ASCII characters to add.
+     * @return A copy of the set, extended with the characters.
+     */
+    constexpr percent_encode_set with(char const* chars) const noexcept {
+        auto result = *this;
+        for (; *chars != '\0'; ++chars) {
+            auto b = utf8_byte(*chars);
+            if (b < 64) result.low |= std::uint64_t(1) << b;
+            else result.high |= std::uint64_t(1) << (b - 64);
+        }
+        return result;
+    }
+
+    /**
+     * @return A copy of the set, that writes spaces as '+' (like
+     * application/x-www-form-urlencoded).
+     */
+    constexpr percent_encode_set with_space_as_plus() const noexcept {
+        auto result = with(" ");
+        result.plus = true;
+        return result;
+    }
+
+    /**
+     * Checks if a byte has to be escaped.
+     */
+    constexpr bool contains(utf8_byte b) const noexcept {
+        if (b >= 128) return true;
+        return b < 64 ? (low >> b & 1) != 0 : (high >> (b - 64) & 1) != 0;
+    }
+
+    /**
+     * @return True, if spaces are written as '+'.
+     */
+    constexpr bool space_as_plus() const noexcept {
+        return plus;
+    }
+
+private:
+    std::uint64_t low = 0xffffffff;
+    std::uint64_t high = std::uint64_t(1) << 63;
+    bool plus = false;
+};
+
+/**
+ * The percent-encode sets of the WHATWG URL standard.
+ */
+namespace percent_sets {
+
+inline constexpr percent_encode_set c0_control{};
+inline constexpr auto fragment = c0_control.with(" \"<>`");
+inline constexpr auto query = c0_control.with(" \"#<>");
+inline constexpr auto special_query = query.with("'");
+inline constexpr auto path = query.with("?`{}");
+inline constexpr auto userinfo = path.with("/:;=@[\\]^|");
+inline constexpr auto component = userinfo.with("$%&+,");
+inline constexpr auto form = component.with("!'()~").with_space_as_plus();
+
+} /* namespace percent_sets */
+
+namespace detail {
+
+/**
+ * Finds the bytes of a 16-byte block that are not unreserved URL characters
+ * (ASCII alphanumerics and "-._~"), which no percent-encode set contains.
+ * @return The mask of the bytes.
+ */
+inline std::uint32_t url_reserved_mask(utf8_byte const* src) noexcept {
+#if UTF8PP_SSE2
+    auto chunk = _mm_loadu_si128((__m128i const*)src);
+    auto in_range = [&](char lo, char hi) {
+        return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(char(lo - 1))),
+            _mm_cmplt_epi8(chunk, _mm_set1_epi8(char(hi + 1))));
+    };
+    // Non-ASCII bytes are negative, so they are in none of the ranges
+    auto unreserved = _mm_or_si128(
+        _mm_or_si128(in_range('0', '9'), in_range('A', 'Z')),
+        _mm_or_si128(in_range('a', 'z'), in_range('-', '.')));
+    unreserved = _mm_or_si128(unreserved,
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')),
+            _mm_cmpeq_epi8(chunk, _mm_set1_epi8('~'))));
+    return ~std::uint32_t(_mm_movemask_epi8(unreserved)) & 0xffff;
+#else
+    std::uint32_t mask = 0;
+    for (unsigned i = 0; i < 16; ++i) {
+        auto b = src[i];
+        bool alnum = (b >= '0' && b <= '9') || ((b | 0x20) >= 'a'
+            && (b | 0x20) <= 'z');
+        if (!alnum && b != '-' && b != '.' && b != '_' && b != '~') {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+/**
+ * Finds the first byte of a 16-byte block that percent decoding can't copy as
+ * it is: a '%', a '+' if it means a space, or a non-ASCII byte (that has to
+ * be validated).
+ * @return The offset of the byte, or 16 if there is none.
+ */
+inline unsigned
+url_decode_special(utf8_byte const* src, bool plus_as_space) noexcept {
+#if UTF8PP_SSE2
+    auto chunk = _mm_loadu_si128((__m128i const*)src);
+    auto special = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('%')),
+        _mm_cmplt_epi8(chunk, _mm_setzero_si128()));
+    if (plus_as_space) {
+        special = _mm_or_si128(special,
+            _mm_cmpeq_epi8(chunk, _mm_set1_epi8('+')));
+    }
+    auto mask = std::uint32_t(_mm_movemask_epi8(special));
+    return mask == 0 ? 16 : ctz(mask);
+#else
+    unsigned i = 0;
+    for (; i < 16; ++i) {
+        auto b = src[i];
+        if (b == '%' || b >= 0x80 || (plus_as_space && b == '+')) break;
+    }
+    return i;
+#endif
+}
+
+/**
+ * Reads the next decoded byte, either a raw byte or a %XX escape. A '%' that
+ * isn't followed by two hex digits is an ordinary byte.
+ * @return The byte, and advances src.
+ */
+inline utf8_byte
+next_url_byte(utf8_byte const*& src, utf8_byte const* end) noexcept {
+    if (*src == '%' && end - src >= 3) {
+        auto hi = hex_value(src[1]);
+        auto lo = hex_value(src[2]);
+        if (hi >= 0 && lo >= 0) {
+            src += 3;
+            return utf8_byte(hi << 4 | lo);
+        }
+    }
+    return *src++;
+}
+
+} /* namespace detail */
+
+/**
+ * Percent-encodes UTF8 text, and validates it in the same pass.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 3 * len bytes.
+ * @param set The bytes to escape, @see percent_sets.
+ * @return The conversion result, the error is error::invalid_utf8 or
+ * error::incomplete.
+ */
+inline convert_result percent_encode(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst, percent_encode_set const& set) noexcept {
+    static constexpr char hex[] = "0123456789ABCDEF";
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        if (len - result.read >= 16) {
+            // Only the reserved bytes have to be looked up in the set
+            auto it = src + result.read;
+            auto mask = detail::url_reserved_mask(it);
+            unsigned clean = 16;
+            for (; mask != 0; mask &= mask - 1) {
+                auto i = detail::ctz(mask);
+                if (set.contains(it[i])) {
+                    clean = i;
+                    break;
+                }
+            }
+            std::memcpy(dst + result.written, it, clean);
+            result.read += clean;
+            result.written += clean;
+            if (clean == 16) continue;
+        }
+
+        auto it = src + result.read;
+        auto out = dst + result.written;
+        if (*it == ' ' && set.space_as_plus()) {
+            *out = '+';
+            ++result.read;
+            ++result.written;
+            continue;
+        }
+        if (!set.contains(*it)) {
+            *out = *it;
+            ++result.read;
+            ++result.written;
+            continue;
+        }
+
+        utf8_ssize n = 1;
+        if (*it >= 0x80) {
+            n = detail::parse_strict(it, end);
+            if (n < 0) {
+                result.error = detail::is_truncated_utf8(it, end)
+                    ? error::incomplete : error::invalid_utf8;
+                return result;
+            }
+        }
+        for (utf8_ssize i = 0; i < n; ++i) {
+            out[3 * i] = '%';
+            out[3 * i + 1] = utf8_byte(hex[it[i] >> 4]);
+            out[3 * i + 2] = utf8_byte(hex[it[i] & 0xf]);
+        }
+        result.read += utf8_usize(n);
+        result.written += utf8_usize(3 * n);
+    }
+    return result;
+}
+
+/**
+ * Decodes percent-encoded text, and validates the decoded UTF8 in the same
+ * pass. Raw and escaped bytes may be mixed in a sequence, and a '%' that
+ * isn't followed by two hex digits is kept as it is.
+ * @param src The percent-encoded source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @param plus_as_space True, if '+' should be decoded as a space (like
+ * application/x-www-form-urlencoded).
+ * @return The conversion result, the error is error::invalid_utf8 or
+ * error::incomplete. On error, read is the offset of the invalid sequence.
+ */
+inline convert_result percent_decode(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst, bool plus_as_space = false) noexcept {
+    convert_result result;
+    auto end = src + len;
+    while (result.read < len) {
+        if (len - result.read >= 16) {
+            // Decoding only shrinks, so the block always fits
+            auto clean = detail::url_decode_special(src + result.read,
+                plus_as_space);
+            std::memcpy(dst + result.written, src + result.read, 16);
+            result.read += clean;
+            result.written += clean;
+            if (clean == 16) continue;
+        }
+
+        auto it = src + result.read;
+        if (*it == '+' && plus_as_space) {
+            dst[result.written++] = ' ';
+            ++result.read;
+            continue;
+        }
+
+        // Gather a whole sequence, then validate it
+        utf8_byte seq[4];
+        seq[0] = detail::next_url_byte(it, end);
+        utf8_ssize n = 1;
+        if (seq[0] >= 0x80) {
+            auto need = seq[0] < 0b11100000 ? 2 : seq[0] < 0b11110000 ? 3 : 4;
+            while (n < need && it != end && (*it == '%' || *it >= 0x80)) {
+                auto peek = it;
+                auto b = detail::next_url_byte(peek, end);
+                if (!detail::is_continuation(b)) break;
+                seq[n++] = b;
+                it = peek;
+            }
+            auto valid = detail::parse_strict(seq, seq + n);
+            if (valid != n) {
+                bool cut = it == end && n < need
+                    && detail::is_truncated_utf8(seq, seq + n);
+                result.error = cut ? error::incomplete : error::invalid_utf8;
+                return result;
+            }
+        }
+        std::memcpy(dst + result.written, seq, utf8_usize(n));
+        result.written += utf8_usize(n);
+        result.read = utf8_usize(it - src);
+    }
+    return result;
+}
+
+/**
+ * What xml_escape does with invalid UTF8 and codepoints that XML 1.0 doesn't
+ * allow.
+ */
+enum class xml_invalid {
+    /**
+     * Stop with an error.
+     */
+    reject,
+
+    /**
+     * Write U+FFFD instead, for every invalid byte or codepoint.
+     */
+    replace,
+};
+
+namespace detail {
+
+/**
+ * Checks if a codepoint matches the Char production of XML 1.0.
+ */
+inline constexpr bool is_xml_char(utf8_cp cp) noexcept {
+    if (cp < 0x20) return cp == '\t' || cp == '\n' || cp == '\r';
+    if (cp < 0xd800) return true;
+    if (cp < 0xe000) return false;
+    return cp != 0xfffe && cp != 0xffff && cp < 0x110000;
+}
+
+/**
+ * Finds the first byte of a 16-byte block that XML text can't hold as it is:
+ * one of <>&"', a control character, or a non-ASCII byte (that has to be
+ * validated).
+ * @return The offset of the byte, or 16 if there is none.
+ */
+inline unsigned xml_special(utf8_byte const* src) noexcept {
+#if UTF8PP_SSE2
+    auto chunk = _mm_loadu_si128((__m128i const*)src);
+    auto is = [&](char c) { return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(c)); };
+    // Non-ASCII bytes are negative, so they are below 0x20 too
+    auto special = _mm_or_si128(
+        _mm_or_si128(_mm_or_si128(is('<'), is('>')), _mm_or_si128(is('&'),
+            is('"'))),
+        _mm_or_si128(is('\''), _mm_cmplt_epi8(chunk, _mm_set1_epi8(0x20))));
+    auto mask = std::uint32_t(_mm_movemask_epi8(special));
+    return mask == 0 ? 16 : ctz(mask);
+#else
+    unsigned i = 0;
+    for (; i < 16; ++i) {
+        auto b = src[i];
+        if (b < 0x20 || b >= 0x80 || b == '<' || b == '>' || b == '&'
+            || b == '"' || b == '\'') {
+            break;
+        }
+    }
+    return i;
+#endif
+}
+
+} /* namespace detail */
+
+/**
+ * Escapes UTF8 text for XML or HTML text and attribute values. <>&"' are
+ * escaped, and the text is checked against the Char production of XML 1.0 in
+ * the same pass.
+ * @param src The UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for 6 * len bytes.
+ * @param invalid What to do with invalid UTF8 and codepoints.
+ * @return The conversion result. When rejecting, the error is
+ * error::invalid_utf8 or error::invalid_codepoint.
+ */
+inline convert_result xml_escape(utf8_byte const* src, utf8_usize len,
+    utf8_byte* dst, xml_invalid invalid = xml_invalid::reject) noexcept {
+    convert_result result;
+    auto end = src + len;
+    auto put = [&](char const* str, utf8_usize n) {
+        std::memcpy(dst + result.written, str, n);
+        result.written += n;
+    };
+    while (result.read < len) {
+        if (len - result.read >= 16) {
+            auto clean = detail::xml_special(src + result.read);
+            std::memcpy(dst + result.written, src + result.read, 16);
+            result.read += clean;
+            result.written += clean;
+            if (clean == 16) continue;
+        }
+
+        auto it = src + result.read;
+        switch (*it) {
+        case '<': put("&lt;", 4); ++result.read; continue;
+        case '>': put("&gt;", 4); ++result.read; continue;
+        case '&': put("&amp;", 5); ++result.read; continue;
+        case '"': put("&quot;", 6); ++result.read; continue;
+        case '\'': put("&#39;", 5); ++result.read; continue;
+        }
+
+        utf8_ssize n = 1;
+        utf8_ssize error = 0;
+        if (*it >= 0x80) {
+            n = detail::parse_strict(it, end);
+            if (n < 0) {
+                error = error::invalid_utf8;
+                n = 1;
+            }
+        }
+        if (error == 0) {
+            auto cp = detail::calc_codepoint(it, utf8_usize(n));
+            if (!detail::is_xml_char(cp)) error = error::invalid_codepoint;
+        }
+        if (error != 0) {
+            if (invalid == xml_invalid::reject) {
+                result.error = error;
+                return result;
+            }
+            put("\xef\xbf\xbd", 3);
+        }
+        else {
+            std::memcpy(dst + result.written, it, utf8_usize(n));
+            result.written += utf8_usize(n);
+        }
+        result.read += utf8_usize(n);
+    }
+    return result;
+}
+
+/**
+ * Decodes the predefined entities of XML (&lt; &gt; &amp; &quot; &apos;) and
+ * numeric character references in UTF8 text. The raw text is validated in the
+ * same pass.
+ * @param src The escaped UTF8 source.
+ * @param len The length of the source.
+ * @param dst The destination buffer, must have room for len bytes.
+ * @return The conversion result. The error is error::invalid_sequence for
+ * malformed or unknown references, and error::invalid_codepoint for references
+ * to codepoints that aren't XML characters. It is error::invalid_utf8 or
+ * error::incomplete for invalid UTF8.
+ */
+inline convert_result
+xml_unescape(utf8_byte const* src, utf8_usize len, utf8_byte* dst) noexcept {
+    static constexpr struct {
+        char const* name;
+        utf8_usize len;
+        utf8_byte value;
+    } entities[] = {
+        { "lt;", 3, '<' }, { "gt;", 3, '>' }, { "amp;", 4, '&' },
+        { "quot;", 5, '"' }, { "apos;", 5, '\'' },
+    };
+    convert_result result;
+    auto end = src + len;
+    auto fail = [&](utf8_ssize error) {
+        result.error = error;
+        return result;
+    };
+    while (result.read < len) {
+        if (len - result.read >= 16) {
+            // References only shrink, so the block always fits
+            auto it = src + result.read;
+            unsigned clean = 16;
+#if UTF8PP_SSE2
+            auto chunk = _mm_loadu_si128((__m128i const*)it);
+            auto special = _mm_or_si128(
+                _mm_cmpeq_epi8(chunk, _mm_set1_epi8('&')),
+                _mm_cmplt_epi8(chunk, _mm_setzero_si128()));
+            auto mask = std::uint32_t(_mm_movemask_epi8(special));
+            if (mask != 0) clean = detail::ctz(mask);
+#else
+            for (clean = 0; clean < 16; ++clean) {
+                if (it[clean] == '&' || it[clean] >= 0x80) break;
+            }
+#endif
+            std::memcpy(dst + result.written, it, 16);
+            result.read += clean;
+            result.written += clean;
+            if (clean == 16) continue;
+        }
+
+        auto it = src + result.read;
+        if (*it >= 0x80) {
+            auto n = detail::parse_strict(it, end);
+            if (n < 0) {
+                return fail(detail::is_truncated_utf8(it, end)
+                    ? error::incomplete : error::invalid_utf8);
+            }
+            std::memcpy(dst + result.written, it, utf8_usize(n));
+            result.read += utf8_usize(n);
+            result.written += utf8_usize(n);
+            continue;
+        }
+        if (*it != '&') {
+            dst[result.written++] = *it;
+            ++result.read;
+            continue;
+        }
+
+        auto semicolon = std::find(it + 1, std::min(end, it + 12), ';');
+        if (semicolon == std::min(end, it + 12)) {
+            return fail(error::invalid_sequence);
+        }
+        auto ref_len = utf8_usize(semicolon - it) + 1;
+        if (it[1] != '#') {
+            auto found = std::find_if(std::begin(entities), std::end(entities),
+                [&](auto const& e) {
+                    return e.len == ref_len - 1
+                        && std::memcmp(e.name, it + 1, e.len) == 0;
+                });
+            if (found == std::end(entities)) {
+                return fail(error::invalid_sequence);
+            }
+            dst[result.written++] = found->value;
+            result.read += ref_len;
+            continue;
+        }
+
+        // Numeric reference, decimal or hexadecimal
+        bool hex = it[2] == 'x';
+        auto digits = it + (hex ? 3 : 2);
+        if (digits == semicolon) return fail(error::invalid_sequence);
+        utf8_cp cp = 0;
+        for (auto d = digits; d != semicolon; ++d) {
+            auto value = hex ? detail::hex_value(*d)
+                : (*d >= '0' && *d <= '9' ? *d - '0' : -1);
+            if (value < 0) return fail(error::invalid_sequence);
+            cp = cp * (hex ? 16 : 10) + utf8_cp(value);
+            if (cp >= 0x110000) return fail(error::invalid_codepoint);
+        }
+        if (!detail::is_xml_char(cp)) return fail(error::invalid_codepoint);
+        result.written += utf8_usize(encode_cp(dst + result.written, cp));
+        result.read += ref_len;
+    }
+    return result;
+}
+
+/**
+ * The offset of a match that wasn't found.
+ */
+inline constexpr utf8_usize not_found = ~utf8_usize(0);
+
+/**
+ * A match of a substring search.
+ */
+struct search_match {
+    /**
+     * The byte offset of the match, or not_found.
+     */
+    utf8_usize offset = not_found;
+
+    /**
+     * The byte length of the match. Ignoring case, it can differ from the
+     * length of the needle, like ß matches "ss".
+     */
+    utf8_usize length = 0;
+
+    /**
+     * The codepoint offset of the match, if it was requested.
+     */
+    utf8_usize codepoint = 0;
+};
+
+namespace detail {
+
+/**
+ * Checks a candidate whose first and last bytes already match: the rest of
+ * the needle has to match too, and the match has to start (and if
+ * EndBoundary is true, end) on codepoint boundaries, even in invalid text.
+ */
+template <bool EndBoundary = true>
+inline bool verify_match(utf8_byte const* ptr, utf8_byte const* end,
+    utf8_byte const* needle, utf8_usize n) noexcept {
+    return !is_continuation(ptr[0])
+        && (!EndBoundary || ptr + n == end || !is_continuation(ptr[n]))
+        && std::memcmp(ptr, needle, n) == 0;
+}
+
+/**
+ * Finds the first match of a non-empty needle in [src, end). Candidates are
+ * filtered by their first and last bytes, 16 positions at a time.
+ * @see verify_match for EndBoundary.
+ * @return The pointer to the match, or end.
+ */
+template <bool EndBoundary = true>
+inline utf8_byte const* find_forward(utf8_byte const* src,
+    utf8_byte const* end, utf8_byte const* needle, utf8_usize n) noexcept {
+    if (utf8_usize(end - src) < n) return end;
+    // Candidates are before limit
+    auto limit = end - n + 1;
+#if UTF8PP_SSE2
+    auto first = _mm_set1_epi8(char(needle[0]));
+    auto last = _mm_set1_epi8(char(needle[n - 1]));
+    for (; limit - src >= 16; src += 16) {
+        auto head = _mm_loadu_si128((__m128i const*)src);
+        auto tail = _mm_loadu_si128((__m128i const*)(src + n - 1));
+        auto mask = std::uint32_t(_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+        for (; mask != 0; mask &= mask - 1) {
+            auto candidate = src + ctz(mask);
+            if (verify_match<EndBoundary>(candidate, end, needle, n)) {
+                return candidate;
+            }
+        }
+    }
+#endif
+    for (; src != limit; ++src) {
+        if (src[0] == needle[0] && src[n - 1] == needle[n - 1]
+            && verify_match<EndBoundary>(src, end, needle, n)) {
+            return src;
+        }
+    }
+    return end;
+}
+
+/**
+ * Finds the last match of a non-empty needle in [begin, end), the mirror of
+ * find_forward.
+ * @return The pointer to the match, or end.
+ */
+inline utf8_byte const* find_backward(utf8_byte const* begin,
+    utf8_byte const* end, utf8_byte const* needle, utf8_usize n) noexcept {
+    if (utf8_usize(end - begin) < n) return end;
+    // Candidates are before src
+    auto src = end - n + 1;
+#if UTF8PP_SSE2
+    auto first = _mm_set1_epi8(char(needle[0]));
+    auto last = _mm_set1_epi8(char(needle[n - 1]));
+    for (; src - begin >= 16; src -= 16) {
+        auto block = src - 16;
+        auto head = _mm_loadu_si128((__m128i const*)block);
+        auto tail = _mm_loadu_si128((__m128i const*)(block + n - 1));
+        auto mask = std::uint32_t(_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+        while (mask != 0) {
+            auto idx = bsr(mask);
+            if (verify_match(block + idx, end, needle, n)) return block + idx;
+            mask &= ~(std::uint32_t(1) << idx);
+        }
+    }
+#endif
+    while (src != begin) {
+        --src;
+        if (src[0] == needle[0] && src[n - 1] == needle[n - 1]
+            && verify_match(src, end, needle, n)) {
+            return src;
+        }
+    }
+    return end;
+}
+
+} /* namespace detail */
+
+/**
+ * Finds the first occurrence of a UTF8 needle. Unlike a plain byte search,
+ * matches only start and end on codepoint boundaries, so a needle never
+ * matches the middle of a sequence in invalid text. An empty needle matches
+ * at the start.
+ * @param src The UTF8 haystack.
+ * @param len The length of the haystack.
+ * @param needle The UTF8 needle.
+ * @param needle_len The length of the needle.
+ * @param codepoints If true, the codepoint offset of the match is computed
+ * too.
+ * @return The match, with offset not_found if there is none.
+ */
+inline search_match find(utf8_byte const* src, utf8_usize len,
+    utf8_byte const* needle, utf8_usize needle_len,
+    bool codepoints = false) noexcept {
+    search_match result;
+    auto end = src + len;
+    auto found = needle_len == 0
+        ? src : detail::find_forward(src, end, needle, needle_len);
+    if (needle_len != 0 && found == end) return result;
+    result.offset = utf8_usize(found - src);
+    result.length = needle_len;
+    if (codepoints) result.codepoint = count_codepoints(src, result.offset);
+    return result;
+}
+
+/**
+ * Finds the last occurrence of a UTF8 needle, @see find. An empty needle
+ * matches at the end.
+ * @param src The UTF8 haystack.
+ * @param len The length of the haystack.
+ * @param needle The UTF8 needle.
+ * @param needle_len The length of the needle.
+ * @param codepoints If true, the codepoint offset of the match is computed
+ * too.
+ * @return The match, with offset not_found if there is none.
+ */
+inline search_match rfind(utf8_byte const* src, utf8_usize len,
+    utf8_byte const* needle, utf8_usize needle_len,
+    bool codepoints = false) noexcept {
+    search_match result;
+    auto end = src + len;
+    auto found = needle_len == 0
+        ? end : detail::find_backward(src, end, needle, needle_len);
+    if (needle_len != 0 && found == end) return result;
+    result.offset = utf8_usize(found - src);
+    result.length = needle_len;
+    if (codepoints) result.codepoint = count_codepoints(src, result.offset);
+    return result;
+}
+
+/**
+ * Finds all non-overlapping occurrences of a UTF8 needle, @see find. Codepoint
+ * offsets are counted incrementally, so they cost one pass over the haystack
+ * in total. An empty needle has no matches.
+ * @param src The UTF8 haystack.
+ * @param len The length of the haystack.
+ * @param needle The UTF8 needle.
+ * @param needle_len The length of the needle.
+ * @param codepoints If true, the codepoint offsets of the matches are
+ * computed too.
+ * @return The matches in order.
+ */
+inline std::vector<search_match> find_all(utf8_byte const* src,
+    utf8_usize len, utf8_byte const* needle, utf8_usize needle_len,
+    bool codepoints = false) {
+    std::vector<search_match> result;
+    if (needle_len == 0) return result;
+
+    auto end = src + len;
+    auto needle_codepoints = count_codepoints(needle, needle_len);
+    auto prev = src;
+    utf8_usize codepoint = 0;
+    for (auto it = src;;) {
+        it = detail::find_forward(it, end, needle, needle_len);
+        if (it == end) break;
+        if (codepoints) {
+            codepoint += count_codepoints(prev, utf8_usize(it - prev));
+            prev = it + needle_len;
+        }
+        result.push_back({ utf8_usize(it - src), needle_len, codepoint });
+        if (codepoints) codepoint += needle_codepoints;
+        it += needle_len;
+    }
+    return result;
+}
+
+namespace detail {
+
+/**
+ * The longest full case folding of a codepoint.
+ */
+inline constexpr int max_case_fold = 3;
+
+/**
+ * Looks up the full case folding of a codepoint (CaseFolding.txt statuses C
+ * and F).
+ * @param cp The codepoint to fold.
+ * @param dst The buffer for the folding, must have room for max_case_fold
+ * codepoints.
+ * @return The number of codepoints written.
+ */
+inline int case_fold(utf8_cp cp, utf8_cp* dst) noexcept {
+    if (cp < 0x80) {
+        dst[0] = cp >= 'A' && cp <= 'Z' ? cp + ('a' - 'A') : cp;
+        return 1;
+    }
+    auto keys = std::begin(tables::case_fold_keys);
+    auto found = std::lower_bound(keys, std::end(tables::case_fold_keys), cp);
+    if (found == std::end(tables::case_fold_keys) || *found != cp) {
+        dst[0] = cp;
+        return 1;
+    }
+    auto value = tables::case_fold_values[found - keys];
+    if ((value & tables::case_fold_sequence_flag) == 0) {
+        dst[0] = value;
+        return 1;
+    }
+    auto seq = tables::case_fold_sequences
+        + (value & ~tables::case_fold_sequence_flag);
+    std::copy(seq + 1, seq + 1 + seq[0], dst);
+    return int(seq[0]);
+}
+
+/**
+ * Checks if the full case folding of any non-ASCII codepoint contains the
+ * given ASCII codepoint, like U+212A KELVIN SIGN folds to k.
+ */
+inline bool is_in_non_ascii_fold(utf8_cp cp) noexcept {
+    return cp < 0x80
+        && (tables::case_fold_ascii_targets[cp / 64] >> (cp % 64) & 1) != 0;
+}
+
+/**
+ * Matches folded haystack codepoints against a folded needle, folding the
+ * haystack lazily. Every haystack codepoint has to be matched by its whole
+ * folding, so a needle never matches half of a ß.
+ * @return The end of the match, or nullptr if there is none.
+ */
+inline utf8_byte const* match_folded(utf8_byte const* src,
+    utf8_byte const* end, utf8_cp const* needle, utf8_usize n) noexcept {
+    utf8_usize i = 0;
+    while (i < n) {
+        if (src == end) return nullptr;
+        utf8_cp folded[max_case_fold];
+        auto len = read_next(src, end, folded[0]);
+        if (len < 0) return nullptr;
+        auto k = utf8_usize(case_fold(folded[0], folded));
+        if (k > n - i || !std::equal(folded, folded + k, needle + i)) {
+            return nullptr;
+        }
+        i += k;
+        src += len;
+    }
+    return src != end && is_continuation(*src) ? nullptr : src;
+}
+
+} /* namespace detail */
+
+/**
+ * Finds the first occurrence of a UTF8 needle, ignoring case. Both sides are
+ * compared by their full case folding, so length-changing folds like ß to ss
+ * match, but only whole haystack codepoints are matched. The needle is folded
+ * once, and the haystack lazily, only at candidates found by a vectorized scan
+ * for the first folded codepoint. An empty needle matches at the start, and an
+ * invalid one matches nothing.
+ * @param src The UTF8 haystack.
+ * @param len The length of the haystack.
+ * @param needle The UTF8 needle.
+ * @param needle_len The length of the needle.
+ * @param codepoints If true, the codepoint offset of the match is computed
+ * too.
+ * @return The match, with offset not_found if there is none.
+ */
+inline search_match find_ignore_case(utf8_byte const* src, utf8_usize len,
+    utf8_byte const* needle, utf8_usize needle_len, bool codepoints = false) {
+    search_match result;
+    if (needle_len == 0) {
+        result.offset = 0;
+        return result;
+    }
+
+    std::vector<utf8_cp> folded;
+    for (auto it = needle, needle_end = needle + needle_len;
+        it != needle_end;) {
+        utf8_cp cp[detail::max_case_fold];
+        auto n = read_next(it, needle_end, cp[0]);
+        if (n < 0) return result;
+        folded.insert(folded.end(), cp, cp + detail::case_fold(cp[0], cp));
+        it += n;
+    }
+
+    // Candidates are the ASCII bytes that fold to the first codepoint, and
+    // the non-ASCII lead bytes if non-ASCII foldings contain it
+    auto first = folded[0];
+    bool ascii = first < 0x80;
+    auto lower = utf8_byte(ascii ? first : 0);
+    auto upper = utf8_byte(lower >= 'a' && lower <= 'z'
+        ? lower - ('a' - 'A') : lower);
+    bool leads = !ascii || detail::is_in_non_ascii_fold(first);
+    auto is_candidate = [&](utf8_byte b) {
+        if (b < 0x80) return ascii && (b == lower || b == upper);
+        return leads && b >= 0xc0;
+    };
+
+    auto end = src + len;
+    auto match = [&](utf8_byte const* it) {
+        auto match_end = detail::match_folded(it, end, folded.data(),
+            folded.size());
+        if (match_end != nullptr) {
+            result.offset = utf8_usize(it - src);
+            result.length = utf8_usize(match_end - it);
+            if (codepoints) {
+                result.codepoint = count_codepoints(src, result.offset);
+            }
+            return true;
+        }
+        return false;
+    };
+    auto it = src;
+#if UTF8PP_SSE2
+    auto lower_mask = _mm_set1_epi8(char(lower));
+    auto upper_mask = _mm_set1_epi8(char(upper));
+    auto lead_mask = _mm_set1_epi8(char(leads ? 0xbf : 0x7f));
+    for (; end - it >= 16; it += 16) {
+        auto chunk = _mm_loadu_si128((__m128i const*)it);
+        // Lead bytes are the signed bytes from -64 to -1, but with no leads
+        // the bound rules out every byte
+        auto lead = _mm_and_si128(_mm_cmplt_epi8(chunk, _mm_setzero_si128()),
+            _mm_cmpgt_epi8(chunk, lead_mask));
+        auto mask = std::uint32_t(_mm_movemask_epi8(_mm_or_si128(lead,
+            ascii ? _mm_or_si128(_mm_cmpeq_epi8(chunk, lower_mask),
+                _mm_cmpeq_epi8(chunk, upper_mask)) : _mm_setzero_si128())));
+        for (; mask != 0; mask &= mask - 1) {
+            if (match(it + detail::ctz(mask))) return result;
+        }
+    }
+#endif
+    for (; it != end; ++it) {
+        if (is_candidate(*it) && match(it)) return result;
+    }
+    return result;
+}
+
+namespace detail {
+
+/**
+ * Folds the codepoint at src into UTF8, @see case_fold. Invalid bytes are
+ * copied one at a time, as they are.
+ * @param dst The destination buffer, must have room for 4 * max_case_fold
+ * bytes.
+ * @param written The number of bytes written.
+ * @return The number of source bytes consumed.
+ */
+inline utf8_usize fold_next(utf8_byte const* src, utf8_byte const* end,
+    utf8_byte* dst, utf8_usize& written) noexcept {
+    written = 1;
+    if (*src < 0x80) {
+        dst[0] = *src >= 'A' && *src <= 'Z' ? *src + ('a' - 'A') : *src;
+        return 1;
+    }
+    auto n = parse_strict(src, end);
+    if (n < 0) {
+        dst[0] = *src;
+        return 1;
+    }
+    utf8_cp folded[max_case_fold];
+    auto k = case_fold(calc_codepoint(src, utf8_usize(n)), folded);
+    written = 0;
+    for (int i = 0; i < k; ++i) {
+        written += utf8_usize(encode_cp(dst + written, folded[i]));
+    }
+    return utf8_usize(n);
+}
+
+/**
+ * Estimates how rare a byte is in typical text, higher is rarer.
+ */
+inline int byte_rarity(utf8_byte b) noexcept {
+    // The most frequent bytes, most frequent first
+    static constexpr char frequent[] =
+        " etaoinsrhldcumfpgwybv,.k\nETAISONRHLDC0123456789-_:/=\"'()";
+    if (b >= 0x80) return 24;
+    auto found = std::memchr(frequent, b, sizeof(frequent) - 1);
+    return found == nullptr
+        ? int(sizeof(frequent)) : int((char const*)found - frequent);
+}
+
+} /* namespace detail */
+
+/**
+ * A match of a keyword_matcher.
+ */
+struct keyword_match {
+    /**
+     * The index of the keyword, in the order the keywords were added.
+     */
+    utf8_usize keyword = 0;
+
+    /**
+     * The byte offset of the start of the match.
+     */
+    utf8_usize begin = 0;
+
+    /**
+     * The byte offset of the end of the match.
+     */
+    utf8_usize end = 0;
+};
+
+/**
+ * Matches many keywords at once with an Aho-Corasick automaton that runs on
+ * UTF8 bytes. The transitions are a dense table over byte classes (every
+ * byte of a keyword gets its own class, the rest share one), and while the
+ * automaton is in its start state, a vectorized prefilter skips ahead to the
+ * next occurrence of a few rare bytes that every keyword contains. Every
+ * (possibly overlapping) match is reported, but only if it starts and ends on
+ * codepoint boundaries.
+ * With ignore_case, keywords and text are compared by their full case
+ * folding. The text is folded while it is decoded, and a match has to cover
+ * whole codepoints, @see find_ignore_case.
+ */
+class keyword_matcher {
+public:
+    explicit keyword_matcher(bool ignore_case = false)
+        : ignore_case(ignore_case) { }
+
+    /**
+     * Adds a keyword, compile must be called before the next search. Empty
+     * keywords never match.
+     * @param keyword The UTF8 keyword. Invalid bytes are matched as they are.
+     * @param len The length of the keyword.
+     * @return The index of the keyword.
+     */
+    utf8_usize add(utf8_byte const* keyword, utf8_usize len) {
+        std::vector<utf8_byte> bytes;
+        if (!ignore_case) {
+            bytes.assign(keyword, keyword + len);
+        }
+        for (auto it = keyword, end = keyword + len;
+            ignore_case && it != end;) {
+            utf8_byte folded[4 * detail::max_case_fold];
+            utf8_usize written = 0;
+            it += detail::fold_next(it, end, folded, written);
+            bytes.insert(bytes.end(), folded, folded + written);
+        }
+        keywords.push_back(std::move(bytes));
+        compiled = false;
+        return keywords.size() - 1;
+    }
+
+    /**
+     * @return The number of keywords added.
+     */
+    utf8_usize keyword_count() const noexcept { return keywords.size(); }
+
+    /**
+     * Builds the automaton and the prefilter from the added keywords.
+     */
+    void compile() {
+        build_automaton();
+        build_prefilter();
+        compiled = true;
+    }
+
+    /**
+     * Calls a function with every match in a UTF8 text, ordered by their
+     * end. Matches that end at the same position are reported in the order
+     * of decreasing length.
+     * @param src The UTF8 text.
+     * @param len The length of the text.
+     * @param fn The function to call with each keyword_match.
+     */
+    template <typename Fn>
+    void for_each_match(utf8_byte const* src, utf8_usize len, Fn&& fn) const {
+        utf8pp_assert(compiled, "The matcher must be compiled!");
+        if (match_span == 0) return;
+        if (ignore_case) scan_folded(src, src + len, fn);
+        else scan(src, src + len, fn);
+    }
+
+    /**
+     * Collects every match in a UTF8 text, @see for_each_match.
+     * @param src The UTF8 text.
+     * @param len The length of the text.
+     * @return The matches.
+     */
+    std::vector<keyword_match>
+    find_all(utf8_byte const* src, utf8_usize len) const {
+        std::vector<keyword_match> result;
+        for_each_match(src, len,
+            [&](keyword_match const& m) { result.push_back(m); });
+        return result;
+    }
+
+private:
+    // The prefilter compares against at most this many bytes
+    static constexpr int max_rare_bytes = 3;
+    // Rarer bytes than this are worth a prefilter
+    static constexpr int min_rarity = 16;
+
+    bool ignore_case;
+    bool compiled = false;
+    // The keywords, case folded when ignoring case
+    std::vector<std::vector<utf8_byte>> keywords;
+
+    // The automaton works on byte classes
+    std::uint32_t class_count = 1;
+    std::uint32_t classes[256] = {};
+    // The transitions of each state, one row of class_count entries per
+    // state. States are stored premultiplied by class_count, the start state
+    // is 0, followed by the states that have matches.
+    std::vector<std::uint32_t> transitions;
+    // The states in [class_count, class_count + match_span) have matches
+    std::uint32_t match_span = 0;
+    // The keywords matched by each match state, and where they start
+    std::vector<utf8_usize> outputs;
+    std::vector<utf8_usize> output_starts;
+    utf8_usize max_length = 0;
+
+    // The rare bytes of the prefilter, and the farthest a match can start
+    // before each of them
+    int rare_count = 0;
+    utf8_byte rare_bytes[max_rare_bytes] = {};
+    utf8_usize rare_offsets[max_rare_bytes] = {};
+
+    void build_automaton() {
+        // Every byte of a keyword gets its own class
+        std::fill(std::begin(classes), std::end(classes), 0);
+        class_count = 1;
+        max_length = 0;
+        for (auto const& kw : keywords) {
+            for (auto b : kw) {
+                if (classes[b] == 0) classes[b] = class_count++;
+            }
+            max_length = std::max(max_length, kw.size());
+        }
+
+        // The trie, where 0 means a missing transition
+        std::vector<std::uint32_t> trie(class_count, 0);
+        std::vector<std::vector<utf8_usize>> matches(1);
+        for (utf8_usize i = 0; i < keywords.size(); ++i) {
+            if (keywords[i].empty()) continue;
+            std::uint32_t state = 0;
+            for (auto b : keywords[i]) {
+                auto& next = trie[state * class_count + classes[b]];
+                if (next == 0) {
+                    next = std::uint32_t(matches.size());
+                    matches.emplace_back();
+                    trie.resize(trie.size() + class_count, 0);
+                }
+                state = trie[state * class_count + classes[b]];
+            }
+            matches[state].push_back(i);
+        }
+
+        // Breadth-first, resolving the failure links into full transitions
+        auto state_count = std::uint32_t(matches.size());
+        std::vector<std::uint32_t> fail(state_count, 0);
+        std::vector<std::uint32_t> queue;
+        for (std::uint32_t c = 0; c < class_count; ++c) {
+            if (trie[c] != 0) queue.push_back(trie[c]);
+        }
+        for (std::size_t i = 0; i < queue.size(); ++i) {
+            auto state = queue[i];
+            auto row = state * class_count;
+            auto fail_row = fail[state] * class_count;
+            for (std::uint32_t c = 0; c < class_count; ++c) {
+                auto next = trie[row + c];
+                if (next == 0) {
+                    trie[row + c] = trie[fail_row + c];
+                    continue;
+                }
+                fail[next] = trie[fail_row + c];
+                auto const& inherited = matches[fail[next]];
+                matches[next].insert(matches[next].end(), inherited.begin(),
+                    inherited.end());
+                queue.push_back(next);
+            }
+        }
+
+        // Renumber the states, so the start state is 0 and the match states
+        // come right after it
+        std::vector<std::uint32_t> order{ 0 };
+        for (std::uint32_t s = 1; s < state_count; ++s) {
+            if (!matches[s].empty()) order.push_back(s);
+        }
+        auto match_count = std::uint32_t(order.size() - 1);
+        for (std::uint32_t s = 1; s < state_count; ++s) {
+            if (matches[s].empty()) order.push_back(s);
+        }
+        std::vector<std::uint32_t> renamed(state_count);
+        for (std::uint32_t i = 0; i < state_count; ++i) {
+            renamed[order[i]] = i * class_count;
+        }
+
+        transitions.assign(std::size_t(state_count) * class_count, 0);
+        outputs.clear();
+        output_starts.assign(1, 0);
+        for (std::uint32_t i = 0; i < state_count; ++i) {
+            auto row = order[i] * class_count;
+            for (std::uint32_t c = 0; c < class_count; ++c) {
+                transitions[i * class_count + c] = renamed[trie[row + c]];
+            }
+            if (i >= 1 && i <= match_count) {
+                // Longer matches first
+                auto& m = matches[order[i]];
+                std::stable_sort(m.begin(), m.end(), [&](auto a, auto b) {
+                    return keywords[a].size() > keywords[b].size();
+                });
+                outputs.insert(outputs.end(), m.begin(), m.end());
+                output_starts.push_back(outputs.size());
+            }
+        }
+        match_span = match_count * class_count;
+    }
+
+    void build_prefilter() {
+        rare_count = 0;
+        // When ignoring case, only the ASCII bytes that come from nothing but
+        // ASCII in the text can be looked for
+        bool usable[256] = {};
+        for (int b = 0; b < 256; ++b) {
+            usable[b] = !ignore_case
+                || (b < 0x80 && !detail::is_in_non_ascii_fold(utf8_cp(b)));
+        }
+
+        utf8_byte chosen[max_rare_bytes] = {};
+        int chosen_count = 0;
+        for (auto const& kw : keywords) {
+            if (kw.empty()) continue;
+            // The rarest usable byte of the keyword
+            int best = -1;
+            for (auto b : kw) {
+                if (!usable[b]) continue;
+                if (best < 0 || detail::byte_rarity(b)
+                    > detail::byte_rarity(utf8_byte(best))) {
+                    best = b;
+                }
+            }
+            if (best < 0 || detail::byte_rarity(utf8_byte(best)) < min_rarity) {
+                return;
+            }
+            auto b = utf8_byte(best);
+            if (std::find(chosen, chosen + chosen_count, b)
+                != chosen + chosen_count) {
+                continue;
+            }
+            if (chosen_count == max_rare_bytes) return;
+            chosen[chosen_count++] = b;
+        }
+
+        // In the text, a letter may come in either case, and a folded byte
+        // may come from up to 3 bytes
+        utf8_byte bytes[2 * max_rare_bytes] = {};
+        utf8_usize offsets[2 * max_rare_bytes] = {};
+        int count = 0;
+        for (int i = 0; i < chosen_count; ++i) {
+            utf8_usize offset = 0;
+            for (auto const& kw : keywords) {
+                for (utf8_usize j = 0; j < kw.size(); ++j) {
+                    if (kw[j] == chosen[i]) offset = std::max(offset, j);
+                }
+            }
+            if (ignore_case) offset *= 3;
+            bytes[count] = chosen[i];
+            offsets[count++] = offset;
+            if (ignore_case && chosen[i] >= 'a' && chosen[i] <= 'z') {
+                bytes[count] = utf8_byte(chosen[i] - ('a' - 'A'));
+                offsets[count++] = offset;
+            }
+        }
+        if (count > max_rare_bytes) return;
+        rare_count = count;
+        std::copy(bytes, bytes + count, rare_bytes);
+        std::copy(offsets, offsets + count, rare_offsets);
+    }
+
+    /**
+     * @return The first rare byte in [src, end), or end.
+     */
+    utf8_byte const*
+    find_rare(utf8_byte const* src, utf8_byte const* end) const noexcept {
+#if UTF8PP_SSE2
+        auto b0 = _mm_set1_epi8(char(rare_bytes[0]));
+        auto b1 = _mm_set1_epi8(char(rare_bytes[rare_count > 1 ? 1 : 0]));
+        auto b2 = _mm_set1_epi8(char(rare_bytes[rare_count > 2 ? 2 : 0]));
+        for (; end - src >= 16; src += 16) {
+            auto chunk = _mm_loadu_si128((__m128i const*)src);
+            auto eq = _mm_or_si128(_mm_cmpeq_epi8(chunk, b0), _mm_or_si128(
+                _mm_cmpeq_epi8(chunk, b1), _mm_cmpeq_epi8(chunk, b2)));
+            auto mask = std::uint32_t(_mm_movemask_epi8(eq));
+            if (mask != 0) return src + detail::ctz(mask);
+        }
+#endif
+        for (; src != end; ++src) {
+            if (std::find(rare_bytes, rare_bytes + rare_count, *src)
+                != rare_bytes + rare_count) {
+                return src;
+            }
+        }
+        return end;
+    }
+
+    /**
+     * Skips from a position where the automaton is in its start state to the
+     * earliest position where a match can start.
+     * @param hit The last rare byte found, updated if it is null or before
+     * src.
+     */
+    utf8_byte const* skip(utf8_byte const* src, utf8_byte const* end,
+        utf8_byte const*& hit) const noexcept {
+        if (hit == nullptr || hit < src) hit = find_rare(src, end);
+        if (hit == end) return end;
+        auto i = std::find(rare_bytes, rare_bytes + rare_count, *hit)
+            - rare_bytes;
+        auto offset = rare_offsets[i];
+        auto start = utf8_usize(hit - src) > offset ? hit - offset : src;
+        // Folding starts at codepoint boundaries
+        while (ignore_case && start != src && detail::is_continuation(*start)) {
+            --start;
+        }
+        return start;
+    }
+
+    bool is_match_state(std::uint32_t state) const noexcept {
+        return std::uint32_t(state - class_count) < match_span;
+    }
+
+    template <typename Fn>
+    void scan(utf8_byte const* src, utf8_byte const* end, Fn& fn) const {
+        std::uint32_t state = 0;
+        utf8_byte const* hit = nullptr;
+        for (auto it = src; it != end;) {
+            if (state == 0 && rare_count != 0) {
+                it = skip(it, end, hit);
+                if (it == end) break;
+            }
+            state = transitions[state + classes[*it]];
+            ++it;
+            if (!is_match_state(state)
+                || (it != end && detail::is_continuation(*it))) {
+                continue;
+            }
+            auto i = state / class_count - 1;
+            for (auto k = output_starts[i]; k != output_starts[i + 1]; ++k) {
+                auto kw = outputs[k];
+                auto begin = it - keywords[kw].size();
+                if (detail::is_continuation(*begin)) continue;
+                fn(keyword_match{ kw, utf8_usize(begin - src),
+                    utf8_usize(it - src) });
+            }
+        }
+    }
+
+    template <typename Fn>
+    void scan_folded(utf8_byte const* src, utf8_byte const* end,
+        Fn& fn) const {
+        // The text offset where the folding of each of the last bytes fed to
+        // the automaton starts, or not_found inside a folding
+        utf8_usize ring_size = 1;
+        while (ring_size <= max_length) ring_size *= 2;
+        std::vector<utf8_usize> origins(ring_size, not_found);
+        utf8_usize pos = 0;
+
+        std::uint32_t state = 0;
+        utf8_byte const* hit = nullptr;
+        for (auto it = src; it != end;) {
+            if (state == 0 && rare_count != 0) {
+                it = skip(it, end, hit);
+                if (it == end) break;
+            }
+            utf8_byte folded[4 * detail::max_case_fold];
+            utf8_usize written = 0;
+            auto n = detail::fold_next(it, end, folded, written);
+            for (utf8_usize j = 0; j < written; ++j) {
+                origins[pos++ & (ring_size - 1)]
+                    = j == 0 ? utf8_usize(it - src) : not_found;
+                state = transitions[state + classes[folded[j]]];
+            }
+            it += n;
+            if (!is_match_state(state)
+                || (it != end && detail::is_continuation(*it))) {
+                continue;
+            }
+            auto i = state / class_count - 1;
+            for (auto k = output_starts[i]; k != output_starts[i + 1]; ++k) {
+                auto kw = outputs[k];
+                auto begin = origins[(pos - keywords[kw].size())
+                    & (ring_size - 1)];
+                if (begin == not_found
+                    || detail::is_continuation(src[begin])) {
+                    continue;
+                }
+                fn(keyword_match{ kw, begin, utf8_usize(it - src) });
+            }
+        }
+    }
+};
+
+/**
+ * The largest Unicode codepoint.
+ */
+inline constexpr utf8_cp max_codepoint = 0x10ffff;
+
+/**
+ * An inclusive range of codepoints.
+ */
+struct codepoint_range {
+    utf8_cp first = 0;
+    utf8_cp last = 0;
+};
+
+/**
+ * An inclusive range of bytes.
+ */
+struct byte_range {
+    utf8_byte first = 0;
+    utf8_byte last = 0;
+};
+
+/**
+ * A sequence of byte ranges that matches the UTF8 encoding of a range of
+ * codepoints, like [E1-EC][80-BF][80-BF].
+ */
+struct utf8_sequence {
+    /**
+     * The number of bytes, from 1 to 4.
+     */
+    utf8_usize length = 0;
+
+    /**
+     * The range of each byte.
+     */
+    byte_range bytes[4];
+
+    /**
+     * Checks if the sequence matches the bytes at src.
+     */
+    bool matches(utf8_byte const* src, utf8_byte const* end) const noexcept {
+        if (utf8_usize(end - src) < length) return false;
+        for (utf8_usize i = 0; i < length; ++i) {
+            if (src[i] < bytes[i].first || src[i] > bytes[i].last) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * A deterministic automaton that matches the UTF8 encoding of the codepoints
+ * of a codepoint_set, one byte at a time. The transitions are a dense table
+ * over byte classes, and every accepted codepoint ends in accept_state.
+ */
+class utf8_dfa {
+public:
+    /**
+     * The state that matches nothing anymore.
+     */
+    static constexpr std::uint32_t dead_state = 0;
+
+    /**
+     * The state after a whole codepoint of the set, with no transitions.
+     */
+    static constexpr std::uint32_t accept_state = 1;
+
+    /**
+     * The state at the start of every codepoint.
+     */
+    static constexpr std::uint32_t start_state = 2;
+
+    /**
+     * @return The next state after a byte.
+     */
+    std::uint32_t next(std::uint32_t state, utf8_byte b) const noexcept {
+        return table[state * class_count + classes[b]];
+    }
+
+    /**
+     * @return The number of states, including the dead and accepting ones.
+     */
+    utf8_usize state_count() const noexcept {
+        return table.size() / class_count;
+    }
+
+    /**
+     * Matches a single codepoint.
+     * @param src The pointer to the UTF8 codepoint.
+     * @param end The end of the buffer.
+     * @return The length of the codepoint, or zero if it isn't in the set
+     * (or invalid).
+     */
+    utf8_usize match(utf8_byte const* src, utf8_byte const* end)
+        const noexcept {
+        auto state = start_state;
+        for (auto it = src; it != end;) {
+            state = next(state, *it++);
+            if (state == accept_state) return utf8_usize(it - src);
+            if (state == dead_state) break;
+        }
+        return 0;
+    }
+
+    /**
+     * Matches as many codepoints as possible, like skipping a run of
+     * letters in a lexer.
+     * @param src The pointer to the UTF8 text.
+     * @param end The end of the buffer.
+     * @return The length of the longest prefix that only holds codepoints of
+     * the set.
+     */
+    utf8_usize span(utf8_byte const* src, utf8_byte const* end)
+        const noexcept {
+        auto matched = src;
+        auto state = start_state;
+        for (auto it = src; it != end;) {
+            state = next(state, *it++);
+            if (state == dead_state) break;
+            if (state == accept_state) {
+                matched = it;
+                state = start_state;
+            }
+        }
+        return utf8_usize(matched - src);
+    }
+
+private:
+    friend class codepoint_set;
+
+    std::uint32_t class_count = 1;
+    std::uint8_t classes[256] = {};
+    std::vector<std::uint32_t> table;
+};
+
+/**
+ * A set of codepoints, stored as sorted ranges. The set can be compiled to
+ * the UTF8 byte ranges of its codepoints, so it can be matched on UTF8
+ * without decoding.
+ */
+class codepoint_set {
+public:
+    codepoint_set() = default;
+
+    codepoint_set(utf8_cp first, utf8_cp last) { add(first, last); }
+
+    /**
+     * Adds a range of codepoints.
+     * @param first The first codepoint of the range.
+     * @param last The last codepoint of the range, inclusive.
+     * @return The set itself.
+     */
+    codepoint_set& add(utf8_cp first, utf8_cp last) {
+        utf8pp_assert(first <= last && last <= max_codepoint,
+            "Invalid codepoint range!");
+
+        // Ranges that overlap or touch the new one are merged into it
+        auto begin = std::lower_bound(items.begin(), items.end(), first,
+            [](codepoint_range r, utf8_cp cp) { return r.last + 1 < cp; });
+        auto end = begin;
+        for (; end != items.end() && end->first <= last + 1; ++end) {
+            first = std::min(first, end->first);
+            last = std::max(last, end->last);
+        }
+        items.insert(items.erase(begin, end), codepoint_range{ first, last });
+        return *this;
+    }
+
+    /**
+     * Adds a codepoint.
+     * @return The set itself.
+     */
+    codepoint_set& add(utf8_cp cp) { return add(cp, cp); }
+
+    /**
+     * Checks if the set contains a codepoint.
+     */
+    bool contains(utf8_cp cp) const noexcept {
+        auto it = std::lower_bound(items.begin(), items.end(), cp,
+            [](codepoint_range r, utf8_cp c) { return r.last < c; });
+        return it != items.end() && it->first <= cp;
+    }
+
+    /**
+     * @return True, if the set has no codepoints.
+     */
+    bool empty() const noexcept { return items.empty(); }
+
+    /**
+     * @return The sorted, disjoint and non-adjacent ranges of the set.
+     */
+    std::vector<codepoint_range> const& ranges() const noexcept {
+        return items;
+    }
+
+    /**
+     * @return The codepoints in either set.
+     */
+    codepoint_set unite(codepoint_set const& o) const {
+        auto result = *this;
+        for (auto r : o.items) result.add(r.first, r.last);
+        return result;
+    }
+
+    /**
+     * @return The codepoints in both sets.
+     */
+    codepoint_set intersect(codepoint_set const& o) const {
+        codepoint_set result;
+        auto a = items.begin();
+        auto b = o.items.begin();
+        while (a != items.end() && b != o.items.end()) {
+            auto first = std::max(a->first, b->first);
+            auto last = std::min(a->last, b->last);
+            if (first <= last) result.items.push_back({ first, last });
+            if (a->last < b->last) ++a;
+            else ++b;
+        }
+        return result;
+    }
+
+    /**
+     * @return The codepoints in this set, but not in the other one.
+     */
+    codepoint_set subtract(codepoint_set const& o) const {
+        return intersect(o.complement());
+    }
+
+    /**
+     * @return The codepoints up to max_codepoint that aren't in the set.
+     */
+    codepoint_set complement() const {
+        codepoint_set result;
+        utf8_cp next = 0;
+        for (auto r : items) {
+            if (r.first > next) result.items.push_back({ next, r.first - 1 });
+            next = r.last + 1;
+        }
+        if (next <= max_codepoint) {
+            result.items.push_back({ next, max_codepoint });
+        }
+        return result;
+    }
+
+    /**
+     * Compiles the set to UTF8 byte ranges. Surrogates are skipped, as they
+     * have no UTF8 encoding. The ranges are split at the same boundaries as
+     * in encode_cp, and at the continuation bytes where the ranges of the
+     * bytes can't be independent.
+     * @return The byte range sequences in the order of their codepoints,
+     * each codepoint is matched by exactly one of them.
+     */
+    std::vector<utf8_sequence> to_utf8_sequences() const {
+        std::vector<utf8_sequence> result;
+        for (auto r : items) append_sequences(r.first, r.last, result);
+        return result;
+    }
+
+    /**
+     * Compiles the set to a minimal DFA over UTF8 bytes.
+     */
+    utf8_dfa compile() const;
+
+private:
+    std::vector<codepoint_range> items;
+
+    static void append_sequences(utf8_cp first, utf8_cp last,
+        std::vector<utf8_sequence>& out) {
+        // The last codepoint of each encoded length, except the longest
+        static constexpr utf8_cp limits[] = { 0x7f, 0x7ff, 0xffff };
+
+        std::vector<codepoint_range> stack{ { first, last } };
+        while (!stack.empty()) {
+            auto r = stack.back();
+            stack.pop_back();
+            bool split = true;
+            while (split) {
+                split = false;
+                if (r.last < 0x80) {
+                    utf8_sequence seq;
+                    seq.length = 1;
+                    seq.bytes[0] = { utf8_byte(r.first), utf8_byte(r.last) };
+                    out.push_back(seq);
+                    break;
+                }
+                // Skip the surrogates
+                if (r.first <= 0xdfff && r.last >= 0xd800) {
+                    if (r.last > 0xdfff) stack.push_back({ 0xe000, r.last });
+                    if (r.first >= 0xd800) break;
+                    r.last = 0xd7ff;
+                }
+                // Split at the encoded lengths
+                for (auto limit : limits) {
+                    if (r.first <= limit && limit < r.last) {
+                        stack.push_back({ limit + 1, r.last });
+                        r.last = limit;
+                        split = true;
+                    }
+                }
+                if (split) continue;
+                // Split where a lower byte doesn't span its whole range
+                for (int i = 1; i < 4 && !split; ++i) {
+                    auto mask = (utf8_cp(1) << (6 * i)) - 1;
+                    if ((r.first & ~mask) == (r.last & ~mask)) continue;
+                    if ((r.first & mask) != 0) {
+                        stack.push_back({ (r.first | mask) + 1, r.last });
+                        r.last = r.first | mask;
+                        split = true;
+                    }
+                    else if ((r.last & mask) != mask) {
+                        stack.push_back({ r.last & ~mask, r.last });
+                        r.last = (r.last & ~mask) - 1;
+                        split = true;
+                    }
+                }
+                if (split) continue;
+
+                utf8_byte lo[4];
+                utf8_byte hi[4];
+                utf8_sequence seq;
+                seq.length = utf8_usize(encode_cp(lo, r.first));
+                encode_cp(hi, r.last);
+                for (utf8_usize i = 0; i < seq.length; ++i) {
+                    seq.bytes[i] = { lo[i], hi[i] };
+                }
+                out.push_back(seq);
+            }
+        }
+    }
+};
+
+inline utf8_dfa codepoint_set::compile() const {
+    // A trie of the byte range sequences, with a shared accepting leaf
+    struct edge {
+        byte_range bytes;
+        std::uint32_t target;
+    };
+    std::vector<std::vector<edge>> trie(3);
+    for (auto const& seq : to_utf8_sequences()) {
+        std::uint32_t node = utf8_dfa::start_state;
+        for (utf8_usize i = 0; i < seq.length; ++i) {
+            auto& edges = trie[node];
+            auto r = seq.bytes[i];
+            // Ranges of siblings are either equal or disjoint
+            if (!edges.empty() && edges.back().bytes.first == r.first
+                && edges.back().bytes.last == r.last) {
+                node = edges.back().target;
+                continue;
+            }
+            auto target = i + 1 == seq.length
+                ? utf8_dfa::accept_state : std::uint32_t(trie.size());
+            edges.push_back({ r, target });
+            if (target != utf8_dfa::accept_state) trie.emplace_back();
+            node = target;
+        }
+    }
+
+    // Merge the nodes with equal edges, from the leaves up. Children are
+    // always created after their parents, so it is enough to go backwards.
+    std::vector<std::uint32_t> merged(trie.size());
+    merged[utf8_dfa::dead_state] = utf8_dfa::dead_state;
+    merged[utf8_dfa::accept_state] = utf8_dfa::accept_state;
+    std::vector<std::vector<edge>> states(3);
+    std::map<std::vector<std::uint32_t>, std::uint32_t> seen;
+    for (auto node = std::uint32_t(trie.size() - 1);; --node) {
+        // Adjacent ranges to the same node become one
+        std::vector<edge> edges;
+        for (auto e : trie[node]) {
+            e.target = merged[e.target];
+            if (!edges.empty() && edges.back().target == e.target
+                && edges.back().bytes.last + 1 == e.bytes.first) {
+                edges.back().bytes.last = e.bytes.last;
+            }
+            else {
+                edges.push_back(e);
+            }
+        }
+        if (node == utf8_dfa::start_state) {
+            states[node] = std::move(edges);
+            break;
+        }
+        std::vector<std::uint32_t> key;
+        for (auto const& e : edges) {
+            key.insert(key.end(), { e.bytes.first, e.bytes.last, e.target });
+        }
+        auto found = seen.emplace(std::move(key),
+            std::uint32_t(states.size()));
+        merged[node] = found.first->second;
+        if (found.second) states.push_back(std::move(edges));
+    }
+
+    // Bytes where no edge starts or ends share a class
+    utf8_dfa result;
+    bool boundary[257] = {};
+    for (auto const& edges : states) {
+        for (auto const& e : edges) {
+            boundary[e.bytes.first] = true;
+            boundary[e.bytes.last + 1] = true;
+        }
+    }
+    result.class_count = 0;
+    for (int b = 0; b < 256; ++b) {
+        if (b == 0 || boundary[b]) ++result.class_count;
+        result.classes[b] = std::uint8_t(result.class_count - 1);
+    }
+    result.table.assign(states.size() * result.class_count,
+        utf8_dfa::dead_state);
+    for (std::size_t s = 0; s < states.size(); ++s) {
+        for (auto const& e : states[s]) {
+            for (int b = e.bytes.first; b <= e.bytes.last; ++b) {
+                result.table[s * result.class_count + result.classes[b]]
+                    = e.target;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * An immutable codepoint_set, laid out for fast membership tests: a bitmap
+ * for ASCII, a two-level bitmap for the rest of the BMP (with shared blocks),
+ * and sorted ranges for the astral planes. The bulk scans only decode
+ * non-ASCII bytes, and when the ASCII part of the set is a single range (or
+ * all or nothing), they check ASCII runs 16 bytes at a time.
+ */
+class frozen_codepoint_set {
+public:
+    frozen_codepoint_set() : frozen_codepoint_set(codepoint_set()) { }
+
+    explicit frozen_codepoint_set(codepoint_set const& set) {
+        // The BMP in blocks of 256 codepoints, the first block is empty
+        blocks.assign(words_per_block, 0);
+        std::vector<std::uint64_t> block(words_per_block);
+        for (utf8_cp hi = 0; hi < 0x100; ++hi) {
+            std::fill(block.begin(), block.end(), 0);
+            auto part = set.intersect(codepoint_set(hi << 8, hi << 8 | 0xff));
+            for (auto r : part.ranges()) {
+                for (auto cp = r.first; cp <= r.last; ++cp) {
+                    block[(cp & 0xff) / 64] |= std::uint64_t(1) << (cp % 64);
+                }
+            }
+            std::size_t index = 0;
+            for (; index < blocks.size(); index += words_per_block) {
+                if (std::equal(block.begin(), block.end(),
+                    blocks.begin() + long(index))) {
+                    break;
+                }
+            }
+            if (index == blocks.size()) {
+                blocks.insert(blocks.end(), block.begin(), block.end());
+            }
+            stage1[hi] = std::uint16_t(index / words_per_block);
+        }
+        ascii[0] = blocks[stage1[0] * words_per_block];
+        ascii[1] = blocks[stage1[0] * words_per_block + 1];
+        astral = set.intersect(codepoint_set(0x10000, max_codepoint)).ranges();
+
+        // A single range of ASCII, empty when lo > hi
+        auto part = set.intersect(codepoint_set(0, 0x7f)).ranges();
+        ascii_lo = 1;
+        ascii_hi = 0;
+        ascii_range = part.size() <= 1;
+        if (part.size() == 1) {
+            ascii_lo = utf8_byte(part[0].first);
+            ascii_hi = utf8_byte(part[0].last);
+        }
+    }
+
+    /**
+     * Checks if the set contains a codepoint.
+     */
+    bool contains(utf8_cp cp) const noexcept {
+        if (cp < 0x80) return (ascii[cp / 64] >> (cp % 64) & 1) != 0;
+        if (cp < 0x10000) {
+            auto word = blocks[stage1[cp >> 8] * words_per_block
+                + (cp & 0xff) / 64];
+            return (word >> (cp % 64) & 1) != 0;
+        }
+        auto it = std::lower_bound(astral.begin(), astral.end(), cp,
+            [](codepoint_range r, utf8_cp c) { return r.last < c; });
+        return it != astral.end() && it->first <= cp;
+    }
+
+    /**
+     * Finds the first codepoint of a UTF8 buffer that is not in the set.
+     * Invalid bytes are never in the set.
+     * @param src The UTF8 buffer.
+     * @param len The length of the buffer.
+     * @return The byte offset of the codepoint, or len if there is none.
+     */
+    utf8_usize
+    find_first_not_in(utf8_byte const* src, utf8_usize len) const noexcept {
+        return find<false>(src, len);
+    }
+
+    /**
+     * Finds the first codepoint of a UTF8 buffer that is in the set.
+     * @param src The UTF8 buffer.
+     * @param len The length of the buffer.
+     * @return The byte offset of the codepoint, or len if there is none.
+     */
+    utf8_usize
+    find_first_in(utf8_byte const* src, utf8_usize len) const noexcept {
+        return find<true>(src, len);
+    }
+
+    /**
+     * Checks if every codepoint of a UTF8 buffer is in the set, which is
+     * false for invalid UTF8.
+     */
+    bool all_of(utf8_byte const* src, utf8_usize len) const noexcept {
+        return find_first_not_in(src, len) == len;
+    }
+
+    /**
+     * Checks if any codepoint of a UTF8 buffer is in the set.
+     */
+    bool any_of(utf8_byte const* src, utf8_usize len) const noexcept {
+        return find_first_in(src, len) != len;
+    }
+
+private:
+    static constexpr std::size_t words_per_block = 4;
+
+    std::uint64_t ascii[2] = {};
+    std::uint16_t stage1[0x100] = {};
+    std::vector<std::uint64_t> blocks;
+    std::vector<codepoint_range> astral;
+    bool ascii_range = false;
+    utf8_byte ascii_lo = 1;
+    utf8_byte ascii_hi = 0;
+
+    /**
+     * Finds the first codepoint whose membership is Member.
+     */
+    template <bool Member>
+    utf8_usize find(utf8_byte const* src, utf8_usize len) const noexcept {
+        auto end = src + len;
+        auto it = src;
+#if UTF8PP_SSE2
+        // As signed bytes, non-ASCII is always below the range
+        auto lo = _mm_set1_epi8(char(ascii_lo));
+        auto hi = _mm_set1_epi8(char(ascii_hi));
+#endif
+        while (it != end) {
+#if UTF8PP_SSE2
+            if (ascii_range && end - it >= 16) {
+                auto chunk = _mm_loadu_si128((__m128i const*)it);
+                auto out = std::uint32_t(_mm_movemask_epi8(_mm_or_si128(
+                    _mm_cmplt_epi8(chunk, lo), _mm_cmpgt_epi8(chunk, hi))));
+                auto stop = Member
+                    ? (~out & 0xffff) | std::uint32_t(_mm_movemask_epi8(chunk))
+                    : out;
+                if (stop == 0) {
+                    it += 16;
+                    continue;
+                }
+                it += detail::ctz(stop);
+            }
+#endif
+            if (*it < 0x80) {
+                if (((ascii[*it / 64] >> (*it % 64) & 1) != 0) == Member) {
+                    break;
+                }
+                ++it;
+                continue;
+            }
+            auto n = detail::parse_strict(it, end);
+            if (n < 0) {
+                if (!Member) break;
+                ++it;
+                continue;
+            }
+            if (contains(detail::calc_codepoint(it, utf8_usize(n))) == Member) {
+                break;
+            }
+            it += n;
+        }
+        return utf8_usize(it - src);
+    }
+};
+
+namespace detail {
+
+/**
+ * Compares a property name to a known one loosely (UAX #44 LM3), ignoring
+ * case, spaces, underscores and hyphens.
+ */
+inline bool loose_equal(utf8_byte const* name, utf8_usize len,
+    char const* known) noexcept {
+    auto skip = [](utf8_byte c) { return c == ' ' || c == '_' || c == '-'; };
+    auto lower = [](utf8_byte c) {
+        return c >= 'A' && c <= 'Z' ? utf8_byte(c + ('a' - 'A')) : c;
+    };
+    auto end = name + len;
+    auto it = (utf8_byte const*)known;
+    while (true) {
+        while (name != end && skip(*name)) ++name;
+        while (*it != '\0' && skip(*it)) ++it;
+        if (name == end || *it == '\0') return name == end && *it == '\0';
+        if (lower(*name++) != lower(*it++)) return false;
+    }
+}
+
+/**
+ * Builds the set of codepoints with a General_Category in a mask, where bit i
+ * stands for general_category(i).
+ */
+inline codepoint_set general_category_set(std::uint32_t mask) {
+    codepoint_set result;
+    auto n = std::size(tables::general_category_starts);
+    for (std::size_t i = 0; i < n; ++i) {
+        if ((mask >> tables::general_category_values[i] & 1) == 0) continue;
+        auto last = i + 1 < n
+            ? tables::general_category_starts[i + 1] - 1 : max_codepoint;
+        result.add(tables::general_category_starts[i], last);
+    }
+    return result;
+}
+
+/**
+ * Looks up a General_Category value (short or long, like Lu or
+ * Uppercase_Letter) or group (L or Letter, and LC or Cased_Letter) by name.
+ * @return True, if the name is known.
+ */
+inline bool general_category_property(utf8_byte const* name, utf8_usize len,
+    codepoint_set& out) {
+    constexpr auto count = std::size(tables::general_category_short_names);
+    // Groups by the first letter of the short names
+    static constexpr char const* groups[][2] = {
+        { "L", "Letter" }, { "M", "Mark" }, { "N", "Number" },
+        { "P", "Punctuation" }, { "S", "Symbol" }, { "Z", "Separator" },
+        { "C", "Other" },
+    };
+
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (loose_equal(name, len, tables::general_category_short_names[i])
+            || loose_equal(name, len,
+                tables::general_category_long_names[i])) {
+            mask |= std::uint32_t(1) << i;
+        }
+    }
+    for (auto const& group : groups) {
+        if (!loose_equal(name, len, group[0])
+            && !loose_equal(name, len, group[1])) {
+            continue;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            if (tables::general_category_short_names[i][0] == group[0][0]) {
+                mask |= std::uint32_t(1) << i;
+            }
+        }
+    }
+    if (loose_equal(name, len, "LC") || loose_equal(name, len, "CasedLetter")) {
+        using gc = general_category;
+        mask = 1 << int(gc::uppercase_letter) | 1 << int(gc::lowercase_letter)
+            | 1 << int(gc::titlecase_letter);
+    }
+    if (mask == 0) return false;
+    out = general_category_set(mask);
+    return true;
+}
+
+/**
+ * Looks up the codepoints of a Script by its name, like Latin or Han.
+ * @return True, if the name is known.
+ */
+inline bool
+script_property(utf8_byte const* name, utf8_usize len, codepoint_set& out) {
+    auto const& names = tables::script_names;
+    auto found = std::find_if(std::begin(names), std::end(names),
+        [&](char const* known) { return loose_equal(name, len, known); });
+    if (found == std::end(names)) return false;
+
+    auto script = std::size_t(found - std::begin(names));
+    auto n = std::size(tables::script_starts);
+    out = codepoint_set();
+    for (std::size_t i = 0; i < n; ++i) {
+        if (tables::script_values[i] != script) continue;
+        auto last = i + 1 < n
+            ? tables::script_starts[i + 1] - 1 : max_codepoint;
+        out.add(tables::script_starts[i], last);
+    }
+    return true;
+}
+
+/**
+ * Looks up the codepoints of a property by name, for \p{...}. The names are
+ * General_Category values and groups, Script names, and Any, ASCII and
+ * Assigned. A property can be named too, as in gc=Lu, Script=Han or sc:Latin.
+ * @return True, if the name is known.
+ */
+inline bool
+property_set(utf8_byte const* name, utf8_usize len, codepoint_set& out) {
+    auto end = name + len;
+    auto sep = std::find_if(name, end,
+        [](utf8_byte c) { return c == '=' || c == ':'; });
+    if (sep != end) {
+        auto key_len = utf8_usize(sep - name);
+        auto value_len = utf8_usize(end - sep - 1);
+        if (loose_equal(name, key_len, "gc")
+            || loose_equal(name, key_len, "General_Category")) {
+            return general_category_property(sep + 1, value_len, out);
+        }
+        if (loose_equal(name, key_len, "sc")
+            || loose_equal(name, key_len, "Script")) {
+            return script_property(sep + 1, value_len, out);
+        }
+        return false;
+    }
+
+    if (general_category_property(name, len, out)
+        || script_property(name, len, out)) {
+        return true;
+    }
+    if (loose_equal(name, len, "Any")) {
+        out = codepoint_set(0, max_codepoint);
+    }
+    else if (loose_equal(name, len, "ASCII")) {
+        out = codepoint_set(0, 0x7f);
+    }
+    else if (loose_equal(name, len, "Assigned")) {
+        out = general_category_set(1 << int(general_category::unassigned))
+            .complement();
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Parses a hexadecimal number of a fixed number of digits.
+ */
+inline bool parse_hex(utf8_byte const*& it, utf8_byte const* end,
+    utf8_cp& cp, int digits) noexcept {
+    cp = 0;
+    for (int i = 0; i < digits; ++i) {
+        auto value = it == end ? -1 : hex_value(*it);
+        if (value < 0) return false;
+        cp = cp * 16 + utf8_cp(value);
+        ++it;
+    }
+    return true;
+}
+
+/**
+ * Parses an escape of a regex or codepoint set pattern, after the backslash.
+ * Single codepoints are returned as a set too.
+ * @param it The position after the backslash, moved past the escape, or to
+ * the error.
+ * @return True, if the escape is valid.
+ */
+inline bool
+parse_escape(utf8_byte const*& it, utf8_byte const* end, codepoint_set& out) {
+    if (it == end) return false;
+    auto c = *it++;
+    bool negate = c == 'D' || c == 'W' || c == 'S' || c == 'P';
+    switch (c) {
+    case 'd': case 'D':
+        out = general_category_set(
+            1 << int(general_category::decimal_number));
+        break;
+    case 'w': case 'W':
+        // Letters, marks, Nd, Nl and Pc
+        out = general_category_set(
+            0x1f << int(general_category::uppercase_letter)
+            | 7 << int(general_category::nonspacing_mark)
+            | 3 << int(general_category::decimal_number)
+            | 1 << int(general_category::connector_punctuation));
+        break;
+    case 's': case 'S':
+        // White_Space
+        out = codepoint_set('\t', '\r');
+        out.add(' ').add(0x85).add(0xa0).add(0x1680).add(0x2000, 0x200a)
+            .add(0x2028, 0x2029).add(0x202f).add(0x205f).add(0x3000);
+        break;
+    case 'p': case 'P': {
+        // Either \pL or \p{Name}
+        if (it == end) return false;
+        auto name = it;
+        auto name_end = ++it;
+        if (*name == '{') {
+            name_end = std::find(++name, end, '}');
+            if (name_end == end) return false;
+            it = name_end + 1;
+        }
+        if (!property_set(name, utf8_usize(name_end - name), out)) {
+            it = name;
+            return false;
+        }
+        break;
+    }
+    case 'n': out = codepoint_set('\n', '\n'); break;
+    case 't': out = codepoint_set('\t', '\t'); break;
+    case 'r': out = codepoint_set('\r', '\r'); break;
+    case 'f': out = codepoint_set('\f', '\f'); break;
+    case 'v': out = codepoint_set('\v', '\v'); break;
+    case 'x': case 'u': case 'U': {
+        utf8_cp cp = 0;
+        if (c != 'x') {
+            if (!parse_hex(it, end, cp, c == 'u' ? 4 : 8)) return false;
+        }
+        else if (it != end && *it == '{') {
+            ++it;
+            auto close = std::find(it, end, '}');
+            auto digits = close - it;
+            if (close == end || digits < 1 || digits > 6
+                || !parse_hex(it, end, cp, int(digits))) {
+                return false;
+            }
+            ++it;
+        }
+        else if (!parse_hex(it, end, cp, 2)) {
+            return false;
+        }
+        if (cp > max_codepoint || is_surrogate(cp)) return false;
+        out = codepoint_set(cp, cp);
+        break;
+    }
+    default:
+        // Escaped ASCII punctuation stands for itself
+        if (c >= 0x80 || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z')
+            || (c >= 'A' && c <= 'Z')) {
+            --it;
+            return false;
+        }
+        out = codepoint_set(c, c);
+    }
+    if (negate) out = out.complement();
+    return true;
+}
+
+/**
+ * The maximum of an unbounded regex repetition.
+ */
+inline constexpr std::uint32_t regex_unbounded = ~std::uint32_t(0);
+
+/**
+ * A node of a parsed regular expression.
+ */
+struct regex_node {
+    enum kind_t : std::uint8_t {
+        empty,
+        set,
+        concat,
+        alternate,
+        repeat,
+    };
+
+    kind_t kind = empty;
+    // The codepoints of a set
+    codepoint_set codepoints;
+    // The parts of a concatenation or alternation, or the repeated node
+    std::vector<regex_node> children;
+    std::uint32_t min = 0;
+    std::uint32_t max = 0;
+    bool greedy = true;
+    // The nesting of groups and repeats, and an estimate of the compiled
+    // program size, which the parser limits
+    std::uint32_t depth = 0;
+    std::uint32_t size = 0;
+};
+
+/**
+ * A recursive descent parser for regular expressions, @see regex for the
+ * syntax.
+ */
+class regex_parser {
+public:
+    regex_parser(utf8_byte const* src, utf8_usize len) noexcept
+        : begin(src), it(src), end(src + len) { }
+
+    /**
+     * Parses the whole pattern.
+     * @return True, if the pattern is valid.
+     */
+    bool parse(regex_node& root, bool& anchored_start, bool& anchored_end) {
+        anchored_start = it != end && *it == '^';
+        if (anchored_start) ++it;
+        anchored_end = false;
+        if (!alternation(root)) return false;
+        if (it != end && *it == '$' && it + 1 == end) {
+            anchored_end = true;
+            ++it;
+        }
+        if (it != end) return false;
+        // Anchors only apply to the whole pattern, not to a top-level branch
+        return !top_level_alternate || (!anchored_start && !anchored_end);
+    }
+
+    /**
+     * @return The offset where parsing stopped, the error position for an
+     * invalid pattern.
+     */
+    utf8_usize offset() const noexcept { return utf8_usize(it - begin); }
+
+private:
+    // The limits of group and repeat nesting, repetition counts, and the
+    // estimated program size in states and edges
+    static constexpr int max_depth = 256;
+    static constexpr std::uint32_t max_count = 1000;
+    static constexpr std::uint64_t max_size = 1 << 20;
+
+    utf8_byte const* begin;
+    utf8_byte const* it;
+    utf8_byte const* end;
+    int depth = 0;
+    bool top_level_alternate = false;
+
+    /**
+     * Sets the size of a node from its children, its depth for repeats.
+     * @return True, if the node is within the limits.
+     */
+    static bool measure(regex_node& node) noexcept {
+        std::uint64_t size = 0;
+        std::uint32_t depth = 0;
+        for (auto const& child : node.children) {
+            size += child.size;
+            depth = std::max(depth, child.depth);
+        }
+        if (node.kind == regex_node::alternate) {
+            size += node.children.size() - 1;
+        }
+        else if (node.kind == regex_node::repeat) {
+            // Each copy of the body and a split for each optional one
+            auto copies = node.max == regex_unbounded
+                ? std::uint64_t(node.min) + 1 : std::uint64_t(node.max);
+            size = size * copies + copies - node.min + 1;
+            ++depth;
+        }
+        node.size = std::uint32_t(std::min(size, max_size + 1));
+        node.depth = depth;
+        return size <= max_size && depth <= max_depth;
+    }
+
+    bool alternation(regex_node& out) {
+        regex_node branch;
+        if (!concatenation(branch)) return false;
+        if (it == end || *it != '|') {
+            out = std::move(branch);
+            return true;
+        }
+        if (depth == 0) top_level_alternate = true;
+        out = regex_node();
+        out.kind = regex_node::alternate;
+        out.children.push_back(std::move(branch));
+        while (it != end && *it == '|') {
+            ++it;
+            if (!concatenation(branch)) return false;
+            out.children.push_back(std::move(branch));
+        }
+        return measure(out);
+    }
+
+    bool concatenation(regex_node& out) {
+        out = regex_node();
+        out.kind = regex_node::concat;
+        while (it != end && *it != '|' && *it != ')') {
+            // A trailing $ anchors the whole pattern
+            if (*it == '$' && depth == 0 && it + 1 == end) break;
+            regex_node node;
+            if (!atom(node) || !quantifiers(node)) return false;
+            out.children.push_back(std::move(node));
+        }
+        if (out.children.size() == 1) {
+            auto child = std::move(out.children[0]);
+            out = std::move(child);
+            return true;
+        }
+        return measure(out);
+    }
+
+    bool quantifiers(regex_node& node) {
+        while (it != end) {
+            std::uint32_t min = 0;
+            std::uint32_t max = regex_unbounded;
+            if (*it == '*') {
+                ++it;
+            }
+            else if (*it == '+') {
+                min = 1;
+                ++it;
+            }
+            else if (*it == '?') {
+                max = 1;
+                ++it;
+            }
+            else if (*it == '{') {
+                ++it;
+                if (!number(min)) return false;
+                max = min;
+                if (it != end && *it == ',') {
+                    ++it;
+                    max = regex_unbounded;
+                    if (it != end && *it != '}' && !number(max)) return false;
+                }
+                if (it == end || *it != '}' || max < min) return false;
+                ++it;
+            }
+            else {
+                return true;
+            }
+
+            regex_node repeated;
+            repeated.kind = regex_node::repeat;
+            repeated.min = min;
+            repeated.max = max;
+            if (it != end && *it == '?') {
+                repeated.greedy = false;
+                ++it;
+            }
+            repeated.children.push_back(std::move(node));
+            node = std::move(repeated);
+            if (!measure(node)) return false;
+        }
+        return true;
+    }
+
+    bool number(std::uint32_t& n) {
+        if (it == end || *it < '0' || *it > '9') return false;
+        n = 0;
+        for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+            n = n * 10 + std::uint32_t(*it - '0');
+            if (n > max_count) return false;
+        }
+        return true;
+    }
+
+    bool atom(regex_node& out) {
+        if (*it == '(') {
+            if (++depth > max_depth) return false;
+            ++it;
+            if (end - it >= 2 && it[0] == '?' && it[1] == ':') it += 2;
+            if (!alternation(out)) return false;
+            if (it == end || *it != ')') return false;
+            ++it;
+            --depth;
+            return ++out.depth <= max_depth;
+        }
+        out.kind = regex_node::set;
+        if (!set_atom(out.codepoints)) return false;
+        // A trie state and edge for each range, roughly
+        auto ranges = out.codepoints.ranges().size();
+        out.size = std::uint32_t(std::min<std::uint64_t>(
+            4 * std::uint64_t(ranges) + 1, max_size + 1));
+        return true;
+    }
+
+    bool set_atom(codepoint_set& out) {
+        switch (*it) {
+        case '[':
+            ++it;
+            return bracket(out);
+        case '.':
+            ++it;
+            out = codepoint_set('\n', '\n').complement();
+            return true;
+        case '\\':
+            ++it;
+            return escape(out);
+        case ')': case '|': case '*': case '+': case '?': case '{': case '}':
+        case ']': case '^': case '$':
+            return false;
+        }
+        utf8_cp cp = 0;
+        if (!literal(cp)) return false;
+        out = codepoint_set(cp, cp);
+        return true;
+    }
+
+    bool literal(utf8_cp& cp) {
+        auto n = parse_strict(it, end);
+        if (n < 0) return false;
+        cp = calc_codepoint(it, utf8_usize(n));
+        it += n;
+        return true;
+    }
+
+    bool escape(codepoint_set& out) { return parse_escape(it, end, out); }
+
+    bool bracket(codepoint_set& out) {
+        bool negate = it != end && *it == '^';
+        if (negate) ++it;
+        out = codepoint_set();
+        bool first = true;
+        while (true) {
+            if (it == end) return false;
+            if (*it == ']' && !first) break;
+            first = false;
+
+            // A single codepoint can start a range
+            codepoint_set item;
+            utf8_cp lo = 0;
+            bool single = true;
+            if (*it == '\\') {
+                ++it;
+                if (!escape(item)) return false;
+                auto const& r = item.ranges();
+                single = r.size() == 1 && r[0].first == r[0].last;
+                if (single) lo = r[0].first;
+            }
+            else if (!literal(lo)) {
+                return false;
+            }
+
+            if (single && end - it >= 2 && it[0] == '-' && it[1] != ']') {
+                ++it;
+                utf8_cp hi = 0;
+                if (*it == '\\') {
+                    ++it;
+                    codepoint_set bound;
+                    if (!escape(bound)) return false;
+                    auto const& r = bound.ranges();
+                    if (r.size() != 1 || r[0].first != r[0].last) {
+                        return false;
+                    }
+                    hi = r[0].first;
+                }
+                else if (!literal(hi)) {
+                    return false;
+                }
+                if (hi < lo) return false;
+                out.add(lo, hi);
+            }
+            else if (single) {
+                out.add(lo);
+            }
+            else {
+                out = out.unite(item);
+            }
+        }
+        ++it;
+        if (negate) out = out.complement();
+        return true;
+    }
+};
+
+/**
+ * A Thompson NFA over UTF8 bytes, compiled from a parsed regex. Splits are
+ * ordered, the first target is preferred.
+ */
+class regex_program {
+public:
+    struct edge {
+        utf8_byte first;
+        utf8_byte last;
+        std::uint32_t target;
+    };
+
+    struct state {
+        enum kind_t : std::uint8_t {
+            bytes,
+            split,
+            match,
+        };
+
+        kind_t kind;
+        // The edges of a bytes state, or the targets of a split
+        std::uint32_t first;
+        std::uint32_t second;
+    };
+
+    std::vector<state> states;
+    std::vector<edge> edges;
+    std::uint32_t start = 0;
+
+    /**
+     * Compiles a parsed regex, matching it backwards if reverse is true.
+     */
+    void build(regex_node const& root, bool reverse) {
+        states.clear();
+        edges.clear();
+        states.push_back({ state::match, 0, 0 });
+        start = compile(root, 0, reverse);
+    }
+
+private:
+    std::uint32_t add_split(std::uint32_t first, std::uint32_t second) {
+        states.push_back({ state::split, first, second });
+        return std::uint32_t(states.size() - 1);
+    }
+
+    /**
+     * Compiles a node that continues with the next state.
+     * @return The entry state of the node.
+     */
+    std::uint32_t
+    compile(regex_node const& node, std::uint32_t next, bool reverse) {
+        switch (node.kind) {
+        case regex_node::empty:
+            return next;
+        case regex_node::set:
+            return compile_set(node.codepoints, next, reverse);
+        case regex_node::concat:
+            if (reverse) {
+                for (auto const& child : node.children) {
+                    next = compile(child, next, reverse);
+                }
+            }
+            else {
+                for (auto i = node.children.size(); i-- > 0;) {
+                    next = compile(node.children[i], next, reverse);
+                }
+            }
+            return next;
+        case regex_node::alternate: {
+            std::vector<std::uint32_t> entries;
+            for (auto const& child : node.children) {
+                entries.push_back(compile(child, next, reverse));
+            }
+            auto entry = entries.back();
+            for (auto i = entries.size() - 1; i-- > 0;) {
+                entry = add_split(entries[i], entry);
+            }
+            return entry;
+        }
+        case regex_node::repeat: {
+            auto const& body = node.children[0];
+            if (node.max == regex_unbounded) {
+                auto loop = add_split(0, 0);
+                auto entry = compile(body, loop, reverse);
+                states[loop].first = node.greedy ? entry : next;
+                states[loop].second = node.greedy ? next : entry;
+                next = loop;
+            }
+            else {
+                for (auto i = node.min; i < node.max; ++i) {
+                    auto entry = compile(body, next, reverse);
+                    next = node.greedy
+                        ? add_split(entry, next) : add_split(next, entry);
+                }
+            }
+            for (std::uint32_t i = 0; i < node.min; ++i) {
+                next = compile(body, next, reverse);
+            }
+            return next;
+        }
+        }
+        return next;
+    }
+
+    /**
+     * Compiles a codepoint set to a trie of its UTF8 byte ranges. Backwards,
+     * the byte ranges of siblings can overlap, that is fine in an NFA.
+     */
+    std::uint32_t compile_set(codepoint_set const& set, std::uint32_t next,
+        bool reverse) {
+        // Local trie nodes, where the leaf is ~0
+        constexpr auto leaf = ~std::uint32_t(0);
+        std::vector<std::vector<edge>> trie(1);
+        for (auto const& seq : set.to_utf8_sequences()) {
+            std::uint32_t node = 0;
+            for (utf8_usize i = 0; i < seq.length; ++i) {
+                auto r = seq.bytes[reverse ? seq.length - 1 - i : i];
+                auto last = i + 1 == seq.length;
+                auto& siblings = trie[node];
+                auto found = std::find_if(siblings.begin(), siblings.end(),
+                    [&](edge const& e) {
+                        return e.first == r.first && e.last == r.last
+                            && (e.target == leaf) == last;
+                    });
+                if (found != siblings.end()) {
+                    node = found->target;
+                    continue;
+                }
+                auto target = last ? leaf : std::uint32_t(trie.size());
+                siblings.push_back({ r.first, r.last, target });
+                if (!last) trie.emplace_back();
+                node = target;
+            }
+        }
+
+        // Children come after their parents, so emit them backwards
+        std::vector<std::uint32_t> ids(trie.size());
+        for (auto i = trie.size(); i-- > 0;) {
+            auto first = std::uint32_t(edges.size());
+            for (auto e : trie[i]) {
+                e.target = e.target == leaf ? next : ids[e.target];
+                edges.push_back(e);
+            }
+            states.push_back({ state::bytes, first,
+                std::uint32_t(edges.size()) });
+            ids[i] = std::uint32_t(states.size() - 1);
+        }
+        return ids[0];
+    }
+};
+
+/**
+ * A lazily built DFA over the byte classes of a regex_program. States are
+ * ordered sets of NFA states, and they are only determinized when the search
+ * first needs them. Built states and transitions are cached, and the cache is
+ * cleared when it grows past a limit, so memory stays bounded while the
+ * search stays linear.
+ */
+class regex_dfa {
+public:
+    static constexpr std::uint32_t dead_state = 0;
+
+    regex_dfa() = default;
+
+    // The cache points into itself, so copies start with an empty one
+    regex_dfa(regex_dfa const& o)
+        : classes(o.classes), unanchored(o.unanchored), longest(o.longest) { }
+
+    regex_dfa& operator=(regex_dfa const& o) {
+        if (this != &o) reset(o.classes, o.unanchored, o.longest);
+        return *this;
+    }
+
+    /**
+     * Resets the DFA for a program.
+     * @param unanchored If true, a match can start anywhere.
+     * @param longest If true, every match is found. Otherwise lower priority
+     * threads are dropped after a match, for leftmost-first semantics.
+     */
+    void reset(std::uint32_t class_count, bool unanchored, bool longest) {
+        classes = class_count;
+        this->unanchored = unanchored;
+        this->longest = longest;
+        ids.clear();
+        sets.clear();
+        table.clear();
+        matching.clear();
+    }
+
+    /**
+     * @return The start state.
+     */
+    std::uint32_t start(regex_program const& prog) {
+        if (sets.empty()) init(prog);
+        return start_state;
+    }
+
+    /**
+     * @return True, if the input so far ends a match in the given state.
+     */
+    bool is_match(std::uint32_t state) const noexcept {
+        return matching[state] != 0;
+    }
+
+    /**
+     * @return The next state after a byte of the given class.
+     */
+    std::uint32_t next(regex_program const& prog, std::uint32_t state,
+        std::uint32_t cls, utf8_byte b) {
+        auto& cached = table[state * classes + cls];
+        if (cached != unknown) return cached;
+
+        step(prog, *sets[state], b);
+        if (ids.find(scratch) == ids.end() && sets.size() >= max_states) {
+            // Start over, the current state is not needed anymore
+            auto key = scratch;
+            init(prog);
+            return add(key);
+        }
+        auto result = add(scratch);
+        table[state * classes + cls] = result;
+        return result;
+    }
+
+private:
+    static constexpr std::uint32_t unknown = ~std::uint32_t(0);
+    // Stands for the unanchored restart in a thread list
+    static constexpr std::uint32_t restart = ~std::uint32_t(0);
+    static constexpr std::size_t max_states = 1 << 12;
+
+    std::uint32_t classes = 1;
+    bool unanchored = false;
+    bool longest = false;
+    std::uint32_t start_state = 0;
+    // The thread lists, with a last element that is 1 for match states
+    std::map<std::vector<std::uint32_t>, std::uint32_t> ids;
+    std::vector<std::vector<std::uint32_t> const*> sets;
+    std::vector<std::uint32_t> table;
+    std::vector<char> matching;
+    // Buffers for determinization
+    std::vector<std::uint32_t> scratch;
+    std::vector<std::uint32_t> stack;
+    std::vector<std::uint32_t> seen;
+    std::uint32_t generation = 0;
+
+    void init(regex_program const& prog) {
+        ids.clear();
+        sets.clear();
+        table.clear();
+        matching.clear();
+        seen.assign(prog.states.size(), 0);
+        generation = 0;
+
+        scratch.assign(1, 0);
+        add(scratch);
+        scratch.clear();
+        ++generation;
+        bool match = false;
+        closure(prog, prog.start, match);
+        if (unanchored && (longest || !match)) scratch.push_back(restart);
+        scratch.push_back(match);
+        start_state = add(scratch);
+    }
+
+    std::uint32_t add(std::vector<std::uint32_t> const& key) {
+        auto found = ids.emplace(key, std::uint32_t(sets.size()));
+        if (found.second) {
+            sets.push_back(&found.first->first);
+            table.resize(table.size() + classes, unknown);
+            matching.push_back(char(key.back()));
+        }
+        return found.first->second;
+    }
+
+    /**
+     * Adds the threads reachable from a state without input to scratch, in
+     * priority order.
+     * @return False, if lower priority threads have to be dropped.
+     */
+    bool closure(regex_program const& prog, std::uint32_t from, bool& match) {
+        stack.assign(1, from);
+        while (!stack.empty()) {
+            auto s = stack.back();
+            stack.pop_back();
+            if (seen[s] == generation) continue;
+            seen[s] = generation;
+            auto const& st = prog.states[s];
+            if (st.kind == regex_program::state::bytes) {
+                if (st.first != st.second) scratch.push_back(s);
+            }
+            else if (st.kind == regex_program::state::split) {
+                stack.push_back(st.second);
+                stack.push_back(st.first);
+            }
+            else {
+                match = true;
+                if (!longest) return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Computes the thread list after a byte into scratch.
+     */
+    void step(regex_program const& prog,
+        std::vector<std::uint32_t> const& threads, utf8_byte b) {
+        scratch.clear();
+        ++generation;
+        bool match = false;
+        bool more = true;
+        for (std::size_t i = 0; more && i + 1 < threads.size(); ++i) {
+            auto t = threads[i];
+            if (t == restart) {
+                more = closure(prog, prog.start, match);
+                if (more) scratch.push_back(restart);
+                continue;
+            }
+            auto const& st = prog.states[t];
+            for (auto e = st.first; more && e != st.second; ++e) {
+                auto const& ed = prog.edges[e];
+                if (b >= ed.first && b <= ed.last) {
+                    more = closure(prog, ed.target, match);
+                }
+            }
+        }
+        scratch.push_back(match);
+    }
+};
+
+} /* namespace detail */
+
+/**
+ * A match of a regex.
+ */
+struct regex_match {
+    /**
+     * The byte offset of the start of the match, or not_found.
+     */
+    utf8_usize begin = not_found;
+
+    /**
+     * The byte offset of the end of the match.
+     */
+    utf8_usize end = not_found;
+};
+
+/**
+ * A regular expression engine that matches UTF8 bytes with lazy DFAs, so
+ * matching is linear in the length of the text. Searches find the
+ * leftmost-first match, like in Perl: a forward DFA finds where the match
+ * ends, then a DFA of the reversed pattern finds where it starts. Patterns
+ * that start with a literal skip ahead with a vectorized substring search.
+ * Since every codepoint class is compiled to the UTF8 byte ranges of its
+ * valid encodings, nothing matches part of a sequence, or invalid bytes.
+ * Searching builds DFA states, so a regex must not be shared between threads.
+ *
+ * The syntax:
+ *  - Literal codepoints, and . for any codepoint but '\n'.
+ *  - Classes like [a-z], [^...], and the escapes \d \w \s (Unicode aware) and
+ *    their negations, \p{...} and \P{...} (@see detail::property_set),
+ *    \n \t \r \f \v, \xHH, \x{H...}, \uHHHH and \UHHHHHHHH, and escaped
+ *    ASCII punctuation.
+ *  - Groups (...) and (?:...), which are the same, and alternation |.
+ *  - The quantifiers * + ? {n} {n,} {n,m}, followed by ? to make them lazy.
+ *  - ^ and $ at the very start and end of the pattern, when the pattern is
+ *    not an alternation at its top level.
+ *
+ * Like RE2, patterns are rejected as invalid when groups and repeats nest
+ * deeper than 256, or the compiled program would be too large, so nested
+ * counted repeats like (?:(?:a{1000}){1000}){1000} fail to compile.
+ */
+class regex {
+public:
+    regex() = default;
+
+    /**
+     * Compiles a pattern. @see error to check the result.
+     */
+    regex(utf8_byte const* pattern, utf8_usize len) {
+        compile(pattern, len);
+    }
+
+    /**
+     * Compiles a pattern, replacing the previous one.
+     * @param pattern The UTF8 pattern.
+     * @param len The length of the pattern.
+     * @return True, if the pattern is valid.
+     */
+    bool compile(utf8_byte const* pattern, utf8_usize len) {
+        detail::regex_node root;
+        detail::regex_parser parser(pattern, len);
+        err = error::invalid_pattern;
+        err_offset = 0;
+        if (!parser.parse(root, anchored_start, anchored_end)) {
+            err_offset = parser.offset();
+            return false;
+        }
+        err = 0;
+
+        forward.build(root, false);
+        backward.build(root, true);
+        prefix.clear();
+        if (!anchored_start && !anchored_end) find_prefix(root);
+
+        // Bytes where no edge starts or ends share a class
+        bool boundary[257] = {};
+        for (auto const* prog : { &forward, &backward }) {
+            for (auto const& e : prog->edges) {
+                boundary[e.first] = true;
+                boundary[e.last + 1] = true;
+            }
+        }
+        std::uint32_t count = 0;
+        for (int b = 0; b < 256; ++b) {
+            if (b == 0 || boundary[b]) ++count;
+            classes[b] = std::uint8_t(count - 1);
+        }
+        unanchored_dfa.reset(count, true, false);
+        anchored_dfa.reset(count, false, false);
+        full_dfa.reset(count, false, true);
+        reverse_dfa.reset(count, false, true);
+        return true;
+    }
+
+    /**
+     * @return Zero, or error::invalid_pattern if the last compiled pattern
+     * was invalid (or nothing was compiled).
+     */
+    utf8_ssize error() const noexcept { return err; }
+
+    /**
+     * @return The byte offset in the pattern where the error was found.
+     */
+    utf8_usize error_offset() const noexcept { return err_offset; }
+
+    /**
+     * Finds the leftmost-first match.
+     * @param src The UTF8 text.
+     * @param len The length of the text.
+     * @param from The byte offset to start searching at, ^ only matches at
+     * zero.
+     * @return The match, with begin not_found if there is none.
+     */
+    regex_match search(utf8_byte const* src, utf8_usize len,
+        utf8_usize from = 0) {
+        regex_match result;
+        if (err != 0 || from > len || (anchored_start && from != 0)) {
+            return result;
+        }
+        if (anchored_end) {
+            auto begin = anchored_start
+                ? (full_match(src, len) ? 0 : not_found)
+                : scan_backward(reverse_dfa, backward, src, len, from);
+            if (begin != not_found) result = { begin, len };
+            return result;
+        }
+
+        auto end = anchored_start
+            ? scan_forward(anchored_dfa, src, len, from)
+            : scan_forward(unanchored_dfa, src, len, from);
+        if (end == not_found) return result;
+        result.begin = anchored_start
+            ? 0 : scan_backward(reverse_dfa, backward, src, end, from);
+        result.end = end;
+        return result;
+    }
+
+    /**
+     * Checks if the whole text matches.
+     */
+    bool full_match(utf8_byte const* src, utf8_usize len) {
+        if (err != 0) return false;
+        auto state = full_dfa.start(forward);
+        for (utf8_usize i = 0; i < len && state != full_dfa.dead_state; ++i) {
+            state = full_dfa.next(forward, state, classes[src[i]], src[i]);
+        }
+        return full_dfa.is_match(state);
+    }
+
+    /**
+     * Finds all non-overlapping matches from left to right. After an empty
+     * match, the search goes on from the next codepoint.
+     * @param src The UTF8 text.
+     * @param len The length of the text.
+     * @return The matches in order.
+     */
+    std::vector<regex_match> find_all(utf8_byte const* src, utf8_usize len) {
+        std::vector<regex_match> result;
+        for (utf8_usize from = 0; from <= len;) {
+            auto m = search(src, len, from);
+            if (m.begin == not_found) break;
+            result.push_back(m);
+            if (m.end != m.begin) {
+                from = m.end;
+                continue;
+            }
+            if (m.end == len) break;
+            auto n = parse_next(src + m.end, src + len);
+            from = m.end + (n > 0 ? utf8_usize(n) : 1);
+        }
+        return result;
+    }
+
+private:
+    utf8_ssize err = error::invalid_pattern;
+    utf8_usize err_offset = 0;
+    bool anchored_start = false;
+    bool anchored_end = false;
+    detail::regex_program forward;
+    detail::regex_program backward;
+    // The literal every match starts with, for skipping ahead
+    std::vector<utf8_byte> prefix;
+    std::uint8_t classes[256] = {};
+    detail::regex_dfa unanchored_dfa;
+    detail::regex_dfa anchored_dfa;
+    detail::regex_dfa full_dfa;
+    detail::regex_dfa reverse_dfa;
+
+    void find_prefix(detail::regex_node const& root) {
+        auto add = [&](detail::regex_node const& node) {
+            if (node.kind != detail::regex_node::set) return false;
+            auto const& r = node.codepoints.ranges();
+            if (r.size() != 1 || r[0].first != r[0].last) return false;
+            utf8_byte buf[4];
+            prefix.insert(prefix.end(), buf, buf + encode_cp(buf, r[0].first));
+            return true;
+        };
+        if (root.kind != detail::regex_node::concat) {
+            add(root);
+            return;
+        }
+        for (auto const& child : root.children) {
+            if (!add(child)) break;
+        }
+    }
+
+    /**
+     * Runs a forward DFA from an offset until it dies.
+     * @return The end of the last match seen, or not_found.
+     */
+    utf8_usize scan_forward(detail::regex_dfa& dfa, utf8_byte const* src,
+        utf8_usize len, utf8_usize from) {
+        auto end = src + len;
+        auto state = dfa.start(forward);
+        auto last = dfa.is_match(state) ? from : not_found;
+        bool skip = !prefix.empty() && &dfa == &unanchored_dfa;
+        for (auto it = src + from; it != end; ++it) {
+            // With no thread alive, jump to where the prefix occurs
+            if (skip && state == dfa.start(forward)) {
+                it = detail::find_forward<false>(it, end, prefix.data(),
+                    prefix.size());
+                if (it == end) break;
+            }
+            state = dfa.next(forward, state, classes[*it], *it);
+            if (state == dfa.dead_state) break;
+            if (dfa.is_match(state)) last = utf8_usize(it - src) + 1;
+        }
+        return last;
+    }
+
+    /**
+     * Runs a DFA of the reversed pattern backwards from an offset until it
+     * dies or reaches the lower limit.
+     * @return The leftmost start of a match ending at the offset, or
+     * not_found.
+     */
+    utf8_usize scan_backward(detail::regex_dfa& dfa,
+        detail::regex_program const& prog, utf8_byte const* src,
+        utf8_usize from, utf8_usize limit) {
+        auto state = dfa.start(prog);
+        auto first = dfa.is_match(state) ? from : not_found;
+        for (auto i = from; i > limit; --i) {
+            auto b = src[i - 1];
+            state = dfa.next(prog, state, classes[b], b);
+            if (state == dfa.dead_state) break;
+            if (dfa.is_match(state)) first = i - 1;
+        }
+        return first;
+    }
+};
+
+namespace detail {
+
+/**
+ * A recursive descent parser for codepoint set patterns, @see
+ * parse_codepoint_set for the syntax.
+ */
+class set_pattern_parser {
+public:
+    set_pattern_parser(utf8_byte const* src, utf8_usize len) noexcept
+        : begin(src), it(src), end(src + len) { }
+
+    /**
+     * Parses a set or a property at the start of the pattern.
+     * @return True, if it is valid.
+     */
+    bool parse(codepoint_set& out) {
+        skip_space();
+        if (!starts_set()) return false;
+        return operand(out);
+    }
+
+    /**
+     * @return The offset where parsing stopped, the error position for an
+     * invalid pattern.
+     */
+    utf8_usize offset() const noexcept { return utf8_usize(it - begin); }
+
+private:
+    // The limit of set nesting
+    static constexpr int max_depth = 256;
+
+    enum operation_t {
+        unite,
+        intersect,
+        subtract,
+    };
+
+    utf8_byte const* begin;
+    utf8_byte const* it;
+    utf8_byte const* end;
+    int depth = 0;
+
+    void skip_space() noexcept {
+        while (it != end && (*it == ' ' || (*it >= '\t' && *it <= '\r'))) {
+            ++it;
+        }
+    }
+
+    bool starts_set() const noexcept {
+        if (it == end) return false;
+        return *it == '['
+            || (*it == '\\' && end - it >= 2 && (it[1] == 'p' || it[1] == 'P'));
+    }
+
+    bool operand(codepoint_set& out) {
+        if (*it == '[') return set(out);
+        ++it;
+        return parse_escape(it, end, out);
+    }
+
+    /**
+     * Parses a literal or escaped codepoint, or a class escape like \p{L}
+     * into the set, when the codepoint is not set.
+     */
+    bool item(utf8_cp& cp, bool& single, codepoint_set& out) {
+        single = true;
+        if (*it == '\\') {
+            ++it;
+            if (!parse_escape(it, end, out)) return false;
+            auto const& r = out.ranges();
+            single = r.size() == 1 && r[0].first == r[0].last;
+            if (single) cp = r[0].first;
+            return true;
+        }
+        // Multi-codepoint strings and variables are not supported
+        if (*it == '{' || *it == '}' || *it == '$') return false;
+        auto n = parse_strict(it, end);
+        if (n < 0) return false;
+        cp = calc_codepoint(it, utf8_usize(n));
+        it += n;
+        return true;
+    }
+
+    /**
+     * Parses [:Name:] or [:^Name:].
+     */
+    bool posix(codepoint_set& out) {
+        it += 2;
+        bool negate = it != end && *it == '^';
+        if (negate) ++it;
+        auto name = it;
+        while (it != end && !(*it == ':' && end - it >= 2 && it[1] == ']')) {
+            ++it;
+        }
+        if (it == end || !property_set(name, utf8_usize(it - name), out)) {
+            it = name;
+            return false;
+        }
+        it += 2;
+        if (negate) out = out.complement();
+        return true;
+    }
+
+    bool set(codepoint_set& out) {
+        if (end - it >= 2 && it[1] == ':') return posix(out);
+        if (++depth > max_depth) return false;
+        ++it;
+        skip_space();
+        bool negate = it != end && *it == '^';
+        if (negate) ++it;
+
+        out = codepoint_set();
+        auto operation = unite;
+        bool empty = true;
+        while (true) {
+            skip_space();
+            if (it == end) return false;
+            if (*it == ']') {
+                if (operation != unite) return false;
+                break;
+            }
+
+            // & and - (or && and --) combine the set so far with the next one
+            if (*it == '&' || *it == '-') {
+                auto op = it;
+                bool doubled = ++it != end && *it == *op;
+                if (doubled) ++it;
+                skip_space();
+                if (*op == '-' && !doubled && it != end && *it == ']') {
+                    out.add('-');
+                    continue;
+                }
+                if (empty || operation != unite || !starts_set()) {
+                    it = op;
+                    return false;
+                }
+                operation = *op == '&' ? intersect : subtract;
+                continue;
+            }
+
+            codepoint_set next;
+            utf8_cp lo = 0;
+            bool single = false;
+            if (*it == '[') {
+                if (!set(next)) return false;
+            }
+            else if (!item(lo, single, next)) {
+                return false;
+            }
+
+            if (single) {
+                // A range needs a single codepoint on both ends
+                auto mark = it;
+                skip_space();
+                bool range = it != end && *it == '-';
+                if (range) {
+                    ++it;
+                    skip_space();
+                    range = it != end && *it != ']' && !starts_set();
+                }
+                if (!range) {
+                    it = mark;
+                    next = codepoint_set(lo, lo);
+                }
+                else {
+                    utf8_cp hi = 0;
+                    codepoint_set bound;
+                    bool bound_single = false;
+                    auto at = it;
+                    if (!item(hi, bound_single, bound)) return false;
+                    if (!bound_single || hi < lo) {
+                        it = at;
+                        return false;
+                    }
+                    next = codepoint_set(lo, hi);
+                }
+                // Only sets can be operands of & and -
+                if (operation != unite) return false;
+            }
+
+            if (operation == intersect) out = out.intersect(next);
+            else if (operation == subtract) out = out.subtract(next);
+            else out = out.unite(next);
+            operation = unite;
+            empty = false;
+        }
+        ++it;
+        --depth;
+        if (negate) out = out.complement();
+        return true;
+    }
+};
+
+} /* namespace detail */
+
+/**
+ * Parses a codepoint set pattern, in the syntax of ICU's UnicodeSet:
+ *  - A property: \p{...} or \P{...}, or [:...:] and [:^...:], with the names
+ *    of @see detail::property_set, like \p{Lu}, \p{Script=Han} or [:Latin:].
+ *  - A set in brackets, [...] or [^...] for its complement, of codepoints,
+ *    ranges like a-z, properties and nested sets, which are united.
+ *  - Inside brackets, & and - (or && and --) followed by a property or a
+ *    nested set intersect or subtract it from the set before them, from left
+ *    to right: [\p{Script=Han}&&[^\p{Nd}]] or [\p{L}-[a-z]].
+ *  - Codepoints are literals, or escapes as in @see regex, like é or \-.
+ *    Whitespace is ignored, a - right before ] stands for itself.
+ * Strings in {...} and variables are not supported. To make membership tests
+ * fast, build a @see frozen_codepoint_set from the result.
+ * @param pattern The UTF8 pattern.
+ * @param len The length of the pattern.
+ * @param out The parsed set.
+ * @return The number of bytes of the set at the start of the pattern, which
+ * is len if it is the whole pattern, or error::invalid_pattern.
+ */
+inline utf8_ssize parse_codepoint_set(utf8_byte const* pattern,
+    utf8_usize len, codepoint_set& out) {
+    detail::set_pattern_parser parser(pattern, len);
+    codepoint_set result;
+    if (!parser.parse(result)) return error::invalid_pattern;
+    out = std::move(result);
+    return utf8_ssize(parser.offset());
+}
+
+namespace detail {
+
+/**
+ * Reads the next codepoint for comparisons of possibly invalid UTF8. Invalid
+ * bytes stand for themselves, as the values above max_codepoint, so they only
+ * equal the same byte and sort after every codepoint.
+ */
+inline utf8_cp
+next_symbol(utf8_byte const*& it, utf8_byte const* end) noexcept {
+    if (*it < 0x80) return *it++;
+    utf8_cp cp = 0;
+    auto n = read_next(it, end, cp);
+    if (n <= 0) return max_codepoint + 1 + *it++;
+    it += n;
+    return cp;
+}
+
+} /* namespace detail */
+
+/**
+ * Computes edit distances in codepoints from a query, with the bit-parallel
+ * algorithm of Myers, in the form of Hyyrö, which also handles adjacent
+ * transpositions (the optimal string alignment distance). Every codepoint of
+ * the query is a bit in the vectors, and queries longer than 64 codepoints
+ * take several words. The match vectors are built once per query, dense for
+ * ASCII and binary searched for the rest.
+ *
+ * Besides whole distances, the automaton can be run one codepoint at a time,
+ * to match against many candidates: with a state saved per prefix, walking
+ * a trie or a sorted word list shares the work of common prefixes, and a
+ * prefix can be skipped once its lower_bound is above the wanted distance.
+ */
+class levenshtein_automaton {
+public:
+    /**
+     * The automaton after reading a text prefix. It holds a column of the
+     * distances from every prefix of the query to the text.
+     */
+    struct state {
+        std::vector<std::uint64_t> vp;
+        std::vector<std::uint64_t> vn;
+        std::vector<std::uint64_t> d0;
+        // The distance of the whole query, and the length of the text
+        utf8_usize score = 0;
+        utf8_usize length = 0;
+        // The smallest distance in the previous column
+        utf8_usize previous_min = 0;
+        // The match vectors of the last codepoint, for transpositions
+        std::size_t previous_row = 0;
+    };
+
+    levenshtein_automaton() : levenshtein_automaton(nullptr, 0) { }
+
+    /**
+     * @param query The UTF8 query.
+     * @param len The length of the query.
+     * @param transpositions Count swapping adjacent codepoints as one edit.
+     */
+    levenshtein_automaton(utf8_byte const* query, utf8_usize len,
+        bool transpositions = false) : transpositions(transpositions) {
+        std::vector<utf8_cp> cps;
+        for (auto it = query, end = query + len; it != end;) {
+            cps.push_back(detail::next_symbol(it, end));
+        }
+        size = cps.size();
+        blocks = std::max<std::size_t>(1, (size + 63) / 64);
+
+        for (auto cp : cps) {
+            if (cp >= 0x80) others.push_back(cp);
+        }
+        std::sort(others.begin(), others.end());
+        others.erase(std::unique(others.begin(), others.end()), others.end());
+        zero_row = 0x80 + others.size();
+        masks.assign((zero_row + 1) * blocks, 0);
+        for (std::size_t i = 0; i < size; ++i) {
+            masks[row(cps[i]) * blocks + i / 64] |= std::uint64_t(1) << i % 64;
+        }
+    }
+
+    /**
+     * @return The length of the query in codepoints.
+     */
+    utf8_usize length() const noexcept { return size; }
+
+    /**
+     * @return The state before reading any text.
+     */
+    state start() const {
+        state s;
+        s.vp.assign(blocks, ~std::uint64_t(0));
+        s.vn.assign(blocks, 0);
+        s.d0.assign(blocks, 0);
+        s.score = size;
+        s.previous_min = 0;
+        s.previous_row = zero_row;
+        return s;
+    }
+
+    /**
+     * Reads a codepoint of the text.
+     */
+    void step(state& s, utf8_cp cp) const noexcept {
+        if (transpositions) s.previous_min = lower_bound_of_column(s);
+        advance(s, row(cp));
+    }
+
+    /**
+     * @return The distance between the query and the text read so far.
+     */
+    utf8_usize distance(state const& s) const noexcept { return s.score; }
+
+    /**
+     * @return A lower bound of the distance between the query and any text
+     * that starts with the text read so far.
+     */
+    utf8_usize lower_bound(state const& s) const noexcept {
+        auto result = lower_bound_of_column(s);
+        if (transpositions && s.length != 0) {
+            result = std::min(result, s.previous_min);
+        }
+        return result;
+    }
+
+    /**
+     * Computes the edit distance between the query and a text.
+     * @param src The UTF8 text.
+     * @param len The length of the text.
+     * @param max The largest distance of interest, larger distances stop
+     * early.
+     * @return The distance in codepoints, or not_found if it is above max.
+     */
+    utf8_usize distance(utf8_byte const* src, utf8_usize len,
+        utf8_usize max = not_found) const {
+        // The text has at most len codepoints
+        if (size > len && size - len > max) return not_found;
+        auto s = start();
+        auto end = src + len;
+        for (auto it = src; it != end;) {
+            auto cp = detail::next_symbol(it, end);
+            advance(s, row(cp));
+            auto left = utf8_usize(end - it);
+            if (s.score > left && s.score - left > max) return not_found;
+        }
+        return s.score <= max ? s.score : not_found;
+    }
+
+private:
+    bool transpositions = false;
+    std::size_t size = 0;
+    std::size_t blocks = 1;
+    // The sorted non-ASCII codepoints of the query, their rows follow ASCII
+    std::vector<utf8_cp> others;
+    // A row of blocks per codepoint, with a bit set where the query has it
+    std::vector<std::uint64_t> masks;
+    std::size_t zero_row = 0x80;
+
+    std::size_t row(utf8_cp cp) const noexcept {
+        if (cp < 0x80) return cp;
+        auto found = std::lower_bound(others.begin(), others.end(), cp);
+        if (found == others.end() || *found != cp) return zero_row;
+        return 0x80 + std::size_t(found - others.begin());
+    }
+
+    /**
+     * Computes the next column, as in the single word algorithm with the
+     * shifts and the addition carried between the words.
+     */
+    void advance(state& s, std::size_t r) const noexcept {
+        auto pm = &masks[r * blocks];
+        auto pm_prev = &masks[s.previous_row * blocks];
+        std::uint64_t add_carry = 0;
+        std::uint64_t hp_carry = 1;
+        std::uint64_t hn_carry = 0;
+        std::uint64_t tr_carry = 0;
+        std::uint64_t hp = 0;
+        std::uint64_t hn = 0;
+        for (std::size_t b = 0; b < blocks; ++b) {
+            auto vp = s.vp[b];
+            auto vn = s.vn[b];
+            auto d0 = pm[b] | vn;
+            if (transpositions) {
+                auto t = ~s.d0[b] & pm[b];
+                d0 |= (t << 1 | tr_carry) & pm_prev[b];
+                tr_carry = t >> 63;
+            }
+            auto a = pm[b] & vp;
+            auto sum = a + vp;
+            auto carry = std::uint64_t(sum < a);
+            sum += add_carry;
+            add_carry = carry | std::uint64_t(sum < add_carry);
+            d0 |= sum ^ vp;
+
+            hp = vn | ~(d0 | vp);
+            hn = vp & d0;
+            auto xp = hp << 1 | hp_carry;
+            auto xn = hn << 1 | hn_carry;
+            hp_carry = hp >> 63;
+            hn_carry = hn >> 63;
+            s.vn[b] = xp & d0;
+            s.vp[b] = xn | ~(xp | d0);
+            s.d0[b] = d0;
+        }
+
+        ++s.length;
+        s.previous_row = r;
+        if (size == 0) {
+            s.score = s.length;
+            return;
+        }
+        auto bit = (size - 1) % 64;
+        s.score += hp >> bit & 1;
+        s.score -= hn >> bit & 1;
+    }
+
+    /**
+     * The smallest distance from a prefix of the query to the text, by
+     * summing the vertical deltas down the column.
+     */
+    utf8_usize lower_bound_of_column(state const& s) const noexcept {
+        auto d = s.length;
+        auto result = d;
+        for (std::size_t b = 0; b < blocks; ++b) {
+            auto valid = size - b * 64 >= 64
+                ? ~std::uint64_t(0) : (std::uint64_t(1) << (size - b * 64)) - 1;
+            auto changes = (s.vp[b] | s.vn[b]) & valid;
+            for (unsigned half = 0; half < 64; half += 32) {
+                auto bits = std::uint32_t(changes >> half);
+                while (bits != 0) {
+                    auto i = half + detail::ctz(bits);
+                    bits &= bits - 1;
+                    if ((s.vp[b] >> i & 1) != 0) {
+                        ++d;
+                    }
+                    else {
+                        result = std::min(result, --d);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+};
+
+/**
+ * Computes the Levenshtein distance of two UTF8 strings in codepoints.
+ * @see levenshtein_automaton, which should be used to compare one string to
+ * many.
+ * @param max The largest distance of interest, larger distances stop early.
+ * @return The distance, or not_found if it is above max.
+ */
+inline utf8_usize edit_distance(utf8_byte const* a, utf8_usize alen,
+    utf8_byte const* b, utf8_usize blen, utf8_usize max = not_found) {
+    if (alen > blen) {
+        std::swap(a, b);
+        std::swap(alen, blen);
+    }
+    return levenshtein_automaton(a, alen).distance(b, blen, max);
+}
+
+/**
+ * Same as @see edit_distance, but swapping two adjacent codepoints is a
+ * single edit, and no codepoint is edited twice (the optimal string
+ * alignment distance, a restricted Damerau-Levenshtein distance).
+ */
+inline utf8_usize damerau_distance(utf8_byte const* a, utf8_usize alen,
+    utf8_byte const* b, utf8_usize blen, utf8_usize max = not_found) {
+    if (alen > blen) {
+        std::swap(a, b);
+        std::swap(alen, blen);
+    }
+    return levenshtein_automaton(a, alen, true).distance(b, blen, max);
+}
+
+/**
+ * The levels of the Unicode Collation Algorithm. Each level only breaks the
+ * ties of the ones before it: base characters, then accents, then case and
+ * variants, then the ignored punctuation of shifted variable weighting.
+ */
+enum class collation_strength : std::uint8_t {
+    primary = 1,
+    secondary,
+    tertiary,
+    quaternary,
+};
+
+/**
+ * The options of collation.
+ */
+struct collation_options {
+    /**
+     * The number of levels to compare.
+     */
+    collation_strength strength = collation_strength::tertiary;
+
+    /**
+     * With shifted variable weighting, spaces, punctuation and most symbols
+     * are ignored on the first three levels, and only compared on the
+     * quaternary one. Otherwise (non-ignorable) they sort like base
+     * characters, before letters and digits.
+     */
+    bool shifted = false;
+};
+
+namespace detail {
+
+/**
+ * Reads the next codepoint for collation, an invalid byte is U+FFFD.
+ */
+inline utf8_cp
+next_collation_codepoint(utf8_byte const*& it, utf8_byte const* end) noexcept {
+    if (*it < 0x80) return *it++;
+    auto n = parse_strict(it, end);
+    if (n < 0) {
+        ++it;
+        return 0xfffd;
+    }
+    auto cp = calc_codepoint(it, utf8_usize(n));
+    it += n;
+    return cp;
+}
+
+/**
+ * Looks up the collation elements or contractions of a codepoint, zero if it
+ * has implicit weights.
+ */
+inline std::uint32_t collation_lookup(utf8_cp cp) noexcept {
+    return lookup_reverse(tables::collation_limit, tables::collation_stage1,
+        tables::collation_stage2, cp);
+}
+
+/**
+ * Computes the two implicit collation elements of a codepoint that is not in
+ * the DUCET, from its block (UTS #10 10.1.3).
+ */
+inline void collation_implicit(utf8_cp cp, std::uint32_t (&out)[2]) noexcept {
+    // Unassigned codepoints
+    std::uint32_t base = 0xfbc0;
+    utf8_cp origin = 0;
+    auto const& firsts = tables::collation_implicit_firsts;
+    auto found = std::upper_bound(std::begin(firsts), std::end(firsts), cp);
+    if (found != std::begin(firsts)) {
+        auto i = std::size_t(found - std::begin(firsts)) - 1;
+        if (cp <= tables::collation_implicit_lasts[i]) {
+            base = tables::collation_implicit_bases[i];
+            origin = tables::collation_implicit_origins[i];
+        }
+    }
+    auto offset = cp - origin;
+    out[0] = (base + (offset >> 15)) << 16 | 0x20 << 6 | 0x02 << 1;
+    out[1] = ((offset & 0x7fff) | 0x8000) << 16;
+}
+
+/**
+ * Produces the collation elements of UTF8 text, packed as in the generated
+ * tables: primary << 16 | secondary << 6 | tertiary << 1 | variable.
+ * Contractions are matched when they are contiguous. The text is not
+ * normalized, the DUCET covers precomposed characters, like ICU without
+ * normalization.
+ */
+class collation_iterator {
+public:
+    collation_iterator(utf8_byte const* src, utf8_byte const* end) noexcept
+        : it(src), end(end) { }
+
+    /**
+     * Reads the next collation element.
+     * @return False at the end of the text.
+     */
+    bool next(std::uint32_t& ce) noexcept {
+        if (remaining == 0 && !refill()) return false;
+        ce = *pending++;
+        --remaining;
+        return true;
+    }
+
+private:
+    utf8_byte const* it;
+    utf8_byte const* end;
+    std::uint32_t const* pending = nullptr;
+    std::uint32_t remaining = 0;
+    std::uint32_t implicit[2] = {};
+
+    bool refill() noexcept {
+        if (it == end) return false;
+        auto cp = next_collation_codepoint(it, end);
+        auto value = collation_lookup(cp);
+        if ((value & tables::collation_contraction_flag) != 0) {
+            value = contract(value & ~tables::collation_contraction_flag);
+        }
+        if (value == 0) {
+            collation_implicit(cp, implicit);
+            pending = implicit;
+            remaining = 2;
+        }
+        else {
+            pending = tables::collation_elements + (value >> 5);
+            remaining = value & 31;
+        }
+        return true;
+    }
+
+    /**
+     * Finds the longest contraction of a starter with what follows it.
+     */
+    std::uint32_t contract(std::uint32_t offset) noexcept {
+        constexpr auto max_length = tables::collation_contraction_length;
+        auto table = tables::collation_contractions + offset;
+        utf8_cp next[max_length] = {};
+        utf8_byte const* after[max_length] = {};
+        std::uint32_t available = 0;
+        for (auto pos = it; available < max_length && pos != end;) {
+            next[available] = next_collation_codepoint(pos, end);
+            after[available++] = pos;
+        }
+
+        auto entry = table + 2;
+        for (std::uint32_t i = 0; i < table[1]; ++i) {
+            auto length = entry[0];
+            if (length <= available
+                && std::equal(entry + 1, entry + 1 + length, next)) {
+                it = after[length - 1];
+                return entry[1 + length];
+            }
+            entry += length + 2;
+        }
+        return table[0];
+    }
+};
+
+/**
+ * The weight of a collation element at a level, zero if it is ignored there.
+ * For shifted variable weighting, tracks whether the element follows a
+ * variable one (UTS #10 4.1).
+ */
+inline std::uint32_t collation_weight(std::uint32_t ce, int level,
+    bool shifted, bool& after_variable) noexcept {
+    auto primary = ce >> 16;
+    if (shifted) {
+        if ((ce >> 1) == 0) return 0;
+        if ((ce & 1) != 0) {
+            after_variable = true;
+            return level == 4 ? primary : 0;
+        }
+        if (primary == 0 && after_variable) return 0;
+        if (primary != 0) after_variable = false;
+        if (level == 4) return 0xffff;
+    }
+    switch (level) {
+    case 1: return primary;
+    case 2: return ce >> 6 & 0x1ff;
+    case 3: return ce >> 1 & 0x1f;
+    }
+    return 0;
+}
+
+/**
+ * The next weight of the text at a level, zero at the end.
+ */
+inline std::uint32_t next_collation_weight(collation_iterator& it,
+    int level, bool shifted, bool& after_variable) noexcept {
+    std::uint32_t ce = 0;
+    while (it.next(ce)) {
+        auto weight = collation_weight(ce, level, shifted, after_variable);
+        if (weight != 0) return weight;
+    }
+    return 0;
+}
+
+/**
+ * The number of levels to compare, the quaternary one only exists with
+ * shifted variable weighting.
+ */
+inline int collation_levels(collation_options const& options) noexcept {
+    auto levels = int(options.strength);
+    return levels == 4 && !options.shifted ? 3 : levels;
+}
+
+/**
+ * Checks if the collation elements after a codepoint never depend on it: it
+ * is not part of any contraction, and ends in a non-variable primary.
+ */
+inline bool collation_boundary_after(utf8_cp cp) noexcept {
+    auto value = collation_lookup(cp);
+    if ((value & tables::collation_contraction_flag) != 0) return false;
+    auto const& members = tables::collation_contraction_members;
+    if (std::binary_search(std::begin(members), std::end(members), cp)) {
+        return false;
+    }
+    // Implicit weights end in a primary too
+    if (value == 0) return true;
+    auto last = tables::collation_elements[(value >> 5) + (value & 31) - 1];
+    return (last >> 16) != 0 && (last & 1) == 0;
+}
+
+/**
+ * The length of the common prefix of two texts, that can be skipped when
+ * comparing them, because it ends at a collation boundary.
+ */
+inline utf8_usize collation_common_prefix(utf8_byte const* a, utf8_usize alen,
+    utf8_byte const* b, utf8_usize blen) noexcept {
+    auto same = std::mismatch(a, a + std::min(alen, blen), b).first;
+    auto n = utf8_usize(same - a);
+    while (n > 0) {
+        // The codepoint ending right at the boundary
+        auto start = n - 1;
+        while (start > 0 && n - start < 4 && is_continuation(a[start])) {
+            --start;
+        }
+        auto length = parse_strict(a + start, a + alen);
+        if (length > 0 && start + utf8_usize(length) == n
+            && collation_boundary_after(
+                calc_codepoint(a + start, utf8_usize(length)))) {
+            break;
+        }
+        n = start;
+    }
+    return n;
+}
+
+} /* namespace detail */
+
+/**
+ * Compares two UTF8 strings with the Unicode Collation Algorithm and the
+ * default table (DUCET), without allocating. Strings equal up to the
+ * compared strength compare equal, even if their bytes differ.
+ * @param a The first UTF8 string.
+ * @param alen The length of the first string.
+ * @param b The second UTF8 string.
+ * @param blen The length of the second string.
+ * @param options The collation options.
+ * @return Negative if a sorts first, positive if b sorts first, zero if they
+ * are equal.
+ */
+inline int collate(utf8_byte const* a, utf8_usize alen, utf8_byte const* b,
+    utf8_usize blen, collation_options const& options = {}) noexcept {
+    auto prefix = detail::collation_common_prefix(a, alen, b, blen);
+    auto levels = detail::collation_levels(options);
+    for (int level = 1; level <= levels; ++level) {
+        detail::collation_iterator ia(a + prefix, a + alen);
+        detail::collation_iterator ib(b + prefix, b + blen);
+        bool va = false;
+        bool vb = false;
+        while (true) {
+            auto wa = detail::next_collation_weight(ia, level, options.shifted,
+                va);
+            auto wb = detail::next_collation_weight(ib, level, options.shifted,
+                vb);
+            if (wa != wb) return wa < wb ? -1 : 1;
+            if (wa == 0) break;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Builds the binary sort key of a UTF8 string. Comparing two keys byte by
+ * byte (with memcmp, a shorter key that is a prefix of the other sorting
+ * first) gives the same order as @see collate. The levels are separated by
+ * a 1 byte. Primary and quaternary weights take 2 bytes, and secondary and
+ * tertiary ones a single byte.
+ * @param src The UTF8 string.
+ * @param len The length of the string.
+ * @param options The collation options.
+ * @return The sort key.
+ */
+inline std::vector<utf8_byte> sort_key(utf8_byte const* src, utf8_usize len,
+    collation_options const& options = {}) {
+    std::vector<utf8_byte> key;
+    auto levels = detail::collation_levels(options);
+    for (int level = 1; level <= levels; ++level) {
+        if (level > 1) key.push_back(1);
+        detail::collation_iterator it(src, src + len);
+        bool after_variable = false;
+        while (auto weight = detail::next_collation_weight(it, level,
+            options.shifted, after_variable)) {
+            if (level == 2) {
+                key.push_back(
+                    utf8_byte(weight - tables::collation_secondary_bias));
+            }
+            else if (level == 3) {
+                key.push_back(utf8_byte(weight));
+            }
+            else {
+                key.push_back(utf8_byte(weight >> 8));
+                key.push_back(utf8_byte(weight));
+            }
+        }
+    }
+    return key;
+}
+
+/**
+ * Gets the value of a decimal digit, a codepoint of General_Category Nd.
+ * @param cp The codepoint.
+ * @return The value from 0 to 9, or -1 if the codepoint is not a digit.
+ */
+inline int decimal_digit_value(utf8_cp cp) noexcept {
+    if (cp < 0x80) return cp >= '0' && cp <= '9' ? int(cp - '0') : -1;
+    auto const& zeros = tables::decimal_digit_zeros;
+    auto found = std::upper_bound(std::begin(zeros), std::end(zeros), cp);
+    auto offset = cp - found[-1];
+    return offset < 10 ? int(offset) : -1;
+}
+
+namespace detail {
+
+/**
+ * Compares the numbers at the start of two strings by their values, and
+ * moves past both. The digits may be of any script, and leading zeros are
+ * ignored.
+ */
+inline int compare_numbers(utf8_byte const*& a, utf8_byte const* aend,
+    utf8_byte const*& b, utf8_byte const* bend) noexcept {
+    // Reads a digit, or leaves the position alone and returns -1
+    auto digit = [](utf8_byte const*& it, utf8_byte const* end) {
+        if (it == end) return -1;
+        auto next = it;
+        auto value = decimal_digit_value(next_symbol(next, end));
+        if (value >= 0) it = next;
+        return value;
+    };
+    auto skip_zeros = [](utf8_byte const*& it, utf8_byte const* end) {
+        while (it != end) {
+            auto next = it;
+            if (decimal_digit_value(next_symbol(next, end)) != 0) break;
+            it = next;
+        }
+    };
+
+    skip_zeros(a, aend);
+    skip_zeros(b, bend);
+    // With as many significant digits, the first difference decides
+    int result = 0;
+    while (true) {
+        auto da = digit(a, aend);
+        auto db = digit(b, bend);
+        if (da < 0 || db < 0) {
+            if (da >= 0 || db >= 0) {
+                // The longer number is larger, skip the rest of it
+                while (digit(a, aend) >= 0) { }
+                while (digit(b, bend) >= 0) { }
+                return da >= 0 ? 1 : -1;
+            }
+            return result;
+        }
+        if (result == 0 && da != db) result = da < db ? -1 : 1;
+    }
+}
+
+} /* namespace detail */
+
+/**
+ * Compares two UTF8 strings in natural order, where numbers compare by their
+ * values, like file9 before file10. Numbers are runs of decimal digits of any
+ * script (like full-width or Arabic-Indic ones), and sort where ASCII digits
+ * would among the other codepoints, which compare by their values. Strings
+ * that are equal this way, like a01 and a1, are ordered by their bytes.
+ * Invalid bytes sort after every codepoint. Does not allocate.
+ * @param a The first UTF8 string.
+ * @param alen The length of the first string.
+ * @param b The second UTF8 string.
+ * @param blen The length of the second string.
+ * @return Negative if a sorts first, positive if b sorts first, zero if they
+ * are the same.
+ */
+inline int natural_compare(utf8_byte const* a, utf8_usize alen,
+    utf8_byte const* b, utf8_usize blen) noexcept {
+    auto ait = a;
+    auto bit = b;
+    auto aend = a + alen;
+    auto bend = b + blen;
+    auto is_digit = [](utf8_byte c) { return c >= '0' && c <= '9'; };
+    while (ait != aend && bit != bend) {
+        // Equal ASCII outside of numbers is skipped without decoding
+        if (*ait == *bit && *ait < 0x80 && !is_digit(*ait)) {
+            ++ait;
+            ++bit;
+            continue;
+        }
+
+        auto anext = ait;
+        auto bnext = bit;
+        auto acp = detail::next_symbol(anext, aend);
+        auto bcp = detail::next_symbol(bnext, bend);
+        bool adigit = decimal_digit_value(acp) >= 0;
+        bool bdigit = decimal_digit_value(bcp) >= 0;
+        if (adigit && bdigit) {
+            auto result = detail::compare_numbers(ait, aend, bit, bend);
+            if (result != 0) return result;
+            continue;
+        }
+        if (adigit) acp = '0';
+        if (bdigit) bcp = '0';
+        if (acp != bcp) return acp < bcp ? -1 : 1;
+        ait = anext;
+        bit = bnext;
+    }
+    if (ait != aend || bit != bend) return ait == aend ? -1 : 1;
+
+    auto common = std::min(alen, blen);
+    auto result = common == 0 ? 0 : std::memcmp(a, b, common);
+    if (result != 0) return result < 0 ? -1 : 1;
+    return alen < blen ? -1 : alen > blen ? 1 : 0;
+}
+
 #undef utf8pp_assert
 #undef utf8pp_panic
 
@@ -272,5 +7583,6 @@ encode_cp(utf8_byte* dst, utf8_cp cp) noexcept {
 #undef UTF8PP_WINDOWS
 #undef UTF8PP_LINUX
 #undef UTF8PP_OSX
+#undef UTF8PP_SSE2
 
 #endif /* PETER_LENKEFI_UTF8PP_HPP */
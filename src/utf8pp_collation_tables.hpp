@@ -0,0 +1,8079 @@
+/**
+ * utf8pp_collation_tables.hpp
+ *
+ * @description This file is generated by generate.py from the unicode character
+ * databases, do not edit it by hand.
+ * @license MIT
+ */
+
+#ifndef PETER_LENKEFI_UTF8PP_COLLATION_TABLES_HPP
+#define PETER_LENKEFI_UTF8PP_COLLATION_TABLES_HPP
+
+#include <cstdint>
+
+namespace utf8pp {
+namespace tables {
+
+inline constexpr std::uint32_t collation_contraction_flag = 0x80000000;
+inline constexpr std::uint32_t collation_secondary_bias = 0x1E;
+inline constexpr std::uint32_t collation_contraction_length = 2;
+
+inline constexpr std::uint32_t collation_limit = 918016;
+
+inline constexpr std::uint16_t collation_stage1[] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+    129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+    145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+    161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+    177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+    193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 209, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241,
+    242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 258, 259,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 0, 0, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 307, 0, 0, 308, 309, 310, 311, 312, 313, 0, 0,
+    314, 315, 316, 317, 318, 0, 319, 320, 321, 322, 323, 324, 325, 326, 327, 0,
+    328, 329, 330, 331, 332, 0, 0, 0, 0, 333, 334, 0, 335, 336, 337, 338,
+    339, 340, 341, 342, 343, 344, 345, 346, 347, 0, 348, 349, 350, 351, 0, 0,
+    352, 353, 354, 355, 0, 0, 356, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+    363, 0, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 0, 0, 0, 0,
+    374, 375, 376, 0, 377, 378, 379, 0, 0, 0, 0, 380, 0, 0, 381, 382,
+    383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 0,
+    398, 399, 400, 401, 402, 403, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+    420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 0, 441, 442, 443, 444, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 445, 446, 0, 447, 448, 449, 450,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    451, 452, 453, 454, 455, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    457, 458, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 0, 470, 471, 472, 0, 0,
+    473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+    489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    500, 0, 0, 0, 501, 502, 0, 0, 0, 0, 0, 503, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    504, 505, 506, 507, 508, 509, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 510, 511, 0, 512, 0, 0, 0, 513, 514, 515, 516, 0, 0, 0, 0,
+    517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 0, 0, 527, 528, 529, 530,
+    531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546,
+    547, 548, 549, 0, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    571, 572, 0, 0, 572, 572, 572, 573,
+};
+
+inline constexpr std::uint32_t collation_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 33, 65, 97, 129, 161, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    193, 225, 257, 289, 259905, 321, 353, 385, 417, 449, 481, 513, 545, 577, 609, 641,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 673, 705, 737, 769, 801, 833,
+    865, 283041, 291425, 293025, 296193, 299777, 305345, 307297, 310049, 313153, 317409, 318529, 2147483648, 325537, 328769, 332161,
+    340545, 342945, 343809, 347617, 351745, 354657, 361345, 363617, 365441, 366881, 368961, 897, 929, 961, 993, 1025,
+    1057, 282785, 291169, 292769, 295937, 299521, 305089, 307041, 309793, 312897, 317185, 318273, 2147483656, 325281, 328513, 331905,
+    340289, 342721, 343553, 347361, 351489, 354401, 361089, 363361, 365185, 366657, 368705, 1089, 1121, 1153, 1185, 1,
+    1, 1, 1, 1, 1, 1217, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1249, 1281, 259841, 260001, 259809, 260065, 1313, 1345, 1377, 1409, 283265, 1441, 1473, 1, 1505, 1537,
+    1569, 1601, 270369, 274561, 1633, 387809, 1665, 1697, 1729, 262657, 332385, 1761, 266147, 264611, 275331, 1793,
+    283554, 283426, 284578, 286370, 285986, 285602, 288483, 294050, 300290, 300162, 300546, 301570, 313698, 313570, 313954, 314210,
+    297506, 329538, 332674, 332546, 332930, 334530, 334018, 1825, 335554, 355170, 355042, 355426, 355874, 367234, 371105, 350371,
+    283490, 283362, 284514, 286306, 285858, 285538, 288387, 293922, 300226, 300098, 300482, 301506, 313634, 313506, 313890, 314146,
+    297442, 329474, 332610, 332482, 332866, 334466, 333890, 1857, 335490, 355106, 354978, 355362, 355746, 367170, 371073, 367618,
+    286946, 286882, 283682, 283618, 286818, 286754, 293474, 293410, 293602, 293538, 293858, 293794, 293730, 293666, 296610, 296546,
+    296994, 296930, 302402, 302338, 300418, 300354, 301826, 301762, 302274, 302210, 301442, 301378, 307906, 307842, 307778, 307714,
+    308162, 308098, 308290, 308226, 310434, 310370, 311074, 311010, 314530, 314466, 314850, 314786, 313826, 313762, 314722, 314658,
+    314594, 316513, 316066, 316002, 317794, 317730, 319170, 319106, 343521, 321954, 321890, 322210, 322146, 322082, 322018, 323042,
+    322978, 322338, 322274, 329154, 329090, 329794, 329730, 329410, 329346, 372354, 331809, 331777, 336194, 336130, 332802, 332738,
+    334402, 334338, 338595, 338499, 344194, 344130, 344578, 344514, 344322, 344258, 348098, 348034, 348418, 348354, 348994, 348930,
+    348546, 348482, 352450, 352386, 352130, 352066, 353953, 353921, 356962, 356898, 357410, 357346, 355298, 355234, 355682, 355618,
+    356834, 356770, 357282, 357218, 364226, 364162, 367490, 367426, 367682, 369314, 369250, 369698, 369634, 369570, 369506, 349634,
+    292289, 292577, 292641, 292609, 372161, 372129, 339457, 295713, 295681, 299233, 299297, 299393, 299361, 370018, 304257, 304417,
+    304577, 306913, 306881, 309473, 309665, 312321, 317089, 316833, 320929, 320897, 324449, 325217, 360769, 331393, 331457, 339937,
+    337154, 337090, 309761, 309729, 342433, 342401, 346209, 372033, 372001, 351233, 351361, 354081, 354177, 354145, 354241, 358178,
+    358114, 360993, 363073, 368513, 368481, 370145, 370113, 370689, 370945, 370913, 371009, 371777, 372097, 372065, 353570, 371265,
+    373025, 373057, 373089, 373121, 298723, 298627, 298531, 323234, 323170, 323106, 330786, 330722, 330658, 285474, 285410, 314082,
+    314018, 333826, 333762, 355554, 355490, 356675, 356579, 356099, 356003, 356483, 356387, 356291, 356195, 304225, 286211, 286115,
+    286659, 286563, 289060, 288932, 309377, 309345, 308034, 307970, 319042, 318978, 335874, 335810, 336035, 335939, 370818, 370754,
+    317858, 298466, 298402, 298338, 307650, 307586, 312353, 371297, 329282, 329218, 285763, 285667, 288804, 288676, 335715, 335619,
+    287202, 287138, 287330, 287266, 303042, 302978, 303170, 303106, 315106, 315042, 315234, 315170, 336898, 336834, 337026, 336962,
+    344834, 344770, 344962, 344898, 357922, 357858, 358050, 357986, 349570, 349506, 352706, 352642, 368673, 368641, 310562, 310498,
+    331489, 299425, 340193, 340161, 370305, 370273, 286498, 286434, 301954, 301890, 334243, 334147, 335075, 334979, 335234, 335170,
+    335395, 335299, 368066, 368002, 325057, 331681, 354273, 317921, 297826, 343202, 290497, 295521, 295489, 324481, 354017, 351041,
+    370465, 372257, 372225, 292321, 360225, 363297, 304097, 304065, 318049, 318017, 343489, 343457, 346433, 346401, 368449, 368417,
+    290753, 290849, 291041, 292545, 339425, 295745, 299201, 299265, 304705, 304353, 304737, 304545, 304769, 304961, 304993, 318177,
+    309441, 309153, 309281, 309633, 305057, 360577, 312417, 312801, 316801, 317057, 316577, 324577, 324769, 324961, 325121, 360737,
+    360897, 328289, 331361, 331617, 331169, 339905, 339137, 340065, 342625, 346497, 346593, 346657, 346753, 346785, 346881, 346945,
+    346145, 347137, 350945, 351169, 318241, 351393, 351457, 354337, 354209, 360193, 360961, 363041, 363265, 365089, 325249, 368385,
+    370337, 370401, 370657, 371041, 372193, 372641, 372993, 373153, 373185, 292257, 305025, 309505, 312289, 318081, 321217, 324193,
+    343425, 372929, 372961, 298338, 298946, 298882, 353570, 353698, 353154, 306498, 323906, 324130, 373217, 373249, 360673, 360705,
+    310273, 312481, 317633, 344033, 346529, 346689, 347169, 363841, 367105, 1889, 1921, 312833, 372321, 312865, 372449, 372705,
+    372289, 372737, 1953, 1985, 2017, 2049, 2081, 2113, 2145, 2177, 2209, 2241, 2273, 2305, 2337, 2369,
+    258625, 258657, 2401, 2433, 2465, 2497, 2529, 2561, 2593, 2625, 2657, 2689, 2721, 2753, 2785, 2817,
+    309697, 321793, 347937, 365697, 372673, 2849, 2881, 2913, 2945, 2977, 3009, 3041, 3073, 3105, 372417, 3137,
+    3169, 3201, 3233, 3265, 3297, 3329, 3361, 3393, 3425, 3457, 3489, 3521, 3553, 3585, 3617, 3649,
+    249697, 249665, 249761, 250017, 250177, 250497, 249729, 250049, 249889, 250529, 249825, 249985, 249793, 250209, 250209, 250561,
+    250593, 250625, 250209, 249601, 249633, 250209, 250241, 250241, 250241, 250241, 250209, 250657, 250241, 250241, 250241, 250241,
+    250241, 250689, 250721, 250753, 250785, 250817, 250849, 250113, 250145, 250241, 250241, 250241, 250241, 250881, 250913, 250241,
+    250945, 250977, 249569, 250241, 251009, 250465, 250273, 250273, 250081, 251041, 250241, 250241, 250241, 250209, 250209, 250209,
+    249697, 249665, 249857, 249601, 249922, 251073, 250209, 250241, 250241, 250241, 250209, 250209, 250209, 250241, 250241, 1,
+    250209, 250209, 250209, 250241, 250241, 250241, 250241, 250209, 251105, 250241, 250241, 250209, 250241, 250209, 250209, 250241,
+    251137, 251169, 250241, 282849, 299585, 312961, 331969, 354465, 292833, 296001, 309857, 325345, 343617, 351553, 361153, 365249,
+    380193, 380161, 398721, 398689, 1889, 3681, 379937, 379905, 0, 0, 384673, 391233, 391169, 391297, 705, 387233,
+    0, 0, 0, 0, 1633, 3714, 376802, 1697, 379586, 383746, 386274, 0, 389922, 0, 392770, 397922,
+    386787, 373345, 377825, 378017, 378241, 378433, 380097, 380289, 384513, 384737, 387361, 387681, 387873, 388513, 388641, 388769,
+    390209, 390593, 0, 391041, 391425, 391553, 393921, 394113, 394305, 394465, 386722, 393282, 376738, 379522, 383682, 386210,
+    393411, 373281, 377729, 377953, 378177, 378337, 380033, 380225, 384417, 384641, 387265, 387617, 387777, 388449, 388577, 388705,
+    390113, 390497, 391137, 390945, 391361, 391489, 393825, 394049, 394241, 394401, 386658, 393218, 389858, 392706, 397858, 387523,
+    377761, 384449, 391585, 392834, 393346, 393857, 390145, 387427, 390465, 390433, 380001, 379969, 379841, 379777, 390401, 390369,
+    398657, 398625, 400929, 400897, 401249, 401217, 401313, 401281, 401505, 401473, 401953, 401921, 402145, 402113, 402401, 402369,
+    387297, 390529, 390977, 387201, 384545, 378369, 3777, 398785, 398753, 391073, 390337, 390305, 390913, 391265, 391201, 391329,
+    404802, 405058, 404417, 403714, 405185, 406273, 407201, 407362, 407585, 408801, 409793, 411521, 407874, 406786, 411714, 414497,
+    402817, 403425, 403521, 403617, 404225, 404705, 405281, 405825, 2147483664, 407521, 407777, 408449, 409089, 409313, 409953, 410401,
+    410689, 410913, 411201, 411617, 412513, 412609, 413441, 413793, 414593, 414753, 414977, 415169, 415393, 415713, 415937, 416161,
+    402753, 403361, 403457, 403553, 404161, 404641, 405217, 405761, 2147483669, 407489, 407713, 408385, 409025, 409249, 409889, 410337,
+    410625, 410849, 411137, 411553, 412449, 412545, 413377, 413729, 414529, 414689, 414913, 415105, 415329, 415681, 415873, 416129,
+    404738, 404994, 404385, 403650, 405121, 406241, 407169, 407234, 407553, 408769, 409761, 411489, 407810, 406722, 411650, 414465,
+    413089, 413025, 415585, 415521, 416321, 416257, 416417, 416353, 416705, 416673, 416577, 416513, 416865, 416801, 416929, 416897,
+    416993, 416961, 417089, 417025, 417153, 417121, 417250, 417186, 412417, 412385, 413345, 413313, 413281, 413249, 413153, 413121,
+    410593, 410561, 3809, 251201, 250209, 249633, 249601, 250209, 1, 1, 407137, 407105, 415489, 415457, 410753, 410721,
+    403842, 403778, 403937, 403905, 404065, 404033, 405729, 405697, 404609, 404577, 407969, 407937, 408225, 408193, 408161, 408129,
+    408097, 408065, 409537, 409505, 409729, 409697, 410529, 410497, 417409, 417377, 411105, 411073, 411393, 411361, 412193, 412161,
+    412257, 412225, 412801, 412769, 413633, 413601, 414113, 414081, 414241, 414209, 412865, 412833, 414369, 414337, 414433, 414401,
+    417537, 405378, 405314, 408033, 408001, 408545, 408513, 409601, 409569, 409473, 409441, 414177, 414145, 409153, 409121, 417505,
+    402914, 402850, 403042, 402978, 403329, 403297, 404930, 404866, 403137, 403105, 403234, 403170, 405506, 405442, 405922, 405858,
+    406401, 406369, 407042, 406978, 406914, 406850, 410082, 410018, 410177, 410145, 410274, 410210, 415810, 415746, 412098, 412034,
+    411842, 411778, 411970, 411906, 413890, 413826, 404129, 404097, 415266, 415202, 404001, 403969, 412673, 412641, 412737, 412705,
+    404289, 404257, 404545, 404513, 406081, 406049, 406529, 406497, 408929, 408897, 409857, 409825, 411041, 411009, 411329, 411297,
+    406145, 406113, 408673, 408641, 408993, 408961, 410817, 410785, 416225, 416193, 408353, 408321, 417473, 417441, 408289, 408257,
+    408737, 408705, 409665, 409633, 410465, 410433, 412929, 412897, 409409, 409377, 405601, 405569, 413985, 413953, 408609, 408577,
+    0, 428737, 428833, 428897, 428961, 429025, 429153, 429217, 429281, 429345, 429409, 429473, 429537, 429601, 429665, 429729,
+    429793, 429857, 429921, 429985, 430049, 430369, 430465, 430529, 430593, 430657, 430721, 430785, 430849, 430913, 430977, 431105,
+    431169, 431233, 431297, 431361, 431425, 431489, 431553, 0, 0, 431585, 3841, 3873, 3905, 3937, 3969, 4001,
+    428769, 428705, 428801, 428865, 428929, 428993, 429121, 429185, 429249, 429313, 429377, 429441, 429505, 429569, 429633, 429697,
+    429761, 429825, 429889, 429953, 430017, 430337, 430433, 430497, 430561, 430625, 430689, 430753, 430817, 430881, 430945, 431073,
+    431137, 431201, 431265, 431329, 431393, 431457, 431521, 429058, 430401, 4033, 4065, 0, 0, 4097, 4129, 260129,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    251265, 251297, 251329, 251361, 251393, 251425, 251457, 251489, 251521, 251553, 251553, 251585, 251681, 1, 4161, 251713,
+    4193, 251649, 251617, 4225, 1, 1, 4257, 251521, 0, 0, 0, 0, 0, 0, 0, 0,
+    431617, 431969, 432161, 432289, 432449, 432577, 432865, 432961, 432993, 433089, 433601, 433537, 433825, 434017, 433953, 434145,
+    434113, 434241, 434337, 434433, 434401, 434689, 434657, 434785, 434881, 435009, 435425, 0, 0, 0, 0, 433252,
+    432738, 432802, 433378, 4289, 4321, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 4353, 4385, 4417, 4449, 4481, 260161, 4513, 4545, 4577, 4609,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4641, 1, 0, 4673, 4705,
+    488289, 437089, 437249, 437345, 437569, 437665, 437857, 2147483674, 440961, 443425, 443521, 446273, 447937, 450273, 451265, 452321,
+    452449, 453313, 453761, 454561, 456993, 459777, 462049, 463649, 464801, 465249, 466657, 474049, 474081, 488193, 488225, 488257,
+    1, 467873, 469793, 471137, 474209, 477441, 479745, 482721, 2147483685, 485505, 2147483690, 252129, 252289, 252481, 252673, 252993,
+    253281, 253569, 253729, 253825, 253857, 253889, 253953, 253985, 254017, 254081, 254113, 254145, 254177, 254209, 254241, 253921,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 4737, 4769, 4801, 4833, 440897, 469729,
+    254529, 437473, 437441, 437761, 437121, 440578, 484386, 484898, 486018, 447297, 447457, 442561, 447617, 447649, 442721, 447681,
+    442881, 452033, 452065, 449473, 449633, 452097, 449793, 449985, 452641, 452737, 452769, 452801, 452833, 452929, 453057, 453153,
+    453185, 453889, 453985, 454017, 454049, 454081, 454113, 454145, 454177, 454273, 459489, 459521, 459553, 463521, 463585, 465185,
+    467649, 469121, 469185, 469249, 469281, 469473, 469505, 470977, 471041, 472897, 473057, 473089, 473121, 473185, 473345, 473409,
+    473601, 473633, 473793, 473825, 473985, 477217, 477249, 477281, 477313, 482593, 482209, 482369, 482529, 482561, 483553, 449953,
+    484034, 483713, 483874, 483937, 484577, 484609, 484705, 484801, 485025, 485121, 485217, 485249, 487777, 487937, 487969, 485377,
+    488001, 488161, 488449, 488546, 4865, 484001, 1, 1, 1, 1, 1, 1, 1, 1, 4897, 1,
+    1, 1, 1, 1, 1, 484257, 485825, 1, 1, 4929, 1, 1, 1, 1, 453217, 454305,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 459585, 463617, 467713, 437186, 477634, 483969,
+    4961, 4993, 5025, 5057, 5089, 5121, 5153, 5185, 5217, 5249, 5281, 5313, 5345, 5377, 0, 1,
+    488801, 254561, 488833, 488929, 488962, 489121, 489089, 489217, 489249, 489281, 489345, 489377, 489410, 489473, 489505, 489537,
+    489601, 489633, 489665, 489697, 489729, 489761, 489793, 489826, 489921, 489953, 489985, 490017, 490049, 488866, 489026, 489154,
+    254593, 254625, 254657, 254689, 254721, 254753, 254785, 254817, 254849, 254881, 254913, 254945, 254977, 255009, 255041, 255073,
+    1, 250209, 250241, 1, 1, 250209, 250241, 1, 1, 1, 1, 0, 0, 489313, 489569, 489889,
+    443041, 443073, 443105, 443137, 443169, 443201, 443265, 452129, 452161, 453249, 453281, 454337, 459617, 467745, 467777, 467809,
+    469665, 469697, 474017, 474113, 474145, 479649, 479681, 482625, 482657, 482689, 477345, 454369, 454401, 459649, 452193, 452225,
+    459681, 454433, 452257, 437793, 437825, 488321, 488353, 488385, 485409, 485441, 488737, 488769, 452289, 459713, 459745, 473153,
+    491233, 491329, 491361, 491393, 491457, 491489, 491521, 491553, 491649, 491713, 491745, 491777, 491841, 491969, 492001, 492065,
+    492097, 492225, 492257, 492289, 492321, 492353, 492385, 492417, 491873, 491265, 491297, 491809, 491425, 492129, 492161, 492193,
+    491905, 491937, 491585, 491617, 492033, 491681, 492481, 492513, 492545, 492577, 492609, 492641, 492673, 492705, 492737, 492769,
+    492801, 492449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 492833, 492865, 492897, 492929, 492961, 492993,
+    493025, 493057, 493089, 493121, 493153, 493185, 493217, 493313, 493409, 493441, 493537, 493569, 493601, 493633, 493665, 493697,
+    493729, 493761, 493793, 493825, 493857, 493889, 493921, 493953, 493250, 493346, 493474, 255105, 255137, 255169, 255201, 255233,
+    255265, 255297, 255329, 255361, 493985, 494017, 5409, 5441, 5473, 5505, 1, 0, 0, 250241, 260193, 260225,
+    436257, 436289, 436321, 436353, 436385, 436417, 436449, 436481, 436513, 436545, 436577, 436609, 436641, 436673, 436705, 436737,
+    436769, 436801, 436833, 436865, 436897, 436929, 436961, 436993, 252033, 252065, 437025, 437057, 251777, 251777, 251809, 251809,
+    251809, 251841, 251841, 251841, 251873, 251873, 251905, 251905, 251937, 251937, 251937, 251969, 252001, 252097, 0, 0,
+    5537, 5569, 5601, 5633, 5665, 5697, 5729, 5761, 5793, 5825, 5857, 5889, 5921, 5953, 5985, 0,
+    490433, 490465, 490497, 490529, 490561, 490593, 490625, 490657, 490689, 490721, 490753, 490785, 490817, 490849, 490881, 490913,
+    490945, 490977, 491009, 491041, 491073, 491105, 491137, 491169, 491201, 250241, 250241, 250241, 0, 0, 6017, 0,
+    490081, 490113, 490145, 490177, 490209, 490241, 490273, 490305, 490337, 490369, 490401, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    443233, 443329, 450145, 465217, 469441, 471105, 477377, 479713, 440193, 440225, 454465, 485473, 440257, 440321, 453025, 463553,
+    473569, 485345, 454497, 467841, 473377, 0, 443361, 443393, 447841, 454529, 488417, 469217, 471009, 482337, 443297, 447873,
+    447905, 450177, 474177, 467681, 471073, 450209, 450241, 477409, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 254273, 252897, 253217, 253505, 252257, 252449, 252641, 1, 1, 1, 1, 1, 1,
+    252225, 252417, 252609, 1, 252929, 252961, 253537, 254305, 254337, 254465, 254497, 254401, 254433, 254369, 253249, 254049,
+    255905, 255905, 255937, 255969, 510465, 510497, 510529, 510721, 510753, 510785, 510817, 510849, 510913, 510977, 511009, 511041,
+    511073, 511137, 511169, 511201, 511233, 511265, 511361, 511457, 511585, 511617, 511649, 511681, 511713, 511873, 511905, 511937,
+    511969, 512033, 512161, 512257, 512289, 512321, 512353, 512385, 512417, 512450, 512513, 512545, 512641, 512705, 512737, 512769,
+    512897, 512930, 512993, 513025, 513058, 513121, 513153, 513185, 513217, 513249, 513601, 513633, 255873, 513281, 513569, 513761,
+    513793, 513825, 513857, 513889, 513921, 514017, 514081, 514113, 514177, 514241, 514273, 514305, 514337, 514369, 514145, 513665,
+    510369, 1, 1, 249697, 249665, 514049, 513697, 513729, 511298, 511394, 511490, 511746, 512066, 512194, 512578, 512802,
+    510881, 510945, 513953, 513985, 6049, 6081, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    6113, 258689, 510433, 510561, 510593, 510625, 510657, 510689, 512001, 511809, 512865, 511553, 511841, 513313, 512129, 512673,
+    514401, 255905, 255937, 255969, 0, 514433, 514465, 514497, 514529, 514561, 514593, 514625, 514689, 0, 0, 514753,
+    514785, 0, 0, 514817, 514849, 514881, 514913, 514945, 514977, 515009, 515041, 515073, 515105, 515137, 515169, 515201,
+    515233, 515265, 515361, 515457, 515489, 515585, 515617, 515649, 515681, 0, 515713, 515745, 515777, 515809, 515841, 515873,
+    515969, 0, 516033, 0, 0, 0, 516097, 516129, 516161, 516193, 0, 0, 255873, 516225, 516257, 516289,
+    516321, 516353, 516385, 516417, 516449, 0, 0, 2147483695, 516577, 0, 0, 516609, 516641, 516673, 515522, 0,
+    0, 0, 0, 0, 0, 0, 0, 516705, 0, 0, 0, 0, 515298, 515394, 0, 515906,
+    514657, 514721, 516481, 516513, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    516001, 516065, 260257, 260289, 6145, 6177, 6209, 6241, 6273, 6305, 6337, 260321, 516737, 6369, 256001, 0,
+    0, 255905, 255937, 255969, 0, 516929, 516961, 517089, 517121, 516833, 516865, 0, 0, 0, 0, 517153,
+    516993, 0, 0, 516897, 517025, 517345, 517377, 517473, 517569, 517601, 517633, 517665, 517697, 517793, 517825, 517857,
+    517889, 517921, 517953, 517985, 518017, 518049, 518081, 518113, 518145, 0, 518177, 518209, 518305, 518337, 518369, 518401,
+    518465, 0, 518497, 518530, 0, 518593, 517218, 0, 517185, 517281, 0, 0, 255873, 0, 518657, 518689,
+    518721, 518753, 518785, 0, 0, 0, 0, 518817, 518849, 0, 0, 518881, 518913, 518945, 0, 0,
+    0, 517313, 0, 0, 0, 0, 0, 0, 0, 517410, 517506, 517730, 518625, 0, 518242, 0,
+    0, 0, 0, 0, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    256033, 256065, 517057, 516801, 516769, 518433, 6401, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 255905, 255937, 255969, 0, 519009, 519041, 519073, 519105, 519137, 519169, 519201, 519265, 519329, 0, 519361,
+    519393, 519425, 0, 519457, 519489, 519521, 519553, 519585, 519617, 519649, 519681, 519713, 519745, 519809, 519841, 519873,
+    519905, 519937, 519969, 520001, 520033, 520065, 520097, 520129, 520161, 0, 520193, 520225, 520257, 520289, 520321, 520353,
+    520385, 0, 520417, 520609, 0, 520449, 520481, 520513, 520545, 520577, 0, 0, 255873, 520641, 520673, 520705,
+    520737, 520769, 520801, 520833, 520865, 520961, 0, 520993, 521025, 521057, 0, 521089, 521121, 521153, 0, 0,
+    518977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    519233, 519297, 520897, 520929, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    6433, 260353, 0, 0, 0, 0, 0, 0, 0, 519777, 253729, 253569, 253825, 255873, 255873, 255873,
+    0, 255905, 255937, 255969, 0, 521185, 521217, 521249, 521281, 521313, 521345, 521377, 521441, 0, 0, 521505,
+    521537, 0, 0, 521569, 521601, 521633, 521665, 521697, 521729, 521761, 521793, 521825, 521857, 521889, 521921, 521953,
+    521985, 522017, 522113, 522209, 522241, 522273, 522305, 522337, 522369, 0, 522401, 522433, 522465, 522497, 522529, 522561,
+    522625, 0, 522657, 522689, 0, 522721, 522785, 522817, 522849, 522881, 0, 0, 255873, 522913, 522945, 522977,
+    523009, 523041, 523073, 523105, 523137, 0, 0, 2147483703, 523265, 0, 0, 523297, 523329, 523361, 0, 0,
+    0, 0, 0, 0, 0, 250209, 523393, 523425, 0, 0, 0, 0, 522050, 522146, 0, 522593,
+    521409, 521473, 523169, 523201, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    6465, 522753, 6497, 6529, 6561, 6593, 6625, 6657, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 255937, 523873, 0, 523489, 523521, 523553, 523585, 523617, 523649, 0, 0, 0, 523681, 523713,
+    523745, 0, 2147483714, 523809, 523841, 523905, 0, 0, 0, 523937, 523969, 0, 524481, 0, 524001, 524033,
+    0, 0, 0, 524065, 524097, 0, 0, 0, 524129, 524449, 524161, 0, 0, 0, 524193, 524225,
+    524257, 524417, 524289, 524385, 524353, 524321, 524513, 524545, 524577, 524609, 0, 0, 0, 0, 524641, 524673,
+    524705, 524737, 524769, 0, 0, 0, 2147483719, 2147483727, 524865, 0, 524897, 524929, 524961, 524993, 0, 0,
+    523457, 0, 0, 0, 0, 0, 0, 525025, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    6689, 6721, 6753, 6785, 6817, 6849, 6881, 6913, 6945, 260417, 6977, 0, 0, 0, 0, 0,
+    255905, 255905, 255937, 255969, 255937, 525057, 525089, 525121, 525153, 525185, 525217, 525249, 525313, 0, 525377, 525409,
+    525441, 0, 525473, 525505, 525537, 525569, 525601, 525633, 525665, 525697, 525729, 525793, 525825, 525889, 525921, 525953,
+    525985, 526017, 526049, 526081, 526113, 526145, 526177, 526209, 526241, 0, 526273, 526305, 526337, 526369, 526401, 526433,
+    526465, 526497, 526529, 526721, 526753, 526561, 526593, 526625, 526657, 526689, 0, 0, 0, 526817, 526849, 526881,
+    526913, 526945, 526977, 527009, 527041, 0, 2147483732, 527169, 527201, 0, 527233, 527265, 527297, 527329, 0, 0,
+    0, 0, 0, 0, 0, 527361, 527393, 0, 525761, 525857, 526785, 0, 0, 0, 0, 0,
+    525281, 525345, 527073, 527105, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    0, 0, 0, 0, 0, 0, 0, 7009, 261729, 262273, 269985, 274177, 262273, 269985, 274177, 7041,
+    529185, 255905, 255937, 255969, 7073, 527425, 527457, 527489, 527521, 527553, 527585, 527617, 527681, 0, 527745, 527777,
+    527809, 0, 527841, 527873, 527905, 527937, 527969, 528001, 528033, 528065, 528097, 528129, 528161, 528193, 528225, 528257,
+    528289, 528321, 528353, 528385, 528417, 528449, 528481, 528513, 528545, 0, 528577, 528609, 528641, 528673, 528705, 528737,
+    528769, 528801, 528833, 529025, 0, 528865, 528897, 528929, 528961, 528993, 0, 0, 255873, 529089, 529217, 2147483737,
+    529281, 529313, 529345, 529377, 529409, 0, 2147483742, 529537, 529569, 0, 2147483757, 529633, 529665, 529697, 0, 0,
+    0, 0, 0, 0, 0, 529729, 529761, 0, 0, 0, 0, 0, 0, 0, 529057, 0,
+    527649, 527713, 529441, 529473, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    0, 529121, 529153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255937, 255905, 255937, 255969, 532161, 529793, 529825, 529857, 529889, 529953, 529985, 530017, 530081, 0, 530145, 530177,
+    530209, 0, 530241, 530273, 530305, 530337, 530433, 530465, 530497, 530529, 530561, 530593, 530625, 530657, 530689, 530721,
+    530753, 530785, 530817, 530849, 530945, 530977, 531009, 531041, 531073, 531169, 531201, 531233, 531265, 531297, 531329, 531425,
+    531521, 532065, 531617, 531873, 531969, 531713, 531745, 531777, 531809, 531841, 532097, 532737, 532737, 532129, 532193, 532225,
+    532257, 532289, 532321, 532353, 532385, 0, 2147483762, 2147483770, 532545, 0, 532577, 532609, 532641, 532705, 531554, 7105,
+    0, 0, 0, 0, 531362, 531458, 532002, 532673, 7137, 7169, 7201, 7233, 7265, 7297, 7329, 529921,
+    530049, 530113, 532417, 532449, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    7361, 7393, 7425, 7457, 7489, 7521, 7553, 7585, 7617, 7649, 530882, 531106, 531554, 531650, 531906, 530370,
+    0, 255905, 255937, 255969, 0, 532769, 532801, 532833, 532865, 532897, 532929, 532961, 532993, 533025, 533057, 533089,
+    533121, 533153, 533185, 533217, 533249, 533281, 533313, 0, 0, 0, 533345, 533377, 533409, 533441, 533473, 533505,
+    533537, 533569, 533601, 533633, 533665, 533697, 533729, 533761, 533793, 533825, 533857, 533889, 533921, 533953, 533985, 534017,
+    534049, 534081, 0, 534113, 534145, 534177, 534209, 534241, 534273, 534305, 534337, 534369, 0, 534401, 0, 0,
+    534433, 534465, 534497, 534529, 534561, 534593, 534625, 0, 0, 0, 535201, 0, 0, 0, 0, 534657,
+    534689, 534721, 534753, 534785, 534817, 0, 534849, 0, 534881, 2147483775, 535041, 535073, 2147483790, 535137, 535169, 534945,
+    0, 0, 0, 0, 0, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    0, 0, 534913, 534977, 7681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 581025, 581057, 581089, 581121, 581153, 581185, 581217, 581249, 581281, 581313, 581345, 581377, 581409, 581441, 581473,
+    581505, 581537, 581569, 581601, 581633, 581665, 581697, 581729, 581761, 581793, 581825, 581857, 581889, 581921, 581953, 581985,
+    582017, 582049, 582081, 582113, 582145, 582177, 582209, 582241, 582273, 582305, 582337, 582369, 582401, 582433, 582465, 582497,
+    582529, 582561, 582593, 582625, 582657, 582689, 582721, 582753, 582785, 582817, 582849, 0, 0, 0, 0, 260577,
+    2147483795, 2147483935, 2147484075, 2147484215, 2147484355, 583041, 258721, 256449, 256481, 256513, 256545, 256577, 256609, 2147484495, 256417, 7713,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 7745, 7777, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 583105, 583137, 0, 583169, 0, 583201, 583233, 583265, 583297, 583361, 0, 583393, 583489, 583425, 583521,
+    583553, 583585, 583617, 583649, 583681, 583713, 583745, 583777, 583809, 583841, 583873, 583905, 583937, 583969, 584001, 584033,
+    584065, 584097, 584129, 584161, 0, 584193, 0, 584225, 584257, 584289, 583329, 584321, 584481, 584513, 584545, 584577,
+    584609, 584641, 584673, 584705, 584737, 584769, 584801, 584833, 584865, 584897, 584929, 584961, 584993, 585025, 0, 0,
+    2147484500, 2147484637, 2147484774, 2147484911, 2147485048, 0, 258753, 0, 256673, 256705, 256737, 256769, 256801, 2147485185, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 584354, 584418, 583073, 583457,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    590659, 7809, 7841, 7873, 7905, 7937, 7969, 8001, 8033, 8065, 8097, 8129, 8161, 8193, 8225, 8257,
+    8289, 8321, 8353, 8385, 8417, 8449, 8481, 8513, 1, 1, 8545, 8577, 8609, 8641, 8673, 8705,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 262337, 270049, 274241, 276353, 277953, 279105,
+    280065, 281121, 282049, 261793, 8737, 1, 8769, 1, 8801, 256929, 8833, 8865, 8897, 8929, 1, 1,
+    587361, 587585, 587649, 587682, 587841, 587905, 587969, 588033, 0, 588097, 588161, 588225, 588289, 588322, 588481, 588545,
+    588609, 588673, 588706, 588865, 588929, 588993, 589057, 589090, 589249, 589313, 589377, 589441, 589474, 589633, 589761, 589825,
+    589889, 589953, 590081, 590305, 590369, 590433, 590497, 590561, 590625, 587394, 590114, 587553, 590273, 0, 0, 0,
+    0, 2147485190, 591073, 591105, 591201, 591233, 591265, 591297, 591329, 591361, 591393, 591425, 591457, 591489, 255937, 255969,
+    591137, 591169, 1, 1, 591521, 8961, 1, 1, 590785, 590849, 590977, 591009, 590913, 590817, 590881, 590945,
+    587457, 587617, 587745, 587778, 587873, 587937, 588001, 588065, 0, 588129, 588193, 588257, 588385, 588418, 588513, 588577,
+    588641, 588769, 588802, 588897, 588961, 589025, 589153, 589186, 589281, 589345, 589409, 589537, 589570, 589665, 589793, 589857,
+    589921, 589985, 2147485201, 2147485213, 590401, 590465, 590529, 590593, 590753, 587490, 589698, 590018, 590210, 0, 8993, 9025,
+    9057, 9089, 9121, 9153, 9185, 9217, 1, 9249, 9281, 9313, 9345, 9377, 9409, 0, 9441, 9473,
+    9505, 9537, 9569, 9601, 9633, 9665, 9697, 9729, 9761, 9793, 9825, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    610913, 610977, 611041, 611169, 611265, 611329, 611425, 611553, 611713, 611937, 612065, 612097, 612161, 612225, 612321, 612417,
+    612545, 612577, 612609, 612705, 612801, 612929, 612961, 613153, 613249, 613345, 613409, 613473, 613601, 613665, 613889, 614049,
+    614241, 614465, 614497, 614529, 614561, 2147485225, 614625, 614785, 614817, 614849, 614881, 614945, 614913, 615073, 615137, 615201,
+    615297, 615457, 615585, 615169, 615649, 615521, 255937, 257057, 255969, 615841, 615873, 613441, 613569, 613697, 614145, 613923,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 9857, 9889, 9921, 9953, 9985, 10017,
+    613793, 613825, 614657, 614689, 614721, 614753, 615329, 615361, 615393, 615425, 611297, 611745, 614305, 614337, 612897, 613377,
+    613633, 611873, 615681, 615905, 615937, 613857, 614433, 615713, 615745, 615969, 616001, 616033, 616065, 616097, 612449, 614369,
+    614401, 615105, 615009, 615233, 615265, 610945, 611009, 611073, 611361, 611649, 611969, 612641, 612833, 612993, 613025, 613185,
+    613761, 614081, 613729, 614977, 615489, 615553, 615809, 616129, 616193, 616289, 616321, 616161, 616225, 616257, 613089, 616353,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 616385, 616417, 615041, 615617, 10049, 10081,
+    423265, 423393, 423521, 423649, 423777, 423905, 424033, 424289, 424417, 424545, 424673, 424801, 424961, 425217, 425345, 425473,
+    425601, 425729, 425857, 426113, 426241, 426369, 426497, 426625, 426753, 426881, 427009, 427137, 427265, 427393, 427521, 427777,
+    427905, 424161, 425089, 425985, 427649, 428033, 0, 428225, 0, 0, 0, 0, 0, 428545, 0, 0,
+    423169, 423297, 423425, 423553, 423681, 423809, 423937, 424193, 424321, 424449, 424577, 424705, 424833, 425121, 425249, 425377,
+    425505, 425633, 425761, 426017, 426145, 426273, 426401, 426529, 426657, 426785, 426913, 427041, 427169, 427297, 427425, 427681,
+    427809, 424065, 424993, 425889, 427553, 427937, 428065, 428129, 428257, 428321, 428385, 10113, 424897, 428449, 428577, 428641,
+    724065, 724481, 724577, 724993, 725409, 725505, 725921, 726337, 726753, 726849, 727265, 727361, 728257, 728929, 729025, 729601,
+    730017, 730433, 730849, 731265, 731297, 731361, 731425, 731457, 731489, 731521, 731553, 731649, 731681, 731745, 731809, 731873,
+    731905, 731969, 732065, 732129, 732193, 732225, 732257, 732289, 732353, 732385, 732449, 732481, 732545, 732609, 732673, 732737,
+    732801, 732833, 732865, 732929, 732961, 732993, 733025, 733089, 733121, 733153, 733185, 733217, 733249, 733281, 733313, 733345,
+    733377, 733441, 733473, 733505, 733537, 733569, 733601, 733633, 733697, 733729, 733761, 733793, 733825, 733889, 733921, 733953,
+    733985, 734017, 734049, 734081, 734113, 734145, 734177, 734209, 734273, 734337, 734401, 734433, 734465, 734497, 734529, 735489,
+    735521, 735617, 735713, 735809, 735905, 736001, 736097, 736193, 736289, 736385, 736481, 736577, 736673, 736769, 736865, 736961,
+    737057, 737153, 737249, 737345, 737441, 737537, 737633, 737665, 737697, 737729, 737761, 737793, 737825, 737857, 737889, 737921,
+    737953, 737985, 738017, 738049, 738081, 738145, 738209, 738241, 738273, 738337, 738369, 738401, 738433, 738465, 738497, 738529,
+    738561, 738593, 738657, 738721, 738753, 738817, 738849, 738881, 738913, 738945, 738977, 739009, 739041, 739073, 739105, 739169,
+    739201, 739233, 739297, 739329, 739361, 739393, 739425, 739457, 740225, 740257, 740289, 740385, 740417, 740513, 740609, 740641,
+    740673, 740769, 740865, 740961, 741057, 741153, 741249, 741281, 741313, 741345, 741377, 741409, 741441, 741473, 741505, 741537,
+    741569, 741601, 741633, 741665, 741697, 741729, 741761, 741793, 741857, 741921, 741953, 741985, 742017, 742081, 742113, 742177,
+    742209, 742241, 742273, 742305, 742369, 742401, 742433, 742465, 742529, 742561, 742625, 742657, 742689, 742721, 742785, 742817,
+    742881, 742913, 742945, 742977, 743009, 743041, 743073, 743105, 743137, 743169, 743201, 743233, 743265, 743297, 743329, 743361,
+    743393, 743425, 743489, 743553, 743585, 743617, 743649, 743681, 743713, 743745, 743777, 743809, 743841, 743873, 743905, 743937,
+    495873, 495905, 495937, 495969, 496001, 496033, 496065, 496097, 496129, 496161, 496193, 496225, 496257, 496289, 496321, 496353,
+    496417, 496449, 496481, 496513, 496545, 496577, 496609, 496641, 496673, 496705, 496737, 496769, 496801, 496833, 496865, 496897,
+    497089, 497121, 497153, 497185, 497217, 497249, 497281, 497313, 497345, 497377, 497409, 497441, 497473, 497505, 497537, 497569,
+    497633, 497665, 497697, 497729, 497761, 497793, 497825, 497857, 498113, 498145, 498177, 498209, 498241, 498273, 498305, 498337,
+    498401, 498433, 498465, 498497, 498529, 498561, 498593, 498625, 498657, 0, 498689, 498721, 498753, 498785, 0, 0,
+    498817, 498849, 498881, 498913, 498945, 498977, 499009, 0, 499041, 0, 499073, 499105, 499137, 499169, 0, 0,
+    499201, 499233, 499265, 499297, 499329, 499361, 499393, 499425, 499617, 499649, 499681, 499713, 499745, 499777, 499809, 499841,
+    499873, 499905, 499937, 499969, 500001, 500033, 500065, 500097, 500161, 500193, 500225, 500257, 500289, 500321, 500353, 500385,
+    500449, 500481, 500513, 500545, 500577, 500609, 500641, 500673, 500705, 0, 500737, 500769, 500801, 500833, 0, 0,
+    500865, 500897, 500929, 500961, 500993, 501025, 501057, 501089, 501153, 501185, 501217, 501249, 501281, 501313, 501345, 501377,
+    501441, 501473, 501505, 501537, 501569, 501601, 501633, 501665, 501729, 501761, 501793, 501825, 501857, 501889, 501921, 501953,
+    501985, 0, 502017, 502049, 502081, 502113, 0, 0, 502145, 502177, 502209, 502241, 502273, 502305, 502337, 0,
+    502369, 0, 502401, 502433, 502465, 502497, 0, 0, 502529, 502561, 502593, 502625, 502657, 502689, 502721, 502753,
+    502785, 502817, 502849, 502881, 502913, 502945, 502977, 0, 503009, 503041, 503073, 503105, 503137, 503169, 503201, 503233,
+    503489, 503521, 503553, 503585, 503617, 503649, 503681, 503713, 503745, 503777, 503809, 503841, 503873, 503905, 503937, 503969,
+    504001, 504033, 504065, 504097, 504129, 504161, 504193, 504225, 504481, 504513, 504545, 504577, 504609, 504641, 504673, 504705,
+    504769, 504801, 504833, 504865, 504897, 504929, 504961, 504993, 505057, 505089, 505121, 505153, 505185, 505217, 505249, 505281,
+    505313, 0, 505345, 505377, 505409, 505441, 0, 0, 505473, 505505, 505537, 505569, 505601, 505633, 505665, 505697,
+    505857, 505889, 505921, 505953, 505985, 506017, 506049, 506081, 506145, 506177, 506209, 506241, 506273, 506305, 506337, 506369,
+    506657, 506689, 506721, 506753, 506785, 506817, 506849, 506881, 506945, 506977, 507009, 507041, 507073, 507105, 507137, 507169,
+    507425, 507457, 507489, 507521, 507553, 507585, 507617, 507649, 507681, 507713, 507745, 507777, 507809, 507841, 507873, 507905,
+    508065, 508097, 508129, 508161, 508193, 508225, 508257, 508289, 508481, 508513, 508545, 0, 0, 255457, 255425, 255393,
+    10145, 10177, 10209, 10241, 10273, 10305, 10337, 10369, 10401, 262273, 269985, 274177, 276289, 277889, 279041, 280001,
+    281057, 281985, 10433, 10465, 10497, 10529, 10561, 10593, 10625, 10657, 10689, 10721, 10753, 0, 0, 0,
+    496929, 496961, 496993, 497025, 499457, 499489, 499521, 499553, 507937, 507969, 508001, 508033, 508321, 508353, 508385, 508417,
+    10785, 10817, 10849, 10881, 10913, 10945, 10977, 11009, 11041, 11073, 0, 0, 0, 0, 0, 0,
+    639713, 639777, 639841, 639905, 639969, 640033, 640097, 640161, 640225, 640289, 640353, 640417, 640481, 640545, 640609, 640673,
+    640737, 640801, 640865, 640929, 640993, 641057, 641121, 641185, 641249, 641313, 641377, 641441, 641505, 641569, 641633, 641697,
+    641761, 641825, 641889, 641953, 642017, 642081, 642145, 642209, 642273, 642337, 642401, 642465, 642529, 642593, 642657, 642721,
+    642785, 642849, 642913, 642977, 643041, 643105, 643169, 643233, 643297, 643361, 643425, 643489, 643553, 643617, 643681, 643745,
+    643809, 643873, 643937, 644001, 644065, 644129, 644193, 644257, 644321, 644385, 644449, 644513, 644577, 644641, 644705, 644769,
+    644833, 644897, 644961, 645025, 645089, 645153, 0, 0, 644801, 644865, 644929, 644993, 645057, 645121, 0, 0,
+    11105, 647489, 647521, 647553, 647585, 647617, 647649, 647681, 647713, 647745, 647777, 647809, 647841, 647873, 647905, 647937,
+    647969, 648001, 648033, 648065, 648097, 648129, 648161, 648193, 648225, 648257, 648289, 648321, 648353, 648385, 648417, 648449,
+    648481, 648513, 648545, 648577, 648609, 648641, 648673, 648705, 648737, 648769, 648801, 648833, 648865, 648897, 648929, 648961,
+    648993, 649025, 649057, 649089, 649121, 649153, 649185, 649217, 649249, 649281, 649313, 649345, 649377, 649409, 649441, 649473,
+    649505, 649537, 649569, 649601, 649633, 649665, 649697, 649729, 649761, 649793, 649825, 649857, 649889, 649921, 649953, 649985,
+    650017, 650049, 650081, 650113, 650145, 650177, 650209, 650241, 650273, 650305, 650337, 650369, 650401, 650433, 650465, 650497,
+    650529, 650561, 650593, 650625, 650657, 650689, 650721, 650753, 650785, 650817, 650849, 650881, 650913, 650945, 650977, 651009,
+    651041, 651073, 651105, 651137, 651169, 651201, 651233, 651265, 651297, 651329, 651361, 651393, 651425, 651457, 651489, 651521,
+    651553, 651585, 651617, 651649, 651681, 651713, 651745, 651777, 651809, 651841, 651873, 651905, 651937, 651969, 652001, 652033,
+    652065, 652097, 652129, 652161, 652193, 652225, 652257, 652289, 652321, 652353, 652385, 652417, 652449, 652481, 652513, 652545,
+    652577, 652609, 652641, 652673, 652705, 652737, 652769, 652801, 652833, 652865, 652897, 652929, 652961, 652993, 653025, 653057,
+    653089, 653121, 653153, 653185, 653217, 653249, 653281, 653313, 653345, 653377, 653409, 653441, 653473, 653505, 653537, 653569,
+    653601, 653633, 653665, 653697, 653729, 653761, 653793, 653825, 653857, 653889, 653921, 653953, 653985, 654017, 654049, 654081,
+    654113, 654145, 654177, 654209, 654241, 654273, 654305, 654337, 654369, 654401, 654433, 654465, 654497, 654529, 654561, 654593,
+    654625, 654657, 654689, 654721, 654753, 654785, 654817, 654849, 654881, 654913, 654945, 654977, 655009, 655041, 655073, 655105,
+    655137, 655169, 655201, 655233, 655265, 655297, 655329, 655361, 655393, 655425, 655457, 655489, 655521, 655553, 655585, 655617,
+    655649, 655681, 655713, 655745, 655777, 655809, 655841, 655873, 655905, 655937, 655969, 656001, 656033, 656065, 656097, 656129,
+    656161, 656193, 656225, 656257, 656289, 656321, 656353, 656385, 656417, 656449, 656481, 656513, 656545, 656577, 656609, 656641,
+    656673, 656705, 656737, 656769, 656801, 656833, 656865, 656897, 656929, 656961, 656993, 657025, 657057, 657089, 657121, 657153,
+    657185, 657217, 657249, 657281, 657313, 657345, 657377, 657409, 657441, 657473, 657505, 657537, 657569, 657601, 657633, 657665,
+    657697, 657729, 657761, 657793, 657825, 657857, 657889, 657921, 657953, 657985, 658017, 658049, 658081, 658113, 658145, 658177,
+    658209, 658241, 658273, 658305, 658337, 658369, 658401, 658433, 658465, 658497, 658529, 658561, 658593, 658625, 658657, 658689,
+    658721, 658753, 658785, 658817, 658849, 658881, 658913, 658945, 658977, 659009, 659041, 659073, 659105, 659137, 659169, 659201,
+    659233, 659265, 659297, 659329, 659361, 659393, 659425, 659457, 659489, 659521, 659553, 659585, 661217, 659617, 659681, 659713,
+    659745, 659777, 659809, 659841, 659873, 659905, 659937, 659969, 660001, 660033, 660065, 660097, 660129, 660161, 660225, 660257,
+    660289, 660321, 660353, 660385, 660417, 660449, 660673, 660705, 660737, 660769, 660801, 660833, 660865, 660897, 660929, 660961,
+    660993, 661025, 661057, 661089, 661121, 661153, 661185, 661249, 661281, 661313, 661345, 661377, 661409, 661441, 661473, 661505,
+    661537, 661569, 661601, 661633, 661665, 661697, 661729, 661761, 661793, 661825, 661857, 661889, 661921, 661953, 661985, 662017,
+    662049, 662081, 662113, 662145, 662177, 662209, 662241, 662273, 662305, 662337, 662369, 662401, 662433, 662465, 662497, 662529,
+    662561, 662593, 662625, 662657, 662689, 662721, 662753, 662785, 662817, 662849, 662881, 662913, 662945, 662977, 663009, 663041,
+    663073, 663105, 663137, 663169, 663201, 663233, 663265, 663297, 663329, 663361, 663393, 663425, 663457, 663489, 663521, 663553,
+    663585, 663617, 663649, 663681, 663713, 663745, 663777, 663809, 663841, 663873, 663905, 663937, 663969, 664001, 664033, 664065,
+    664097, 664129, 664161, 664193, 664225, 664257, 664289, 664321, 664353, 664385, 664417, 664449, 664481, 664513, 664545, 664577,
+    664609, 664641, 664673, 664705, 664737, 664769, 664801, 664833, 664865, 664897, 664929, 664961, 664993, 665025, 665057, 665089,
+    665121, 665153, 665185, 665217, 665249, 665281, 665313, 665345, 665377, 665409, 665441, 665473, 665505, 665537, 665569, 665601,
+    665633, 665665, 665697, 665729, 665761, 665793, 665825, 665857, 665889, 665921, 665953, 665985, 666017, 666049, 666081, 666113,
+    666145, 666177, 666209, 666241, 666273, 666305, 666337, 666369, 666401, 666433, 666465, 666497, 666529, 666561, 666593, 666625,
+    666657, 666689, 666721, 666753, 666785, 666817, 666849, 666881, 666913, 666945, 666977, 667009, 667041, 667073, 667105, 667137,
+    667169, 667201, 667233, 667265, 667297, 667329, 667361, 667393, 667425, 667457, 667489, 667521, 667553, 11137, 11169, 659649,
+    660193, 660481, 660513, 660545, 660577, 660609, 660641, 667585, 667617, 667649, 667681, 667713, 667745, 667777, 667809, 667841,
+    11201, 670113, 670145, 670177, 670209, 670241, 670273, 670305, 670337, 670369, 670401, 670433, 670465, 670497, 670529, 670561,
+    670593, 670625, 670657, 670689, 670721, 670753, 670785, 670817, 670849, 670881, 670913, 11233, 11265, 0, 0, 0,
+    670945, 670978, 671041, 674625, 671074, 671138, 671201, 671234, 671361, 671394, 674497, 674561, 671458, 671522, 671586, 671681,
+    671713, 671745, 671777, 671810, 671874, 671938, 672002, 672097, 674721, 672129, 672225, 672258, 672322, 672386, 672449, 672482,
+    672546, 672609, 672642, 672737, 672770, 672833, 672866, 672993, 673025, 673121, 673153, 673186, 673314, 673378, 673442, 673537,
+    673570, 673634, 673697, 673730, 673794, 673058, 673857, 673921, 673954, 674018, 674209, 674242, 674305, 674338, 674401, 674433,
+    674657, 674785, 674817, 674689, 674753, 674849, 674881, 674914, 674978, 672162, 673250, 11297, 11329, 11361, 672930, 674084,
+    671298, 672065, 673505, 674465, 671649, 672705, 673889, 674529, 674593, 0, 0, 0, 0, 0, 0, 0,
+    603009, 603041, 603073, 603105, 603137, 603169, 603201, 603233, 603265, 603297, 603329, 603361, 603393, 0, 603425, 603457,
+    603489, 603521, 603553, 603585, 603617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    603649, 603681, 603713, 603745, 603777, 603809, 603841, 603873, 603905, 603937, 603969, 604001, 604033, 604065, 604097, 604129,
+    604161, 604193, 604225, 604257, 604289, 11393, 11425, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    604321, 604353, 604385, 604417, 604449, 604481, 604513, 604545, 604577, 604609, 604641, 604673, 604705, 604737, 604769, 604801,
+    604833, 604865, 604897, 604929, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    604961, 604993, 605025, 605057, 605089, 605121, 605153, 605185, 605217, 605249, 605281, 605313, 605345, 0, 605377, 605409,
+    605441, 0, 605473, 605505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    619521, 619553, 619585, 619617, 619649, 619681, 619713, 619745, 619777, 619809, 619841, 619873, 619905, 619937, 619969, 620001,
+    620033, 620065, 620097, 620129, 620161, 620193, 620225, 620257, 620289, 620321, 620353, 620385, 620417, 620449, 620481, 620513,
+    620545, 620577, 620609, 620673, 620705, 620737, 620769, 620801, 620833, 620865, 620897, 620929, 620961, 620993, 621025, 621057,
+    621089, 621121, 621153, 621185, 1, 1, 621217, 621249, 621281, 621313, 621345, 621377, 621409, 621441, 621473, 621505,
+    621537, 621569, 621601, 621633, 621665, 621697, 255937, 255969, 257089, 257121, 257153, 250209, 250209, 250209, 250209, 250209,
+    250209, 250209, 621729, 1, 11457, 11489, 11521, 258785, 11553, 11585, 11617, 260609, 620641, 250209, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    11649, 11681, 11713, 11745, 11777, 11809, 11841, 11873, 11905, 11937, 1, 1, 1, 1, 1, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    634561, 634625, 634721, 634913, 634977, 635073, 635137, 635233, 635265, 635297, 635457, 635521, 635617, 635681, 635841, 635905,
+    635937, 635969, 636193, 636289, 636385, 636577, 636705, 636801, 636865, 636929, 637025, 637185, 637217, 637313, 637441, 637537,
+    637569, 637601, 637633, 634529, 634657, 634753, 634945, 635009, 635105, 635169, 635329, 635489, 635553, 635649, 635713, 635873,
+    636225, 636321, 636417, 636609, 637249, 636737, 636897, 637057, 637377, 637473, 637665, 637697, 636513, 634689, 634785, 634881,
+    635201, 635041, 635361, 637089, 635745, 635809, 635585, 636001, 636257, 636353, 636641, 636961, 637409, 637505, 637281, 637345,
+    637729, 636449, 636769, 634817, 637121, 636833, 636993, 636673, 636481, 0, 0, 0, 0, 0, 0, 0,
+    634305, 634337, 634369, 634401, 634433, 634465, 634497, 634593, 634849, 637153, 635393, 636545, 637761, 637825, 637857, 637921,
+    637953, 638049, 638113, 638145, 638209, 638273, 638337, 638369, 637985, 638305, 635777, 635425, 636033, 636065, 637793, 637889,
+    638017, 638081, 636097, 638241, 636129, 636161, 638401, 638433, 638177, 638497, 638465, 0, 0, 0, 0, 0,
+    667873, 667905, 667937, 667969, 668001, 668033, 668065, 668097, 668129, 668161, 668193, 668225, 668257, 668289, 668321, 668353,
+    668385, 668417, 668449, 668481, 668513, 668545, 668577, 668609, 668641, 668673, 668705, 668737, 668769, 668801, 668833, 668865,
+    668897, 668929, 668961, 668993, 669025, 669057, 669089, 669121, 669153, 669185, 669217, 669249, 669281, 669313, 669345, 669377,
+    669409, 669441, 669473, 669505, 669537, 669569, 669601, 669633, 669665, 669697, 669729, 669761, 669793, 669825, 669857, 669889,
+    669921, 669953, 669985, 670017, 670049, 670081, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    601281, 601313, 601345, 601377, 601409, 601441, 601473, 601505, 601537, 601633, 601665, 601697, 601793, 601825, 601857, 601889,
+    601921, 601953, 601985, 602017, 602049, 602081, 602113, 602145, 602177, 602209, 602241, 602273, 602305, 601570, 601730, 0,
+    602337, 602369, 602401, 602433, 602465, 602497, 602529, 602561, 602593, 602625, 602657, 602689, 0, 0, 0, 0,
+    602721, 602753, 602785, 602817, 602849, 602881, 602913, 602945, 602977, 257441, 257473, 257505, 0, 0, 0, 0,
+    11969, 0, 0, 0, 12001, 12033, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    621761, 621793, 621825, 621857, 621889, 621921, 621953, 621985, 622017, 622049, 622081, 622113, 622145, 622177, 622209, 622241,
+    622273, 622305, 622337, 622369, 622401, 622433, 622465, 622497, 622529, 622561, 622593, 622625, 622657, 622689, 0, 0,
+    622721, 622753, 622785, 622817, 622849, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    622881, 622913, 622945, 622977, 623009, 623041, 623073, 623105, 623137, 623169, 623201, 623233, 623265, 623297, 623329, 623361,
+    623393, 623425, 623457, 623489, 623521, 623553, 623585, 623617, 623649, 623681, 623713, 623745, 623777, 623969, 624001, 624033,
+    624065, 624097, 624129, 624161, 624193, 624225, 624257, 624289, 624321, 624353, 624385, 624417, 0, 0, 0, 0,
+    624449, 624481, 624513, 624545, 624577, 2147485230, 2147485364, 2147485498, 624705, 624737, 2147485632, 624801, 624833, 624865, 624897, 624929,
+    624961, 624993, 625025, 625057, 625089, 625121, 625153, 625185, 625217, 625249, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 262273, 0, 0, 0, 623810, 623875,
+    12065, 12097, 12129, 12161, 12193, 12225, 12257, 12289, 12321, 12353, 12385, 12417, 12449, 12481, 12513, 12545,
+    12577, 12609, 12641, 12673, 12705, 12737, 12769, 12801, 12833, 12865, 12897, 12929, 12961, 12993, 13025, 13057,
+    605537, 605569, 605601, 605633, 605665, 605697, 605729, 605761, 605793, 605825, 605857, 605889, 605921, 605953, 605985, 606017,
+    606049, 606081, 606113, 606145, 606177, 606209, 606241, 606273, 606305, 606337, 606369, 606401, 0, 0, 13089, 13121,
+    625281, 625313, 625345, 625377, 625409, 625441, 625473, 625537, 625569, 625601, 625633, 625665, 625697, 625729, 625761, 625793,
+    625825, 625857, 625889, 625921, 625953, 625985, 626017, 626049, 626081, 626113, 626145, 626177, 626241, 626273, 626305, 626337,
+    626369, 626401, 626433, 626465, 626497, 626529, 626561, 626689, 626721, 626753, 626785, 626817, 626849, 627137, 627169, 627201,
+    627233, 627265, 627297, 626881, 626595, 626945, 626977, 627009, 625505, 625505, 626209, 626209, 627041, 627073, 627105, 0,
+    627905, 627329, 627393, 627425, 627457, 627489, 627521, 627553, 627585, 627617, 627649, 626913, 627361, 627873, 627681, 627713,
+    627777, 627809, 627841, 627745, 255937, 257185, 257217, 257249, 257281, 257313, 257345, 257377, 257409, 0, 0, 1,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    13153, 13185, 13217, 13249, 13281, 13313, 13345, 258817, 13377, 13409, 13441, 13473, 13505, 13537, 0, 0,
+    250209, 250209, 250209, 250209, 250209, 250241, 250241, 250241, 250241, 250241, 250241, 250209, 250209, 250241, 250305, 363425,
+    365121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255905, 255905, 255937, 256097, 255969, 2147485766, 630177, 2147485771, 630241, 2147485776, 630305, 2147485781, 630369, 2147485786, 630433, 630465,
+    630497, 2147485791, 630561, 630593, 630689, 630721, 630753, 630785, 630817, 630849, 630881, 630913, 630945, 630977, 631009, 631041,
+    631073, 631105, 631137, 631201, 631233, 631265, 631297, 631329, 631393, 631425, 631457, 631489, 631521, 631553, 631585, 631617,
+    631681, 631713, 631745, 631841, 255873, 631873, 631905, 631937, 631969, 632001, 2147485796, 632065, 2147485801, 632129, 2147485806, 2147485811,
+    632225, 632257, 2147485816, 632321, 632353, 630625, 630657, 631169, 631361, 631649, 631777, 631809, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 13569, 13601, 13633, 13665, 13697, 13729,
+    13761, 13793, 13825, 13857, 13889, 13921, 13953, 13985, 14017, 14049, 14081, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 14113, 14145, 14177, 14209, 14241, 14273, 14305, 14337, 14369, 0, 0, 0,
+    255937, 256161, 255969, 573857, 573921, 573953, 573985, 574017, 574049, 574081, 574113, 574209, 574241, 574273, 574305, 574337,
+    574369, 574401, 574433, 574465, 574497, 574529, 574561, 574593, 574625, 574689, 574785, 574849, 574945, 575041, 575105, 575137,
+    575201, 574817, 574881, 574977, 575233, 575265, 575297, 575329, 575361, 575393, 575425, 575457, 574753, 575073, 574177, 575169,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 573889, 574913, 575009, 574657, 574145, 574721,
+    607169, 607201, 607233, 607265, 607265, 607297, 607329, 607361, 607393, 607425, 607457, 607489, 607521, 607521, 607553, 607585,
+    607617, 607649, 607681, 607713, 607745, 607777, 607809, 607841, 607873, 607905, 607905, 607937, 607969, 608001, 608033, 608065,
+    608097, 608129, 608161, 608193, 608225, 608257, 255873, 608289, 608321, 608353, 608385, 608417, 608449, 608481, 608513, 608545,
+    608577, 608609, 608641, 608673, 0, 0, 0, 0, 0, 0, 0, 0, 14401, 14433, 14465, 14497,
+    597761, 597793, 597825, 597857, 597889, 597921, 597953, 597985, 598017, 598049, 598177, 598209, 598241, 598273, 598305, 598337,
+    598369, 598401, 598433, 598465, 598497, 598529, 598561, 598593, 598625, 598657, 598689, 598753, 598817, 598849, 598881, 598913,
+    598945, 598977, 599009, 599041, 598721, 598785, 599105, 599137, 599169, 599201, 599233, 599265, 599297, 599329, 599361, 599393,
+    599425, 599457, 599489, 599521, 599553, 599585, 599073, 255873, 0, 0, 0, 14529, 14561, 14593, 14625, 14657,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 598081, 598113, 598145,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 638529, 638561, 638593, 638625, 638657, 638689,
+    638721, 638753, 638785, 638817, 638849, 638881, 638913, 638945, 638977, 639009, 639041, 639073, 639105, 639137, 639169, 639201,
+    639233, 639265, 639297, 639329, 639361, 639393, 639425, 639457, 639489, 639521, 639553, 639585, 639617, 639649, 14689, 14721,
+    403489, 404193, 409921, 410881, 411169, 411169, 414945, 415553, 412321, 0, 0, 0, 0, 0, 0, 0,
+    423201, 423329, 423457, 423585, 423713, 423841, 423969, 424225, 424353, 424481, 424609, 424737, 424865, 425153, 425281, 425409,
+    425537, 425665, 425793, 426049, 426177, 426305, 426433, 426561, 426689, 426817, 426945, 427073, 427201, 427329, 427457, 427713,
+    427841, 424097, 425025, 425921, 427585, 427969, 428097, 428161, 428289, 428353, 428417, 0, 0, 428481, 428609, 428673,
+    14753, 14785, 14817, 14849, 14881, 14913, 14945, 14977, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 513345, 513377, 513377, 513377, 255937, 513377, 513377,
+    513377, 513377, 255969, 255969, 1, 513409, 513441, 1, 1, 1, 513377, 0, 0, 0, 0, 0,
+    290433, 290625, 290657, 292385, 295457, 299009, 299041, 303969, 304897, 316737, 317985, 320833, 324353, 328161, 331297, 339041,
+    339521, 339073, 339553, 339361, 339169, 340257, 339745, 339809, 342177, 346369, 346561, 353889, 359905, 360001, 360065, 360865,
+    362913, 364929, 370081, 370881, 372769, 372801, 378145, 387745, 390273, 390881, 394369, 408481, 283329, 288579, 291681, 292353,
+    296513, 300065, 304289, 307553, 310337, 313473, 317697, 318817, 321857, 325857, 329057, 331265, 332449, 340225, 340833, 344097,
+    352033, 354945, 363873, 283265, 290817, 290945, 290689, 291649, 296449, 300001, 304449, 304641, 304929, 307521, 316769, 318753,
+    325793, 331841, 332385, 339489, 339777, 339841, 340769, 351969, 354881, 360033, 360801, 361601, 372833, 377889, 378081, 378305,
+    393985, 394177, 313441, 344065, 354913, 361633, 377921, 378113, 390657, 394017, 394209, 360097, 292417, 299137, 306817, 328225,
+    331329, 342337, 346465, 346913, 350881, 354049, 370177, 309537, 409345, 308610, 353315, 316897, 317153, 342209, 360385, 361057,
+    292513, 299169, 306849, 309409, 320865, 324897, 328257, 331585, 342369, 346625, 350913, 351329, 363009, 366369, 370209, 290529,
+    291009, 299329, 304129, 304673, 304865, 304513, 316961, 339617, 351425, 360417, 370977, 291105, 293345, 295777, 297570, 304833,
+    305633, 318209, 309217, 360641, 316865, 317121, 316641, 316929, 318145, 324993, 324929, 324257, 328353, 360929, 331425, 331649,
+    331233, 339969, 342657, 351009, 351265, 354113, 360257, 361025, 359937, 363105, 363329, 369185, 370369, 370433, 370721, 384609,
+    250209, 250209, 250241, 250209, 250209, 250209, 250209, 250209, 250209, 250209, 343617, 250209, 250209, 250209, 250209, 250241,
+    250241, 250209, 371649, 288034, 288387, 289410, 289922, 293986, 297634, 297442, 307105, 309313, 318337, 321345, 324225, 328193,
+    328577, 331201, 346177, 346305, 347425, 349634, 368769, 290881, 291233, 292705, 304385, 305153, 324705, 336642, 340353, 351201,
+    357666, 363425, 285922, 333954, 355810, 250209, 250209, 250209, 250209, 250241, 0, 250209, 250241, 250241, 250209, 250241,
+    287970, 287906, 291778, 291714, 291906, 291842, 292034, 291970, 294211, 294115, 296738, 296674, 297122, 297058, 297378, 297314,
+    296866, 296802, 297250, 297186, 302755, 302659, 302563, 302467, 303618, 303554, 303746, 303682, 302115, 302019, 305762, 305698,
+    308418, 308354, 310818, 310754, 311266, 311202, 310690, 310626, 310946, 310882, 311394, 311330, 315490, 315426, 314371, 314275,
+    318914, 318850, 319426, 319362, 319554, 319490, 322466, 322402, 322627, 322531, 322914, 322850, 322786, 322722, 325954, 325890,
+    326082, 326018, 326210, 326146, 329666, 329602, 330050, 329986, 330306, 330242, 330178, 330114, 334691, 334595, 334883, 334787,
+    336547, 336451, 336355, 336259, 340930, 340866, 341058, 340994, 344450, 344386, 345090, 345026, 345251, 345155, 345410, 345346,
+    348866, 348802, 349250, 349186, 348259, 348163, 348707, 348611, 349411, 349315, 352322, 352258, 352578, 352514, 352962, 352898,
+    352834, 352770, 359394, 359330, 359650, 359586, 359522, 359458, 357123, 357027, 357571, 357475, 361762, 361698, 361890, 361826,
+    364098, 364034, 363970, 363906, 364418, 364354, 364546, 364482, 364674, 364610, 365986, 365922, 365858, 365794, 367938, 367874,
+    369442, 369378, 369826, 369762, 369954, 369890, 311458, 352194, 364290, 367554, 290370, 349763, 351105, 351137, 350467, 299489,
+    287458, 287394, 287074, 287010, 284739, 284643, 284931, 284835, 285315, 285219, 285123, 285027, 287811, 287715, 283843, 283747,
+    284035, 283939, 284419, 284323, 284227, 284131, 287619, 287523, 303298, 303234, 302914, 302850, 301698, 301634, 300707, 300611,
+    300899, 300803, 301283, 301187, 301091, 300995, 303459, 303363, 314978, 314914, 315362, 315298, 338242, 338178, 336770, 336706,
+    333091, 332995, 333283, 333187, 333667, 333571, 333475, 333379, 338403, 338307, 337315, 337219, 337507, 337411, 337891, 337795,
+    337699, 337603, 338083, 337987, 359266, 359202, 357794, 357730, 358339, 358243, 358531, 358435, 358915, 358819, 358723, 358627,
+    359107, 359011, 367362, 367298, 368322, 368258, 368194, 368130, 367810, 367746, 323362, 323298, 363233, 363201, 368577, 368545,
+    373410, 375074, 373987, 375651, 373539, 375203, 374435, 376099, 373474, 375138, 374083, 375747, 373635, 375299, 374531, 376195,
+    378498, 379010, 378819, 379331, 378627, 379139, 0, 0, 378562, 379074, 378915, 379427, 378723, 379235, 0, 0,
+    380354, 382018, 380931, 382595, 380483, 382147, 381379, 383043, 380418, 382082, 381027, 382691, 380579, 382243, 381475, 383139,
+    384802, 385506, 385123, 385827, 384931, 385635, 385315, 386019, 384866, 385570, 385219, 385923, 385027, 385731, 385411, 386115,
+    388834, 389346, 389155, 389667, 388963, 389475, 0, 0, 388898, 389410, 389251, 389763, 389059, 389571, 0, 0,
+    391650, 392002, 391811, 392323, 391715, 392131, 391907, 392515, 0, 392066, 0, 392419, 0, 392227, 0, 392611,
+    394530, 396194, 395107, 396771, 394659, 396323, 395555, 397219, 394594, 396258, 395203, 396867, 394755, 396419, 395651, 397315,
+    376962, 376738, 379650, 379522, 383906, 383682, 386338, 386210, 389986, 389858, 392898, 392706, 398082, 397858, 0, 0,
+    374883, 376547, 374180, 375844, 373732, 375396, 374628, 376292, 374979, 376643, 374308, 375972, 373860, 375524, 374756, 376420,
+    381827, 383491, 381124, 382788, 380676, 382340, 381572, 383236, 381923, 383587, 381252, 382916, 380804, 382468, 381700, 383364,
+    396003, 397667, 395300, 396964, 394852, 396516, 395748, 397412, 396099, 397763, 395428, 397092, 394980, 396644, 395876, 397540,
+    377186, 377474, 377091, 377602, 376867, 0, 377314, 377379, 377250, 377538, 377026, 376802, 377666, 15009, 384641, 15009,
+    15041, 15074, 384035, 384290, 383811, 0, 384130, 384195, 379714, 379586, 383970, 383746, 384354, 15138, 15202, 15266,
+    386466, 387074, 386883, 386787, 0, 0, 386594, 386979, 386530, 387138, 386402, 386274, 0, 15330, 15394, 15458,
+    393026, 393698, 393507, 393411, 390690, 390754, 393154, 393603, 393090, 393762, 392962, 392770, 390818, 15522, 3714, 1057,
+    0, 0, 398211, 398466, 397987, 0, 398306, 398371, 390050, 389922, 398146, 397922, 398530, 1633, 15585, 0,
+    11201, 11201, 11201, 11201, 11201, 11201, 11201, 1249, 11201, 11201, 11201, 1, 1, 1, 1, 1,
+    15617, 15649, 15681, 15713, 15745, 15777, 15809, 15841, 15873, 15905, 15937, 15969, 16001, 16033, 16065, 16097,
+    16129, 16161, 16193, 16225, 16257, 16290, 16355, 16449, 16481, 16513, 1, 1, 1, 1, 1, 1249,
+    16545, 16577, 16609, 16642, 16707, 16801, 16834, 16899, 16993, 17025, 17057, 17089, 17122, 17185, 17217, 17249,
+    17281, 17313, 17345, 17377, 17409, 17441, 17473, 17506, 17570, 17634, 17697, 17729, 17761, 17793, 17825, 17857,
+    17889, 17921, 17953, 17985, 18017, 18049, 18081, 18116, 18241, 18273, 18305, 18337, 18369, 18401, 18433, 11201,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    262017, 313409, 0, 0, 276673, 278273, 279425, 280385, 281441, 282369, 18465, 18497, 18529, 18561, 18593, 328993,
+    262049, 262689, 270401, 274593, 276705, 278305, 279457, 280417, 281473, 282401, 18625, 18657, 18689, 18721, 18753, 0,
+    283297, 300033, 332417, 365729, 304481, 310305, 318785, 321825, 325825, 329025, 340801, 347969, 352001, 0, 0, 0,
+    260673, 260705, 260737, 260769, 260801, 260833, 260865, 260897, 346050, 260929, 260993, 261025, 261057, 261089, 261121, 261153,
+    261185, 261217, 261249, 261281, 261313, 261345, 261377, 261409, 261441, 261473, 261537, 261569, 261601, 261633, 261665, 261697,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    258145, 258177, 258209, 258209, 258241, 258273, 258305, 258337, 250273, 250273, 250273, 258369, 258401, 250305, 250305, 250305,
+    250305, 258433, 250305, 250305, 250305, 250273, 258465, 258497, 258529, 258561, 250273, 250273, 250241, 250241, 250241, 250241,
+    250209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    288291, 289539, 293281, 293090, 18785, 295043, 295363, 304609, 18817, 305410, 307233, 310209, 310209, 310209, 309985, 311010,
+    313345, 313345, 321729, 321473, 18849, 328929, 330914, 18881, 18913, 340705, 343105, 343969, 343969, 343969, 18945, 18977,
+    350082, 353219, 353506, 19009, 369121, 19041, 394465, 19073, 369121, 19105, 318529, 285602, 291585, 293281, 19137, 299713,
+    299937, 305569, 306977, 325729, 332097, 431649, 432001, 432193, 432321, 313089, 19169, 305955, 390177, 377985, 378049, 390241,
+    19201, 19233, 19265, 19297, 19329, 296385, 296129, 299713, 313089, 317345, 19361, 19393, 19425, 289635, 306945, 19457,
+    268067, 269347, 263812, 265507, 271875, 266787, 272611, 275491, 277187, 267427, 278563, 268707, 275779, 278659, 280675, 262722,
+    313217, 315746, 315907, 316322, 361409, 362018, 362179, 362404, 316450, 365505, 366114, 366275, 321601, 293153, 296257, 325601,
+    312961, 315682, 315811, 316258, 361153, 361954, 362083, 362276, 316386, 365249, 366050, 366179, 321345, 292833, 296001, 325345,
+    19489, 19521, 19553, 295841, 295809, 279041, 19585, 19617, 19649, 262083, 19681, 19713, 0, 0, 0, 0,
+    19745, 19777, 19809, 19841, 19873, 19905, 19937, 19969, 20001, 20033, 20066, 20130, 20193, 20225, 20257, 20289,
+    20321, 20353, 20385, 20417, 20449, 20481, 20513, 20545, 20577, 20609, 20641, 20673, 20705, 20737, 20770, 20833,
+    20865, 20897, 20929, 20961, 20993, 21025, 21057, 21089, 21121, 21153, 21185, 21217, 21249, 21281, 21313, 21345,
+    21377, 21409, 21441, 21473, 21505, 21537, 21569, 21601, 21633, 21665, 21697, 21729, 21761, 21794, 21858, 21922,
+    21985, 22017, 22049, 22081, 22113, 22145, 22177, 22209, 22241, 22273, 22305, 22337, 22369, 22401, 22433, 22465,
+    22497, 22529, 22561, 22593, 22625, 22657, 22689, 22721, 22753, 22785, 22817, 22849, 22881, 22913, 22945, 22977,
+    23009, 23041, 23073, 23105, 23137, 23169, 23201, 23233, 23265, 23297, 23329, 23361, 23393, 23425, 23457, 23489,
+    23521, 23553, 23585, 23617, 23650, 23713, 23745, 23777, 23809, 23842, 23905, 23937, 23970, 24033, 24065, 24097,
+    24129, 24161, 24193, 24225, 24257, 24289, 24321, 24353, 24385, 24417, 24449, 24481, 24513, 24545, 24577, 24609,
+    24641, 24673, 24705, 24737, 24770, 24833, 24866, 24929, 24961, 24993, 25025, 25057, 25090, 25155, 25249, 25282,
+    25347, 25441, 25473, 25505, 25537, 25569, 25601, 25633, 25665, 25697, 25729, 25761, 25793, 25825, 25857, 25889,
+    25921, 25954, 26017, 26049, 26082, 26145, 26177, 26210, 26273, 26306, 26369, 26401, 26433, 26465, 26497, 26529,
+    26561, 26593, 26625, 26657, 26689, 26721, 26753, 26785, 26817, 26849, 26881, 26913, 26945, 26977, 27009, 27041,
+    27074, 27137, 27170, 27233, 27265, 27297, 27329, 27361, 27393, 27425, 27457, 27489, 27521, 27554, 27618, 27682,
+    27746, 27810, 27873, 27905, 27938, 28002, 28065, 28097, 28130, 28194, 28257, 28289, 28321, 28353, 28385, 28417,
+    28450, 28514, 28577, 28609, 28642, 28706, 28769, 28801, 28834, 28898, 28961, 28993, 29025, 29057, 29089, 29121,
+    29153, 29185, 29217, 29249, 29281, 29313, 29345, 29377, 29409, 29441, 29473, 29505, 29537, 29569, 29601, 29633,
+    29665, 29697, 29729, 29761, 29793, 29825, 29857, 29889, 29921, 29953, 29985, 30017, 30050, 30114, 30178, 30242,
+    30305, 30337, 30369, 30401, 30433, 30465, 30497, 30529, 30561, 30593, 30625, 30657, 30689, 30721, 30753, 30785,
+    30817, 30849, 30881, 30913, 30945, 30977, 31009, 31041, 31073, 31105, 31137, 31169, 31201, 31233, 31265, 31297,
+    31329, 31361, 31393, 31425, 31457, 31489, 31521, 31553, 31585, 31617, 31649, 31681, 31713, 31745, 31777, 31809,
+    31842, 31906, 31970, 32034, 32097, 32129, 32161, 32193, 32225, 32257, 32290, 32354, 32418, 32482, 32545, 32577,
+    32609, 32641, 32673, 32705, 32737, 32769, 32801, 32833, 32865, 32897, 32929, 32961, 32993, 33025, 33057, 33089,
+    33121, 33153, 33185, 33217, 33249, 33281, 33313, 33345, 33377, 33409, 33441, 33473, 33505, 33537, 33569, 33601,
+    33633, 33665, 33697, 33729, 33761, 33793, 33825, 33857, 33889, 33921, 33953, 33985, 34017, 34049, 34081, 34113,
+    34145, 34177, 34209, 34241, 34273, 34305, 34337, 34369, 34401, 34433, 34465, 34497, 34529, 34561, 34593, 34625,
+    34657, 34689, 34721, 34753, 34785, 34817, 34849, 34881, 34913, 34945, 34977, 35009, 35041, 35073, 35105, 35137,
+    35169, 35201, 35233, 35265, 35297, 35329, 35361, 35393, 35425, 35457, 35489, 35521, 35553, 35585, 35617, 35649,
+    35681, 35713, 35745, 35777, 35809, 35841, 35873, 35905, 35937, 35969, 36001, 36033, 36065, 36097, 36129, 36161,
+    36193, 36225, 36257, 36289, 36321, 36353, 36385, 36417, 36449, 36481, 36513, 36545, 36577, 36609, 36641, 36673,
+    36705, 36737, 36769, 36801, 36833, 36865, 36897, 36929, 36961, 36993, 37025, 37057, 37089, 37121, 37153, 37185,
+    37217, 37249, 37281, 37313, 37345, 37377, 37409, 37441, 37473, 37505, 37537, 37569, 37601, 37633, 37665, 37697,
+    37729, 37761, 37793, 37825, 37857, 37889, 37921, 37953, 37985, 38017, 38049, 38081, 38113, 38145, 38177, 38209,
+    38241, 38273, 38305, 38337, 38369, 38401, 38433, 38465, 38497, 38529, 38561, 38593, 38625, 38657, 38689, 38721,
+    38753, 38785, 38817, 38849, 38881, 38913, 38945, 38977, 39009, 39041, 39073, 39105, 39137, 39169, 39201, 39233,
+    39265, 39297, 39329, 39361, 39393, 39425, 39457, 39489, 39521, 39553, 39585, 39617, 39649, 39681, 39713, 39745,
+    39777, 39809, 39841, 39873, 39905, 39937, 39969, 40001, 40033, 40065, 40097, 40129, 40161, 40193, 40225, 40257,
+    40289, 40321, 40353, 40385, 40417, 40449, 40481, 40513, 40545, 40577, 40609, 40641, 40673, 40705, 40737, 40769,
+    40801, 40833, 40865, 40897, 40929, 40961, 40993, 41025, 41057, 41089, 41121, 41153, 41185, 41217, 41249, 41281,
+    41313, 41345, 41377, 41409, 41441, 41473, 41505, 41537, 41569, 41601, 41633, 41665, 41697, 41729, 41761, 41793,
+    41825, 41857, 41889, 41921, 41953, 41985, 42017, 42049, 42081, 42113, 42145, 42177, 42209, 42241, 42273, 42305,
+    42337, 42369, 42401, 42433, 42465, 42497, 42529, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    42561, 42593, 42625, 42657, 42689, 42721, 42753, 42785, 42817, 42849, 42881, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    262625, 270337, 274529, 276641, 278241, 279393, 280353, 281409, 282337, 263074, 263746, 264546, 265442, 266082, 266722, 267362,
+    268002, 268642, 269282, 270722, 262371, 270083, 274275, 276387, 277987, 279139, 280099, 281155, 282083, 262852, 263524, 264324,
+    265220, 265860, 266500, 267140, 267780, 268420, 269060, 270500, 262466, 270178, 274370, 276482, 278082, 279234, 280194, 281250,
+    282178, 262979, 263651, 264451, 265347, 265987, 266627, 267267, 267907, 268547, 269187, 270627, 282883, 291267, 292867, 296035,
+    299619, 305187, 307139, 309891, 312995, 317251, 318371, 321379, 325379, 328611, 332003, 340387, 342787, 343651, 347459, 351587,
+    354499, 361187, 363459, 365283, 366723, 368803, 283233, 291617, 293313, 296417, 299969, 305601, 307489, 310241, 313377, 317601,
+    318721, 321761, 325761, 328961, 332353, 340737, 343137, 344001, 347905, 351937, 354849, 361569, 363809, 365665, 367073, 369153,
+    283009, 291393, 292993, 296161, 299745, 305313, 307265, 310017, 313121, 317377, 318497, 321505, 325505, 328737, 332129, 340513,
+    342913, 343777, 347585, 351713, 354625, 361313, 363585, 365409, 366849, 368929, 261985, 263746, 264546, 265442, 266082, 266722,
+    267362, 268002, 268642, 269282, 270722, 262625, 270337, 274529, 276641, 278241, 279393, 280353, 281409, 282337, 263074, 261985,
+    42913, 42945, 42977, 43009, 43041, 43073, 43105, 43137, 43169, 43201, 43233, 43265, 43297, 43329, 43361, 43393,
+    43425, 43457, 43489, 43521, 43553, 43585, 43617, 43649, 43681, 43713, 43745, 43777, 43809, 43841, 43873, 43905,
+    43937, 43969, 44001, 44033, 44065, 44097, 44129, 44161, 44193, 44225, 44257, 44289, 44321, 44353, 44385, 44417,
+    44449, 44481, 44513, 44545, 44577, 44609, 44641, 44673, 44705, 44737, 44769, 44801, 44833, 44865, 44897, 44929,
+    44961, 44993, 45025, 45057, 45089, 45121, 45153, 45185, 45217, 45249, 45281, 45313, 45345, 45377, 45409, 45441,
+    45473, 45505, 45537, 45569, 45601, 45633, 45665, 45697, 45729, 45761, 45793, 45825, 45857, 45889, 45921, 45953,
+    45985, 46017, 46049, 46081, 46113, 46145, 46177, 46209, 46241, 46273, 46305, 46337, 46369, 46401, 46433, 46465,
+    46497, 46529, 46561, 46593, 46625, 46657, 46689, 46721, 46753, 46785, 46817, 46849, 46881, 46913, 46945, 46977,
+    47009, 47041, 47073, 47105, 47137, 47169, 47201, 47233, 47265, 47297, 47329, 47361, 47393, 47425, 47457, 47489,
+    47521, 47553, 47585, 47617, 47649, 47681, 47713, 47745, 47777, 47809, 47841, 47873, 47905, 47937, 47969, 48001,
+    48033, 48065, 48097, 48129, 48161, 48193, 48225, 48257, 48289, 48321, 48353, 48385, 48417, 48449, 48481, 48513,
+    48545, 48577, 48609, 48641, 48673, 48705, 48737, 48769, 48801, 48833, 48865, 48897, 48929, 48961, 48993, 49025,
+    49057, 49089, 49121, 49153, 49185, 49217, 49249, 49281, 49313, 49345, 49377, 49409, 49441, 49473, 49505, 49537,
+    49569, 49601, 49633, 49665, 49697, 49729, 49761, 49793, 49825, 49857, 49889, 49921, 49953, 49985, 50017, 50049,
+    50081, 50113, 50145, 50177, 50209, 50241, 50273, 50305, 50337, 50369, 50401, 50433, 50465, 50497, 50529, 50561,
+    50593, 50625, 50657, 50689, 50721, 50753, 50785, 50817, 50849, 50881, 50913, 50945, 50977, 51009, 51041, 51073,
+    51105, 51137, 51169, 51201, 51233, 51265, 51297, 51329, 51361, 51393, 51425, 51457, 51489, 51521, 51553, 51585,
+    51617, 51649, 51681, 51713, 51745, 51777, 51809, 51841, 51873, 51905, 51937, 51969, 52001, 52033, 52065, 52097,
+    52129, 52161, 52193, 52225, 52257, 52289, 52321, 52353, 52385, 52417, 52449, 52481, 52513, 52545, 52577, 52609,
+    52641, 52673, 52705, 52737, 52769, 52801, 52833, 52865, 52897, 52929, 52961, 52993, 53025, 53057, 53089, 53121,
+    53153, 53185, 53217, 53249, 53281, 53313, 53345, 53377, 53409, 53441, 53473, 53505, 53537, 53569, 53601, 53633,
+    53665, 53697, 53729, 53761, 53793, 53825, 53857, 53889, 53921, 53953, 53985, 54017, 54049, 54081, 54113, 54145,
+    54177, 54209, 54241, 54273, 54305, 54337, 54369, 54401, 54433, 54465, 54497, 54529, 54561, 54593, 54625, 54657,
+    54689, 54721, 54753, 54785, 54817, 54849, 54881, 54913, 54945, 54977, 55009, 55041, 55073, 55105, 55137, 55169,
+    55201, 55233, 55265, 55297, 55329, 55361, 55393, 55425, 55457, 55489, 55521, 55553, 55585, 55617, 55649, 55681,
+    55713, 55745, 55777, 55809, 55841, 55873, 55905, 55937, 55969, 56001, 56033, 56065, 56097, 56129, 56161, 56193,
+    56225, 56257, 56289, 56321, 56353, 56385, 56417, 56449, 56481, 56513, 56545, 56577, 56609, 56641, 56673, 56705,
+    56737, 56769, 56801, 56833, 56865, 56897, 56929, 56961, 56993, 57025, 57057, 57089, 57121, 57153, 57185, 57217,
+    57249, 57281, 57313, 57345, 57377, 57409, 57441, 57473, 57505, 57537, 57569, 57601, 57633, 57665, 57697, 57729,
+    57761, 57793, 57825, 57857, 57889, 57921, 57953, 57985, 58017, 58049, 58081, 58113, 58145, 58177, 58209, 58241,
+    58273, 58305, 58337, 58369, 58401, 58433, 58465, 58497, 58529, 58561, 58593, 58625, 58657, 58689, 58721, 58753,
+    58785, 58817, 58849, 58881, 58913, 58945, 58977, 59009, 59041, 59073, 59105, 59137, 59169, 59201, 59233, 59265,
+    59297, 59329, 59361, 59393, 59425, 59457, 59489, 59521, 59553, 59585, 59617, 59649, 59681, 59713, 59745, 59777,
+    59809, 59841, 59873, 59905, 59937, 59969, 60001, 60033, 60065, 60097, 60129, 60161, 60193, 60225, 60257, 60289,
+    60321, 60353, 60385, 60417, 60449, 60481, 60513, 60545, 60577, 60609, 60641, 60673, 60705, 60737, 60769, 60801,
+    60833, 60865, 60897, 60929, 60961, 60993, 61025, 61057, 61089, 61121, 61153, 61185, 61217, 61249, 61281, 61313,
+    61345, 61377, 61409, 61441, 61473, 61505, 61537, 61569, 61601, 61633, 61665, 61697, 61729, 61761, 61793, 61825,
+    61857, 61889, 61921, 61953, 61985, 62017, 62049, 62081, 62113, 62145, 62177, 62209, 62241, 62273, 62305, 62337,
+    62369, 62401, 62433, 62465, 62497, 62529, 62561, 62593, 62625, 62657, 62689, 62721, 62753, 62785, 62817, 62849,
+    62881, 62913, 62945, 62977, 63009, 63041, 262625, 270337, 274529, 276641, 278241, 279393, 280353, 281409, 282337, 263074,
+    262625, 270337, 274529, 276641, 278241, 279393, 280353, 281409, 282337, 263074, 262625, 270337, 274529, 276641, 278241, 279393,
+    280353, 281409, 282337, 263074, 63073, 63105, 63137, 63169, 63201, 63233, 63265, 63297, 63329, 63361, 63393, 63425,
+    63457, 63489, 63521, 63553, 63585, 63617, 63649, 63681, 63713, 63745, 63777, 63809, 63841, 63873, 63905, 63937,
+    63969, 64001, 64033, 64065, 64097, 64129, 64161, 64193, 64225, 64257, 64289, 64321, 64353, 64385, 64417, 64449,
+    64481, 64513, 64545, 64577, 64609, 64641, 64673, 64705, 64737, 64769, 64801, 64833, 64865, 64897, 64929, 64961,
+    64993, 65025, 65057, 65089, 65121, 65153, 65185, 65217, 65249, 65281, 65313, 65345, 65377, 65409, 65441, 65473,
+    65505, 65537, 65569, 65601, 65633, 65665, 65697, 65729, 65761, 65793, 65825, 65857, 65889, 65921, 65953, 65985,
+    66017, 66049, 66081, 66113, 66145, 66177, 66209, 66241, 66273, 66305, 66337, 66369, 66401, 66433, 66465, 66497,
+    66529, 66561, 66593, 66625, 66657, 66689, 66721, 66753, 66785, 66817, 66849, 66881, 66913, 66945, 66977, 67009,
+    67041, 67073, 67105, 67137, 67169, 67201, 67233, 67265, 67297, 67329, 67361, 67393, 67425, 67457, 67489, 67521,
+    67553, 67585, 67617, 67649, 67681, 67713, 67745, 67777, 67809, 67841, 67873, 67905, 67937, 67969, 68001, 68033,
+    68065, 68097, 68129, 68161, 68193, 68225, 68257, 68289, 68321, 68353, 68385, 68417, 68449, 68481, 68513, 68545,
+    68577, 68609, 68641, 68673, 68705, 68737, 68769, 68801, 68833, 68865, 68897, 68929, 68961, 68993, 69025, 69057,
+    69089, 69121, 69153, 69185, 69217, 69249, 69281, 69313, 69345, 69377, 69409, 69441, 69473, 69505, 69537, 69569,
+    69601, 69633, 69665, 69697, 69729, 69761, 69793, 69825, 69857, 69889, 69921, 69953, 69985, 70017, 70049, 70081,
+    70113, 70145, 70177, 70209, 70241, 70273, 70305, 70337, 70369, 70401, 70433, 70465, 70497, 70529, 70561, 70593,
+    70625, 70657, 70689, 70721, 70753, 70785, 70817, 70849, 70881, 70913, 70945, 70977, 71009, 71041, 71073, 71105,
+    71137, 71169, 71201, 71233, 71265, 71297, 71329, 71361, 71393, 71425, 71457, 71489, 71521, 71553, 71585, 71617,
+    71649, 71681, 71713, 71745, 71777, 71809, 71841, 71873, 71905, 71937, 71969, 72001, 72033, 72065, 72097, 72129,
+    72161, 72193, 72225, 72257, 72289, 72321, 72353, 72385, 72417, 72449, 72481, 72513, 72545, 72577, 72609, 72641,
+    72673, 72705, 72737, 72769, 72801, 72833, 72865, 72897, 72929, 72961, 72993, 73025, 73057, 73089, 73121, 73153,
+    73185, 73217, 73249, 73281, 73313, 73345, 73377, 73409, 73441, 73473, 73505, 73537, 73569, 73601, 73633, 73665,
+    73697, 73729, 73761, 73793, 73825, 73857, 73889, 73921, 73953, 73985, 74017, 74049, 74081, 74113, 74145, 74177,
+    74209, 74241, 74273, 74305, 74337, 74369, 74401, 74433, 74465, 74497, 74529, 74561, 74593, 74625, 74657, 74689,
+    74721, 74753, 74785, 74817, 74849, 74881, 74913, 74945, 74977, 75009, 75041, 75073, 75105, 75137, 75169, 75201,
+    75233, 75265, 75297, 75329, 75361, 75393, 75425, 75457, 75489, 75521, 75553, 75585, 75617, 75649, 75681, 75713,
+    75745, 75777, 75809, 75841, 75873, 75905, 75937, 75969, 76001, 76033, 76065, 76097, 76129, 76161, 76193, 76225,
+    76257, 76289, 76321, 76353, 76385, 76417, 76449, 76481, 76513, 76545, 76577, 76609, 76641, 76673, 76705, 76737,
+    76769, 76801, 76833, 76865, 76897, 76929, 76961, 76993, 77025, 77057, 77089, 77121, 77153, 77185, 77217, 77249,
+    77281, 77313, 77345, 77377, 77409, 77441, 77473, 77505, 77537, 77569, 77601, 77633, 77665, 77697, 77729, 77761,
+    77793, 77825, 77857, 77889, 77921, 77953, 77985, 78017, 78049, 78081, 78113, 78145, 78177, 78209, 78241, 78273,
+    78305, 78337, 78369, 78401, 78433, 78465, 78497, 78529, 78561, 78593, 78625, 78657, 78689, 78721, 78753, 78785,
+    78817, 78849, 78881, 78913, 78945, 78977, 79009, 79041, 79073, 79105, 79137, 79169, 79201, 79233, 79265, 79297,
+    79329, 79361, 79393, 79425, 79457, 79489, 79521, 79553, 79585, 79617, 79649, 79681, 79713, 79745, 79777, 79809,
+    79841, 79873, 79905, 79937, 79969, 80001, 80033, 80065, 80097, 80129, 80161, 80193, 80225, 80257, 80289, 80321,
+    80353, 80385, 80417, 80449, 80481, 80513, 80545, 80577, 80609, 80641, 80673, 80705, 80737, 80769, 80801, 80833,
+    80865, 80897, 80929, 80961, 80993, 81025, 81057, 81089, 81121, 81153, 81185, 81217, 81249, 81281, 81313, 81345,
+    81377, 81409, 81441, 81473, 81505, 81537, 81569, 81601, 81633, 81665, 81697, 81729, 81761, 81793, 81825, 81857,
+    81889, 81921, 81953, 81985, 82017, 82049, 82081, 82113, 82145, 82177, 82209, 82241, 82273, 82305, 82337, 82369,
+    82401, 82433, 82465, 82497, 82529, 82561, 82593, 82625, 82657, 82689, 82721, 82753, 82785, 82817, 82849, 82881,
+    82913, 82945, 82977, 83009, 83041, 83073, 83105, 83137, 83169, 83201, 83233, 83265, 83300, 83425, 83457, 83489,
+    83521, 83553, 83585, 83617, 83649, 83681, 83713, 83745, 83777, 83809, 83841, 83873, 83905, 83937, 83969, 84001,
+    84033, 84065, 84097, 84129, 84161, 84193, 84225, 84257, 84289, 84321, 84353, 84385, 84417, 84449, 84481, 84513,
+    84545, 84577, 84609, 84641, 84673, 84705, 84737, 84769, 84801, 84833, 84865, 84897, 84929, 84961, 84993, 85025,
+    85057, 85089, 85121, 85153, 85185, 85217, 85249, 85281, 85313, 85345, 85377, 85409, 85441, 85473, 85505, 85537,
+    85569, 85601, 85633, 85665, 85697, 85729, 85761, 85793, 85825, 85857, 85889, 85921, 85953, 85985, 86017, 86049,
+    86081, 86113, 86145, 86177, 86209, 86241, 86273, 86305, 86337, 86369, 86401, 86433, 86465, 86497, 86529, 86561,
+    86593, 86625, 86657, 86689, 86723, 86818, 86883, 86977, 87009, 87041, 87073, 87105, 87137, 87169, 87201, 87233,
+    87265, 87297, 87329, 87361, 87393, 87425, 87457, 87489, 87521, 87553, 87585, 87617, 87649, 87681, 87713, 87745,
+    87777, 87809, 87841, 87873, 87905, 87937, 87969, 88001, 88033, 88065, 88097, 88129, 88161, 88193, 88225, 88257,
+    88289, 88321, 88353, 88385, 88417, 88449, 88481, 88513, 88545, 88577, 88609, 88641, 88673, 88705, 88737, 88769,
+    88801, 88833, 88865, 88897, 88929, 88961, 88993, 89025, 89057, 89089, 89121, 89153, 89185, 89217, 89249, 89281,
+    89313, 89345, 89377, 89409, 89441, 89473, 89505, 89537, 89569, 89601, 89633, 89665, 89697, 89729, 89761, 89793,
+    89825, 89857, 89889, 89921, 89953, 89985, 90017, 90049, 90081, 90113, 90145, 90177, 90210, 90273, 90305, 90337,
+    90369, 90401, 90433, 90465, 90497, 90529, 90561, 90593, 90625, 90657, 90689, 90721, 90753, 90785, 90817, 90849,
+    90881, 90913, 90945, 90977, 91009, 91041, 91073, 91105, 91137, 91169, 91201, 91233, 91265, 91297, 91329, 91361,
+    91393, 91425, 91457, 91489, 91521, 91553, 91585, 91617, 91649, 91681, 91713, 91745, 91777, 91809, 91841, 91873,
+    91905, 91937, 91969, 92001, 92033, 92065, 92097, 92129, 92161, 92193, 92225, 92257, 92289, 92321, 92353, 92385,
+    92417, 92449, 92481, 92513, 92545, 92577, 92609, 92641, 92673, 92705, 92737, 92769, 92801, 92833, 92865, 92897,
+    92929, 92961, 92993, 93025, 93057, 93089, 93121, 93153, 93185, 93217, 93249, 93281, 93313, 93345, 93377, 93409,
+    93441, 93473, 93505, 93537, 93569, 93601, 93633, 93665, 93697, 93729, 93761, 93793, 93825, 93857, 93889, 93921,
+    93953, 93985, 94017, 94049, 94081, 94113, 94145, 94177, 94209, 94241, 94273, 94305, 94337, 94369, 94401, 94433,
+    94465, 94497, 94529, 94561, 94593, 94625, 94657, 94689, 94721, 94753, 94785, 94817, 94849, 94881, 94913, 94945,
+    94977, 95009, 95041, 95073, 0, 0, 95105, 95137, 95169, 95201, 95233, 95265, 95297, 95329, 95361, 95393,
+    95425, 95457, 95489, 95521, 95553, 95585, 95617, 95649, 95681, 95713, 95745, 95777, 95809, 95841, 95873, 95905,
+    95937, 95969, 96001, 96033, 96065, 96097, 0, 96129, 96161, 96193, 96225, 96257, 96289, 96321, 96353, 96385,
+    96417, 96449, 96481, 96513, 96545, 96577, 96609, 96641, 96673, 96705, 96737, 96769, 96801, 96833, 96865, 96897,
+    96929, 96961, 96993, 97025, 97057, 97089, 97121, 97153, 97185, 97217, 97249, 97281, 97313, 97345, 97377, 97409,
+    97441, 97473, 97505, 97537, 97569, 97601, 97633, 97665, 97697, 97729, 97761, 97793, 97825, 97857, 97889, 97921,
+    97953, 97985, 98017, 98049, 98081, 98113, 98145, 98177, 98209, 98241, 98273, 98305, 98337, 98369, 98401, 98433,
+    98465, 98497, 98529, 98561, 98593, 98625, 98657, 98689, 98721, 98753, 98785, 98817, 98849, 98881, 98913, 98945,
+    98977, 99009, 99041, 99073, 99105, 99137, 99169, 99201, 99233, 99265, 99297, 99329, 99361, 99393, 99425, 99457,
+    417633, 417729, 417825, 417921, 418017, 418113, 418209, 418273, 418369, 418465, 418561, 418657, 418753, 418849, 418945, 419041,
+    419137, 419233, 419329, 419425, 419521, 419617, 419713, 419809, 419905, 419969, 420033, 420129, 420225, 420321, 420417, 420513,
+    420609, 420705, 420769, 420865, 420961, 421025, 421121, 421217, 421313, 421409, 421505, 421569, 421633, 421697, 421761, 0,
+    417569, 417665, 417761, 417857, 417953, 418049, 418145, 418241, 418305, 418401, 418497, 418593, 418689, 418785, 418881, 418977,
+    419073, 419169, 419265, 419361, 419457, 419553, 419649, 419745, 419841, 419937, 420001, 420065, 420161, 420257, 420353, 420449,
+    420545, 420641, 420737, 420801, 420897, 420993, 421057, 421153, 421249, 421345, 421441, 421537, 421601, 421665, 421729, 0,
+    324545, 324513, 324609, 342241, 346817, 290465, 353985, 312545, 312513, 320993, 320961, 370561, 370529, 290913, 328321, 290785,
+    291073, 363137, 365057, 365025, 363169, 312609, 312577, 342689, 304193, 346721, 339873, 304321, 317665, 361665, 351073, 370497,
+    398849, 398817, 398913, 398881, 398977, 398945, 399041, 399009, 399105, 399073, 399233, 399201, 399297, 399265, 399361, 399329,
+    399425, 399393, 399489, 399457, 399553, 399521, 399777, 399745, 399841, 399809, 399905, 399873, 400097, 400065, 400161, 400129,
+    400225, 400193, 400289, 400257, 400353, 400321, 400417, 400385, 400481, 400449, 400545, 400513, 400609, 400577, 400673, 400641,
+    400737, 400705, 402465, 402433, 402529, 402497, 399169, 399137, 399713, 399681, 399969, 399937, 400033, 400001, 400801, 400769,
+    400865, 400833, 401057, 401025, 401121, 401089, 401185, 401153, 401441, 401409, 401569, 401537, 401633, 401601, 401697, 401665,
+    401761, 401729, 401825, 401793, 401889, 401857, 402081, 402049, 402209, 402177, 402273, 402241, 402337, 402305, 402593, 402561,
+    402657, 402625, 402721, 402689, 399587, 99489, 99521, 99553, 99585, 99617, 99649, 400993, 400961, 402017, 401985, 250209,
+    249633, 249601, 401377, 401345, 0, 0, 0, 0, 0, 99681, 99713, 99745, 99777, 99809, 99841, 99873,
+    423233, 423361, 423489, 423617, 423745, 423873, 424001, 424257, 424385, 424513, 424641, 424769, 424929, 425185, 425313, 425441,
+    425569, 425697, 425825, 426081, 426209, 426337, 426465, 426593, 426721, 426849, 426977, 427105, 427233, 427361, 427489, 427745,
+    427873, 424129, 425057, 425953, 427617, 428001, 0, 428193, 0, 0, 0, 0, 0, 428513, 0, 0,
+    494049, 494081, 494113, 494145, 494177, 494209, 494241, 494273, 494305, 494337, 494369, 494401, 494465, 494497, 494529, 494561,
+    494593, 494625, 494657, 494689, 494721, 494753, 494785, 494817, 494849, 494881, 494913, 494945, 494977, 495009, 495041, 495073,
+    495105, 495137, 495169, 495201, 495265, 495297, 495329, 495361, 495393, 495425, 495457, 495489, 495521, 495553, 495585, 495617,
+    495649, 495681, 495713, 495745, 495777, 495809, 494433, 495233, 0, 0, 0, 0, 0, 0, 0, 495841,
+    99905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    496385, 497057, 497601, 497889, 498369, 499585, 500129, 500417, 501121, 501409, 501697, 503265, 504257, 504737, 505025, 506113,
+    506401, 506913, 508449, 505729, 505761, 505793, 505825, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    508577, 508609, 508641, 508673, 508705, 508737, 508769, 0, 508801, 508833, 508865, 508897, 508929, 508961, 508993, 0,
+    509025, 509057, 509089, 509121, 509153, 509185, 509217, 0, 509249, 509281, 509313, 509345, 509377, 509409, 509441, 0,
+    509473, 509505, 509537, 509569, 509601, 509633, 509665, 0, 509697, 509729, 509761, 509793, 509825, 509857, 509889, 0,
+    509921, 509953, 509985, 510017, 510049, 510081, 510113, 0, 510145, 510177, 510209, 510241, 510273, 510305, 510337, 0,
+    403393, 403489, 403585, 404193, 405249, 405793, 407745, 408417, 409057, 409281, 409921, 410369, 410657, 410881, 411169, 412577,
+    413409, 413761, 414561, 414721, 417057, 410946, 402785, 404673, 407649, 412321, 415553, 415905, 416065, 416385, 416545, 416833,
+    99937, 99969, 100001, 100033, 100065, 100097, 100129, 100161, 100193, 100225, 100257, 100289, 100321, 100353, 100385, 100417,
+    100449, 100481, 100513, 100545, 100577, 100609, 100641, 100673, 100705, 100737, 100769, 100801, 100833, 100865, 100897, 100929,
+    100961, 100993, 101025, 101057, 101089, 101121, 101153, 101185, 101217, 101249, 101281, 101313, 101345, 101377, 101409, 414849,
+    101441, 101473, 101505, 101537, 101569, 101601, 101633, 101665, 101697, 101729, 101761, 101793, 101825, 101857, 101889, 101921,
+    101953, 101985, 102017, 102049, 102081, 102113, 102145, 102177, 102209, 102241, 102273, 102305, 102337, 102369, 102401, 102433,
+    102465, 102497, 102529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    983363, 994275, 984066, 984002, 983907, 985538, 988739, 989923, 990211, 990306, 993635, 993795, 1002819, 1002915, 1003139, 1003234,
+    1003074, 1003299, 1005058, 1005698, 1007138, 1007043, 1008130, 1008035, 1010562, 1012866, 0, 1013954, 1014403, 1015907, 1019523, 1020002,
+    1020258, 1020642, 1020706, 1023906, 1025314, 1025379, 982978, 1025987, 1026530, 1027235, 1029379, 1030755, 1032131, 1032226, 1034851, 1036034,
+    1037122, 1037538, 1037378, 1037603, 1037699, 1037443, 1038115, 1038211, 1038306, 1038818, 1039618, 1039523, 1039747, 1040867, 1041666, 1041731,
+    1041827, 1044418, 1045954, 1046786, 1046722, 1047106, 1047170, 1047235, 1048354, 1049762, 1050147, 1051074, 1051522, 1051587, 1051683, 1052291,
+    1054370, 1054434, 1054498, 1054562, 1054882, 1055011, 1055106, 1056195, 1056674, 1057186, 1057890, 1058018, 1058146, 1058210, 1058339, 1058274,
+    1058754, 1058883, 1059426, 1059555, 1060099, 1060450, 1060898, 1061027, 1061442, 1061698, 1062210, 1062915, 1063010, 1063139, 1063234, 1063427,
+    1063586, 1063779, 1063875, 1063970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    981378, 982914, 983298, 983650, 983778, 984386, 984514, 985218, 985410, 987394, 987778, 988034, 988674, 989090, 989346, 989858,
+    990082, 990146, 991266, 992162, 992418, 992546, 992610, 992802, 993570, 993730, 994210, 994370, 994498, 994754, 997570, 998082,
+    999298, 999618, 999746, 999810, 1000130, 1000834, 1001602, 1001922, 1002562, 1002754, 1003074, 1003394, 1003842, 1003906, 1004610, 1004802,
+    1004994, 1005186, 1005442, 1005698, 1005826, 1006530, 1006658, 1006786, 1006850, 1006978, 1007266, 1007522, 1007970, 1010050, 1010370, 1010434,
+    1012738, 1012802, 1013314, 1013442, 1013634, 1013762, 1013890, 1014146, 1015330, 1015586, 1016450, 1018946, 1019138, 1019458, 1019746, 1019938,
+    1020066, 1020130, 1020194, 1020322, 1020386, 1023650, 1025186, 1025538, 1025602, 1025666, 1025730, 1025858, 1025922, 1026466, 1026978, 1027106,
+    1028226, 1028290, 1028418, 1028482, 1028674, 1028738, 1029314, 1029474, 1029922, 1029986, 1030050, 1030114, 1030690, 1031362, 1031426, 1031490,
+    1032066, 1033762, 1033826, 1034338, 1034658, 1034786, 1035394, 1035970, 1037186, 1037314, 1038050, 1038562, 1038754, 1038946, 1039010, 1039074,
+    1039458, 1039682, 1040226, 1040354, 1040610, 1040802, 1041090, 1041218, 1041282, 1041346, 1041474, 1041538, 1044354, 1044738, 1045570, 1045698,
+    1045890, 1046658, 1046978, 1047170, 1047394, 1048418, 1048482, 1048674, 1048738, 1048802, 1049826, 1049890, 1050082, 1050498, 1050626, 1051138,
+    1051330, 1051394, 1052226, 1052834, 1053154, 1053282, 1053474, 1054434, 1054626, 1054946, 1055682, 1055874, 1056130, 1056610, 1056802, 1056866,
+    1056930, 1056994, 1057250, 1057314, 1057442, 1057954, 1058082, 1058210, 1058818, 1058978, 1059106, 1059490, 1059650, 1059714, 1059842, 1059906,
+    1059970, 1060034, 1060194, 1060514, 1060962, 1061186, 1061378, 1061570, 1061634, 1061762, 1061890, 1062018, 1062082, 1062338, 1062466, 1062594,
+    1062722, 1062850, 1063074, 1063362, 1063714, 1064034, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    102561, 102593, 102625, 102657, 102689, 102721, 102753, 102785, 102817, 102849, 102881, 102913, 0, 0, 0, 0,
+    102945, 102977, 103009, 103041, 103073, 259169, 753410, 261729, 34433, 34465, 103105, 103137, 103169, 103201, 103233, 103265,
+    103297, 103329, 103361, 103393, 103425, 103457, 103489, 103521, 103553, 103585, 103617, 103649, 103681, 103713, 103745, 103777,
+    103809, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 257889, 257921, 257953, 257985, 258017, 258049,
+    103841, 259329, 259362, 259425, 259458, 259521, 103873, 103905, 992802, 993058, 993122, 259201, 763106, 103937, 103969, 104001,
+    0, 745537, 745569, 746305, 746337, 746785, 746817, 747265, 747297, 747809, 747841, 748257, 748418, 749153, 749282, 750593,
+    750754, 751553, 751714, 751937, 752066, 752545, 752706, 753121, 753282, 753633, 753794, 753921, 754050, 754369, 754498, 754625,
+    754754, 755009, 755138, 755265, 755297, 755490, 755617, 755746, 756033, 756194, 756481, 756673, 756801, 756961, 757089, 757313,
+    757474, 757602, 758305, 758466, 758594, 759233, 759394, 759522, 760257, 760418, 760546, 761569, 761730, 761858, 762753, 763521,
+    764033, 764193, 764705, 764833, 764865, 765281, 765313, 765601, 765633, 765889, 766049, 766401, 766849, 767265, 767425, 767457,
+    767809, 768033, 768257, 768481, 747010, 748225, 751521, 0, 0, 250337, 250401, 104033, 104065, 259553, 259586, 765826,
+    104097, 745601, 745665, 746369, 746433, 746849, 746913, 747329, 747393, 747873, 747937, 748321, 748482, 749185, 749346, 750657,
+    750818, 751617, 751778, 751969, 752130, 752577, 752770, 753185, 753346, 753697, 753858, 753953, 754114, 754401, 754562, 754657,
+    754818, 755041, 755202, 755329, 755393, 755554, 755649, 755810, 756097, 756258, 756513, 756705, 756865, 756993, 757121, 757377,
+    757538, 757666, 758369, 758530, 758658, 759297, 759458, 759586, 760321, 760482, 760610, 761633, 761794, 761922, 762785, 763553,
+    764097, 764225, 764737, 764897, 764961, 765345, 765409, 765665, 765729, 765953, 766113, 766465, 766913, 767329, 767489, 767521,
+    767873, 768097, 768321, 768545, 747074, 748289, 751585, 767618, 767938, 768162, 768418, 104129, 259649, 259713, 259746, 752386,
+    0, 0, 0, 0, 0, 777761, 777857, 777921, 777985, 778049, 778081, 778145, 778209, 778241, 778369, 778497,
+    778561, 778657, 778689, 778817, 778849, 778881, 778913, 778945, 779041, 779073, 779201, 779297, 779425, 779489, 779617, 779713,
+    779745, 779841, 779873, 779905, 779937, 780001, 780097, 780129, 780289, 780449, 778017, 778433, 778721, 780481, 779457, 778177,
+    0, 724097, 724513, 740321, 724609, 740449, 740545, 725025, 725441, 725537, 740705, 740801, 740897, 740993, 741089, 741185,
+    731585, 725953, 726369, 726785, 732001, 726881, 727297, 727393, 728289, 728961, 729057, 729633, 730049, 730465, 730881, 735649,
+    735745, 735841, 735937, 736033, 736129, 736225, 736321, 736417, 736513, 736609, 736705, 736801, 736897, 736993, 737089, 737185,
+    737281, 737377, 737473, 737569, 735553, 731329, 731393, 741825, 741889, 742049, 742145, 742337, 742497, 742593, 731713, 742753,
+    742849, 731777, 731841, 731937, 732097, 732161, 732321, 732417, 732513, 732577, 732641, 732705, 732769, 732897, 733057, 733409,
+    733665, 733857, 743457, 743521, 734241, 734305, 734369, 738113, 738177, 738305, 738625, 738689, 738785, 739137, 739265, 0,
+    104161, 104193, 981634, 984898, 982338, 997826, 982530, 983106, 982658, 1028802, 983842, 982786, 981762, 1000322, 998338, 985474,
+    777794, 778978, 778594, 778306, 779521, 779554, 779393, 779330, 780386, 779234, 780162, 780322, 777953, 778465, 779650, 779778,
+    780033, 780065, 779969, 780226, 777889, 778113, 778401, 778529, 779105, 779137, 779169, 778273, 778753, 778785, 780513, 780545,
+    104225, 104257, 104289, 104321, 104353, 104385, 104417, 104449, 104481, 104513, 104545, 104577, 104609, 104641, 104673, 104705,
+    104737, 104769, 104801, 104833, 104865, 104897, 104929, 104961, 104993, 105025, 105057, 105089, 105121, 105153, 105185, 105217,
+    105249, 105281, 105313, 105345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    750625, 753153, 753665, 756065, 756833, 757345, 758337, 759265, 760289, 761601, 764065, 765921, 766081, 766433, 766881, 767297,
+    724131, 724643, 725059, 725571, 725987, 726403, 726915, 727427, 728323, 729091, 729667, 730083, 730499, 730915, 724292, 724804,
+    725220, 725732, 726148, 726564, 727076, 727588, 728484, 729252, 729828, 730244, 730660, 731076, 728676, 727783, 728006, 0,
+    981444, 984580, 982020, 997636, 985028, 988356, 981828, 988100, 984132, 992868, 1015652, 1023716, 1020452, 1016516, 1053540, 998148,
+    1014212, 1017540, 1016004, 1032420, 995332, 1026148, 1048868, 1032932, 991460, 985732, 995972, 1001732, 1030436, 986052, 1049316, 993316,
+    1033252, 986244, 1040420, 1040676, 996418, 1005762, 1013378, 1035010, 263074, 270722, 274754, 276802, 278402, 279554, 280514, 281570,
+    341955, 271042, 271362, 271810, 272226, 272546, 272834, 273026, 273218, 273410, 274754, 274946, 275138, 275202, 275266, 275426,
+    724225, 724737, 725153, 725665, 726081, 726497, 727009, 727521, 728417, 729185, 729761, 730177, 730593, 731009, 724418, 724930,
+    725346, 725858, 726274, 726690, 727202, 727714, 728610, 729378, 729954, 730370, 730786, 731202, 729445, 728804, 728194, 105377,
+    981570, 984834, 982274, 997762, 985154, 988482, 981954, 988226, 984258, 992994, 1015778, 1023842, 1020578, 1016642, 1053666, 998274,
+    1014338, 1017666, 1016130, 1032546, 995458, 1026274, 1048994, 1033058, 991586, 1033954, 1028930, 1000898, 1051970, 987330, 993890, 1021218,
+    1057506, 986370, 989218, 1019202, 982466, 983042, 982594, 1004866, 995074, 992674, 1002178, 1001858, 1030562, 986178, 1049442, 993442,
+    1000002, 275586, 275650, 275714, 275874, 276802, 276866, 276930, 276994, 277058, 277122, 277282, 277346, 277410, 277474, 278402,
+    269795, 273987, 276099, 277699, 278851, 279811, 280867, 281795, 282595, 263268, 264068, 264964, 311746, 303811, 303906, 323971,
+    745729, 746497, 746977, 747457, 748001, 748385, 749249, 750721, 751681, 752033, 752641, 753249, 753761, 754017, 754465, 754721,
+    755105, 755457, 755713, 756161, 756577, 756769, 756929, 757057, 757185, 757441, 758433, 759361, 760385, 761697, 762849, 763617,
+    764161, 764289, 764801, 765025, 765473, 765793, 766017, 766177, 766529, 766977, 767393, 767585, 767905, 768129, 768385, 985924,
+    745861, 746020, 746149, 745763, 746533, 746691, 747139, 747622, 747492, 748131, 748035, 748547, 748644, 748772, 748900, 749028,
+    749412, 749540, 749668, 749798, 749986, 750054, 750246, 750437, 750884, 751014, 751206, 751396, 751843, 752451, 752196, 752836,
+    752965, 753477, 754179, 754275, 754884, 755939, 756323, 756418, 756610, 757219, 758211, 757734, 757924, 758053, 758726, 758916,
+    759043, 759139, 759654, 759844, 759974, 760163, 760965, 761123, 761220, 761347, 761444, 760677, 760836, 762181, 762404, 762530,
+    762597, 761987, 762083, 762884, 763011, 763171, 763267, 763365, 763652, 763778, 763846, 764451, 764549, 764324, 765060, 765187,
+    765507, 766212, 766338, 766724, 766565, 767010, 767078, 767683, 262179, 269891, 274083, 276195, 277795, 278947, 279907, 280963,
+    281891, 282691, 263396, 264196, 265092, 265732, 266372, 267012, 267652, 268292, 268932, 269572, 270916, 271236, 271684, 272100,
+    272420, 312067, 297762, 289858, 292099, 338978, 341314, 298082, 298147, 298243, 316194, 1005508, 1014756, 1000196, 1014500, 1017736,
+    341122, 330370, 387938, 326402, 319618, 319682, 326530, 308834, 294307, 319748, 341378, 330530, 388002, 388066, 326722, 319874,
+    312226, 319939, 326787, 308899, 353411, 388130, 326978, 298018, 320098, 306434, 330850, 388194, 327042, 294786, 320162, 327107,
+    294851, 326274, 320291, 327203, 294947, 326338, 320387, 327555, 327716, 341186, 320483, 327395, 308995, 345603, 345701, 345862,
+    341890, 330978, 388258, 327650, 342050, 331042, 388322, 327842, 320642, 327906, 342114, 331106, 388386, 327970, 320706, 328034,
+    320770, 328098, 289188, 292194, 294402, 294530, 294596, 295139, 297890, 309090, 311522, 312002, 316130, 320034, 320226, 320578,
+    323426, 323490, 323555, 324066, 326466, 326883, 327299, 341442, 341508, 341635, 341826, 350242, 350722, 364738, 362531, 289315,
+    269699, 273891, 276003, 277603, 278755, 279715, 280771, 281699, 282499, 263140, 263940, 264836, 265604, 266244, 266884, 267524,
+    268164, 268804, 269444, 270788, 271108, 271556, 271972, 272292, 272708, 272900, 273092, 273284, 273476, 274820, 275012, 308739,
+    105409, 105441, 105473, 105505, 105537, 105569, 105601, 105633, 105665, 105697, 105729, 105761, 105793, 105825, 105857, 105889,
+    105921, 105953, 105985, 106017, 106049, 106081, 106113, 106145, 106177, 106209, 106241, 106273, 106305, 106337, 106369, 106401,
+    106433, 106465, 106497, 106529, 106561, 106593, 106625, 106657, 106689, 106721, 106753, 106785, 106817, 106849, 106881, 106913,
+    106945, 106977, 107009, 107041, 107073, 107105, 107137, 107169, 107201, 107233, 107265, 107297, 107329, 107361, 107393, 107425,
+    780577, 780609, 780641, 780673, 780705, 780737, 780769, 780801, 780833, 780865, 780897, 780929, 780961, 780993, 781025, 781057,
+    781089, 781121, 781153, 781185, 781217, 781249, 781281, 781313, 781345, 781377, 781409, 781441, 781473, 781505, 781537, 781569,
+    781601, 781633, 781665, 781697, 781729, 781761, 781793, 781825, 781857, 781889, 781921, 781953, 781985, 782017, 782049, 782081,
+    782113, 782145, 782177, 782209, 782241, 782273, 782305, 782337, 782369, 782401, 782433, 782465, 782497, 782529, 782561, 782593,
+    782625, 782657, 782689, 782721, 782753, 782785, 782817, 782849, 782881, 782913, 782945, 782977, 783009, 783041, 783073, 783105,
+    783137, 783169, 783201, 783233, 783265, 783297, 783329, 783361, 783393, 783425, 783457, 783489, 783521, 783553, 783585, 783617,
+    783649, 783681, 783713, 783745, 783777, 783809, 783841, 783873, 783905, 783937, 783969, 784001, 784033, 784065, 784097, 784129,
+    784161, 784193, 784225, 784257, 784289, 784321, 784353, 784385, 784417, 784449, 784481, 784513, 784545, 784577, 784609, 784641,
+    784673, 784705, 784737, 784769, 784801, 784833, 784865, 784897, 784929, 784961, 784993, 785025, 785057, 785089, 785121, 785153,
+    785185, 785217, 785249, 785281, 785313, 785345, 785377, 785409, 785441, 785473, 785505, 785537, 785569, 785601, 785633, 785665,
+    785697, 785729, 785761, 785793, 785825, 785857, 785889, 785921, 785953, 785985, 786017, 786049, 786081, 786113, 786145, 786177,
+    786209, 786241, 786273, 786305, 786337, 786369, 786401, 786433, 786465, 786497, 786529, 786561, 786593, 786625, 786657, 786689,
+    786721, 786753, 786785, 786817, 786849, 786881, 786913, 786945, 786977, 787009, 787041, 787073, 787105, 787137, 787169, 787201,
+    787233, 787265, 787297, 787329, 787361, 787393, 787425, 787457, 787489, 787521, 787553, 787585, 787617, 787649, 787681, 787713,
+    787745, 787777, 787809, 787841, 787873, 787905, 787937, 787969, 788001, 788033, 788065, 788097, 788129, 788161, 788193, 788225,
+    788257, 788289, 788321, 788353, 788385, 788417, 788449, 788481, 788513, 788545, 788577, 788609, 788641, 788673, 788705, 788737,
+    788769, 788801, 788833, 788865, 788897, 788929, 788961, 788993, 789025, 789057, 789089, 789121, 789153, 789185, 789217, 789249,
+    789281, 789313, 789345, 789377, 789409, 789441, 789473, 789505, 789537, 789569, 789601, 789633, 789665, 789697, 789729, 789761,
+    789793, 789825, 789857, 789889, 789921, 789953, 789985, 790017, 790049, 790081, 790113, 790145, 790177, 790209, 790241, 790273,
+    790305, 790337, 790369, 790401, 790433, 790465, 790497, 790529, 790561, 790593, 790625, 790657, 790689, 790721, 790753, 790785,
+    790817, 790849, 790881, 790913, 790945, 790977, 791009, 791041, 791073, 791105, 791137, 791169, 791201, 791233, 791265, 791297,
+    791329, 791361, 791393, 791425, 791457, 791489, 791521, 791553, 791585, 791617, 791649, 791681, 791713, 791745, 791777, 791809,
+    791841, 791873, 791905, 791937, 791969, 792001, 792033, 792065, 792097, 792129, 792161, 792193, 792225, 792257, 792289, 792321,
+    792353, 792385, 792417, 792449, 792481, 792513, 792545, 792577, 792609, 792641, 792673, 792705, 792737, 792769, 792801, 792833,
+    792865, 792897, 792929, 792961, 792993, 793025, 793057, 793089, 793121, 793153, 793185, 793217, 793249, 793281, 793313, 793345,
+    793377, 793409, 793441, 793473, 793505, 793537, 793569, 793601, 793633, 793665, 793697, 793729, 793761, 793793, 793825, 793857,
+    793889, 793921, 793953, 793985, 794017, 794049, 794081, 794113, 794145, 794177, 794209, 794241, 794273, 794305, 794337, 794369,
+    794401, 794433, 794465, 794497, 794529, 794561, 794593, 794625, 794657, 794689, 794721, 794753, 794785, 794817, 794849, 794881,
+    794913, 794945, 794977, 795009, 795041, 795073, 795105, 795137, 795169, 795201, 795233, 795265, 795297, 795329, 795361, 795393,
+    795425, 795457, 795489, 795521, 795553, 795585, 795617, 795649, 795681, 795713, 795745, 795777, 795809, 795841, 795873, 795905,
+    795937, 795969, 796001, 796033, 796065, 796097, 796129, 796161, 796193, 796225, 796257, 796289, 796321, 796353, 796385, 796417,
+    796449, 796481, 796513, 796545, 796577, 796609, 796641, 796673, 796705, 796737, 796769, 796801, 796833, 796865, 796897, 796929,
+    796961, 796993, 797025, 797057, 797089, 797121, 797153, 797185, 797217, 797249, 797281, 797313, 797345, 797377, 797409, 797441,
+    797473, 797505, 797537, 797569, 797601, 797633, 797665, 797697, 797729, 797761, 797793, 797825, 797857, 797889, 797921, 797953,
+    797985, 798017, 798049, 798081, 798113, 798145, 798177, 798209, 798241, 798273, 798305, 798337, 798369, 798401, 798433, 798465,
+    798497, 798529, 798561, 798593, 798625, 798657, 798689, 798721, 798753, 798785, 798817, 798849, 798881, 798913, 798945, 798977,
+    799009, 799041, 799073, 799105, 799137, 799169, 799201, 799233, 799265, 799297, 799329, 799361, 799393, 799425, 799457, 799489,
+    799521, 799553, 799585, 799617, 799649, 799681, 799713, 799745, 799777, 799809, 799841, 799873, 799905, 799937, 799969, 800001,
+    800033, 800065, 800097, 800129, 800161, 800193, 800225, 800257, 800289, 800321, 800353, 800385, 800417, 800449, 800481, 800513,
+    800545, 800577, 800609, 800641, 800673, 800705, 800737, 800769, 800801, 800833, 800865, 800897, 800929, 800961, 800993, 801025,
+    801057, 801089, 801121, 801153, 801185, 801217, 801249, 801281, 801313, 801345, 801377, 801409, 801441, 801473, 801505, 801537,
+    801569, 801601, 801633, 801665, 801697, 801729, 801761, 801793, 801825, 801857, 801889, 801921, 801953, 801985, 802017, 802049,
+    802081, 802113, 802145, 802177, 802209, 802241, 802273, 802305, 802337, 802369, 802401, 802433, 802465, 802497, 802529, 802561,
+    802593, 802625, 802657, 802689, 802721, 802753, 802785, 802817, 802849, 802881, 802913, 802945, 802977, 803009, 803041, 803073,
+    803105, 803137, 803169, 803201, 803233, 803265, 803297, 803329, 803361, 803393, 803425, 803457, 803489, 803521, 803553, 803585,
+    803617, 803649, 803681, 803713, 803745, 803777, 803809, 803841, 803873, 803905, 803937, 803969, 804001, 804033, 804065, 804097,
+    804129, 804161, 804193, 804225, 804257, 804289, 804321, 804353, 804385, 804417, 804449, 804481, 804513, 804545, 804577, 804609,
+    804641, 804673, 804705, 804737, 804769, 804801, 804833, 804865, 804897, 804929, 804961, 804993, 805025, 805057, 805089, 805121,
+    805153, 805185, 805217, 805249, 805281, 805313, 805345, 805377, 805409, 805441, 805473, 805505, 805537, 805569, 805601, 805633,
+    805665, 805697, 805729, 805761, 805793, 805825, 805857, 805889, 805921, 805953, 805985, 806017, 806049, 806081, 806113, 806145,
+    806177, 806209, 806241, 806273, 806305, 806337, 806369, 806401, 806433, 806465, 806497, 806529, 806561, 806593, 806625, 806657,
+    806689, 806721, 806753, 806785, 806817, 806849, 806881, 806913, 806945, 806977, 807009, 807041, 807073, 807105, 807137, 807169,
+    807201, 807233, 807265, 807297, 807329, 807361, 807393, 807425, 807457, 807489, 807521, 807553, 807585, 807617, 807649, 807681,
+    807713, 807745, 807777, 807809, 807841, 807873, 807905, 807937, 807969, 808001, 808033, 808065, 808097, 808129, 808161, 808193,
+    808225, 808257, 808289, 808321, 808353, 808385, 808417, 808449, 808481, 808513, 808545, 808577, 808609, 808641, 808673, 808705,
+    808737, 808769, 808801, 808833, 808865, 808897, 808929, 808961, 808993, 809025, 809057, 809089, 809121, 809153, 809185, 809217,
+    809249, 809281, 809313, 809345, 809377, 809409, 809441, 809473, 809505, 809537, 809569, 809601, 809633, 809665, 809697, 809729,
+    809761, 809793, 809825, 809857, 809889, 809921, 809953, 809985, 810017, 810049, 810081, 810113, 810145, 810177, 810209, 810241,
+    810273, 810305, 810337, 810369, 810401, 810433, 810465, 810497, 810529, 810561, 810593, 810625, 810657, 810689, 810721, 810753,
+    810785, 810817, 810849, 810881, 810913, 810945, 810977, 811009, 811041, 811073, 811105, 811137, 811169, 811201, 811233, 811265,
+    811297, 811329, 811361, 811393, 811425, 811457, 811489, 811521, 811553, 811585, 811617, 811649, 811681, 811713, 811745, 811777,
+    811809, 811841, 811873, 811905, 811937, 811969, 812001, 812033, 812065, 812097, 812129, 812161, 812193, 812225, 812257, 812289,
+    812321, 812353, 812385, 812417, 812449, 812481, 812513, 812545, 812577, 812609, 812641, 812673, 812705, 812737, 812769, 812801,
+    812833, 812865, 812897, 812929, 812961, 812993, 813025, 813057, 813089, 813121, 813153, 813185, 813217, 813249, 813281, 813313,
+    813345, 813377, 813409, 813441, 813473, 813505, 813537, 813569, 813601, 813633, 813665, 813697, 813729, 813761, 813793, 813825,
+    813857, 813889, 813921, 813953, 813985, 814017, 814049, 814081, 814113, 814145, 814177, 814209, 814241, 814273, 814305, 814337,
+    814369, 814401, 814433, 814465, 814497, 814529, 814561, 814593, 814625, 814657, 814689, 814721, 814753, 814785, 814817, 814849,
+    814881, 814913, 814945, 814977, 815009, 815041, 815073, 815105, 815137, 815169, 815201, 815233, 815265, 815297, 815329, 815361,
+    815393, 815425, 815457, 815489, 815521, 815553, 815585, 815617, 815649, 815681, 815713, 815745, 815777, 815809, 815841, 815873,
+    815905, 815937, 815969, 816001, 816033, 816065, 816097, 816129, 816161, 816193, 816225, 816257, 816289, 816321, 816353, 816385,
+    816417, 816449, 816481, 816513, 816545, 816577, 816609, 816641, 816673, 816705, 816737, 816769, 816801, 816833, 816865, 816897,
+    816929, 816961, 816993, 817025, 817057, 817089, 817121, 817153, 817185, 817217, 817249, 817281, 817313, 817345, 817377, 817409,
+    817441, 817473, 817505, 817537, 817569, 817601, 817633, 817665, 817697, 817729, 817761, 817793, 817825, 0, 0, 0,
+    107457, 107489, 107521, 107553, 107585, 107617, 107649, 107681, 107713, 107745, 107777, 107809, 107841, 107873, 107905, 107937,
+    107969, 108001, 108033, 108065, 108097, 108129, 108161, 108193, 108225, 108257, 108289, 108321, 108353, 108385, 108417, 108449,
+    108481, 108513, 108545, 108577, 108609, 108641, 108673, 108705, 108737, 108769, 108801, 108833, 108865, 108897, 108929, 108961,
+    108993, 109025, 109057, 109089, 109121, 109153, 109185, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    818049, 818081, 818113, 818145, 818177, 818209, 818241, 818273, 818305, 818337, 818369, 818401, 818433, 818465, 818497, 818529,
+    818561, 818593, 818625, 818657, 818689, 818721, 818753, 818785, 818817, 818849, 818945, 818881, 818977, 818913, 819041, 819073,
+    819105, 819137, 819169, 819201, 819233, 819265, 819297, 819329, 817857, 817889, 817921, 817953, 818017, 817985, 109217, 109249,
+    682177, 682209, 682241, 682273, 682305, 682337, 682369, 682401, 682433, 682465, 682497, 682529, 682561, 682657, 682689, 682721,
+    682753, 682785, 682817, 682849, 682881, 682913, 682945, 682977, 683009, 683041, 683073, 683105, 683137, 683169, 683201, 683297,
+    683329, 683361, 683393, 683425, 683457, 683489, 683521, 683553, 683585, 683617, 683649, 683681, 683713, 683745, 683777, 683809,
+    683841, 683873, 683905, 683937, 684033, 684065, 684097, 684129, 684161, 684193, 684225, 684257, 684289, 684321, 684353, 684385,
+    684417, 684449, 684481, 684513, 684545, 684577, 684609, 684641, 684737, 684769, 684801, 684833, 684865, 684897, 684929, 684961,
+    684993, 685025, 685057, 685153, 685185, 685217, 685249, 685281, 685313, 685441, 685473, 685569, 685601, 685633, 685665, 685697,
+    685729, 685825, 685857, 685889, 685921, 685953, 685985, 686017, 686049, 686081, 686113, 686177, 686209, 686241, 686273, 686337,
+    686369, 686401, 686433, 686465, 686497, 686529, 686561, 686593, 686625, 686657, 686689, 686721, 686753, 686785, 686817, 686849,
+    686881, 686913, 686945, 686977, 687009, 687041, 687137, 687169, 687233, 687265, 687297, 687329, 687361, 687393, 687425, 687457,
+    687489, 687521, 687553, 687585, 687617, 687649, 687681, 687713, 687745, 687777, 687809, 687841, 687873, 687905, 687937, 687969,
+    688001, 688033, 688065, 688097, 688129, 688161, 688193, 688225, 688257, 688289, 688321, 688353, 688385, 688417, 688449, 688481,
+    688513, 688545, 688577, 688609, 688641, 688737, 688769, 688801, 688833, 688865, 688897, 688929, 688961, 688993, 689025, 689057,
+    689089, 689121, 689153, 689185, 689217, 689249, 689281, 689313, 689345, 689377, 689409, 689441, 689537, 689569, 689601, 689633,
+    689665, 689697, 689825, 689857, 689889, 689921, 689953, 689985, 690017, 690113, 690145, 690177, 690209, 690241, 690273, 690305,
+    690337, 690369, 690401, 690433, 690465, 690497, 690529, 690561, 690593, 690625, 690657, 690689, 690721, 690753, 690785, 690817,
+    690849, 690881, 690913, 690945, 690977, 691009, 691041, 691073, 691105, 691137, 691169, 691201, 691233, 691265, 691297, 691329,
+    691361, 691393, 691425, 691457, 691489, 691521, 691553, 691585, 691617, 691649, 691681, 691713, 691745, 109281, 109313, 109345,
+    685345, 686145, 687201, 682594, 683234, 683970, 684674, 685090, 685378, 685506, 685762, 687074, 688674, 689474, 689762, 690050,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 686305, 689729, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    406017, 405985, 406209, 406177, 406337, 406305, 407457, 407425, 407681, 407617, 412353, 412289, 413217, 413185, 414817, 414785,
+    415073, 415041, 415649, 415617, 416001, 415969, 416097, 416033, 416481, 416449, 416641, 416609, 416769, 416737, 417345, 417313,
+    413505, 413473, 404481, 404449, 408865, 408833, 409217, 409185, 409985, 409921, 409985, 409921, 409985, 409921, 409921, 251233,
+    1, 1, 1, 109377, 405153, 406657, 407298, 411585, 414945, 415137, 415361, 413057, 250209, 250209, 109409, 414881,
+    404353, 404321, 406593, 406561, 405665, 405633, 414305, 414273, 406465, 406433, 411457, 411425, 411265, 411233, 413569, 413537,
+    413697, 413665, 414049, 414017, 412993, 412961, 414657, 414625, 409985, 409921, 409985, 409921, 415009, 415425, 412481, 416289,
+    691777, 691809, 691841, 691873, 691905, 691937, 691969, 692001, 692033, 692065, 692097, 692129, 692161, 692193, 692225, 692257,
+    692289, 692321, 692353, 692385, 692417, 692449, 692481, 692513, 692545, 692577, 692609, 692641, 692673, 692705, 692737, 692769,
+    692801, 692833, 692865, 692897, 692929, 692961, 692993, 693025, 693057, 693089, 693121, 693153, 693185, 693217, 693249, 693281,
+    693313, 693345, 693377, 693409, 693441, 693473, 693505, 693537, 693569, 693601, 693633, 693665, 693697, 693729, 693761, 693793,
+    693825, 693857, 693889, 693921, 693953, 693985, 694017, 694049, 694081, 694113, 694145, 694177, 694209, 694241, 694273, 694305,
+    255489, 255521, 109441, 109473, 109505, 109537, 109569, 109601, 0, 0, 0, 0, 0, 0, 0, 0,
+    109633, 109665, 109697, 109729, 109761, 109793, 109825, 109857, 109889, 109921, 109953, 109985, 110017, 110049, 110081, 110113,
+    110145, 110177, 110209, 110241, 110273, 110305, 110337, 110369, 110401, 110433, 110465, 110497, 110529, 110561, 110593, 110625,
+    110657, 110689, 372513, 372481, 372897, 372865, 312737, 312705, 353826, 353762, 371841, 371809, 371905, 371873, 371969, 371937,
+    306689, 350785, 288162, 288098, 289474, 289410, 289794, 289730, 289986, 289922, 290147, 290051, 290306, 290242, 295905, 295873,
+    321057, 321025, 321121, 321089, 321185, 321153, 324321, 324289, 324417, 324385, 340033, 340001, 339713, 339681, 338914, 338850,
+    342305, 342273, 342497, 342465, 342561, 342529, 343329, 343297, 343393, 343361, 346337, 346273, 347329, 347297, 362977, 362945,
+    362850, 362786, 370625, 370593, 371169, 371137, 371233, 371201, 371361, 371329, 371521, 371489, 371585, 371553, 371681, 371617,
+    371713, 299457, 325089, 328481, 331745, 347233, 347265, 354305, 371745, 297698, 297634, 305890, 305826, 308674, 309601, 309569,
+    325185, 325153, 345538, 345474, 349698, 349634, 353090, 353026, 110721, 110753, 110785, 372577, 372545, 360609, 325025, 372609,
+    331553, 331521, 295585, 295553, 295617, 312385, 292481, 292449, 306785, 306753, 286050, 285922, 334082, 333954, 355938, 355810,
+    308546, 308482, 319298, 319234, 329922, 329858, 344706, 344642, 349122, 349058, 312449, 304801, 309185, 324801, 316609, 343265,
+    321249, 354369, 318113, 366561, 292737, 292673, 340129, 340097, 360353, 360321, 290593, 290561, 317025, 316993, 360545, 360513,
+    0, 0, 364993, 364961, 295649, 350977, 370241, 299105, 299073, 350849, 350817, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 312673, 312641, 316705, 311138, 338691, 360833, 307009, 342593, 328417, 316673, 328449,
+    537249, 537281, 537313, 537345, 537377, 537409, 537441, 537505, 537537, 537569, 537601, 255937, 537633, 537665, 537697, 537729,
+    537761, 537793, 537825, 537857, 537889, 537921, 537953, 537985, 538017, 538049, 538081, 538113, 538145, 538177, 538209, 538241,
+    538273, 538305, 538337, 538369, 538401, 538433, 538465, 538497, 110817, 110849, 110881, 110913, 537473, 0, 0, 0,
+    110945, 110977, 111009, 111041, 111073, 111105, 111137, 111169, 260385, 111201, 0, 0, 0, 0, 0, 0,
+    599617, 599649, 599681, 599713, 599745, 599777, 599809, 599841, 600001, 600033, 600065, 600097, 600129, 600161, 600193, 600225,
+    600257, 600289, 600321, 600353, 600417, 600449, 600481, 600513, 600609, 600705, 600737, 600801, 600833, 600929, 601089, 601121,
+    601153, 601185, 600961, 600993, 601025, 601057, 601217, 600385, 600545, 599873, 599905, 599937, 599969, 600577, 600769, 600865,
+    600897, 600641, 600673, 601249, 111233, 111265, 111297, 111329, 0, 0, 0, 0, 0, 0, 0, 0,
+    255937, 255969, 538529, 538561, 538593, 538625, 538657, 538689, 538721, 538753, 538785, 538817, 538849, 538881, 538913, 538945,
+    538977, 539009, 539041, 539073, 539105, 539137, 539169, 539201, 539233, 539265, 539297, 539329, 539361, 539393, 539425, 539457,
+    539489, 539521, 539553, 539585, 539617, 539649, 539681, 539713, 539745, 539777, 539809, 539841, 539873, 539905, 539937, 539969,
+    540001, 540033, 540065, 540097, 540129, 540161, 540193, 540225, 540257, 540289, 540321, 540353, 540385, 540417, 540449, 540481,
+    540513, 540545, 540577, 540609, 540641, 255905, 0, 0, 0, 0, 0, 0, 0, 0, 111361, 111393,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 513473, 513505, 513505, 513505, 513505, 513505, 111425, 111457, 111489, 513537, 111521, 510401, 511105, 514209,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 609857, 609889, 609921, 609953, 609985, 610017,
+    610049, 610081, 610113, 610145, 610177, 610209, 610241, 610273, 610305, 610337, 610369, 610401, 610433, 610465, 610497, 610529,
+    610561, 610593, 610625, 610657, 610689, 610721, 610753, 610785, 610817, 610849, 610881, 256961, 256993, 257025, 111553, 111585,
+    608705, 608737, 608769, 608801, 608833, 608865, 608897, 608929, 608961, 608993, 609025, 609057, 609089, 609121, 609153, 609185,
+    609217, 609249, 609281, 609313, 609345, 609377, 609409, 609441, 609473, 609505, 609537, 609569, 609601, 609633, 609665, 609697,
+    609729, 609761, 609793, 609825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111617,
+    734561, 734593, 734625, 734657, 734689, 734721, 734753, 734785, 734817, 734849, 734881, 734913, 734945, 734977, 735009, 735041,
+    735073, 735105, 735137, 735169, 735201, 735233, 735265, 735297, 735329, 735361, 735393, 735425, 735457, 0, 0, 0,
+    255905, 255937, 256129, 255969, 632385, 632417, 632449, 632481, 632513, 632545, 632577, 632609, 632641, 632673, 632705, 632737,
+    632769, 632801, 632833, 632865, 632897, 632929, 632961, 632993, 633025, 633057, 633089, 633121, 633153, 633185, 633217, 633249,
+    633281, 633313, 633345, 633377, 633409, 633441, 633473, 633505, 633537, 633569, 633601, 633665, 633697, 633761, 633793, 633825,
+    633857, 633889, 633921, 255873, 633953, 633985, 634049, 634081, 634113, 634145, 634209, 634241, 634017, 634177, 633633, 633729,
+    634273, 111649, 111681, 111713, 111745, 111777, 111809, 111841, 111873, 111905, 111937, 111969, 112001, 112033, 0, 258849,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 112065, 112097,
+    611201, 611457, 611777, 612481, 613281, 615777, 258881, 612033, 613121, 611137, 611233, 611617, 611841, 612289, 612385, 612513,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 614273, 612673, 612769, 613217, 613313, 0,
+    627937, 627969, 628001, 628033, 628065, 628097, 628129, 628161, 628193, 628225, 628257, 628289, 628321, 628353, 628385, 628417,
+    628449, 628481, 628513, 628545, 628577, 628609, 628641, 628673, 628705, 628737, 628769, 628801, 628833, 628865, 628897, 628929,
+    628961, 628993, 629025, 629057, 629089, 629121, 629153, 629185, 629217, 629377, 629409, 629441, 629473, 629505, 629537, 629569,
+    629601, 629633, 629665, 629249, 629281, 629313, 629345, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    629697, 629729, 629761, 629793, 629825, 629857, 629889, 629921, 629953, 629985, 630017, 630049, 630081, 630113, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 112129, 112161, 112193, 112225,
+    611105, 611393, 611489, 611585, 611809, 612001, 612129, 612193, 612257, 612353, 612737, 612865, 614017, 614113, 614177, 613057,
+    258913, 614209, 611681, 613505, 616545, 616577, 616609, 112257, 112289, 112321, 613537, 616449, 616481, 616513, 611521, 611905,
+    585217, 585249, 585281, 585313, 585345, 585377, 585409, 585441, 585473, 585505, 585537, 585569, 585601, 585633, 585665, 585697,
+    585729, 585761, 585793, 585825, 585857, 585889, 585921, 585953, 585985, 586017, 586049, 586081, 586113, 586145, 586177, 586209,
+    586241, 586273, 586305, 586337, 586369, 586401, 586433, 586465, 586497, 586529, 586561, 586593, 586625, 586657, 586689, 586721,
+    586753, 586785, 586817, 586849, 586881, 2147485821, 2147485967, 586977, 587009, 2147486113, 587073, 2147486259, 2147486405, 587169, 587201, 256865,
+    587233, 256897, 587265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 587297, 587329, 258945, 112353, 112385,
+    536129, 536161, 536193, 536225, 536257, 536289, 536321, 536353, 536385, 536417, 536449, 536737, 536769, 536801, 536833, 536865,
+    112417, 112449, 535233, 258977, 259009, 536897, 537217, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 497921, 497953, 497985, 498017, 498049, 498081, 0, 0, 504289, 504321, 504353, 504385, 504417, 504449, 0,
+    0, 503297, 503329, 503361, 503393, 503425, 503457, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    506433, 506465, 506497, 506529, 506561, 506593, 506625, 0, 507201, 507233, 507265, 507297, 507329, 507361, 507393, 0,
+    290977, 290721, 304001, 304033, 304161, 306721, 309249, 324833, 324673, 324737, 328385, 331713, 331873, 339105, 339393, 339585,
+    339265, 339201, 339233, 339297, 339329, 346113, 346241, 346977, 347009, 346849, 347041, 347073, 347105, 351297, 359969, 360289,
+    360129, 360161, 360449, 366529, 366593, 366625, 366401, 366433, 366465, 366497, 368609, 112481, 312769, 324865, 324641, 360481,
+    371393, 371425, 339649, 371457, 291137, 398593, 298818, 353634, 347201, 365153, 112513, 112545, 0, 0, 0, 0,
+    639681, 639745, 639809, 639873, 639937, 640001, 640065, 640129, 640193, 640257, 640321, 640385, 640449, 640513, 640577, 640641,
+    640705, 640769, 640833, 640897, 640961, 641025, 641089, 641153, 641217, 641281, 641345, 641409, 641473, 641537, 641601, 641665,
+    641729, 641793, 641857, 641921, 641985, 642049, 642113, 642177, 642241, 642305, 642369, 642433, 642497, 642561, 642625, 642689,
+    642753, 642817, 642881, 642945, 643009, 643073, 643137, 643201, 643265, 643329, 643393, 643457, 643521, 643585, 643649, 643713,
+    643777, 643841, 643905, 643969, 644033, 644097, 644161, 644225, 644289, 644353, 644417, 644481, 644545, 644609, 644673, 644737,
+    535265, 535297, 535329, 535361, 535393, 535425, 535457, 535489, 535521, 535553, 535585, 535617, 535649, 535681, 535713, 535745,
+    535777, 535809, 535841, 535873, 535905, 535937, 535969, 536001, 536033, 536065, 536097, 536929, 536961, 536993, 537025, 537057,
+    537089, 537121, 537153, 536481, 536513, 536545, 536577, 536609, 536641, 536673, 536705, 112577, 256193, 537185, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    739489, 739521, 739553, 739585, 739617, 739649, 739681, 739713, 739745, 739777, 739809, 739841, 739873, 739905, 739937, 739969,
+    740001, 740033, 740065, 740097, 740129, 740161, 740193, 0, 0, 0, 0, 743969, 744001, 744033, 744065, 744097,
+    744129, 744161, 744193, 744225, 744257, 744289, 744321, 744353, 744385, 744417, 744449, 744481, 744513, 744545, 744577, 744609,
+    744641, 744673, 744705, 744737, 744769, 744801, 744833, 744865, 744897, 744929, 744961, 744993, 745025, 745057, 745089, 745121,
+    745153, 745185, 745217, 745249, 745281, 745313, 745345, 745377, 745409, 745441, 745473, 745505, 0, 0, 0, 0,
+    1048546, 1015394, 1050562, 1049506, 1022754, 983234, 994818, 1063650, 1063650, 1000578, 1053410, 996738, 1000514, 1009922, 1029858, 1037986,
+    1044290, 1045314, 1046338, 1052162, 1018562, 1021346, 1024482, 1027458, 1043394, 1052962, 1059234, 984322, 994018, 1018882, 1025058, 1044226,
+    1060834, 1004226, 1023266, 1043970, 1046594, 1011010, 1040162, 1045506, 1006210, 1016258, 1021730, 1026722, 1052450, 986562, 989538, 991970,
+    1012674, 1018754, 1024994, 1030626, 1038690, 1044098, 1044546, 1050370, 1056482, 1060258, 1060770, 1031682, 1033378, 1036546, 1042946, 1054114,
+    1061122, 1047778, 999234, 1006722, 1035330, 1039394, 1026082, 1031810, 1049250, 1056354, 999170, 1003586, 1018626, 1022050, 1022882, 1036290,
+    1036930, 1055234, 991778, 1039842, 989730, 989666, 1034082, 1036610, 1043330, 1055362, 1048226, 1011074, 1018562, 1047970, 983522, 1002370,
+    1008450, 1027042, 1029250, 992482, 1031938, 986818, 1007842, 982722, 1021026, 1013250, 1036226, 994434, 998914, 1030914, 1043458, 1047522,
+    1019810, 1051266, 1020898, 1011330, 1042306, 1011842, 1029186, 985346, 987970, 989602, 1018050, 1035842, 1041410, 1047714, 1053346, 992098,
+    995778, 1000770, 1006466, 1013826, 1023330, 1032002, 1054754, 1059362, 1061250, 1061826, 991202, 1015266, 1019330, 1051010, 1005634, 1009538,
+    1009986, 1012546, 1023074, 1024674, 1028034, 1033890, 1036738, 1039266, 1050754, 1043586, 1051778, 1054178, 990498, 991330, 996226, 1024418,
+    1046018, 1047522, 1006146, 1008322, 1011714, 1019682, 1035266, 1026850, 985858, 997890, 1002370, 1004546, 1008514, 1027394, 1027842, 1038434,
+    1039138, 1053730, 1056290, 1056546, 1057634, 986626, 1033698, 1053090, 1055810, 1008898, 984450, 987202, 1002434, 1003458, 1013506, 1018562,
+    1024866, 1029794, 1043778, 1052098, 1063298, 1015010, 1055170, 991138, 1017090, 1017282, 1021602, 1022498, 1027586, 1029122, 1031618, 1036162,
+    1057826, 988290, 1010242, 1055426, 986946, 1004098, 1022114, 1050818, 1007586, 1009026, 1017410, 1027042, 1055554, 990626, 995522, 1003714,
+    1014626, 1016834, 1018242, 1021154, 1027522, 1029538, 1037858, 1046082, 1046274, 1053218, 1056002, 992738, 1022562, 995586, 1024930, 1028098,
+    1044034, 1055618, 1060386, 1061314, 1017218, 1021986, 1040290, 1034594, 1034946, 1035522, 1026658, 1024162, 1048162, 985602, 1042562, 990690,
+    990434, 1005890, 1011138, 1035714, 1001986, 1021410, 1015202, 1050946, 1045634, 1055298, 1046914, 1006338, 987458, 997122, 1064098, 1064162,
+    998850, 1064226, 1014946, 1064290, 1064354, 989794, 1026786, 1030178, 1032290, 1033122, 1033186, 1033634, 1056738, 1035586, 1038498, 1064418,
+    1044162, 1064482, 1047906, 1064546, 1064610, 1051842, 1052642, 1064674, 1064738, 1064802, 1058498, 1058562, 1058626, 1060706, 1052514, 1055746,
+    986690, 987266, 987586, 991714, 992034, 993250, 996866, 997314, 997442, 998786, 998978, 1003650, 1003778, 1008706, 1009346, 1009474,
+    1009858, 1012930, 1014018, 1015074, 1018114, 1021794, 1022242, 1023010, 1024738, 1025250, 1027650, 1031746, 1032354, 1032674, 1032610, 1032738,
+    1032802, 1032866, 1033506, 1033570, 1034146, 1034466, 1035074, 1036738, 1036866, 1036994, 1037794, 1038882, 1040546, 1041602, 1041602, 1043522,
+    1046466, 1047042, 1048034, 1048098, 1049570, 1049634, 1051458, 1051842, 1056066, 1057378, 1057762, 1008578, 1071906, 1041154, 0, 0,
+    982850, 989474, 987906, 986498, 987522, 988610, 991650, 992226, 996866, 996546, 996802, 997250, 998850, 999106, 1000450, 1000642,
+    1001218, 1001474, 1006274, 1006402, 1007394, 1007906, 1008834, 1009218, 1008962, 1009474, 1009282, 1009858, 1010306, 1011970, 1012162, 1012290,
+    1012994, 1014946, 1016258, 1016322, 1016962, 1019394, 1019810, 1021602, 1022818, 1022690, 1023010, 1023458, 1024738, 1031298, 1025474, 1026594,
+    1026786, 1027906, 1028354, 1028994, 1029666, 1029730, 1030178, 1030370, 1030850, 1031170, 1031106, 1031874, 1034530, 1035074, 1035458, 1036418,
+    1036738, 1037250, 1038882, 1042626, 1043266, 1045186, 1046530, 1046850, 1047042, 1047586, 1047906, 1047650, 1048034, 1047970, 1047842, 1048098,
+    1048290, 1049634, 1050882, 1052034, 1053026, 1053858, 1055490, 1056066, 1056738, 1057058, 1057378, 1057570, 1057762, 1059778, 1063650, 1070562,
+    1070498, 1071138, 1066210, 1066850, 1066914, 1072802, 1073378, 1074914, 1062786, 1063522, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    306050, 306306, 306370, 306115, 306211, 350627, 350562, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 430274, 430082, 430146, 431010, 430210, 0, 0, 0, 0, 0, 433122, 251745, 433443,
+    434369, 431681, 432353, 432481, 433569, 433857, 433985, 434913, 435457, 112609, 435106, 435042, 435331, 435235, 431714, 431778,
+    431842, 432034, 432226, 432386, 432514, 432674, 432898, 0, 433026, 433186, 433698, 433634, 433890, 0, 434050, 0,
+    434178, 434274, 0, 434530, 434466, 0, 434722, 434818, 434946, 435170, 435490, 432610, 432098, 433762, 434594, 431906,
+    437537, 437505, 442689, 442657, 442593, 442625, 442849, 442817, 442753, 442785, 443009, 442977, 442913, 442945, 447585, 447553,
+    447489, 447521, 447809, 447777, 447713, 447745, 447425, 447393, 447329, 447361, 469409, 469377, 469313, 469345, 469633, 469601,
+    469537, 469569, 449761, 449729, 449665, 449697, 449601, 449569, 449505, 449537, 449921, 449889, 449825, 449857, 450113, 450081,
+    450017, 450049, 452993, 452961, 452897, 452865, 453121, 453089, 452705, 452673, 454241, 454209, 453953, 453921, 473025, 472993,
+    472929, 472961, 473537, 473505, 473441, 473473, 473953, 473921, 473857, 473889, 473761, 473729, 473665, 473697, 482305, 482273,
+    482497, 482465, 482401, 482433, 484162, 484098, 483841, 483809, 483745, 483777, 483681, 483649, 483585, 483617, 488513, 488481,
+    488674, 488610, 112641, 112673, 112705, 112737, 112769, 112801, 112833, 112865, 112897, 112929, 112961, 112993, 113025, 113057,
+    113089, 113121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 473313, 473281, 473217, 473249, 484865, 484833, 484769, 484737, 485089, 485057, 484962, 485313, 485281,
+    484673, 484641, 485185, 485153, 488129, 488097, 488033, 488065, 485537, 485569, 438082, 438018, 439106, 439042, 439234, 439170,
+    439490, 439426, 439362, 439298, 439618, 439554, 440130, 440066, 440002, 439810, 439746, 439682, 487905, 487873, 487809, 487841,
+    438210, 438338, 438786, 439810, 439938, 441218, 441346, 441570, 442050, 442370, 442498, 443778, 444194, 444610, 445282, 446082,
+    446210, 446466, 446850, 447106, 447234, 448194, 448770, 450530, 450754, 451522, 451586, 451714, 454882, 455266, 455554, 456066,
+    460034, 461538, 462306, 462434, 462754, 463202, 463906, 464098, 465122, 465506, 465954, 466914, 467042, 468130, 468258, 468386,
+    468706, 468930, 469058, 470050, 470274, 470786, 470914, 471394, 471522, 471650, 471778, 472034, 472290, 472706, 472834, 474978,
+    475586, 476098, 476546, 477026, 477154, 477826, 478338, 478882, 479362, 479522, 479586, 480002, 480706, 481122, 481506, 482018,
+    482146, 483042, 483170, 483426, 483490, 486146, 486370, 486594, 486978, 487586, 487714, 452578, 453442, 485730, 252354, 252546,
+    252834, 253154, 253442, 253666, 438466, 438530, 438722, 438850, 439746, 439874, 441730, 441794, 441986, 442114, 442306, 442434,
+    444962, 445026, 445218, 445826, 446018, 446146, 446530, 446594, 446786, 446914, 447042, 447170, 468866, 468994, 470722, 470850,
+    471330, 471970, 472226, 472642, 472770, 476482, 476962, 477090, 477698, 479298, 481186, 481250, 481442, 481762, 481954, 482082,
+    485666, 486658, 486722, 486914, 487330, 487522, 487650, 438146, 438274, 438402, 438594, 438914, 441154, 441282, 441506, 441858,
+    442178, 443714, 444130, 444546, 445090, 445890, 446658, 448130, 448706, 450466, 450690, 451458, 451650, 454754, 455138, 455426,
+    455938, 459970, 460386, 461474, 462242, 462370, 462690, 463138, 463842, 464994, 465442, 465890, 466850, 466978, 468066, 468194,
+    468322, 468642, 469986, 470210, 471458, 471586, 471714, 471842, 472098, 474914, 475522, 476034, 476354, 476898, 477762, 478274,
+    478818, 479234, 479938, 480642, 481058, 481314, 481826, 482978, 483106, 482914, 486082, 486306, 486530, 486786, 487394, 438658,
+    438978, 441922, 442242, 445154, 445954, 446722, 446978, 456002, 456674, 458530, 459170, 471906, 472162, 476418, 481378, 481890,
+    486850, 487458, 252770, 253090, 253378, 464610, 464738, 466466, 466594, 467458, 467586, 456802, 456930, 459298, 459426, 451074,
+    451202, 449282, 449410, 451842, 451970, 461858, 461986, 463330, 463458, 457378, 457730, 458274, 458658, 458402, 455874, 460514,
+    463074, 464546, 464674, 466402, 466530, 467394, 467522, 456738, 456866, 459234, 459362, 451010, 451138, 449218, 449346, 451778,
+    451906, 461794, 461922, 463266, 463394, 457314, 457666, 458210, 458594, 458338, 455810, 460450, 463010, 457186, 457538, 458082,
+    458466, 456610, 459106, 463970, 454818, 455202, 455490, 457250, 457602, 458146, 464034, 465058, 440450, 440514, 113153, 113185,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    443843, 444355, 444259, 444451, 444675, 445347, 445443, 445539, 448931, 448835, 450915, 450819, 455331, 454947, 455043, 456323,
+    456227, 456131, 456515, 456419, 460195, 460099, 461699, 457891, 457795, 457443, 458819, 458723, 459011, 458915, 462499, 462915,
+    462819, 464259, 464163, 464355, 464451, 465667, 466115, 466019, 466211, 467107, 467299, 467203, 468547, 468451, 470435, 470531,
+    475747, 475939, 475843, 475043, 475139, 476259, 476163, 476707, 476611, 478403, 478499, 478723, 477891, 478083, 478947, 479043,
+    0, 0, 477987, 483235, 483331, 480771, 480867, 480355, 480259, 480451, 481667, 481571, 487139, 487043, 441635, 444035,
+    443939, 444867, 444771, 445731, 445635, 449123, 448259, 449027, 455619, 460291, 457987, 462595, 475427, 476803, 486435, 486211,
+    487235, 479427, 470627, 480963, 470339, 475651, 466307, 472547, 480067, 479139, 475235, 472451, 475331, 480163, 448355, 450595,
+    478179, 468771, 441411, 472355, 465571, 461603, 455715, 480547, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    461379, 470115, 440772, 440644, 478596, 460580, 453508, 465764, 484452, 460707, 460818, 448456, 453636, 113217, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    113249, 113281, 113313, 113345, 113377, 113409, 113441, 113473, 113505, 113539, 0, 0, 0, 0, 0, 0,
+    251169, 1, 251137, 1, 1, 1, 1, 250241, 1, 251137, 1, 1, 1, 1, 251201, 1,
+    113634, 113697, 113729, 113761, 113761, 113793, 113825, 113857, 113889, 113921, 113953, 113985, 114017, 114049, 114081, 114113,
+    114145, 114177, 114209, 114241, 114273, 114305, 114337, 114369, 114401, 114433, 114433, 114433, 114433, 114465, 114465, 114465,
+    114497, 114529, 114561, 0, 114593, 114625, 114657, 114689, 114721, 114753, 114785, 114817, 114849, 114881, 114913, 114945,
+    114977, 115009, 115041, 115073, 115105, 115137, 115169, 0, 115201, 259969, 115233, 115265, 0, 0, 0, 0,
+    252193, 252161, 252321, 1, 252513, 0, 252737, 252705, 253057, 253025, 253345, 253313, 253633, 253601, 253793, 253761,
+    437153, 437313, 437281, 437409, 437377, 437633, 437601, 437729, 437697, 437985, 437953, 437889, 437921, 440417, 440385, 441121,
+    441089, 441025, 441057, 443489, 443457, 443681, 443649, 443585, 443617, 446433, 446401, 446337, 446369, 448097, 448065, 448001,
+    448033, 450433, 450401, 450337, 450369, 451425, 451393, 451329, 451361, 452417, 452385, 452545, 452513, 453409, 453377, 453857,
+    453825, 454721, 454689, 454625, 454657, 457153, 457121, 457057, 457089, 459937, 459905, 459841, 459873, 462209, 462177, 462113,
+    462145, 463809, 463777, 463713, 463745, 464961, 464929, 464865, 464897, 465409, 465377, 465313, 465345, 466817, 466785, 466721,
+    466753, 468033, 468001, 467937, 467969, 469953, 469921, 469857, 469889, 471297, 471265, 471201, 471233, 474369, 474337, 474273,
+    474305, 477601, 477569, 477505, 477537, 479905, 479873, 479809, 479841, 482881, 482849, 482785, 482817, 484353, 484321, 485633,
+    485601, 485985, 485953, 485889, 485921, 474466, 474402, 474594, 474530, 474722, 474658, 474850, 474786, 0, 0, 1,
+    0, 115297, 115329, 115361, 259937, 115393, 115425, 115457, 115489, 115521, 115553, 115585, 115617, 115649, 115681, 115713,
+    261761, 262305, 270017, 274209, 276321, 277921, 279073, 280033, 281089, 282017, 115745, 115777, 115809, 115841, 115873, 115905,
+    115937, 283073, 291457, 293057, 296225, 299809, 305377, 307329, 310081, 313185, 317441, 318561, 321569, 325569, 328801, 332193,
+    340577, 342977, 343841, 347649, 351777, 354689, 361377, 363649, 365473, 366913, 368993, 115969, 116001, 116033, 116065, 116097,
+    116129, 282817, 291201, 292801, 295969, 299553, 305121, 307073, 309825, 312929, 317217, 318305, 321313, 325313, 328545, 331937,
+    340321, 342753, 343585, 347393, 351521, 354433, 361121, 363393, 365217, 366689, 368737, 116161, 116193, 116225, 116257, 116289,
+    116321, 116353, 116385, 116417, 116449, 116481, 768353, 745633, 746401, 746881, 747361, 747905, 764929, 765377, 765697, 755361,
+    259681, 745697, 746465, 746945, 747425, 747969, 748353, 749217, 750689, 751649, 752001, 752609, 753217, 753729, 753985, 754433,
+    754689, 755073, 755425, 755681, 756129, 756545, 756737, 756897, 757025, 757153, 757409, 758401, 759329, 760353, 761665, 762817,
+    763585, 764129, 764257, 764769, 764993, 765441, 765761, 765985, 766145, 766497, 766945, 767361, 767553, 768577, 250369, 250433,
+    735585, 724257, 724545, 740353, 724769, 740481, 740577, 725185, 725473, 725697, 740737, 740833, 740929, 741025, 741121, 741217,
+    731617, 726113, 726529, 726817, 732033, 727041, 727329, 727553, 728449, 728993, 729217, 729793, 730209, 730625, 731041, 0,
+    0, 0, 735681, 735777, 735873, 735969, 736065, 736161, 0, 0, 736257, 736353, 736449, 736545, 736641, 736737,
+    0, 0, 736833, 736929, 737025, 737121, 737217, 737313, 0, 0, 737409, 737505, 737601, 0, 0, 0,
+    259873, 260033, 116513, 116545, 116577, 260097, 260961, 0, 116609, 116641, 116673, 116705, 116737, 116769, 116801, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 116833, 1076193, 0, 0,
+    853505, 853537, 853569, 853601, 853633, 853665, 853697, 853729, 853761, 853793, 853825, 853857, 0, 853889, 853921, 853953,
+    853985, 854017, 854049, 854081, 854113, 854145, 854177, 854209, 854241, 854273, 854305, 854337, 854369, 854401, 854433, 854465,
+    854497, 854529, 854561, 854593, 854625, 854657, 854689, 0, 854721, 854753, 854785, 854817, 854849, 854881, 854913, 854945,
+    854977, 855009, 855041, 855073, 855105, 855137, 855169, 855201, 855233, 855265, 855297, 0, 855329, 855361, 0, 855393,
+    855425, 855457, 855489, 855521, 855553, 855585, 855617, 855649, 855681, 855713, 855745, 855777, 855809, 855841, 0, 0,
+    855873, 855905, 855937, 855969, 856001, 856033, 856065, 856097, 856129, 856161, 856193, 856225, 856257, 856289, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    856321, 856353, 856385, 856417, 856449, 856481, 856513, 856545, 856577, 856609, 856641, 856673, 856705, 856737, 856769, 856801,
+    856833, 856865, 856897, 856929, 856961, 856993, 857025, 857057, 857089, 857121, 857153, 857185, 857217, 857249, 857281, 857313,
+    857345, 857377, 857409, 857441, 857473, 857505, 857537, 857569, 857601, 857633, 857665, 857697, 857729, 857761, 857793, 857825,
+    857857, 857889, 857921, 857953, 857985, 858017, 858049, 858081, 858113, 858145, 858177, 858209, 858241, 858273, 858305, 858337,
+    858369, 858401, 858433, 858465, 858497, 858529, 858561, 858593, 858625, 858657, 858689, 858721, 858753, 858785, 858817, 858849,
+    858881, 858913, 858945, 858977, 859009, 859041, 859073, 859105, 859137, 859169, 859201, 859233, 859265, 859297, 859329, 859361,
+    859393, 859425, 859457, 859489, 859521, 859553, 859585, 859617, 859649, 859681, 859713, 859745, 859777, 859809, 859841, 859873,
+    859905, 859937, 859969, 860001, 860033, 860065, 860097, 860129, 860161, 860193, 860225, 0, 0, 0, 0, 0,
+    116865, 116897, 116929, 0, 0, 0, 0, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    116961, 116993, 117025, 117057, 117089, 117121, 117153, 117185, 117217, 117249, 117281, 117313, 117345, 117377, 117409, 117441,
+    117473, 117505, 117537, 117569, 117601, 117633, 117665, 117697, 117729, 117761, 117793, 117825, 117857, 117889, 117921, 117953,
+    117985, 118017, 118049, 118081, 0, 0, 0, 118113, 118145, 118177, 118209, 118241, 118273, 118305, 118337, 118369,
+    118401, 118433, 262273, 277889, 118465, 118497, 118529, 118561, 277889, 118593, 118625, 118657, 118689, 118721, 118753, 277889,
+    118785, 118817, 118849, 118881, 118913, 118945, 118977, 119009, 262273, 262273, 262273, 269985, 269985, 269985, 269985, 277889,
+    119041, 119073, 119105, 119137, 119169, 119201, 119233, 119265, 119297, 119329, 119361, 119393, 119425, 119457, 119489, 119521,
+    119553, 119585, 119617, 277889, 119649, 119681, 119713, 119745, 119777, 119809, 119841, 119873, 119905, 119937, 119969, 120001,
+    120033, 120065, 120097, 120129, 120161, 120193, 120225, 120257, 120289, 120321, 261729, 120353, 120385, 120417, 120449, 0,
+    120481, 120513, 120545, 120577, 120609, 120641, 120673, 120705, 120737, 120769, 120801, 120833, 120865, 0, 0, 0,
+    120897, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    120929, 120961, 120993, 121025, 121057, 121089, 121121, 121153, 121185, 121217, 121249, 121281, 121313, 121345, 121377, 121409,
+    121441, 121473, 121505, 121537, 121569, 121601, 121633, 121665, 121697, 121729, 121761, 121793, 121825, 121857, 121889, 121921,
+    121953, 121985, 122017, 122049, 122081, 122113, 122145, 122177, 122209, 122241, 122273, 122305, 122337, 258593, 0, 0,
+    833953, 833985, 834017, 834049, 834081, 834113, 834145, 834177, 834209, 834241, 834273, 834305, 834337, 834369, 834401, 834433,
+    834465, 834497, 834529, 834561, 834593, 834625, 834657, 834689, 834721, 834753, 834785, 834817, 834849, 0, 0, 0,
+    834881, 834913, 834945, 834977, 835009, 835041, 835073, 835105, 835137, 835169, 835201, 835233, 835265, 835297, 835329, 835361,
+    835393, 835425, 835457, 835489, 835521, 835553, 835585, 835617, 835649, 835681, 835713, 835745, 835777, 835809, 835841, 835873,
+    835905, 835937, 835969, 836001, 836033, 836065, 836097, 836129, 836161, 836193, 836225, 836257, 836289, 836321, 836353, 836385,
+    836417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 122369, 122401, 122433, 122465, 122497, 122529,
+    122561, 122593, 122625, 122657, 122689, 122721, 122753, 122785, 122817, 122849, 122881, 122913, 0, 0, 0, 0,
+    837281, 837313, 837345, 837377, 837409, 837441, 837473, 837505, 837537, 837569, 837601, 837633, 837665, 837697, 837729, 837793,
+    837825, 837857, 837889, 837921, 837953, 837985, 838017, 838049, 838081, 838113, 838145, 838177, 838209, 838241, 838273, 837761,
+    262273, 277889, 122945, 122977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 838305, 838337, 838369,
+    838401, 838433, 838465, 838497, 838529, 838561, 838593, 838625, 838657, 838689, 838721, 838753, 838785, 838817, 838849, 838881,
+    838913, 838945, 838977, 839009, 839041, 839073, 839105, 839137, 839169, 839201, 839233, 0, 0, 0, 0, 0,
+    421793, 421857, 421889, 421921, 421985, 422017, 422049, 422081, 422145, 422177, 422209, 422241, 422273, 422305, 422369, 422401,
+    422433, 422465, 422529, 422561, 422593, 422625, 422657, 422689, 422721, 422753, 422785, 422817, 422849, 422881, 422913, 422945,
+    422977, 423009, 423041, 423073, 423105, 423137, 421825, 421953, 422113, 422337, 422497, 0, 0, 0, 0, 0,
+    887457, 887489, 887521, 887553, 887585, 887617, 887649, 887681, 887713, 887745, 887777, 887809, 887841, 887873, 887905, 887937,
+    887969, 888001, 888033, 888065, 888097, 888129, 888161, 888193, 888225, 888257, 888289, 888321, 888353, 888385, 0, 123009,
+    888417, 888449, 888481, 888513, 888545, 888577, 888609, 888641, 888673, 888705, 888737, 888769, 888801, 888833, 888865, 888897,
+    888929, 888961, 888993, 889025, 889057, 889089, 889121, 889153, 889185, 889217, 889249, 889281, 889313, 889345, 889377, 889409,
+    889441, 889473, 889505, 889537, 0, 0, 0, 0, 889569, 889601, 889633, 889665, 889697, 889729, 889761, 889793,
+    123041, 262273, 269985, 123073, 123105, 123137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    839297, 839361, 839425, 839489, 839553, 839617, 839681, 839745, 839809, 839873, 839937, 840001, 840065, 840129, 840193, 840257,
+    840321, 840385, 840449, 840513, 840577, 840641, 840705, 840769, 840833, 840897, 840961, 841025, 841089, 841153, 841217, 841281,
+    841345, 841409, 841473, 841537, 841601, 841665, 841729, 841793, 839265, 839329, 839393, 839457, 839521, 839585, 839649, 839713,
+    839777, 839841, 839905, 839969, 840033, 840097, 840161, 840225, 840289, 840353, 840417, 840481, 840545, 840609, 840673, 840737,
+    840801, 840865, 840929, 840993, 841057, 841121, 841185, 841249, 841313, 841377, 841441, 841505, 841569, 841633, 841697, 841761,
+    841825, 841857, 841889, 841921, 841953, 841985, 842017, 842049, 842081, 842113, 842145, 842177, 842209, 842241, 842273, 842305,
+    842337, 842369, 842401, 842433, 842465, 842497, 842529, 842561, 842593, 842625, 842657, 842689, 842721, 842753, 842785, 842817,
+    842849, 842881, 842913, 842945, 842977, 843009, 843041, 843073, 843105, 843137, 843169, 843201, 843233, 843265, 843297, 843329,
+    847809, 847841, 847873, 847905, 847937, 847969, 848001, 848033, 848065, 848097, 848129, 848161, 848193, 848225, 848257, 848289,
+    848321, 848353, 848385, 848417, 848449, 848481, 848513, 848545, 848577, 848609, 848641, 848673, 848705, 848737, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    645217, 645281, 645345, 645409, 645473, 645537, 645601, 645665, 645729, 645793, 645857, 645921, 645985, 646049, 646113, 646177,
+    646241, 646305, 646369, 646433, 646497, 646561, 646625, 646689, 646753, 646817, 646881, 646945, 647009, 647073, 647137, 647201,
+    647265, 647329, 647393, 647457, 0, 0, 0, 0, 645185, 645249, 645313, 645377, 645441, 645505, 645569, 645633,
+    645697, 645761, 645825, 645889, 645953, 646017, 646081, 646145, 646209, 646273, 646337, 646401, 646465, 646529, 646593, 646657,
+    646721, 646785, 646849, 646913, 646977, 647041, 647105, 647169, 647233, 647297, 647361, 647425, 0, 0, 0, 0,
+    848769, 848801, 848833, 848865, 848897, 848929, 848961, 848993, 849025, 849057, 849089, 849121, 849153, 849185, 849217, 849249,
+    849281, 849313, 849345, 849377, 849409, 849441, 849473, 849505, 849537, 849569, 849601, 849633, 849665, 849697, 849729, 849761,
+    849793, 849825, 849857, 849889, 849921, 849953, 849985, 850017, 0, 0, 0, 0, 0, 0, 0, 0,
+    850049, 850081, 850113, 850145, 850177, 850209, 850241, 850273, 850305, 850337, 850369, 850401, 850433, 850465, 850497, 850529,
+    850561, 850593, 850625, 850657, 850689, 850721, 850753, 850785, 850817, 850849, 850881, 850913, 850945, 850977, 851009, 851041,
+    851073, 851105, 851137, 851169, 851201, 851233, 851265, 851297, 851329, 851361, 851393, 851425, 851457, 851489, 851521, 851553,
+    851585, 851617, 851649, 851681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123169,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    860257, 860289, 860321, 860353, 860385, 860417, 860449, 860481, 860513, 860545, 860577, 860609, 860641, 860673, 860705, 860737,
+    860769, 860801, 860833, 860865, 860897, 860929, 860961, 860993, 861025, 861057, 861089, 861121, 861153, 861185, 861217, 861249,
+    861281, 861313, 861345, 861377, 861409, 861441, 861473, 861505, 861537, 861569, 861601, 861633, 861665, 861697, 861729, 861761,
+    861793, 861825, 861857, 861889, 861921, 861953, 861985, 862017, 862049, 862081, 862113, 862145, 862177, 862209, 862241, 862273,
+    862305, 862337, 862369, 862401, 862433, 862465, 862497, 862529, 862561, 862593, 862625, 862657, 862689, 862721, 862753, 862785,
+    862817, 862849, 862881, 862913, 862945, 862977, 863009, 863041, 863073, 863105, 863137, 863169, 863201, 863233, 863265, 863297,
+    863329, 863361, 863393, 863425, 863457, 863489, 863521, 863553, 863585, 863617, 863649, 863681, 863713, 863745, 863777, 863809,
+    863841, 863873, 863905, 863937, 863969, 864001, 864033, 864065, 864097, 864129, 864161, 864193, 864225, 864257, 864289, 864321,
+    864353, 864385, 864417, 864449, 864481, 864513, 864545, 864577, 864609, 864641, 864673, 864705, 864737, 864769, 864801, 864833,
+    864865, 864897, 864929, 864961, 864993, 865025, 865057, 865089, 865121, 865153, 865185, 865217, 865249, 865281, 865313, 865345,
+    865377, 865409, 865441, 865473, 865505, 865537, 865569, 865601, 865633, 865665, 865697, 865729, 865761, 865793, 865825, 865857,
+    865889, 865921, 865953, 865985, 866017, 866049, 866081, 866113, 866145, 866177, 866209, 866241, 866273, 866305, 866337, 866369,
+    866401, 866433, 866465, 866497, 866529, 866561, 866593, 866625, 866657, 866689, 866721, 866753, 866785, 866817, 866849, 866881,
+    866913, 866945, 866977, 867009, 867041, 867073, 867105, 867137, 867169, 867201, 867233, 867265, 867297, 867329, 867361, 867393,
+    867425, 867457, 867489, 867521, 867553, 867585, 867617, 867649, 867681, 867713, 867745, 867777, 867809, 867841, 867873, 867905,
+    867937, 867969, 868001, 868033, 868065, 868097, 868129, 868161, 868193, 868225, 868257, 868289, 868321, 868353, 868385, 868417,
+    868449, 868481, 868513, 868545, 868577, 868609, 868641, 868673, 868705, 868737, 868769, 868801, 868833, 868865, 868897, 868929,
+    868961, 868993, 869025, 869057, 869089, 869121, 869153, 869185, 869217, 869249, 869281, 869313, 869345, 869377, 869409, 869441,
+    869473, 869505, 869537, 869569, 869601, 869633, 869665, 869697, 869729, 869761, 869793, 869825, 869857, 869889, 869921, 869953,
+    869985, 870017, 870049, 870081, 870113, 870145, 870177, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    870209, 870241, 870273, 870305, 870337, 870369, 870401, 870433, 870465, 870497, 870529, 870561, 870593, 870625, 870657, 870689,
+    870721, 870753, 870785, 870817, 870849, 870881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    870913, 870945, 870977, 871009, 871041, 871073, 871105, 871137, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    871169, 871201, 871233, 871265, 871297, 871329, 0, 0, 871361, 0, 871393, 871425, 871457, 871489, 871521, 871553,
+    871585, 871617, 871649, 871681, 871713, 871745, 871777, 871809, 871841, 871873, 871905, 871937, 871969, 872001, 872033, 872065,
+    872097, 872129, 872161, 872193, 872225, 872257, 872289, 872321, 872353, 872385, 872417, 872449, 872481, 872513, 872545, 872577,
+    872609, 872641, 872673, 872705, 872737, 872769, 0, 872801, 872833, 0, 0, 0, 872865, 0, 0, 872897,
+    878945, 878977, 879009, 879041, 879073, 879105, 879137, 879169, 879201, 879233, 879265, 879297, 879329, 879361, 879393, 879425,
+    879457, 879489, 879521, 879553, 879585, 879617, 0, 123201, 262273, 269985, 274177, 123233, 123265, 123297, 123329, 123361,
+    876545, 876577, 876609, 876641, 876673, 876705, 876737, 876769, 876801, 876833, 876865, 876897, 876929, 876993, 876961, 877025,
+    877057, 877089, 877121, 877153, 877185, 877217, 877249, 123393, 123425, 262273, 269985, 274177, 276289, 277889, 123457, 123489,
+    877313, 877281, 877377, 877345, 877409, 877441, 877505, 877473, 877537, 877569, 877601, 877633, 877697, 877665, 877761, 877729,
+    877825, 877793, 877889, 877857, 877953, 877921, 877985, 878017, 878049, 878081, 878113, 878145, 878209, 878177, 878241, 0,
+    0, 0, 0, 0, 0, 0, 0, 262273, 269985, 274177, 276289, 276289, 277889, 123521, 123553, 123585,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    878273, 878305, 878337, 878369, 878401, 878433, 878465, 878497, 878529, 878561, 878593, 878625, 878657, 878689, 878721, 878753,
+    878785, 878817, 878849, 0, 878881, 878913, 0, 0, 0, 0, 0, 262273, 277889, 123617, 123649, 123681,
+    435553, 435585, 435617, 435649, 435681, 435713, 435745, 435777, 435809, 435841, 435873, 435905, 435937, 435969, 436001, 436033,
+    436065, 436097, 436129, 436161, 436193, 436225, 262273, 123713, 123745, 123777, 269985, 274177, 0, 0, 0, 123809,
+    836449, 836481, 836513, 836545, 836577, 836609, 836641, 836673, 836705, 836737, 836769, 836801, 836833, 836865, 836897, 836929,
+    836961, 836993, 837025, 837057, 837089, 837121, 837153, 837185, 837217, 837249, 0, 0, 0, 0, 0, 123841,
+    959906, 960002, 960098, 960194, 960290, 960386, 960482, 960546, 960642, 960738, 960834, 960898, 960994, 961058, 961154, 961218,
+    961314, 961410, 961506, 961666, 961730, 961826, 961922, 962018, 962114, 962178, 962274, 962338, 962434, 962530, 962657, 962689,
+    959873, 959969, 960065, 960161, 960257, 960353, 960449, 960609, 960705, 960801, 960961, 961121, 961281, 961377, 961473, 961569,
+    961602, 961793, 961889, 961985, 962081, 962241, 962401, 962497, 0, 0, 0, 0, 123873, 123905, 962593, 962625,
+    262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 123937, 123969, 124001, 124033, 124065, 124097, 124129,
+    0, 0, 124161, 124193, 124225, 124257, 124289, 124321, 124353, 124385, 124417, 124449, 124481, 124513, 124545, 124577,
+    124609, 124641, 124673, 124705, 124737, 124769, 124801, 124833, 124865, 124897, 124929, 124961, 124993, 125025, 125057, 125089,
+    125121, 125153, 125185, 125217, 125249, 125281, 125313, 125345, 125377, 125409, 125441, 125473, 125505, 125537, 125569, 125601,
+    577697, 577729, 577761, 577793, 0, 577825, 577857, 0, 0, 0, 0, 0, 577889, 250241, 255937, 255969,
+    577921, 577985, 578017, 578049, 0, 578081, 578113, 578145, 0, 578177, 578209, 578273, 578337, 578369, 578401, 578433,
+    578465, 578497, 578529, 578561, 578593, 578625, 578657, 578689, 578721, 578753, 578785, 578817, 578849, 578913, 578945, 578977,
+    579009, 579041, 577953, 578305, 578241, 578881, 0, 0, 256225, 256257, 256289, 0, 0, 0, 0, 579073,
+    262273, 269985, 274177, 276289, 125633, 125665, 125697, 125729, 125761, 0, 0, 0, 0, 0, 0, 0,
+    125793, 125825, 125857, 125889, 125921, 125953, 125985, 126017, 126049, 0, 0, 0, 0, 0, 0, 0,
+    872929, 872961, 872993, 873025, 873057, 873089, 873121, 873153, 873185, 873217, 873249, 873281, 873313, 873345, 873377, 873409,
+    873441, 873473, 873505, 873537, 873569, 873601, 873633, 873665, 873697, 873729, 873761, 873793, 873825, 262273, 126081, 126113,
+    873857, 873889, 873921, 873953, 873985, 874017, 874049, 874081, 874113, 874145, 874177, 874209, 874241, 874273, 874305, 874337,
+    874369, 874401, 874433, 874465, 874497, 874529, 874561, 874593, 874625, 874657, 874689, 874721, 874753, 262273, 126145, 126177,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    882305, 882337, 882369, 882401, 882433, 882465, 882497, 882529, 882562, 882625, 882657, 882689, 882721, 882753, 882785, 882817,
+    882849, 882881, 882913, 882945, 882977, 883009, 883041, 883073, 883105, 883137, 883169, 883201, 883233, 883265, 883297, 883329,
+    883361, 883393, 883425, 883457, 883489, 250209, 250241, 0, 0, 0, 0, 262273, 277889, 126209, 126241, 126273,
+    126305, 126337, 126369, 126401, 126433, 126465, 126497, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    874785, 874817, 874849, 874881, 874913, 874945, 874977, 875009, 875041, 875073, 875105, 875137, 875169, 875201, 875233, 875265,
+    875297, 875329, 875361, 875393, 875425, 875457, 875489, 875521, 875553, 875585, 875617, 875649, 875681, 875713, 875745, 875777,
+    875809, 875841, 875873, 875905, 875937, 875969, 876001, 876033, 876065, 876097, 876129, 876161, 876193, 876225, 876258, 876321,
+    876353, 876385, 876417, 876449, 876481, 876513, 0, 0, 0, 126529, 126561, 126593, 126625, 126657, 126689, 126721,
+    879649, 879681, 879713, 879745, 879777, 879809, 879841, 879873, 879905, 879937, 879969, 880001, 880033, 880065, 880097, 880129,
+    880161, 880193, 880225, 880257, 880289, 880321, 0, 0, 262273, 269985, 274177, 276289, 126753, 126785, 126817, 126849,
+    880353, 880385, 880417, 880449, 880481, 880513, 880545, 880577, 880609, 880641, 880673, 880705, 880737, 880769, 880801, 880833,
+    880865, 880897, 880929, 0, 0, 0, 0, 0, 262273, 269985, 274177, 276289, 126881, 126913, 126945, 126977,
+    880961, 880993, 881025, 881057, 881089, 881121, 881153, 881185, 881217, 881249, 881281, 881313, 881345, 881377, 881409, 881441,
+    881473, 881505, 0, 0, 0, 0, 0, 0, 0, 127009, 127041, 127073, 127105, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 262273, 269985, 274177, 276289, 127137, 127169, 127201,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    678945, 678978, 679041, 679073, 679106, 679169, 679201, 679233, 679266, 679329, 679362, 679425, 679458, 679521, 679554, 679617,
+    679650, 679713, 679746, 679809, 679841, 679874, 679937, 679970, 680033, 680066, 680129, 680162, 680225, 680258, 680321, 680354,
+    680417, 680449, 680481, 680513, 680545, 680578, 680641, 680674, 680737, 680770, 680833, 680866, 680929, 680961, 680994, 681057,
+    681089, 681121, 681153, 681186, 681249, 681282, 681345, 681378, 681441, 681474, 681537, 681570, 681633, 681665, 681697, 681729,
+    681762, 681825, 681858, 681921, 681954, 682017, 682050, 682113, 682145, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    675073, 675170, 675265, 675329, 675393, 675457, 675521, 675585, 675649, 675713, 675810, 675938, 676033, 676097, 676161, 676225,
+    676289, 676386, 676481, 676545, 676609, 676673, 676737, 676801, 676865, 676929, 676993, 677057, 677154, 677249, 677346, 677474,
+    677569, 677633, 677697, 677794, 677889, 677953, 678017, 678081, 678145, 678209, 678273, 678370, 678465, 678562, 678657, 678721,
+    678785, 678849, 678913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    675041, 675106, 675233, 675297, 675361, 675425, 675489, 675553, 675617, 675681, 675746, 675874, 676001, 676065, 676129, 676193,
+    676257, 676322, 676449, 676513, 676577, 676641, 676705, 676769, 676833, 676897, 676961, 677025, 677090, 677217, 677282, 677410,
+    677537, 677601, 677665, 677730, 677857, 677921, 677985, 678049, 678113, 678177, 678241, 678306, 678433, 678498, 678625, 678689,
+    678753, 678817, 678881, 0, 0, 0, 0, 0, 0, 0, 262273, 277889, 127233, 127265, 127297, 127329,
+    616641, 616833, 616865, 616897, 616929, 616961, 616993, 617025, 617057, 617089, 617121, 617153, 617185, 617217, 617249, 617281,
+    617313, 617345, 617377, 617409, 617441, 617473, 617505, 617537, 617569, 617601, 617633, 617665, 617697, 616673, 616705, 616737,
+    616769, 616801, 617729, 617761, 250209, 250209, 250209, 250209, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 127361, 127393, 127425, 127457, 127489, 127521, 127553,
+    127585, 127617, 127649, 127681, 127713, 127745, 127777, 127809, 127841, 127873, 127905, 127937, 127969, 128001, 128033, 0,
+    885377, 885409, 885441, 885473, 885505, 885537, 885569, 885601, 885633, 885665, 885697, 885729, 885761, 885793, 885825, 885857,
+    885889, 885921, 885953, 885985, 886017, 886049, 886081, 886113, 886145, 886177, 886209, 886241, 886273, 886305, 886337, 886369,
+    886401, 886465, 886497, 886529, 886561, 886593, 886625, 886657, 886689, 886753, 0, 253857, 253825, 128065, 0, 0,
+    886433, 886721, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    883521, 883553, 883585, 883617, 883649, 883681, 883713, 883745, 883777, 883809, 883841, 883873, 883905, 883937, 883969, 884001,
+    884034, 884097, 884129, 884162, 884289, 884321, 884353, 884386, 884449, 884481, 884513, 884545, 884578, 262273, 269985, 274177,
+    276289, 277889, 128097, 128129, 128161, 128193, 128225, 884226, 0, 0, 0, 0, 0, 0, 0, 0,
+    884641, 884673, 884705, 884737, 884769, 884801, 884833, 884865, 884897, 884929, 884961, 884993, 885025, 885057, 885089, 885121,
+    885153, 885185, 885281, 885313, 885345, 885218, 250241, 250241, 250209, 250209, 250209, 250241, 250209, 250241, 250241, 250241,
+    250241, 262273, 128257, 128289, 128321, 128353, 128385, 128417, 128449, 128481, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    886785, 886817, 886849, 886881, 886913, 886945, 886977, 887009, 887041, 887073, 887105, 887137, 887169, 887201, 887233, 887265,
+    887297, 887329, 887361, 887393, 887425, 262273, 269985, 274177, 276289, 128513, 128545, 128577, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    881537, 881569, 881601, 881633, 881665, 881697, 881729, 881825, 881857, 881889, 881921, 881953, 881985, 882017, 882049, 882081,
+    882113, 882145, 882177, 882209, 882241, 882273, 881762, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255905, 255937, 255969, 576993, 577025, 575489, 575521, 575553, 575585, 575617, 575649, 575681, 575713, 575745, 575777, 575809,
+    575841, 575873, 575905, 575937, 575969, 576001, 576033, 576065, 576097, 576129, 576161, 576193, 576225, 576257, 576289, 576321,
+    576353, 576385, 576417, 576449, 576481, 576513, 576545, 576577, 576609, 576641, 576673, 576705, 576737, 576769, 576801, 576833,
+    576865, 576897, 576929, 576961, 577057, 577089, 577121, 577153, 577185, 577217, 577249, 577281, 577313, 577345, 577377, 577409,
+    577441, 577473, 577505, 577537, 577569, 577601, 577633, 128609, 128641, 128673, 128705, 128737, 128769, 128801, 0, 0,
+    0, 0, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 128833, 128865, 128897, 128929, 128961,
+    128993, 129025, 129057, 129089, 129121, 129153, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 577665,
+    255905, 255937, 255969, 540673, 540705, 540737, 540769, 540801, 540833, 540865, 540897, 540929, 540961, 540993, 541025, 541057,
+    541089, 541121, 541153, 541185, 541217, 541249, 541281, 541313, 541345, 541377, 541410, 541473, 541506, 541569, 541601, 541633,
+    541665, 541697, 541729, 541761, 541793, 541825, 541921, 541953, 541985, 542017, 542049, 541858, 542081, 542113, 542145, 542177,
+    542209, 542241, 542273, 542305, 542337, 542369, 542401, 542433, 542465, 542497, 255873, 129185, 129217, 1, 129249, 129281,
+    129313, 129345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    851713, 851745, 851777, 851809, 851841, 851873, 851905, 851937, 851969, 852001, 852033, 852065, 852097, 852129, 852161, 852193,
+    852225, 852257, 852289, 852321, 852353, 852385, 852417, 852449, 852481, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    255905, 255937, 255969, 617793, 617825, 617857, 617889, 617921, 617953, 617985, 618017, 618049, 618081, 618113, 618145, 618177,
+    618209, 618241, 618273, 618305, 618337, 618369, 618401, 618433, 618465, 618497, 618529, 618561, 618593, 618625, 618657, 618689,
+    618721, 618753, 618785, 618817, 618881, 618913, 618945, 619009, 619041, 619073, 619105, 619137, 619169, 619201, 619233, 619265,
+    619297, 2147486551, 2147486556, 619457, 619489, 0, 261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    129377, 129409, 129441, 129473, 618977, 619393, 619425, 618849, 0, 0, 0, 0, 0, 0, 0, 0,
+    542529, 542561, 542593, 542625, 542657, 542689, 542721, 542753, 542785, 542817, 542849, 542881, 542913, 542945, 542977, 543009,
+    543041, 543073, 543105, 543137, 543169, 543201, 543233, 543265, 543297, 543329, 543361, 543393, 543425, 543457, 543489, 543521,
+    543585, 543617, 543649, 255873, 129505, 129537, 543553, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255905, 255937, 255969, 543745, 543777, 543809, 543841, 543873, 543905, 543937, 543969, 544001, 544033, 544065, 544097, 544129,
+    544161, 544193, 544225, 544257, 544289, 544321, 544353, 544385, 544417, 544449, 544481, 544513, 544545, 544577, 544609, 544641,
+    544673, 544705, 544737, 544769, 544801, 544833, 544865, 544897, 544929, 544961, 544993, 545025, 545057, 545089, 545121, 545153,
+    545185, 545217, 545249, 545409, 545441, 545473, 545505, 545537, 545569, 545601, 545633, 545665, 545697, 545761, 545793, 545825,
+    545857, 545281, 545313, 545345, 543681, 129569, 129601, 129633, 129665, 256001, 255873, 256321, 256353, 129697, 545729, 255905,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 543713, 129729, 545377, 129761, 129793, 129825,
+    0, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 129857, 129889, 129921, 129953, 129985, 130017,
+    130049, 130081, 130113, 130145, 130177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    545889, 545921, 545953, 545985, 546017, 546049, 546081, 546113, 546145, 546177, 546209, 546241, 546273, 546305, 546337, 546369,
+    546401, 546433, 0, 546465, 546497, 546529, 546561, 546593, 546625, 546657, 546689, 546721, 546753, 546785, 546817, 546849,
+    546881, 546913, 546945, 546977, 547009, 547041, 547073, 547105, 547137, 547169, 547201, 547233, 547265, 547297, 547329, 547361,
+    547393, 547425, 547457, 547489, 255937, 547521, 255873, 253569, 130209, 130241, 130273, 130305, 130337, 130369, 253729, 0,
+    549377, 549409, 549441, 549473, 549569, 549601, 549633, 0, 549665, 0, 549697, 549729, 549761, 549793, 0, 549825,
+    549857, 549889, 549921, 549953, 549985, 550017, 550049, 550081, 550113, 550145, 550177, 550209, 550241, 550273, 0, 550305,
+    550337, 550369, 550401, 550433, 550465, 549505, 549537, 550497, 550529, 130401, 0, 0, 0, 0, 0, 0,
+    547553, 547585, 547617, 547649, 547681, 547713, 547745, 547777, 547809, 547841, 547873, 547905, 547937, 547969, 548001, 548033,
+    548065, 548097, 548129, 548161, 548193, 548225, 548257, 548289, 548321, 548353, 548385, 548417, 548449, 548481, 548513, 548545,
+    548577, 548609, 548641, 548673, 548705, 548737, 548769, 548801, 548833, 548865, 548897, 548929, 548961, 548993, 549025, 255937,
+    549057, 549089, 549121, 549153, 549185, 549217, 549249, 549281, 549313, 255873, 549345, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    255937, 255905, 255937, 255969, 0, 550593, 550625, 550657, 550689, 550721, 550753, 550785, 550849, 0, 0, 550913,
+    550945, 0, 0, 550977, 551009, 551041, 551073, 551105, 551137, 551169, 551201, 551233, 551265, 551297, 551329, 551361,
+    551393, 551425, 551457, 551489, 551521, 551553, 551585, 551617, 551649, 0, 551681, 551713, 551745, 551777, 551809, 551841,
+    551873, 0, 551905, 551937, 0, 551969, 552001, 552033, 552065, 552097, 0, 255873, 255873, 552129, 552225, 552257,
+    552289, 552321, 552353, 552385, 552417, 0, 0, 2147486561, 552545, 0, 0, 552577, 552609, 552641, 0, 0,
+    550561, 0, 0, 0, 0, 0, 0, 552673, 0, 0, 0, 0, 0, 552705, 552161, 552193,
+    550817, 550881, 552449, 552481, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    552801, 552833, 552865, 552897, 552929, 552961, 552993, 553025, 553057, 553089, 553121, 553153, 553185, 553217, 553249, 553281,
+    553313, 553345, 553377, 553409, 553441, 553473, 553505, 553537, 553569, 553601, 553633, 553665, 553697, 553729, 553761, 553793,
+    553825, 553857, 553889, 553921, 553953, 553985, 554017, 554049, 554081, 554113, 554145, 554177, 554209, 554241, 554273, 554305,
+    554337, 554369, 554401, 554433, 554465, 554657, 554689, 554721, 554753, 554785, 554817, 554849, 554881, 554913, 554945, 554977,
+    555009, 555041, 555073, 255905, 255937, 255969, 255873, 554497, 554593, 552737, 552769, 130433, 130465, 130497, 130529, 130561,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 130593, 130625, 0, 130657, 256001, 554625,
+    554529, 554561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    555137, 555169, 555201, 555233, 555265, 555297, 555329, 555361, 555393, 555425, 555457, 555489, 555521, 555553, 555585, 555617,
+    555649, 555681, 555713, 555745, 555777, 555809, 555841, 555873, 555905, 555937, 555969, 556001, 556033, 556065, 556097, 556129,
+    556161, 556193, 556225, 556257, 556289, 556321, 556353, 556385, 556417, 556449, 556481, 556513, 556545, 556577, 556609, 556641,
+    556737, 556769, 556801, 556833, 556865, 556897, 556929, 556961, 556993, 2147486569, 557057, 557089, 557121, 557153, 557185, 255905,
+    255937, 255969, 557217, 255873, 556673, 556705, 130689, 555105, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    557249, 557281, 557313, 557473, 557569, 557665, 557697, 557729, 557761, 557793, 557825, 557857, 557889, 557921, 557953, 557985,
+    558017, 558049, 558081, 558113, 558145, 558177, 558209, 558241, 558273, 558305, 558337, 558369, 558401, 558433, 558465, 558497,
+    558529, 558561, 558593, 558625, 558657, 558689, 558721, 558753, 558785, 558817, 558849, 558881, 558913, 558945, 558977, 559009,
+    559041, 559073, 559105, 559201, 559297, 559329, 0, 0, 2147486580, 2147486585, 559425, 559457, 255905, 255937, 255969, 559489,
+    255873, 130721, 130753, 130785, 130817, 130849, 130881, 130913, 130945, 130977, 131009, 131041, 131073, 131105, 131137, 131169,
+    131201, 131233, 131265, 131297, 131329, 131361, 131393, 131425, 557346, 557410, 557506, 557602, 559138, 559234, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    559521, 559553, 559585, 559617, 559649, 559681, 559713, 559745, 559777, 559809, 559841, 559873, 559905, 559937, 559969, 560001,
+    560033, 560065, 560097, 560129, 560161, 560193, 560225, 560257, 560289, 560321, 560353, 560385, 560417, 560449, 560481, 560513,
+    560545, 560577, 560609, 560641, 560673, 560705, 560737, 560769, 560801, 560833, 560865, 560897, 560929, 560961, 560993, 561025,
+    561057, 561089, 561121, 561153, 561185, 561217, 561249, 561281, 561313, 561345, 561377, 561409, 561441, 255937, 255969, 561473,
+    255905, 131457, 131489, 131521, 561505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    131553, 131585, 131617, 131649, 131681, 131713, 131745, 131777, 131809, 131841, 131873, 131905, 131937, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    561537, 561569, 561601, 561633, 561665, 561697, 561729, 561761, 561793, 561825, 561953, 561985, 562049, 562081, 562113, 562145,
+    562177, 562209, 562241, 562273, 562305, 562337, 562369, 562401, 562433, 562465, 562497, 562529, 562561, 562593, 562625, 562657,
+    562689, 562721, 562753, 562785, 562817, 562849, 562881, 561889, 561857, 561921, 562913, 255937, 255969, 562945, 562977, 563009,
+    563041, 563073, 563105, 563137, 563169, 563201, 563233, 255873, 562017, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    568833, 568865, 568897, 568929, 568961, 568994, 569057, 569089, 569121, 569217, 569249, 569281, 569313, 569345, 569377, 569409,
+    569441, 569473, 569505, 569537, 569569, 569601, 569634, 569697, 569729, 569761, 569154, 0, 0, 570177, 570209, 570241,
+    569793, 569825, 569857, 569889, 569921, 569953, 569985, 570017, 570049, 570081, 570113, 570145, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 131969, 132001, 132033, 132065, 132097, 132129,
+    567041, 567073, 567105, 567137, 567169, 567201, 567233, 567265, 567297, 567329, 567361, 567393, 567425, 567457, 567489, 567521,
+    567553, 567585, 567617, 567649, 567681, 567713, 567745, 567777, 567809, 567841, 567873, 567905, 567937, 567969, 568001, 568033,
+    568065, 568097, 568129, 568161, 568193, 568225, 568257, 568289, 568321, 568353, 568385, 568417, 568449, 568481, 568513, 568545,
+    568577, 568609, 568641, 568673, 568705, 568737, 568769, 255937, 255969, 568801, 255873, 132161, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    824193, 824257, 824321, 824385, 824449, 824513, 824577, 824641, 824705, 824769, 824833, 824897, 824961, 825025, 825089, 825153,
+    825217, 825281, 825345, 825409, 825473, 825537, 825601, 825665, 825729, 825793, 825857, 825921, 825985, 826049, 826113, 826177,
+    824161, 824225, 824289, 824353, 824417, 824481, 824545, 824609, 824673, 824737, 824801, 824865, 824929, 824993, 825057, 825121,
+    825185, 825249, 825313, 825377, 825441, 825505, 825569, 825633, 825697, 825761, 825825, 825889, 825953, 826017, 826081, 826145,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 132193, 132225, 132257, 132289, 132321, 132353,
+    132385, 132417, 132449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 824129,
+    563265, 563297, 563329, 563361, 563393, 563425, 563457, 0, 0, 563489, 0, 0, 563521, 563553, 563585, 563617,
+    563649, 563713, 563745, 563777, 0, 563809, 563841, 0, 563873, 563905, 563937, 563969, 564001, 564033, 564065, 564097,
+    564129, 564161, 564193, 564225, 564257, 564289, 564353, 564417, 564481, 564513, 564545, 564577, 564609, 564641, 564673, 564705,
+    564737, 564769, 564801, 564833, 564865, 2147486590, 0, 564929, 564961, 0, 0, 255937, 255905, 564993, 565025, 563681,
+    564321, 564385, 564449, 255873, 132481, 132513, 132545, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    565057, 565089, 565121, 565153, 565185, 565217, 565249, 565281, 0, 0, 565313, 565345, 565377, 565409, 565441, 565473,
+    565505, 565537, 565569, 565601, 565633, 565665, 565697, 565729, 565761, 565793, 565825, 565857, 565889, 565921, 565953, 565985,
+    566017, 566049, 566081, 566113, 566145, 566177, 566209, 566241, 566273, 566305, 566337, 566369, 566401, 566433, 566465, 566497,
+    566529, 566625, 566657, 566689, 566721, 566753, 566785, 566817, 0, 0, 566849, 566913, 566945, 566977, 255937, 255969,
+    567009, 566561, 132577, 566593, 566881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    592993, 593025, 593057, 593089, 593121, 593153, 593185, 593217, 593249, 593281, 593313, 591553, 591617, 591649, 591681, 591713,
+    591745, 591777, 591809, 591841, 591873, 591905, 591937, 591969, 592001, 592033, 592065, 592097, 592129, 592161, 592193, 592225,
+    592257, 592289, 592321, 592353, 592385, 592417, 592449, 592481, 592513, 592545, 592577, 592641, 592737, 592801, 592865, 592897,
+    592929, 592961, 591585, 255873, 593345, 255905, 255905, 255905, 255937, 255969, 592673, 592609, 592705, 592769, 592833, 132609,
+    132641, 132673, 132705, 132737, 132769, 132801, 132833, 593377, 0, 0, 0, 0, 0, 0, 0, 0,
+    593409, 593441, 593473, 593505, 593601, 593665, 593633, 593697, 593729, 593537, 593569, 593761, 593793, 593889, 593953, 593985,
+    594017, 594081, 594113, 594145, 594177, 594209, 594241, 594273, 594305, 594337, 594369, 594401, 594465, 594497, 594529, 594561,
+    594625, 594689, 594721, 594753, 594785, 594849, 594881, 594913, 594945, 594977, 595009, 595073, 595105, 595201, 595297, 595329,
+    595425, 595457, 595553, 593857, 595585, 595617, 595137, 595233, 595361, 595489, 593825, 593921, 594049, 594433, 594593, 594657,
+    594817, 595169, 595265, 595393, 595521, 595041, 255937, 255969, 256385, 595649, 132865, 132897, 132929, 595681, 132961, 132993,
+    133025, 133057, 133089, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    826433, 826465, 826497, 826529, 826561, 826593, 826625, 826657, 826689, 826721, 826753, 826785, 826817, 826849, 826881, 826913,
+    826945, 826977, 827009, 827041, 827073, 826209, 826241, 826273, 826305, 826337, 826369, 826401, 827105, 827137, 827329, 827169,
+    827201, 827233, 827265, 827297, 827361, 827553, 827489, 827937, 827585, 827521, 827969, 827809, 827745, 827841, 827777, 827393,
+    828001, 827457, 827425, 827681, 827617, 827873, 827713, 827649, 827905, 0, 0, 0, 0, 0, 0, 0,
+    579105, 579137, 579169, 579201, 579233, 579265, 579297, 579329, 579361, 0, 579393, 579425, 579457, 579489, 579521, 579553,
+    579585, 579617, 579649, 579681, 579713, 579745, 579777, 579809, 579841, 579873, 579905, 579937, 579969, 580001, 580033, 580065,
+    580097, 580129, 580161, 580193, 580225, 580257, 580289, 580321, 580353, 580385, 580417, 580449, 580481, 580513, 580545, 580609,
+    580641, 580673, 580705, 580737, 580769, 580801, 580833, 0, 580865, 580897, 580929, 580961, 255905, 255937, 255969, 580993,
+    580577, 133121, 133153, 133185, 133217, 133249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 262273, 269985, 274177, 276289, 277889, 279041,
+    280001, 281057, 281985, 133281, 133313, 133345, 133377, 133409, 133441, 133473, 133505, 133537, 133569, 0, 0, 0,
+    133601, 133633, 595713, 595777, 595841, 595905, 595969, 596033, 596097, 596161, 596225, 596289, 596353, 596417, 596481, 596545,
+    596609, 596673, 596737, 596801, 596865, 596929, 596993, 597057, 597121, 597153, 597217, 597281, 597345, 597409, 597473, 597537,
+    0, 0, 595745, 595809, 595873, 595937, 596001, 596065, 596129, 596193, 596257, 596321, 596385, 596449, 596513, 596577,
+    596641, 596705, 596769, 596833, 596897, 596961, 597025, 597089, 0, 597185, 597249, 597313, 597377, 597441, 597505, 597569,
+    597601, 597633, 597665, 597697, 597729, 255937, 255905, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    570273, 570305, 570337, 570369, 570401, 570433, 570465, 0, 570497, 570529, 0, 570561, 570593, 570625, 570657, 570689,
+    570721, 570753, 570785, 570817, 570849, 570881, 570913, 570945, 570977, 571009, 571041, 571073, 571105, 571137, 571169, 571201,
+    571233, 571265, 571297, 571329, 571361, 571393, 571425, 571521, 571553, 571585, 571617, 571649, 571681, 571713, 571745, 571777,
+    571809, 571841, 571873, 571905, 571937, 571969, 572001, 0, 0, 0, 572033, 0, 572065, 572097, 0, 572129,
+    255937, 255969, 255873, 255905, 572161, 572193, 571457, 571489, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    572257, 572289, 572321, 572353, 572385, 572417, 0, 572449, 572481, 0, 572513, 572545, 572577, 572609, 572641, 572673,
+    572705, 572737, 572769, 572801, 572833, 572865, 572897, 572929, 572961, 572993, 573025, 573057, 573089, 573121, 573153, 573185,
+    573217, 573249, 573281, 573313, 573345, 573377, 573409, 573441, 573473, 573505, 573537, 573569, 573601, 573633, 573665, 0,
+    573697, 573729, 0, 573761, 573793, 255937, 255969, 573825, 572225, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    606433, 606465, 606497, 606529, 606561, 606593, 606625, 606657, 606689, 606721, 606753, 606785, 606817, 606849, 606881, 606913,
+    606945, 606977, 607009, 607041, 607073, 607105, 607137, 133665, 133697, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    819009, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    133729, 133761, 133793, 133825, 133857, 133889, 133921, 133953, 133985, 134017, 134049, 134081, 134113, 134145, 134177, 134209,
+    134241, 134273, 134305, 134337, 134369, 134401, 134433, 134465, 134497, 134529, 134561, 134593, 134625, 260449, 260481, 260513,
+    260545, 134657, 134689, 134721, 134753, 134785, 134817, 134849, 134881, 134913, 134945, 134977, 135009, 135041, 135073, 135105,
+    135137, 135169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135201,
+    889825, 889857, 889889, 889921, 889953, 889985, 890017, 890049, 890081, 890113, 890145, 890177, 890209, 890241, 890273, 890305,
+    890337, 890369, 890401, 890433, 890465, 890497, 890529, 890561, 890593, 890625, 890657, 890689, 890721, 890753, 890785, 890817,
+    890849, 890881, 890913, 890945, 890977, 891009, 891041, 891073, 891105, 891137, 891169, 891201, 891233, 891265, 891297, 891329,
+    891361, 891393, 891425, 891457, 891489, 891521, 891553, 891585, 891617, 891649, 891681, 891713, 891745, 891777, 891809, 891841,
+    891873, 891905, 891937, 891969, 892001, 892033, 892065, 892097, 892129, 892161, 892193, 892225, 892257, 892289, 892321, 892353,
+    892385, 892417, 892449, 892481, 892513, 892545, 892577, 892609, 892641, 892673, 892705, 892737, 892769, 892801, 892833, 892865,
+    892897, 892929, 892961, 892993, 893025, 893057, 893089, 893121, 893153, 893185, 893217, 893249, 893281, 893313, 893345, 893377,
+    893409, 893441, 893473, 893505, 893537, 893569, 893601, 893633, 893665, 893697, 893729, 893761, 893793, 893825, 893857, 893889,
+    893921, 893953, 893985, 894017, 894049, 894081, 894113, 894145, 894177, 894209, 894241, 894273, 894305, 894337, 894369, 894401,
+    894433, 894465, 894497, 894529, 894561, 894593, 894625, 894657, 894689, 894721, 894753, 894785, 894817, 894849, 894881, 894913,
+    894945, 894977, 895009, 895041, 895073, 895105, 895137, 895169, 895201, 895233, 895265, 895297, 895329, 895361, 895393, 895425,
+    895457, 895489, 895521, 895553, 895585, 895617, 895649, 895681, 895713, 895745, 895777, 895809, 895841, 895873, 895905, 895937,
+    895969, 896001, 896033, 896065, 896097, 896129, 896161, 896193, 896225, 896257, 896289, 896321, 896353, 896385, 896417, 896449,
+    896481, 896513, 896545, 896577, 896609, 896641, 896673, 896705, 896737, 896769, 896801, 896833, 896865, 896897, 896929, 896961,
+    896993, 897025, 897057, 897089, 897121, 897153, 897185, 897217, 897249, 897281, 897313, 897345, 897377, 897409, 897441, 897473,
+    897505, 897537, 897569, 897601, 897633, 897665, 897697, 897729, 897761, 897793, 897825, 897857, 897889, 897921, 897953, 897985,
+    898017, 898049, 898081, 898113, 898145, 898177, 898209, 898241, 898273, 898305, 898337, 898369, 898401, 898433, 898465, 898497,
+    898529, 898561, 898593, 898625, 898657, 898689, 898721, 898753, 898785, 898817, 898849, 898881, 898913, 898945, 898977, 899009,
+    899041, 899073, 899105, 899137, 899169, 899201, 899233, 899265, 899297, 899329, 899361, 899393, 899425, 899457, 899489, 899521,
+    899553, 899585, 899617, 899649, 899681, 899713, 899745, 899777, 899809, 899841, 899873, 899905, 899937, 899969, 900001, 900033,
+    900065, 900097, 900129, 900161, 900193, 900225, 900257, 900289, 900321, 900353, 900385, 900417, 900449, 900481, 900513, 900545,
+    900577, 900609, 900641, 900673, 900705, 900737, 900769, 900801, 900833, 900865, 900897, 900929, 900961, 900993, 901025, 901057,
+    901089, 901121, 901153, 901185, 901217, 901249, 901281, 901313, 901345, 901377, 901409, 901441, 901473, 901505, 901537, 901569,
+    901601, 901633, 901665, 901697, 901729, 901761, 901793, 901825, 901857, 901889, 901921, 901953, 901985, 902017, 902049, 902081,
+    902113, 902145, 902177, 902209, 902241, 902273, 902305, 902337, 902369, 902401, 902433, 902465, 902497, 902529, 902561, 902593,
+    902625, 902657, 902689, 902721, 902753, 902785, 902817, 902849, 902881, 902913, 902945, 902977, 903009, 903041, 903073, 903105,
+    903137, 903169, 903201, 903233, 903265, 903297, 903329, 903361, 903393, 903425, 903457, 903489, 903521, 903553, 903585, 903617,
+    903649, 903681, 903713, 903745, 903777, 903809, 903841, 903873, 903905, 903937, 903969, 904001, 904033, 904065, 904097, 904129,
+    904161, 904193, 904225, 904257, 904289, 904321, 904353, 904385, 904417, 904449, 904481, 904513, 904545, 904577, 904609, 904641,
+    904673, 904705, 904737, 904769, 904801, 904833, 904865, 904897, 904929, 904961, 904993, 905025, 905057, 905089, 905121, 905153,
+    905185, 905217, 905249, 905281, 905313, 905345, 905377, 905409, 905441, 905473, 905505, 905537, 905569, 905601, 905633, 905665,
+    905697, 905729, 905761, 905793, 905825, 905857, 905889, 905921, 905953, 905985, 906017, 906049, 906081, 906113, 906145, 906177,
+    906209, 906241, 906273, 906305, 906337, 906369, 906401, 906433, 906465, 906497, 906529, 906561, 906593, 906625, 906657, 906689,
+    906721, 906753, 906785, 906817, 906849, 906881, 906913, 906945, 906977, 907009, 907041, 907073, 907105, 907137, 907169, 907201,
+    907233, 907265, 907297, 907329, 907361, 907393, 907425, 907457, 907489, 907521, 907553, 907585, 907617, 907649, 907681, 907713,
+    907745, 907777, 907809, 907841, 907873, 907905, 907937, 907969, 908001, 908033, 908065, 908097, 908129, 908161, 908193, 908225,
+    908257, 908289, 908321, 908353, 908385, 908417, 908449, 908481, 908513, 908545, 908577, 908609, 908641, 908673, 908705, 908737,
+    908769, 908801, 908833, 908865, 908897, 908929, 908961, 908993, 909025, 909057, 909089, 909121, 909153, 909185, 909217, 909249,
+    909281, 909313, 909345, 909441, 909473, 909505, 909537, 909569, 909601, 909633, 909665, 909697, 909729, 909761, 909793, 909825,
+    909857, 909889, 909921, 909953, 909985, 910017, 910049, 910081, 910113, 910145, 910177, 910209, 910241, 910273, 910305, 910337,
+    910369, 910401, 910433, 910465, 910497, 910529, 910561, 910593, 910625, 910657, 910689, 910721, 910753, 910785, 910817, 910849,
+    910881, 910913, 910945, 910977, 911009, 911041, 911073, 911105, 911137, 911169, 911201, 911233, 911265, 911297, 911329, 911361,
+    911393, 911425, 911457, 911489, 911521, 911553, 911585, 911617, 911649, 911681, 911713, 911745, 911777, 911809, 911841, 911873,
+    911905, 911937, 911969, 912001, 912033, 912065, 912097, 912129, 912161, 912193, 912225, 912257, 912289, 912321, 912353, 912385,
+    912417, 912449, 912481, 912513, 912545, 912577, 912609, 912641, 912673, 912705, 912737, 912769, 912801, 912833, 912865, 912897,
+    912929, 912961, 912993, 913025, 909377, 909409, 913057, 913089, 913121, 913153, 913185, 913217, 913249, 913281, 913313, 913345,
+    913377, 913409, 913441, 913473, 913505, 913537, 913569, 913601, 913633, 913665, 913697, 913729, 913761, 913793, 913825, 913857,
+    913889, 913921, 913953, 913985, 914017, 914049, 914081, 914113, 914145, 914177, 914209, 914241, 914273, 914305, 914337, 914369,
+    914401, 914433, 914465, 914497, 914529, 914561, 914593, 914625, 914657, 914689, 914721, 914753, 914785, 914817, 914849, 914881,
+    914913, 914945, 914977, 915009, 915041, 915073, 915105, 915137, 915169, 915201, 915233, 915265, 915297, 915329, 915361, 915393,
+    915425, 915457, 915489, 915521, 915553, 915585, 915617, 915649, 915681, 915713, 915745, 915777, 915809, 915841, 915873, 915905,
+    915937, 915969, 916001, 916033, 916065, 916097, 916129, 916161, 916193, 916225, 916257, 916289, 916321, 916353, 916385, 916417,
+    916449, 916481, 916513, 916545, 916577, 916609, 916641, 916673, 916705, 916737, 916769, 916801, 916833, 916865, 916897, 916929,
+    916961, 916993, 917025, 917057, 917089, 917121, 917153, 917185, 917217, 917249, 917281, 917313, 917345, 917377, 917409, 917441,
+    917473, 917505, 917537, 917569, 917601, 917633, 917665, 917697, 917729, 917761, 917793, 917825, 917857, 917889, 917921, 917953,
+    917985, 918017, 918049, 918081, 918113, 918145, 918177, 918209, 918241, 918273, 918305, 918337, 918369, 918401, 918433, 918465,
+    918497, 918529, 918561, 918593, 918625, 918657, 918689, 918721, 918753, 918785, 918817, 918849, 918881, 918913, 918945, 918977,
+    919009, 919041, 919073, 919105, 919137, 919169, 919201, 919233, 919265, 919297, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 276289,
+    277889, 279041, 280001, 281057, 281985, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 262273, 269985,
+    274177, 276289, 277889, 269985, 274177, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 262273, 269985, 274177, 274177,
+    276289, 277889, 135233, 135265, 262273, 269985, 274177, 274177, 276289, 277889, 274177, 274177, 276289, 276289, 276289, 276289,
+    279041, 280001, 280001, 280001, 281057, 281057, 281985, 281985, 281985, 281985, 269985, 274177, 276289, 277889, 279041, 262273,
+    269985, 274177, 276289, 276289, 277889, 277889, 269985, 274177, 262273, 269985, 135297, 135329, 135361, 135393, 135425, 135457,
+    135489, 135521, 135553, 135585, 135617, 135649, 135681, 135713, 135745, 276289, 277889, 279041, 280001, 281057, 281985, 0,
+    135777, 135809, 135841, 135873, 135905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    919329, 919361, 919393, 919425, 919457, 919489, 919521, 919553, 919585, 919617, 919649, 919681, 919713, 919745, 919777, 919809,
+    919841, 919873, 919905, 919937, 919969, 920001, 920033, 920065, 920097, 920129, 920161, 920193, 920225, 920257, 920289, 920321,
+    920353, 920385, 920417, 920449, 920481, 920513, 920545, 920577, 920609, 920641, 920673, 920705, 920737, 920769, 920801, 920833,
+    920865, 920897, 920929, 920961, 920993, 921025, 921057, 921089, 921121, 921153, 921185, 921217, 921249, 921281, 921313, 921345,
+    921377, 921409, 921441, 921473, 921505, 921537, 921569, 921601, 921633, 921665, 921697, 921729, 921761, 921793, 921825, 921857,
+    921889, 921921, 921953, 921985, 922017, 922049, 922081, 922113, 922145, 922177, 922209, 922241, 922273, 922305, 922337, 922369,
+    922401, 922433, 922465, 922497, 922529, 922561, 922593, 922625, 922657, 922689, 922721, 922753, 922785, 922817, 922849, 922881,
+    922913, 922945, 922977, 923009, 923041, 923073, 923105, 923137, 923169, 923201, 923233, 923265, 923297, 923329, 923361, 923393,
+    923425, 923457, 923489, 923521, 923553, 923585, 923617, 923649, 923681, 923713, 923745, 923777, 923809, 923841, 923873, 923905,
+    923937, 923969, 924001, 924033, 924065, 924097, 924129, 924161, 924193, 924225, 924257, 924289, 924321, 924353, 924385, 924417,
+    924449, 924481, 924513, 924545, 924577, 924609, 924641, 924673, 924705, 924737, 924769, 924801, 924833, 924865, 924897, 924929,
+    924961, 924993, 925025, 925057, 925089, 925121, 925153, 925185, 925217, 925249, 925281, 925313, 925345, 925377, 925409, 925441,
+    925473, 925505, 925537, 925569, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    925601, 925633, 925665, 925697, 925729, 925761, 925793, 925825, 925857, 925889, 925921, 925953, 925985, 926017, 926049, 926081,
+    926113, 926145, 926177, 926209, 926241, 926273, 926305, 926337, 926369, 926401, 926433, 926465, 926497, 926529, 926561, 926593,
+    926625, 926657, 926689, 926721, 926753, 926785, 926817, 926849, 926881, 926913, 926945, 926977, 927009, 927041, 927073, 927105,
+    927137, 927169, 927201, 927233, 927265, 927297, 927329, 927361, 927393, 927425, 927457, 927489, 927521, 927553, 927585, 927617,
+    927649, 927681, 927713, 927745, 927777, 927809, 927841, 927873, 927905, 927937, 927969, 928001, 928033, 928065, 928097, 928129,
+    928161, 928193, 928225, 928257, 928289, 928321, 928353, 928385, 928417, 928449, 928481, 928513, 928545, 928577, 928609, 928641,
+    928673, 928705, 928737, 928769, 928801, 928833, 928865, 928897, 928929, 928961, 928993, 929025, 929057, 929089, 929121, 929153,
+    929185, 929217, 929249, 929281, 929313, 929345, 929377, 929409, 929441, 929473, 929505, 929537, 929569, 929601, 929633, 929665,
+    929697, 929729, 929761, 929793, 929825, 929857, 929889, 929921, 929953, 929985, 930017, 930049, 930081, 930113, 930145, 930177,
+    930209, 930241, 930273, 930305, 930337, 930369, 930401, 930433, 930465, 930497, 930529, 930561, 930593, 930625, 930657, 930689,
+    930721, 930753, 930785, 930817, 930849, 930881, 930913, 930945, 930977, 931009, 931041, 931073, 931105, 931137, 931169, 931201,
+    931233, 931265, 931297, 931329, 931361, 931393, 931425, 931457, 931489, 931521, 931553, 931585, 931617, 931649, 931681, 931713,
+    931745, 931777, 931809, 931841, 931873, 931905, 931937, 931969, 932001, 932033, 932065, 932097, 932129, 932161, 932193, 932225,
+    932257, 932289, 932321, 932353, 932385, 932417, 932449, 932481, 932513, 932545, 932577, 932609, 932641, 932673, 932705, 932737,
+    932769, 932801, 932833, 932865, 932897, 932929, 932961, 932993, 933025, 933057, 933089, 933121, 933153, 933185, 933217, 933249,
+    933281, 933313, 933345, 933377, 933409, 933441, 933473, 933505, 933537, 933569, 933601, 933633, 933665, 933697, 933729, 933761,
+    933793, 933825, 933857, 933889, 933921, 933953, 933985, 934017, 934049, 934081, 934113, 934145, 934177, 934209, 934241, 934273,
+    934305, 934337, 934369, 934401, 934433, 934465, 934497, 934529, 934561, 934593, 934625, 934657, 934689, 934721, 934753, 934785,
+    934817, 934849, 934881, 934913, 934945, 934977, 935009, 935041, 935073, 935105, 935137, 935169, 935201, 935233, 935265, 935297,
+    935329, 935361, 935393, 935425, 935457, 935489, 935521, 935553, 935585, 935617, 935649, 935681, 935713, 935745, 935777, 935809,
+    935841, 935873, 935905, 935937, 935969, 936001, 936033, 936065, 936097, 936129, 936161, 936193, 936225, 936257, 936289, 936321,
+    936353, 936385, 936417, 936449, 936481, 936513, 936545, 936577, 936609, 936641, 936673, 936705, 936737, 936769, 936801, 936833,
+    936865, 936897, 936929, 936961, 936993, 937025, 937057, 937089, 937121, 937153, 937185, 937217, 937249, 937281, 937313, 937345,
+    937377, 937409, 937441, 937473, 937505, 937537, 937569, 937601, 937633, 937665, 937697, 937729, 937761, 937793, 937825, 937857,
+    937889, 937921, 937953, 937985, 938017, 938049, 938081, 938113, 938145, 938177, 938209, 938241, 938273, 938305, 938337, 938369,
+    938401, 938433, 938465, 938497, 938529, 938561, 938593, 938625, 938657, 938689, 938721, 938753, 938785, 938817, 938849, 938881,
+    938913, 938945, 938977, 939009, 939041, 939073, 939105, 939137, 939169, 939201, 939233, 939265, 939297, 939329, 939361, 939393,
+    939425, 939457, 939489, 939521, 939553, 939585, 939617, 939649, 939681, 939713, 939745, 939777, 939809, 939841, 939873, 939905,
+    939937, 939969, 940001, 940033, 940065, 940097, 940129, 940161, 940193, 940225, 940257, 940289, 940321, 940353, 940385, 940417,
+    940449, 940481, 940513, 940545, 940577, 940609, 940641, 940673, 940705, 940737, 940769, 940801, 940833, 940865, 940897, 940929,
+    940961, 940993, 941025, 941057, 941089, 941121, 941153, 941185, 941217, 941249, 941281, 941313, 941345, 941377, 941409, 941441,
+    941473, 941505, 941537, 941569, 941601, 941633, 941665, 941697, 941729, 941761, 941793, 941825, 941857, 941889, 941921, 941953,
+    941985, 942017, 942049, 942081, 942113, 942145, 942177, 942209, 942241, 942273, 942305, 942337, 942369, 942401, 942433, 942465,
+    942497, 942529, 942561, 942593, 942625, 942657, 942689, 942721, 942753, 942785, 942817, 942849, 942881, 942913, 942945, 942977,
+    943009, 943041, 943073, 943105, 943137, 943169, 943201, 943233, 943265, 943297, 943329, 943361, 943393, 943425, 943457, 943489,
+    943521, 943553, 943585, 943617, 943649, 943681, 943713, 943745, 943777, 943809, 943841, 943873, 943905, 943937, 943969, 944001,
+    944033, 944065, 944097, 944129, 944161, 944193, 944225, 944257, 944289, 944321, 944353, 944385, 944417, 944449, 944481, 944513,
+    944545, 944577, 944609, 944641, 944673, 944705, 944737, 944769, 944801, 944833, 944865, 944897, 944929, 944961, 944993, 945025,
+    945057, 945089, 945121, 945153, 945185, 945217, 945249, 945281, 945313, 945345, 945377, 945409, 945441, 945473, 945505, 945537,
+    945569, 945601, 945633, 945665, 945697, 945729, 945761, 945793, 945825, 945857, 945889, 945921, 945953, 945985, 946017, 946049,
+    946081, 946113, 946145, 946177, 946209, 946241, 946273, 946305, 946337, 946369, 946401, 946433, 946465, 946497, 946529, 946561,
+    946593, 946625, 946657, 946689, 946721, 946753, 946785, 946817, 946849, 946881, 946913, 946945, 946977, 947009, 947041, 947073,
+    947105, 947137, 947169, 947201, 947233, 947265, 947297, 947329, 947361, 947393, 947425, 947457, 947489, 947521, 947553, 947585,
+    947617, 947649, 947681, 947713, 947745, 947777, 947809, 947841, 947873, 947905, 947937, 947969, 948001, 948033, 948065, 948097,
+    948129, 948161, 948193, 948225, 948257, 948289, 948321, 948353, 948385, 948417, 948449, 948481, 948513, 948545, 948577, 948609,
+    948641, 948673, 948705, 948737, 948769, 948801, 948833, 948865, 948897, 948929, 948961, 948993, 949025, 949057, 949089, 949121,
+    949153, 949185, 949217, 949249, 949281, 949313, 949345, 949377, 949409, 949441, 949473, 949505, 949537, 949569, 949601, 949633,
+    949665, 949697, 949729, 949761, 949793, 949825, 949857, 949889, 949921, 949953, 949985, 950017, 950049, 950081, 950113, 950145,
+    950177, 950209, 950241, 950273, 950305, 950337, 950369, 950401, 950433, 950465, 950497, 950529, 950561, 950593, 950625, 950657,
+    950689, 950721, 950753, 950785, 950817, 950849, 950881, 950913, 950945, 950977, 951009, 951041, 951073, 951105, 951137, 951169,
+    951201, 951233, 951265, 951297, 951329, 951361, 951393, 951425, 951457, 951489, 951521, 951553, 951585, 951617, 951649, 951681,
+    951713, 951745, 951777, 951809, 951841, 951873, 951905, 951937, 951969, 952001, 952033, 952065, 952097, 952129, 952161, 952193,
+    952225, 952257, 952289, 952321, 952353, 952385, 952417, 952449, 952481, 952513, 952545, 952577, 952609, 952641, 952673, 952705,
+    952737, 952769, 952801, 952833, 952865, 952897, 952929, 952961, 952993, 953025, 953057, 953089, 953121, 953153, 953185, 953217,
+    953249, 953281, 953313, 953345, 953377, 953409, 953441, 953473, 953505, 953537, 953569, 953601, 953633, 953665, 953697, 953729,
+    953761, 953793, 953825, 953857, 953889, 953921, 953953, 953985, 954017, 954049, 954081, 954113, 954145, 954177, 954209, 954241,
+    954273, 954305, 954337, 954369, 954401, 954433, 954465, 954497, 954529, 954561, 954593, 954625, 954657, 954689, 954721, 954753,
+    954785, 954817, 954849, 954881, 954913, 954945, 954977, 955009, 955041, 955073, 955105, 955137, 955169, 955201, 955233, 955265,
+    955297, 955329, 955361, 955393, 955425, 955457, 955489, 955521, 955553, 955585, 955617, 955649, 955681, 955713, 955745, 955777,
+    955809, 955841, 955873, 955905, 955937, 955969, 956001, 956033, 956065, 956097, 956129, 956161, 956193, 956225, 956257, 956289,
+    956321, 956353, 956385, 956417, 956449, 956481, 956513, 956545, 956577, 956609, 956641, 956673, 956705, 956737, 956769, 956801,
+    956833, 956865, 956897, 956929, 956961, 956993, 957025, 957057, 957089, 957121, 957153, 957185, 957217, 957249, 957281, 957313,
+    957345, 957377, 957409, 957441, 957473, 957505, 957537, 957569, 957601, 957633, 957665, 957697, 957729, 957761, 957793, 957825,
+    957857, 957889, 957921, 957953, 957985, 958017, 958049, 958081, 958113, 958145, 958177, 958209, 958241, 958273, 958305, 958337,
+    958369, 958401, 958433, 958465, 958497, 958529, 958561, 958593, 958625, 958657, 958689, 958721, 958753, 958785, 958817, 958849,
+    958881, 958913, 958945, 958977, 959009, 959041, 959073, 959105, 959137, 959169, 959201, 959233, 959265, 959297, 959329, 959361,
+    959393, 959425, 959457, 959489, 959521, 959553, 959585, 959617, 959649, 959681, 959713, 959745, 959777, 959809, 959841, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    962721, 962753, 962785, 962817, 962849, 962881, 962913, 962945, 962977, 963009, 963041, 963073, 963105, 963137, 963169, 963201,
+    963233, 963265, 963297, 963329, 963361, 963393, 963425, 963457, 963489, 963521, 963553, 963585, 963617, 963649, 963681, 963713,
+    963745, 963777, 963809, 963841, 963873, 963905, 963937, 963969, 964001, 964033, 964065, 964097, 964129, 964161, 964193, 964225,
+    964257, 964289, 964321, 964353, 964385, 964417, 964449, 964481, 964513, 964545, 964577, 964609, 964641, 964673, 964705, 964737,
+    964769, 964801, 964833, 964865, 964897, 964929, 964961, 964993, 965025, 965057, 965089, 965121, 965153, 965185, 965217, 965249,
+    965281, 965313, 965345, 965377, 965409, 965441, 965473, 965505, 965537, 965569, 965601, 965633, 965665, 965697, 965729, 965761,
+    965793, 965825, 965857, 965889, 965921, 965953, 965985, 966017, 966049, 966081, 966113, 966145, 966177, 966209, 966241, 966273,
+    966305, 966337, 966369, 966401, 966433, 966465, 966497, 966529, 966561, 966593, 966625, 966657, 966689, 966721, 966753, 966785,
+    966817, 966849, 966881, 966913, 966945, 966977, 967009, 967041, 967073, 967105, 967137, 967169, 967201, 967233, 967265, 967297,
+    967329, 967361, 967393, 967425, 967457, 967489, 967521, 967553, 967585, 967617, 967649, 967681, 967713, 967745, 967777, 967809,
+    967841, 967873, 967905, 967937, 967969, 968001, 968033, 968065, 968097, 968129, 968161, 968193, 968225, 968257, 968289, 968321,
+    968353, 968385, 968417, 968449, 968481, 968513, 968545, 968577, 968609, 968641, 968673, 968705, 968737, 968769, 968801, 968833,
+    968865, 968897, 968929, 968961, 968993, 969025, 969057, 969089, 969121, 969153, 969185, 969217, 969249, 969281, 969313, 969345,
+    969377, 969409, 969441, 969473, 969505, 969537, 969569, 969601, 969633, 969665, 969697, 969729, 969761, 969793, 969825, 969857,
+    969889, 969921, 969953, 969985, 970017, 970049, 970081, 970113, 970145, 970177, 970209, 970241, 970273, 970305, 970337, 970369,
+    970401, 970433, 970465, 970497, 970529, 970561, 970593, 970625, 970657, 970689, 970721, 970753, 970785, 970817, 970849, 970881,
+    970913, 970945, 970977, 971009, 971041, 971073, 971105, 971137, 971169, 971201, 971233, 971265, 971297, 971329, 971361, 971393,
+    971425, 971457, 971489, 971521, 971553, 971585, 971617, 971649, 971681, 971713, 971745, 971777, 971809, 971841, 971873, 971905,
+    971937, 971969, 972001, 972033, 972065, 972097, 972129, 972161, 972193, 972225, 972257, 972289, 972321, 972353, 972385, 972417,
+    972449, 972481, 972513, 972545, 972577, 972609, 972641, 972673, 972705, 972737, 972769, 972801, 972833, 972865, 972897, 972929,
+    972961, 972993, 973025, 973057, 973089, 973121, 973153, 973185, 973217, 973249, 973281, 973313, 973345, 973377, 973409, 973441,
+    973473, 973505, 973537, 973569, 973601, 973633, 973665, 973697, 973729, 973761, 973793, 973825, 973857, 973889, 973921, 973953,
+    973985, 974017, 974049, 974081, 974113, 974145, 974177, 974209, 974241, 974273, 974305, 974337, 974369, 974401, 974433, 974465,
+    974497, 974529, 974561, 974593, 974625, 974657, 974689, 974721, 974753, 974785, 974817, 974849, 974881, 974913, 974945, 974977,
+    975009, 975041, 975073, 975105, 975137, 975169, 975201, 975233, 975265, 975297, 975329, 975361, 975393, 975425, 975457, 975489,
+    975521, 975553, 975585, 975617, 975649, 975681, 975713, 975745, 975777, 975809, 975841, 975873, 975905, 975937, 975969, 976001,
+    976033, 976065, 976097, 976129, 976161, 976193, 976225, 976257, 976289, 976321, 976353, 976385, 976417, 976449, 976481, 976513,
+    976545, 976577, 976609, 976641, 976673, 976705, 976737, 976769, 976801, 976833, 976865, 976897, 976929, 976961, 976993, 977025,
+    977057, 977089, 977121, 977153, 977185, 977217, 977249, 977281, 977313, 977345, 977377, 977409, 977441, 977473, 977505, 977537,
+    977569, 977601, 977633, 977665, 977697, 977729, 977761, 977793, 977825, 977857, 977889, 977921, 977953, 977985, 978017, 978049,
+    978081, 978113, 978145, 978177, 978209, 978241, 978273, 978305, 978337, 978369, 978401, 978433, 978465, 978497, 978529, 978561,
+    978593, 978625, 978657, 978689, 978721, 978753, 978785, 978817, 978849, 978881, 978913, 978945, 978977, 979009, 979041, 979073,
+    979105, 979137, 979169, 979201, 979233, 979265, 979297, 979329, 979361, 979393, 979425, 979457, 979489, 979521, 979553, 979585,
+    979617, 979649, 979681, 979713, 979745, 979777, 979809, 979841, 979873, 979905, 979937, 979969, 980001, 980033, 980065, 980097,
+    980129, 980161, 980193, 980225, 980257, 980289, 980321, 980353, 980385, 980417, 980449, 980481, 980513, 980545, 980577, 980609,
+    980641, 980673, 980705, 980737, 980769, 980801, 980833, 980865, 980897, 980929, 980961, 980993, 981025, 981057, 981089, 981121,
+    981153, 981185, 981217, 981249, 981281, 981313, 981345, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    694337, 694369, 694401, 694433, 694465, 694497, 694529, 694561, 694593, 694625, 694657, 694689, 694721, 694753, 694785, 694817,
+    694849, 694881, 694913, 694945, 694977, 695009, 695041, 695073, 695105, 695137, 695169, 695201, 695233, 695265, 695297, 695329,
+    695361, 695393, 695425, 695457, 695489, 695521, 695553, 695585, 695617, 695649, 695681, 695713, 695745, 695777, 695809, 695841,
+    695873, 695905, 695937, 695969, 696001, 696033, 696065, 696097, 696129, 696161, 696193, 696225, 696257, 696289, 696321, 696353,
+    696385, 696417, 696449, 696481, 696513, 696545, 696577, 696609, 696641, 696673, 696705, 696737, 696769, 696801, 696833, 696865,
+    696897, 696929, 696961, 696993, 697025, 697057, 697089, 697121, 697153, 697185, 697217, 697249, 697281, 697313, 697345, 697377,
+    697409, 697441, 697473, 697505, 697537, 697569, 697601, 697633, 697665, 697697, 697729, 697761, 697793, 697825, 697857, 697889,
+    697921, 697953, 697985, 698017, 698049, 698081, 698113, 698145, 698177, 698209, 698241, 698273, 698305, 698337, 698369, 698401,
+    698433, 698465, 698497, 698529, 698561, 698593, 698625, 698657, 698689, 698721, 698753, 698785, 698817, 698849, 698881, 698913,
+    698945, 698977, 699009, 699041, 699073, 699105, 699137, 699169, 699201, 699233, 699265, 699297, 699329, 699361, 699393, 699425,
+    699457, 699489, 699521, 699553, 699585, 699617, 699649, 699681, 699713, 699745, 699777, 699809, 699841, 699873, 699905, 699937,
+    699969, 700001, 700033, 700065, 700097, 700129, 700161, 700193, 700225, 700257, 700289, 700321, 700353, 700385, 700417, 700449,
+    700481, 700513, 700545, 700577, 700609, 700641, 700673, 700705, 700737, 700769, 700801, 700833, 700865, 700897, 700929, 700961,
+    700993, 701025, 701057, 701089, 701121, 701153, 701185, 701217, 701249, 701281, 701313, 701345, 701377, 701409, 701441, 701473,
+    701505, 701537, 701569, 701601, 701633, 701665, 701697, 701729, 701761, 701793, 701825, 701857, 701889, 701921, 701953, 701985,
+    702017, 702049, 702081, 702113, 702145, 702177, 702209, 702241, 702273, 702305, 702337, 702369, 702401, 702433, 702465, 702497,
+    702529, 702561, 702593, 702625, 702657, 702689, 702721, 702753, 702785, 702817, 702849, 702881, 702913, 702945, 702977, 703009,
+    703041, 703073, 703105, 703137, 703169, 703201, 703233, 703265, 703297, 703329, 703361, 703393, 703425, 703457, 703489, 703521,
+    703553, 703585, 703617, 703649, 703681, 703713, 703745, 703777, 703809, 703841, 703873, 703905, 703937, 703969, 704001, 704033,
+    704065, 704097, 704129, 704161, 704193, 704225, 704257, 704289, 704321, 704353, 704385, 704417, 704449, 704481, 704513, 704545,
+    704577, 704609, 704641, 704673, 704705, 704737, 704769, 704801, 704833, 704865, 704897, 704929, 704961, 704993, 705025, 705057,
+    705089, 705121, 705153, 705185, 705217, 705249, 705281, 705313, 705345, 705377, 705409, 705441, 705473, 705505, 705537, 705569,
+    705601, 705633, 705665, 705697, 705729, 705761, 705793, 705825, 705857, 705889, 705921, 705953, 705985, 706017, 706049, 706081,
+    706113, 706145, 706177, 706209, 706241, 706273, 706305, 706337, 706369, 706401, 706433, 706465, 706497, 706529, 706561, 706593,
+    706625, 706657, 706689, 706721, 706753, 706785, 706817, 706849, 706881, 706913, 706945, 706977, 707009, 707041, 707073, 707105,
+    707137, 707169, 707201, 707233, 707265, 707297, 707329, 707361, 707393, 707425, 707457, 707489, 707521, 707553, 707585, 707617,
+    707649, 707681, 707713, 707745, 707777, 707809, 707841, 707873, 707905, 707937, 707969, 708001, 708033, 708065, 708097, 708129,
+    708161, 708193, 708225, 708257, 708289, 708321, 708353, 708385, 708417, 708449, 708481, 708513, 708545, 708577, 708609, 708641,
+    708673, 708705, 708737, 708769, 708801, 708833, 708865, 708897, 708929, 708961, 708993, 709025, 709057, 709089, 709121, 709153,
+    709185, 709217, 709249, 709281, 709313, 709345, 709377, 709409, 709441, 709473, 709505, 709537, 709569, 709601, 709633, 709665,
+    709697, 709729, 709761, 709793, 709825, 709857, 709889, 709921, 709953, 709985, 710017, 710049, 710081, 710113, 710145, 710177,
+    710209, 710241, 710273, 710305, 710337, 710369, 710401, 710433, 710465, 710497, 710529, 710561, 710593, 710625, 710657, 710689,
+    710721, 710753, 710785, 710817, 710849, 710881, 710913, 710945, 710977, 711009, 711041, 711073, 711105, 711137, 711169, 711201,
+    711233, 711265, 711297, 711329, 711361, 711393, 711425, 711457, 711489, 711521, 711553, 711585, 711617, 711649, 711681, 711713,
+    711745, 711777, 711809, 711841, 711873, 711905, 711937, 711969, 712001, 712033, 712065, 712097, 712129, 712161, 712193, 712225,
+    712257, 712289, 712321, 712353, 712385, 712417, 712449, 712481, 712513, 0, 0, 0, 0, 0, 0, 0,
+    852513, 852545, 852577, 852609, 852641, 852673, 852705, 852737, 852769, 852801, 852833, 852865, 852897, 852929, 852961, 852993,
+    853025, 853057, 853089, 853121, 853153, 853185, 853217, 853249, 853281, 853313, 853345, 853377, 853409, 853441, 853473, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 135937, 135969,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    712545, 712577, 712609, 712641, 712673, 712705, 712737, 712769, 712801, 712833, 712865, 712897, 712929, 712961, 712993, 713025,
+    713057, 713089, 713121, 713153, 713185, 713217, 713249, 713281, 713313, 713345, 713377, 713409, 713441, 713473, 0, 0,
+    255553, 255585, 255617, 255649, 255681, 136001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    828033, 828065, 828097, 828129, 828161, 828193, 828225, 828257, 828289, 828321, 828353, 828385, 828417, 828449, 828481, 828513,
+    828545, 828577, 828609, 828641, 828673, 828705, 828737, 828769, 828801, 828833, 828865, 828897, 828929, 828961, 828993, 829025,
+    829057, 829089, 829121, 829153, 829185, 829217, 829249, 829281, 829313, 829345, 829377, 829409, 829441, 829473, 829505, 829537,
+    257537, 257569, 257601, 257633, 257665, 257697, 257729, 136033, 136065, 136097, 136129, 136161, 136193, 136225, 136257, 136289,
+    829569, 829601, 259041, 259073, 136321, 136353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 136385, 136417, 136449, 136481, 136513,
+    136545, 136577, 0, 829633, 829665, 829697, 829729, 829761, 829793, 829825, 829857, 829889, 829921, 829953, 829985, 830017,
+    830049, 830081, 830113, 830145, 830177, 830209, 830241, 830273, 0, 0, 0, 0, 0, 830305, 830337, 830369,
+    830401, 830433, 830465, 830497, 830529, 830561, 830593, 830625, 830657, 830689, 830721, 830753, 830785, 830817, 830849, 830881,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    719841, 719905, 719969, 720033, 720097, 720161, 720225, 720289, 720353, 720417, 720481, 720545, 720609, 720673, 720737, 720801,
+    720865, 720929, 720993, 721057, 721121, 721185, 721249, 721313, 721377, 721441, 721505, 721569, 721633, 721697, 721761, 721825,
+    719809, 719873, 719937, 720001, 720065, 720129, 720193, 720257, 720321, 720385, 720449, 720513, 720577, 720641, 720705, 720769,
+    720833, 720897, 720961, 721025, 721089, 721153, 721217, 721281, 721345, 721409, 721473, 721537, 721601, 721665, 721729, 721793,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 136609, 136641, 136673, 136705, 136737, 136769,
+    136801, 136833, 136865, 136897, 262786, 270434, 274626, 136929, 136961, 136993, 137025, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    819361, 819393, 819425, 819457, 819521, 819585, 819553, 819617, 819649, 819681, 819713, 819745, 819777, 819809, 819873, 819905,
+    819969, 820033, 820065, 820001, 820097, 820129, 820161, 820193, 820225, 820257, 820289, 820321, 820353, 820385, 820417, 820449,
+    820481, 820513, 820545, 820577, 820641, 820609, 820673, 820705, 820737, 820769, 820801, 820833, 820865, 820897, 820929, 820961,
+    820993, 821025, 821057, 821121, 821185, 821217, 821249, 821281, 821313, 821345, 821409, 821441, 821473, 821505, 821569, 821537,
+    821601, 821633, 821665, 821697, 821729, 819489, 821153, 821089, 819841, 821377, 819937, 0, 0, 0, 0, 821889,
+    821761, 821793, 821825, 821857, 821921, 821953, 821985, 822017, 822049, 822113, 822145, 822177, 822209, 822273, 822305, 822337,
+    822369, 822433, 822465, 822497, 822529, 822561, 822625, 822657, 822689, 822721, 822753, 822785, 822817, 822849, 822945, 822977,
+    823009, 823041, 823073, 823137, 823169, 823265, 823297, 823329, 823361, 823393, 823425, 823457, 823489, 823521, 823553, 822881,
+    823105, 822081, 823233, 822241, 822401, 823201, 822593, 822913, 0, 0, 0, 0, 0, 0, 0, 823585,
+    823617, 823649, 823681, 823713, 823745, 823777, 823809, 823841, 823873, 823905, 823937, 823969, 824001, 824033, 824065, 824097,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    259233, 259265, 137057, 259297, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    258081, 258113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    747233, 769025, 768609, 768641, 768673, 768705, 768737, 768769, 768801, 768833, 768865, 768897, 768929, 768961, 768993, 769057,
+    769089, 769121, 769153, 769185, 769217, 769249, 769281, 769313, 769345, 769377, 769409, 769441, 769473, 769505, 769537, 769569,
+    769601, 769633, 769665, 769697, 769729, 769761, 769793, 769825, 769857, 769889, 769921, 769953, 769985, 770017, 770049, 770081,
+    770113, 770145, 770177, 770209, 770241, 770273, 770305, 770337, 770369, 770401, 770433, 770465, 770497, 770529, 770561, 770593,
+    770625, 770657, 770689, 770721, 770753, 770785, 770817, 770849, 770881, 770913, 770945, 770977, 771009, 771041, 771073, 771105,
+    771137, 771169, 771201, 771233, 771265, 771297, 771329, 771361, 771393, 771425, 771457, 771489, 771521, 771553, 771585, 771617,
+    771649, 771681, 771713, 771745, 771777, 771809, 771841, 771873, 771905, 771937, 771969, 772001, 772033, 772065, 772097, 772129,
+    772161, 772193, 772225, 772257, 772289, 772321, 772353, 772385, 772417, 772449, 772481, 772513, 772545, 772577, 772609, 772641,
+    772673, 772705, 772737, 772769, 772801, 772833, 772865, 772897, 772929, 772961, 772993, 773025, 773057, 773089, 773121, 773153,
+    773185, 773217, 773249, 773281, 773313, 773345, 773377, 773409, 773441, 773473, 773505, 773537, 773569, 773601, 773633, 773665,
+    773697, 773729, 773761, 773793, 773825, 773857, 773889, 773921, 773953, 773985, 774017, 774049, 774081, 774113, 774145, 774177,
+    774209, 774241, 774273, 774305, 774337, 774369, 774401, 774433, 774465, 774497, 774529, 774561, 774593, 774625, 774657, 774689,
+    774721, 774753, 774785, 774817, 774849, 774881, 774913, 774945, 774977, 775009, 775041, 775073, 775105, 775137, 775169, 775201,
+    775233, 775265, 775297, 775329, 775361, 775393, 775425, 775457, 775489, 775521, 775553, 775585, 775617, 775649, 775681, 775713,
+    775745, 775777, 775809, 775841, 775873, 775905, 775937, 775969, 776001, 776033, 776065, 776097, 776129, 776161, 776193, 776225,
+    776257, 776289, 776321, 776353, 776385, 776417, 776449, 776481, 776513, 776545, 776577, 776609, 776641, 776673, 776705, 776737,
+    776769, 776801, 776833, 776865, 776897, 776929, 776961, 776993, 777025, 777057, 777089, 777121, 777153, 777185, 777217, 777249,
+    777281, 777313, 777345, 777377, 777409, 777441, 777473, 777505, 777537, 777569, 777601, 777633, 777665, 777697, 777729, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    767777, 768001, 768225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 767841, 768065, 768289, 768513, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    843361, 843393, 843425, 843457, 843489, 843521, 843553, 843585, 843617, 843649, 843681, 843713, 843745, 843777, 843809, 843841,
+    843873, 843905, 843937, 843969, 844001, 844033, 844065, 844097, 844129, 844161, 844193, 844225, 844257, 844289, 844321, 844353,
+    844385, 844417, 844449, 844481, 844513, 844545, 844577, 844609, 844641, 844673, 844705, 844737, 844769, 844801, 844833, 844865,
+    844897, 844929, 844961, 844993, 845025, 845057, 845089, 845121, 845153, 845185, 845217, 845249, 845281, 845313, 845345, 845377,
+    845409, 845441, 845473, 845505, 845537, 845569, 845601, 845633, 845665, 845697, 845729, 845761, 845793, 845825, 845857, 845889,
+    845921, 845953, 845985, 846017, 846049, 846081, 846113, 846145, 846177, 846209, 846241, 846273, 846305, 846337, 846369, 846401,
+    846433, 846465, 846497, 846529, 846561, 846593, 846625, 846657, 846689, 846721, 846753, 0, 0, 0, 0, 0,
+    846785, 846817, 846849, 846881, 846913, 846945, 846977, 847009, 847041, 847073, 847105, 847137, 847169, 0, 0, 0,
+    847201, 847233, 847265, 847297, 847329, 847361, 847393, 847425, 847457, 0, 0, 0, 0, 0, 0, 0,
+    847489, 847521, 847553, 847585, 847617, 847649, 847681, 847713, 847745, 847777, 0, 0, 137089, 250209, 250273, 137121,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137153, 137185, 137217, 137249, 137281, 137313, 137345, 137377, 137409, 137441, 137473, 137505, 137537, 137569, 137601, 137633,
+    137665, 137697, 137729, 137761, 137793, 137825, 137857, 137889, 137921, 137953, 137985, 138017, 138049, 138081, 138113, 138145,
+    138177, 138209, 138241, 138273, 138305, 138337, 138369, 138401, 138433, 138465, 138497, 138529, 138561, 138593, 138625, 138657,
+    138689, 138721, 138753, 138785, 138817, 138849, 138881, 138913, 138945, 138977, 139009, 139041, 139073, 139105, 139137, 139169,
+    139201, 139233, 139265, 139297, 139329, 139361, 139393, 139425, 139457, 139489, 139521, 139553, 139585, 139617, 139649, 139681,
+    139713, 139745, 139777, 139809, 139841, 139873, 139905, 139937, 139969, 140001, 140033, 140065, 140097, 140129, 140161, 140193,
+    140225, 140257, 140289, 140321, 140353, 140385, 140417, 140449, 140481, 140513, 140545, 140577, 140609, 140641, 140673, 140705,
+    140737, 140769, 140801, 140833, 140865, 140897, 140929, 140961, 140993, 141025, 141057, 141089, 141121, 141153, 141185, 141217,
+    141249, 141281, 141313, 141345, 141377, 141409, 141441, 141473, 141505, 141537, 141569, 141601, 141633, 141665, 141697, 141729,
+    141761, 141793, 141825, 141857, 141889, 141921, 141953, 141985, 142017, 142049, 142081, 142113, 142145, 142177, 142209, 142241,
+    142273, 142305, 142337, 142369, 142401, 142433, 142465, 142497, 142529, 142561, 142593, 142625, 142657, 142689, 142721, 142753,
+    142785, 142817, 142849, 142881, 142913, 142945, 142977, 143009, 143041, 143073, 143105, 143137, 143169, 143201, 143233, 143265,
+    143297, 143329, 143361, 143393, 143425, 143457, 143489, 143521, 143553, 143585, 143617, 143649, 143681, 143713, 143745, 143777,
+    143809, 143841, 143873, 143905, 143937, 143969, 144001, 144033, 144065, 144097, 144129, 144161, 144193, 144225, 144257, 144289,
+    144321, 144353, 144385, 144417, 144449, 144481, 144513, 144545, 144577, 144609, 144641, 144673, 144705, 144737, 144769, 144801,
+    144833, 144865, 144897, 144929, 144961, 144993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    145025, 145057, 145089, 145121, 145153, 145185, 145217, 145249, 145281, 145313, 145345, 145377, 145409, 145441, 145473, 145505,
+    145537, 145569, 145601, 145633, 145665, 145697, 145729, 145761, 145793, 145825, 145857, 145889, 145921, 145953, 145985, 146017,
+    146049, 146081, 146113, 146145, 146177, 146209, 146241, 0, 0, 146273, 146305, 146337, 146369, 146401, 146433, 146465,
+    146497, 146529, 146561, 146593, 146625, 146657, 146689, 146721, 146753, 146785, 146817, 146849, 146881, 146913, 146945, 146977,
+    147009, 147041, 147073, 147105, 147137, 147169, 147201, 147233, 147265, 147297, 147329, 147361, 147393, 147425, 147457, 147489,
+    147521, 147553, 147585, 147617, 147649, 147681, 147713, 147745, 147777, 147809, 147841, 147873, 147905, 147937, 147970, 148034,
+    148099, 148099, 148099, 148099, 148099, 1, 1, 1, 1, 1, 148193, 148225, 148257, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 148289, 148321, 1, 1, 1, 1, 1, 1, 1, 148353, 148385, 148417, 148449,
+    148481, 148513, 148545, 148577, 148609, 148641, 148673, 148705, 148737, 148769, 148801, 148833, 148865, 148897, 148929, 148961,
+    148993, 149025, 149057, 149089, 149121, 149153, 149185, 149217, 149249, 149281, 1, 1, 1, 1, 149313, 149345,
+    149377, 149409, 149441, 149473, 149505, 149537, 149569, 149601, 149633, 149665, 149697, 149730, 149794, 149859, 149955, 149859,
+    149955, 150049, 150081, 150113, 150145, 150177, 150209, 150241, 150273, 150305, 150337, 150369, 150401, 150433, 150465, 150497,
+    150529, 150561, 150593, 150625, 150657, 150689, 150721, 150753, 150785, 150817, 150849, 150881, 150913, 150945, 150977, 151009,
+    151041, 151073, 151105, 151137, 151169, 151201, 151233, 151265, 151297, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    151329, 151361, 151393, 151425, 151457, 151489, 151521, 151553, 151585, 151617, 151649, 151681, 151713, 151745, 151777, 151809,
+    151841, 151873, 151905, 151937, 151969, 152001, 152033, 152065, 152097, 152129, 152161, 152193, 152225, 152257, 152289, 152321,
+    152353, 152385, 152417, 152449, 152481, 152513, 152545, 152577, 152609, 152641, 152673, 152705, 152737, 152769, 152801, 152833,
+    152865, 152897, 152929, 152961, 152993, 153025, 153057, 153089, 153121, 153153, 153185, 153217, 153249, 153281, 153313, 153345,
+    153377, 153409, 1, 1, 1, 153441, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 153473, 153505, 153537, 153569, 153601, 153633,
+    153665, 153697, 153729, 153761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    153793, 153825, 153857, 153889, 153921, 153953, 153985, 154017, 154049, 154081, 154113, 154145, 154177, 154209, 154241, 154273,
+    154305, 154337, 154369, 154401, 154433, 154465, 154497, 154529, 154561, 154593, 154625, 154657, 154689, 154721, 154753, 154785,
+    154817, 154849, 154881, 154913, 154945, 154977, 155009, 155041, 155073, 155105, 155137, 155169, 155201, 155233, 155265, 155297,
+    155329, 155361, 155393, 155425, 155457, 155489, 155521, 155553, 155585, 155617, 155649, 155681, 155713, 155745, 155777, 155809,
+    155841, 155873, 155905, 155937, 155969, 156001, 156033, 156065, 156097, 156129, 156161, 156193, 156225, 156257, 156289, 156321,
+    156353, 156385, 156417, 156449, 156481, 156513, 156545, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 156577, 156609, 156641, 156673, 156705, 156737, 156769,
+    156801, 156833, 262273, 269985, 274177, 276289, 277889, 262273, 277889, 0, 0, 0, 0, 0, 0, 0,
+    283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705,
+    343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281,
+    307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281,
+    363553, 365377, 366817, 368897, 283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729,
+    325729, 328929, 332321, 340705, 343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361,
+    292961, 296129, 299713, 305281, 307233, 0, 313089, 317345, 318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745,
+    347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897, 283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209,
+    313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705, 343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633,
+    367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281, 307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705,
+    332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897, 283201, 0, 293281, 296385,
+    0, 0, 307457, 0, 0, 317569, 318689, 0, 0, 328929, 332321, 340705, 343105, 0, 347873, 351905,
+    354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361, 292961, 296129, 0, 305281, 0, 309985, 313089, 317345,
+    318465, 321473, 325473, 328705, 0, 340481, 342881, 343745, 347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897,
+    283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705,
+    343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281,
+    307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281,
+    363553, 365377, 366817, 368897, 283201, 291585, 0, 296385, 299937, 305569, 307457, 0, 0, 317569, 318689, 321729,
+    325729, 328929, 332321, 340705, 343105, 0, 347873, 351905, 354817, 361537, 363777, 365633, 367041, 0, 282977, 291361,
+    292961, 296129, 299713, 305281, 307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745,
+    347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897, 283201, 291585, 0, 296385, 299937, 305569, 307457, 0,
+    313345, 317569, 318689, 321729, 325729, 0, 332321, 0, 0, 0, 347873, 351905, 354817, 361537, 363777, 365633,
+    367041, 0, 282977, 291361, 292961, 296129, 299713, 305281, 307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705,
+    332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897, 283201, 291585, 293281, 296385,
+    299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705, 343105, 343969, 347873, 351905,
+    354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281, 307233, 309985, 313089, 317345,
+    318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897,
+    283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705,
+    343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281,
+    307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281,
+    363553, 365377, 366817, 368897, 283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729,
+    325729, 328929, 332321, 340705, 343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361,
+    292961, 296129, 299713, 305281, 307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745,
+    347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897, 283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209,
+    313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705, 343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633,
+    367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281, 307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705,
+    332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897, 283201, 291585, 293281, 296385,
+    299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705, 343105, 343969, 347873, 351905,
+    354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281, 307233, 309985, 313089, 317345,
+    318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281, 363553, 365377, 366817, 368897,
+    283201, 291585, 293281, 296385, 299937, 305569, 307457, 310209, 313345, 317569, 318689, 321729, 325729, 328929, 332321, 340705,
+    343105, 343969, 347873, 351905, 354817, 361537, 363777, 365633, 367041, 369121, 282977, 291361, 292961, 296129, 299713, 305281,
+    307233, 309985, 313089, 317345, 318465, 321473, 325473, 328705, 332097, 340481, 342881, 343745, 347553, 351681, 354593, 361281,
+    363553, 365377, 366817, 368897, 316545, 317953, 0, 0, 373377, 377857, 378049, 378273, 378465, 380129, 380321, 384577,
+    384769, 387393, 387713, 387905, 388545, 388673, 388801, 390241, 390625, 384577, 391105, 391457, 391617, 393953, 394145, 394337,
+    394497, 156865, 373313, 377793, 377985, 378209, 378401, 380065, 380257, 384481, 384705, 387329, 387649, 387841, 388481, 388609,
+    388737, 390177, 390561, 391009, 391009, 391393, 391521, 393889, 394081, 394273, 394433, 156897, 378401, 384481, 387329, 393889,
+    390561, 390177, 373377, 377857, 378049, 378273, 378465, 380129, 380321, 384577, 384769, 387393, 387713, 387905, 388545, 388673,
+    388801, 390241, 390625, 384577, 391105, 391457, 391617, 393953, 394145, 394337, 394497, 156865, 373313, 377793, 377985, 378209,
+    378401, 380065, 380257, 384481, 384705, 387329, 387649, 387841, 388481, 388609, 388737, 390177, 390561, 391009, 391009, 391393,
+    391521, 393889, 394081, 394273, 394433, 156897, 378401, 384481, 387329, 393889, 390561, 390177, 373377, 377857, 378049, 378273,
+    378465, 380129, 380321, 384577, 384769, 387393, 387713, 387905, 388545, 388673, 388801, 390241, 390625, 384577, 391105, 391457,
+    391617, 393953, 394145, 394337, 394497, 156865, 373313, 377793, 377985, 378209, 378401, 380065, 380257, 384481, 384705, 387329,
+    387649, 387841, 388481, 388609, 388737, 390177, 390561, 391009, 391009, 391393, 391521, 393889, 394081, 394273, 394433, 156897,
+    378401, 384481, 387329, 393889, 390561, 390177, 373377, 377857, 378049, 378273, 378465, 380129, 380321, 384577, 384769, 387393,
+    387713, 387905, 388545, 388673, 388801, 390241, 390625, 384577, 391105, 391457, 391617, 393953, 394145, 394337, 394497, 156865,
+    373313, 377793, 377985, 378209, 378401, 380065, 380257, 384481, 384705, 387329, 387649, 387841, 388481, 388609, 388737, 390177,
+    390561, 391009, 391009, 391393, 391521, 393889, 394081, 394273, 394433, 156897, 378401, 384481, 387329, 393889, 390561, 390177,
+    373377, 377857, 378049, 378273, 378465, 380129, 380321, 384577, 384769, 387393, 387713, 387905, 388545, 388673, 388801, 390241,
+    390625, 384577, 391105, 391457, 391617, 393953, 394145, 394337, 394497, 156865, 373313, 377793, 377985, 378209, 378401, 380065,
+    380257, 384481, 384705, 387329, 387649, 387841, 388481, 388609, 388737, 390177, 390561, 391009, 391009, 391393, 391521, 393889,
+    394081, 394273, 394433, 156897, 378401, 384481, 387329, 393889, 390561, 390177, 379873, 379809, 0, 0, 261953, 262593,
+    270305, 274497, 276609, 278209, 279361, 280321, 281377, 282305, 261953, 262593, 270305, 274497, 276609, 278209, 279361, 280321,
+    281377, 282305, 261953, 262593, 270305, 274497, 276609, 278209, 279361, 280321, 281377, 282305, 261953, 262593, 270305, 274497,
+    276609, 278209, 279361, 280321, 281377, 282305, 261953, 262593, 270305, 274497, 276609, 278209, 279361, 280321, 281377, 282305,
+    156929, 156961, 156993, 157025, 157057, 157089, 157121, 157153, 157185, 157217, 157249, 157281, 157313, 157345, 157377, 157409,
+    157441, 157473, 157505, 157537, 157569, 157601, 157633, 157665, 157697, 157729, 157761, 157793, 157825, 157857, 157889, 157921,
+    157953, 157985, 158017, 158049, 158081, 158113, 158145, 158177, 158209, 158241, 158273, 158305, 158337, 158369, 158401, 158433,
+    158465, 158497, 158529, 158561, 158593, 158625, 158657, 158689, 158721, 158753, 158785, 158817, 158849, 158881, 158913, 158945,
+    158977, 159009, 159041, 159073, 159105, 159137, 159169, 159201, 159233, 159265, 159297, 159329, 159361, 159393, 159425, 159457,
+    159489, 159521, 159553, 159585, 159617, 159649, 159681, 159713, 159745, 159777, 159809, 159841, 159873, 159905, 159937, 159969,
+    160001, 160033, 160065, 160097, 160129, 160161, 160193, 160225, 160257, 160289, 160321, 160353, 160385, 160417, 160449, 160481,
+    160513, 160545, 160577, 160609, 160641, 160673, 160705, 160737, 160769, 160801, 160833, 160865, 160897, 160929, 160961, 160993,
+    161025, 161057, 161089, 161121, 161153, 161185, 161217, 161249, 161281, 161313, 161345, 161377, 161409, 161441, 161473, 161505,
+    161537, 161569, 161601, 161633, 161665, 161697, 161729, 161761, 161793, 161825, 161857, 161889, 161921, 161953, 161985, 162017,
+    162049, 162081, 162113, 162145, 162177, 162209, 162241, 162273, 162305, 162337, 162369, 162401, 162433, 162465, 162497, 162529,
+    162561, 162593, 162625, 162657, 162689, 162721, 162753, 162785, 162817, 162849, 162881, 162913, 162945, 162977, 163009, 163041,
+    163073, 163105, 163137, 163169, 163201, 163233, 163265, 163297, 163329, 163361, 163393, 163425, 163457, 163489, 163521, 163553,
+    163585, 163617, 163649, 163681, 163713, 163745, 163777, 163809, 163841, 163873, 163905, 163937, 163969, 164001, 164033, 164065,
+    164097, 164129, 164161, 164193, 164225, 164257, 164289, 164321, 164353, 164385, 164417, 164449, 164481, 164513, 164545, 164577,
+    164609, 164641, 164673, 164705, 164737, 164769, 164801, 164833, 164865, 164897, 164929, 164961, 164993, 165025, 165057, 165089,
+    165121, 165153, 165185, 165217, 165249, 165281, 165313, 165345, 165377, 165409, 165441, 165473, 165505, 165537, 165569, 165601,
+    165633, 165665, 165697, 165729, 165761, 165793, 165825, 165857, 165889, 165921, 165953, 165985, 166017, 166049, 166081, 166113,
+    166145, 166177, 166209, 166241, 166273, 166305, 166337, 166369, 166401, 166433, 166465, 166497, 166529, 166561, 166593, 166625,
+    166657, 166689, 166721, 166753, 166785, 166817, 166849, 166881, 166913, 166945, 166977, 167009, 167041, 167073, 167105, 167137,
+    167169, 167201, 167233, 167265, 167297, 167329, 167361, 167393, 167425, 167457, 167489, 167521, 167553, 167585, 167617, 167649,
+    167681, 167713, 167745, 167777, 167809, 167841, 167873, 167905, 167937, 167969, 168001, 168033, 168065, 168097, 168129, 168161,
+    168193, 168225, 168257, 168289, 168321, 168353, 168385, 168417, 168449, 168481, 168513, 168545, 168577, 168609, 168641, 168673,
+    168705, 168737, 168769, 168801, 168833, 168865, 168897, 168929, 168961, 168993, 169025, 169057, 169089, 169121, 169153, 169185,
+    169217, 169249, 169281, 169313, 169345, 169377, 169409, 169441, 169473, 169505, 169537, 169569, 169601, 169633, 169665, 169697,
+    169729, 169761, 169793, 169825, 169857, 169889, 169921, 169953, 169985, 170017, 170049, 170081, 170113, 170145, 170177, 170209,
+    170241, 170273, 170305, 170337, 170369, 170401, 170433, 170465, 170497, 170529, 170561, 170593, 170625, 170657, 170689, 170721,
+    170753, 170785, 170817, 170849, 170881, 170913, 170945, 170977, 171009, 171041, 171073, 171105, 171137, 171169, 171201, 171233,
+    171265, 171297, 171329, 171361, 171393, 171425, 171457, 171489, 171521, 171553, 171585, 171617, 171649, 171681, 171713, 171745,
+    171777, 171809, 171841, 171873, 171905, 171937, 171969, 172001, 172033, 172065, 172097, 172129, 172161, 172193, 172225, 172257,
+    172289, 172321, 172353, 172385, 172417, 172449, 172481, 172513, 172545, 172577, 172609, 172641, 172673, 172705, 172737, 172769,
+    172801, 172833, 172865, 172897, 172929, 172961, 172993, 173025, 173057, 173089, 173121, 173153, 173185, 173217, 173249, 173281,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 173313, 173345, 173377, 173409, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 173441, 173473, 173505,
+    173537, 173569, 173601, 173633, 173665, 1, 173697, 173729, 173761, 173793, 173825, 173857, 173889, 173921, 173953, 173985,
+    174017, 174049, 174081, 174113, 1, 174145, 174177, 174209, 174241, 174273, 174305, 174337, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    417601, 417697, 417793, 417889, 417985, 418081, 418177, 0, 418337, 418433, 418529, 418625, 418721, 418817, 418913, 419009,
+    419105, 419201, 419297, 419393, 419489, 419585, 419681, 419777, 419873, 0, 0, 420097, 420193, 420289, 420385, 420481,
+    420577, 420673, 0, 420833, 420929, 0, 421089, 421185, 421281, 421377, 421473, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    830913, 830945, 830977, 831009, 831041, 831073, 831105, 831137, 831169, 831201, 831233, 831265, 831297, 831329, 831361, 831393,
+    831425, 831457, 831489, 831521, 831553, 831585, 831617, 831649, 831681, 831713, 831745, 831777, 831809, 831841, 831873, 831905,
+    831937, 831969, 832001, 832033, 832065, 832097, 832129, 832161, 832193, 832225, 832257, 832289, 832321, 0, 0, 0,
+    257665, 257537, 257601, 257633, 257697, 257729, 257569, 832353, 832385, 832417, 832449, 832481, 259105, 259137, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 832513, 174369,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    832545, 832577, 832609, 832641, 832673, 832705, 832737, 832769, 832801, 832833, 832865, 832897, 832929, 832961, 832993, 833025,
+    833057, 833089, 833121, 833153, 833185, 833217, 833249, 833281, 833313, 833345, 833377, 833409, 833441, 833473, 833505, 833537,
+    833569, 833601, 833633, 833665, 833697, 833729, 833761, 833793, 833825, 833857, 833889, 833921, 257761, 257793, 257825, 257857,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 0, 260641,
+    713505, 713537, 713569, 713601, 713633, 713665, 713697, 713729, 713761, 713793, 713825, 713857, 713889, 713921, 713953, 713985,
+    714017, 714049, 714081, 714113, 714145, 714177, 714209, 714241, 714273, 714305, 714337, 714369, 714401, 714433, 714465, 714497,
+    714529, 714561, 714593, 714625, 714657, 714689, 714721, 714753, 714785, 714817, 714849, 714881, 714913, 714945, 714977, 715009,
+    715041, 715073, 715105, 715137, 715169, 715201, 715233, 715265, 715297, 715329, 715361, 715393, 715425, 715457, 715489, 715521,
+    715553, 715585, 715617, 715649, 715681, 715713, 715745, 715777, 715809, 715841, 715873, 715905, 715937, 715969, 716001, 716033,
+    716065, 716097, 716129, 716161, 716193, 716225, 716257, 716289, 716321, 716353, 716385, 716417, 716449, 716481, 716513, 716545,
+    716577, 716609, 716641, 716673, 716705, 716737, 716769, 716801, 716833, 716865, 716897, 716929, 716961, 716993, 717025, 717057,
+    717089, 717121, 717153, 717185, 717217, 717249, 717281, 717313, 717345, 717377, 717409, 717441, 717473, 717505, 717537, 717569,
+    717601, 717633, 717665, 717697, 717729, 717761, 717793, 717825, 717857, 717889, 717921, 717953, 717985, 718017, 718049, 718081,
+    718113, 718145, 718177, 718209, 718241, 718273, 718305, 718337, 718369, 718401, 718433, 718465, 718497, 718529, 718561, 718593,
+    718625, 718657, 718689, 718721, 718753, 718785, 718817, 718849, 718881, 718913, 718945, 718977, 719009, 719041, 719073, 719105,
+    719137, 719169, 719201, 719233, 719265, 719297, 719329, 719361, 719393, 719425, 719457, 719489, 719521, 719553, 719585, 719617,
+    719649, 719681, 719713, 719745, 719777, 0, 0, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    721889, 721953, 722017, 722081, 722145, 722209, 722273, 722337, 722401, 722465, 722529, 722593, 722657, 722721, 722785, 722849,
+    722913, 722977, 723041, 723105, 723169, 723233, 723297, 723361, 723425, 723489, 723553, 723617, 723681, 723745, 723809, 723873,
+    723937, 724001, 721857, 721921, 721985, 722049, 722113, 722177, 722241, 722305, 722369, 722433, 722497, 722561, 722625, 722689,
+    722753, 722817, 722881, 722945, 723009, 723073, 723137, 723201, 723265, 723329, 723393, 723457, 723521, 723585, 723649, 723713,
+    723777, 723841, 723905, 723969, 255713, 255713, 255713, 255777, 255809, 255841, 255745, 724033, 0, 0, 0, 0,
+    261729, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 0, 0, 0, 0, 174401, 174433,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 174465, 174497, 174529, 174561, 174593, 174625,
+    174657, 174689, 174721, 174753, 174785, 174817, 174849, 174881, 174913, 174945, 174977, 175009, 175041, 175073, 175105, 175137,
+    175169, 175201, 175233, 175265, 175297, 175329, 175361, 175393, 175425, 175457, 175489, 175521, 175553, 175585, 175617, 175649,
+    175681, 175713, 175745, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 175777, 175809, 175841, 175873,
+    261505, 262786, 270434, 175905, 175937, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 262273, 269985, 274177, 276289, 277889, 279041, 280001, 281057, 281985, 175969, 176001, 176033, 176065, 176097, 176129,
+    176161, 176193, 176225, 176257, 176289, 176321, 176353, 176385, 176417, 176449, 176481, 176513, 176545, 176577, 176609, 176641,
+    176673, 176705, 176737, 176769, 176801, 176833, 176865, 176897, 176929, 176961, 176993, 177025, 177057, 177089, 177121, 270434,
+    274690, 276738, 278338, 279490, 280450, 281506, 282434, 177153, 177185, 177217, 177249, 177281, 177313, 177345, 0, 0,
+    440353, 440993, 447969, 452353, 0, 484289, 453793, 450305, 463681, 485857, 471169, 474241, 477473, 479777, 454593, 465281,
+    467905, 459809, 469825, 453345, 457025, 443553, 446305, 451297, 452481, 462081, 464833, 466689, 440929, 482241, 469153, 469761,
+    0, 440993, 447969, 0, 482753, 0, 0, 450305, 0, 485857, 471169, 474241, 477473, 479777, 454593, 465281,
+    467905, 459809, 469825, 0, 457025, 443553, 446305, 451297, 0, 462081, 0, 466689, 0, 0, 0, 0,
+    0, 0, 447969, 0, 0, 0, 0, 450305, 0, 485857, 0, 474241, 0, 479777, 454593, 465281,
+    0, 459809, 469825, 0, 457025, 0, 0, 451297, 0, 462081, 0, 466689, 0, 482241, 0, 469761,
+    0, 440993, 447969, 0, 482753, 0, 0, 450305, 463681, 485857, 471169, 0, 477473, 479777, 454593, 465281,
+    467905, 459809, 469825, 0, 457025, 443553, 446305, 451297, 0, 462081, 464833, 466689, 440929, 0, 469153, 0,
+    440353, 440993, 447969, 452353, 482753, 484289, 453793, 450305, 463681, 485857, 0, 474241, 477473, 479777, 454593, 465281,
+    467905, 459809, 469825, 453345, 457025, 443553, 446305, 451297, 452481, 462081, 464833, 466689, 0, 0, 0, 0,
+    0, 440993, 447969, 452353, 0, 484289, 453793, 450305, 463681, 485857, 0, 474241, 477473, 479777, 454593, 465281,
+    467905, 459809, 469825, 453345, 457025, 443553, 446305, 451297, 452481, 462081, 464833, 466689, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    177377, 177409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    177441, 177473, 177505, 177537, 177569, 177601, 177633, 177665, 177697, 177729, 177761, 177793, 177825, 177857, 177889, 177921,
+    177953, 177985, 178017, 178049, 178081, 178113, 178145, 178177, 178209, 178241, 178273, 178305, 178337, 178369, 178401, 178433,
+    178465, 178497, 178529, 178561, 178593, 178625, 178657, 178689, 178721, 178753, 178785, 178817, 0, 0, 0, 0,
+    178849, 178881, 178913, 178945, 178977, 179009, 179041, 179073, 179105, 179137, 179169, 179201, 179233, 179265, 179297, 179329,
+    179361, 179393, 179425, 179457, 179489, 179521, 179553, 179585, 179617, 179649, 179681, 179713, 179745, 179777, 179809, 179841,
+    179873, 179905, 179937, 179969, 180001, 180033, 180065, 180097, 180129, 180161, 180193, 180225, 180257, 180289, 180321, 180353,
+    180385, 180417, 180449, 180481, 180513, 180545, 180577, 180609, 180641, 180673, 180705, 180737, 180769, 180801, 180833, 180865,
+    180897, 180929, 180961, 180993, 181025, 181057, 181089, 181121, 181153, 181185, 181217, 181249, 181281, 181313, 181345, 181377,
+    181409, 181441, 181473, 181505, 181537, 181569, 181601, 181633, 181665, 181697, 181729, 181761, 181793, 181825, 181857, 181889,
+    181921, 181953, 181985, 182017, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    182049, 182081, 182113, 182145, 182177, 182209, 182241, 182273, 182305, 182337, 182369, 182401, 182433, 182465, 182497, 0,
+    0, 182529, 182561, 182593, 182625, 182657, 182689, 182721, 182753, 182785, 182817, 182849, 182881, 182913, 182945, 182977,
+    0, 183009, 183041, 183073, 183105, 183137, 183169, 183201, 183233, 183265, 183297, 183329, 183361, 183393, 183425, 183457,
+    0, 183489, 183521, 183553, 183585, 183617, 183649, 183681, 183713, 183745, 183777, 183809, 183841, 183873, 183905, 183937,
+    183969, 184001, 184033, 184065, 184097, 184129, 184161, 184193, 184225, 184257, 184289, 184321, 184353, 184385, 184417, 184449,
+    184481, 184513, 184545, 184577, 184609, 184641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261826, 261890, 262530, 270242, 274434, 276546, 278146, 279298, 280258, 281314, 282242, 261985, 261985, 184673, 184705, 184737,
+    283107, 291491, 293187, 296291, 299843, 305475, 307363, 310115, 313251, 317475, 318595, 321635, 325635, 328835, 332227, 340611,
+    343011, 343875, 347683, 351811, 354723, 361443, 363683, 365539, 366947, 369027, 347779, 293313, 344001, 294466, 364866, 184769,
+    283329, 291681, 293377, 296513, 300065, 305665, 307553, 310337, 313473, 317697, 318817, 321857, 325857, 329057, 332449, 340833,
+    343169, 344097, 348001, 352033, 354945, 361665, 363873, 365761, 367137, 369217, 312162, 327906, 349922, 350306, 341731, 364802,
+    283233, 291617, 293313, 296417, 299969, 305601, 307489, 310241, 313377, 317601, 318721, 321761, 325761, 328961, 332353, 340737,
+    343137, 344001, 347905, 351937, 354849, 361569, 363809, 365665, 367073, 369153, 326594, 326658, 327490, 184801, 184833, 184865,
+    283329, 291681, 293377, 296513, 300065, 305665, 307553, 310337, 313473, 317697, 318817, 321857, 325857, 329057, 332449, 340833,
+    343169, 344097, 348001, 352033, 354945, 361665, 363873, 365761, 367137, 369217, 340833, 315554, 341250, 349858, 288226, 364802,
+    297954, 294722, 295236, 306564, 315618, 330435, 330594, 338786, 350147, 359811, 362722, 275938, 273671, 273602, 277538, 281634,
+    278467, 280579, 271428, 279619, 264708, 296481, 311586, 311651, 311814, 323656, 349987, 359715, 362627, 184897, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 184929, 184961, 184993, 185025, 185057, 185089, 185121, 185153, 185185, 185217,
+    185249, 185281, 185313, 185345, 185377, 185409, 185441, 185473, 185505, 185537, 185569, 185601, 185633, 185665, 185697, 185729,
+    762338, 752322, 752673, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1010498, 1001666, 994626, 755874, 984962, 999938, 1047330, 1000386, 985282, 1014690, 1024546, 1013570, 990882, 1007650, 988898, 1013698,
+    990562, 1036354, 1028546, 1049058, 999426, 995714, 1022946, 1010882, 1011586, 981698, 982402, 1051906, 1004930, 983170, 995138, 1011394,
+    1049954, 1010754, 1033442, 1034402, 995266, 1022434, 1016194, 1015842, 1028866, 991010, 997058, 1052898, 0, 0, 0, 0,
+    1016708, 982148, 984708, 1002052, 1024292, 1010628, 1030244, 991844, 1013060, 0, 0, 0, 0, 0, 0, 0,
+    1007714, 994946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    185761, 185793, 185825, 185857, 185889, 185921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    185953, 185985, 186017, 186049, 186081, 186113, 186145, 186177, 186209, 186241, 186273, 186305, 186337, 186369, 186401, 186433,
+    186465, 186497, 186529, 186561, 186593, 186625, 186657, 186689, 186721, 186753, 186785, 186817, 186849, 186881, 186913, 186945,
+    186977, 187009, 187041, 187073, 187105, 187137, 187169, 187201, 187233, 187265, 187297, 187329, 187361, 187393, 187425, 187457,
+    187489, 187521, 187553, 187585, 187617, 187649, 187681, 187713, 187745, 187777, 187809, 187841, 187873, 187905, 187937, 187969,
+    188001, 188033, 188065, 188097, 188129, 188161, 188193, 188225, 188257, 188289, 188321, 188353, 188385, 188417, 188449, 188481,
+    188513, 188545, 188577, 188609, 188641, 188673, 188705, 188737, 188769, 188801, 188833, 188865, 188897, 188929, 188961, 188993,
+    189025, 189057, 189089, 189121, 189153, 189185, 189217, 189249, 189281, 189313, 189345, 189377, 189409, 189441, 189473, 189505,
+    189537, 189569, 189601, 189633, 189665, 189697, 189729, 189761, 189793, 189825, 189857, 189889, 189921, 189953, 189985, 190017,
+    190049, 190081, 190113, 190145, 190177, 190209, 190241, 190273, 190305, 190337, 190369, 190401, 190433, 190465, 190497, 190529,
+    190561, 190593, 190625, 190657, 190689, 190721, 190753, 190785, 190817, 190849, 190881, 190913, 190945, 190977, 191009, 191041,
+    191073, 191105, 191137, 191169, 191201, 191233, 191265, 191297, 191329, 191361, 191393, 191425, 191457, 191489, 191521, 191553,
+    191585, 191617, 191649, 191681, 191713, 191745, 191777, 191809, 191841, 191873, 191905, 191937, 191969, 192001, 192033, 192065,
+    192097, 192129, 192161, 192193, 192225, 192257, 192289, 192321, 192353, 192385, 192417, 192449, 192481, 192513, 192545, 192577,
+    192609, 192641, 192673, 192705, 192737, 192769, 192801, 192833, 192865, 192897, 192929, 192961, 192993, 193025, 193057, 193089,
+    193121, 193153, 193185, 193217, 193249, 193281, 193313, 193345, 193377, 193409, 193441, 193473, 193505, 193537, 193569, 193601,
+    193633, 193665, 193697, 193729, 193761, 193793, 193825, 193857, 193889, 193921, 193953, 193985, 194017, 194049, 194081, 194113,
+    194145, 194177, 194209, 194241, 194273, 194305, 194337, 194369, 194401, 194433, 194465, 194497, 194529, 194561, 194593, 194625,
+    194657, 194689, 194721, 194753, 194785, 194817, 194849, 194881, 194913, 194945, 194977, 195009, 195041, 195073, 195105, 195137,
+    195169, 195201, 195233, 195265, 195297, 195329, 195361, 195393, 195425, 195457, 195489, 195521, 195553, 195585, 195617, 195649,
+    195681, 195713, 195745, 195777, 195809, 195841, 195873, 195905, 195937, 195969, 196001, 196033, 196065, 196097, 196129, 196161,
+    196193, 196225, 196257, 196289, 196321, 196353, 196385, 196417, 196449, 196481, 196513, 196545, 196577, 196609, 196641, 196673,
+    196705, 196737, 196769, 196801, 196833, 196865, 196897, 196929, 196961, 196993, 197025, 197057, 197089, 197121, 197153, 197185,
+    197217, 197249, 197281, 197313, 197345, 197377, 197409, 197441, 197473, 197505, 197537, 197569, 197601, 197633, 197665, 197697,
+    197729, 197761, 197793, 197825, 197857, 197889, 197921, 197953, 197985, 198017, 198049, 198081, 198113, 198145, 198177, 198209,
+    198241, 198273, 198305, 198337, 198369, 198401, 198433, 198465, 198497, 198529, 198561, 198593, 198625, 198657, 198689, 198721,
+    198753, 198785, 198817, 198849, 198881, 198913, 198945, 198977, 199009, 199041, 199073, 199105, 199137, 199169, 199201, 199233,
+    199265, 199297, 199329, 199361, 199393, 199425, 199457, 199489, 199521, 199553, 199585, 199617, 199649, 199681, 199713, 199745,
+    199777, 199809, 199841, 199873, 199905, 199937, 199969, 200001, 200033, 200065, 200097, 200129, 200161, 200193, 200225, 200257,
+    200289, 200321, 200353, 200385, 200417, 200449, 200481, 200513, 200545, 200577, 200609, 200641, 200673, 200705, 200737, 200769,
+    200801, 200833, 200865, 200897, 200929, 200961, 200993, 201025, 201057, 201089, 201121, 201153, 201185, 201217, 201249, 201281,
+    201313, 201345, 201377, 201409, 201441, 201473, 201505, 201537, 201569, 201601, 201633, 201665, 201697, 201729, 201761, 201793,
+    201825, 201857, 201889, 201921, 201953, 201985, 202017, 202049, 202081, 202113, 202145, 202177, 202209, 202241, 202273, 202305,
+    202337, 202369, 202401, 202433, 202465, 202497, 202529, 202561, 202593, 202625, 202657, 202689, 202721, 202753, 202785, 202817,
+    202849, 202881, 202913, 202945, 202977, 203009, 203041, 203073, 203105, 203137, 203169, 203201, 203233, 203265, 203297, 203329,
+    203361, 203393, 203425, 203457, 203489, 203521, 203553, 203585, 203617, 203649, 203681, 203713, 203745, 203777, 203809, 203841,
+    203873, 203905, 203937, 203969, 204001, 204033, 204065, 204097, 204129, 204161, 204193, 204225, 204257, 204289, 204321, 204353,
+    204385, 204417, 204449, 204481, 204513, 204545, 204577, 204609, 204641, 204673, 204705, 204737, 204769, 204801, 204833, 204865,
+    204897, 204929, 204961, 204993, 205025, 205057, 205089, 205121, 205153, 205185, 205217, 205249, 205281, 205313, 205345, 205377,
+    205409, 205441, 205473, 205505, 205537, 205569, 205601, 205633, 205665, 205697, 205729, 205761, 205793, 205825, 205857, 205889,
+    205921, 205953, 205985, 206017, 206049, 206081, 206113, 206145, 206177, 206209, 206241, 206273, 206305, 206337, 206369, 206401,
+    206433, 206465, 206497, 206529, 206561, 206593, 206625, 206657, 206689, 206721, 206753, 206785, 206817, 206849, 206881, 206913,
+    206945, 206977, 207009, 207041, 207073, 207105, 207137, 207169, 207201, 207233, 207265, 207297, 207329, 207361, 207393, 207425,
+    207457, 207489, 207521, 207553, 207585, 207617, 207649, 207681, 207713, 207745, 207777, 207809, 207841, 207873, 207905, 207937,
+    207969, 208001, 208033, 208065, 208097, 208129, 208161, 208193, 208225, 208257, 208289, 208321, 208353, 208385, 208417, 208449,
+    208481, 208513, 208545, 208577, 208609, 208641, 208673, 208705, 208737, 208769, 208801, 208833, 208865, 208897, 208929, 208961,
+    208993, 209025, 209057, 209089, 209121, 209153, 209185, 209217, 209249, 209281, 209313, 209345, 209377, 209409, 209441, 209473,
+    209505, 209537, 209569, 209601, 209633, 209665, 209697, 209729, 209761, 209793, 209825, 209857, 209889, 209921, 209953, 209985,
+    210017, 210049, 210081, 210113, 210145, 210177, 210209, 210241, 210273, 210305, 210337, 210369, 210401, 210433, 210465, 210497,
+    210529, 210561, 210593, 210625, 210657, 210689, 210721, 210753, 210785, 210817, 210849, 210881, 210913, 210945, 210977, 211009,
+    211041, 211073, 211105, 211137, 211169, 211201, 211233, 211265, 211297, 211329, 211361, 211393, 211425, 211457, 211489, 211521,
+    211553, 211585, 211617, 211649, 211681, 211713, 211745, 211777, 211809, 211841, 211873, 211905, 211937, 211969, 212001, 212033,
+    212065, 212097, 212129, 212161, 212193, 212225, 212257, 212289, 212321, 212353, 212385, 212417, 212449, 212481, 212513, 212545,
+    212577, 212609, 212641, 212673, 212705, 212737, 212769, 212801, 212833, 212865, 212897, 212929, 212961, 212993, 213025, 213057,
+    213089, 213121, 213153, 213185, 213217, 213249, 213281, 213313, 213345, 213377, 213409, 213441, 213473, 213505, 213537, 213569,
+    213601, 213633, 213665, 213697, 213729, 213761, 213793, 213825, 213857, 213889, 213921, 213953, 213985, 214017, 214049, 214081,
+    214113, 214145, 214177, 214209, 214241, 214273, 214305, 214337, 214369, 214401, 214433, 214465, 214497, 214529, 214561, 214593,
+    214625, 214657, 214689, 214721, 214753, 214785, 214817, 214849, 214881, 214913, 214945, 214977, 215009, 215041, 215073, 215105,
+    215137, 215169, 215201, 215233, 215265, 215297, 215329, 215361, 215393, 215425, 215457, 215489, 215521, 215553, 215585, 215617,
+    215649, 215681, 215713, 215745, 215777, 215809, 215841, 215873, 215905, 215937, 215969, 216001, 216033, 216065, 216097, 216129,
+    216161, 216193, 216225, 216257, 216289, 216321, 216353, 216385, 216417, 216449, 216481, 216513, 216545, 216577, 216609, 216641,
+    216673, 216705, 216737, 216769, 216801, 216833, 216865, 216897, 216929, 216961, 216993, 217025, 217057, 217089, 217121, 217153,
+    217185, 217217, 217249, 217281, 217313, 217345, 217377, 217409, 0, 0, 0, 0, 0, 0, 0, 0,
+    217441, 217473, 217505, 217537, 217569, 217601, 217633, 217665, 217697, 217729, 217761, 217793, 217825, 0, 0, 0,
+    217857, 217889, 217921, 217953, 217985, 218017, 218049, 218081, 218113, 218145, 218177, 218209, 218241, 0, 0, 0,
+    218273, 218305, 218337, 218369, 218401, 218433, 218465, 218497, 218529, 218561, 218593, 218625, 218657, 218689, 218721, 218753,
+    218785, 218817, 218849, 218881, 218913, 218945, 218977, 219009, 219041, 219073, 219105, 219137, 219169, 219201, 219233, 219265,
+    219297, 219329, 219361, 219393, 219425, 219457, 219489, 219521, 219553, 219585, 219617, 219649, 219681, 219713, 219745, 219777,
+    219809, 219841, 219873, 219905, 219937, 219969, 220001, 220033, 220065, 220097, 220129, 220161, 220193, 220225, 220257, 220289,
+    220321, 220353, 220385, 220417, 220449, 220481, 220513, 220545, 220577, 220609, 220641, 220673, 220705, 220737, 220769, 220801,
+    220833, 220865, 220897, 220929, 220961, 220993, 221025, 221057, 221089, 221121, 221153, 221185, 221217, 221249, 221281, 221313,
+    221345, 221377, 221409, 221441, 221473, 221505, 221537, 221569, 221601, 221633, 221665, 221697, 221729, 221761, 221793, 221825,
+    221857, 221889, 221921, 221953, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    221985, 222017, 222049, 222081, 222113, 222145, 222177, 222209, 222241, 222273, 222305, 222337, 222369, 222401, 222433, 222465,
+    222497, 222529, 222561, 222593, 222625, 222657, 222689, 222721, 222753, 222785, 222817, 222849, 222881, 222913, 222945, 222977,
+    223009, 223041, 223073, 223105, 223137, 223169, 223201, 223233, 223265, 223297, 223329, 223361, 223393, 223425, 223457, 223489,
+    223521, 223553, 223585, 223617, 223649, 223681, 223713, 223745, 223777, 223809, 223841, 223873, 223905, 223937, 223969, 224001,
+    224033, 224065, 224097, 224129, 224161, 224193, 224225, 224257, 224289, 224321, 224353, 224385, 224417, 224449, 224481, 224513,
+    224545, 224577, 224609, 224641, 224673, 224705, 224737, 224769, 224801, 0, 0, 0, 0, 0, 0, 0,
+    224833, 224865, 224897, 224929, 224961, 224993, 225025, 225057, 225089, 225121, 225153, 225185, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    225217, 225249, 225281, 225313, 225345, 225377, 225409, 225441, 225473, 225505, 225537, 225569, 0, 0, 0, 0,
+    225601, 225633, 225665, 225697, 225729, 225761, 225793, 225825, 225857, 225889, 225921, 225953, 225985, 226017, 226049, 226081,
+    226113, 226145, 226177, 226209, 226241, 226273, 226305, 226337, 226369, 226401, 226433, 226465, 226497, 226529, 226561, 226593,
+    226625, 226657, 226689, 226721, 226753, 226785, 226817, 226849, 226881, 226913, 226945, 226977, 227009, 227041, 227073, 227105,
+    227137, 227169, 227201, 227233, 227265, 227297, 227329, 227361, 0, 0, 0, 0, 0, 0, 0, 0,
+    227393, 227425, 227457, 227489, 227521, 227553, 227585, 227617, 227649, 227681, 0, 0, 0, 0, 0, 0,
+    227713, 227745, 227777, 227809, 227841, 227873, 227905, 227937, 227969, 228001, 228033, 228065, 228097, 228129, 228161, 228193,
+    228225, 228257, 228289, 228321, 228353, 228385, 228417, 228449, 228481, 228513, 228545, 228577, 228609, 228641, 228673, 228705,
+    228737, 228769, 228801, 228833, 228865, 228897, 228929, 228961, 0, 0, 0, 0, 0, 0, 0, 0,
+    228993, 229025, 229057, 229089, 229121, 229153, 229185, 229217, 229249, 229281, 229313, 229345, 229377, 229409, 229441, 229473,
+    229505, 229537, 229569, 229601, 229633, 229665, 229697, 229729, 229761, 229793, 229825, 229857, 229889, 229921, 0, 0,
+    229953, 229985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230017, 230049, 230081, 230113, 230145, 230177, 230209, 230241, 230273, 230305, 230337, 230369, 230401, 230433, 230465, 230497,
+    230529, 230561, 230593, 230625, 230657, 230689, 230721, 230753, 230785, 230817, 230849, 230881, 230913, 230945, 230977, 231009,
+    231041, 231073, 231105, 231137, 231169, 231201, 231233, 231265, 231297, 231329, 231361, 231393, 231425, 231457, 231489, 231521,
+    231553, 231585, 231617, 231649, 231681, 231713, 231745, 231777, 231809, 231841, 231873, 231905, 231937, 231969, 232001, 232033,
+    232065, 232097, 232129, 232161, 232193, 232225, 232257, 232289, 232321, 232353, 232385, 232417, 232449, 232481, 232513, 232545,
+    232577, 232609, 232641, 232673, 232705, 232737, 232769, 232801, 232833, 232865, 232897, 232929, 232961, 232993, 233025, 233057,
+    233089, 233121, 233153, 233185, 233217, 233249, 233281, 233313, 233345, 233377, 233409, 233441, 233473, 233505, 233537, 233569,
+    233601, 233633, 233665, 233697, 233729, 233761, 233793, 233825, 233857, 0, 233889, 233921, 233953, 233985, 234017, 234049,
+    234081, 234113, 234145, 234177, 234209, 234241, 234273, 234305, 234337, 234369, 234401, 234433, 234465, 234497, 234529, 234561,
+    234593, 234625, 234657, 234689, 234721, 234753, 234785, 234817, 234849, 234881, 234913, 234945, 234977, 235009, 235041, 235073,
+    235105, 235137, 235169, 235201, 235233, 235265, 235297, 235329, 235361, 235393, 235425, 235457, 235489, 235521, 235553, 235585,
+    235617, 235649, 235681, 235713, 235745, 235777, 235809, 235841, 235873, 235905, 235937, 235969, 236001, 236033, 236065, 236097,
+    236129, 236161, 236193, 236225, 236257, 236289, 236321, 236353, 236385, 236417, 236449, 236481, 0, 236513, 236545, 236577,
+    236609, 236641, 236673, 236705, 236737, 236769, 236801, 236833, 236865, 236897, 236929, 236961, 236993, 237025, 237057, 237089,
+    237121, 237153, 237185, 237217, 237249, 237281, 237313, 237345, 237377, 237409, 237441, 237473, 237505, 237537, 237569, 237601,
+    237633, 237665, 237697, 237729, 237761, 237793, 237825, 237857, 237889, 237921, 237953, 237985, 238017, 238049, 238081, 238113,
+    238145, 238177, 238209, 238241, 238273, 238305, 238337, 238369, 238401, 238433, 238465, 238497, 238529, 238561, 238593, 238625,
+    238657, 238689, 238721, 238753, 238785, 238817, 238849, 238881, 238913, 238945, 238977, 239009, 239041, 239073, 239105, 239137,
+    239169, 239201, 239233, 239265, 239297, 239329, 239361, 239393, 239425, 239457, 239489, 239521, 239553, 239585, 239617, 239649,
+    239681, 239713, 239745, 239777, 239809, 239841, 239873, 239905, 239937, 239969, 240001, 240033, 240065, 240097, 240129, 240161,
+    240193, 240225, 240257, 240289, 240321, 240353, 240385, 240417, 240449, 240481, 240513, 240545, 240577, 240609, 240641, 240673,
+    240705, 240737, 240769, 240801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    240833, 240865, 240897, 240929, 240961, 240993, 241025, 241057, 241089, 241121, 241153, 241185, 241217, 241249, 0, 0,
+    241281, 241313, 241345, 241377, 241409, 0, 0, 0, 241441, 241473, 241505, 0, 0, 0, 0, 0,
+    241537, 241569, 241601, 241633, 241665, 241697, 241729, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    241761, 241793, 241825, 241857, 241889, 241921, 241953, 241985, 242017, 242049, 242081, 242113, 242145, 242177, 242209, 242241,
+    242273, 242305, 242337, 242369, 242401, 242433, 242465, 242497, 242529, 0, 0, 0, 0, 0, 0, 0,
+    242561, 242593, 242625, 242657, 242689, 242721, 242753, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    242785, 242817, 242849, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    242881, 242913, 242945, 242977, 243009, 243041, 243073, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    243105, 243137, 243169, 243201, 243233, 243265, 243297, 243329, 243361, 243393, 243425, 243457, 243489, 243521, 243553, 243585,
+    243617, 243649, 243681, 243713, 243745, 243777, 243809, 243841, 243873, 243905, 243937, 243969, 244001, 244033, 244065, 244097,
+    244129, 244161, 244193, 244225, 244257, 244289, 244321, 244353, 244385, 244417, 244449, 244481, 244513, 244545, 244577, 244609,
+    244641, 244673, 244705, 244737, 244769, 244801, 244833, 244865, 244897, 244929, 244961, 244993, 245025, 245057, 245089, 245121,
+    245153, 245185, 245217, 245249, 245281, 245313, 245345, 245377, 245409, 245441, 245473, 245505, 245537, 245569, 245601, 245633,
+    245665, 245697, 245729, 245761, 245793, 245825, 245857, 245889, 245921, 245953, 245985, 246017, 246049, 246081, 246113, 246145,
+    246177, 246209, 246241, 246273, 246305, 246337, 246369, 246401, 246433, 246465, 246497, 246529, 246561, 246593, 246625, 246657,
+    246689, 246721, 246753, 246785, 246817, 246849, 246881, 246913, 246945, 246977, 247009, 247041, 247073, 247105, 247137, 247169,
+    247201, 247233, 247265, 247297, 247329, 247361, 247393, 247425, 247457, 247489, 247521, 247553, 247585, 247617, 247649, 247681,
+    247713, 247745, 247777, 0, 247809, 247841, 247873, 247905, 247937, 247969, 248001, 248033, 248065, 248097, 248129, 248161,
+    248193, 248225, 248257, 248289, 248321, 248353, 248385, 248417, 248449, 248481, 248513, 248545, 248577, 248609, 248641, 248673,
+    248705, 248737, 248769, 248801, 248833, 248865, 248897, 248929, 248961, 248993, 249025, 249057, 249089, 249121, 249153, 249185,
+    249217, 249249, 249281, 249313, 249345, 249377, 249409, 249441, 249473, 249505, 249537, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261953, 262593, 270305, 274497, 276609, 278209, 279361, 280321, 281377, 282305, 0, 0, 0, 0, 0, 0,
+    983586, 983458, 983714, 1069154, 986434, 986690, 986754, 986882, 987010, 987074, 987266, 987138, 1064866, 1069410, 987586, 987650,
+    987714, 988546, 1069218, 1064930, 987842, 988834, 1069346, 989154, 989282, 985666, 989410, 989474, 1075426, 990018, 990370, 1065058,
+    990754, 990818, 990946, 991074, 1065122, 991650, 991714, 992034, 992226, 992290, 992354, 992482, 993186, 993250, 993506, 993954,
+    994082, 994146, 994146, 994146, 1069602, 1023970, 994562, 994690, 1069666, 994882, 995010, 995202, 996098, 995650, 995842, 995906,
+    996162, 996290, 996354, 996482, 996610, 996674, 996674, 996802, 996930, 996994, 997186, 997954, 997314, 998018, 997378, 997506,
+    990434, 999362, 998466, 998530, 998594, 998402, 998722, 998658, 999042, 1069730, 999490, 999554, 999682, 999874, 1000066, 1000706,
+    1069794, 1069858, 1001026, 1001090, 1001154, 1000962, 1001282, 1065186, 1065250, 1001410, 1001538, 1001538, 1069922, 1002242, 1002306, 1002370,
+    1002498, 1069986, 1002626, 1002690, 1007202, 1003010, 1065314, 1003522, 1003778, 1004034, 1003970, 1070114, 1004162, 1070178, 1004354, 1004290,
+    1004418, 1004674, 1004738, 1065378, 1005122, 1005250, 1005314, 1005378, 1065442, 1070242, 1065506, 1005954, 1006018, 1006082, 1006210, 1076066,
+    1006594, 1070370, 1070370, 1040962, 1006914, 1006914, 1065570, 1070818, 1073506, 1007330, 1007458, 1065634, 1007778, 1008194, 1008258, 1008386,
+    1008642, 1065762, 1065698, 1008706, 1070434, 1008770, 1009090, 1009154, 1009218, 1009154, 1009410, 1009474, 1009730, 1009602, 1009666, 1009794,
+    1009858, 1009922, 1010114, 1010178, 1010818, 1010946, 1011202, 1011522, 1070626, 1011458, 1011266, 1011650, 1011778, 1012098, 1070690, 1012226,
+    1012034, 1011906, 1065826, 1012354, 1012482, 1012610, 1012418, 1065890, 1012930, 1013186, 1070754, 1014082, 1015458, 1014882, 1066082, 1015074,
+    1066018, 1065954, 988962, 989026, 1015522, 1015138, 1039906, 1067682, 1016258, 1016322, 1016386, 1017026, 1016898, 1071074, 1066146, 1017346,
+    1017154, 1017986, 1018114, 1071202, 1018178, 1017474, 1018306, 1066210, 1018370, 1018434, 1018498, 1018690, 1071266, 1018818, 1066274, 1019010,
+    1071330, 1019074, 1066338, 1019266, 1019618, 1019810, 1019874, 1071394, 1070050, 1071458, 1020770, 1071522, 1020962, 1021090, 1020834, 1021282,
+    1021538, 1021794, 1021602, 1021666, 1021858, 1021922, 1071586, 1021474, 1022306, 1022370, 1066402, 1022690, 1022626, 1071650, 1022178, 1023138,
+    1071714, 1071778, 1023202, 1023522, 1023458, 1023394, 1066466, 1023586, 1024098, 1024034, 1024226, 1069282, 1024610, 1071842, 1024802, 1071970,
+    1025122, 1025474, 1025794, 1072034, 1026338, 1026402, 1072098, 1072162, 1026914, 1027170, 1066530, 1027330, 1066594, 1066594, 1027714, 1027778,
+    1027906, 1027970, 1028162, 1066658, 1028610, 1072226, 1029058, 1072290, 1029250, 1070306, 1029602, 1072354, 1072418, 1072482, 1066722, 1066786,
+    1030850, 1072610, 1072546, 1072674, 1072738, 1030978, 1031042, 1031042, 1031170, 1066914, 1031234, 1066978, 1067042, 1072866, 1031554, 1031682,
+    1031874, 1067106, 1072930, 1032802, 1072994, 1073058, 1033634, 1034018, 1067170, 1034146, 1034210, 1034274, 1073122, 1073186, 1073186, 1034722,
+    1067234, 1073250, 1035138, 1035202, 1067298, 1073314, 1035650, 1067362, 1035906, 1035778, 1036098, 1073442, 1036482, 1067426, 1036674, 1036802,
+    1037058, 1067490, 1073570, 1073634, 1067554, 1073698, 1037922, 1073762, 1038370, 1038626, 1038882, 1073826, 1073890, 1039202, 1073954, 1039330,
+    1070882, 1067618, 1039970, 1040034, 1067746, 1040098, 1001346, 1074018, 1074082, 1070946, 1071010, 1040962, 1041026, 1051202, 1067810, 1041986,
+    1041922, 1042050, 991394, 1042114, 1042178, 1042242, 1042370, 1074146, 1042306, 1042434, 1042754, 1042818, 1042498, 1042882, 1043202, 1043522,
+    1042690, 1043010, 1043074, 1043138, 1074210, 1074338, 1074274, 1067874, 1043650, 1043714, 1043842, 1074594, 1043906, 1074402, 1067938, 1068002,
+    1074466, 1074530, 1068066, 1044482, 1044546, 1044610, 1044674, 1044866, 1044802, 1044994, 1044930, 1045186, 1045058, 1045122, 1045250, 1068130,
+    1045378, 1045442, 1068194, 1045762, 1045826, 1074658, 1046146, 1046210, 1068258, 1046402, 1064994, 1074722, 1074786, 1068322, 1068386, 1047458,
+    1047842, 1048290, 1048610, 1074850, 1049122, 1049186, 1049698, 1050018, 1074978, 1069474, 1050306, 1050242, 1050434, 1069538, 1050690, 1050882,
+    1075042, 1075106, 1052386, 1052578, 1052706, 1075170, 1052770, 1053794, 1053986, 1054050, 1053922, 1054242, 1054306, 1075234, 1054690, 1068450,
+    1054818, 1075298, 1068514, 1055938, 1004482, 1056418, 1075362, 1075490, 1068578, 1068642, 1057122, 1075554, 1068706, 1075618, 1057570, 1057570,
+    1057698, 1075682, 1058434, 1068770, 1058690, 1059042, 1059170, 1059298, 1068834, 1075746, 1059778, 1060322, 1060578, 1068898, 1068962, 1060642,
+    1075810, 1069026, 1075874, 1075938, 1076002, 1061506, 1069090, 1061954, 1062146, 1062274, 1062402, 1062530, 1062658, 1076130, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint32_t collation_elements[] = {
+    0, 33622021, 33687557, 33753093, 33818629, 33884165, 34146309, 40306693,
+    52234245, 61605893, 61671429, 61409285, 51775493, 52955141, 53020677, 60884997,
+    107350021, 35850245, 34408453, 41814021, 61212677, 37750789, 37357573, 107612165,
+    107677701, 107743237, 40699909, 60819461, 53086213, 61278213, 53151749, 79104005,
+    34277381, 78907397, 53217285, 107874309, 53282821, 108005381, 33949701, 34146359,
+    40372229, 107939845, 60426245, 79366149, 97650693, 52824069, 107808773, 97781765,
+    79169541, 86640645, 107415557, 78972933, 60557317, 43190277, 79562757, 52889605,
+    40765445, 107546629, 107481093, 80021509, 80152581, 80218117, 80283653, 80349189,
+    80414725, 80480261, 80545797, 80611333, 80676869, 80742405, 80807941, 80873477,
+    80939013, 81004549, 81070085, 81135621, 81201157, 81266693, 81332229, 81528837,
+    81594373, 79235077, 79300613, 79431685, 79628293, 79038469, 79497221, 81659909,
+    81725445, 81790981, 81856517, 81922053, 81987589, 82053125, 82118661, 82184197,
+    82249733, 82315269, 82380805, 82446341, 82511877, 82577413, 82642949, 82708485,
+    82774021, 82839557, 82905093, 82970629, 83036165, 83101701, 83167237, 83232773,
+    83298309, 83363845, 83429381, 80087045, 79366149, 2308, 107022341, 86706181,
+    65275909, 65341445, 40437765, 36308997, 40896517, 65406981, 37816325, 34473989,
+    86771717, 86837253, 65472517, 65538053, 65603589, 65669125, 65734661, 65800197,
+    108857349, 108988421, 86902789, 61868037, 61999109, 36374533, 36440069, 87099397,
+    87164933, 37423109, 37881861, 40962053, 61736965, 36505605, 36571141, 61081605,
+    41945093, 87230469, 87296005, 46991365, 42010629, 42076165, 37947397, 38012933,
+    38078469, 38144005, 38209541, 38275077, 41027589, 65865733, 65931269, 65996805,
+    66062341, 88475653, 47056901, 36636677, 40503301, 38340613, 38406149, 38471685,
+    38537221, 38602757, 38668293, 38733829, 38799365, 38864901, 38930437, 38995973,
+    39061509, 39127045, 39192581, 39258117, 66127877, 43386885, 43452421, 67110917,
+    492177413, 492242949, 492308485, 492374021, 492439557, 492505093, 88541189, 67438597,
+    67504133, 67569669, 88606725, 492570629, 492636165, 492701701, 492767237, 492832773,
+    492898309, 493357061, 493422597, 493488133, 88672261, 88737797, 88803333, 88868869,
+    88934405, 88999941, 89065477, 67635205, 90769413, 67700741, 90834949, 494929925,
+    494995461, 495060997, 495126533, 495192069, 495257605, 495323141, 495388677, 495454213,
+    495519749, 495585285, 495650821, 495716357, 495781893, 495847429, 495912965, 90900485,
+    67766277, 67831813, 67897349, 67962885, 91424773, 91490309, 91555845, 68159493,
+    68225029, 68290565, 68356101, 68421637, 68487173, 68552709, 68749317, 68749367,
+    68814853, 68880389, 68945925, 69011461, 69076997, 69142533, 91621381, 39782405,
+    91686917, 91752453, 91817989, 91883525, 91949061, 92014597, 92080133, 92145669,
+    92211205, 92276741, 92342277, 92407813, 53348357, 53413893, 53479429, 53544965,
+    69208069, 92473349, 92538885, 92604421, 92669957, 92735493, 92801029, 92866565,
+    92932101, 92997637, 93063173, 93128709, 93194245, 93259781, 93325317, 93390853,
+    93456389, 68618245, 68683781, 69273605, 69339141, 69404677, 93521925, 93587461,
+    93652997, 93718533, 69470213, 69535749, 44107781, 44173317, 70977541, 71043077,
+    71108613, 71174149, 93915141, 93980677, 47122437, 47187973, 39323653, 42141701,
+    39389189, 39454725, 39520261, 39585797, 41093125, 47253509, 495978501, 496044037,
+    496109573, 496175109, 496240645, 496306181, 496371717, 496437253, 496502789, 496568325,
+    496633861, 83494917, 83560453, 83625989, 83691525, 83757061, 83822597, 83888133,
+    83953669, 84019205, 84084741, 34539525, 93784069, 42338309, 34146313, 53610501,
+    53676037, 40044549, 40110085, 40175621, 43911173, 43976709, 44238853, 44304389,
+    39847941, 71239685, 71305221, 71370757, 66193413, 41879557, 36702213, 42207237,
+    39651333, 39716869, 34670597, 34736133, 36767749, 42272773, 93849605, 40568837,
+    41158661, 94308357, 94373893, 94439429, 94504965, 94570501, 94636037, 94701573,
+    94767109, 94832645, 94898181, 94963717, 95029253, 95094789, 95160325, 95225861,
+    95291397, 95356933, 95422469, 95488005, 95553541, 95619077, 95684613, 95750149,
+    95815685, 95881221, 95946757, 96012293, 96077829, 96143365, 96208901, 96274437,
+    96339973, 47319045, 47384581, 71436293, 71501829, 71567365, 71632901, 71698437,
+    71763973, 71829509, 44369925, 44435461, 44500997, 44566533, 71895045, 71960581,
+    47450117, 47515653, 42403845, 39913477, 44632069, 44697605, 34605061, 96405509,
+    96471045, 96536581, 96602117, 96667653, 96733189, 96798725, 96864261, 96929797,
+    96995333, 97060869, 97126405, 97191941, 97257477, 97323013, 97388549, 97454085,
+    97519621, 97585157, 72747013, 72812549, 72878085, 72943621, 43649029, 43714565,
+    70780933, 70846469, 70912005, 46860293, 46925829, 72026117, 72091653, 72157189,
+    72222725, 72288261, 72353797, 72419333, 72484869, 79693829, 79824901, 79366149,
+    2692, 79693829, 2372, 79693829, 2308, 79693829, 2692, 79759365,
+    2372, 79759365, 2308, 79759365, 2692, 79366149, 2372, 79759365,
+    34801669, 34801719, 34867205, 34932741, 34998277, 35063813, 60033029, 34342917,
+    51841029, 51906565, 51972101, 52037637, 52299781, 52365317, 52430853, 52496389,
+    62064645, 62130181, 62457861, 62523397, 41814025, 41814025, 41814025, 41814025,
+    41814025, 41814025, 62588933, 34015237, 34080773, 61802501, 61933573, 62851077,
+    62851081, 62851081, 62851081, 62851081, 62851081, 62916613, 62916617, 62916617,
+    62916617, 62916617, 62916617, 63113221, 52103173, 52168709, 63178757, 40306697,
+    40306697, 41682949, 34211845, 63244293, 63375365, 63506437, 63571973, 62654469,
+    108398597, 53741573, 53807109, 40699913, 40699913, 40699913, 40306697, 40306697,
+    40699913, 61474821, 60622853, 62720005, 62785541, 60950533, 37488645, 63440901,
+    61016069, 108136453, 35260421, 63309829, 49874949, 49940485, 62851081, 62851081,
+    62851081, 62851081, 50006021, 50071557, 50137093, 50202629, 50268165, 50333701,
+    50399237, 107350057, 108070953, 107677737, 52955177, 53020713, 107350059, 108070955,
+    107677739, 52955179, 53020715, 97912837, 97978373, 98043909, 98109445, 98174981,
+    98240517, 98306053, 98371589, 98437125, 98502661, 98568197, 98633733, 98699269,
+    107284491, 98764805, 98830341, 98895877, 98961413, 99026949, 117508101, 99092485,
+    99158021, 496699397, 496764933, 496830469, 496896005, 496961541, 497027077, 99223557,
+    99289093, 99354629, 99485701, 99420165, 99551237, 99616773, 99682309, 99747845,
+    99813381, 99878917, 99944453, 99354629, 3012, 99420165, 3012, 100009989,
+    100075525, 100141061, 100206597, 100272133, 100337669, 100403205, 100468741, 100534277,
+    100599813, 100665349, 100730885, 100796421, 100861957, 100927493, 100993029, 101058565,
+    101124101, 99616773, 3012, 101189637, 101255173, 101320709, 101386245, 101451781,
+    101517317, 101582853, 101648389, 101713925, 101779461, 101844997, 101910533, 101976069,
+    102041605, 102107141, 102172677, 102238213, 102303749, 102369285, 102434821, 102500357,
+    102565893, 102631429, 102696965, 102762501, 102828037, 102893573, 102959109, 103024645,
+    103090181, 103155717, 3012, 103417861, 3012, 103286789, 3012, 103155717,
+    103221253, 103286789, 103352325, 103417861, 103483397, 103548933, 103614469, 103680005,
+    103745541, 103811077, 103876613, 103942149, 104007685, 104073221, 104138757, 104204293,
+    104269829, 104335365, 104400901, 104466437, 104531973, 104597509, 104663045, 104728581,
+    104794117, 104859653, 104925189, 104990725, 105056261, 105121797, 105187333, 105252869,
+    105318405, 105383941, 105449477, 105515013, 105580549, 105646085, 105711621, 105777157,
+    105842693, 105908229, 105973765, 106039301, 106104837, 106170373, 106235909, 106301445,
+    106366981, 106432517, 106498053, 106498053, 3012, 106563589, 106629125, 106694661,
+    106760197, 106760197, 3012, 106825733, 106891269, 106891269, 3012, 106956805,
+    107087877, 107153413, 107218949, 107284485, 108070917, 108201989, 108267525, 108333061,
+    108464133, 108529669, 108595205, 108660741, 108726277, 108791813, 108922885, 109053957,
+    109119493, 109185029, 109250565, 109316101, 109381637, 109447173, 109447173, 3012,
+    109512709, 109512709, 3012, 109578245, 109643781, 109709317, 109774853, 109840389,
+    109840393, 109840393, 109840393, 109840393, 109840393, 109905925, 109905929, 109905929,
+    109905929, 109905929, 109905929, 109971461, 110036997, 110102533, 110168069, 110233605,
+    110299141, 110364677, 110430213, 110495749, 110561285, 110626821, 110692357, 110757893,
+    110823429, 110888965, 110954501, 110692357, 3012, 111020037, 111085573, 111085573,
+    3012, 111151109, 111216645, 111151109, 3012, 111282181, 111282181, 3012,
+    111347717, 111413253, 111478789, 111544325, 111609861, 111675397, 111740933, 111806469,
+    111872005, 111937541, 112003077, 112068613, 112134149, 112199685, 112265221, 112330757,
+    112396293, 112461829, 112527365, 112592901, 112658437, 112723973, 107677701, 3012,
+    112789509, 112789509, 3012, 112855045, 112920581, 112986117, 113051653, 113117189,
+    113182725, 113248261, 113313797, 113379333, 113444869, 111544325, 3012, 107612165,
+    3012, 107743237, 3012, 112920581, 3012, 112986117, 3012, 113510405,
+    113575941, 113510405, 3012, 113575941, 3012, 113641477, 113707013, 113641477,
+    3012, 113707013, 3012, 113772549, 113838085, 113903621, 113969157, 114034693,
+    114100229, 113772549, 3012, 113838085, 3012, 114165765, 114231301, 114165765,
+    3012, 114231301, 3012, 114296837, 114362373, 114296837, 3012, 114362373,
+    3012, 114427909, 114493445, 114558981, 114624517, 114690053, 114755589, 114821125,
+    114886661, 114952197, 115017733, 115083269, 115148805, 115214341, 115279877, 115345413,
+    115410949, 115476485, 115542021, 115607557, 115673093, 115738629, 115804165, 115869701,
+    115935237, 116000773, 116066309, 116131845, 116197381, 116262917, 116328453, 116393989,
+    116459525, 116525061, 116590597, 116000773, 3012, 116393989, 3012, 116459525,
+    3012, 116590597, 3012, 116656133, 116721669, 116787205, 116852741, 116918277,
+    116983813, 117049349, 117114885, 117180421, 117245957, 117311493, 117377029, 117442565,
+    117573637, 117639173, 117704709, 117770245, 117835781, 117901317, 117966853, 118032389,
+    118097925, 118163461, 118228997, 118294533, 118360069, 118425605, 118491141, 118556677,
+    118622213, 118687749, 118753285, 118818821, 118884357, 118949893, 119015429, 119080965,
+    119146501, 119212037, 119277573, 119343109, 119408645, 119474181, 119539717, 119605253,
+    119670789, 119736325, 119801861, 113903621, 3012, 113969157, 3012, 114886661,
+    3012, 114952197, 3012, 119867397, 119932933, 119998469, 120064005, 120129541,
+    120195077, 116787205, 3012, 116852741, 3012, 116918277, 3012, 116983813,
+    3012, 120260613, 120326149, 120391685, 120457221, 120522757, 120588293, 120653829,
+    120719365, 120784901, 120850437, 120915973, 120981509, 121047045, 121112581, 121178117,
+    121243653, 121309189, 121374725, 121440261, 121505797, 121571333, 121636869, 121702405,
+    121767941, 121833477, 121899013, 53872645, 53938181, 54003717, 54069253, 121964549,
+    122030085, 122095621, 122161157, 122226693, 122292229, 122357765, 122423301, 122488837,
+    122554373, 122619909, 122685445, 122750981, 122816517, 122882053, 122947589, 123013125,
+    123078661, 123144197, 123209733, 123275269, 123340805, 123406341, 123471877, 123537413,
+    123602949, 123668485, 123734021, 123799557, 58722309, 58787845, 123865093, 123930629,
+    123996165, 124061701, 124127237, 124192773, 124258309, 124323845, 124389381, 124454917,
+    124520453, 124585989, 124651525, 124717061, 124782597, 124848133, 124913669, 124979205,
+    125044741, 125110277, 125175813, 125241349, 125306885, 125372421, 125437957, 125503493,
+    125569029, 125634565, 125700101, 125765637, 125831173, 125896709, 125962245, 126027781,
+    126093317, 126158853, 126224389, 126289925, 126355461, 126420997, 126486533, 126552069,
+    126617605, 126683141, 126748677, 126814213, 126879749, 126945285, 127010821, 127076357,
+    127141893, 127207429, 127272965, 127338501, 127404037, 127469573, 127535109, 127600645,
+    127666181, 127731717, 127797253, 127862789, 127928325, 127993861, 128059397, 128124933,
+    128190469, 128256005, 128321541, 128387077, 128452613, 128518149, 128583685, 128649221,
+    128714757, 128780293, 128845829, 128911365, 128976901, 129042437, 129107973, 129173509,
+    129239045, 129304581, 129370117, 129435653, 129501189, 129566725, 129632261, 129697797,
+    129763333, 129828869, 129894405, 129959941, 130025477, 130091013, 130156549, 130222085,
+    130287621, 130353157, 130418693, 130484229, 130549765, 130615301, 130680837, 130746373,
+    130811909, 130877445, 130942981, 131008517, 131074053, 131139589, 131205125, 131270661,
+    131336197, 131401733, 131467269, 131532805, 131598341, 131663877, 131729413, 131794949,
+    131860485, 131926021, 131991557, 132057093, 132122629, 132188165, 132253701, 132319237,
+    132384773, 132450309, 132515845, 132581381, 132646917, 132712453, 132777989, 132843525,
+    132909061, 132974597, 133040133, 133105669, 133171205, 133236741, 133302277, 133367813,
+    133433349, 133498885, 133564421, 133629957, 133695493, 133761029, 133826565, 133892101,
+    133957637, 134023173, 134088709, 134154245, 134219781, 134285317, 134350853, 134416389,
+    134481925, 134547461, 134612997, 134678533, 134744069, 134809605, 134875141, 134940677,
+    135006213, 135071749, 135137285, 135202821, 135268357, 135333893, 135399429, 135464965,
+    135530501, 135596037, 135661573, 135727109, 135792645, 135858181, 135923717, 135989253,
+    136054789, 136120325, 136185861, 136251397, 136316933, 136382469, 136448005, 136513541,
+    136579077, 136644613, 136710149, 136775685, 136841221, 136906757, 136972293, 137037829,
+    137103365, 137168901, 137234437, 137299973, 137365509, 137431045, 137496581, 137562117,
+    137627653, 137693189, 137758725, 137824261, 137889797, 137955333, 138020869, 138086405,
+    138151941, 138217477, 138283013, 138348549, 138414085, 138479621, 138545157, 138610693,
+    138676229, 138741765, 138807301, 138872837, 138938373, 139003909, 139069445, 139134981,
+    139200517, 139266053, 139331589, 139397125, 139462661, 139528197, 139593733, 139659269,
+    139724805, 139790341, 139855877, 139921413, 139986949, 140052485, 140118021, 140183557,
+    140249093, 140314629, 140380165, 140445701, 140511237, 140576773, 140642309, 140707845,
+    140773381, 140838917, 140904453, 140969989, 141035525, 141101061, 141166597, 141232133,
+    141297669, 141363205, 141428741, 141494277, 141559813, 141625349, 141690885, 141756421,
+    141821957, 141887493, 141953029, 142018565, 142084101, 142149637, 142215173, 142280709,
+    142346245, 142411781, 142477317, 142542853, 142608389, 142673925, 142739461, 142804997,
+    142870533, 142936069, 143001605, 143067141, 143132677, 143198213, 143263749, 143329285,
+    143394821, 143460357, 143525893, 143591429, 143656965, 143722501, 143788037, 143853573,
+    143919109, 143984645, 144050181, 144115717, 144181253, 144246789, 144312325, 144377861,
+    144443397, 144508933, 144574469, 144640005, 144705541, 144771077, 144836613, 144902149,
+    144967685, 145033221, 145098757, 145164293, 145229829, 145295365, 145360901, 145426437,
+    145491973, 145557509, 145623045, 145688581, 145754117, 145819653, 145885189, 145950725,
+    146016261, 146081797, 146147333, 146212869, 146278405, 146343941, 146409477, 146475013,
+    146540549, 146606085, 146671621, 146737157, 146802693, 146868229, 146933765, 146999301,
+    147064837, 147130373, 147195909, 147261445, 147326981, 147392517, 147458053, 147523589,
+    147589125, 147654661, 147720197, 147785733, 147851269, 147916805, 147982341, 148047877,
+    148113413, 148178949, 148244485, 148310021, 148375557, 148441093, 148506629, 148572165,
+    148637701, 148703237, 148768773, 148834309, 148899845, 148965381, 149030917, 149096453,
+    149161989, 149227525, 149293061, 149358597, 149424133, 149489669, 149555205, 149620741,
+    149686277, 149751813, 149817349, 149882885, 149948421, 150013957, 150079493, 150145029,
+    150210565, 150276101, 150341637, 150407173, 150472709, 150538245, 150603781, 150669317,
+    150734853, 150800389, 150865925, 150931461, 150996997, 151062533, 151128069, 151193605,
+    151259141, 151324677, 151390213, 151455749, 151521285, 151586821, 151652357, 151717893,
+    151783429, 151848965, 151914501, 151980037, 152045573, 152111109, 152176645, 152242181,
+    152307717, 152373253, 152438789, 152504325, 152569861, 152635397, 152700933, 152766469,
+    152832005, 152897541, 152963077, 153028613, 153094149, 153159685, 153225221, 153290757,
+    153356293, 153421829, 153487365, 153552901, 153618437, 153683973, 153749509, 153815045,
+    153880581, 153946117, 154011653, 154077189, 154142725, 154208261, 154273797, 154339333,
+    154404869, 154470405, 154535941, 154601477, 154667013, 154732549, 154798085, 154863621,
+    154929157, 154994693, 155060229, 155125765, 155191301, 155256837, 155322373, 155387909,
+    155453445, 155518981, 155584517, 155650053, 155715589, 155781125, 155846661, 155912197,
+    155977733, 156043269, 156108805, 156174341, 156239877, 156305413, 156370949, 156436485,
+    156502021, 156567557, 156633093, 156698629, 156764165, 156829701, 156895237, 156960773,
+    157026309, 157091845, 157157381, 157222917, 157288453, 157353989, 157419525, 157485061,
+    157550597, 157616133, 157681669, 157747205, 157812741, 171116549, 171182085, 171247621,
+    171313157, 171378693, 171444229, 171509765, 171575301, 171640837, 171706373, 171771909,
+    171837445, 171902981, 171968517, 172034053, 172099589, 172165125, 172230661, 172296197,
+    172361733, 172427269, 172492805, 172558341, 172623877, 172689413, 172754949, 172820485,
+    172886021, 172951557, 173017093, 173082629, 173148165, 173213701, 173279237, 173344773,
+    173410309, 173475845, 173541381, 173606917, 173672453, 173737989, 173803525, 173869061,
+    173934597, 174000133, 174065669, 174131205, 174196741, 267257861, 267323397, 267388933,
+    267454469, 267520005, 267585541, 267651077, 267716613, 174262277, 174327813, 174393349,
+    174458885, 174524421, 174589957, 174655493, 174721029, 174786565, 174852101, 174917637,
+    174983173, 175048709, 175114245, 175179781, 175245317, 175310853, 175376389, 175441925,
+    175507461, 175572997, 175638533, 175704069, 175769605, 175835141, 175900677, 175966213,
+    176031749, 176097285, 176162821, 176228357, 176293893, 176359429, 176424965, 176490501,
+    176556037, 176621573, 176687109, 176752645, 176818181, 176883717, 176949253, 177014789,
+    177080325, 177145861, 177211397, 177276933, 177342469, 177408005, 177473541, 177539077,
+    177604613, 177670149, 306251781, 306317317, 306382853, 177735685, 177801221, 177866757,
+    177932293, 177997829, 178063365, 178128901, 178194437, 178259973, 178325509, 178391045,
+    178456581, 178522117, 178587653, 178653189, 178718725, 178784261, 178849797, 178915333,
+    178980869, 179046405, 179111941, 179177477, 179243013, 179308549, 179374085, 266864645,
+    266930181, 266995717, 267061253, 267126789, 267192325, 179439621, 179505157, 179570693,
+    179636229, 179701765, 179767301, 179832837, 179898373, 179963909, 180029445, 180094981,
+    180160517, 180226053, 180291589, 180357125, 180422661, 180488197, 180553733, 180619269,
+    180684805, 180750341, 180815877, 180881413, 180946949, 181012485, 181078021, 181143557,
+    181209093, 181274629, 181340165, 181405701, 181471237, 181536773, 181602309, 181667845,
+    181733381, 181798917, 181864453, 181929989, 181995525, 182061061, 182126597, 182192133,
+    182257669, 182323205, 182388741, 182454277, 182519813, 182585349, 182650885, 182716421,
+    182781957, 182847493, 182913029, 182978565, 183044101, 183109637, 183175173, 183240709,
+    183306245, 183371781, 183437317, 183502853, 183568389, 183633925, 183699461, 183764997,
+    183830533, 183896069, 183961605, 184027141, 184092677, 184158213, 184223749, 184289285,
+    184354821, 184420357, 184485893, 184551429, 184616965, 184682501, 184748037, 184813573,
+    184879109, 184944645, 185010181, 185075717, 185141253, 185206789, 185272325, 185337861,
+    185403397, 185468933, 185534469, 185600005, 185665541, 185731077, 185796613, 185862149,
+    185927685, 185993221, 186058757, 186124293, 186189829, 186255365, 186320901, 186386437,
+    186451973, 186517509, 186583045, 186648581, 186714117, 188483589, 188549125, 188614661,
+    188680197, 188745733, 188811269, 188876805, 188942341, 189007877, 189073413, 189138949,
+    189204485, 189270021, 189335557, 189401093, 189466629, 189532165, 189597701, 189663237,
+    189728773, 189794309, 189859845, 189925381, 189990917, 190056453, 190121989, 190187525,
+    190253061, 190318597, 190384133, 190449669, 190515205, 190580741, 190777349, 190842885,
+    190908421, 190973957, 191039493, 191105029, 191170565, 191236101, 191301637, 191367173,
+    191432709, 191498245, 191563781, 191629317, 191694853, 191760389, 191825925, 191891461,
+    191956997, 192022533, 192088069, 192153605, 192219141, 192284677, 192350213, 192415749,
+    192481285, 192546821, 192612357, 192677893, 192743429, 192808965, 192874501, 192940037,
+    193005573, 193071109, 193136645, 193202181, 193267717, 193333253, 193398789, 193464325,
+    193529861, 193595397, 193660933, 193726469, 193792005, 193857541, 193923077, 193988613,
+    194054149, 194119685, 194185221, 194250757, 194316293, 194381829, 194447365, 194512901,
+    194578437, 194643973, 194709509, 194775045, 194840581, 194906117, 194971653, 195037189,
+    195102725, 195168261, 195233797, 195299333, 195364869, 56494085, 56559621, 56625157,
+    56690693, 56756229, 56821765, 56887301, 56952837, 57018373, 57083909, 57149445,
+    57214981, 57280517, 57346053, 195430405, 195495941, 195561477, 195627013, 195692549,
+    195758085, 195823621, 195889157, 195954693, 196020229, 196085765, 196151301, 196216837,
+    196282373, 196347909, 196413445, 196478981, 196544517, 196610053, 196675589, 196741125,
+    196806661, 196872197, 196937733, 197003269, 197068805, 197134341, 197199877, 197265413,
+    197330949, 197396485, 197462021, 197527557, 197593093, 197658629, 197724165, 197789701,
+    197855237, 197920773, 197986309, 198051845, 198117381, 198182917, 198248453, 198313989,
+    198379525, 198445061, 198510597, 198576133, 55707653, 55773189, 198641669, 198707205,
+    198772741, 198838277, 198903813, 198969349, 199034885, 199100421, 199165957, 199231493,
+    199297029, 199362565, 199428101, 199493637, 199559173, 199624709, 199690245, 199755781,
+    199821317, 199886853, 199952389, 200017925, 200083461, 200148997, 200214533, 200280069,
+    200345605, 200411141, 200476677, 200542213, 200607749, 55838725, 55904261, 55969797,
+    56035333, 56100869, 56166405, 56231941, 56297477, 56363013, 56428549, 200673285,
+    200738821, 200804357, 200869893, 200935429, 201000965, 201066501, 201132037, 201197573,
+    201263109, 201328645, 201394181, 201459717, 201525253, 201590789, 201656325, 250087429,
+    250152965, 250218501, 250284037, 250349573, 250415109, 250480645, 250546181, 250611717,
+    250677253, 250742789, 250808325, 250873861, 250939397, 251004933, 251070469, 251136005,
+    251201541, 251267077, 251332613, 251398149, 251463685, 251529221, 251594757, 251660293,
+    251725829, 251791365, 251856901, 251922437, 251987973, 252053509, 252119045, 252184581,
+    252250117, 252315653, 252381189, 252446725, 252512261, 252577797, 252643333, 252708869,
+    252774405, 252839941, 252905477, 252971013, 253036549, 253102085, 253167621, 253233157,
+    253298693, 253364229, 253429765, 253495301, 253560837, 253626373, 253691909, 253757445,
+    253822981, 253888517, 253954053, 254019589, 254085125, 254150661, 254216197, 254281733,
+    254347269, 254412805, 254478341, 254543877, 254609413, 254674949, 254740485, 254806021,
+    254871557, 254937093, 255002629, 255068165, 255133701, 255199237, 255264773, 255330309,
+    255395845, 255461381, 255526917, 255592453, 255657989, 255723525, 255789061, 255854597,
+    255920133, 255985669, 256051205, 256116741, 256182277, 256247813, 256313349, 256378885,
+    256444421, 256509957, 256575493, 256641029, 256706565, 256772101, 256837637, 256903173,
+    256968709, 257034245, 257099781, 257165317, 257230853, 257296389, 257361925, 257427461,
+    257492997, 257558533, 257624069, 257689605, 257755141, 257820677, 257886213, 257951749,
+    258017285, 258082821, 258148357, 258213893, 258279429, 258344965, 258410501, 258476037,
+    258541573, 258607109, 258672645, 258738181, 258803717, 258869253, 258934789, 259000325,
+    259065861, 259131397, 259196933, 259262469, 259328005, 259393541, 259459077, 259524613,
+    259590149, 259655685, 259721221, 259786757, 259852293, 259917829, 259983365, 260048901,
+    260114437, 260179973, 260245509, 260311045, 260376581, 260442117, 260507653, 260573189,
+    260638725, 260704261, 260769797, 260835333, 260900869, 260966405, 261031941, 261097477,
+    261163013, 261228549, 261294085, 261359621, 261425157, 261490693, 261556229, 261621765,
+    261687301, 261752837, 261818373, 261883909, 261949445, 262014981, 262080517, 262146053,
+    262211589, 262277125, 262342661, 262408197, 262473733, 262539269, 262604805, 262670341,
+    262735877, 262801413, 262866949, 262932485, 262998021, 263063557, 263129093, 263194629,
+    263260165, 263325701, 263391237, 263456773, 263522309, 263587845, 263653381, 263718917,
+    263784453, 263849989, 263915525, 263981061, 264046597, 264112133, 264177669, 264243205,
+    264308741, 264374277, 264439813, 264505349, 264570885, 264636421, 264701957, 264767493,
+    264833029, 264898565, 264964101, 265029637, 265095173, 265160709, 265226245, 265291781,
+    265357317, 265422853, 265488389, 265553925, 265619461, 265684997, 265750533, 265816069,
+    265881605, 265947141, 266012677, 266078213, 266143749, 266209285, 266274821, 266340357,
+    266405893, 266471429, 266536965, 266602501, 266668037, 266733573, 266799109, 201721861,
+    201787397, 201852933, 201918469, 201984005, 202049541, 202115077, 202180613, 202246149,
+    202311685, 202377221, 202442757, 202508293, 202573829, 202639365, 202704901, 202770437,
+    202835973, 202901509, 202967045, 203032581, 203098117, 203163653, 203229189, 203294725,
+    203360261, 203425797, 203491333, 203556869, 203622405, 203687941, 203753477, 203819013,
+    203884549, 203950085, 204015621, 204081157, 204146693, 204212229, 204277765, 204343301,
+    204408837, 204474373, 204539909, 204605445, 204670981, 204736517, 204802053, 204867589,
+    204933125, 204998661, 205064197, 205129733, 205195269, 205260805, 205326341, 205391877,
+    205457413, 205522949, 205588485, 205654021, 205719557, 205785093, 205850629, 205916165,
+    205981701, 206047237, 206112773, 206178309, 206243845, 206309381, 206374917, 206440453,
+    206505989, 206571525, 206637061, 206702597, 206768133, 206833669, 206899205, 206964741,
+    207030277, 207095813, 207161349, 207226885, 207292421, 207357957, 207423493, 207489029,
+    207554565, 207620101, 207685637, 207751173, 207816709, 207882245, 207947781, 208013317,
+    208078853, 208144389, 208209925, 208275461, 208340997, 208406533, 208472069, 208537605,
+    208603141, 208668677, 208734213, 208799749, 208865285, 208930821, 208996357, 209061893,
+    209127429, 209192965, 209258501, 209324037, 209389573, 209455109, 209520645, 209586181,
+    209651717, 209717253, 209782789, 209848325, 209913861, 209979397, 210044933, 210110469,
+    210176005, 210241541, 54265861, 54331397, 54396933, 54462469, 54528005, 54593541,
+    54659077, 54724613, 54790149, 54855685, 54921221, 54986757, 55052293, 55117829,
+    55183365, 55248901, 55314437, 55379973, 55445509, 55511045, 55576581, 55642117,
+    210307077, 210372613, 210438149, 210503685, 210569221, 210634757, 210700293, 210765829,
+    210831365, 210896901, 210962437, 211027973, 211093509, 211159045, 211224581, 211290117,
+    211355653, 211421189, 211486725, 211552261, 211617797, 211683333, 211748869, 211814405,
+    211879941, 211945477, 212011013, 212076549, 212142085, 212207621, 212273157, 212338693,
+    212404229, 212469765, 212535301, 212600837, 212666373, 212731909, 212797445, 212862981,
+    212928517, 212994053, 213059589, 213125125, 213190661, 213256197, 213321733, 213387269,
+    213452805, 213518341, 213583877, 213649413, 213714949, 213780485, 213846021, 213911557,
+    213977093, 214042629, 214108165, 214173701, 214239237, 214304773, 214370309, 60164101,
+    60229637, 60295173, 60360709, 214435845, 214501381, 214566917, 214632453, 214697989,
+    214763525, 214829061, 214894597, 214960133, 215025669, 215091205, 215156741, 215222277,
+    215287813, 215353349, 215418885, 215484421, 215549957, 215615493, 215681029, 215746565,
+    215812101, 215877637, 215943173, 216008709, 216074245, 216139781, 216205317, 216270853,
+    216336389, 216401925, 216467461, 54134789, 54200325, 216532997, 216598533, 216664069,
+    216729605, 216795141, 216860677, 216926213, 216991749, 217057285, 217122821, 217188357,
+    217253893, 217319429, 217384965, 109840393, 109840393, 109840393, 109840393, 217450501,
+    217516037, 217581573, 217647109, 217712645, 217778181, 217843717, 217909253, 217974789,
+    218040325, 218105861, 218171397, 218236933, 218302469, 218368005, 218433541, 218499077,
+    218564613, 218630149, 218695685, 218761221, 218826757, 218892293, 218957829, 219023365,
+    219088901, 219154437, 219219973, 219285509, 219351045, 219416581, 219482117, 219547653,
+    219613189, 219678725, 219744261, 219809797, 219875333, 219940869, 220006405, 220071941,
+    220137477, 220203013, 220268549, 220334085, 220399621, 220465157, 220530693, 220596229,
+    220661765, 220727301, 220792837, 220858373, 220923909, 220989445, 221054981, 221120517,
+    221186053, 221251589, 221317125, 221382661, 221448197, 221513733, 221579269, 221644805,
+    221710341, 221775877, 221841413, 221906949, 221972485, 222038021, 222103557, 222169093,
+    222234629, 222300165, 222365701, 222431237, 222496773, 222562309, 222627845, 222693381,
+    222758917, 222824453, 222889989, 222955525, 223021061, 223086597, 223152133, 223217669,
+    223283205, 223348741, 223414277, 223479813, 223545349, 223610885, 223676421, 223741957,
+    223807493, 223873029, 223938565, 224004101, 224069637, 224135173, 37750793, 37750793,
+    107677705, 107677705, 107677705, 107677705, 107677705, 107677705, 224200709, 224266245,
+    224331781, 224397317, 224462853, 224528389, 224593925, 224659461, 224724997, 224790533,
+    224856069, 224921605, 224987141, 225052677, 225118213, 225183749, 225249285, 225314821,
+    225380357, 225445893, 225511429, 225576965, 225642501, 225708037, 225773573, 225839109,
+    225904645, 225970181, 226035717, 226101253, 226166789, 226232325, 226297861, 226363397,
+    226428933, 226494469, 226560005, 226625541, 226691077, 226756613, 226822149, 226887685,
+    226953221, 227018757, 227084293, 227149829, 227215365, 227280901, 227346437, 227411973,
+    227477509, 227543045, 227608581, 227674117, 227739653, 227805189, 227870725, 227936261,
+    228001797, 228067333, 228132869, 228198405, 228263941, 228329477, 228395013, 228460549,
+    228526085, 228591621, 228657157, 228722693, 228788229, 228853765, 228919301, 228984837,
+    229050373, 229115909, 229181445, 229246981, 229312517, 229378053, 229443589, 229509125,
+    229574661, 229640197, 229705733, 229771269, 229836805, 229902341, 229967877, 230033413,
+    230098949, 230164485, 230230021, 230295557, 230361093, 230426629, 230492165, 230557701,
+    230623237, 230688773, 230754309, 230819845, 3012, 230819845, 230885381, 230950917,
+    231016453, 231081989, 231147525, 231213061, 231278597, 231344133, 231409669, 231475205,
+    231540741, 231606277, 231671813, 231737349, 231802885, 231868421, 231933957, 231999493,
+    232065029, 232130565, 232196101, 232261637, 232327173, 232392709, 232458245, 232523781,
+    232589317, 232654853, 232720389, 232785925, 232851461, 232916997, 232982533, 233048069,
+    233113605, 233179141, 233244677, 233310213, 233375749, 233441285, 233506821, 233572357,
+    233637893, 233703429, 233768965, 233834501, 233900037, 233965573, 234031109, 234096645,
+    234162181, 234227717, 234293253, 234358789, 234424325, 234489861, 234555397, 234620933,
+    234686469, 234752005, 234817541, 234883077, 234948613, 235014149, 235079685, 235145221,
+    235210757, 235276293, 235341829, 235407365, 235472901, 235538437, 235603973, 235669509,
+    235735045, 235800581, 235866117, 235931653, 235997189, 236062725, 236128261, 236193797,
+    236259333, 236324869, 236390405, 236455941, 236521477, 236587013, 236652549, 236718085,
+    236783621, 236849157, 236914693, 236980229, 237045765, 237111301, 237176837, 237242373,
+    237307909, 237373445, 237438981, 237504517, 237570053, 237635589, 237701125, 237766661,
+    237832197, 237897733, 237963269, 238028805, 238094341, 238159877, 238225413, 238290949,
+    238356485, 238422021, 238487557, 238553093, 238618629, 238684165, 238749701, 238815237,
+    238880773, 238946309, 239011845, 239077381, 239142917, 239208453, 239273989, 239339525,
+    239405061, 239470597, 239536133, 239601669, 239667205, 239732741, 239798277, 239863813,
+    239929349, 239994885, 240060421, 240125957, 240191493, 240257029, 240322565, 240388101,
+    240453637, 240519173, 240584709, 240650245, 240715781, 240781317, 240846853, 240912389,
+    240977925, 241043461, 241108997, 241174533, 241240069, 241305605, 241371141, 241436677,
+    241502213, 241567749, 241633285, 241698821, 241764357, 241829893, 241895429, 241960965,
+    242026501, 242092037, 242157573, 242223109, 242288645, 242354181, 242419717, 242485253,
+    242550789, 242616325, 242681861, 242747397, 242812933, 242878469, 242944005, 243009541,
+    243075077, 243140613, 243206149, 243271685, 243337221, 243402757, 243468293, 243533829,
+    243599365, 243664901, 243730437, 243795973, 243861509, 243927045, 243992581, 244058117,
+    244123653, 244189189, 244254725, 244320261, 244385797, 244451333, 244516869, 244582405,
+    244647941, 244713477, 244779013, 244844549, 244910085, 244975621, 245041157, 245106693,
+    245172229, 245237765, 245303301, 245368837, 245434373, 245499909, 245565445, 245630981,
+    245696517, 245762053, 245827589, 245893125, 245958661, 246024197, 246089733, 246155269,
+    246220805, 246286341, 246351877, 246417413, 246482949, 246548485, 246614021, 246679557,
+    246745093, 246810629, 246876165, 246941701, 247007237, 247072773, 247138309, 247203845,
+    247269381, 247334917, 247400453, 247465989, 247531525, 247597061, 247662597, 247728133,
+    247793669, 247859205, 247924741, 247990277, 248055813, 248121349, 248186885, 248252421,
+    248317957, 248383493, 248449029, 248514565, 248580101, 248645637, 248711173, 248776709,
+    248842245, 248907781, 248973317, 249038853, 249104389, 249169925, 249235461, 249300997,
+    249366533, 249432069, 249497605, 249563141, 249628677, 249694213, 249759749, 249825285,
+    249890821, 249956357, 250021893, 42469381, 41224197, 41289733, 50792453, 498534405,
+    42534917, 50857989, 72550405, 63637509, 63703045, 57411589, 57477125, 57542661,
+    57608197, 63768581, 63834117, 63899653, 57673733, 57739269, 63965189, 57804805,
+    57870341, 64030725, 64096261, 64161797, 64227333, 64292869, 64358405, 64423941,
+    64489477, 64555013, 35391493, 41748485, 50923525, 64620549, 64686085, 57935877,
+    58001413, 64751621, 64817157, 58066949, 58132485, 58198021, 58263557, 58329093,
+    58394629, 58460165, 58525701, 58591237, 58656773, 50464773, 50530309, 50595845,
+    50661381, 40830981, 42600453, 43255813, 35981317, 43321349, 35915781, 37554181,
+    62195717, 62261253, 62326789, 60491781, 35129349, 35194885, 42665989, 50726917,
+    60098565, 60753925, 35457029, 36046853, 52561925, 35325957, 64882693, 64948229,
+    65013765, 65079301, 65144837, 37685253, 61343749, 62392325, 36112389, 60688389,
+    36177925, 36243461, 190646277, 190711813, 61540357, 488310789, 488376325, 488441861,
+    488507397, 488572933, 488638469, 488704005, 488769541, 488835077, 488900613, 488966149,
+    489031685, 34146311, 37095429, 43124741, 62982149, 491456517, 58853381, 58918917,
+    58984453, 59049989, 59115525, 59181061, 59246597, 59312133, 491522053, 491587589,
+    59377669, 59443205, 59508741, 59574277, 59639813, 59705349, 59770885, 59836421,
+    35522565, 52627461, 52692997, 52758533, 491653125, 35588101, 491522057, 491718661,
+    63047685, 491784197, 491849733, 79890437, 79955973, 35653637, 35719173, 491915269,
+    491980805, 489097221, 489162757, 489228293, 489293829, 489359365, 489424901, 489490437,
+    489555973, 489621509, 489687045, 489752581, 489818117, 489883653, 489949189, 490014725,
+    490080261, 490145797, 490211333, 490276869, 490342405, 490407941, 490473477, 490539013,
+    490604549, 490670085, 490735621, 490801157, 490866693, 490932229, 490997765, 491063301,
+    491128837, 491194373, 491259909, 491325445, 491390981, 492046341, 267782149, 267847685,
+    267913221, 267978757, 268044293, 268109829, 268175365, 268240901, 268306437, 268371973,
+    268437509, 268503045, 268568581, 268634117, 268699653, 268765189, 268830725, 268896261,
+    268961797, 269027333, 269092869, 269158405, 269223941, 269289477, 269355013, 269420549,
+    269486085, 269551621, 269617157, 269682693, 269748229, 269813765, 269879301, 269944837,
+    270010373, 270075909, 270141445, 270206981, 270272517, 270338053, 270403589, 270469125,
+    270534661, 270600197, 270665733, 270731269, 270796805, 270862341, 270927877, 270993413,
+    271058949, 271124485, 271190021, 271255557, 271321093, 271386629, 271452165, 271517701,
+    271583237, 271648773, 271714309, 271779845, 271845381, 271910917, 277678085, 277743621,
+    277809157, 277874693, 277940229, 278005765, 278071301, 278136837, 278202373, 278267909,
+    278333445, 278398981, 278464517, 278530053, 278595589, 278661125, 278726661, 278792197,
+    278857733, 278923269, 278988805, 279054341, 279119877, 279185413, 279250949, 279316485,
+    279382021, 279447557, 279513093, 279578629, 279644165, 279709701, 279775237, 279840773,
+    279906309, 279971845, 280037381, 280102917, 280168453, 280233989, 280299525, 280365061,
+    280430597, 280496133, 280561669, 280627205, 280692741, 280758277, 280823813, 280889349,
+    280954885, 281020421, 281085957, 281151493, 281217029, 36833285, 42731525, 36898821,
+    42797061, 41355269, 61147141, 65210373, 48236549, 42862597, 40241157, 36964357,
+    37619717, 41420805, 84150277, 84215813, 84281349, 84346885, 84412421, 84477957,
+    84543493, 84609029, 84674565, 84740101, 84805637, 84871173, 84936709, 85002245,
+    85067781, 85133317, 85198853, 85264389, 85329925, 85395461, 85460997, 85526533,
+    85592069, 85657605, 85723141, 85788677, 85854213, 85919749, 85985285, 86050821,
+    86116357, 86181893, 86247429, 86312965, 86378501, 86444037, 86509573, 90966021,
+    91031557, 91097093, 91162629, 492963845, 493029381, 493094917, 493160453, 493225989,
+    493291525, 91228165, 91293701, 91359237, 72615941, 72681477, 43780101, 43845637,
+    43517957, 43583493, 67176453, 67241989, 67307525, 67373061, 73009157, 44042245,
+    48302085, 47581189, 47646725, 47712261, 47777797, 47843333, 47908869, 39979013,
+    44763141, 44828677, 47974405, 48039941, 48105477, 48171013, 73074693, 73140229,
+    73205765, 44894213, 44959749, 45025285, 94046213, 94111749, 94177285, 68028421,
+    68093957, 45090821, 41486341, 86575109, 81397765, 81463301, 45156357, 107350027,
+    87427077, 87492613, 87558149, 87623685, 87689221, 87754757, 87820293, 87885829,
+    87951365, 88016901, 88082437, 88147973, 88213509, 88279045, 88344581, 88410117,
+    59901957, 59967493, 87361541, 35850285, 37095469, 43124781, 37750829, 37357613,
+    40306733, 40699949, 59508781, 59574317, 41814061, 41814061, 41814061, 41814061,
+    41814061, 34998317, 34932781, 34277421, 52955181, 53020717, 53217325, 53282861,
+    59377709, 59443245, 59246637, 59312173, 58853421, 58918957, 58722349, 58787885,
+    58984493, 59050029, 59115565, 59181101, 37160965, 37226501, 53086253, 53151789,
+    34211849, 34277385, 35850271, 37095455, 41814047, 37357599, 37750815, 40699935,
+    40306719, 34998303, 52955167, 53020703, 53217311, 53282847, 59377695, 59443231,
+    61605919, 61409311, 60885023, 107350047, 34408479, 107612191, 107743263, 107677727,
+    61278239, 61671455, 60819487, 40306695, 52234247, 61605895, 61671431, 61409287,
+    51775495, 52955143, 53020679, 60884999, 107350023, 35850247, 34408455, 41814023,
+    61212679, 37750791, 37357575, 107612167, 107677703, 107743239, 40699911, 60819463,
+    53086215, 61278215, 53151751, 79104007, 34277383, 78907399, 53217287, 107874311,
+    53282823, 108005383, 54396935, 54462471, 43124773, 58984485, 59050021, 37095461,
+    35719205, 107808775, 79169543, 107939847, 141232165, 99354661, 99485733, 99420197,
+    99551269, 151586853, 154404901, 492111877, 51054597, 51120133, 51185669, 498993157,
+    499058693, 499124229, 499189765, 499255301, 499320837, 499386373, 499451909, 499517445,
+    499582981, 499648517, 499714053, 499779589, 499845125, 499910661, 499976197, 500041733,
+    500107269, 500172805, 500238341, 500303877, 500369413, 500434949, 500500485, 500566021,
+    500631557, 500697093, 500762629, 500828165, 500893701, 500959237, 501024773, 501090309,
+    501155845, 501221381, 501286917, 281282565, 281348101, 281413637, 281479173, 281544709,
+    281610245, 281675781, 281741317, 281806853, 501352453, 501417989, 501483525, 501549061,
+    501614597, 501680133, 501745669, 501811205, 501876741, 501942277, 502007813, 502073349,
+    502138885, 502204421, 502269957, 502335493, 502401029, 502466565, 502532101, 502597637,
+    502663173, 502728709, 502794245, 502859781, 502925317, 502990853, 503056389, 503121925,
+    503187461, 503252997, 503318533, 503384069, 503449605, 503515141, 503580677, 503646213,
+    503711749, 503777285, 503842821, 503908357, 503973893, 504039429, 504104965, 504170501,
+    281872389, 281937925, 282003461, 282068997, 282134533, 282200069, 282265605, 282331141,
+    282396677, 282462213, 282527749, 282593285, 282658821, 282724357, 282789893, 282855429,
+    282920965, 504236037, 282986501, 283052037, 283117573, 283183109, 283248645, 283314181,
+    283379717, 283445253, 283510789, 283576325, 283641861, 283707397, 283772933, 283838469,
+    283904005, 283969541, 284035077, 284100613, 284166149, 284231685, 284297221, 284362757,
+    284428293, 284493829, 284559365, 284624901, 284690437, 284755973, 284821509, 284887045,
+    284952581, 285018117, 285083653, 285149189, 285214725, 285280261, 285345797, 285411333,
+    285476869, 285542405, 285607941, 285673477, 285739013, 285804549, 285870085, 285935621,
+    286001157, 286066693, 286132229, 286197765, 286263301, 286328837, 286394373, 286459909,
+    286525445, 286590981, 286656517, 286722053, 286787589, 286853125, 286918661, 286984197,
+    504301573, 504367109, 504432645, 504498181, 504563717, 504629253, 504694789, 504760325,
+    504825861, 504891397, 504956933, 505022469, 505088005, 505153541, 505219077, 505284613,
+    505350149, 505415685, 498599941, 498665477, 51251205, 51316741, 505481221, 505546757,
+    505612293, 73271301, 48367621, 506660869, 506726405, 506791941, 506857477, 506923013,
+    287049733, 287115269, 505677829, 505743365, 505808901, 505874437, 505939973, 506005509,
+    506071045, 506136581, 506464261, 506529797, 506595333, 51382277, 50989061, 522913797,
+    522192901, 519374853, 519440389, 519505925, 519571461, 519636997, 519702533, 519768069,
+    519833605, 519899141, 519964677, 520030213, 520095749, 520161285, 520226821, 520292357,
+    520357893, 520423429, 520488965, 520554501, 520620037, 520685573, 520751109, 520816645,
+    520882181, 520947717, 521013253, 521078789, 521144325, 521209861, 521275397, 521340933,
+    521406469, 521472005, 521537541, 521603077, 521668613, 521734149, 521799685, 521865221,
+    521930757, 521996293, 522061829, 522127365, 522258437, 522323973, 522389509, 522455045,
+    522520581, 522586117, 522651653, 522717189, 522782725, 522848261, 509478917, 509544453,
+    509609989, 509675525, 509741061, 73664517, 73730053, 73795589, 73861125, 73926661,
+    73992197, 45221893, 45287429, 74057733, 506202117, 506267653, 506333189, 506398725,
+    506988549, 507054085, 507119621, 74385413, 74450949, 74516485, 74582021, 74647557,
+    74713093, 74778629, 74319877, 48433157, 48498693, 48564229, 48629765, 48695301,
+    48760837, 507185157, 507250693, 507316229, 507381765, 507447301, 507512837, 507578373,
+    507643909, 74844165, 74909701, 74975237, 75040773, 507709445, 507774981, 507840517,
+    498731013, 498796549, 498862085, 498927621, 497092613, 497158149, 497223685, 497289221,
+    497354757, 497420293, 497485829, 497551365, 497616901, 497682437, 497747973, 497813509,
+    497879045, 497944581, 498010117, 498075653, 498141189, 498206725, 498272261, 498337797,
+    498403333, 498468869, 35784709, 507906053, 507971589, 508037125, 508102661, 508168197,
+    508233733, 508299269, 508364805, 48826373, 48891909, 48957445, 49022981, 49088517,
+    508430341, 508495877, 508561413, 45352965, 45418501, 73336837, 73402373, 73467909,
+    73533445, 73598981, 508758021, 508823557, 508889093, 508954629, 509020165, 509085701,
+    509151237, 509216773, 509282309, 509347845, 509413381, 75106309, 75171845, 49154053,
+    49219589, 45484037, 45549573, 49285125, 45615109, 45680645, 41551877, 75237381,
+    75302917, 45746181, 45811717, 75433989, 49350661, 75368453, 75499525, 75565061,
+    49416197, 49481733, 510461957, 510527493, 510593029, 510658565, 510724101, 510789637,
+    510855173, 510920709, 510986245, 511051781, 511117317, 45877253, 45942789, 75630597,
+    75696133, 75761669, 75827205, 49547269, 46008325, 46073861, 75892741, 76023813,
+    76089349, 75958277, 76154885, 76220421, 76285957, 76351493, 46139397, 46204933,
+    76417029, 76482565, 76548101, 76613637, 76679173, 76744709, 76810245, 76875781,
+    76941317, 77006853, 77072389, 77137925, 77203461, 77268997, 77334533, 77400069,
+    77465605, 77531141, 77596677, 77662213, 46270469, 46336005, 77727749, 66258949,
+    66324485, 66390021, 66455557, 66521093, 66586629, 66652165, 66717701, 66783237,
+    66848773, 66914309, 66979845, 67045381, 508626949, 508692485, 46401541, 46467077,
+    49612805, 94242821, 77793285, 511182853, 511248389, 511313925, 511379461, 511444997,
+    511510533, 511576069, 511641605, 511707141, 46532613, 77858821, 49678341, 77924357,
+    69601285, 69666821, 69732357, 69797893, 69863429, 69928965, 69994501, 70060037,
+    70125573, 70191109, 70256645, 70322181, 70387717, 70453253, 70518789, 70584325,
+    46598149, 46663685, 74123269, 74188805, 74254341, 509806597, 509872133, 509937669,
+    510003205, 510068741, 510134277, 510199813, 510265349, 510330885, 510396421, 70649861,
+    70715397, 49743877, 49809413, 493553669, 493619205, 493684741, 493750277, 493815813,
+    493881349, 493946885, 494012421, 494077957, 494143493, 494209029, 494274565, 494340101,
+    494405637, 494471173, 494536709, 494602245, 494667781, 494733317, 494798853, 494864389,
+    89131013, 89196549, 89262085, 89327621, 89393157, 89458693, 89524229, 89589765,
+    89655301, 89720837, 89786373, 89851909, 89917445, 89982981, 90048517, 90114053,
+    90179589, 90245125, 90310661, 90376197, 90441733, 90507269, 90572805, 90638341,
+    90703877, 77989893, 522979333, 523044869, 523110405, 523175941, 523241477, 523307013,
+    523372549, 523438085, 523503621, 523569157, 523634693, 523700229, 523765765, 523831301,
+    523896837, 523962373, 524027909, 51447813, 51513349, 51578885, 51644421, 51709957,
+    46729221, 46794757, 42928133, 78055429, 78120965, 78186501, 78252037, 78317573,
+    287180805, 287246341, 287311877, 287377413, 78383109, 287442949, 511772677, 511838213,
+    511903749, 511969285, 512034821, 512100357, 512165893, 512231429, 512296965, 512362501,
+    512428037, 512493573, 512559109, 512624645, 512690181, 512755717, 512821253, 37029893,
+    42993669, 78448645, 78514181, 37292037, 320079877, 43059205, 287574021, 287639557,
+    287705093, 287770629, 287836165, 287901701, 287967237, 288032773, 288098309, 288163845,
+    288229381, 288294917, 288360453, 288425989, 288491525, 288557061, 288622597, 288688133,
+    288753669, 288819205, 288884741, 288950277, 289015813, 289081349, 289146885, 289212421,
+    289277957, 289343493, 289409029, 289474565, 289540101, 289605637, 289671173, 289736709,
+    289802245, 289867781, 289933317, 289998853, 290064389, 290129925, 290195461, 290260997,
+    290326533, 290392069, 290457605, 290523141, 290588677, 290654213, 290719749, 290785285,
+    290850821, 290916357, 290981893, 291047429, 291112965, 291178501, 291244037, 291309573,
+    291375109, 291440645, 291506181, 291571717, 291637253, 291702789, 291768325, 291833861,
+    291899397, 291964933, 292030469, 292096005, 292161541, 292227077, 292292613, 292358149,
+    292423685, 292489221, 292554757, 292620293, 292685829, 292751365, 292816901, 292882437,
+    292947973, 293013509, 293079045, 293144581, 293210117, 293275653, 293341189, 293406725,
+    293472261, 293537797, 293603333, 293668869, 293734405, 293799941, 293865477, 293931013,
+    293996549, 294062085, 294127621, 294193157, 294258693, 294324229, 294389765, 294455301,
+    294520837, 294586373, 294651909, 294717445, 294782981, 294848517, 294914053, 294979589,
+    295045125, 295110661, 295176197, 295241733, 295307269, 295372805, 295438341, 295503877,
+    295569413, 295634949, 295700485, 295766021, 295831557, 295897093, 295962629, 296028165,
+    296093701, 296159237, 296224773, 296290309, 296355845, 296421381, 296486917, 296552453,
+    296617989, 296683525, 296749061, 296814597, 296880133, 296945669, 297011205, 297076741,
+    297142277, 297207813, 297273349, 297338885, 297404421, 297469957, 297535493, 297601029,
+    297666565, 297732101, 297797637, 297863173, 297928709, 297994245, 298059781, 298125317,
+    298190853, 298256389, 298321925, 298387461, 298452997, 298518533, 298584069, 298649605,
+    298715141, 298780677, 298846213, 298911749, 298977285, 299042821, 299108357, 299173893,
+    299239429, 299304965, 299370501, 299436037, 299501573, 299567109, 299632645, 299698181,
+    299763717, 299829253, 299894789, 299960325, 300025861, 300091397, 300156933, 300222469,
+    300288005, 300353541, 300419077, 300484613, 300550149, 300615685, 300681221, 300746757,
+    300812293, 300877829, 300943365, 301008901, 301074437, 301139973, 301205509, 301271045,
+    301336581, 301402117, 301467653, 301533189, 301598725, 301664261, 301729797, 301795333,
+    301860869, 301926405, 301991941, 302057477, 302123013, 302188549, 302254085, 302319621,
+    302385157, 302450693, 302516229, 302581765, 302647301, 302712837, 302778373, 302843909,
+    302909445, 302974981, 303040517, 303106053, 303171589, 303237125, 303302661, 303368197,
+    303433733, 303499269, 303564805, 303630341, 303695877, 303761413, 303826949, 303892485,
+    303958021, 304023557, 304089093, 304154629, 304220165, 304285701, 304351237, 304416773,
+    304482309, 304547845, 304613381, 304678917, 304744453, 304809989, 304875525, 304941061,
+    305006597, 305072133, 305137669, 305203205, 305268741, 305334277, 305399813, 305465349,
+    305530885, 305596421, 305661957, 305727493, 305793029, 305858565, 305924101, 305989637,
+    306055173, 306120709, 306186245, 307496965, 306448389, 306513925, 306579461, 306644997,
+    306710533, 306776069, 306841605, 306907141, 306972677, 307038213, 307103749, 307169285,
+    307234821, 307300357, 307365893, 307431429, 307562501, 307628037, 307693573, 307759109,
+    307824645, 307890181, 307955717, 308021253, 308086789, 308152325, 308217861, 308283397,
+    308348933, 308414469, 308480005, 308545541, 308611077, 308676613, 308742149, 308807685,
+    308873221, 308938757, 309004293, 309069829, 309135365, 309200901, 309266437, 309331973,
+    309397509, 309463045, 309528581, 309594117, 309659653, 309725189, 309790725, 309856261,
+    309463045, 0, 309528581, 0, 309528581, 0, 0, 309921797,
+    309987333, 310052869, 310118405, 310183941, 310249477, 310315013, 310380549, 310446085,
+    310511621, 310577157, 310642693, 310708229, 310773765, 310839301, 310904837, 310970373,
+    311035909, 311101445, 311166981, 311232517, 311298053, 311363589, 311429125, 311494661,
+    311560197, 311625733, 311691269, 311756805, 311822341, 311887877, 311953413, 312018949,
+    312084485, 312150021, 312215557, 312281093, 312346629, 312412165, 312477701, 312543237,
+    312608773, 312674309, 312739845, 312805381, 312870917, 312936453, 313001989, 312936453,
+    0, 313001989, 0, 312936453, 0, 0, 313001989, 0,
+    0, 313067525, 313133061, 313198597, 313264133, 313329669, 313395205, 313460741,
+    313526277, 313591813, 313657349, 313722885, 313788421, 313853957, 313919493, 313985029,
+    314050565, 314116101, 314181637, 314247173, 314312709, 314378245, 314443781, 314509317,
+    314574853, 314640389, 314705925, 314771461, 314836997, 314902533, 314968069, 315033605,
+    315099141, 315164677, 315230213, 315295749, 315361285, 315426821, 315492357, 315557893,
+    315623429, 315688965, 315754501, 315820037, 315885573, 315951109, 316016645, 316082181,
+    316147717, 316213253, 316278789, 316344325, 316409861, 316475397, 316540933, 316606469,
+    316672005, 316737541, 316803077, 316868613, 316934149, 316999685, 317065221, 317130757,
+    317196293, 317261829, 317327365, 317392901, 317458437, 317523973, 317589509, 317655045,
+    317720581, 317786117, 317851653, 317917189, 317982725, 318048261, 318113797, 318179333,
+    318244869, 318310405, 318375941, 318441477, 318507013, 318572549, 318638085, 318703621,
+    318769157, 318834693, 318900229, 318965765, 319031301, 319096837, 319162373, 319227909,
+    319293445, 319358981, 319424517, 319490053, 319555589, 319621125, 319686661, 319752197,
+    319817733, 319883269, 319948805, 320014341, 512886789, 512952325, 513017861, 513083397,
+    513148933, 513214469, 513280005, 513345541, 513411077, 513476613, 271976453, 272041989,
+    272107525, 272173061, 272238597, 272304133, 272369669, 272435205, 272500741, 272566277,
+    272631813, 272697349, 272762885, 272828421, 272893957, 272959493, 273025029, 273090565,
+    273156101, 273221637, 273287173, 273352709, 273418245, 273483781, 273549317, 273614853,
+    273680389, 273745925, 273811461, 273876997, 273942533, 274008069, 274073605, 274139141,
+    274204677, 274270213, 274335749, 274401285, 274466821, 274532357, 274597893, 274663429,
+    274728965, 274794501, 274860037, 274925573, 274991109, 275056645, 275122181, 275187717,
+    275253253, 275318789, 275384325, 275449861, 275515397, 275580933, 275646469, 275712005,
+    275777541, 275843077, 275908613, 275974149, 276039685, 276105221, 276170757, 276236293,
+    276301829, 276367365, 276432901, 276498437, 276563973, 276629509, 276695045, 276760581,
+    276826117, 276891653, 276957189, 277022725, 277088261, 277153797, 277219333, 277284869,
+    277350405, 277415941, 277481477, 277547013, 277612549, 524093445, 524158981, 524224517,
+    524290053, 524355589, 524421125, 524486661, 524552197, 524617733, 106694667, 106432523,
+    452921349, 452986885, 453052421, 453117957, 453183493, 453249029, 453314565, 453380101,
+    453445637, 453511173, 453576709, 453642245, 453707781, 453773317, 453838853, 453904389,
+    453969925, 454035461, 454100997, 454166533, 454232069, 454297605, 454363141, 454428677,
+    454494213, 454559749, 454625285, 454690821, 454756357, 454821893, 454887429, 454952965,
+    455018501, 455084037, 455149573, 455215109, 455280645, 455346181, 455411717, 455477253,
+    455542789, 455608325, 455673861, 455739397, 455804933, 455870469, 455936005, 456001541,
+    456067077, 456132613, 456198149, 456263685, 456329221, 456394757, 456460293, 456525829,
+    456591365, 456656901, 456722437, 456787973, 456853509, 456919045, 456984581, 457050117,
+    457115653, 457181189, 457246725, 457312261, 457377797, 457443333, 457508869, 457574405,
+    457639941, 457705477, 457771013, 457836549, 457902085, 457967621, 458033157, 458098693,
+    458164229, 458229765, 458295301, 458360837, 458426373, 458491909, 458557445, 458622981,
+    458688517, 458754053, 458819589, 458885125, 458950661, 459016197, 459081733, 459147269,
+    459212805, 459278341, 459343877, 459409413, 459474949, 459540485, 459606021, 459671557,
+    459737093, 459802629, 459868165, 459933701, 459999237, 460064773, 460130309, 460195845,
+    460261381, 460326917, 460392453, 460457989, 460523525, 460589061, 460654597, 460720133,
+    460785669, 460851205, 460916741, 460982277, 461047813, 461113349, 461178885, 461244421,
+    461309957, 461375493, 461441029, 461506565, 461572101, 461637637, 461703173, 461768709,
+    461834245, 461899781, 461965317, 462030853, 462096389, 462161925, 462227461, 462292997,
+    462358533, 462424069, 462489605, 462555141, 462620677, 462686213, 462751749, 462817285,
+    462882821, 462948357, 463013893, 463079429, 463144965, 463210501, 463276037, 463341573,
+    463407109, 463472645, 463538181, 463603717, 463669253, 463734789, 463800325, 463865861,
+    463931397, 463996933, 464062469, 464128005, 464193541, 464259077, 464324613, 464390149,
+    464455685, 464521221, 464586757, 464652293, 464717829, 464783365, 464848901, 464914437,
+    464979973, 465045509, 465111045, 465176581, 465242117, 465307653, 465373189, 465438725,
+    465504261, 465569797, 465635333, 465700869, 465766405, 465831941, 465897477, 465963013,
+    466028549, 466094085, 466159621, 466225157, 466290693, 466356229, 466421765, 466487301,
+    466552837, 466618373, 466683909, 466749445, 466814981, 466880517, 466946053, 467011589,
+    467077125, 467142661, 467208197, 467273733, 467339269, 467404805, 467470341, 467535877,
+    467601413, 467666949, 467732485, 467798021, 467863557, 467929093, 467994629, 468060165,
+    468125701, 468191237, 468256773, 468322309, 468387845, 468453381, 468518917, 468584453,
+    468649989, 468715525, 468781061, 468846597, 468912133, 468977669, 469043205, 469108741,
+    469174277, 469239813, 469305349, 469370885, 469436421, 469501957, 469567493, 469633029,
+    469698565, 469764101, 469829637, 469895173, 469960709, 470026245, 470091781, 470157317,
+    470222853, 470288389, 470353925, 470419461, 470484997, 470550533, 470616069, 470681605,
+    470747141, 470812677, 470878213, 470943749, 471009285, 471074821, 471140357, 471205893,
+    471271429, 471336965, 471402501, 471468037, 471533573, 471599109, 471664645, 471730181,
+    471795717, 471861253, 471926789, 471992325, 472057861, 472123397, 472188933, 472254469,
+    472320005, 472385541, 472451077, 472516613, 472582149, 472647685, 472713221, 472778757,
+    472844293, 472909829, 472975365, 473040901, 473106437, 473171973, 473237509, 473303045,
+    473368581, 473434117, 473499653, 473565189, 473630725, 473696261, 473761797, 473827333,
+    473892869, 473958405, 474023941, 474089477, 474155013, 474220549, 474286085, 474351621,
+    474417157, 474482693, 474548229, 474613765, 474679301, 474744837, 474810373, 474875909,
+    474941445, 475006981, 475072517, 475138053, 475203589, 475269125, 475334661, 475400197,
+    475465733, 475531269, 475596805, 475662341, 475727877, 475793413, 475858949, 475924485,
+    475990021, 476055557, 476121093, 476186629, 476252165, 476317701, 476383237, 476448773,
+    476514309, 476579845, 476645381, 476710917, 476776453, 476841989, 476907525, 476973061,
+    477038597, 477104133, 477169669, 477235205, 477300741, 477366277, 477431813, 477497349,
+    477562885, 477628421, 477693957, 477759493, 477825029, 477890565, 477956101, 478021637,
+    478087173, 478152709, 478218245, 478283781, 478349317, 478414853, 478480389, 478545925,
+    478611461, 478676997, 478742533, 478808069, 478873605, 478939141, 479004677, 479070213,
+    479135749, 479201285, 479266821, 479332357, 479397893, 479463429, 479528965, 479594501,
+    479660037, 479725573, 479791109, 479856645, 479922181, 479987717, 480053253, 480118789,
+    480184325, 480249861, 480315397, 480380933, 480446469, 480512005, 480577541, 480643077,
+    480708613, 480774149, 480839685, 480905221, 480970757, 481036293, 481101829, 481167365,
+    481232901, 481298437, 481363973, 481429509, 481495045, 481560581, 481626117, 481691653,
+    481757189, 481822725, 481888261, 481953797, 482019333, 482084869, 482150405, 482215941,
+    482281477, 482347013, 482412549, 482478085, 482543621, 482609157, 482674693, 482740229,
+    482805765, 482871301, 482936837, 483002373, 483067909, 483133445, 483198981, 483264517,
+    483330053, 483395589, 483461125, 483526661, 483592197, 483657733, 483723269, 483788805,
+    483854341, 483919877, 483985413, 484050949, 484116485, 484182021, 484247557, 484313093,
+    484378629, 484444165, 484509701, 484575237, 484640773, 484706309, 484771845, 484837381,
+    484902917, 484968453, 485033989, 485099525, 485165061, 485230597, 485296133, 485361669,
+    485427205, 485492741, 485558277, 485623813, 485689349, 485754885, 485820421, 485885957,
+    485951493, 486017029, 486082565, 486148101, 486213637, 486279173, 486344709, 486410245,
+    486475781, 486541317, 486606853, 486672389, 486737925, 486803461, 486868997, 486934533,
+    487000069, 487065605, 487131141, 487196677, 487262213, 487327749, 487393285, 487458821,
+    487524357, 487589893, 487655429, 487720965, 487786501, 487852037, 487917573, 487983109,
+    488048645, 488114181, 488179717, 488245253, 78579717, 78645253, 78710789, 78776325,
+    78841861, 287508485, 40634373, 41617413, 513542149, 513607685, 513673221, 513738757,
+    513804293, 513869829, 513935365, 514000901, 514066437, 514131973, 514197509, 514263045,
+    514328581, 514394117, 514459653, 514525189, 514590725, 514656261, 514721797, 514787333,
+    514852869, 514918405, 514983941, 515049477, 515115013, 515180549, 515246085, 515311621,
+    515377157, 515442693, 515508229, 515573765, 515639301, 515704837, 515770373, 515835909,
+    515901445, 515966981, 516032517, 516098053, 516163589, 320145413, 516229125, 516294661,
+    516360197, 516425733, 516491269, 516556805, 516622341, 516687877, 516753413, 516818949,
+    516884485, 516950021, 517015557, 517081093, 517146629, 517212165, 517277701, 517343237,
+    517408773, 517474309, 517539845, 517605381, 517670917, 517736453, 517801989, 517867525,
+    517933061, 517998597, 518064133, 518129669, 518195205, 518260741, 518326277, 518391813,
+    518457349, 518522885, 518588421, 518653957, 518719493, 518785029, 518850565, 320210949,
+    518916101, 518981637, 519047173, 519112709, 519178245, 519243781, 519309317, 86968325,
+    87033861, 320276485, 320342021, 320407557, 320473093, 320538629, 320604165, 320669701,
+    320735237, 320800773, 320866309, 320931845, 320997381, 321062917, 321128453, 321193989,
+    321259525, 321325061, 321390597, 321456133, 321521669, 321587205, 321652741, 321718277,
+    321783813, 321849349, 321914885, 321980421, 322045957, 322111493, 322177029, 322242565,
+    322308101, 322373637, 322439173, 322504709, 322570245, 322635781, 322701317, 322766853,
+    322832389, 322897925, 322963461, 323028997, 323094533, 323160069, 323225605, 323291141,
+    323356677, 323422213, 323487749, 323553285, 323618821, 323684357, 323749893, 323815429,
+    323880965, 323946501, 324012037, 324077573, 324143109, 324208645, 324274181, 324339717,
+    324405253, 324470789, 324536325, 324601861, 324667397, 324732933, 324798469, 324864005,
+    324929541, 324995077, 325060613, 325126149, 325191685, 325257221, 325322757, 325388293,
+    325453829, 325519365, 325584901, 325650437, 325715973, 325781509, 325847045, 325912581,
+    325978117, 326043653, 326109189, 326174725, 326240261, 326305797, 326371333, 326436869,
+    326502405, 326567941, 326633477, 326699013, 326764549, 326830085, 326895621, 326961157,
+    327026693, 327092229, 327157765, 327223301, 327288837, 327354373, 327419909, 327485445,
+    327550981, 327616517, 327682053, 327747589, 327813125, 327878661, 327944197, 328009733,
+    328075269, 328140805, 328206341, 328271877, 328337413, 328402949, 328468485, 328534021,
+    328599557, 328665093, 328730629, 328796165, 328861701, 328927237, 328992773, 329058309,
+    329123845, 329189381, 329254917, 329320453, 329385989, 329451525, 329517061, 329582597,
+    329648133, 329713669, 329779205, 329844741, 329910277, 329975813, 330041349, 330106885,
+    330172421, 330237957, 330303493, 330369029, 330434565, 330500101, 330565637, 330631173,
+    330696709, 330762245, 330827781, 330893317, 330958853, 331024389, 331089925, 331155461,
+    331220997, 331286533, 331352069, 331417605, 331483141, 331548677, 331614213, 331679749,
+    331745285, 331810821, 331876357, 331941893, 332007429, 332072965, 332138501, 332204037,
+    332269573, 332335109, 332400645, 332466181, 332531717, 332597253, 332662789, 332728325,
+    332793861, 332859397, 332924933, 332990469, 333056005, 333121541, 333187077, 333252613,
+    333318149, 333383685, 333449221, 333514757, 333580293, 333645829, 333711365, 333776901,
+    333842437, 333907973, 333973509, 334039045, 334104581, 334170117, 334235653, 334301189,
+    334366725, 334432261, 334497797, 334563333, 334628869, 334694405, 334759941, 334825477,
+    334891013, 334956549, 335022085, 341510149, 341575685, 341641221, 97716229, 341706757,
+    341772293, 341837829, 97847301, 186779653, 186845189, 186910725, 186976261, 187041797,
+    187107333, 187172869, 187238405, 187303941, 187369477, 187435013, 187500549, 187566085,
+    187631621, 187697157, 187762693, 187828229, 187893765, 187959301, 188024837, 188090373,
+    188155909, 188221445, 188286981, 188352517, 188418053, 341903365, 341968901, 342034437,
+    342099973, 342165509, 342231045, 342296581, 342362117, 342427653, 342493189, 342558725,
+    342624261, 342689797, 342755333, 342820869, 342886405, 342951941, 343017477, 343083013,
+    343148549, 343214085, 343279621, 343345157, 343410693, 343476229, 343541765, 343607301,
+    343672837, 343738373, 343803909, 343869445, 343934981, 344000517, 344066053, 344131589,
+    344197125, 344262661, 344328197, 344393733, 344459269, 344524805, 344590341, 344655877,
+    344721413, 344786949, 344852485, 344918021, 344983557, 345049093, 345114629, 345180165,
+    345245701, 345311237, 345376773, 345442309, 345507845, 345573381, 345638917, 345704453,
+    345769989, 345835525, 345901061, 345966597, 346032133, 346097669, 346163205, 346228741,
+    346294277, 346359813, 346425349, 346490885, 346556421, 346621957, 346687493, 346753029,
+    346818565, 346884101, 346949637, 347015173, 347080709, 347146245, 347211781, 347277317,
+    347342853, 347408389, 347473925, 347539461, 347604997, 347670533, 347736069, 347801605,
+    347867141, 347932677, 347998213, 348063749, 348129285, 348194821, 348260357, 348325893,
+    348391429, 348456965, 348522501, 348588037, 348653573, 348719109, 348784645, 348850181,
+    348915717, 348981253, 349046789, 349112325, 349177861, 349243397, 349308933, 349374469,
+    349440005, 349505541, 349571077, 349636613, 349702149, 349767685, 349833221, 349898757,
+    349964293, 350029829, 350095365, 350160901, 350226437, 350291973, 350357509, 350423045,
+    350488581, 350554117, 350619653, 350685189, 350750725, 350816261, 350881797, 350947333,
+    351012869, 351078405, 351143941, 351209477, 351275013, 351340549, 351406085, 351471621,
+    351537157, 351602693, 351668229, 351733765, 351799301, 351864837, 351930373, 351995909,
+    352061445, 352126981, 352192517, 352258053, 352323589, 352389125, 352454661, 352520197,
+    352585733, 352651269, 352716805, 352782341, 352847877, 352913413, 352978949, 353044485,
+    353110021, 353175557, 353241093, 353306629, 353372165, 353437701, 353503237, 353568773,
+    353634309, 353699845, 353765381, 353830917, 353896453, 353961989, 354027525, 354093061,
+    354158597, 354224133, 354289669, 354355205, 354420741, 354486277, 354551813, 354617349,
+    354682885, 354748421, 354813957, 354879493, 354945029, 355010565, 355076101, 355141637,
+    355207173, 355272709, 355338245, 355403781, 355469317, 355534853, 355600389, 355665925,
+    355731461, 355796997, 355862533, 355928069, 355993605, 356059141, 356124677, 356190213,
+    356255749, 356321285, 356386821, 356452357, 356517893, 356583429, 356648965, 356714501,
+    356780037, 356845573, 356911109, 356976645, 357042181, 357107717, 357173253, 357238789,
+    357304325, 357369861, 357435397, 357500933, 357566469, 357632005, 357697541, 357763077,
+    357828613, 357894149, 357959685, 358025221, 358090757, 358156293, 358221829, 358287365,
+    358352901, 358418437, 358483973, 358549509, 358615045, 358680581, 358746117, 358811653,
+    358877189, 358942725, 359008261, 359073797, 359139333, 359204869, 359270405, 359335941,
+    359401477, 359467013, 359532549, 359598085, 359663621, 359729157, 359794693, 359860229,
+    359925765, 359991301, 360056837, 360122373, 360187909, 360253445, 360318981, 360384517,
+    360450053, 360515589, 360581125, 360646661, 360712197, 360777733, 360843269, 360908805,
+    360974341, 361039877, 361105413, 361170949, 361236485, 361302021, 361367557, 361433093,
+    361498629, 361564165, 361629701, 361695237, 361760773, 361826309, 361891845, 361957381,
+    362022917, 362088453, 362153989, 362219525, 362285061, 362350597, 362416133, 362481669,
+    362547205, 362612741, 362678277, 362743813, 362809349, 362874885, 362940421, 363005957,
+    363071493, 363137029, 363202565, 363268101, 363333637, 363399173, 363464709, 363530245,
+    363595781, 363661317, 363726853, 363792389, 363857925, 363923461, 363988997, 364054533,
+    364120069, 364185605, 364251141, 364316677, 364382213, 364447749, 364513285, 364578821,
+    364644357, 364709893, 364775429, 364840965, 364906501, 364972037, 365037573, 365103109,
+    365168645, 365234181, 365299717, 365365253, 365430789, 365496325, 365561861, 365627397,
+    365692933, 365758469, 365824005, 365889541, 365955077, 366020613, 366086149, 366151685,
+    366217221, 366282757, 366348293, 366413829, 366479365, 366544901, 366610437, 366675973,
+    366741509, 366807045, 366872581, 366938117, 367003653, 367069189, 367134725, 367200261,
+    367265797, 367331333, 367396869, 367462405, 367527941, 367593477, 367659013, 367724549,
+    367790085, 367855621, 367921157, 367986693, 368052229, 368117765, 368183301, 368248837,
+    368314373, 368379909, 368445445, 368510981, 368576517, 368642053, 368707589, 368773125,
+    368838661, 368904197, 368969733, 369035269, 369100805, 369166341, 369231877, 369297413,
+    369362949, 369428485, 369494021, 369559557, 369625093, 369690629, 369756165, 369821701,
+    369887237, 369952773, 370018309, 370083845, 370149381, 370214917, 370280453, 370345989,
+    370411525, 370477061, 370542597, 370608133, 370673669, 370739205, 370804741, 370870277,
+    370935813, 371001349, 371066885, 371132421, 371197957, 371263493, 371329029, 371394565,
+    371460101, 371525637, 371591173, 371656709, 371722245, 371787781, 371853317, 371918853,
+    371984389, 372049925, 372115461, 372180997, 372246533, 372312069, 372377605, 372443141,
+    372508677, 372574213, 372639749, 372705285, 372770821, 372836357, 372901893, 372967429,
+    373032965, 373098501, 373164037, 373229573, 373295109, 373360645, 373426181, 373491717,
+    373557253, 373622789, 373688325, 373753861, 373819397, 373884933, 373950469, 374016005,
+    374081541, 374147077, 374212613, 374278149, 374343685, 374409221, 374474757, 374540293,
+    374605829, 374671365, 374736901, 374802437, 374867973, 374933509, 374999045, 375064581,
+    375130117, 375195653, 375261189, 375326725, 375392261, 375457797, 375523333, 375588869,
+    375654405, 375719941, 375785477, 375851013, 375916549, 375982085, 376047621, 376113157,
+    376178693, 376244229, 376309765, 376375301, 376440837, 376506373, 376571909, 376637445,
+    376702981, 376768517, 376834053, 376899589, 376965125, 377030661, 377096197, 377161733,
+    377227269, 377292805, 377358341, 377423877, 377489413, 377554949, 377620485, 377686021,
+    377751557, 377817093, 377882629, 377948165, 378013701, 378079237, 378144773, 378210309,
+    378275845, 378341381, 378406917, 378472453, 378537989, 378603525, 378669061, 378734597,
+    378800133, 378865669, 378931205, 378996741, 379062277, 379127813, 379193349, 379258885,
+    379324421, 379389957, 379455493, 379521029, 379586565, 379652101, 379717637, 379783173,
+    379848709, 379914245, 379979781, 380045317, 380110853, 380176389, 380241925, 380307461,
+    380372997, 380438533, 380504069, 380569605, 380635141, 380700677, 380766213, 380831749,
+    380897285, 380962821, 381028357, 381093893, 381159429, 381224965, 381290501, 381356037,
+    381421573, 381487109, 381552645, 381618181, 381683717, 381749253, 381814789, 381880325,
+    381945861, 382011397, 382076933, 382142469, 382208005, 382273541, 382339077, 382404613,
+    382470149, 382535685, 382601221, 382666757, 382732293, 382797829, 382863365, 382928901,
+    382994437, 383059973, 383125509, 383191045, 383256581, 383322117, 383387653, 383453189,
+    383518725, 383584261, 383649797, 383715333, 383780869, 383846405, 383911941, 383977477,
+    384043013, 384108549, 384174085, 384239621, 384305157, 384370693, 384436229, 384501765,
+    384567301, 384632837, 384698373, 384763909, 384829445, 384894981, 384960517, 385026053,
+    385091589, 385157125, 385222661, 385288197, 385353733, 385419269, 385484805, 385550341,
+    385615877, 385681413, 385746949, 385812485, 385878021, 385943557, 386009093, 386074629,
+    386140165, 386205701, 386271237, 386336773, 386402309, 386467845, 386533381, 386598917,
+    386664453, 386729989, 386795525, 386861061, 386926597, 386992133, 387057669, 387123205,
+    387188741, 387254277, 387319813, 387385349, 387450885, 387516421, 387581957, 387647493,
+    387713029, 387778565, 387844101, 387909637, 387975173, 388040709, 388106245, 388171781,
+    388237317, 388302853, 388368389, 388433925, 388499461, 388564997, 388630533, 388696069,
+    388761605, 388827141, 388892677, 388958213, 389023749, 389089285, 389154821, 389220357,
+    389285893, 389351429, 389416965, 389482501, 389548037, 389613573, 389679109, 389744645,
+    389810181, 389875717, 389941253, 390006789, 390072325, 390137861, 390203397, 390268933,
+    390334469, 390400005, 390465541, 390531077, 390596613, 390662149, 390727685, 390793221,
+    390858757, 390924293, 390989829, 391055365, 391120901, 391186437, 391251973, 391317509,
+    391383045, 391448581, 391514117, 391579653, 391645189, 391710725, 391776261, 391841797,
+    391907333, 391972869, 392038405, 392103941, 392169477, 392235013, 392300549, 392366085,
+    392431621, 392497157, 392562693, 413009925, 413075461, 413140997, 413206533, 413272069,
+    413337605, 413403141, 413468677, 413534213, 413599749, 413665285, 413730821, 413796357,
+    413861893, 413927429, 413992965, 414058501, 414124037, 414189573, 414255109, 414320645,
+    414386181, 414451717, 414517253, 414582789, 414648325, 414713861, 414779397, 414844933,
+    414910469, 414976005, 415041541, 415107077, 415172613, 415238149, 415303685, 415369221,
+    415434757, 415500293, 415565829, 415631365, 415696901, 415762437, 415827973, 415893509,
+    415959045, 416024581, 416090117, 416155653, 416221189, 416286725, 416352261, 416417797,
+    416483333, 416548869, 416614405, 416679941, 416745477, 416811013, 416876549, 416942085,
+    417007621, 417073157, 417138693, 417204229, 417269765, 417335301, 417400837, 417466373,
+    417531909, 417597445, 417662981, 417728517, 417794053, 417859589, 417925125, 417990661,
+    418056197, 418121733, 418187269, 418252805, 418318341, 418383877, 418449413, 418514949,
+    418580485, 418646021, 418711557, 418777093, 418842629, 418908165, 418973701, 419039237,
+    419104773, 419170309, 419235845, 419301381, 419366917, 419432453, 419497989, 419563525,
+    419629061, 419694597, 419760133, 419825669, 419891205, 419956741, 420022277, 420087813,
+    420153349, 420218885, 420284421, 420349957, 420415493, 420481029, 420546565, 420612101,
+    420677637, 420743173, 420808709, 420874245, 420939781, 421005317, 421070853, 421136389,
+    421201925, 421267461, 421332997, 421398533, 421464069, 421529605, 421595141, 421660677,
+    421726213, 421791749, 421857285, 421922821, 421988357, 422053893, 422119429, 422184965,
+    422250501, 422316037, 422381573, 422447109, 422512645, 422578181, 422643717, 422709253,
+    422774789, 422840325, 422905861, 422971397, 423036933, 423102469, 423168005, 423233541,
+    423299077, 423364613, 423430149, 423495685, 423561221, 423626757, 423692293, 423757829,
+    423823365, 423888901, 423954437, 424019973, 424085509, 424151045, 424216581, 424282117,
+    424347653, 424413189, 424478725, 424544261, 424609797, 424675333, 424740869, 424806405,
+    424871941, 424937477, 425003013, 425068549, 425134085, 425199621, 425265157, 425330693,
+    425396229, 425461765, 425527301, 425592837, 425658373, 425723909, 425789445, 425854981,
+    425920517, 425986053, 426051589, 426117125, 426182661, 426248197, 426313733, 426379269,
+    426444805, 426510341, 426575877, 426641413, 426706949, 426772485, 426838021, 426903557,
+    426969093, 427034629, 427100165, 427165701, 427231237, 427296773, 427362309, 427427845,
+    427493381, 427558917, 427624453, 427689989, 427755525, 427821061, 427886597, 427952133,
+    428017669, 428083205, 428148741, 428214277, 428279813, 428345349, 428410885, 428476421,
+    428541957, 428607493, 428673029, 428738565, 428804101, 428869637, 428935173, 429000709,
+    429066245, 429131781, 429197317, 429262853, 429328389, 429393925, 429459461, 429524997,
+    429590533, 429656069, 429721605, 429787141, 429852677, 429918213, 429983749, 430049285,
+    430114821, 430180357, 430245893, 430311429, 430376965, 430442501, 430508037, 430573573,
+    430639109, 430704645, 430770181, 430835717, 430901253, 430966789, 431032325, 431097861,
+    431163397, 431228933, 431294469, 431360005, 431425541, 431491077, 431556613, 431622149,
+    431687685, 431753221, 431818757, 431884293, 431949829, 432015365, 432080901, 432146437,
+    432211973, 432277509, 432343045, 432408581, 432474117, 432539653, 432605189, 432670725,
+    432736261, 432801797, 432867333, 432932869, 432998405, 433063941, 433129477, 433195013,
+    433260549, 433326085, 433391621, 433457157, 433522693, 433588229, 433653765, 433719301,
+    433784837, 433850373, 433915909, 433981445, 434046981, 434112517, 434178053, 434243589,
+    434309125, 434374661, 434440197, 434505733, 434571269, 434636805, 434702341, 434767877,
+    434833413, 434898949, 434964485, 435030021, 435095557, 435161093, 435226629, 435292165,
+    435357701, 435423237, 435488773, 435554309, 435619845, 435685381, 435750917, 435816453,
+    435881989, 435947525, 436013061, 436078597, 436144133, 436209669, 436275205, 436340741,
+    436406277, 436471813, 436537349, 436602885, 436668421, 436733957, 436799493, 436865029,
+    436930565, 436996101, 437061637, 437127173, 437192709, 437258245, 437323781, 437389317,
+    437454853, 437520389, 437585925, 437651461, 437716997, 437782533, 437848069, 437913605,
+    437979141, 438044677, 438110213, 438175749, 438241285, 438306821, 438372357, 438437893,
+    438503429, 438568965, 438634501, 438700037, 438765573, 438831109, 438896645, 438962181,
+    439027717, 439093253, 439158789, 439224325, 439289861, 439355397, 439420933, 439486469,
+    439552005, 439617541, 439683077, 439748613, 439814149, 439879685, 439945221, 440010757,
+    440076293, 440141829, 440207365, 440272901, 440338437, 440403973, 440469509, 440535045,
+    440600581, 440666117, 440731653, 440797189, 440862725, 440928261, 440993797, 441059333,
+    441124869, 441190405, 441255941, 441321477, 441387013, 441452549, 441518085, 441583621,
+    441649157, 441714693, 441780229, 441845765, 441911301, 441976837, 442042373, 442107909,
+    442173445, 442238981, 442304517, 442370053, 442435589, 442501125, 442566661, 442632197,
+    442697733, 442763269, 442828805, 442894341, 442959877, 443025413, 443090949, 443156485,
+    443222021, 443287557, 443353093, 443418629, 443484165, 443549701, 443615237, 443680773,
+    443746309, 443811845, 443877381, 443942917, 444008453, 444073989, 444139525, 444205061,
+    444270597, 444336133, 444401669, 444467205, 444532741, 444598277, 444663813, 444729349,
+    444794885, 444860421, 444925957, 444991493, 445057029, 445122565, 445188101, 445253637,
+    445319173, 445384709, 445450245, 445515781, 445581317, 445646853, 445712389, 445777925,
+    445843461, 445908997, 445974533, 446040069, 446105605, 446171141, 446236677, 446302213,
+    446367749, 446433285, 446498821, 446564357, 446629893, 446695429, 446760965, 446826501,
+    446892037, 446957573, 447023109, 447088645, 447154181, 447219717, 447285253, 447350789,
+    447416325, 447481861, 447547397, 447612933, 447678469, 447744005, 447809541, 447875077,
+    447940613, 448006149, 448071685, 448137221, 448202757, 448268293, 448333829, 448399365,
+    448464901, 448530437, 448595973, 448661509, 448727045, 448792581, 448858117, 448923653,
+    448989189, 449054725, 449120261, 449185797, 449251333, 449316869, 449382405, 449447941,
+    449513477, 449579013, 449644549, 449710085, 449775621, 449841157, 449906693, 449972229,
+    450037765, 450103301, 450168837, 450234373, 450299909, 450365445, 450430981, 450496517,
+    450562053, 450627589, 450693125, 450758661, 450824197, 450889733, 450955269, 451020805,
+    451086341, 451151877, 451217413, 451282949, 451348485, 451414021, 451479557, 451545093,
+    451610629, 451676165, 451741701, 451807237, 451872773, 451938309, 452003845, 452069381,
+    452134917, 452200453, 452265989, 452331525, 452397061, 452462597, 452528133, 452593669,
+    452659205, 452724741, 452790277, 452855813, 392628229, 392693765, 392759301, 392824837,
+    392890373, 392955909, 393021445, 393086981, 393152517, 393218053, 393283589, 393349125,
+    393414661, 393480197, 393545733, 393611269, 393676805, 393742341, 393807877, 393873413,
+    393938949, 394004485, 394070021, 394135557, 394201093, 394266629, 394332165, 394397701,
+    394463237, 394528773, 394594309, 394659845, 394725381, 394790917, 394856453, 394921989,
+    394987525, 395053061, 395118597, 395184133, 395249669, 395315205, 395380741, 395446277,
+    395511813, 395577349, 395642885, 395708421, 395773957, 395839493, 395905029, 395970565,
+    396036101, 396101637, 396167173, 396232709, 396298245, 396363781, 396429317, 396494853,
+    396560389, 396625925, 396691461, 396756997, 396822533, 396888069, 396953605, 397019141,
+    397084677, 397150213, 397215749, 397281285, 397346821, 397412357, 397477893, 397543429,
+    397608965, 397674501, 397740037, 397805573, 397871109, 397936645, 398002181, 398067717,
+    398133253, 398198789, 398264325, 398329861, 398395397, 398460933, 398526469, 398592005,
+    398657541, 398723077, 398788613, 398854149, 398919685, 398985221, 399050757, 399116293,
+    399181829, 399247365, 399312901, 399378437, 399443973, 399509509, 399575045, 399640581,
+    399706117, 399771653, 399837189, 399902725, 399968261, 400033797, 400099333, 400164869,
+    400230405, 400295941, 400361477, 400427013, 400492549, 400558085, 400623621, 400689157,
+    400754693, 400820229, 400885765, 400951301, 401016837, 401082373, 401147909, 401213445,
+    401278981, 401344517, 401410053, 401475589, 401541125, 401606661, 401672197, 401737733,
+    401803269, 401868805, 401934341, 401999877, 402065413, 402130949, 402196485, 402262021,
+    402327557, 402393093, 402458629, 402524165, 402589701, 402655237, 402720773, 402786309,
+    402851845, 402917381, 402982917, 403048453, 403113989, 403179525, 403245061, 403310597,
+    403376133, 403441669, 403507205, 403572741, 403638277, 403703813, 403769349, 403834885,
+    403900421, 403965957, 404031493, 404097029, 404162565, 404228101, 404293637, 404359173,
+    404424709, 404490245, 404555781, 404621317, 404686853, 404752389, 404817925, 404883461,
+    404948997, 405014533, 405080069, 405145605, 405211141, 405276677, 405342213, 405407749,
+    405473285, 405538821, 405604357, 405669893, 405735429, 405800965, 405866501, 405932037,
+    405997573, 406063109, 406128645, 406194181, 406259717, 406325253, 406390789, 406456325,
+    406521861, 406587397, 406652933, 406718469, 406784005, 406849541, 406915077, 406980613,
+    407046149, 407111685, 407177221, 407242757, 407308293, 407373829, 407439365, 407504901,
+    407570437, 407635973, 407701509, 407767045, 407832581, 407898117, 407963653, 408029189,
+    408094725, 408160261, 408225797, 408291333, 408356869, 408422405, 408487941, 408553477,
+    408619013, 408684549, 408750085, 408815621, 408881157, 408946693, 409012229, 409077765,
+    409143301, 409208837, 335087621, 335153157, 335218693, 335284229, 335349765, 335415301,
+    335480837, 335546373, 335611909, 335677445, 335742981, 335808517, 335874053, 335939589,
+    336005125, 336070661, 336136197, 336201733, 336267269, 336332805, 336398341, 336463877,
+    336529413, 336594949, 336660485, 336726021, 336791557, 336857093, 336922629, 336988165,
+    337053701, 337119237, 337184773, 337250309, 337315845, 337381381, 337446917, 337512453,
+    337577989, 337643525, 337709061, 337774597, 337840133, 337905669, 337971205, 338036741,
+    338102277, 338167813, 338233349, 338298885, 338364421, 338429957, 338495493, 338561029,
+    338626565, 338692101, 338757637, 338823173, 338888709, 338954245, 339019781, 339085317,
+    339150853, 339216389, 339281925, 339347461, 339412997, 339478533, 339544069, 339609605,
+    339675141, 339740677, 339806213, 339871749, 339937285, 340002821, 340068357, 340133893,
+    340199429, 340264965, 340330501, 340396037, 340461573, 340527109, 340592645, 340658181,
+    340723717, 340789253, 340854789, 340920325, 340985861, 341051397, 341116933, 341182469,
+    341248005, 341313541, 341379077, 341444613, 409274373, 409339909, 409405445, 409470981,
+    409536517, 409602053, 409667589, 409733125, 409798661, 409864197, 409929733, 409995269,
+    410060805, 410126341, 410191877, 410257413, 410322949, 410388485, 410454021, 410519557,
+    410585093, 410650629, 410716165, 410781701, 410847237, 410912773, 410978309, 411043845,
+    411109381, 411174917, 411240453, 411305989, 411371525, 411437061, 411502597, 411568133,
+    411633669, 411699205, 411764741, 411830277, 411895813, 411961349, 412026885, 412092421,
+    412157957, 412223493, 412289029, 412354565, 412420101, 412485637, 412551173, 412616709,
+    412682245, 412747781, 412813317, 412878853, 412944389, 157878277, 157943813, 158009349,
+    158074885, 158140421, 158205957, 158271493, 158337029, 158402565, 158468101, 158533637,
+    158599173, 158664709, 158730245, 158795781, 158861317, 158926853, 158992389, 159057925,
+    159123461, 159188997, 159254533, 159320069, 159385605, 159451141, 159516677, 159582213,
+    159647749, 159713285, 159778821, 159844357, 159909893, 159975429, 160040965, 160106501,
+    160172037, 160237573, 160303109, 160368645, 160434181, 160499717, 160565253, 160630789,
+    160696325, 160761861, 160827397, 160892933, 160958469, 161024005, 161089541, 161155077,
+    161220613, 161286149, 161351685, 161417221, 161482757, 161548293, 161613829, 161679365,
+    161744901, 161810437, 161875973, 161941509, 162007045, 162072581, 162138117, 162203653,
+    162269189, 162334725, 162400261, 162465797, 162531333, 162596869, 162662405, 162727941,
+    162793477, 162859013, 162924549, 162990085, 163055621, 163121157, 163186693, 163252229,
+    163317765, 163383301, 163448837, 163514373, 163579909, 163645445, 163710981, 163776517,
+    163842053, 163907589, 163973125, 164038661, 164104197, 164169733, 164235269, 164300805,
+    164366341, 164431877, 164497413, 164562949, 164628485, 164694021, 164759557, 164825093,
+    164890629, 164956165, 165021701, 165087237, 165152773, 165218309, 165283845, 165349381,
+    165414917, 165480453, 165545989, 165611525, 165677061, 165742597, 165808133, 165873669,
+    165939205, 166004741, 166070277, 166135813, 166201349, 166266885, 166332421, 166397957,
+    166463493, 166529029, 166594565, 166660101, 166725637, 166791173, 166856709, 166922245,
+    166987781, 167053317, 167118853, 167184389, 167249925, 167315461, 167380997, 167446533,
+    167512069, 167577605, 167643141, 167708677, 167774213, 167839749, 167905285, 167970821,
+    168036357, 168101893, 168167429, 168232965, 168298501, 168364037, 168429573, 168495109,
+    168560645, 168626181, 168691717, 168757253, 168822789, 168888325, 168953861, 169019397,
+    169084933, 169150469, 169216005, 169281541, 169347077, 169412613, 169478149, 169543685,
+    169609221, 169674757, 169740293, 169805829, 169871365, 169936901, 170002437, 170067973,
+    170133509, 170199045, 170264581, 170330117, 170395653, 170461189, 170526725, 170592261,
+    170657797, 170723333, 170788869, 170854405, 170919941, 170985477, 171051013, 2116,
+    2180, 2244, 2308, 2372, 2436, 2500, 2564, 2628,
+    2692, 2756, 2756, 2308, 2820, 2884, 2948, 3012,
+    3076, 3140, 3204, 3268, 3332, 3396, 3460, 3524,
+    3556, 3588, 3620, 3652, 3716, 3780, 3844, 3908,
+    3972, 4036, 4100, 4164, 4228, 4292, 4356, 4420,
+    4484, 4548, 4612, 4676, 4740, 4804, 4868, 4932,
+    4996, 5060, 5124, 5188, 5252, 5316, 5380, 5444,
+    5508, 5572, 5636, 5700, 5764, 5828, 5892, 5956,
+    6020, 6084, 6148, 6212, 6276, 6340, 6404, 6468,
+    6532, 6596, 6660, 6724, 6788, 6852, 6916, 6980,
+    7024, 7028, 7044, 7108, 7172, 7220, 7220, 8244,
+    7236, 7300, 7364, 7412, 7412, 8244, 7428, 7492,
+    7556, 7600, 7604, 7600, 8240, 7604, 8244, 7620,
+    7684, 7748, 7812, 7856, 7860, 7856, 8240, 7860,
+    8244, 7876, 7940, 8004, 8048, 8052, 8048, 8240,
+    8052, 8244, 8068, 8132, 8196, 8240, 8244, 8244,
+    9780, 8260, 8304, 8308, 8324, 8388, 8452, 8516,
+    8580, 8644, 8708, 8772, 8836, 8900, 8964, 9028,
+    9092, 9156, 9220, 9284, 9348, 9412, 9476, 9540,
+    9604, 9668, 9732, 9796, 9860, 9924, 9988, 10052,
+    10116, 10180, 10244, 10308, 10372, 10436, 10500, 10564,
+    10628, 10692, 10756, 10820, 10884, 10948, 11012, 11076,
+    11140, 11204, 11268, 11332, 11396, 11460, 11524, 11588,
+    11652, 11716, 11780, 11844, 11908, 11972, 12036, 12100,
+    12164, 12228, 12292, 12356, 12420, 12484, 12548, 12612,
+    12676, 12740, 12804, 12868, 12932, 12996, 13060, 13124,
+    13188, 13252, 13316, 13380, 13444, 13508, 13572, 13636,
+    13700, 13764, 13828, 13892, 13956, 14020, 14084, 14148,
+    14212, 14276, 14340, 14404, 14468, 14532, 14596, 14660,
+    14724, 14788, 14852, 14916, 14980, 15044, 15108, 15172,
+    15236, 15300, 15364, 15428, 15492, 15556, 15620, 15684,
+    15748, 15812, 15876, 15940, 16004, 16068, 16132, 16196,
+    16260, 16324, 16388, 16452, 16516, 16580, 16644, 16708,
+    16772, 16836, 16900, 16964, 17028, 17092, 17156, 17220,
+    17284, 17348, 17412, 17476, 17540, 17604, 17668, 17732,
+    17796, 17860, 524683268, 524748804, 524814340, 524879876, 524945412, 525010948,
+    525076484, 525142020, 525207556, 525273092, 525338628, 525404164, 525469700, 525535236,
+    525600772, 525666308, 525731844, 525797380, 525862916, 525928452, 525993988, 526059524,
+    526125060, 526125060, 3524, 526190596, 526190596, 3524, 526256132, 526321668,
+    526321668, 3524, 526387204, 526387236, 526452740, 526452740, 3524, 526518276,
+    526583812, 526583814, 526649348, 526649350, 526649374, 526714884, 526714886, 526780420,
+    526780422, 526845956, 526911492, 526977028, 527042564, 527108100, 527173636, 527239172,
+    527304708, 527370244, 527435780, 527501316, 527566852, 527632388, 527697924, 527763460,
+    527828996, 527894532, 527960068, 528025604, 528091140, 528156676, 528222212, 528287748,
+    528353284, 528418820, 528484356, 528484358, 528549892, 528615428, 528680964, 528746500,
+    528812036, 528877572, 528943108, 529008644, 529074180, 529139716, 529205252, 529270788,
+    529336324, 529401860, 529467396, 529532932, 529598468, 529664004, 529729540, 529795076,
+    529860612, 529926148, 529991684, 530057220, 530057222, 530057224, 530057224, 41814025,
+    530057224, 35850249, 530057226, 530057228, 530057256, 530057258, 530057276, 108398653,
+    530253884, 530057224, 4215277576, 4038656000, 530122756, 530122758, 530122760, 52955145,
+    530122760, 53020681, 530122760, 41814025, 530122760, 35850249, 530122762, 530122764,
+    530122792, 530122794, 530122812, 108398653, 530122760, 17928, 52955145, 530122760,
+    530057224, 53020681, 530122760, 530057224, 41814025, 530122764, 530057228, 530122760,
+    530057224, 4215277576, 3856990208, 530122760, 530057224, 4215277576, 3876061184, 530122760,
+    530057224, 4215277576, 4038656000, 52955145, 530122760, 530122760, 53020681, 530122760,
+    530122760, 41814025, 530122764, 530122764, 530122812, 108398653, 530122812, 530057276,
+    530122760, 530122760, 4215277576, 3856990208, 530122760, 530122760, 4215277576, 3876061184,
+    530122760, 530122760, 4215277576, 4038656000, 52955145, 530122760, 530188296, 53020681,
+    530122760, 530188296, 41814025, 530122764, 530188300, 530122812, 108398653, 530188348,
+    530122808, 530188344, 530057272, 560662586, 530122760, 530188296, 4215277576, 3856990208,
+    530122760, 530188296, 4215277576, 3876061184, 530122760, 530188296, 4215277576, 4038656000,
+    52955145, 530122760, 530253832, 53020681, 530122760, 530253832, 41814025, 530122764,
+    530253836, 530122812, 108398653, 530253884, 530122760, 530253832, 4215277576, 3856990208,
+    530122760, 530253832, 4215277576, 4038656000, 52955145, 530122760, 530319368, 53020681,
+    530122760, 530319368, 41814025, 530122764, 530319372, 530122812, 108398653, 530319420,
+    530122760, 530319368, 4215277576, 3856990208, 530122760, 530319368, 4215277576, 4038656000,
+    52955145, 530122760, 530384904, 53020681, 530122760, 530384904, 41814025, 530122764,
+    530384908, 530122812, 108398653, 530384956, 530122760, 530384904, 4215277576, 3856990208,
+    530122760, 530384904, 4215277576, 4038656000, 52955145, 530122760, 530450440, 53020681,
+    530122760, 530450440, 41814025, 530122764, 530450444, 530122812, 108398653, 530450492,
+    530122760, 530450440, 4215277576, 3856990208, 530122760, 530450440, 4215277576, 4038656000,
+    52955145, 530122760, 530515976, 53020681, 530122760, 530515976, 41814025, 530122764,
+    530515980, 530122812, 108398653, 530516028, 530122760, 530515976, 4215277576, 3856990208,
+    530122760, 530515976, 4215277576, 4038656000, 52955145, 530122760, 530581512, 53020681,
+    530122760, 530581512, 41814025, 530122764, 530581516, 530122812, 108398653, 530581564,
+    530122760, 530581512, 4215277576, 3856990208, 530122760, 530581512, 4215277576, 4038656000,
+    52955145, 530122760, 530647048, 53020681, 530122760, 530647048, 41814025, 530122764,
+    530647052, 530122812, 108398653, 530647100, 530122760, 530647048, 4215277576, 3856990208,
+    530122760, 530647048, 4215277576, 4038656000, 530122760, 4215277576, 3856990208, 530122760,
+    4215277576, 3876061184, 530122760, 4215277576, 4038656000, 530188292, 530188294, 530188296,
+    52955145, 530188296, 53020681, 530188296, 41814025, 530188296, 35850249, 530188298,
+    530188300, 530188328, 530188330, 530188296, 17928, 52955145, 530188296, 530057224,
+    53020681, 530188296, 530057224, 41814025, 530188300, 530057228, 530188296, 530057224,
+    4215277576, 3856990208, 530188296, 530057224, 4215277576, 4038656000, 530188300, 530122764,
+    530188296, 530122760, 4215277576, 3856990208, 530188296, 530122760, 4215277576, 4038656000,
+    530188300, 530188300, 530188344, 530188344, 41814073, 530188344, 530188296, 530188296,
+    4215277576, 3856990208, 530188296, 530188296, 4215277576, 4038656000, 530188300, 530253836,
+    530188348, 108398653, 530253884, 530188296, 530253832, 4215277576, 3856990208, 530188296,
+    530253832, 4215277576, 4038656000, 530188300, 530319372, 530188296, 530319368, 4215277576,
+    3856990208, 530188296, 530319368, 4215277576, 4038656000, 530188300, 530384908, 530188348,
+    108398653, 530384956, 530188296, 530384904, 4215277576, 3856990208, 530188300, 530450444,
+    530188296, 530450440, 4215277576, 3856990208, 530188300, 530515980, 530188296, 530515976,
+    4215277576, 3856990208, 530188300, 530581516, 530188296, 530581512, 4215277576, 3856990208,
+    530188300, 530647052, 530188296, 530647048, 4215277576, 3856990208, 530188344, 549718074,
+    530188344, 555223096, 535496760, 34146361, 567412794, 534120504, 563284024, 530188296,
+    4215277576, 3856990208, 530188296, 4215277576, 3876061184, 530188296, 4215277576, 4038656000,
+    530253828, 530253830, 530253832, 52955145, 530253832, 53020681, 530253832, 41814025,
+    530253832, 35850249, 530253834, 530253836, 530253864, 530253866, 530253828, 17924,
+    530253832, 17928, 530253836, 530057228, 530253832, 530057224, 4215277576, 3856990208,
+    530253836, 530122764, 530253832, 530122760, 4215277576, 3856990208, 530253836, 530188300,
+    530253836, 530253836, 530253836, 530319372, 530253884, 108398653, 530319420, 530253836,
+    530384908, 530253884, 108398653, 530384956, 530253836, 530450444, 530253836, 530515980,
+    530253836, 530581516, 530253884, 108398653, 530581564, 530253836, 530647052, 530253880,
+    535496762, 530253832, 4215277576, 3856990208, 530253832, 4215277576, 3876061184, 530253832,
+    4215277576, 4038656000, 530319364, 530319366, 530319368, 52955145, 530319368, 53020681,
+    530319368, 41814025, 530319368, 35850249, 530319370, 530319372, 530319400, 530319402,
+    530319368, 17928, 530319372, 530057228, 530319372, 530122764, 530319372, 530188300,
+    530319372, 530253836, 530319372, 530319372, 530319372, 530384908, 530319420, 108398653,
+    530384956, 530319372, 530450444, 530319372, 530515980, 530319372, 530581516, 530319372,
+    530647052, 530319416, 549718074, 530319368, 4215277576, 3856990208, 530319368, 4215277576,
+    3876061184, 530319368, 4215277576, 4038656000, 530384900, 530384902, 530384904, 52955145,
+    530384904, 53020681, 530384904, 41814025, 530384904, 35850249, 530384906, 530384908,
+    530384936, 530384938, 530384904, 17928, 530384908, 530057228, 530384952, 41814073,
+    530122808, 530384956, 108398653, 530450492, 530384956, 108398653, 530581564, 530384904,
+    4215277576, 3856990208, 530384904, 4215277576, 3876061184, 530384904, 4215277576, 4038656000,
+    530450436, 530450438, 530450440, 52955145, 530450440, 53020681, 530450440, 41814025,
+    530450440, 35850249, 530450442, 530450444, 530450472, 530450474, 530450440, 17928,
+    530450444, 530057228, 530450488, 530057272, 560662586, 530450440, 4215277576, 3856990208,
+    530450440, 4215277576, 3876061184, 530450440, 4215277576, 4038656000, 530515972, 530515974,
+    530515976, 52955145, 530515976, 53020681, 530515976, 41814025, 530515976, 35850249,
+    530515978, 530515980, 530516008, 530516010, 530515976, 17928, 530515980, 530057228,
+    530516024, 41814073, 530122808, 530516028, 108398653, 530581564, 530515976, 4215277576,
+    3856990208, 530515976, 4215277576, 3876061184, 530515976, 4215277576, 4038656000, 530581508,
+    530581510, 530581512, 52955145, 530581512, 53020681, 530581512, 41814025, 530581512,
+    35850249, 530581514, 530581516, 530581544, 530581546, 530581512, 17928, 530581516,
+    530057228, 530581560, 549718074, 530581512, 4215277576, 3856990208, 530581512, 4215277576,
+    3876061184, 530581512, 4215277576, 4038656000, 530647044, 530647046, 530647048, 52955145,
+    530647048, 53020681, 530647048, 41814025, 530647048, 35850249, 530647050, 530647052,
+    530647080, 530647082, 530647048, 17928, 530647048, 4215277576, 3856990208, 530647048,
+    4215277576, 3876061184, 530647048, 4215277576, 4038656000, 530712580, 530712582, 530712584,
+    52955145, 530712584, 53020681, 530712586, 530712588, 530712592, 530712594, 52955145,
+    530712596, 53020681, 530712598, 530712600, 530712616, 530712618, 530712634, 530712580,
+    2308, 530712592, 2308, 530712580, 2372, 530712592, 2372, 530712580,
+    2436, 530712592, 2436, 530712580, 2436, 2308, 530712592, 2436,
+    2308, 530712580, 2436, 2372, 530712592, 2436, 2372, 530712580,
+    2436, 2884, 530712592, 2436, 2884, 530712580, 2436, 3780,
+    530712592, 2436, 3780, 530712580, 2500, 530712592, 2500, 530712580,
+    2500, 2308, 530712592, 2500, 2308, 530712580, 2500, 2372,
+    530712592, 2500, 2372, 530712580, 2500, 2884, 530712592, 2500,
+    2884, 530712580, 2500, 3780, 530712592, 2500, 3780, 530712580,
+    2564, 530712592, 2564, 530712580, 2628, 530712592, 2628, 530712580,
+    2628, 2308, 530712592, 2628, 2308, 530712580, 2756, 530712584,
+    2760, 530712592, 2756, 530712596, 2760, 530712580, 2756, 3204,
+    530712592, 2756, 3204, 530712580, 2884, 530712592, 2884, 530712580,
+    2948, 530712592, 2948, 530712580, 2948, 3204, 530712592, 2948,
+    3204, 530712580, 3140, 530712592, 3140, 530712580, 3204, 530712592,
+    3204, 530712580, 3780, 530712592, 3780, 530712580, 3844, 530712592,
+    3844, 530712580, 3972, 530712592, 3972, 530712580, 4228, 530712592,
+    4228, 530712580, 4228, 2436, 530712592, 4228, 2436, 530712580,
+    4228, 2500, 530712592, 4228, 2500, 530712580, 4356, 530712592,
+    4356, 530712584, 17928, 530712584, 530712584, 530712596, 530712596, 530712634,
+    532416570, 530712584, 61212681, 534120456, 530712584, 17928, 537331720, 530712596,
+    17928, 537331732, 530712616, 17960, 537331752, 530712584, 17928, 537331720,
+    2308, 530712596, 17928, 537331732, 2308, 530712584, 17928, 537331720,
+    3204, 530712596, 17928, 537331732, 3204, 530712632, 41814073, 554240056,
+    41814073, 530712634, 108333113, 554240056, 530712584, 557582344, 530712596, 557582356,
+    530712584, 61212681, 567412744, 530712596, 61212681, 567412756, 530712584, 571934728,
+    530712596, 571934740, 530712634, 571934778, 530712584, 575080456, 530712596, 575080468,
+    530712584, 17928, 575080456, 530712596, 17928, 575080468, 530712584, 577767432,
+    530712596, 577767444, 530712584, 585435144, 530974724, 531040260, 531040272, 531105796,
+    531171332, 531171344, 531236868, 531302404, 531302440, 531367940, 531433476, 531433488,
+    531433512, 531695620, 531695624, 531695632, 531695656, 531957764, 532023300, 532088836,
+    532088848, 532088872, 532350980, 532416516, 532416518, 532416520, 52955145, 532416520,
+    53020681, 532416522, 532416524, 532416528, 532416530, 52955145, 532416532, 53020681,
+    532416534, 532416536, 532416552, 532416570, 532416516, 2948, 532416528, 2948,
+    532416516, 4228, 532416528, 4228, 532416516, 4676, 532416528, 4676,
+    532416568, 530712632, 563284024, 532416570, 562038840, 532678660, 532940804, 532940816,
+    533202948, 533268484, 533334020, 533399556, 533399568, 533465092, 533530628, 533530640,
+    533792772, 533792784, 534054916, 534054920, 534054928, 534120452, 534120454, 534120456,
+    52955145, 534120456, 53020681, 534120458, 534120460, 534120464, 534120466, 86640649,
+    534120468, 534120468, 52955145, 534120468, 53020681, 534120470, 534120472, 534120488,
+    534120506, 534120452, 2308, 534120464, 2308, 534120452, 2500, 534120464,
+    2500, 534120452, 2564, 534120464, 2564, 534120452, 2948, 534120464,
+    2948, 534120452, 3076, 534120456, 3080, 534120464, 3076, 534120452,
+    3076, 2308, 534120464, 3076, 2308, 534120504, 530712632, 550897720,
+    534120504, 534120504, 534120472, 535496728, 534120504, 535496760, 534120506, 108333113,
+    549718072, 542181432, 534120506, 550897722, 534120504, 554240056, 534120504, 554240056,
+    530188344, 534120504, 554240056, 530253880, 534120456, 61212681, 557582344, 534120506,
+    557582392, 41814073, 534120506, 557582394, 557582394, 550897722, 534120456, 61212681,
+    571934728, 534382596, 534448132, 534448144, 534710276, 534710288, 534775812, 534775824,
+    534841348, 534841360, 535103492, 535103528, 535365636, 535365648, 535431172, 535431184,
+    535496708, 535496710, 535496712, 52955145, 535496712, 53020681, 535496714, 535496716,
+    535496720, 535496722, 535496724, 52955145, 535496724, 53020681, 535496726, 535496728,
+    535496744, 535496760, 535496762, 535496708, 2564, 535496720, 2564, 535496708,
+    2948, 535496720, 2948, 535496708, 3076, 535496720, 3076, 535496708,
+    3652, 535496720, 3652, 535496708, 4228, 535496720, 4228, 535496708,
+    4484, 535496720, 4484, 535496708, 4676, 535496720, 4676, 535496712,
+    17928, 535496724, 17928, 535496744, 17960, 535496712, 17992, 535496724,
+    17992, 535496760, 530712632, 535496712, 532416520, 535496760, 532416570, 535496762,
+    548079674, 535496760, 550897720, 535496760, 554240056, 535496760, 554240056, 530188344,
+    535496760, 554240056, 530253880, 535496712, 579209224, 535496724, 579209224, 535496724,
+    579209236, 535496712, 579209224, 2568, 535496724, 579209224, 2568, 535496724,
+    579209236, 2568, 535496712, 580192264, 535496712, 580454408, 535496712, 581109768,
+    535758852, 535824388, 535889924, 535889936, 535955460, 536020996, 536086532, 536086544,
+    536348676, 536348688, 536610820, 536676356, 536676368, 536938500, 537200644, 537266180,
+    537331716, 537331718, 537331720, 52955145, 537331720, 53020681, 537331722, 537331724,
+    537331728, 537331730, 52955145, 537331732, 53020681, 537331734, 537331736, 537331752,
+    537331754, 537331770, 537331716, 2308, 537331728, 2308, 537331716, 2372,
+    537331728, 2372, 537331716, 2436, 537331728, 2436, 537331716, 2500,
+    537331728, 2500, 537331716, 2500, 2308, 537331728, 2500, 2308,
+    537331716, 2500, 2372, 537331728, 2500, 2372, 537331716, 2500,
+    2884, 537331728, 2500, 2884, 537331716, 2500, 3780, 537331728,
+    2500, 3780, 537331716, 2564, 537331728, 2564, 537331716, 2756,
+    537331728, 2756, 537331716, 2884, 537331728, 2884, 537331716, 2948,
+    537331728, 2948, 537331716, 3076, 537331728, 3076, 537331716, 3076,
+    2436, 537331728, 3076, 2436, 537331716, 3140, 537331728, 3140,
+    537331716, 3204, 537331728, 3204, 537331716, 3204, 2308, 537331728,
+    3204, 2308, 537331716, 3204, 2372, 537331728, 3204, 2372,
+    537331716, 3780, 537331728, 3780, 537331716, 3844, 537331728, 3844,
+    537331716, 3972, 537331728, 3972, 537331716, 4228, 537331728, 4228,
+    537331716, 4228, 2500, 537331728, 4228, 2500, 537331716, 4484,
+    537331728, 4484, 537331716, 4612, 537331728, 4612, 537331768, 563284024,
+    542181432, 537331768, 575080506, 537593860, 537659396, 537724932, 537790468, 537790480,
+    538052612, 538118148, 538183684, 538249220, 538249232, 538249274, 538511364, 538576900,
+    538576904, 538576912, 538576936, 538576938, 538839044, 538904580, 538904592, 538904596,
+    538904616, 539166724, 539232260, 539494404, 539756548, 539756560, 539756584, 540018692,
+    540084228, 540084264, 540149764, 540411908, 540674052, 540936196, 541198340, 541198342,
+    541198344, 52955145, 541198344, 53020681, 541198346, 541198348, 541198352, 541198354,
+    86640649, 541198356, 52955145, 541198356, 53020681, 541198358, 541198360, 541198376,
+    541198394, 541198340, 2948, 541198352, 2948, 541198344, 17992, 541198356,
+    17992, 541198356, 530712596, 576981012, 541198344, 541198344, 541198344, 541198344,
+    546310152, 541198344, 541198344, 550897672, 541198344, 546310152, 541198344, 550897672,
+    541198392, 554240056, 541198344, 557254664, 541198394, 563284026, 537331770, 537331770,
+    541460484, 541526020, 541591556, 541591568, 541657092, 541722628, 541788164, 541788176,
+    542050308, 542050320, 542115844, 542181380, 542181382, 542181384, 52955145, 542181384,
+    53020681, 542181386, 542181388, 542181392, 542181394, 52955145, 542181396, 53020681,
+    542181398, 542181400, 542181416, 542181434, 542181380, 2308, 542181392, 2308,
+    542181380, 2436, 542181392, 2436, 542181380, 2500, 542181392, 2500,
+    542181380, 2564, 542181392, 2564, 542181380, 2948, 542181392, 2948,
+    542181380, 3076, 542181392, 3076, 542181380, 3204, 542181392, 3204,
+    542181384, 3400, 542181396, 3400, 542181384, 17992, 542181396, 17992,
+    542181432, 530712632, 550897720, 542181434, 532416570, 542181434, 544540730, 579209272,
+    542181434, 560662586, 530712632, 542181434, 577767480, 542443524, 542443536, 542443560,
+    542705668, 542771204, 542771208, 543033348, 543033360, 543295492, 543361028, 543361040,
+    543623172, 543885316, 543950852, 543950864, 544016388, 544016400, 544016424, 544278532,
+    544278544, 544540676, 544540678, 544540680, 52955145, 544540680, 53020681, 544540682,
+    544540684, 544540688, 544540690, 52955145, 544540692, 53020681, 544540694, 544540696,
+    544540712, 544540714, 544540730, 544540676, 2500, 544540688, 2500, 544540676,
+    2564, 544540688, 2564, 544540676, 2756, 544540688, 2756, 544540676,
+    2948, 544540688, 2948, 544540676, 3076, 544540688, 3076, 544540676,
+    3652, 544540688, 3652, 544540712, 3688, 544540676, 4228, 544540688,
+    4228, 544540676, 4548, 544540688, 4548, 544540676, 4676, 544540728,
+    530712632, 544540730, 534120504, 544540730, 535496760, 563284026, 544540730, 542181432,
+    544540730, 546310200, 34146361, 563284026, 537331768, 567412792, 544540730, 560662586,
+    544540728, 560662586, 530712632, 544540730, 575080506, 544540730, 579209272, 544802820,
+    545064964, 545064976, 545327108, 545392644, 545392656, 545392680, 545654788, 545654800,
+    545720324, 545720336, 545785860, 545785872, 545851396, 545851408, 545851432, 545916932,
+    546179076, 546244612, 546310148, 546310150, 546310152, 52955145, 546310152, 53020681,
+    546310154, 546310156, 546310160, 546310162, 546310164, 52955145, 546310164, 53020681,
+    546310166, 546310168, 546310184, 546310186, 546310202, 546310148, 2308, 546310160,
+    2308, 546310148, 2372, 546310160, 2372, 546310148, 2436, 546310160,
+    2436, 546310148, 2500, 546310160, 2500, 546310148, 2564, 546310160,
+    2564, 546310148, 2756, 546310160, 2756, 546310148, 2756, 2308,
+    546310160, 2756, 2308, 546310148, 2884, 546310160, 2884, 546310160,
+    2948, 546310148, 3140, 546310160, 3140, 546310148, 3204, 546310160,
+    3204, 546310148, 3780, 546310160, 3780, 546310148, 3844, 546310160,
+    3844, 546310148, 3972, 546310160, 3972, 546310148, 4228, 546310160,
+    4228, 546310148, 4612, 546310160, 4612, 546310202, 534120506, 546310202,
+    535496762, 546310152, 546310152, 546310164, 546310164, 546310152, 546310152, 546310152,
+    546310164, 546310164, 546310164, 546310152, 548079624, 546310164, 548079636, 546310200,
+    555223096, 546310202, 571934778, 546310152, 575080456, 546310164, 575080468, 546310152,
+    576981000, 546310164, 576981012, 546572292, 546572298, 546834436, 546834448, 546834472,
+    547096580, 547162116, 547227652, 547227688, 547293188, 547293200, 547293224, 547555332,
+    547555368, 547620868, 547686404, 547686416, 547751940, 547751952, 547751976, 548014084,
+    548079620, 548079622, 52955145, 548079624, 53020681, 548079626, 548079628, 548079632,
+    548079634, 52955145, 548079636, 53020681, 548079638, 548079640, 548079656, 548079658,
+    548079674, 548079620, 2500, 548079632, 2500, 548079620, 2564, 548341764,
+    548341770, 548603908, 548669444, 548669456, 548931588, 548931600, 548931624, 549193732,
+    549193768, 549455876, 549718020, 549718022, 549718024, 52955145, 549718024, 53020681,
+    549718026, 549718028, 549718032, 549718034, 52955145, 549718036, 53020681, 549718038,
+    549718040, 549718056, 549718058, 549718074, 549718020, 2308, 549718032, 2308,
+    549718020, 2564, 549718032, 2564, 549718020, 3076, 549718032, 3076,
+    549718024, 3400, 549718036, 3400, 549718020, 4228, 549718032, 4228,
+    549718020, 4676, 549718032, 4676, 549718072, 530712634, 549718074, 532416570,
+    549718072, 534120504, 530712632, 550897720, 549718072, 542181432, 549718072, 544540730,
+    579209272, 549718074, 549718074, 549718072, 550897720, 549718072, 554240056, 549718074,
+    554240058, 549718072, 554240056, 530188344, 549718072, 554240056, 530253880, 549718072,
+    560662586, 530712632, 549718072, 569837624, 549718072, 575080506, 549718072, 576260154,
+    549718072, 591792186, 549980164, 550045700, 550111236, 550111248, 550373380, 550373392,
+    550438916, 550438928, 550504452, 550504464, 550569988, 550570000, 550635524, 550635536,
+    550897668, 550897670, 550897672, 52955145, 550897672, 53020681, 550897674, 550897676,
+    550897680, 550897682, 550897684, 52955145, 550897684, 53020681, 550897686, 550897688,
+    550897704, 550897706, 550897722, 550897668, 2308, 550897680, 2308, 550897668,
+    2564, 550897680, 2564, 550897668, 3076, 550897680, 3076, 550897668,
+    3652, 550897680, 3652, 550897668, 4228, 550897680, 4228, 550897668,
+    4228, 3204, 550897680, 4228, 3204, 550897668, 4484, 550897680,
+    4484, 550897668, 4676, 550897680, 4676, 550897668, 17924, 550897680,
+    17924, 550897672, 548079624, 550897684, 548079624, 550897684, 548079636, 550897672,
+    550897672, 550897684, 550897684, 550897720, 554240056, 550897720, 555223096, 550897720,
+    557582392, 542181432, 550897722, 557582392, 567412792, 567412792, 550897720, 537331768,
+    567412792, 567412792, 550897672, 567412744, 550897722, 569837626, 535496762, 550897720,
+    576981048, 550897672, 579209224, 551159812, 551159816, 551159848, 551421956, 551421968,
+    551487492, 551553028, 551553040, 551618564, 551618576, 551880708, 551880720, 551946244,
+    551946256, 551946280, 552208388, 552208392, 552273924, 552339460, 552339472, 552601604,
+    552601640, 552667140, 552667176, 552732676, 552732712, 552994820, 553060356, 553322500,
+    553388036, 553650180, 553650192, 553715716, 553977860, 554240004, 554240006, 554240008,
+    52955145, 554240008, 53020681, 554240010, 554240012, 554240016, 554240018, 554240020,
+    52955145, 554240020, 53020681, 554240022, 554240024, 554240040, 554240042, 554240058,
+    554240004, 2308, 554240016, 2308, 554240004, 2948, 554240016, 2948,
+    554240004, 4228, 554240016, 4228, 554240056, 530188344, 554240056, 530253880,
+    554240056, 530712634, 554240056, 532416568, 554240058, 532416570, 554240040, 534120488,
+    554240040, 535496744, 554240056, 542181432, 554240058, 544540730, 579209272, 554240056,
+    546310200, 550897720, 554240056, 550897720, 554240056, 554240056, 554240056, 554240056,
+    530188344, 554240056, 554240056, 530253880, 554240056, 557582392, 550897720, 554240058,
+    560662586, 530712632, 554240040, 563284008, 554240056, 108333113, 567412792, 554240056,
+    567412792, 554240056, 108333113, 567412792, 530188344, 554240056, 575080506, 554240058,
+    575080506, 554240056, 576260154, 554240058, 576260154, 554240058, 591792186, 554502148,
+    554502152, 554567684, 554633220, 554698756, 554698768, 554698792, 554960900, 555026436,
+    555091972, 555157508, 555223044, 555223046, 555223048, 52955145, 555223048, 53020681,
+    555223050, 555223052, 555223056, 555223058, 52955145, 555223060, 53020681, 555223062,
+    555223064, 555223080, 555223082, 555223098, 555223044, 2308, 555223056, 2308,
+    555223044, 2372, 555223056, 2372, 555223044, 2564, 555223056, 2564,
+    555223044, 2884, 555223056, 2884, 555223044, 2948, 555223056, 2948,
+    555223044, 3076, 555223056, 3076, 555223048, 3400, 555223060, 3400,
+    555223044, 4228, 555223056, 4228, 555223044, 4484, 555223056, 4484,
+    555223044, 4676, 555223056, 4676, 555223096, 530712634, 555223098, 537331770,
+    576260154, 555223096, 541198394, 555223098, 542181434, 555223048, 548079624, 555223060,
+    548079624, 555223060, 548079636, 555223096, 554240056, 555223060, 557582344, 555223096,
+    567412792, 555223096, 575080506, 555223096, 576260154, 555485188, 555485192, 555485224,
+    555747332, 555812868, 555878404, 555943940, 555943952, 555943976, 556206084, 556206096,
+    556468228, 556468240, 556533764, 556599300, 556599336, 556861444, 557123588, 557189124,
+    557254660, 557254672, 557254696, 557516804, 557582340, 557582342, 557582344, 52955145,
+    557582344, 53020681, 557582346, 557582348, 557582352, 557582354, 52955145, 557582356,
+    53020681, 557582358, 557582360, 557582376, 557582378, 557582394, 557582340, 2308,
+    557582352, 2308, 557582340, 2372, 557582352, 2372, 557582340, 2436,
+    557582352, 2436, 557582340, 2500, 557582352, 2500, 557582340, 2500,
+    2308, 557582352, 2500, 2308, 557582340, 2500, 2372, 557582352,
+    2500, 2372, 557582340, 2500, 2884, 557582352, 2500, 2884,
+    557582340, 2500, 3780, 557582352, 2500, 3780, 557582340, 2564,
+    557582352, 2564, 557582340, 2756, 557582344, 2760, 557582352, 2756,
+    557582356, 2760, 557582340, 2756, 3204, 557582352, 2756, 3204,
+    557582340, 2820, 557582352, 2820, 557582340, 2884, 557582352, 2884,
+    557582340, 2884, 2308, 557582352, 2884, 2308, 557582340, 2884,
+    2756, 557582352, 2884, 2756, 557582340, 2884, 3204, 557582352,
+    2884, 3204, 557582340, 2948, 557582352, 2948, 557582340, 2948,
+    3204, 557582352, 2948, 3204, 557582340, 3012, 557582352, 3012,
+    557582340, 3012, 2308, 557582352, 3012, 2308, 557582340, 3140,
+    557582352, 3140, 557582340, 3140, 3204, 557582352, 3140, 3204,
+    557582340, 3204, 557582352, 3204, 557582340, 3204, 2308, 557582352,
+    3204, 2308, 557582340, 3204, 2372, 557582352, 3204, 2372,
+    557582344, 3336, 557582340, 3780, 557582352, 3780, 557582340, 3844,
+    557582352, 3844, 557582340, 3972, 557582352, 3972, 557582340, 4036,
+    557582352, 4036, 557582340, 4036, 2308, 557582352, 4036, 2308,
+    557582340, 4036, 2372, 557582352, 4036, 2372, 557582340, 4036,
+    2884, 557582352, 4036, 2884, 557582340, 4036, 3780, 557582352,
+    4036, 3780, 557582340, 4036, 4228, 557582352, 4036, 4228,
+    557582340, 4228, 557582352, 4228, 557582340, 4228, 2500, 557582352,
+    4228, 2500, 557582344, 17928, 537331720, 557582356, 17928, 537331732,
+    557582376, 17960, 537331752, 557582394, 549718074, 557582344, 557582344, 557582356,
+    557582356, 557582392, 575080506, 557844484, 557910020, 557975556, 558041092, 558303236,
+    558368772, 558434308, 558499844, 558565380, 558630916, 558696452, 558761988, 558827524,
+    558827536, 558827560, 559089668, 559155204, 559220740, 559286276, 559351812, 559417348,
+    559417360, 559482884, 559482920, 559548420, 559548456, 559613956, 559679492, 559679504,
+    559679528, 559941636, 559941648, 560007172, 560269316, 560269328, 560334852, 560334864,
+    560334906, 560596996, 560662532, 560662534, 560662536, 52955145, 560662536, 53020681,
+    560662538, 560662540, 560662544, 560662546, 52955145, 560662548, 53020681, 560662550,
+    560662552, 560662568, 560662570, 560662586, 560662532, 2308, 560662544, 2308,
+    560662532, 2948, 560662544, 2948, 560662584, 530712634, 560662586, 530712632,
+    560662586, 530712634, 560662584, 534120504, 560662584, 541198394, 560662586, 544540730,
+    560662584, 41814073, 554240056, 41814073, 560662586, 560662586, 554240058, 560662586,
+    560662586, 575080506, 560662586, 563284026, 560662584, 567412792, 560662586, 569837626,
+    537331770, 560662584, 575080506, 560662584, 576260154, 560924676, 560990212, 560990224,
+    561055748, 561055760, 561121284, 561186820, 561252356, 561252368, 561514500, 561514512,
+    561580036, 561580048, 561645572, 561711108, 561711144, 561973252, 562038788, 562038790,
+    52955145, 562038792, 53020681, 562038794, 562038796, 562038800, 562038802, 52955145,
+    562038804, 53020681, 562038806, 562038808, 562038842, 562038792, 560662536, 562300932,
+    562366468, 562366480, 562432004, 562432016, 562497540, 562759684, 562759696, 563021828,
+    563283972, 563283974, 563283976, 52955145, 563283976, 53020681, 563283978, 563283980,
+    563283984, 563283986, 52955145, 563283988, 53020681, 563283990, 563283992, 563284008,
+    563284010, 563284026, 563283972, 2308, 563283984, 2308, 563283972, 2564,
+    563283984, 2564, 563283972, 2948, 563283984, 2948, 563283972, 3076,
+    563283984, 3076, 563283976, 3400, 563283988, 3400, 563283972, 3844,
+    563283984, 3844, 563283972, 3972, 563283984, 3972, 563283972, 4228,
+    563283984, 4228, 563283972, 4228, 3204, 563283984, 4228, 3204,
+    563283972, 4676, 563283984, 4676, 563283976, 17992, 563283988, 17992,
+    563284024, 530712632, 535496760, 563284024, 530712632, 535496760, 108333113, 567412792,
+    563284024, 530712632, 535496760, 108333113, 567412792, 530188344, 563283988, 567412744,
+    563546116, 563611652, 563611656, 563611664, 563873796, 563939332, 563939336, 563939344,
+    564004868, 564070404, 564070416, 564332548, 564398084, 564398120, 564660228, 564725764,
+    564987908, 565053444, 565053480, 565315588, 565381124, 565643268, 565643280, 565905412,
+    565970948, 566233092, 566298628, 566560772, 566626308, 566691844, 566757380, 566822916,
+    566888452, 566888488, 567150596, 567216132, 567281668, 567347204, 567347216, 567412740,
+    567412742, 567412744, 52955145, 567412744, 53020681, 567412746, 567412748, 567412752,
+    567412754, 52955145, 567412756, 53020681, 59377673, 567412756, 59443209, 567412758,
+    567412760, 567412776, 567412778, 567412794, 567412740, 2308, 567412752, 2308,
+    567412740, 2308, 2948, 567412752, 2308, 2948, 567412740, 2500,
+    567412752, 2500, 567412740, 2564, 567412752, 2564, 567412740, 2564,
+    2948, 567412752, 2564, 2948, 567412740, 2948, 567412752, 2948,
+    567412740, 3076, 567412752, 3076, 567412744, 3400, 567412756, 3400,
+    567412740, 4228, 567412752, 4228, 567412740, 4228, 2948, 567412752,
+    4228, 2948, 567412740, 4420, 567412752, 4420, 567412744, 17992,
+    567412756, 17992, 567412744, 17992, 2948, 567412794, 530712634, 567412794,
+    535496762, 567412794, 544540730, 575080506, 567412776, 554240040, 567412794, 557582394,
+    567412794, 567412792, 563284024, 567412794, 567412794, 567412744, 17928, 567412744,
+    567412756, 17928, 567412756, 567412744, 569837576, 567412744, 17992, 569837576,
+    567412794, 575080504, 567674884, 567740420, 567740432, 567805956, 567871492, 567937028,
+    567937040, 567937064, 568199172, 568199184, 568461316, 568526852, 568592388, 568592392,
+    568592400, 568592424, 568854532, 568920068, 568985604, 569247748, 569509892, 569575428,
+    569837572, 569837574, 569837576, 52955145, 569837576, 53020681, 569837578, 569837580,
+    569837584, 569837586, 52955145, 569837588, 53020681, 569837590, 569837592, 569837608,
+    569837610, 569837626, 569837572, 2564, 569837584, 2564, 569837572, 2756,
+    569837572, 2948, 569837584, 2948, 569837572, 3076, 569837584, 3076,
+    569837572, 4228, 569837584, 4228, 569837572, 4420, 569837584, 4420,
+    569837572, 4484, 569837584, 4484, 569837572, 4676, 569837584, 4676,
+    569837576, 17992, 569837588, 17992, 569837576, 535103496, 569837588, 537331732,
+    550897684, 569837576, 17928, 544540680, 569837626, 544540730, 579209272, 569837608,
+    554240040, 569837576, 567412744, 569837576, 567937032, 569837576, 568592392, 569837576,
+    579209224, 569837588, 579209224, 570099716, 570165252, 570165264, 570427396, 570427408,
+    570492932, 570558468, 570558504, 570820612, 570820624, 571082756, 571082768, 571344900,
+    571607044, 571672580, 571672592, 571934724, 571934726, 571934728, 52955145, 571934728,
+    53020681, 571934730, 571934732, 571934736, 571934738, 52955145, 571934740, 53020681,
+    571934742, 571934744, 571934760, 571934762, 571934778, 571934724, 2308, 571934736,
+    2308, 571934724, 2372, 571934736, 2372, 571934724, 2436, 571934736,
+    2436, 571934724, 2500, 571934736, 2500, 571934724, 2564, 571934736,
+    2564, 571934724, 2628, 571934736, 2628, 571934724, 2756, 571934728,
+    2760, 571934736, 2756, 571934740, 2760, 571934724, 2756, 2308,
+    571934736, 2756, 2308, 571934724, 2756, 2372, 571934736, 2756,
+    2372, 571934724, 2756, 2564, 571934736, 2756, 2564, 571934724,
+    2756, 3204, 571934736, 2756, 3204, 571934724, 2820, 571934736,
+    2820, 571934724, 2884, 571934736, 2884, 571934724, 2884, 2308,
+    571934736, 2884, 2308, 571934724, 3140, 571934736, 3140, 571934724,
+    3204, 571934736, 3204, 571934724, 3204, 2756, 571934736, 3204,
+    2756, 571934728, 3336, 571934724, 3780, 571934736, 3780, 571934724,
+    3844, 571934736, 3844, 571934724, 3972, 571934736, 3972, 571934724,
+    4036, 571934736, 4036, 571934724, 4036, 2308, 571934736, 4036,
+    2308, 571934724, 4036, 2372, 571934736, 4036, 2372, 571934724,
+    4036, 2884, 571934736, 4036, 2884, 571934724, 4036, 3780,
+    571934736, 4036, 3780, 571934724, 4036, 4228, 571934736, 4036,
+    4228, 571934724, 4228, 571934736, 4228, 571934724, 4292, 571934736,
+    4292, 571934724, 4484, 571934736, 4484, 571934724, 4612, 571934736,
+    4612, 571934778, 544540730, 535496762, 571934778, 560662586, 40306745, 572196868,
+    572196904, 572262404, 572327940, 572327976, 572393476, 572459012, 572524548, 572590084,
+    572655620, 572655632, 572655656, 572917764, 572983300, 572983312, 573048836, 573114372,
+    573179908, 573179944, 573245444, 573245456, 573310980, 573310992, 573311016, 573573124,
+    573835268, 574097412, 574097424, 574097448, 574359556, 574425092, 574490628, 574490664,
+    574752772, 574752784, 574752808, 575014916, 575080452, 575080454, 575080456, 52955145,
+    575080456, 53020681, 575080458, 575080460, 575080464, 575080466, 575080468, 52955145,
+    575080468, 53020681, 575080470, 575080472, 575080488, 575080490, 575080506, 575080452,
+    2884, 575080464, 2884, 575080452, 4228, 575080464, 4228, 575080456,
+    546310152, 575080468, 546310164, 575080456, 546310152, 546310152, 575080468, 546310164,
+    546310164, 575080456, 546310152, 546310152, 546310152, 575080468, 546310164, 546310164,
+    546310164, 575080506, 108333113, 554240056, 575080506, 557582394, 535496762, 575080506,
+    567412794, 575080456, 577767432, 575080468, 577767444, 575342596, 575408132, 575408144,
+    575473668, 575539204, 575539216, 575539240, 575801348, 575866884, 575932420, 575932432,
+    575997956, 575997968, 575997992, 576260100, 576260102, 576260104, 52955145, 576260104,
+    53020681, 576260106, 576260108, 576260112, 576260114, 52955145, 576260116, 53020681,
+    576260118, 576260120, 576260136, 576260154, 576260100, 2308, 576260112, 2308,
+    576260100, 2372, 576260112, 2372, 576260100, 2500, 576260112, 2500,
+    576260100, 2628, 576260100, 2756, 576260112, 2756, 576260100, 2948,
+    576260112, 2948, 576260100, 4228, 576260112, 4228, 576260154, 532416568,
+    576260154, 534120506, 576260120, 579209240, 576522244, 576587780, 576587792, 576653316,
+    576653328, 576718852, 576718856, 576718888, 576980996, 576980998, 576981000, 52955145,
+    576981000, 53020681, 576981002, 576981004, 576981008, 576981010, 576981012, 52955145,
+    576981012, 53020681, 576981014, 576981016, 576981032, 576981034, 576981050, 576980996,
+    2756, 576981008, 2756, 576980996, 2948, 576981008, 2948, 576981000,
+    546310152, 576981012, 546310164, 576981000, 546310152, 546310152, 576981012, 546310164,
+    546310164, 577243140, 577308676, 577374212, 577439748, 577505284, 577570820, 577570832,
+    577636356, 577701892, 577767428, 577767430, 52955145, 577767432, 53020681, 577767434,
+    577767436, 577767440, 577767442, 52955145, 577767444, 53020681, 577767446, 577767448,
+    577767464, 577767482, 577767428, 2308, 577767440, 2308, 577767428, 2372,
+    577767440, 2372, 577767428, 2500, 577767440, 2500, 577767428, 2628,
+    577767428, 2756, 577767440, 2756, 577767428, 2884, 577767440, 2884,
+    577767428, 2948, 577767440, 2948, 577767428, 3204, 577767440, 3204,
+    577767428, 3780, 577767440, 3780, 577767428, 4228, 577767440, 4228,
+    578029572, 578291716, 578291728, 578553860, 578553872, 578816004, 578816016, 578881540,
+    578947076, 578947088, 579209220, 579209222, 579209224, 52955145, 579209224, 53020681,
+    579209226, 579209228, 579209232, 579209234, 52955145, 579209236, 53020681, 579209238,
+    579209240, 579209256, 579209274, 579209220, 2308, 579209232, 2308, 579209220,
+    2500, 579209232, 2500, 579209220, 2564, 579209232, 2564, 579209220,
+    2948, 579209232, 2948, 579209220, 4228, 579209232, 4228, 579209220,
+    4676, 579209232, 4676, 579209224, 576260104, 579471364, 579536900, 579536912,
+    579799044, 579864580, 579864592, 579930116, 579930128, 580192260, 580192296, 580454404,
+    580454440, 580716548, 580716560, 580978692, 580978704, 581044228, 581044240, 581109764,
+    581109776, 581109800, 581109764, 2564, 581109776, 2564, 581371908, 581437444,
+    581437456, 581699588, 581765124, 582027268, 582289412, 582289424, 582551556, 582551568,
+    582617092, 582617104, 582682628, 582682640, 582944772, 582944784, 583010308, 583075844,
+    583141380, 583206916, 583206928, 583272452, 583272464, 583337988, 583337992, 583338000,
+    583338024, 583403524, 583469060, 583731204, 583731216, 583796740, 583796752, 583862276,
+    583862288, 583927812, 583927824, 584189956, 584189968, 584452100, 584452112, 584714244,
+    584976388, 584976400, 585238532, 585304068, 585304072, 555223048, 585369604, 585435140,
+    585500676, 585500688, 585566212, 585566224, 585631748, 585697284, 585697320, 585959428,
+    586024964, 586090500, 586156036, 586156072, 586221572, 586221584, 586287108, 586549252,
+    586811396, 587073540, 587335684, 587597828, 587859972, 588122116, 588384260, 588646404,
+    588908548, 589170692, 589170698, 589170704, 589170710, 589170692, 2180, 589170704,
+    2180, 589170692, 2180, 2308, 589170704, 2180, 2308, 589170692,
+    2180, 2308, 4868, 589170704, 2180, 2308, 4868, 589170692,
+    2180, 2372, 589170704, 2180, 2372, 589170692, 2180, 2372,
+    4868, 589170704, 2180, 2372, 4868, 589170692, 2180, 2692,
+    589170704, 2180, 2692, 589170692, 2180, 2692, 4868, 589170704,
+    2180, 2692, 4868, 589170692, 2180, 4868, 589170704, 2180,
+    4868, 589170692, 2244, 589170704, 2244, 589170692, 2244, 2308,
+    589170704, 2244, 2308, 589170692, 2244, 2308, 4868, 589170704,
+    2244, 2308, 4868, 589170692, 2244, 2372, 589170704, 2244,
+    2372, 589170692, 2244, 2372, 4868, 589170704, 2244, 2372,
+    4868, 589170692, 2244, 2692, 589170704, 2244, 2692, 589170692,
+    2244, 2692, 4868, 589170704, 2244, 2692, 4868, 589170692,
+    2244, 4868, 589170704, 2244, 4868, 589170692, 2308, 589170704,
+    2308, 589170692, 2308, 4868, 589170692, 2372, 589170704, 2372,
+    589170692, 2372, 4868, 589170692, 2436, 589170704, 2436, 589170692,
+    2692, 589170692, 2692, 4868, 589170692, 3204, 589170704, 3204,
+    589170692, 4868, 589170704, 4868, 589236228, 589236232, 589236234, 589236240,
+    589236246, 589236264, 589236266, 589301764, 589301770, 589301776, 589301782, 589301800,
+    589301802, 589367300, 589432836, 589432842, 589432848, 589432854, 589432872, 589498372,
+    589498376, 589498378, 589498384, 589498390, 589498372, 2180, 589498384, 2180,
+    589498372, 2180, 2308, 589498384, 2180, 2308, 589498372, 2180,
+    2372, 589498384, 2180, 2372, 589498372, 2244, 589498384, 2244,
+    589498372, 2244, 2308, 589498384, 2244, 2308, 589498372, 2244,
+    2372, 589498384, 2244, 2372, 589498372, 2308, 589498384, 2308,
+    589498372, 2372, 589498384, 2372, 589563908, 589563914, 589563920, 589563926,
+    589629444, 589629456, 589694980, 589694992, 589760516, 589760522, 589760528, 589760534,
+    589826052, 589826064, 589891588, 589891594, 589891600, 589891606, 589891588, 2180,
+    589891600, 2180, 589891588, 2180, 2308, 589891600, 2180, 2308,
+    589891588, 2180, 2308, 4868, 589891600, 2180, 2308, 4868,
+    589891588, 2180, 2372, 589891600, 2180, 2372, 589891588, 2180,
+    2372, 4868, 589891600, 2180, 2372, 4868, 589891588, 2180,
+    2692, 589891600, 2180, 2692, 589891588, 2180, 2692, 4868,
+    589891600, 2180, 2692, 4868, 589891588, 2180, 4868, 589891600,
+    2180, 4868, 589891588, 2244, 589891600, 2244, 589891588, 2244,
+    2308, 589891600, 2244, 2308, 589891588, 2244, 2308, 4868,
+    589891600, 2244, 2308, 4868, 589891588, 2244, 2372, 589891600,
+    2244, 2372, 589891588, 2244, 2372, 4868, 589891600, 2244,
+    2372, 4868, 589891588, 2244, 2692, 589891600, 2244, 2692,
+    589891588, 2244, 2692, 4868, 589891600, 2244, 2692, 4868,
+    589891588, 2244, 4868, 589891600, 2244, 4868, 589891588, 2308,
+    589891600, 2308, 589891588, 2308, 4868, 589891588, 2372, 589891600,
+    2372, 589891588, 2372, 4868, 589891588, 2692, 589891588, 2692,
+    4868, 589891588, 4868, 589891600, 4868, 589957124, 589957128, 589957130,
+    589957136, 589957140, 589957142, 589957160, 590022660, 590022664, 590022666, 590022672,
+    590022678, 590022660, 2180, 590022672, 2180, 590022660, 2180, 2308,
+    590022672, 2180, 2308, 590022660, 2180, 2372, 590022672, 2180,
+    2372, 590022660, 2180, 2692, 590022672, 2180, 2692, 590022660,
+    2244, 590022672, 2244, 590022660, 2244, 2308, 590022672, 2244,
+    2308, 590022660, 2244, 2372, 590022672, 2244, 2372, 590022660,
+    2244, 2692, 590022672, 2244, 2692, 590022660, 2308, 590022672,
+    2308, 590022660, 2372, 590022672, 2372, 590022660, 2436, 590022672,
+    2436, 590022660, 2692, 590022660, 2756, 590022672, 2756, 590022660,
+    2756, 2308, 590022660, 2756, 2372, 590022660, 2756, 2692,
+    590022660, 3204, 590022672, 3204, 590088196, 590088208, 590153732, 590153736,
+    590153738, 590153744, 590153750, 590153736, 589170696, 590022664, 590153748, 589170696,
+    590022664, 590219268, 590219274, 590219280, 590219286, 590284804, 590350340, 590350344,
+    590350346, 590350352, 590350358, 590350392, 530712634, 590350392, 541198394, 590350392,
+    542181432, 590350392, 550897720, 590350392, 554240056, 590350392, 567412792, 590350392,
+    575080506, 590350392, 576260154, 590415876, 590415882, 590415888, 590415894, 590481412,
+    590481418, 590481424, 590481430, 590546948, 590546954, 590546960, 590546966, 590546948,
+    2180, 590546960, 2180, 590546948, 2180, 2308, 590546960, 2180,
+    2308, 590546948, 2180, 2372, 590546960, 2180, 2372, 590546948,
+    2244, 590546960, 2244, 590546948, 2244, 2308, 590546960, 2244,
+    2308, 590546948, 2244, 2372, 590546960, 2244, 2372, 590546948,
+    2308, 590546960, 2308, 590546948, 2372, 590546960, 2372, 590612484,
+    590612488, 590612490, 590612496, 590612502, 590678020, 590743556, 590743568, 590809092,
+    590809104, 590874628, 590874640, 590940164, 590940168, 590940170, 590940176, 590940182,
+    590940202, 590940164, 2180, 590940164, 2244, 590940176, 2244, 591005700,
+    591071236, 591136772, 591136776, 591136778, 591136784, 591136788, 591136790, 591136818,
+    591202308, 591202320, 591267844, 591267856, 591333380, 591333392, 591398916, 591398922,
+    591398928, 591398934, 591464452, 591464458, 591464464, 591464468, 591464470, 591464452,
+    2180, 591464452, 2180, 2308, 591464452, 2180, 2372, 591464452,
+    2180, 2692, 591464452, 2244, 591464464, 2244, 591464452, 2244,
+    2308, 591464464, 2244, 2308, 591464452, 2244, 2372, 591464464,
+    2244, 2372, 591464452, 2244, 2692, 591464464, 2244, 2692,
+    591464452, 2308, 591464464, 2308, 591464468, 2308, 591464452, 2372,
+    591464464, 2372, 591464452, 2436, 591464464, 2436, 591464452, 2692,
+    591464452, 2756, 591464464, 2756, 591464468, 2756, 591464452, 2756,
+    2308, 591464452, 2756, 2372, 591464452, 2756, 2692, 591464452,
+    3204, 591464464, 3204, 591529988, 591529992, 591529994, 591530000, 591530006,
+    591530024, 591530026, 591595524, 591595530, 591595536, 591595542, 591595560, 591595562,
+    591661060, 591661066, 591661072, 591661078, 591726596, 591792132, 591792138, 591792144,
+    591792150, 591792132, 2180, 591792144, 2180, 591792132, 2180, 2308,
+    591792144, 2180, 2308, 591792132, 2180, 2308, 4868, 591792144,
+    2180, 2308, 4868, 591792132, 2180, 2372, 591792144, 2180,
+    2372, 591792132, 2180, 2372, 4868, 591792144, 2180, 2372,
+    4868, 591792132, 2180, 2692, 591792144, 2180, 2692, 591792132,
+    2180, 2692, 4868, 591792144, 2180, 2692, 4868, 591792132,
+    2180, 4868, 591792144, 2180, 4868, 591792132, 2244, 591792144,
+    2244, 591792132, 2244, 2308, 591792144, 2244, 2308, 591792132,
+    2244, 2308, 4868, 591792144, 2244, 2308, 4868, 591792132,
+    2244, 2372, 591792144, 2244, 2372, 591792132, 2244, 2372,
+    4868, 591792144, 2244, 2372, 4868, 591792132, 2244, 2692,
+    591792144, 2244, 2692, 591792132, 2244, 2692, 4868, 591792144,
+    2244, 2692, 4868, 591792132, 2244, 4868, 591792144, 2244,
+    4868, 591792132, 2308, 591792144, 2308, 591792132, 2308, 4868,
+    591792132, 2372, 591792144, 2372, 591792132, 2372, 4868, 591792132,
+    2692, 591792132, 2692, 4868, 591792132, 4868, 591792144, 4868,
+    591857668, 591923204, 591923216, 591988740, 591988752, 592054276, 592054288, 592119812,
+    592119824, 592185348, 592185360, 592250884, 592250896, 592316420, 592316432, 592381956,
+    592381968, 592447492, 592447504, 592513028, 592513040, 592578564, 592578576, 592644100,
+    592644112, 592709636, 592709648, 592775172, 592775184, 592840708, 592840720, 592840712,
+    592119816, 592775176, 592906244, 592906256, 592971780, 592971792, 593037316, 593037328,
+    593102852, 593102864, 593168388, 593168400, 593233924, 593233936, 593299460, 593299472,
+    593364996, 593365008, 593430532, 593430544, 593496068, 593496080, 593561604, 593561616,
+    593627140, 593627152, 593692676, 593692688, 593758212, 593758224, 593823748, 593823760,
+    593889284, 593889296, 593954820, 593954832, 594020356, 594020368, 594085892, 594085904,
+    594151428, 594151440, 594216964, 594216976, 594282500, 594282512, 594348036, 594348048,
+    594413572, 594413584, 594479108, 594479120, 594544644, 594544656, 594610180, 594610192,
+    594675716, 594675728, 594741252, 594741264, 594806788, 594806800, 594872324, 594872336,
+    594937860, 594937872, 595003396, 595003408, 595068932, 595068944, 595134468, 595134480,
+    595200004, 595200016, 595265540, 595265552, 595331076, 595331088, 595396612, 595396624,
+    595462148, 595462160, 595527684, 595527696, 595593220, 595593232, 595658756, 595658768,
+    595724292, 595724304, 595789828, 595789840, 595855364, 595855376, 595920900, 595920912,
+    595986436, 595986448, 596051972, 596051976, 596051984, 596051972, 2436, 596051984,
+    2436, 596051972, 2756, 596051984, 2756, 596314116, 596314128, 596314116,
+    2756, 596314128, 2756, 596576260, 596576272, 596838404, 596838408, 596838416,
+    597100548, 597100552, 597100560, 597362692, 597362696, 597362704, 597362692, 2308,
+    597362704, 2308, 597362696, 17992, 597362708, 17992, 597624836, 597624848,
+    597886980, 597886992, 598149124, 598149136, 598411268, 598411280, 598673412, 598673416,
+    598673424, 598935556, 598935568, 599001092, 599001104, 599066628, 599066640, 599328772,
+    599328784, 599394308, 599394320, 599459844, 599459856, 599721988, 599721992, 599722000,
+    599721988, 2372, 599722000, 2372, 599721988, 2436, 599722000, 2436,
+    599721988, 2756, 599722000, 2756, 599984132, 599984136, 599984144, 600246276,
+    600246280, 600246288, 600246276, 2436, 600246288, 2436, 600246276, 2756,
+    600246288, 2756, 600508420, 600508432, 600573956, 600573968, 600639492, 600639504,
+    600901636, 600901640, 600901648, 600901636, 2756, 600901648, 2756, 601163780,
+    601163792, 601229316, 601229328, 601294852, 601294864, 601360388, 601360400, 601425924,
+    601425936, 601688068, 601688080, 601753604, 601753616, 602015748, 602015760, 602081284,
+    602081296, 602146820, 602146832, 602212356, 602212360, 602212368, 602212356, 2372,
+    602212368, 2372, 602212356, 2756, 602212368, 2756, 602212356, 3204,
+    602212368, 3204, 602474500, 602474512, 602736644, 602736656, 602736644, 2756,
+    602736648, 2760, 602736656, 2756, 602998788, 602998800, 603064324, 603064336,
+    603326468, 603326480, 603588612, 603588616, 603588624, 603654148, 603654152, 603654160,
+    603654148, 2308, 603654160, 2308, 603916292, 603916304, 604178436, 604178448,
+    604440580, 604440592, 604702724, 604702736, 604964868, 604964880, 605227012, 605227024,
+    605292548, 605292560, 605358084, 605358088, 605358096, 605620228, 605685764, 605685776,
+    605947908, 605947920, 606013444, 606013456, 606078980, 606078992, 606144516, 606144528,
+    606406660, 606406672, 606472196, 606472208, 606537732, 606537744, 606603268, 606603272,
+    606603280, 606865412, 606865424, 607127556, 607127568, 607193092, 607193096, 607193104,
+    607193128, 607455236, 607455248, 607520772, 607520784, 607782916, 607782928, 608045060,
+    608045072, 608307204, 608307216, 608372740, 608372752, 608634884, 608634896, 608897028,
+    608897040, 608962564, 608962568, 608962576, 608962580, 608962564, 2756, 608962576,
+    2756, 609224708, 609224720, 609224708, 2756, 609224720, 2756, 609486852,
+    609486856, 609486864, 609748996, 609749008, 609814532, 609814544, 610076676, 610076688,
+    610338820, 610338824, 610338832, 610600964, 610600976, 610863108, 610863120, 610928644,
+    610928648, 610928656, 610928648, 611518472, 611190788, 611190800, 611256324, 611256336,
+    611518468, 611518472, 611518480, 611780612, 611780624, 611846148, 611846160, 611911684,
+    611911696, 612173828, 612173840, 612239364, 612239376, 612501508, 612501512, 612501520,
+    612501508, 2436, 612501520, 2436, 612501508, 2756, 612501520, 2756,
+    612501508, 2820, 612501520, 2820, 612501508, 3204, 612501520, 3204,
+    612763652, 612763664, 613025796, 613025808, 613287940, 613287944, 613287952, 613353476,
+    613353488, 613615620, 613615624, 613615632, 613877764, 613877768, 613877776, 614139908,
+    614139920, 614402052, 614402064, 614664196, 614664208, 614926340, 614926352, 615188484,
+    615188496, 615254020, 615254032, 615319556, 615319560, 615319568, 615581700, 615581712,
+    615843844, 615843856, 615909380, 615909392, 616171524, 616171536, 616433668, 616433672,
+    616433680, 616695812, 616695824, 616761348, 616761360, 616826884, 616826896, 617089028,
+    617089040, 617154564, 617154568, 617154576, 617154564, 2756, 617154576, 2756,
+    617416708, 617416720, 617482244, 617482256, 617547780, 617547792, 617809924, 617809936,
+    618072068, 618072080, 618334212, 618334224, 618399748, 618399760, 618661892, 618661904,
+    618924036, 618924048, 619186180, 619186184, 619186192, 619448324, 619448336, 619513860,
+    619513864, 619513872, 619776004, 619776016, 619841540, 619907076, 619972612, 619972616,
+    619972624, 619972648, 620234756, 620234768, 620300292, 620300296, 620300304, 620300292,
+    2756, 620300304, 2756, 620562436, 620562440, 620562448, 620562472, 620824580,
+    620824592, 621086724, 621086728, 621086736, 621348868, 621348880, 621414404, 621414416,
+    621414404, 2756, 621414416, 2756, 621676548, 621676552, 621676560, 621938692,
+    621938704, 622004228, 622004232, 622004240, 622069764, 622069776, 622331908, 622331920,
+    622397444, 622397448, 622397456, 622659588, 622659592, 622659600, 622921732, 622921744,
+    622987268, 622987272, 622987280, 623249412, 623249424, 623314948, 623314960, 623577092,
+    623577104, 623642628, 623642632, 623642640, 623904772, 623904784, 624166916, 624166928,
+    624429060, 624429064, 624429072, 624691204, 624691216, 624691204, 3844, 624691216,
+    3844, 624953348, 624953360, 625018884, 625018896, 625281028, 625281040, 625346564,
+    625346576, 625608708, 625608712, 625608720, 625674244, 625674248, 625674256, 625739780,
+    625739784, 625739792, 625805316, 625805320, 625805328, 625870852, 625870856, 625870864,
+    625936388, 625936392, 625936400, 626001924, 626001928, 626001936, 626067460, 626067472,
+    626132996, 626133000, 626133008, 626198532, 626198536, 626198544, 626264068, 626264072,
+    626264080, 626329604, 626329608, 626329616, 626395140, 626395144, 626395152, 626460676,
+    626460680, 626460688, 626526212, 626526216, 626526224, 626591748, 626591752, 626591760,
+    626657284, 626657288, 626657296, 626722820, 626722824, 626722832, 626788356, 626788360,
+    626788368, 626853892, 626853896, 626853904, 626919428, 626919432, 626919440, 626984964,
+    626984968, 626984976, 627050500, 627050504, 627050512, 627116036, 627116040, 627116048,
+    627181572, 627181576, 627181584, 627247108, 627247120, 627312644, 627312656, 627378180,
+    627378184, 627378192, 627443716, 627443720, 627443728, 627509252, 627509256, 627509264,
+    627574788, 627574792, 627574800, 627640324, 627640328, 627640336, 627705860, 627705864,
+    627705872, 627771396, 627771400, 627771408, 627836932, 627836944, 627902468, 627902472,
+    627902480, 627968004, 627968008, 627968016, 628033540, 628033552, 628099076, 628099080,
+    628099088, 628164612, 628164616, 628164624, 628230148, 628230152, 628230160, 628295684,
+    628295688, 628295696, 628361220, 628361224, 628361232, 628426756, 628426768, 628492292,
+    628492304, 628557828, 628557840, 628623364, 628623376, 628688900, 628688904, 628754436,
+    628819972, 628885508, 628885512, 628951044, 629016580, 629082116, 629147652, 629147656,
+    629213188, 629278724, 629344260, 629409796, 629475332, 629540868, 629540872, 629606404,
+    629671940, 629737476, 629803012, 629803016, 629868548, 629934084, 629999620, 630065156,
+    630130692, 630196228, 630261764, 630327300, 630392836, 630458372, 630523908, 630589444,
+    630654980, 630720516, 630786052, 630851588, 630917124, 630982660, 631048196, 631113732,
+    631179268, 631179280, 631244804, 631244816, 631310340, 631310352, 631375876, 631375888,
+    631441412, 631441424, 631506948, 631506960, 631572484, 631572496, 631638020, 631638032,
+    631703556, 631703568, 631769092, 631769104, 631834628, 631834640, 631900164, 631900176,
+    631965700, 631965712, 632031236, 632031248, 632096772, 632096784, 632162308, 632162320,
+    632227844, 632227856, 632293380, 632293392, 632358916, 632358928, 632424452, 632424464,
+    632489988, 632490000, 632555524, 632555536, 632621060, 632621072, 632686596, 632686608,
+    632752132, 632752144, 632817668, 632817680, 632883204, 632883216, 632883240, 632948740,
+    632948752, 633014276, 633014288, 633079812, 633079824, 633145348, 633145360, 633210884,
+    633210896, 633276420, 633276432, 633341956, 633341968, 633407492, 633407504, 633473028,
+    633473040, 633538564, 633538576, 633604100, 633604112, 633669636, 633669648, 633735172,
+    633735184, 633800708, 633800720, 633866244, 633866256, 633931780, 633931792, 633997316,
+    633997328, 634062852, 634062864, 634128388, 634128400, 634193924, 634193936, 634259460,
+    634259472, 634324996, 634325008, 634390532, 634390544, 634456068, 634456080, 634521604,
+    634521616, 634587140, 634587152, 634652676, 634652688, 634718212, 634718224, 634783748,
+    634783760, 634849284, 634849296, 634914820, 634914832, 634980356, 634980368, 635045892,
+    635045904, 635111428, 635111440, 635176964, 635176976, 635242500, 635242512, 635308036,
+    635308048, 635373572, 635373584, 635439108, 635439120, 635504644, 635504656, 635570180,
+    635570192, 635635716, 635635728, 635701252, 635701264, 635766788, 635766800, 635832324,
+    635832336, 635897860, 635897872, 635963396, 635963408, 636028932, 636028944, 636094468,
+    636094480, 636160004, 636160016, 636225540, 636225552, 636291076, 636291088, 636356612,
+    636356624, 636422148, 636422160, 636487684, 636487696, 636553220, 636553232, 636618756,
+    636618768, 636684292, 636684304, 636749828, 636749840, 636815364, 636815376, 636880900,
+    636946436, 636946448, 637011972, 637011984, 637077508, 637077520, 637143044, 637143056,
+    637143048, 639109128, 637208580, 637208592, 637274116, 637274128, 637339652, 637339664,
+    637405188, 637405200, 637470724, 637470736, 637536260, 637536272, 637601796, 637601808,
+    637667332, 637667344, 637732868, 637732880, 637798404, 637798416, 637863940, 637863952,
+    637929476, 637929488, 637995012, 637995024, 638060548, 638060560, 638126084, 638126096,
+    638126088, 637143048, 638126088, 637536264, 638126088, 637667336, 638126088, 638322696,
+    638191620, 638191632, 638257156, 638322692, 638322704, 638388228, 638388240, 638453764,
+    638453776, 638519300, 638519312, 638584836, 638584848, 638650372, 638650384, 638715908,
+    638715920, 638781444, 638781456, 638846980, 638846992, 638846984, 638322696, 638912516,
+    638912528, 638978052, 638978064, 639043588, 639043600, 639109124, 639109136, 639174660,
+    639174672, 639240196, 639240208, 639305732, 639305744, 639371268, 639371280, 639436804,
+    639502340, 639502344, 639502346, 639502340, 5700, 639502340, 5764, 639502340,
+    6084, 639502344, 640223240, 639567876, 639567880, 639567876, 6084, 639567876,
+    6148, 639633412, 639633416, 639633412, 6084, 639698948, 639698952, 639698954,
+    639698948, 6084, 639764484, 639764490, 639764484, 6084, 639830020, 639830020,
+    5828, 639830020, 6084, 639830024, 639830024, 639830024, 640092168, 639895556,
+    639895556, 6084, 639961092, 640026628, 640026628, 6084, 640092164, 640092164,
+    5508, 640092164, 6084, 640092168, 639764488, 639830024, 639764488, 640092168,
+    640092168, 640092168, 640092168, 5700, 640157700, 640157706, 640157746, 640157700,
+    6084, 640157746, 6084, 640157700, 6148, 640223236, 640223242, 640223236,
+    6084, 640288772, 640288778, 640288818, 640288772, 6084, 640354308, 640354354,
+    640354308, 6084, 640419844, 640419844, 6084, 640485380, 640485386, 640550916,
+    640550962, 640550916, 6084, 640550962, 6084, 640550916, 6148, 640616452,
+    640616498, 640616452, 6084, 640681988, 640681988, 6084, 640747524, 640747530,
+    640747524, 6084, 640813060, 640813060, 5956, 640813060, 6020, 640813060,
+    6084, 640813060, 6084, 5956, 640813060, 6084, 6020, 640878596,
+    640878602, 640878596, 6084, 640944132, 641009668, 641075204, 641140740, 641206276,
+    641271812, 641337348, 641402884, 641468420, 641533956, 641599492, 641665028, 641730564,
+    641796100, 641861636, 641927172, 641992708, 642058244, 642123780, 642189316, 642254852,
+    642320388, 642385924, 642451460, 642516996, 642582532, 642648068, 642713604, 642779140,
+    642844676, 642910212, 642975748, 643041284, 643106820, 643172356, 643237892, 643303428,
+    643368964, 643434500, 643500036, 643565572, 643631108, 643696644, 643762180, 643827716,
+    643893252, 643958788, 644024324, 644089860, 644089864, 644089908, 644089864, 17992,
+    644155396, 644155442, 644155444, 644220932, 644220978, 644220980, 644286468, 644352004,
+    644352050, 644352052, 644417540, 644417586, 644417588, 644483076, 644483122, 644483124,
+    644548612, 644614148, 644679684, 644745220, 644745262, 644745264, 644745266, 644745268,
+    644745266, 645007410, 644745268, 645007412, 644745262, 646907950, 644745268, 646907956,
+    644745262, 647563310, 644745268, 647563316, 644745262, 647628846, 644745266, 649267250,
+    644745266, 649332786, 644745262, 655624238, 644745264, 655624240, 644745266, 655624242,
+    644745268, 655624244, 644745266, 655886386, 644745262, 656541742, 644745264, 656541744,
+    644745266, 656869426, 644745268, 656869428, 644745266, 656934962, 644745268, 656934964,
+    644745266, 657131570, 644745268, 657131572, 644745266, 657197106, 644745268, 657197108,
+    644745266, 657262642, 644745268, 657262644, 644745262, 657852462, 644745266, 657852466,
+    644745268, 657852468, 644745266, 657918002, 644745268, 657918004, 644745262, 658180142,
+    644745266, 658180146, 644745268, 658180148, 644810756, 644876292, 644941828, 645007364,
+    645007368, 645007370, 645007410, 645007412, 645007410, 7026, 645007412, 7028,
+    645007368, 644089864, 645007412, 653658164, 645138484, 649267252, 645007412, 655099956,
+    655099956, 656541748, 645072900, 645072906, 645138436, 645138442, 645138478, 645138480,
+    645138482, 645138484, 645138478, 646907950, 645138484, 646907956, 645138478, 647563310,
+    645138484, 647563316, 645138482, 647563314, 657918002, 645138478, 647628846, 645138484,
+    647628852, 645138482, 647628850, 657918002, 645138482, 649267250, 645138482, 649332786,
+    645138478, 655624238, 645138480, 655624240, 645138482, 655624242, 645138484, 655624244,
+    645138482, 655886386, 645138478, 656541742, 645138480, 656541744, 645138482, 657852466,
+    645138484, 657852468, 645138482, 657918002, 645138484, 657918004, 645203972, 645204014,
+    645204016, 645204018, 645204020, 645269508, 645269550, 645269552, 645269554, 645269556,
+    645335044, 645335086, 645335088, 645335090, 645335092, 645400580, 645466116, 645531652,
+    645597188, 645662724, 645728260, 645793796, 645859332, 645924868, 645990404, 646055940,
+    646121476, 646187012, 646187058, 646187060, 646252548, 646252554, 646252590, 646252592,
+    646252594, 646252596, 646252590, 646907950, 646252596, 646907956, 646252590, 646907950,
+    655624238, 646252594, 646907954, 657852466, 646252594, 646907954, 657918002, 646252590,
+    647563310, 646252596, 647563316, 646252590, 647563310, 646907950, 646252594, 647563314,
+    646907954, 646252590, 647563310, 655624238, 646252590, 647628846, 646252596, 647628852,
+    646252590, 647628846, 655624238, 646252594, 647628850, 657852466, 646252594, 647628850,
+    657918002, 646252594, 649267250, 646252594, 649332786, 646252590, 655624238, 646252592,
+    655624240, 646252594, 655624242, 646252596, 655624244, 646252590, 655624238, 646907950,
+    646252590, 655624238, 647563310, 646252590, 655624238, 647628846, 646252594, 655624242,
+    657852466, 646252594, 655624242, 657918002, 646252594, 655886386, 646252590, 656541742,
+    646252592, 656541744, 646252594, 657852466, 646252596, 657852468, 646252594, 657918002,
+    646252596, 657918004, 646318084, 646318090, 646318126, 646318128, 646318130, 646318132,
+    646318132, 646907956, 646318130, 649267250, 646318130, 649332786, 646318126, 655624238,
+    646318128, 655624240, 646318130, 655624242, 646318132, 655624244, 646318130, 655886386,
+    646318128, 656541744, 646318130, 657852466, 646318132, 657852468, 646318130, 657918002,
+    646318132, 657918004, 646383620, 646383662, 646383664, 646383666, 646383668, 646449156,
+    646449198, 646449200, 646449202, 646449204, 646514692, 646580228, 646645764, 646645806,
+    646645808, 646645810, 646645812, 646711300, 646776836, 646842372, 646907908, 646907914,
+    646907950, 646907952, 646907954, 646907956, 646907950, 647563310, 646907956, 647563316,
+    646907954, 647563314, 657852466, 646907954, 647563314, 657918002, 646907956, 655099956,
+    34146357, 646907956, 655099956, 645007412, 655099956, 656541748, 646907950, 655624238,
+    646907956, 655624244, 646907950, 655624238, 647563310, 646907954, 655624242, 647563314,
+    646907954, 655624242, 657852466, 646907954, 655624242, 657918002, 646907954, 657852466,
+    646907956, 657852468, 646907954, 657918002, 646907956, 657918004, 646973444, 646973486,
+    646973488, 646973490, 646973492, 647038980, 647039022, 647039024, 647039026, 647039028,
+    647104516, 647104558, 647104560, 647104562, 647104564, 647170052, 647235588, 647235630,
+    647235632, 647235634, 647235636, 647301124, 647366660, 647432196, 647497732, 647563268,
+    647563274, 647563310, 647563312, 647563314, 647563316, 647563310, 646907950, 647563316,
+    646907956, 647563314, 646907954, 657918002, 647563310, 655624238, 647563316, 655624244,
+    647563314, 655624242, 657852466, 647563314, 655624242, 657918002, 647563314, 657852466,
+    647563316, 657852468, 647563314, 657918002, 647563316, 657918004, 647628804, 647628810,
+    647628846, 647628848, 647628850, 647628852, 647628846, 646907950, 647628852, 646907956,
+    647628852, 647563316, 647628846, 655624238, 647628852, 655624244, 647628850, 657852466,
+    647628852, 657852468, 647628850, 657918002, 647628852, 657918004, 647694340, 647759876,
+    647825412, 647890948, 647956484, 648022020, 648087556, 648153092, 648218628, 648284164,
+    648284170, 648284210, 648284212, 648349700, 648349706, 648349746, 648349748, 648349748,
+    9780, 648415236, 648415282, 648415284, 648480772, 648546308, 648611844, 648677380,
+    648677426, 648677428, 648742916, 648742962, 648742964, 648808452, 648873988, 648874034,
+    648874036, 648939524, 649005060, 649070596, 649136132, 649201668, 649267204, 649267210,
+    649267250, 649267252, 649267252, 9780, 649267252, 650512436, 656934964, 655099956,
+    649267252, 657983540, 645007412, 655099956, 649332740, 649332746, 649332786, 649332788,
+    649398276, 649398322, 649398324, 649463812, 649529348, 649594884, 649660420, 649725956,
+    649791492, 649857028, 649857074, 649857076, 649922564, 649988100, 650053636, 650119172,
+    650184708, 650250244, 650315780, 650381316, 650446852, 650512388, 650512394, 650512430,
+    650512432, 650512434, 650512436, 650512430, 646907950, 650512432, 646907952, 650512436,
+    646907956, 650512430, 646907950, 647563310, 650512434, 646907954, 657852466, 650512430,
+    647563310, 650512432, 647563312, 650512436, 647563316, 650512430, 647563310, 646907950,
+    650512430, 647628846, 650512432, 647628848, 650512436, 647628852, 650512434, 647628850,
+    657852466, 650512434, 647628850, 657918002, 650512434, 649267250, 650512436, 649267252,
+    650512430, 655624238, 650512432, 655624240, 650512436, 655624244, 650512430, 655624238,
+    646907950, 650512430, 655624238, 647563310, 650512434, 655624242, 647563314, 650512430,
+    655624238, 655624238, 650512434, 655624242, 655624242, 650512430, 656541742, 650512432,
+    656541744, 650512434, 657852466, 650512436, 657852468, 650512434, 657918002, 650512436,
+    657918004, 650577924, 650577930, 650577966, 650577968, 650577970, 650577972, 650577966,
+    646907950, 650577968, 646907952, 650577970, 646907954, 650577972, 646907956, 650577970,
+    646907954, 657918002, 650577966, 647563310, 650577968, 647563312, 650577970, 647563314,
+    650577972, 647563316, 650577966, 647563310, 655624238, 650577970, 647563314, 655624242,
+    650577970, 647563314, 657918002, 650577966, 647628846, 650577968, 647628848, 650577970,
+    647628850, 650577972, 647628852, 650577970, 649267250, 650577972, 649267252, 650577966,
+    655624238, 650577968, 655624240, 650577970, 655624242, 650577972, 655624244, 650577966,
+    655624238, 647628846, 650577970, 655624242, 647628850, 650577966, 655624238, 655624238,
+    650577970, 655624242, 655624242, 650577966, 656541742, 650577968, 656541744, 650577970,
+    657852466, 650577972, 657852468, 650577970, 657918002, 650577972, 657918004, 650643460,
+    650708996, 650774532, 650840068, 650905604, 650971140, 651036676, 651102212, 651167748,
+    651233284, 651233290, 651233326, 651233328, 651233330, 651233332, 651233326, 647563310,
+    651233332, 647563316, 651233326, 647563310, 647563310, 651233330, 647563314, 647563314,
+    651233330, 647563314, 657918002, 651233326, 647628846, 651233330, 649267250, 651233332,
+    649267252, 651233332, 655099956, 651888692, 655624244, 651233332, 655099956, 657852468,
+    651233332, 655099956, 657852468, 34146357, 645007412, 655099956, 655099956, 656541748,
+    34146357, 651888692, 655099956, 657918004, 656541748, 34146357, 656934964, 650512436,
+    655099956, 655624244, 651233332, 655099956, 658835508, 651233326, 655624238, 651233332,
+    655624244, 651233326, 655624238, 655624238, 651233330, 655624242, 655624242, 651233330,
+    657852466, 651233332, 657852468, 651233330, 657918002, 651233332, 657918004, 651298820,
+    651298826, 651298862, 651298864, 651298866, 651298868, 651298862, 646907950, 651298868,
+    646907956, 651298862, 647563310, 651298868, 647563316, 651298866, 647563314, 657852466,
+    651298866, 647563314, 657918002, 651298862, 647628846, 651298868, 647628852, 651298862,
+    647628846, 655624238, 651298866, 647628850, 655624242, 651298866, 649267250, 651298868,
+    649267252, 651298862, 655624238, 651298868, 655624244, 651298866, 657852466, 651298868,
+    657852468, 651298866, 657918002, 651298868, 657918004, 651364356, 651429892, 651495428,
+    651560964, 651626500, 651626506, 651626542, 651626544, 651626546, 651626548, 651626542,
+    647563310, 651626548, 647563316, 651626542, 655624238, 651626544, 655624240, 651626548,
+    655624244, 651626542, 655624238, 647563310, 651626546, 655624242, 647563314, 651626542,
+    655624238, 655624238, 651626546, 655624242, 657918002, 651626546, 657852466, 651626548,
+    657852468, 651626546, 657918002, 651626548, 657918004, 651692036, 651692042, 651692078,
+    651692080, 651692082, 651692084, 651692078, 655624238, 651692080, 655624240, 651692084,
+    655624244, 651757572, 651823108, 651888644, 651888650, 651888686, 651888688, 651888690,
+    651888692, 651888686, 646907950, 651888692, 646907956, 651888686, 646907950, 655624238,
+    651888690, 646907954, 655624242, 651888692, 655099956, 657918004, 656541748, 651888686,
+    655624238, 651888692, 655624244, 651888686, 655624238, 655624238, 651888690, 655624242,
+    655624242, 651888690, 655624242, 657852466, 651888690, 655624242, 657918002, 651888690,
+    657852466, 651888692, 657852468, 651888690, 657918002, 651888692, 657918004, 651954180,
+    651954186, 651954222, 651954224, 651954226, 651954228, 651954222, 646907950, 651954228,
+    646907956, 651954222, 655624238, 651954228, 655624244, 651954226, 655624242, 655624242,
+    651954226, 655624242, 657852466, 651954226, 655624242, 657918002, 651954226, 657852466,
+    651954228, 657852468, 651954226, 657918002, 651954228, 657918004, 652019716, 652085252,
+    652150788, 652216324, 652281860, 652347396, 652412932, 652478468, 652478474, 652478510,
+    652478512, 652478514, 652478516, 652478510, 646907950, 652478516, 646907956, 652478510,
+    647563310, 652478516, 647563316, 652478510, 647628846, 652478516, 647628852, 652478510,
+    647628846, 655624238, 652478514, 647628850, 655624242, 652478510, 655624238, 652478516,
+    655624244, 652478514, 655624242, 657918002, 652478514, 657852466, 652478516, 657852468,
+    652478514, 657918002, 652478516, 657918004, 652544004, 652544010, 652609540, 652675076,
+    652740612, 652806148, 652806190, 652806192, 652806194, 652806196, 652871684, 652937220,
+    653002756, 653002798, 653002800, 653002802, 653002804, 653068292, 653133828, 653199364,
+    653199370, 653264900, 653264906, 653264942, 653264944, 653264946, 653264948, 653264942,
+    647563310, 653264948, 647563316, 653264948, 655099956, 658835508, 653264942, 655624238,
+    653264948, 655624244, 653264942, 655624238, 647563310, 653264946, 655624242, 647563314,
+    653264946, 655624242, 655624242, 653264946, 655624242, 657918002, 653264946, 657852466,
+    653264948, 657852468, 653264946, 657918002, 653264948, 657918004, 653330436, 653395972,
+    653461508, 653527044, 653592580, 653658116, 653658122, 653658158, 653658160, 653658162,
+    653658164, 653658162, 645007410, 653658164, 645007412, 653658158, 646907950, 653658164,
+    646907956, 653658158, 647563310, 653658164, 647563316, 653658158, 647628846, 653658164,
+    647628852, 653658158, 655099950, 653658160, 655099952, 653658162, 655099954, 653658164,
+    655099956, 653658158, 655624238, 653658160, 655624240, 653658162, 655624242, 653658164,
+    655624244, 653658158, 655624238, 655624238, 653658162, 655624242, 655624242, 653658162,
+    655624242, 657918002, 653658162, 657852466, 653658164, 657852468, 653658162, 657918002,
+    653658164, 657918004, 653723652, 653723694, 653723696, 653723698, 653723700, 653789188,
+    653854724, 653920260, 653985796, 654051332, 654051374, 654051376, 654051378, 654051380,
+    654116868, 654182404, 654247940, 654247982, 654247984, 654247986, 654247988, 654313476,
+    654379012, 654444548, 654444590, 654444592, 654444594, 654444596, 654510084, 654575620,
+    654575662, 654575664, 654575666, 654575668, 654641156, 654706692, 654772228, 654837764,
+    654903300, 654968836, 655034372, 655099908, 655099914, 655099950, 655099952, 655099954,
+    655099956, 655099954, 644155442, 655099956, 644155444, 655099954, 644220978, 655099956,
+    644220980, 655099954, 644483122, 655099956, 644483124, 655099954, 645007410, 655099956,
+    645007412, 655099950, 646907950, 655099956, 646907956, 655099950, 646907950, 646907950,
+    655099954, 646907954, 646907954, 655099950, 646907950, 655624238, 655099954, 646907954,
+    655624242, 655099954, 646907954, 657918002, 655099950, 647563310, 655099956, 647563316,
+    655099950, 647563310, 655624238, 655099954, 647563314, 655624242, 655099954, 647563314,
+    657852466, 655099954, 647563314, 657918002, 655099950, 647628846, 655099956, 647628852,
+    655099950, 647628846, 655624238, 655099954, 647628850, 655624242, 655099950, 655624238,
+    655099952, 655624240, 655099954, 655624242, 655099956, 655624244, 655099950, 655624238,
+    647563310, 655099954, 655624242, 647563314, 655099954, 655624242, 657918002, 655099950,
+    656541742, 655099954, 657852466, 655099956, 657852468, 655099954, 657918002, 655099956,
+    657918004, 655165444, 655230980, 655296516, 655362052, 655427588, 655493124, 655558660,
+    655624196, 655624202, 655624238, 655624240, 655624242, 655624244, 655624200, 17992,
+    655624242, 645007410, 655624238, 646907950, 655624244, 646907956, 655624238, 646907950,
+    647563310, 655624238, 646907950, 647628846, 655624238, 646907950, 655624238, 655624242,
+    646907954, 657918002, 655624238, 647563310, 655624244, 647563316, 655624238, 647563310,
+    646907950, 655624238, 647563310, 655624238, 655624244, 647563316, 655624244, 648284212,
+    655624242, 647563314, 657918002, 655624238, 647628846, 655624244, 647628852, 655624238,
+    647628846, 646907950, 655624238, 647628846, 655624238, 655624242, 647628850, 657918002,
+    655624238, 655624238, 655624242, 655624242, 655624244, 655624244, 655624242, 655624242,
+    657918002, 655624244, 657852468, 655624244, 657918004, 655689732, 655755268, 655820804,
+    655886340, 655886346, 655886382, 655886384, 655886386, 655886388, 655886382, 646907950,
+    655886388, 646907956, 655886382, 646907950, 647563310, 655886386, 646907954, 647563314,
+    655886382, 646907950, 655624238, 655886386, 646907954, 655624242, 655886386, 646907954,
+    657852466, 655886386, 646907954, 657918002, 655886382, 647563310, 655886388, 647563316,
+    655886382, 647563310, 655624238, 655886386, 647563314, 657852466, 655886386, 647563314,
+    657918002, 655886382, 647628846, 655886388, 647628852, 655886386, 649267250, 655886386,
+    649332786, 655886382, 655624238, 655886384, 655624240, 655886386, 655624242, 655886388,
+    655624244, 655886386, 655624242, 657852466, 655886386, 655624242, 657918002, 655886386,
+    655886386, 655886382, 656541742, 655886384, 656541744, 655886386, 657852466, 655886388,
+    657852468, 655886386, 657918002, 655886388, 657918004, 655951876, 655951882, 655951922,
+    655951924, 656017412, 656082948, 656082990, 656082992, 656082994, 656082996, 656148484,
+    656214020, 656279556, 656345092, 656410628, 656476164, 656541700, 656541706, 656541742,
+    656541744, 656541746, 656541748, 656541742, 9774, 656541742, 646907950, 656541748,
+    646907956, 656541742, 655624238, 656541748, 655624244, 656541742, 655624238, 646907950,
+    656541742, 655624238, 655624238, 656541748, 657852468, 656541748, 657918004, 656607236,
+    656607278, 656607280, 656607282, 656607284, 656672772, 656672814, 656672816, 656672818,
+    656672820, 656672772, 8388, 656738308, 656803844, 656869380, 656869380, 8388,
+    656869426, 8434, 656869428, 8436, 656934916, 656934920, 656934922, 656934962,
+    656934964, 656934920, 644089864, 656934964, 650512436, 655099956, 655624244, 657000452,
+    657065988, 657066034, 657066036, 657131524, 657131570, 657131572, 657197060, 657197106,
+    657197108, 657197064, 644089864, 657197108, 644089908, 657262596, 657262642, 657262644,
+    657328132, 657328178, 657328180, 657393668, 657459204, 657459250, 657459252, 657524740,
+    657590276, 657655812, 657721348, 657786884, 657852420, 657852462, 657852464, 657852466,
+    657852468, 657852466, 9778, 657852468, 9780, 657917956, 657917960, 657917962,
+    657917998, 657918000, 657918002, 657918004, 657917960, 644089864, 657917998, 646907950,
+    657918004, 646907956, 657918002, 646907954, 657918002, 657917998, 647563310, 657918004,
+    647563316, 657918002, 647563314, 657918002, 657917998, 647628846, 657918004, 647628852,
+    657918002, 649267250, 657918002, 649332786, 657917998, 655624238, 657918000, 655624240,
+    657918002, 655624242, 657918004, 655624244, 657917998, 655624238, 655624238, 657918002,
+    655624242, 655624242, 657918002, 655624242, 657918002, 657918002, 655886386, 657917998,
+    656541742, 657918000, 656541744, 657918002, 657852466, 657918004, 657852468, 657918002,
+    657918002, 657918004, 657918004, 657983492, 657983534, 657983536, 657983538, 657983540,
+    658049028, 658114564, 658180100, 658180142, 658180144, 658180146, 658180148, 658245636,
+    658311172, 658376708, 658442244, 658507780, 658573316, 658638852, 658704388, 658769924,
+    658835460, 658835506, 658835508, 658835460, 8388, 658835506, 8434, 658835508,
+    8436, 658900996, 658966532, 659032068, 659097604, 659097608, 18056, 659163140,
+    659163144, 17992, 659163144, 18056, 659228676, 659294212, 659294216, 18056,
+    659359748, 659425284, 659490820, 659556356, 659621892, 659687428, 659687432, 17992,
+    659752964, 659818500, 659884036, 659949572, 660015108, 660080644, 660146180, 660211716,
+    660211762, 660277252, 660342788, 660342792, 17992, 660408324, 660473860, 660539396,
+    660604932, 660670468, 660736004, 660801540, 660867076, 660932612, 660998148, 661063684,
+    661129220, 661194756, 661260292, 661325828, 661391364, 661456900, 661522436, 661587972,
+    661653508, 661719044, 661784580, 661850116, 661915652, 661981188, 662046724, 662112260,
+    662177796, 662243332, 662308868, 662374404, 662439940, 662505476, 662571012, 662636548,
+    662702084, 662767620, 662833156, 662898692, 662964228, 663029764, 663095300, 663160836,
+    663226372, 663291908, 663357444, 663422980, 663488516, 663554052, 663619588, 663685124,
+    663750660, 663816196, 663881732, 663947268, 664012804, 664078340, 664143876, 664209412,
+    664274948, 664340484, 664406020, 664471556, 664537092, 664602628, 664668164, 664733700,
+    664799236, 664864772, 664930308, 664995844, 665061380, 665126916, 665192452, 665257988,
+    665323524, 665389060, 665454596, 665520132, 665585668, 665651204, 665716740, 665782276,
+    665847812, 665913348, 665978884, 666044420, 666109956, 666175492, 666241028, 666306564,
+    666372100, 666437636, 666503172, 666568708, 666634244, 666699780, 666765316, 666830852,
+    666896388, 666961924, 667027460, 667092996, 667158532, 667224068, 667224072, 17928,
+    667289604, 667289608, 17928, 667355140, 667420676, 667420680, 17928, 667486212,
+    667551748, 667617284, 667682820, 667748356, 667813892, 667879428, 667944964, 668010500,
+    668076036, 668141572, 668207108, 668272644, 668338180, 668403716, 668469252, 668534788,
+    668600324, 668665860, 668731396, 668796932, 668862468, 668928004, 668993540, 669059076,
+    669124612, 669190148, 669255684, 669321220, 669386756, 669452292, 669517828, 669583364,
+    669648900, 669714436, 669779972, 669845508, 669911044, 669976580, 670042116, 670107652,
+    670173188, 670238724, 670304260, 670369796, 670435332, 670500868, 670566404, 670631940,
+    670697476, 670763012, 670828548, 670894084, 670959620, 671025156, 671090692, 671156228,
+    671221764, 671287300, 671352836, 671418372, 671483908, 671549444, 671614980, 671680516,
+    671746052, 671811588, 671877124, 671942660, 672008196, 672073732, 672139268, 672204804,
+    672270340, 672335876, 672401412, 672466948, 672532484, 672598020, 672663556, 672729092,
+    672794628, 672860164, 672925700, 672991236, 673056772, 673122308, 673187844, 673253380,
+    673318916, 673384452, 673449988, 673515524, 673581060, 673646596, 673712132, 673777668,
+    673843204, 673908740, 673974276, 674039812, 674105348, 674170884, 674236420, 674301956,
+    674367492, 674433028, 674498564, 674564100, 674629636, 674695172, 674760708, 674826244,
+    674891780, 674957316, 675022852, 675088388, 675153924, 675219460, 675284996, 675350532,
+    675416068, 675481604, 675547140, 675612676, 675678212, 675743748, 675809284, 675874820,
+    675940356, 676005892, 676071428, 676136964, 676202500, 676268036, 676333572, 676399108,
+    676464644, 676530180, 676595716, 676661252, 676726788, 676792324, 676857860, 676923396,
+    676988932, 677054468, 677120004, 677185540, 677251076, 677316612, 677382148, 677447684,
+    677513220, 677578756, 677644292, 677709828, 677775364, 677840900, 677906436, 677971972,
+    678037508, 678103044, 678168580, 678234116, 678299652, 678365188, 678430724, 678496260,
+    678561796, 678627332, 678692868, 678758404, 678823940, 678889476, 678955012, 679020548,
+    679086084, 679151620, 679217156, 679282692, 679348228, 679413764, 679479300, 679544836,
+    679610372, 679675908, 679741444, 679806980, 679872516, 679938052, 680003588, 680069124,
+    680134660, 680200196, 680265732, 680331268, 680396804, 680462340, 680527876, 680593412,
+    680658948, 680724484, 680790020, 680855556, 680921092, 680986628, 681052164, 681117700,
+    681183236, 681248772, 681314308, 681379844, 681445380, 681510916, 681576452, 681641988,
+    681707524, 681773060, 681838596, 681904132, 681969668, 682035204, 682100740, 682166276,
+    682231812, 682297348, 682362884, 682428420, 682493956, 682559492, 682625028, 682690564,
+    682756100, 682821636, 682887172, 682952708, 683018244, 683083780, 683149316, 683214852,
+    683280388, 683345924, 683411460, 683476996, 683542532, 683608068, 683673604, 683739140,
+    683804676, 683870212, 683935748, 684001284, 684066820, 684132356, 684197892, 684263428,
+    684328964, 684394500, 684460036, 684525572, 684591108, 684656644, 684722180, 684787716,
+    684853252, 684918788, 684984324, 685049860, 685115396, 685180932, 685246468, 685312004,
+    685377540, 685443076, 685508612, 685574148, 685639684, 685705220, 685770756, 685836292,
+    685901828, 685967364, 686032900, 686098436, 686163972, 686229508, 686295044, 686360580,
+    686426116, 686491652, 686557188, 686622724, 686688260, 686753796, 686819332, 686884868,
+    686950404, 687015940, 687081476, 687147012, 687212548, 687278084, 687343620, 687409156,
+    687474692, 687540228, 687605764, 687671300, 687736836, 687802372, 687867908, 687933444,
+    687998980, 688064516, 688130052, 688195588, 688261124, 688326660, 688392196, 688457732,
+    688523268, 688588804, 688654340, 688719876, 688785412, 688850948, 688916484, 688982020,
+    689047556, 689113092, 689178628, 689244164, 689309700, 689375236, 689440772, 689506308,
+    689571844, 689637380, 689702916, 689768452, 689833988, 689899524, 689965060, 690030596,
+    690096132, 690161668, 690227204, 690292740, 690358276, 690423812, 690489348, 690554884,
+    690620420, 690685956, 690751492, 690817028, 690882564, 690948100, 691013636, 691079172,
+    691144708, 691210244, 691275780, 691341316, 691406852, 691472388, 691537924, 691603460,
+    691668996, 691734532, 691800068, 691865604, 691931140, 691996676, 692062212, 692127748,
+    692193284, 692258820, 692324356, 692389892, 692455428, 692520964, 692586500, 692652036,
+    692717572, 692783108, 692848644, 692914180, 692979716, 693045252, 693110788, 693176324,
+    693241860, 693307396, 693372932, 693438468, 693504004, 693569540, 693635076, 693700612,
+    693766148, 693831684, 693897220, 693962756, 694028292, 694093828, 694159364, 694224900,
+    694290436, 694355972, 694421508, 694487044, 694552580, 694618116, 694683652, 694749188,
+    694814724, 694880260, 694945796, 695011332, 695076868, 695142404, 695207940, 695273476,
+    695339012, 695404548, 695470084, 695535620, 695601156, 695666692, 695732228, 695797764,
+    695863300, 695928836, 695994372, 696059908, 696125444, 696190980, 696256516, 696322052,
+    696387588, 696453124, 696518660, 696584196, 696649732, 696715268, 696780804, 696846340,
+    696911876, 696977412, 697042948, 697108484, 697174020, 697239556, 697305092, 697370628,
+    697436164, 697501700, 697567236, 697632772, 697698308, 697763844, 697829380, 697894916,
+    697960452, 698025988, 698091524, 698157060, 698222596, 698288132, 698353668, 698419204,
+    698484740, 698550276, 698615812, 698681348, 698746884, 698812420, 698877956, 698943492,
+    699009028, 699074564, 699140100, 699205636, 699271172, 699336708, 699402244, 699467780,
+    699533316, 699598852, 699664388, 699729924, 699795460, 699860996, 699926532, 699992068,
+    700057604, 700123140, 700188676, 700254212, 700319748, 700385284, 700450820, 700516356,
+    700581892, 700647428, 700712964, 700778500, 700844036, 700909572, 700975108, 701040644,
+    701106180, 701171716, 701237252, 701302788, 701368324, 701433860, 701499396, 701564932,
+    701630468, 701696004, 701761540, 701827076, 701892612, 701958148, 702023684, 702089220,
+    702154756, 702220292, 702285828, 702351364, 702416900, 702482436, 702547972, 702613508,
+    702679044, 702744580, 702810116, 702875652, 702941188, 703006724, 703072260, 703137796,
+    703203332, 703268868, 703334404, 703399940, 703465476, 703531012, 703596548, 703662084,
+    703727620, 703793156, 703793156, 12420, 703858692, 703858692, 12420, 703924228,
+    703924228, 12420, 703989764, 704055300, 704120836, 704186372, 704251908, 704317444,
+    704317444, 12420, 704382980, 704448516, 704514052, 704579588, 704645124, 704710660,
+    704776196, 704841732, 704841732, 12420, 704907268, 704972804, 704972804, 12420,
+    705038340, 705103876, 705169412, 705234948, 705300484, 705366020, 705366020, 12420,
+    705431556, 705497092, 705497092, 12420, 705562628, 705628164, 705693700, 705759236,
+    705824772, 705824772, 12420, 705890308, 705955844, 705955844, 12420, 706021380,
+    706086916, 706086916, 12420, 706152452, 706217988, 706283524, 706349060, 706414596,
+    706480132, 706545668, 706611204, 706611208, 706676740, 706742276, 706807812, 706807816,
+    706873348, 706938884, 707004420, 707069956, 707135492, 707201028, 707266564, 707332100,
+    707397636, 707463172, 707528708, 707594244, 707659780, 707725316, 707790852, 707856388,
+    707921924, 707987460, 708052996, 708118532, 708184068, 708249604, 708315140, 708380676,
+    708446212, 708511748, 708577284, 708642820, 708708356, 708773892, 708839428, 708904964,
+    708970500, 709036036, 709101572, 709167108, 709232644, 709298180, 709363716, 709429252,
+    709494788, 709560324, 709625860, 709691396, 709756932, 709822468, 709888004, 709953540,
+    710019076, 710084612, 710150148, 710215684, 710281220, 710346756, 710412292, 710412292,
+    12420, 710477828, 710477828, 12420, 710543364, 710608900, 710608904, 712771592,
+    710674436, 710739972, 710805508, 710871044, 710936580, 711002116, 711067652, 711133188,
+    711198724, 711264260, 711264260, 12420, 711329796, 711395332, 711460868, 711526404,
+    711591940, 711657476, 711723012, 711788548, 711854084, 711919620, 711985156, 712050692,
+    712116228, 712181764, 712247300, 712312836, 712378372, 712443908, 712509444, 712574980,
+    712640516, 712706052, 712771588, 712837124, 712902660, 712968196, 713033732, 713099268,
+    713164804, 713230340, 713295876, 713361412, 713426948, 713492484, 713558020, 713623556,
+    713689092, 713754628, 713820164, 713820164, 12420, 713885700, 713951236, 714016772,
+    714082308, 714082308, 12420, 714147844, 714147844, 12420, 714213380, 714278916,
+    714344452, 714409988, 714475524, 714475524, 12420, 714541060, 714606596, 714672132,
+    714737668, 714803204, 714868740, 714934276, 714999812, 715065348, 715130884, 715196420,
+    715261956, 715327492, 715393028, 715393028, 12420, 715458564, 715524100, 715589636,
+    715655172, 715720708, 715786244, 715851780, 715851780, 12420, 715917316, 715982852,
+    716048388, 716113924, 716179460, 716244996, 716310532, 716376068, 716441604, 716507140,
+    716572676, 716638212, 716703748, 716769284, 716834820, 716900356, 716965892, 717031428,
+    717096964, 717162500, 717228036, 717293572, 717359108, 717424644, 717490180, 717555716,
+    717621252, 717686788, 717752324, 717817860, 717883396, 717948932, 718014468, 718080004,
+    718145540, 718211076, 718276612, 718342148, 718407684, 718473220, 718538756, 718604292,
+    718669828, 718735364, 718800900, 718866436, 718931972, 718997508, 719063044, 719128580,
+    719194116, 719259652, 719325188, 719390724, 719456260, 719521796, 719587332, 719652868,
+    719718404, 719783940, 719849476, 719915012, 719980548, 720046084, 720111620, 720177156,
+    720242692, 720308228, 720373764, 720439300, 720504836, 720570372, 720635908, 720701444,
+    720766980, 720832516, 720898052, 720963588, 721029124, 721094660, 721160196, 721225732,
+    721291268, 721356804, 721422340, 721487876, 721553412, 721618948, 721684484, 721750020,
+    721815556, 721881092, 721946628, 722012164, 722077700, 722143236, 722208772, 722274308,
+    722339844, 722405380, 722470916, 722536452, 722601988, 722667524, 722733060, 722798596,
+    722864132, 722929668, 722929668, 12420, 722995204, 722995204, 12420, 723060740,
+    723126276, 723191812, 723257348, 723322884, 723388420, 723453956, 723519492, 723585028,
+    723650564, 723716100, 723781636, 723847172, 723912708, 723978244, 724043780, 724109316,
+    724174852, 724240388, 724305924, 724371460, 724436996, 724502532, 724568068, 724633604,
+    724699140, 724764676, 724830212, 724895748, 724961284, 725026820, 725092356, 725157892,
+    725223428, 725288964, 725354500, 725420036, 725485572, 725551108, 725616644, 725682180,
+    725747716, 725813252, 725878788, 725944324, 726009860, 726075396, 726140932, 726206468,
+    726272004, 726337540, 726403076, 726468612, 726534148, 726599684, 726665220, 726730756,
+    726796292, 726861828, 726927364, 726992900, 727058436, 727123972, 727189508, 727255044,
+    727320580, 727386116, 727451652, 727517188, 727582724, 727648260, 727713796, 727779332,
+    727844868, 727910404, 727975940, 728041476, 728107012, 728172548, 728238084, 728303620,
+    728369156, 728434692, 728500228, 728565764, 728631300, 728696836, 728762372, 728827908,
+    728893444, 728958980, 729024516, 729090052, 729155588, 729221124, 729286660, 729352196,
+    729417732, 729483268, 729548804, 729614340, 729679876, 729745412, 729810948, 729876484,
+    729942020, 730007556, 730073092, 730138628, 730204164, 730269700, 730335236, 730400772,
+    730466308, 730531844, 730597380, 730662916, 730728452, 730793988, 730859524, 730925060,
+    730990596, 731056132, 731121668, 731187204, 731252740, 731318276, 731383812, 731449348,
+    731514884, 731580420, 731645956, 731711492, 731777028, 731842564, 731908100, 731973636,
+    732039172, 732104708, 732170244, 732235780, 732301316, 732366852, 732432388, 732497924,
+    732563460, 732628996, 732694532, 732760068, 732825604, 732891140, 732956676, 733022212,
+    733087748, 733153284, 733218820, 733284356, 733349892, 733415428, 733480964, 733546500,
+    733612036, 733677572, 733743108, 733808644, 733874180, 733939716, 734005252, 734070788,
+    734136324, 734201860, 734267396, 734332932, 734398468, 734464004, 734529540, 734595076,
+    734660612, 734726148, 734791684, 734857220, 734922756, 734988292, 735053828, 735119364,
+    735184900, 735250436, 735315972, 735381508, 735447044, 735512580, 735578116, 735643652,
+    735709188, 735774724, 735840260, 735905796, 735971332, 736036868, 736102404, 736167940,
+    736233476, 736299012, 736364548, 736430084, 736495620, 736561156, 736626692, 736692228,
+    736757764, 736823300, 736888836, 736954372, 737019908, 737085444, 737150980, 737216516,
+    737282052, 737347588, 737413124, 737478660, 737544196, 737609732, 737675268, 737740804,
+    737806340, 737871876, 737937412, 738002948, 738068484, 738134020, 738199556, 738265092,
+    738330628, 738396164, 738461700, 738527236, 738592772, 738658308, 738723844, 738789380,
+    738854916, 738920452, 738985988, 739051524, 739117060, 739182596, 739248132, 739313668,
+    739379204, 739444740, 739510276, 739575812, 739641348, 739706884, 739706888, 743376904,
+    739772420, 739837956, 739903492, 739969028, 740034564, 740100100, 740165636, 740231172,
+    740296708, 740362244, 740427780, 740493316, 740558852, 740624388, 740624392, 743376904,
+    740689924, 740755460, 740820996, 740886532, 740952068, 740952072, 743376904, 741017604,
+    741083140, 741148676, 741214212, 741279748, 741345284, 741345288, 743376904, 741410820,
+    741410824, 743376904, 741476356, 741476360, 743376904, 741541892, 741541896, 743376904,
+    741607428, 741672964, 741738500, 741804036, 741869572, 741935108, 741935112, 743376904,
+    742000644, 742000648, 743376904, 742066180, 742131716, 742197252, 742262788, 742328324,
+    742393860, 742459396, 742524932, 742590468, 742656004, 742721540, 742787076, 742852612,
+    742918148, 742983684, 743049220, 743114756, 743180292, 743245828, 743311364, 743376900,
+    743376904, 743442436, 743507972, 743573508, 743639044, 743704580, 743770116, 743835652,
+    743901188, 743966724, 744032260, 744097796, 744163332, 744228868, 744294404, 744359940,
+    744425476, 744491012, 744556548, 744622084, 744687620, 744753156, 744818692, 744884228,
+    744949764, 745015300, 745080836, 745146372, 745211908, 745277444, 745342980, 745408516,
+    745474052, 745539588, 745605124, 745670660, 745736196, 745801732, 745867268, 745932804,
+    745998340, 746063876, 746129412, 746194948, 746260484, 746326020, 746391556, 746457092,
+    746522628, 746588164, 746653700, 746719236, 746784772, 746850308, 746915844, 746981380,
+    747046916, 747112452, 747177988, 747243524, 747309060, 747374596, 747440132, 747505668,
+    747571204, 747636740, 747702276, 747767812, 747833348, 747898884, 747964420, 748029956,
+    748095492, 748161028, 748226564, 748292100, 748357636, 748423172, 748488708, 748554244,
+    748619780, 748685316, 748750852, 748816388, 748881924, 748947460, 749012996, 749078532,
+    749144068, 749209604, 749275140, 749340676, 749406212, 749471748, 749537284, 749602820,
+    749668356, 749733892, 749799428, 749864964, 749930500, 749996036, 750061572, 750127108,
+    750192644, 750258180, 750323716, 750389252, 750454788, 750520324, 750585860, 750651396,
+    750716932, 750782468, 750848004, 750913540, 750979076, 751044612, 751110148, 751175684,
+    751241220, 751306756, 751372292, 751437828, 751503364, 751568900, 751634436, 751699972,
+    751765508, 751831044, 751896580, 751962116, 752027652, 752093188, 752158724, 752224260,
+    752289796, 752355332, 752420868, 752486404, 752551940, 752617476, 752683012, 752748548,
+    752814084, 752879620, 752945156, 753010692, 753076228, 753141764, 753207300, 753272836,
+    753338372, 753403908, 753469444, 753534980, 753600516, 753666052, 753731588, 753797124,
+    753862660, 753928196, 753993732, 754059268, 754124804, 754190340, 754255876, 754321412,
+    754386948, 754452484, 754518020, 754583556, 754649092, 754714628, 754780164, 754845700,
+    754911236, 754976772, 755042308, 755107844, 755173380, 755238916, 755304452, 755369988,
+    755435524, 755501060, 755566596, 755632132, 755697668, 755763204, 755828740, 755894276,
+    755959812, 756025348, 756090884, 756156420, 756221956, 756287492, 756353028, 756418564,
+    756484100, 756549636, 756615172, 756680708, 756746244, 756811780, 756877316, 756942852,
+    757008388, 757073924, 757139460, 757204996, 757270532, 757336068, 757401604, 757467140,
+    757532676, 757598212, 757663748, 757729284, 757794820, 757860356, 757925892, 757991428,
+    758056964, 758122500, 758188036, 758253572, 758319108, 758384644, 758450180, 758515716,
+    758581252, 758646788, 758712324, 758777860, 758843396, 758908932, 758974468, 759040004,
+    759105540, 759171076, 759236612, 759302148, 759367684, 759433220, 759498756, 759564292,
+    759629828, 759695364, 759760900, 759826436, 759891972, 759957508, 760023044, 760088580,
+    760154116, 760219652, 760285188, 760350724, 760416260, 760481796, 760547332, 760612868,
+    760678404, 760743940, 760809476, 760875012, 760940548, 761006084, 761071620, 761071620,
+    12420, 761137156, 761137156, 12420, 761202692, 761268228, 761333764, 761399300,
+    761464836, 761530372, 761595908, 761661444, 761726980, 761726980, 12420, 761792516,
+    761858052, 761923588, 761989124, 762054660, 762120196, 762185732, 762251268, 762316804,
+    762382340, 762447876, 762513412, 762578948, 762644484, 762710020, 762775556, 762841092,
+    762906628, 762972164, 763037700, 763103236, 763168772, 763234308, 763299844, 763365380,
+    763430916, 763496452, 763561988, 763627524, 763693060, 763758596, 763824132, 763889668,
+    763955204, 764020740, 764086276, 764151812, 764217348, 764282884, 764348420, 764413956,
+    764479492, 764545028, 764610564, 764676100, 764741636, 764807172, 764872708, 764938244,
+    765003780, 765069316, 765134852, 765200388, 765265924, 765331460, 765396996, 765462532,
+    765528068, 765593604, 765659140, 765724676, 765790212, 765855748, 765921284, 765986820,
+    766052356, 766117892, 766183428, 766248964, 766314500, 766380036, 766445572, 766511108,
+    766576644, 766642180, 766707716, 766773252, 766838788, 766904324, 766969860, 767035396,
+    767100932, 767166468, 767232004, 767297540, 767363076, 767428612, 767494148, 767559684,
+    767625220, 767690756, 767756292, 767821828, 767887364, 767952900, 768018436, 768083972,
+    768149508, 768215044, 768280580, 768346116, 768411652, 768477188, 768542724, 768608260,
+    768673796, 768739332, 768804868, 768870404, 768935940, 769001476, 769067012, 769132548,
+    769198084, 769263620, 769329156, 769394692, 769460228, 769525764, 769591300, 769656836,
+    769722372, 769787908, 769853444, 769918980, 769984516, 770050052, 770115588, 770181124,
+    770246660, 770312196, 770377732, 770443268, 770508804, 770574340, 770639876, 770705412,
+    770770948, 770836484, 770902020, 770967556, 771033092, 771098628, 771164164, 771229700,
+    771295236, 771360772, 771426308, 771491844, 771557380, 771622916, 771688452, 771753988,
+    771819524, 771885060, 771950596, 772016132, 772081668, 772147204, 772212740, 772278276,
+    772343812, 772409348, 772474884, 772540420, 772605956, 772671492, 772737028, 772802564,
+    772868100, 772933636, 772999172, 773064708, 773130244, 773195780, 773261316, 773326852,
+    773392388, 773457924, 773523460, 773588996, 773654532, 773720068, 773785604, 773851140,
+    773916676, 773982212, 774047748, 774113284, 774178820, 774244356, 774309892, 774375428,
+    774440964, 774506500, 774572036, 774637572, 774703108, 774768644, 774834180, 774899716,
+    774965252, 775030788, 775096324, 775161860, 775227396, 775292932, 775358468, 775424004,
+    775489540, 775555076, 775620612, 775686148, 775751684, 775817220, 775882756, 775948292,
+    776013828, 776079364, 776144900, 776210436, 776275972, 776341508, 776407044, 776472580,
+    776538116, 776603652, 776669188, 776734724, 776800260, 776865796, 776931332, 776996868,
+    777062404, 777127940, 777193476, 777259012, 777324548, 777390084, 777455620, 777521156,
+    777586692, 777652228, 777717764, 777783300, 777848836, 777914372, 777979908, 778045444,
+    778110980, 778176516, 778242052, 778307588, 778373124, 778438660, 778504196, 778569732,
+    778635268, 778700804, 778766340, 778831876, 778897412, 778962948, 779028484, 779094020,
+    779159556, 779225092, 779290628, 779356164, 779421700, 779487236, 779552772, 779618308,
+    779683844, 779749380, 779814916, 779880452, 779945988, 780011524, 780077060, 780142596,
+    780208132, 780273668, 780339204, 780404740, 780470276, 780535812, 780601348, 780666884,
+    780732420, 780797956, 780863492, 780929028, 780994564, 781060100, 781125636, 781191172,
+    781256708, 781322244, 781387780, 781453316, 781518852, 781584388, 781649924, 781715460,
+    781780996, 781846532, 781912068, 781977604, 782043140, 782108676, 782174212, 782239748,
+    782305284, 782370820, 782436356, 782501892, 782567428, 782632964, 782698500, 782764036,
+    782829572, 782895108, 782960644, 783026180, 783091716, 783157252, 783222788, 783288324,
+    783353860, 783419396, 783484932, 783550468, 783616004, 783681540, 783747076, 783812612,
+    783878148, 783943684, 784009220, 784074756, 784140292, 784205828, 784271364, 784336900,
+    784402436, 784467972, 784533508, 784599044, 784664580, 784730116, 784795652, 784861188,
+    784926724, 784992260, 785057796, 785123332, 785188868, 785254404, 785319940, 785385476,
+    785451012, 785516548, 785582084, 785647620, 785713156, 785778692, 785844228, 785909764,
+    785975300, 786040836, 786106372, 786171908, 786237444, 786302980, 786368516, 786434052,
+    786499588, 786565124, 786630660, 786696196, 786761732, 786827268, 786892804, 786958340,
+    787023876, 787089412, 787154948, 787220484, 787286020, 787351556, 787417092, 787482628,
+    787548164, 787613700, 787679236, 787744772, 787810308, 787875844, 787941380, 788006916,
+    788072452, 788137988, 788203524, 788269060, 788334596, 788400132, 788465668, 788531204,
+    788596740, 788662276, 788727812, 788793348, 788858884, 788924420, 788989956, 789055492,
+    789121028, 789186564, 789252100, 789317636, 789383172, 789448708, 789514244, 789579780,
+    789645316, 789710852, 789776388, 789841924, 789907460, 789972996, 790038532, 790104068,
+    790169604, 790235140, 790300676, 790366212, 790431748, 790497284, 790562820, 790628356,
+    790693892, 790759428, 790824964, 790890500, 790956036, 791021572, 791087108, 791152644,
+    791218180, 791283716, 791349252, 791414788, 791480324, 791545860, 791611396, 791676932,
+    791742468, 791808004, 791873540, 791939076, 792004612, 792070148, 792135684, 792201220,
+    792266756, 792332292, 792397828, 792463364, 792528900, 792594436, 792659972, 792725508,
+    792791044, 792856580, 792922116, 792987652, 793053188, 793118724, 793184260, 793249796,
+    793315332, 793315336, 17928, 793315336, 17992, 793380868, 793380872, 17928,
+    793446404, 793446408, 17928, 793511940, 793577476, 793643012, 793708548, 793774084,
+    793839620, 793905156, 793970692, 794036228, 794101764, 794167300, 794232836, 794298372,
+    794363908, 794429444, 794494980, 794560516, 794626052, 794691588, 794757124, 794822660,
+    794888196, 794953732, 795019268, 795084804, 795150340, 795215876, 795281412, 795346948,
+    795412484, 795478020, 795543556, 795609092, 795674628, 795740164, 795805700, 795871236,
+    795936772, 796002308, 796067844, 796133380, 796198916, 796264452, 796329988, 796395524,
+    796461060, 796461064, 17928, 796526596, 796526600, 17928, 796592132, 796657668,
+    796723204, 796788740, 796854276, 796919812, 796985348, 797050884, 797116420, 797181956,
+    797247492, 797313028, 797378564, 797444100, 797509636, 797575172, 797640708, 797706244,
+    797771780, 797837316, 797902852, 797968388, 798033924, 798099460, 798164996, 798230532,
+    798296068, 798361604, 798427140, 798492676, 798558212, 798623748, 798689284, 798754820,
+    798820356, 798885892, 798951428, 799016964, 799082500, 799148036, 799213572, 799279108,
+    799344644, 799410180, 799475716, 799541252, 799606788, 799672324, 799737860, 799803396,
+    799868932, 799934468, 800000004, 800065540, 800131076, 800196612, 800262148, 800327684,
+    800393220, 800458756, 800524292, 800589828, 800655364, 800720900, 800786436, 800851972,
+    800917508, 800983044, 801048580, 801114116, 801179652, 801245188, 801310724, 801376260,
+    801441796, 801507332, 801572868, 801638404, 801703940, 801769476, 801835012, 801900548,
+    801966084, 802031620, 802097156, 802162692, 802228228, 802293764, 802359300, 802424836,
+    802490372, 802555908, 802621444, 802686980, 802752516, 802818052, 802883588, 802949124,
+    803014660, 803080196, 803145732, 803211268, 803276804, 803342340, 803407876, 803473412,
+    803538948, 803604484, 803670020, 803735556, 803801092, 803866628, 803932164, 803997700,
+    804063236, 804128772, 804194308, 804259844, 804325380, 804390916, 804456452, 804521988,
+    804587524, 804653060, 804718596, 804784132, 804849668, 804915204, 804980740, 805046276,
+    805111812, 805177348, 805242884, 805308420, 805373956, 805439492, 805505028, 805570564,
+    805636100, 805701636, 805767172, 805832708, 805898244, 805963780, 806029316, 806094852,
+    806160388, 806225924, 806291460, 806356996, 806422532, 806488068, 806553604, 806619140,
+    806684676, 806750212, 806815748, 806881284, 806946820, 807012356, 807077892, 807143428,
+    807208964, 807274500, 807340036, 807405572, 807471108, 807536644, 807602180, 807667716,
+    807733252, 807798788, 807864324, 807929860, 807995396, 808060932, 808126468, 808192004,
+    808257540, 808323076, 808388612, 808454148, 808519684, 808585220, 808650756, 808716292,
+    808781828, 808847364, 808912900, 808978436, 809043972, 809109508, 809175044, 809240580,
+    809306116, 809371652, 809437188, 809502724, 809568260, 809633796, 809699332, 809764868,
+    809830404, 809895940, 809961476, 810027012, 810092548, 810158084, 810223620, 810289156,
+    810354692, 810420228, 810485764, 810551300, 810616836, 810682372, 810747908, 810813444,
+    810878980, 810944516, 811010052, 811075588, 811141124, 811206660, 811272196, 811337732,
+    811403268, 811468804, 811534340, 811599876, 811665412, 811730948, 811796484, 811862020,
+    811927556, 811993092, 812058628, 812124164, 812189700, 812255236, 812320772, 812386308,
+    812451844, 812517380, 812582916, 812648452, 812713988, 812779524, 812845060, 812910596,
+    812976132, 813041668, 813107204, 813172740, 813238276, 813303812, 813369348, 813434884,
+    813500420, 813565956, 813631492, 813697028, 813762564, 813828100, 813893636, 813959172,
+    814024708, 814090244, 814155780, 814221316, 814286852, 814352388, 814417924, 814483460,
+    814548996, 814614532, 814680068, 814745604, 814811140, 814876676, 814942212, 815007748,
+    815073284, 815138820, 815204356, 815269892, 815335428, 815400964, 815466500, 815532036,
+    815597572, 815663108, 815728644, 815794180, 815859716, 815925252, 815990788, 816056324,
+    816121860, 816187396, 816252932, 816318468, 816384004, 816384008, 17928, 816449540,
+    816515076, 816580612, 816580616, 17928, 816646148, 816711684, 816777220, 816842756,
+    816908292, 816973828, 817039364, 817104900, 817170436, 817235972, 817301508, 817367044,
+    817432580, 817432584, 17928, 817498116, 817563652, 817629188, 817694724, 817760260,
+    817825796, 817891332, 817956868, 818022404, 818087940, 818153476, 818219012, 818284548,
+    818350084, 818415620, 818481156, 818546692, 818612228, 818677764, 818743300, 818808836,
+    818874372, 818939908, 819005444, 819070980, 819136516, 819202052, 819267588, 819333124,
+    819398660, 819464196, 819529732, 819595268, 819660804, 819726340, 819791876, 819857412,
+    819922948, 819988484, 820054020, 820119556, 820185092, 820250628, 820316164, 820381700,
+    820447236, 820512772, 820578308, 820643844, 820709380, 820774916, 820840452, 820905988,
+    820971524, 821037060, 821037102, 821037106, 821102596, 821168132, 821233668, 821299204,
+    821364740, 821430276, 821495812, 821561348, 821626884, 821692420, 821757956, 821823492,
+    821889028, 821954564, 822020100, 822085636, 822151172, 822216708, 822282244, 822347780,
+    822413316, 822478852, 822544388, 822609924, 822675460, 822740996, 822806532, 822872068,
+    822937604, 823003140, 823068676, 823134212, 823199748, 823265284, 823330820, 823396356,
+    823461892, 823527428, 823592964, 823658500, 823724036, 823789572, 823855108, 823920644,
+    823986180, 824051716, 824117252, 824182788, 824248324, 824313860, 824379396, 824444932,
+    824510468, 824576004, 824641540, 824707076, 824772612, 824838148, 824903684, 824969220,
+    825034756, 825100292, 825165828, 825231364, 825296900, 825362436, 825427972, 825493508,
+    825559044, 825624580, 825690116, 825755652, 825821188, 825886724, 825886728, 825952260,
+    826017796, 826083332, 826148868, 826214404, 826279940, 826345476, 826345522, 826411012,
+    826476548, 826542084, 826607620, 826673156, 826738692, 826804228, 826869764, 826935300,
+    827000836, 827066372, 827131908, 827197444, 827262980, 827328516, 827394052, 827459588,
+    827459634, 827525124, 827590660, 827656196, 827721732, 827787268, 827852804, 827918340,
+    827983876, 828049412, 828114948, 828180484, 828246020, 828311556, 828377092, 828442628,
+    828508164, 828573700, 828639236, 828704772, 828770308, 828835844, 828901380, 828966916,
+    829032452, 829097988, 829163524, 829229060, 829294596, 829360132, 829425668, 829491204,
+    829556740, 829622276, 829687812, 829753348, 829818884, 829884420, 829949956, 830015492,
+    830081028, 830146564, 830212100, 830277636, 830343172, 830408708, 830474244, 830539780,
+    830605316, 830670852, 830736388, 830801924, 830867460, 830932996, 830998532, 831064068,
+    831129604, 831195140, 831260676, 831326212, 831391748, 831457284, 831522820, 831588356,
+    831653892, 831719428, 831784964, 831850500, 831916036, 831981572, 832047108, 832112644,
+    832178180, 832243716, 832309252, 832374788, 832440324, 832505860, 832571396, 832636932,
+    832702468, 832768004, 832833540, 832899076, 832964612, 833030148, 833095684, 833161220,
+    833226756, 833292292, 833357828, 833423364, 833488900, 833554436, 833619972, 833685508,
+    833751044, 833816580, 833882116, 833947652, 834013188, 834078724, 834144260, 834209796,
+    834275332, 834340868, 834406404, 834471940, 834537476, 834603012, 834668548, 834734084,
+    834799620, 834865156, 834930692, 834996228, 835061764, 835127300, 835192836, 835258372,
+    835323908, 835389444, 835454980, 835520516, 835586052, 835651588, 835717124, 835782660,
+    835848196, 835913732, 835979268, 836044804, 836110340, 836175876, 836241412, 836306948,
+    836372484, 836438020, 836503556, 836569092, 836634628, 836700164, 836765700, 836831236,
+    836896772, 836962308, 837027844, 837093380, 837158916, 837224452, 837289988, 837355524,
+    837421060, 837486596, 837552132, 837617668, 837683204, 837748740, 837814276, 837879812,
+    837945348, 838010884, 838076420, 838141956, 838207492, 838273028, 838338564, 838404100,
+    838469636, 838535172, 838600708, 838666244, 838731780, 838797316, 838862852, 838928388,
+    838993924, 839059460, 839124996, 839190532, 839256068, 839321604, 839387140, 839452676,
+    839518212, 839583748, 839649284, 839714820, 839780356, 839845892, 839911428, 839976964,
+    840042500, 840108036, 840173572, 840239108, 840304644, 840370180, 840435716, 840501252,
+    840566788, 840632324, 840697860, 840763396, 840828932, 840894468, 840960004, 841025540,
+    841091076, 841156612, 841222148, 841287684, 841353220, 841418756, 841484292, 841549828,
+    841615364, 841680900, 841746436, 841811972, 841877508, 841943044, 842008580, 842074116,
+    842139652, 842205188, 842270724, 842336260, 842401796, 842467332, 842532868, 842598404,
+    842663940, 842729476, 842795012, 842860548, 842926084, 842991620, 843057156, 843122692,
+    843188228, 843253764, 843319300, 843384836, 843450372, 843515908, 843581444, 843646980,
+    843712516, 843778052, 843843588, 843909124, 843974660, 844040196, 844105732, 844171268,
+    844236804, 844302340, 844367876, 844433412, 844498948, 844564484, 844630020, 844695556,
+    844761092, 844826628, 844892164, 844957700, 845023236, 845088772, 845154308, 845219844,
+    845285380, 845350916, 845416452, 845481988, 845547524, 845613060, 845678596, 845744132,
+    845809668, 845875204, 845940740, 846006276, 846071812, 846137348, 846202884, 846268420,
+    846333956, 846399492, 846465028, 846530564, 846596100, 846661636, 846727172, 846792708,
+    846858244, 846923780, 846989316, 847054852, 847120388, 847120392, 846137352, 847120392,
+    846661640, 847185924, 847251460, 847316996, 847382532, 847448068, 847513604, 847579140,
+    847644676, 847710212, 847775748, 847841284, 847906820, 847972356, 848037892, 848103428,
+    848168964, 848234500, 848300036, 848365572, 848431108, 848496644, 848562180, 848627716,
+    848693252, 848758788, 848824324, 848889860, 848955396, 849020932, 849086468, 849152004,
+    849217540, 849283076, 849348612, 849414148, 849479684, 849545220, 849610756, 849676292,
+    849741828, 849807364, 849872900, 849938436, 850003972, 850069508, 850135044, 850200580,
+    850266116, 850331652, 850397188, 850462724, 850528260, 850593796, 850659332, 850724868,
+    850790404, 850855940, 850921476, 850987012, 851052548, 851118084, 851183620, 851249156,
+    851314692, 851380228, 851445764, 851511300, 851576836, 851642372, 851707908, 851773444,
+    851838980, 851904516, 851970052, 852035588, 852101124, 852166660, 852232196, 852297732,
+    852363268, 852428804, 852494340, 852559876, 852625412, 852690948, 852756484, 852822020,
+    852887556, 852953092, 853018628, 853084164, 853084164, 857344004, 853149700, 853149700,
+    857344004, 853215236, 853280772, 853346308, 853411844, 853411844, 857606148, 853477380,
+    853477380, 857606148, 853542916, 853608452, 853673988, 853739524, 853805060, 853870596,
+    853936132, 854001668, 854067204, 854132740, 854198276, 854263812, 854329348, 854394884,
+    854460420, 854460420, 857606148, 854525956, 854525956, 857606148, 854591492, 854657028,
+    854722564, 854788100, 854853636, 854919172, 854984708, 854984708, 857606148, 855050244,
+    855050244, 857606148, 855115780, 855181316, 855246852, 855312388, 855377924, 855443460,
+    855508996, 855508996, 857606148, 855574532, 855574532, 857606148, 855640068, 855705604,
+    855771140, 855836676, 855902212, 855967748, 856033284, 856033284, 857606148, 856098820,
+    856098820, 857606148, 856164356, 856229892, 856229896, 17992, 856295428, 856360964,
+    856426500, 856492036, 856557572, 856623108, 856688644, 856754180, 856754184, 17992,
+    856819716, 856819720, 17992, 856885252, 856885256, 17992, 856950788, 857016324,
+    857081860, 857147396, 857212932, 857278468, 857344004, 857409540, 857475076, 857540612,
+    857606148, 857671684, 857671688, 859179016, 12552, 857737220, 857802756, 857868292,
+    857933828, 857999364, 858064900, 858130436, 858195972, 858261508, 858327044, 858392580,
+    858458116, 858523652, 858589188, 858654724, 858720260, 858785796, 858851332, 858916868,
+    858982404, 859047940, 859113476, 859179012, 859244548, 859310084, 859375620, 859441156,
+    859506692, 859572228, 859637764, 859703300, 859768836, 859834372, 859899908, 859965444,
+    860030980, 860096516, 860162052, 860227588, 860293124, 860358660, 860424196, 860489732,
+    860555268, 860620804, 860686340, 860751876, 860817412, 860882948, 860948484, 861014020,
+    861079556, 861145092, 861210628, 861276164, 861341700, 861407236, 861472772, 861472818,
+    861538308, 861538350, 861538354, 861603844, 861603890, 861669380, 861669426, 861734916,
+    861800452, 861865988, 861931524, 861997060, 862062596, 862128132, 862193668, 862259204,
+    862324740, 862390276, 862455812, 862521348, 862586884, 862652420, 862717956, 862783492,
+    862849028, 862914564, 862980100, 863045636, 863111172, 863176708, 863242244, 863307780,
+    863373316, 863438852, 863504388, 863569924, 863635460, 863635506, 863700996, 863766532,
+    863766578, 863832068, 863897604, 863963140, 863963186, 864028676, 864094212, 864159748,
+    864225284, 864290820, 864356356, 864421892, 864487428, 864552964, 864618500, 864684036,
+    864684082, 864749572, 864815108, 864880644, 864946180, 864946226, 865011716, 865011762,
+    865077252, 865142788, 865208324, 865273860, 865273906, 865339396, 865404932, 865470468,
+    865536004, 865601540, 865667076, 865667122, 865732612, 865798148, 865798190, 865798194,
+    865863684, 865863726, 865863730, 865929220, 865994756, 865994798, 865994802, 866060292,
+    866125828, 866125870, 866125874, 866191364, 866256900, 866322436, 866387972, 866453508,
+    866519044, 866584580, 866650116, 866715652, 866781188, 866846724, 866912260, 866977796,
+    867043332, 867108868, 867174404, 867239940, 867305476, 867371012, 867436548, 867502084,
+    867567620, 867633156, 867698692, 867764228, 867829764, 867895300, 867960836, 868026372,
+    868091908, 868157444, 868222980, 868288516, 868354052, 868419588, 868485124, 868550660,
+    868616196, 868681732, 868747268, 868812804, 868878340, 868943876, 869009412, 869074948,
+    869140484, 869206020, 869271556, 869337092, 869402628, 869468164, 869533700, 869599236,
+    869664772, 869730308, 869795844, 869861380, 869926916, 869992452, 870057988, 870123524,
+    870189060, 870254596, 870320132, 870385668, 870451204, 870516740, 870582276, 870647812,
+    870713348, 870778884, 870844420, 870909956, 870975492, 871041028, 871106564, 871172100,
+    871237636, 871303172, 871368708, 871434244, 871499780, 871565316, 871630852, 871696388,
+    871761924, 871827460, 871892996, 871958532, 872024068, 872089604, 872155140, 872220676,
+    872286212, 872351748, 872417284, 872482820, 872548356, 872613892, 872679428, 872744964,
+    872810500, 872876036, 872941572, 873007108, 873072644, 873138180, 873203716, 873269252,
+    873334788, 873400324, 873465860, 873531396, 873596932, 873662468, 873728004, 873793540,
+    873859076, 873924612, 873990148, 874055684, 874121220, 874186756, 874252292, 874317828,
+    874383364, 874448900, 874514436, 874579972, 874645508, 874711044, 874776580, 874842116,
+    874907652, 874973188, 875038724, 875104260, 875169796, 875235332, 875300868, 875366404,
+    875431940, 875497476, 875563012, 875628548, 875694084, 875759620, 875825156, 875890692,
+    875956228, 876021764, 876087300, 876152836, 876218372, 876283908, 876349444, 876414980,
+    876480516, 876546052, 876611588, 876677124, 876742660, 876808196, 876873732, 876939268,
+    877004804, 877070340, 877135876, 877201412, 877266948, 877332484, 877398020, 877463556,
+    877529092, 877594628, 877660164, 877725700, 877791236, 877856772, 877922308, 877987844,
+    878053380, 878118916, 878184452, 878249988, 878315524, 878381060, 878446596, 878446600,
+    880412680, 878512132, 878577668, 878643204, 878643208, 880478216, 878708740, 878774276,
+    878839812, 878905348, 878970884, 879036420, 879101956, 879167492, 879233028, 879298564,
+    879364100, 879429636, 879495172, 879560708, 879626244, 879691780, 879757316, 879822852,
+    879888388, 879953924, 880019460, 880084996, 880150532, 880216068, 880281604, 880347140,
+    880412676, 880478212, 880543748, 880609284, 880674820, 880740356, 880805892, 880871428,
+    880936964, 881002500, 881068036, 881133572, 881199108, 881264644, 881330180, 881395716,
+    881461252, 881526788, 881592324, 881657860, 881723396, 881788932, 881854468, 881920004,
+    881985540, 882051076, 882116612, 882182148, 882247684, 882313220, 882378756, 882444292,
+    882509828, 882575364, 882640900, 882706436, 882771972, 882837508, 882903044, 882968580,
+    883034116, 883099652, 883165188, 883230724, 883296260, 883361796, 883427332, 883492868,
+    883558404, 883623940, 883689476, 883755012, 883820548, 883886084, 883951620, 884017156,
+    884082692, 884148228, 884213764, 884279300, 884344836, 884410372, 884475908, 884541444,
+    884606980, 884672516, 884738052, 884803588, 884869124, 884934660, 885000196, 885065732,
+    885131268, 885196804, 885262340, 885327876, 885393412, 885458948, 885524484, 885590020,
+    885655556, 885721092, 885786628, 885852164, 885917700, 885983236, 886048772, 886114308,
+    886179844, 886245380, 886310916, 886376452, 886441988, 886507524, 886573060, 886638596,
+    886704132, 886769668, 886835204, 886900740, 886966276, 887031812, 887097348, 887162884,
+    887228420, 887293956, 887359492, 887425028, 887490564, 887556100, 887621636, 887687172,
+    887752708, 887818244, 887883780, 887949316, 888014852, 888080388, 888145924, 888211460,
+    888276996, 888342532, 888408068, 888473604, 888539140, 888604676, 888670212, 888735748,
+    888801284, 888866820, 888932356, 888997892, 889063428, 889128964, 889194500, 889260036,
+    889325572, 889391108, 889456644, 889522180, 889587716, 889653252, 889718788, 889718792,
+    889784324, 889784328, 889849860, 889849864, 889915396, 889915400, 889980932, 889980936,
+    890046468, 890046472, 890112004, 890112008, 890177540, 890243076, 890308612, 890308616,
+    890374148, 890374152, 890439684, 890439688, 890505220, 890505224, 890570756, 890570760,
+    890636292, 890701828, 890701832, 890767364, 890832900, 890898436, 890963972, 891029508,
+    891095044, 891160580, 891160584, 891226116, 891291652, 891291656, 891357188, 891357192,
+    891422724, 891422728, 891488260, 891553796, 891619332, 891684868, 891750404, 891815940,
+    891881476, 891947012, 892012548, 892078084, 892143620, 892209156, 892274692, 892340228,
+    892405764, 892471300, 892536836, 892602372, 892667908, 892733444, 892798980, 892864516,
+    892930052, 892995588, 893061124, 893126660, 893192196, 893257732, 893323268, 893388804,
+    893454340, 893519876, 893585412, 893650948, 893716484, 893782020, 893847556, 893913092,
+    893978628, 894044164, 894109700, 894175236, 894240772, 894306308, 894371844, 894437380,
+    894502916, 894568452, 894633988, 894699524, 894765060, 894830596, 894896132, 894961668,
+    895027204, 895092740, 895158276, 895223812, 895289348, 895354884, 895420420, 895485956,
+    895551492, 895617028, 895682564, 895748100, 895813636, 895879172, 895944708, 896010244,
+    896075780, 896141316, 896206852, 896272388, 896337924, 896403460, 896468996, 896534532,
+    896600068, 896665604, 896731140, 896796676, 896862212, 896927748, 896993284, 897058820,
+    897124356, 897189892, 897255428, 897320964, 897386500, 897452036, 897517572, 897583108,
+    897648644, 897714180, 897779716, 897845252, 897910788, 897976324, 898041860, 898107396,
+    898172932, 898238468, 898304004, 898369540, 898435076, 898500612, 898566148, 898631684,
+    898697220, 898762756, 898828292, 898893828, 898959364, 899024900, 899090436, 899155972,
+    899221508, 899287044, 899352580, 899418116, 899483652, 899549188, 899614724, 899680260,
+    899745796, 899811332, 899876868, 899942404, 900007940, 900073476, 900139012, 900204548,
+    900270084, 900335620, 900401156, 900466692, 900532228, 900597764, 900663300, 900728836,
+    900794372, 900859908, 900925444, 900990980, 901056516, 901122052, 901187588, 901253124,
+    901318660, 901384196, 901449732, 901515268, 901580804, 901646340, 901711876, 901777412,
+    901842948, 901908484, 901974020, 902039556, 902105092, 902170628, 902236164, 902301700,
+    902367236, 902367240, 906102792, 902367240, 902432772, 902498308, 902563844, 902629380,
+    902694916, 902760452, 902825988, 902891524, 902957060, 903022596, 903088132, 903153668,
+    903219204, 903284740, 903350276, 903415812, 903481348, 903546884, 903612420, 903677956,
+    903743492, 903809028, 903874564, 903940100, 904005636, 904071172, 904136708, 904202244,
+    904267780, 904267784, 904333316, 904398852, 904464388, 904529924, 904595460, 904660996,
+    904726532, 904792068, 904857604, 904923140, 904988676, 905054212, 905119748, 905185284,
+    905250820, 905316356, 905381892, 905447428, 905512964, 905578500, 905644036, 905709572,
+    905775108, 905840644, 905906180, 905971716, 906037252, 906102788, 906168324, 906233860,
+    906299396, 906364932, 906430468, 906496004, 906561540, 906627076, 906692612, 906758148,
+    906823684, 906889220, 906954756, 907020292, 907085828, 907151364, 907216900, 907282436,
+    907347972, 907413508, 907479044, 907544580, 907610116, 907675652, 907741188, 907806724,
+    907872260, 907937796, 908003332, 908068868, 908134404, 908199940, 908265476, 908331012,
+    908396548, 908462084, 908527620, 908593156, 908658692, 908724228, 908789764, 908855300,
+    908920836, 908986372, 909051908, 909117444, 909182980, 909248516, 909314052, 909379588,
+    909445124, 909510660, 909576196, 909641732, 909707268, 909772804, 909838340, 909903876,
+    909969412, 910034948, 910100484, 910166020, 910231556, 910297092, 910362628, 910428164,
+    910493700, 910559236, 910624772, 910690308, 910755844, 910821380, 910886916, 910952452,
+    911017988, 911083524, 911149060, 911214596, 911280132, 911345668, 911411204, 911476740,
+    911542276, 911607812, 911673348, 911738884, 911804420, 911869956, 911935492, 912001028,
+    912066564, 912132100, 912197636, 912263172, 912328708, 912394244, 912459780, 912525316,
+    912590852, 912656388, 912721924, 912787460, 912852996, 912918532, 912984068, 913049604,
+    913115140, 913180676, 913246212, 913311748, 913377284, 913442820, 913508356, 913573892,
+    913639428, 913704964, 913770500, 913836036, 913901572, 913967108, 914032644, 914098180,
+    914163716, 914229252, 914294788, 914360324, 914425860, 914491396, 914556932, 914622468,
+    914688004, 914753540, 914819076, 914884612, 914950148, 915015684, 915081220, 915146756,
+    915212292, 915277828, 915343364, 915408900, 915474436, 915539972, 915605508, 915671044,
+    915736580, 915802116, 915867652, 915933188, 915998724, 916064260, 916129796, 916195332,
+    916260868, 916326404, 916391940, 916457476, 916523012, 916588548, 916654084, 916719620,
+    916785156, 916850692, 916916228, 916981764, 917047300, 917112836, 917178372, 917243908,
+    917309444, 917374980, 917440516, 917506052, 917571588, 917637124, 917702660, 917768196,
+    917833732, 917899268, 917964804, 918030340, 918095876, 918161412, 918226948, 918292484,
+    918358020, 918423556, 918489092, 918554628, 918620164, 918685700, 918751236, 918816772,
+    918882308, 918947844, 919013380, 919078916, 919144452, 919209988, 919275524, 919341060,
+    919406596, 919472132, 919537668, 919603204, 919668740, 919734276, 919799812, 919865348,
+    919930884, 919996420, 920061956, 920127492, 920193028, 920258564, 920324100, 920389636,
+    920455172, 920520708, 920586244, 920651780, 920717316, 920782852, 920848388, 920913924,
+    920979460, 921044996, 921110532, 921176068, 921241604, 921307140, 921372676, 921438212,
+    921503748, 921569284, 921634820, 921700356, 921765892, 921831428, 921896964, 921962500,
+    922028036, 922093572, 922159108, 922224644, 922290180, 922355716, 922355720, 923797512,
+    922355720, 923797512, 924518408, 922421252, 922486788, 922552324, 922617860, 922683396,
+    922748932, 922814468, 922880004, 922945540, 923011076, 923076612, 923142148, 923207684,
+    923273220, 923338756, 923404292, 923469828, 923535364, 923600900, 923666436, 923731972,
+    923797508, 923863044, 923928580, 923994116, 924059652, 924125188, 924190724, 924256260,
+    924321796, 924387332, 924452868, 924518404, 924583940, 924649476, 924715012, 924780548,
+    924846084, 924911620, 924977156, 925042692, 925108228, 925173764, 925239300, 925304836,
+    925370372, 925435908, 925501444, 925501448, 925566980, 925632516, 925698052, 925763588,
+    925829124, 925894660, 925960196, 926025732, 926091268, 926156804, 926222340, 926287876,
+    926353412, 926418948, 926484484, 926550020, 926615556, 926681092, 926746628, 926812164,
+    926877700, 926877704, 926943236, 927008772, 927074308, 927139844, 927205380, 927270916,
+    927336452, 927401988, 927467524, 927533060, 927598596, 927598600, 930088968, 927598600,
+    927664132, 927729668, 927795204, 927860740, 927926276, 927991812, 928057348, 928122884,
+    928188420, 928253956, 928319492, 928385028, 928450564, 928516100, 928581636, 928647172,
+    928712708, 928778244, 928843780, 928909316, 928974852, 929040388, 929105924, 929171460,
+    929171464, 929236996, 929302532, 929368068, 929433604, 929499140, 929564676, 929630212,
+    929695748, 929761284, 929826820, 929892356, 929957892, 930023428, 930088964, 930154500,
+    930220036, 930285572, 930351108, 930416644, 930482180, 930547716, 930613252, 930678788,
+    930744324, 930809860, 930875396, 930940932, 931006468, 931072004, 931137540, 931203076,
+    931268612, 931334148, 931399684, 931465220, 931530756, 931596292, 931661828, 931727364,
+    931792900, 931858436, 931923972, 931989508, 932055044, 932120580, 932186116, 932251652,
+    932317188, 932382724, 932448260, 932513796, 932579332, 932644868, 932710404, 932775940,
+    932841476, 932907012, 932972548, 933038084, 933103620, 933169156, 933234692, 933300228,
+    933365764, 933431300, 933496836, 933562372, 933627908, 933693444, 933758980, 933824516,
+    933890052, 933955588, 934021124, 934086660, 934152196, 934217732, 934283268, 934348804,
+    934414340, 934479876, 934545412, 934610948, 934676484, 934742020, 934807556, 934873092,
+    934938628, 935004164, 935069700, 935135236, 935200772, 935266308, 935331844, 935397380,
+    935462916, 935528452, 935593988, 935659524, 935725060, 935790596, 935856132, 935921668,
+    935987204, 936052740, 936118276, 936183812, 936249348, 936314884, 936380420, 936445956,
+    936511492, 936577028, 936642564, 936708100, 936773636, 936839172, 936904708, 936970244,
+    937035780, 937101316, 937166852, 937232388, 937297924, 937363460, 937428996, 937494532,
+    937560068, 937625604, 937691140, 937756676, 937822212, 937887748, 937953284, 938018820,
+    938084356, 938149892, 938215428, 938280964, 938346500, 938412036, 938477572, 938543108,
+    938608644, 938674180, 938739716, 938805252, 938870788, 938936324, 939001860, 939067396,
+    939132932, 939198468, 939264004, 939329540, 939395076, 939460612, 939526148, 939591684,
+    939657220, 939722756, 939788292, 939853828, 939919364, 939984900, 940050436, 940115972,
+    940181508, 940247044, 940312580, 940378116, 940443652, 940509188, 940574724, 940640260,
+    940705796, 940771332, 940836868, 940902404, 940967940, 941033476, 941099012, 941164548,
+    941230084, 941295620, 941361156, 941426692, 941492228, 941557764, 941623300, 941688836,
+    941754372, 941819908, 941885444, 941885448, 941950980, 942016516, 942082052, 942147588,
+    942213124, 942278660, 942344196, 942409732, 942409736, 942475268, 942540804, 942606340,
+    942671876, 942737412, 942802948, 942868484, 942934020, 942999556, 943065092, 943130628,
+    943196164, 943261700, 943327236, 943392772, 943458308, 943523844, 943589380, 943654916,
+    943720452, 943785988, 943851524, 943917060, 943982596, 944048132, 944113668, 944179204,
+    944244740, 944310276, 944375812, 944441348, 944506884, 944572420, 944637956, 944703492,
+    944769028, 944834564, 944900100, 944965636, 945031172, 945096708, 945162244, 945227780,
+    945293316, 945358852, 945424388, 945489924, 945555460, 945620996, 945686532, 945752068,
+    945817604, 945883140, 945948676, 946014212, 946079748, 946145284, 946210820, 946276356,
+    946341892, 946407428, 946472964, 946538500, 946604036, 946669572, 946735108, 946800644,
+    946866180, 946931716, 946997252, 947062788, 947128324, 947193860, 947259396, 947324932,
+    947390468, 947456004, 947521540, 947587076, 947652612, 947718148, 947783684, 947849220,
+    947914756, 947980292, 948045828, 948111364, 948176900, 948242436, 948307972, 948373508,
+    948439044, 948504580, 948570116, 948635652, 948701188, 948766724, 948832260, 948897796,
+    948963332, 949028868, 949094404, 949159940, 949225476, 949291012, 949356548, 949422084,
+    949487620, 949553156, 949618692, 949684228, 949749764, 949815300, 949880836, 949946372,
+    950011908, 950077444, 950142980, 950208516, 950274052, 950339588, 950405124, 950470660,
+    950536196, 950601732, 950667268, 950732804, 950798340, 950863876, 950929412, 950994948,
+    951060484, 951126020, 951191556, 951257092, 951322628, 951388164, 951453700, 951519236,
+    951584772, 951650308, 951715844, 951781380, 951846916, 951912452, 951977988, 952043524,
+    952109060, 952174596, 952240132, 952305668, 952371204, 952436740, 952502276, 952567812,
+    952633348, 952698884, 952764420, 952829956, 952895492, 952961028, 953026564, 953092100,
+    953157636, 953223172, 953288708, 953354244, 953419780, 953485316, 953550852, 953616388,
+    953681924, 953747460, 953812996, 953878532, 953944068, 954009604, 954075140, 954075152,
+    954140676, 954140688, 954206212, 954206224, 954271748, 954271760, 954337284, 954337296,
+    954402820, 954402832, 954468356, 954468368, 954533892, 954533904, 954599428, 954599440,
+    954664964, 954664976, 954730500, 954730512, 954796036, 954796048, 954861572, 954861584,
+    954927108, 954927120, 954992644, 954992656, 955058180, 955058192, 955123716, 955123728,
+    955189252, 955189264, 955254788, 955254800, 955320324, 955320336, 955385860, 955385872,
+    955451396, 955451408, 955516932, 955516944, 955582468, 955582480, 955648004, 955648016,
+    955713540, 955713552, 955779076, 955779088, 955844612, 955844624, 955910148, 955910160,
+    955975684, 955975696, 956041220, 956041232, 956106756, 956106768, 956172292, 956172304,
+    956237828, 956237840, 956303364, 956303376, 956368900, 956368912, 956434436, 956434448,
+    956499972, 956499984, 956565508, 956565520, 956631044, 956631056, 956696580, 956696592,
+    956762116, 956762128, 956827652, 956827664, 956893188, 956893200, 956958724, 956958736,
+    957024260, 957024272, 957089796, 957089808, 957155332, 957155344, 957220868, 957220880,
+    957286404, 957286416, 957351940, 957351952, 957417476, 957417488, 957483012, 957483024,
+    957548548, 957548560, 957614084, 957614096, 957679620, 957679632, 957745156, 957745168,
+    957810692, 957810704, 957876228, 957876240, 957941764, 957941776, 958007300, 958007312,
+    958072836, 958072848, 958138372, 958138384, 958203908, 958203920, 958269444, 958269456,
+    958334980, 958334992, 958400516, 958400528, 958466052, 958466064, 958531588, 958531600,
+    958597124, 958597136, 958662660, 958662672, 958728196, 958728208, 958793732, 958793744,
+    958859268, 958859280, 958924804, 958924816, 958990340, 958990352, 959055876, 959055888,
+    959121412, 959121424, 959186948, 959186960, 959252484, 959252496, 959318020, 959318032,
+    959383556, 959383568, 959449092, 959449104, 959514628, 959514640, 959580164, 959580176,
+    959645700, 959645712, 959711236, 959711248, 959776772, 959776784, 959842308, 959842320,
+    959907844, 959907856, 959973380, 959973392, 960038916, 960038928, 960104452, 960104464,
+    960169988, 960170000, 960235524, 960235536, 960301060, 960301072, 960366596, 960366608,
+    960432132, 960432144, 960497668, 960497680, 960563204, 960563216, 960628740, 960628752,
+    960694276, 960694288, 960759812, 960759824, 960825348, 960825360, 960890884, 960890896,
+    960956420, 960956432, 961021956, 961021968, 961087492, 961087504, 961153028, 961153040,
+    961218564, 961218576, 961284100, 961284112, 961349636, 961349648, 961415172, 961415184,
+    961480708, 961480720, 961546244, 961546256, 961611780, 961611792, 961677316, 961677328,
+    961742852, 961742864, 961808388, 961808400, 961873924, 961873936, 961939460, 961939472,
+    962004996, 962005008, 962070532, 962136068, 962201604, 962267140, 962332676, 962398212,
+    962463748, 962529284, 962594820, 962660356, 962725892, 962791428, 962856964, 962922500,
+    962988036, 963053572, 963119108, 963184644, 963250180, 963315716, 963381252, 963446788,
+    963512324, 963577860, 963643396, 963708932, 963774468, 963840004, 963905540, 963971076,
+    964036612, 964102148, 964167684, 964233220, 964298756, 964364292, 964429828, 964495364,
+    964560900, 964626436, 964691972, 964757508, 964823044, 964888580, 964954116, 965019652,
+    965085188, 965150724, 965216260, 965281796, 965347332, 965412868, 965478404, 965543940,
+    965609476, 965675012, 965740548, 965806084, 965871620, 965937156, 966002692, 966068228,
+    966133764, 966199300, 966264836, 966330372, 966395908, 966461444, 966526980, 966592516,
+    966658052, 966723588, 966789124, 966854660, 966920196, 966985732, 967051268, 967116804,
+    967182340, 967247876, 967313412, 967378948, 967444484, 967510020, 967575556, 967641092,
+    967706628, 967772164, 967837700, 967903236, 967968772, 968034308, 968099844, 968165380,
+    968230916, 968296452, 968361988, 968427524, 968493060, 968558596, 968624132, 968689668,
+    968755204, 968820740, 968886276, 968951812, 969017348, 969082884, 969148420, 969213956,
+    969279492, 969345028, 969410564, 969476100, 969541636, 969607172, 969672708, 969738244,
+    969803780, 969869316, 969934852, 970000388, 970065924, 970131460, 970196996, 970262532,
+    970328068, 970393604, 970459140, 970524676, 970590212, 970655748, 970721284, 970786820,
+    970852356, 970917892, 970983428, 971048964, 971114500, 971180036, 971245572, 971311108,
+    971376644, 971442180, 971507716, 971573252, 971638788, 971704324, 971769860, 971835396,
+    971900932, 971966468, 972032004, 972097540, 972163076, 972228612, 972294148, 972359684,
+    972425220, 972490756, 972556292, 972621828, 972687364, 972752900, 972818436, 972883972,
+    972949508, 973015044, 973080580, 973146116, 973211652, 973277188, 973342724, 973408260,
+    973473796, 973539332, 973604868, 973670404, 973735940, 973801476, 973867012, 973932548,
+    973998084, 974063620, 974129156, 974194692, 974260228, 974325764, 974391300, 974456836,
+    974522372, 974587908, 974653444, 974718980, 974784516, 974850052, 974915588, 974981124,
+    975046660, 975112196, 975177732, 975243268, 975308804, 975374340, 975439876, 975505412,
+    975570948, 975636484, 975702020, 975767556, 975833092, 975898628, 975964164, 976029700,
+    976095236, 976160772, 976226308, 976291844, 976357380, 976422916, 976488452, 976553988,
+    976619524, 976685060, 976750596, 976816132, 976881668, 976947204, 977012740, 977078276,
+    977143812, 977209348, 977274884, 977340420, 977405956, 977471492, 977537028, 977602564,
+    977668100, 977733636, 977799172, 977864708, 977930244, 977995780, 978061316, 978126852,
+    978192388, 978257924, 978323460, 978388996, 978454532, 978520068, 978585604, 978651140,
+    978716676, 978782212, 978847748, 978913284, 978978820, 979044356, 979109892, 979175428,
+    979240964, 979306500, 979372036, 979437572, 979503108, 979568644, 979634180, 979699716,
+    979765252, 979830788, 979896324, 979961860, 980027396, 980092932, 980158468, 980224004,
+    980289540, 980355076, 980420612, 980486148, 980551684, 980617220, 980682756, 980748292,
+    980813828, 980879364, 980944900, 981010436, 981075972, 981141508, 981207044, 981272580,
+    981338116, 981403652, 981469188, 981534724, 981600260, 981665796, 981731332, 981796868,
+    981862404, 981927940, 981993476, 982059012, 982124548, 982190084, 982255620, 982321156,
+    982386692, 982452228, 982517764, 982583300, 982648836, 982714372, 982779908, 982845444,
+    982910980, 982976516, 983042052, 983107588, 983173124, 983238660, 983304196, 983369732,
+    983435268, 983500804, 983566340, 983631876, 983697412, 983762948, 983828484, 983894020,
+    983959556, 984025092, 984090628, 984156164, 984221700, 984287236, 984352772, 984418308,
+    984483844, 984549380, 984614916, 984680452, 984745988, 984811524, 984877060, 984942596,
+    985008132, 985073668, 985139204, 985204740, 985270276, 985335812, 985401348, 985466884,
+    985532420, 985597956, 985663492, 985729028, 985794564, 985860100, 985925636, 985991172,
+    986056708, 986122244, 986187780, 986253316, 986318852, 986384388, 986449924, 986515460,
+    986580996, 986646532, 986712068, 986777604, 986843140, 986908676, 986974212, 987039748,
+    987105284, 987170820, 987236356, 987301892, 987367428, 987432964, 987498500, 987564036,
+    987629572, 987695108, 987760644, 987826180, 987891716, 987957252, 988022788, 988088324,
+    988153860, 988219396, 988284932, 988350468, 988416004, 988481540, 988547076, 988612612,
+    988678148, 988743684, 988809220, 988874756, 988940292, 989005828, 989071364, 989136900,
+    989202436, 989267972, 989333508, 989399044, 989464580, 989530116, 989595652, 989661188,
+    989726724, 989792260, 989857796, 989923332, 989988868, 990054404, 990119940, 990185476,
+    990251012, 990316548, 990382084, 990447620, 990513156, 990578692, 990644228, 990709764,
+    990775300, 990840836, 990906372, 990971908, 991037444, 991102980, 991168516, 991234052,
+    991299588, 991365124, 991430660, 991496196, 991561732, 991627268, 991692804, 991758340,
+    991823876, 991889412, 991954948, 992020484, 992086020, 992151556, 992217092, 992282628,
+    992348164, 992413700, 992479236, 992544772, 992610308, 992675844, 992741380, 992806916,
+    992872452, 992937988, 993003524, 993069060, 993134596, 993200132, 993265668, 993331204,
+    993396740, 993462276, 993527812, 993593348, 993658884, 993724420, 993789956, 993855492,
+    993921028, 993986564, 994052100, 994117636, 994183172, 994248708, 994314244, 994379780,
+    994445316, 994510852, 994576388, 994641924, 994707460, 994772996, 994838532, 994904068,
+    994969604, 995035140, 995100676, 995166212, 995231748, 995297284, 995362820, 995428356,
+    995493892, 995559428, 995624964, 995690500, 995756036, 995821572, 995887108, 995952644,
+    996018180, 996083716, 996149252, 996214788, 996280324, 996345860, 996411396, 996476932,
+    996542468, 996608004, 996673540, 996739076, 996804612, 996870148, 996935684, 997001220,
+    997066756, 997132292, 997197828, 997263364, 997328900, 997394436, 997459972, 997525508,
+    997591044, 997656580, 997722116, 997787652, 997853188, 997918724, 997984260, 998049796,
+    998115332, 998180868, 998246404, 998311940, 998377476, 998443012, 998508548, 998574084,
+    998639620, 998705156, 998770692, 998836228, 998901764, 998967300, 999032836, 999098372,
+    999163908, 999229444, 999294980, 999360516, 999426052, 999491588, 999557124, 999622660,
+    999688196, 999753732, 999819268, 999884804, 999950340, 1000015876, 1000081412, 1000146948,
+    1000212484, 1000278020, 1000343556, 1000409092, 1000474628, 1000540164, 1000605700, 1000671236,
+    1000736772, 1000802308, 1000867844, 1000933380, 1000998916, 1001064452, 1001129988, 1001195524,
+    1001261060, 1001326596, 1001392132, 1001457668, 1001523204, 1001588740, 1001654276, 1001719812,
+    1001785348, 1001850884, 1001916420, 1001981956, 1002047492, 1002113028, 1002178564, 1002244100,
+    1002309636, 1002375172, 1002440708, 1002506244, 1002571780, 1002637316, 1002702852, 1002768388,
+    1002833924, 1002899460, 1002964996, 1003030532, 1003096068, 1003161604, 1003227140, 1003292676,
+    1003358212, 1003423748, 1003489284, 1003554820, 1003620356, 1003685892, 1003751428, 1003816964,
+    1003882500, 1003948036, 1004013572, 1004079108, 1004144644, 1004210180, 1004275716, 1004341252,
+    1004406788, 1004472324, 1004537860, 1004603396, 1004668932, 1004734468, 1004800004, 1004865540,
+    1004931076, 1004996612, 1005062148, 1005127684, 1005193220, 1005258756, 1005324292, 1005389828,
+    1005455364, 1005520900, 1005586436, 1005651972, 1005717508, 1005783044, 1005848580, 1005914116,
+    1005979652, 1006045188, 1006110724, 1006176260, 1006241796, 1006307332, 1006372868, 1006438404,
+    1006503940, 1006569476, 1006635012, 1006700548, 1006766084, 1006831620, 1006897156, 1006962692,
+    1007028228, 1007093764, 1007159300, 1007224836, 1007290372, 1007355908, 1007421444, 1007486980,
+    1007552516, 1007618052, 1007683588, 1007749124, 1007814660, 1007880196, 1007945732, 1008011268,
+    1008076804, 1008142340, 1008207876, 1008273412, 1008338948, 1008404484, 1008470020, 1008535556,
+    1008601092, 1008666628, 1008732164, 1008797700, 1008863236, 1008928772, 1008994308, 1009059844,
+    1009125380, 1009190916, 1009256452, 1009321988, 1009387524, 1009453060, 1009518596, 1009584132,
+    1009649668, 1009715204, 1009780740, 1009846276, 1009911812, 1009977348, 1010042884, 1010108420,
+    1010108424, 17928, 1010173956, 1010173960, 17928, 1010173960, 17992, 1010239492,
+    1010239496, 17928, 1010239496, 1010239496, 1010305028, 1010305032, 17928, 1010305032,
+    17992, 1010305032, 18056, 1010305032, 18120, 1010370564, 1010436100, 1010501636,
+    1010567172, 1010632708, 1010632712, 17928, 1010632712, 17992, 1010632712, 18056,
+    1010632712, 18120, 1010698244, 1010763780, 1010829316, 1010829320, 17928, 1010894852,
+    1010894856, 17928, 1010894856, 17992, 1010894856, 18056, 1010960388, 1010960392,
+    17928, 1010960392, 17992, 1011025924, 1011025928, 17928, 1011091460, 1011156996,
+    1011157000, 17928, 1011222532, 1011222536, 17928, 1011222536, 1011943432, 1011288068,
+    1011353604, 1011353608, 17928, 1011419140, 1011484676, 1011484680, 17928, 1011484680,
+    17992, 1011484680, 18056, 1011484680, 18120, 1011484680, 18184, 1011550212,
+    1011615748, 1011615752, 17928, 1011615752, 17992, 1011681284, 1011681288, 17928,
+    1011681288, 17992, 1011746820, 1011812356, 1011877892, 1011877896, 17928, 1011877896,
+    17992, 1011877896, 17928, 1011877896, 17928, 1011943428, 1011943432, 17928,
+    1012008964, 1012008968, 17928, 1012074500, 1012140036, 1012205572, 1012271108, 1012336644,
+    1012402180, 1012467716, 1012533252, 1012598788, 1012664324, 1012729860, 1012795396, 1012860932,
+    1012926468, 1012992004, 1013057540, 1013057544, 17928, 1013057544, 17992, 1013123076,
+    1013123088, 1013123080, 17928, 1013123092, 17928, 1013188612, 1013188624, 1013254148,
+    1013254160, 1013319684, 1013319696, 1013385220, 1013385232, 1013450756, 1013450768, 1013516292,
+    1013516304, 1013581828, 1013581840, 1013647364, 1013647376, 1013647368, 17928, 1013647380,
+    17928, 1013647368, 17992, 1013647380, 17992, 1013712900, 1013712912, 1013778436,
+    1013778448, 1013843972, 1013843984, 1013909508, 1013909520, 1013975044, 1013975056, 1013975048,
+    17928, 1013975060, 17928, 1014040580, 1014040592, 1014106116, 1014106128, 1014171652,
+    1014171664, 1014237188, 1014237200, 1014302724, 1014302736, 1014368260, 1014368272, 1014433796,
+    1014433808, 1014499332, 1014499344, 1014564868, 1014564880, 1014630404, 1014630416, 1014630408,
+    17928, 1014630420, 17928, 1014695940, 1014695952, 1014695944, 17928, 1014695956,
+    17928, 1014695944, 17992, 1014695956, 17992, 1014761476, 1014761488, 1014827012,
+    1014827024, 1014892548, 1014892560, 1014892552, 17928, 1014892564, 17928, 1014958084,
+    1014958096, 1015023620, 1015023632, 1015089156, 1015089168, 1015154692, 1015154704, 1015220228,
+    1015220240, 1015285764, 1015285776, 1015351300, 1015351312, 1015351304, 17928, 1015351316,
+    17928, 1015416836, 1015416848, 1015416840, 17928, 1015416852, 17928, 1015482372,
+    1015482384, 1015547908, 1015547920, 1015613444, 1015613456, 1015678980, 1015678992, 1015744516,
+    1015744528, 1015810052, 1015810056, 17928, 1015875588, 1015941124, 1015941128, 17928,
+    1016006660, 1016072196, 1016137732, 1016137736, 17928, 1016203268, 1016203272, 17928,
+    1016268804, 1016268808, 17928, 1016334340, 1016334344, 17928, 1016399876, 1016399880,
+    17928, 1016465412, 1016465416, 17928, 1016530948, 1016596484, 1016596488, 17928,
+    1016662020, 1016662024, 17928, 1016727556, 1016727560, 17928, 1016793092, 1016793096,
+    17928, 1016858628, 1016858632, 17928, 1016924164, 1016924168, 17928, 1016989700,
+    1017055236, 1017120772, 1017186308, 1017251844, 1017251848, 17928, 1017317380, 1017317384,
+    17928, 1017382916, 1017382920, 17928, 1017448452, 1017448456, 17928, 1017513988,
+    1017579524, 1017579528, 17928, 1017645060, 1017710596, 1017776132, 1017841668, 1017841672,
+    17928, 1017907204, 1017907208, 17928, 1017972740, 1017972744, 17928, 1018038276,
+    1018038280, 17928, 1018103812, 1018103816, 17928, 1018169348, 1018234884, 1018300420,
+    1018365956, 1018365960, 17928, 1018431492, 1018431496, 17928, 1018497028, 1018497032,
+    17928, 1018562564, 1018562568, 17928, 1018628100, 1018693636, 1018759172, 1018824708,
+    1018890244, 1018955780, 1019021316, 1019086852, 1019152388, 1019217924, 1019283460, 1019348996,
+    1019414532, 1019480068, 1019545604, 1019545608, 1036257288, 1019611140, 1019676676, 1019742212,
+    1019807748, 1019873284, 1019938820, 1020004356, 1020069892, 1020135428, 1020200964, 1020266500,
+    1020332036, 1020397572, 1020463108, 1020528644, 1020594180, 1020659716, 1020725252, 1020725256,
+    1036257288, 1020790788, 1020856324, 1020921860, 1020987396, 1021052932, 1021118468, 1021184004,
+    1021249540, 1021315076, 1021380612, 1021446148, 1021511684, 1021577220, 1021642756, 1021708292,
+    1021773828, 1021839364, 1021904900, 1021970436, 1022035972, 1022101508, 1022101512, 1036257288,
+    1022167044, 1022232580, 1022298116, 1022363652, 1022429188, 1022494724, 1022560260, 1022625796,
+    1022691332, 1022756868, 1022822404, 1022887940, 1022953476, 1023019012, 1023084548, 1023150084,
+    1023215620, 1023281156, 1023346692, 1023412228, 1023412232, 1036322824, 1023477764, 1023543300,
+    1023608836, 1023674372, 1023739908, 1023805444, 1023870980, 1023936516, 1024002052, 1024067588,
+    1024133124, 1024133128, 1036257288, 1024198660, 1024264196, 1024329732, 1024395268, 1024460804,
+    1024526340, 1024526344, 1024526344, 1036322824, 1024591876, 1024657412, 1024657416, 1036322824,
+    1024722948, 1024788484, 1024854020, 1024919556, 1024985092, 1025050628, 1025050632, 1036257288,
+    1025116164, 1025181700, 1025247236, 1025312772, 1025378308, 1025443844, 1025509380, 1025574916,
+    1025640452, 1025705988, 1025705992, 1025771524, 1025837060, 1025902596, 1025968132, 1025968136,
+    1026033668, 1026099204, 1026164740, 1026230276, 1026295812, 1026361348, 1026426884, 1026492420,
+    1026557956, 1026623492, 1026689028, 1026754564, 1026820100, 1026885636, 1026951172, 1027016708,
+    1027082244, 1027147780, 1027213316, 1027278852, 1027344388, 1027409924, 1027475460, 1027475464,
+    1036257288, 1027540996, 1027606532, 1027606536, 1027672068, 1027737604, 1027803140, 1027868676,
+    1027934212, 1027999748, 1028065284, 1028130820, 1028196356, 1028261892, 1028327428, 1028392964,
+    1028458500, 1028524036, 1028589572, 1028655108, 1028720644, 1028786180, 1028851716, 1028917252,
+    1028982788, 1029048324, 1029113860, 1029179396, 1029244932, 1029310468, 1029376004, 1029441540,
+    1029507076, 1029572612, 1029638148, 1029703684, 1029769220, 1029834756, 1029900292, 1029965828,
+    1030031364, 1030096900, 1030162436, 1030227972, 1030293508, 1030359044, 1030424580, 1030490116,
+    1030555652, 1030555656, 1036257288, 1030621188, 1030686724, 1030752260, 1030817796, 1030883332,
+    1030948868, 1031014404, 1031079940, 1031145476, 1031211012, 1031276548, 1031342084, 1031407620,
+    1031473156, 1031538692, 1031604228, 1031669764, 1031735300, 1031800836, 1031866372, 1031931908,
+    1031997444, 1032062980, 1032062984, 1036257288, 1032128516, 1032194052, 1032259588, 1032325124,
+    1032390660, 1032456196, 1032456200, 1032456200, 1036322824, 1032521732, 1032587268, 1032652804,
+    1032718340, 1032783876, 1032849412, 1032914948, 1032914952, 1036257288, 1032980484, 1033046020,
+    1033111556, 1033177092, 1033242628, 1033308164, 1033373700, 1033439236, 1033504772, 1033570308,
+    1033635844, 1033701380, 1033766916, 1033832452, 1033897988, 1033963524, 1034029060, 1034094596,
+    1034160132, 1034225668, 1034291204, 1034356740, 1034422276, 1034487812, 1034553348, 1034618884,
+    1034684420, 1034749956, 1034815492, 1034881028, 1034946564, 1035012100, 1035077636, 1035143172,
+    1035208708, 1035274244, 1035339780, 1035405316, 1035470852, 1035536388, 1035601924, 1035667460,
+    1035732996, 1035798532, 1035864068, 1035929604, 1035995140, 1036060676, 1036126212, 1036191748,
+    1036257284, 1036322820, 1036388356, 1036453892, 1036519428, 1036584964, 1036650500, 1036716036,
+    1036781572, 1036847108, 1036912644, 1036978180, 1037043716, 1037109252, 1037174788, 1037240324,
+    1037305860, 1037371396, 1037436932, 1037502468, 1037568004, 1037633540, 1037699076, 1037764612,
+    1037830148, 1037895684, 1037961220, 1038026756, 1038092292, 1038157828, 1038223364, 1038288900,
+    1038354436, 1038419972, 1038485508, 1038551044, 1038616580, 1038682116, 1038747652, 1038813188,
+    1038878724, 1038944260, 1039009796, 1039075332, 1039140868, 1039206404, 1039271940, 1039337476,
+    1039403012, 1039468548, 1039534084, 1039599620, 1039665156, 1039730692, 1039796228, 1039861764,
+    1039927300, 1039992836, 1040058372, 1040123908, 1040189444, 1040254980, 1040320516, 1040386052,
+    1040451588, 1040517124, 1040582660, 1040648196, 1040713732, 1040779268, 1040844804, 1040910340,
+    1040975876, 1041041412, 1041106948, 1041172484, 1041238020, 1041303556, 1041369092, 1041434628,
+    1041500164, 1041565700, 1041631236, 1041696772, 1041762308, 1041827844, 1041893380, 1041958916,
+    1042024452, 1042089988, 1042155524, 1042221060, 1042286596, 1042352132, 1042417668, 1042483204,
+    1042548740, 1042614276, 1042679812, 1042745348, 1042810884, 1042876420, 1042941956, 1043007492,
+    1043073028, 1043138564, 1043204100, 1043269636, 1043335172, 1043400708, 1043466244, 1043531780,
+    1043597316, 1043662852, 1043728388, 1043793924, 1043859460, 1043924996, 1043990532, 1044056068,
+    1044121604, 1044187140, 1044252676, 1044318212, 1044383748, 1044449284, 1044514820, 1044580356,
+    1044645892, 1044711428, 1044776964, 1044842500, 1044908036, 1044973572, 1045039108, 1045104644,
+    1045170180, 1045235716, 1045301252, 1045366788, 1045432324, 1045497860, 1045563396, 1045628932,
+    1045694468, 1045760004, 1045825540, 1045891076, 1045956612, 1046022148, 1046087684, 1046153220,
+    1046218756, 1046284292, 1046349828, 1046415364, 1046480900, 1046546436, 1046611972, 1046677508,
+    1046743044, 1046808580, 1046874116, 1046939652, 1047005188, 1047070724, 1047136260, 1047201796,
+    1047267332, 1047332868, 1047398404, 1047463940, 1047529476, 1047595012, 1047660548, 1047726084,
+    1047791620, 1047857156, 1047922692, 1047988228, 1048053764, 1048119300, 1048184836, 1048250372,
+    1048315908, 1048381444, 1048446980, 1048512516, 1048578052, 1048643588, 1048709124, 1048774660,
+    1048840196, 1048905732, 1048971268, 1049036804, 1049102340, 1049167876, 1049233412, 1049298948,
+    1049364484, 1049430020, 1049495556, 1049561092, 1049626628, 1049692164, 1049757700, 1049823236,
+    1049888772, 1049954308, 1050019844, 1050085380, 1050150916, 1050216452, 1050281988, 1050347524,
+    1050413060, 1050478596, 1050544132, 1050609668, 1050675204, 1050740740, 1050806276, 1050871812,
+    1050937348, 1051002884, 1051068420, 1051133956, 1051199492, 1051265028, 1051330564, 1051396100,
+    1051461636, 1051527172, 1051592708, 1051658244, 1051723780, 1051789316, 1051854852, 1051920388,
+    1051985924, 1052051460, 1052116996, 1052182532, 1052248068, 1052313604, 1052379140, 1052444676,
+    1052510212, 1052575748, 1052641284, 1052706820, 1052772356, 1052837892, 1052903428, 1052968964,
+    1053034500, 1053100036, 1053165572, 1053231108, 1053296644, 1053362180, 1053427716, 1053493252,
+    1053558788, 1053624324, 1053689860, 1053755396, 1053820932, 1053886468, 1053952004, 1054017540,
+    1054083076, 1054148612, 1054214148, 1054279684, 1054345220, 1054410756, 1054476292, 1054541828,
+    1054607364, 1054672900, 1054738436, 1054803972, 1054869508, 1054935044, 1055000580, 1055066116,
+    1055131652, 1055197188, 1055262724, 1055328260, 1055393796, 1055459332, 1055524868, 1055590404,
+    1055655940, 1055721476, 1055787012, 1055852548, 1055918084, 1055983620, 1056049156, 1056114692,
+    1056180228, 1056245764, 1056311300, 1056376836, 1056442372, 1056507908, 1056573444, 1056638980,
+    1056704516, 1056770052, 1056835588, 1056901124, 1056966660, 1057032196, 1057097732, 1057163268,
+    1057228804, 1057294340, 1057359876, 1057425412, 1057490948, 1057556484, 1057622020, 1057687556,
+    1057753092, 1057818628, 1057884164, 1057949700, 1058015236, 1058080772, 1058146308, 1058211844,
+    1058277380, 1058342916, 1058408452, 1058473988, 1058539524, 1058605060, 1058670596, 1058736132,
+    1058801668, 1058867204, 1058932740, 1058998276, 1059063812, 1059129348, 1059194884, 1059260420,
+    1059325956, 1059391492, 1059457028, 1059522564, 1059588100, 1059653636, 1059719172, 1059784708,
+    1059850244, 1059915780, 1059981316, 1060046852, 1060112388, 1060177924, 1060243460, 1060308996,
+    1060374532, 1060440068, 1060505604, 1060571140, 1060636676, 1060702212, 1060767748, 1060833284,
+    1060898820, 1060964356, 1061029892, 1061095428, 1061160964, 1061226500, 1061292036, 1061357572,
+    1061423108, 1061488644, 1061554180, 1061619716, 1061685252, 1061750788, 1061816324, 1061881860,
+    1061947396, 1062012932, 1062078468, 1062144004, 1062209540, 1062275076, 1062340612, 1062406148,
+    1062471684, 1062537220, 1062602756, 1062668292, 1062733828, 1062799364, 1062864900, 1062930436,
+    1062995972, 1063061508, 1063127044, 1063192580, 1063258116, 1063323652, 1063389188, 1063454724,
+    1063520260, 1063585796, 1063651332, 1063716868, 1063782404, 1063847940, 1063913476, 1063979012,
+    1064044548, 1064110084, 1064175620, 1064241156, 1064306692, 1064372228, 1064437764, 1064503300,
+    1064568836, 1064634372, 1064699908, 1064765444, 1064830980, 1064896516, 1064962052, 1065027588,
+    1065093124, 1065158660, 1065224196, 1065289732, 1065355268, 1065420804, 1065486340, 1065551876,
+    1065617412, 1065682948, 1065748484, 1065814020, 1065879556, 1065945092, 1066010628, 1066076164,
+    1066141700, 1066207236, 1066272772, 1066338308, 1066403844, 1066469380, 1066534916, 1066600452,
+    1066665988, 1066731524, 1066797060, 1066862596, 1066928132, 1066993668, 1067059204, 1067124740,
+    1067190276, 1067255812, 1067321348, 1067386884, 1067452420, 1067517956, 1067583492, 1067649028,
+    1067714564, 1067780100, 1067845636, 1067911172, 1067976708, 1068042244, 1068107780, 1068173316,
+    1068238852, 1068304388, 1068369924, 1068435460, 1068500996, 1068566532, 1068632068, 1068697604,
+    1068763140, 1068828676, 1068894212, 1068959748, 1069025284, 1069090820, 1069156356, 1069221892,
+    1069287428, 1069352964, 1069418500, 1069484036, 1069549572, 1069615108, 1069680644, 1069746180,
+    1069811716, 1069877252, 1069942788, 1070008324, 1070073860, 1070139396, 1070204932, 1070270468,
+    1070336004, 1070401540, 1070467076, 1070532612, 1070598148, 1070663684, 1070729220, 1070794756,
+    1070860292, 1070925828, 1070991364, 1071056900, 1071122436, 1071187972, 1071253508, 1071319044,
+    1071384580, 1071450116, 1071515652, 1071581188, 1071646724, 1071712260, 1071777796, 1071843332,
+    1071908868, 1071974404, 1072039940, 1072105476, 1072171012, 1072236548, 1072302084, 1072367620,
+    1072433156, 1072498692, 1072564228, 1072629764, 1072695300, 1072760836, 1072826372, 1072891908,
+    1072957444, 1073022980, 1073088516, 1073154052, 1073219588, 1073285124, 1073350660, 1073416196,
+    1073481732, 1073547268, 1073612804, 1073678340, 1073743876, 1073809412, 1073874948, 1073940484,
+    1074006020, 1074071556, 1074137092, 1074202628, 1074268164, 1074333700, 1074399236, 1074464772,
+    1074530308, 1074595844, 1074661380, 1074726916, 1074792452, 1074857988, 1074923524, 1074989060,
+    1075054596, 1075120132, 1075185668, 1075251204, 1075316740, 1075382276, 1075447812, 1075513348,
+    1075578884, 1075644420, 1075709956, 1075775492, 1075841028, 1075906564, 1075972100, 1076037636,
+    1076103172, 1076168708, 1076234244, 1076299780, 1076365316, 1076430852, 1076496388, 1076561924,
+    1076627460, 1076692996, 1076758532, 1076824068, 1076889604, 1076955140, 1077020676, 1077086212,
+    1077151748, 1077217284, 1077282820, 1077348356, 1077413892, 1077479428, 1077544964, 1077610500,
+    1077676036, 1077741572, 1077807108, 1077872644, 1077938180, 1078003716, 1078069252, 1078134788,
+    1078200324, 1078265860, 1078331396, 1078396932, 1078462468, 1078528004, 1078593540, 1078659076,
+    1078724612, 1078790148, 1078855684, 1078921220, 1078986756, 1079052292, 1079117828, 1079183364,
+    1079248900, 1079314436, 1079379972, 1079445508, 1079511044, 1079576580, 1079642116, 1079707652,
+    1079773188, 1079838724, 1079904260, 1079969796, 1080035332, 1080100868, 1080166404, 1080231940,
+    1080297476, 1080363012, 1080428548, 1080494084, 1080559620, 1080625156, 1080690692, 1080756228,
+    1080821764, 1080887300, 1080952836, 1081018372, 1081083908, 1081149444, 1081214980, 1081280516,
+    1081346052, 1081411588, 1081477124, 1081542660, 1081608196, 1081673732, 1081739268, 1081804804,
+    1081870340, 1081935876, 1082001412, 1082066948, 1082132484, 1082198020, 1082263556, 1082329092,
+    1082394628, 1082460164, 1082525700, 1082591236, 1082656772, 1082722308, 1082787844, 1082853380,
+    1082918916, 1082984452, 1083049988, 1083115524, 1083181060, 1083246596, 1083312132, 1083377668,
+    1083443204, 1083508740, 1083574276, 1083639812, 1083705348, 1083770884, 1083836420, 1083901956,
+    1083967492, 1084033028, 1084098564, 1084164100, 1084229636, 1084295172, 1084360708, 1084426244,
+    1084491780, 1084557316, 1084622852, 1084688388, 1084753924, 1084819460, 1084884996, 1084950532,
+    1085016068, 1085081604, 1085147140, 1085212676, 1085278212, 1085343748, 1085409284, 1085474820,
+    1085540356, 1085605892, 1085671428, 1085736964, 1085802500, 1085868036, 1085933572, 1085999108,
+    1086064644, 1086130180, 1086195716, 1086261252, 1086326788, 1086392324, 1086457860, 1086523396,
+    1086588932, 1086654468, 1086720004, 1086785540, 1086851076, 1086916612, 1086982148, 1087047684,
+    1087113220, 1087178756, 1087244292, 1087309828, 1087375364, 1087440900, 1087506436, 1087571972,
+    1087637508, 1087703044, 1087768580, 1087834116, 1087899652, 1087965188, 1088030724, 1088096260,
+    1088161796, 1088227332, 1088292868, 1088358404, 1088423940, 1088489476, 1088555012, 1088620548,
+    1088686084, 1088751620, 1088817156, 1088882692, 1088948228, 1089013764, 1089079300, 1089144836,
+    1089210372, 1089275908, 1089341444, 1089406980, 1089472516, 1089538052, 1089603588, 1089669124,
+    1089734660, 1089800196, 1089865732, 1089931268, 1089996804, 1090062340, 1090127876, 1090193412,
+    1090258948, 1090324484, 1090390020, 1090455556, 1090521092, 1090586628, 1090652164, 1090717700,
+    1090783236, 1090848772, 1090914308, 1090979844, 1091045380, 1091110916, 1091176452, 1091241988,
+    1091307524, 1091373060, 1091438596, 1091504132, 1091569668, 1091635204, 1091700740, 1091766276,
+    1091831812, 1091897348, 1091962884, 1092028420, 1092093956, 1092159492, 1092225028, 1092290564,
+    1092356100, 1092421636, 1092487172, 1092552708, 1092618244, 1092683780, 1092749316, 1092814852,
+    1092880388, 1092945924, 1093011460, 1093076996, 1093142532, 1093208068, 1093273604, 1093339140,
+    1093404676, 1093470212, 1093535748, 1093601284, 1093666820, 1093732356, 1093797892, 1093797904,
+    1093863428, 1093863440, 1093928964, 1093928976, 1093994500, 1093994512, 1094060036, 1094060048,
+    1094125572, 1094125584, 1094191108, 1094191120, 1094256644, 1094256656, 1094322180, 1094322192,
+    1094387716, 1094387728, 1094453252, 1094453264, 1094518788, 1094518800, 1094584324, 1094584336,
+    1094649860, 1094649872, 1094715396, 1094715408, 1094780932, 1094780944, 1094846468, 1094846480,
+    1094912004, 1094912016, 1094977540, 1094977552, 1095043076, 1095043088, 1095108612, 1095108624,
+    1095174148, 1095174160, 1095239684, 1095239696, 1095305220, 1095305232, 1095370756, 1095370768,
+    1095436292, 1095436304, 1095501828, 1095501840, 1095567364, 1095567376, 1095632900, 1095632912,
+    1095698436, 1095698448, 1095763972, 1095763984, 1095829508, 1095829520, 1095895044, 1095895056,
+    1095960580, 1095960592, 1096026116, 1096026128, 1096091652, 1096091664, 1096157188, 1096157200,
+    1096222724, 1096222736, 1096288260, 1096288272, 1096353796, 1096353808, 1096419332, 1096419344,
+    1096484868, 1096484880, 1096550404, 1096550416, 1096615940, 1096615952, 1096681476, 1096681488,
+    1096747012, 1096747024, 1096812548, 1096812560, 1096878084, 1096878096, 1096943620, 1096943632,
+    1097009156, 1097009168, 1097074692, 1097074704, 1097140228, 1097140240, 1097205764, 1097205776,
+    1097271300, 1097271312, 1097336836, 1097336848, 1097402372, 1097402384, 1097467908, 1097467920,
+    1097533444, 1097533456, 1097598980, 1097598992, 1097664516, 1097664528, 1097730052, 1097730064,
+    1097795588, 1097795600, 1097861124, 1097861136, 1097926660, 1097926672, 1097992196, 1097992208,
+    1098057732, 1098057744, 1098123268, 1098188804, 1098188808, 52955145, 1098188808, 53020681,
+    1098188812, 1098188836, 52955145, 1098188808, 1106446344, 53020681, 1098188812, 1106446348,
+    1098254340, 1098254344, 1098254372, 1098319876, 1098319880, 52955145, 1098319880, 53020681,
+    1098319884, 1098319908, 52955145, 1098319880, 1106446344, 53020681, 1098319884, 1106446348,
+    1098385412, 1098385416, 52955145, 1098385416, 53020681, 1098385420, 1098385444, 52955145,
+    1098385416, 1106446344, 53020681, 1098385420, 1106446348, 1098450948, 1098450952, 1098450980,
+    1098516484, 1098516488, 52955145, 1098516488, 53020681, 1098516492, 1098516516, 52955145,
+    1098516488, 1106446344, 53020681, 1098516492, 1106446348, 1098582020, 1098582024, 52955145,
+    1098582024, 53020681, 1098582028, 1098582052, 52955145, 1098582024, 1106446344, 53020681,
+    1098582028, 1106446348, 1098647556, 1098647560, 52955145, 1098647560, 53020681, 1098647564,
+    1098647588, 52955145, 1098647560, 1106446344, 53020681, 1098647564, 1106446348, 1098713092,
+    1098713096, 1098713124, 1098778628, 1098778632, 52955145, 1098778632, 53020681, 1098778636,
+    1098778660, 52955145, 1098778632, 1106446344, 53020681, 1098778636, 1106446348, 1098844164,
+    1098844168, 1098844196, 1098909700, 1098909704, 52955145, 1098909704, 53020681, 1098909708,
+    1098909732, 52955145, 1098909704, 1106446344, 53020681, 1098909708, 1106446348, 52955145,
+    1098909704, 1106970632, 1098975240, 1106708488, 1112803336, 53020681, 52955145, 1098909704,
+    1106970632, 1099368456, 1107298312, 53020681, 1098909708, 1107298316, 1098975236, 1098975240,
+    52955145, 1098975240, 53020681, 1098975244, 1098975268, 52955145, 1098975240, 1106446344,
+    53020681, 1098975244, 1106446348, 52955145, 1098975240, 1107298312, 53020681, 1098975244,
+    1107298316, 1098909708, 1107691532, 1099040772, 1099040776, 1099040804, 1099106308, 1099106312,
+    52955145, 1099106312, 53020681, 1099106316, 1099106340, 52955145, 1099106312, 1106446344,
+    53020681, 1099106316, 1106446348, 1099106316, 1106446348, 1113589772, 1098188812, 1106970636,
+    1099171844, 1099171848, 52955145, 1099171848, 53020681, 1099171852, 1099171876, 52955145,
+    1099171848, 1106446344, 53020681, 1099171852, 1106446348, 1099237380, 1099237384, 52955145,
+    1099237384, 53020681, 1099237388, 1099237412, 52955145, 1099237384, 1106446344, 53020681,
+    1099237388, 1106446348, 1099302916, 1099302920, 52955145, 1099302920, 53020681, 1099302924,
+    1099302948, 52955145, 1099302920, 1106446344, 53020681, 1099302924, 1106446348, 1099368452,
+    1099368456, 52955145, 1099368456, 53020681, 1099368460, 1099368484, 52955145, 1099368456,
+    1106446344, 53020681, 1099368460, 1106446348, 1099433988, 1099499524, 1099499528, 1099565060,
+    1099565064, 1099630596, 1099696132, 1099761668, 1099827204, 1099892740, 1099892744, 1099892772,
+    1099958276, 1100023812, 1100023816, 1100089348, 1100089352, 1100154884, 1100154888, 1100220420,
+    1100285956, 1100285960, 1100351492, 1100351496, 1100351524, 1100417028, 1100417032, 1100482564,
+    1100482568, 1100548100, 1100613636, 1100679172, 1100744708, 1100744712, 1100810244, 1100875780,
+    1100875784, 1100941316, 1101006852, 1101006856, 1101072388, 1101072392, 1101137924, 1101137928,
+    1101203460, 1101203464, 1101268996, 1101269000, 1101334532, 1101400068, 1101465604, 1101465608,
+    1101531140, 1101596676, 1101662212, 1101727748, 1101727752, 1101793284, 1101858820, 1101924356,
+    1101989892, 1102055428, 1102120964, 1102186500, 1102252036, 1102317572, 1102383108, 1102383112,
+    1102448644, 1102514180, 1102579716, 1102645252, 1102710788, 1102776324, 1102841860, 1102841864,
+    1102907396, 1102972932, 1103038468, 1103104004, 1103169540, 1103169544, 1103235076, 1103300612,
+    1103366148, 1103431684, 1103497220, 1103562756, 1103628292, 1103693828, 1103759364, 1103824900,
+    1103890436, 1103890440, 1103955972, 1103955976, 1104021508, 1104021512, 1104087044, 1104152580,
+    1104218116, 1104283652, 1104349188, 1104414724, 1104480260, 1104545796, 1104611332, 1104676868,
+    1104742404, 1104807940, 1104873476, 1104939012, 1105004548, 1105070084, 1105135620, 1105201156,
+    1105266692, 1105332228, 1105397764, 1105463300, 1105528836, 1105594372, 1105659908, 1105725444,
+    1105790980, 1105856516, 1105922052, 1105987588, 1106053124, 1106118660, 1106184196, 1106249732,
+    1106315268, 1106380804, 1106380808, 1106380836, 1106446340, 1106446344, 1106446372, 1106511876,
+    1106511880, 1106511908, 1106577412, 1106577416, 1106577444, 1106642948, 1106642952, 1106642980,
+    1106708484, 1106708488, 1106708516, 1106774020, 1106774024, 1106774052, 1106839556, 1106839560,
+    1106839588, 1106905092, 1106905096, 1106905124, 1106970628, 1106970632, 1106970660, 1107036164,
+    1107036168, 1107036196, 1107101700, 1107101704, 1107101732, 1107167236, 1107167240, 1107167268,
+    1107232772, 1107232776, 1107232804, 1107298308, 1107298312, 1107298340, 1107363844, 1107363848,
+    1107363876, 1107429380, 1107429384, 1107429412, 1107494916, 1107494920, 1107494948, 1107560452,
+    1107560456, 1107560484, 1107625988, 1107625992, 1107626020, 1107691524, 1107691528, 1107691556,
+    1107757060, 1107757064, 1107757092, 1107822596, 1107888132, 1107953668, 1108019204, 1108084740,
+    1108150276, 1108215812, 1108281348, 1108346884, 1108412420, 1108477956, 1108543492, 1108609028,
+    1108674564, 1108740100, 1108740104, 1108805636, 1108805640, 1108871172, 1108936708, 1109002244,
+    1109002248, 1109067780, 1109133316, 1109198852, 1109264388, 1109329924, 1109395460, 1109460996,
+    1109526532, 1109592068, 1109592072, 1109657604, 1109657608, 1109723140, 1109788676, 1109788680,
+    1109854212, 1109919748, 1109985284, 1110050820, 1110116356, 1110181892, 1110247428, 1110312964,
+    1110378500, 1110444036, 1110444040, 1110509572, 1110575108, 1110640644, 1110640648, 1110706180,
+    1110771716, 1110837252, 1110902788, 1110968324, 1111033860, 1111099396, 1111164932, 1111230468,
+    1111296004, 1111361540, 1111427076, 1111492612, 1111558148, 1111623684, 1111689220, 1111754756,
+    1111820292, 1111885828, 1111951364, 1112016900, 1112082436, 1112147972, 1112213508, 1112279044,
+    1112344580, 1112410116, 1112475652, 1112541188, 1112606724, 1112672260, 1112737796, 1112737800,
+    1112737828, 1112803332, 1112868868, 1112868872, 1112868900, 1112934404, 1112934408, 1112934436,
+    1112999940, 1113065476, 1113131012, 1113131016, 1113131044, 1113196548, 1113196552, 1113196580,
+    1113262084, 1113262088, 1113262116, 1113327620, 1113327624, 1113327652, 1113393156, 1113393160,
+    1113393188, 1113458692, 1113458696, 1113458724, 1113524228, 1113589764, 1113655300, 1113720836,
+    1113786372, 1113851908, 1113917444, 1113982980, 1114048516, 1114114052, 1114179588, 1114245124,
+    1114310660, 1114376196, 1114441732, 1114507268, 1114572804, 1114638340, 1114638344, 1114703876,
+    1114703880, 1114769412, 1114834948, 1114900484, 1114966020, 1114966024, 1115031556, 1115097092,
+    1115097096, 1115162628, 1115228164, 1115293700, 1115359236, 1115424772, 1115424776, 1115490308,
+    1115555844, 1115621380, 1115686916, 1115686920, 1115752452, 1115817988, 1115817992, 1115883524,
+    1115949060, 1116014596, 1116080132, 1116080136, 1116145668, 1116211204, 1116211208, 1116276740,
+    1116342276, 1116407812, 1116473348, 1116538884, 1116604420, 1116669956, 1116735492, 1116801028,
+    1116866564, 1116932100, 1116997636, 1117063172, 1117128708, 1117194244, 1117259780, 1117325316,
+    1117390852, 1117390856, 1117456388, 1117456392, 1117521924, 1117587460, 1117652996, 1117718532,
+    1117784068, 1117849604, 1117915140, 1117980676, 1118046212, 1118111748, 1118177284, 1118242820,
+    1118308356, 1118373892, 1118439428, 1118504964, 1118570500, 1118636036, 1118701572, 1118767108,
+    1118832644, 1118898180, 1118963716, 1119029252, 1119094788, 1119160324, 1119225860, 1119291396,
+    1119356932, 1119422468, 1119488004, 1119553540, 1119619076, 1119684612, 1119750148, 1119815684,
+    1119881220, 1119946756, 1120012292, 1120077828, 1120143364, 1120208900, 1120274436, 1120339972,
+    1120405508, 1120471044, 1120536580, 1120602116, 1120667652, 1120733188, 1120798724, 1120864260,
+    1120929796, 1120995332, 1121060868, 1121126404, 1121191940, 1121257476, 1121323012, 1121388548,
+    1121454084, 1121519620, 1121585178, 1121585180, 1121585182, 1121585184, 1121585186, 1121585188,
+    1121585190, 1121585208, 526387256, 1124272184, 1121585208, 1123289144, 3640, 526387256,
+    1122895928, 1121585208, 1124272184, 1123420216, 1121585208, 1121585208, 1124730936, 1123485752,
+    3640, 1121585208, 1121650714, 1121650716, 1121650718, 1121650720, 1121650722, 1121650724,
+    1121650726, 1121650744, 1123027000, 1124730936, 1122109496, 3576, 1121650744, 1124730936,
+    1122699320, 1121716250, 1121716252, 1121716254, 1121716256, 1121716258, 1121716260, 1121716262,
+    1121716252, 3524, 1121716258, 3524, 1121716280, 1121912888, 1124730936, 1121781794,
+    1121847322, 1121847324, 1121847326, 1121847328, 1121847330, 1121847332, 1121847334, 1121847352,
+    526387256, 1121978424, 526387256, 1121847352, 1122437176, 1122109496, 526387256, 1122895928,
+    3576, 1121912858, 1121912860, 1121912862, 1121912864, 1121912866, 1121912868, 1121912870,
+    1121912888, 526387256, 1123747896, 1121912888, 1124730936, 1122437176, 1121978394, 1121978396,
+    1121978398, 1121978402, 1121978404, 1121978406, 1121978396, 3524, 1121978402, 3524,
+    1121978424, 1121650744, 1124206648, 1121978424, 1124141112, 1122764856, 1122895928, 1121978424,
+    1124403256, 1124206648, 526387256, 1121978424, 3576, 1124403256, 1124730936, 1121978424,
+    3576, 1124730936, 1123616824, 1122043932, 1122043938, 1122043940, 1122043942, 1122043932,
+    3524, 1122043938, 3524, 1122043960, 3576, 1121978424, 3576, 1122043960,
+    3576, 1123027000, 526387256, 1122043960, 1124010040, 1124206648, 526387256, 1122043960,
+    3576, 1124272184, 1122633784, 3576, 526387256, 1122043960, 1124403256, 1122043960,
+    1124403256, 1122109496, 3576, 1124141112, 1123747896, 1122043960, 1124403256, 1123813432,
+    526387256, 1122895928, 1124272184, 1122043960, 1124403256, 1124468792, 1122764856, 1122895928,
+    1122109468, 1122109470, 1122109474, 1122109476, 1122109478, 1122109468, 3524, 1122109474,
+    3524, 1122109496, 3576, 1124141112, 1123747896, 1122109496, 3576, 1124141112,
+    1123747896, 1122895928, 1124730936, 1122109496, 1124272184, 1122502712, 3576, 1121650744,
+    1124403256, 1122109496, 1124403256, 526387256, 1123158072, 1122175002, 1122175004, 1122175006,
+    1122175010, 1122175012, 1122175014, 1122175004, 3524, 1122175010, 3524, 1122175032,
+    526387256, 1122437176, 1122240540, 1122240546, 1122240548, 1122240550, 1122240540, 3524,
+    1122240546, 3524, 1122240568, 526387256, 1123551288, 3640, 1122240568, 1122240568,
+    1122240556, 1122895916, 1122240568, 1124272184, 1122961464, 1122306076, 1122306082, 1122306084,
+    1122306086, 1122306104, 1122306076, 3524, 1122306082, 3524, 1122306104, 1121650744,
+    1122109496, 1124272184, 1122306104, 1124730936, 1122699320, 526387256, 1123747896, 1122371612,
+    1122371614, 1122371618, 1122371620, 1122371622, 1122371612, 3524, 1122371618, 3524,
+    1122371592, 1123813384, 1122371640, 1124206648, 1124730936, 1122109496, 3576, 1122437148,
+    1122437150, 1122437154, 1122437156, 1122437158, 1122437148, 3524, 1122437154, 3524,
+    1122502684, 1122502690, 1122502692, 1122502694, 1122502684, 3524, 1122502690, 3524,
+    1122502712, 1124730936, 1122699320, 1122502712, 1124730936, 1122895928, 1122568220, 1122568226,
+    1122568228, 1122568230, 1122568220, 3524, 1122568226, 3524, 1122633756, 1122633762,
+    1122633764, 1122633766, 1122633756, 3524, 1122633762, 3524, 1122633784, 3576,
+    526387256, 1122437176, 1122699292, 1122699298, 1122699300, 1122699302, 1122699292, 3524,
+    1122699298, 3524, 1122764826, 1122764828, 1122764830, 1122764832, 1122764834, 1122764836,
+    1122764838, 1122764828, 3524, 1122764834, 3524, 1122830364, 1122830370, 1122830372,
+    1122830374, 1122830364, 3524, 1122830370, 3524, 1122830392, 3576, 1122830392,
+    3576, 1122371640, 1122895900, 1122895902, 1122895906, 1122895908, 1122895910, 1122895900,
+    3524, 1122895906, 3524, 1122895928, 3576, 1124272184, 1122895928, 1124730936,
+    1122961436, 1122961442, 1122961444, 1122961446, 1122961464, 1123223608, 1123026972, 1123026978,
+    1123026980, 1123026982, 1123092508, 1123092510, 1123092514, 1123092516, 1123092518, 1123158044,
+    1123158050, 1123158052, 1123158054, 1123223580, 1123223586, 1123223588, 1123223590, 1123223608,
+    1122764856, 1122895928, 1123289116, 1123289118, 1123289122, 1123289124, 1123289126, 1123289116,
+    3524, 1123289122, 3524, 1123289116, 3588, 1123289122, 3588, 1123289144,
+    3640, 526387256, 1122502712, 1124730936, 1122895928, 1123289144, 3640, 526387256,
+    1122764856, 1123289144, 3576, 526387256, 1124337720, 1124272184, 1123289144, 1121650744,
+    1122764856, 1123354652, 1123354654, 1123354658, 1123354660, 1123354662, 1123354652, 3524,
+    1123354658, 3524, 1123354652, 3588, 1123354658, 3588, 1123354680, 3640,
+    1121585208, 1122437176, 1122895928, 1124272184, 1123354680, 3640, 1122109496, 1124272184,
+    1123354680, 3640, 1122240568, 1123354680, 3576, 1124272184, 1123420188, 1123420190,
+    1123420194, 1123420196, 1123420198, 1123420188, 3524, 1123420194, 3524, 1123420188,
+    3588, 1123420194, 3588, 1123420216, 1121585208, 1124141112, 1122764856, 1122895928,
+    3576, 1123420216, 1121650744, 526387256, 1122895928, 1123420216, 3576, 1122764856,
+    1122371640, 1121847352, 1124272184, 1123420216, 1124141112, 1124730936, 1123485724, 1123485726,
+    1123485730, 1123485732, 1123485734, 1123485724, 3524, 1123485730, 3524, 1123485724,
+    3588, 1123485730, 3588, 1123485752, 3640, 526387256, 1122371640, 3576,
+    1123485752, 3576, 526387256, 1122633784, 1123485752, 1122109496, 1122633784, 526387256,
+    1124272184, 1123485752, 3640, 1122568248, 1123485752, 3640, 1123027000, 1123354680,
+    1123485752, 1124272184, 1122764856, 1123485752, 3640, 1124730936, 1122437176, 1123551260,
+    1123551262, 1123551266, 1123551268, 1123551270, 1123551260, 3524, 1123551266, 3524,
+    1123551260, 3588, 1123551266, 3588, 1123551288, 526387256, 1124272184, 1123551288,
+    526387256, 1124730936, 1123551288, 3640, 1121650744, 1124730936, 1122895928, 1123551288,
+    1121978424, 1123551288, 3576, 1124272184, 1122895928, 1123551288, 1124730936, 1123551288,
+    3640, 1124730936, 1122895928, 3576, 1123616796, 1123616802, 1123616804, 1123616806,
+    1123616824, 1121650744, 1122109496, 1124403256, 1123616824, 1121650744, 1124272184, 1123616776,
+    1122437128, 1123616824, 1122764856, 1123289144, 1123616824, 1124272184, 1122109496, 1123616824,
+    1124730936, 1122371640, 1124075576, 1124730936, 1123682332, 1123682338, 1123682340, 1123682342,
+    1123682360, 1122109496, 1124403256, 1124730936, 1123682360, 1124206648, 1123682360, 1124206648,
+    1123289144, 3576, 526387256, 1124272184, 1123747868, 1123747870, 1123747874, 1123747876,
+    1123747878, 1123813404, 1123813410, 1123813412, 1123813414, 1123813432, 526387256, 1122895928,
+    1124272184, 1123813432, 1121978424, 3576, 1123813432, 1121978424, 3576, 1122895928,
+    1124730936, 1123878940, 1123878946, 1123878948, 1123878950, 1123944474, 1123944476, 1123944478,
+    1123944480, 1123944482, 1123944484, 1123944486, 1123944504, 526387256, 1122895928, 3576,
+    1123944504, 526387256, 1124272184, 1124010010, 1124010012, 1124010014, 1124010016, 1124010018,
+    1124010020, 1124010022, 1124010040, 1121585208, 1124730936, 1124075546, 1124075548, 1124075550,
+    1124075552, 1124075554, 1124075556, 1124075558, 1124075564, 1124206636, 1124141084, 1124141086,
+    1124141090, 1124141092, 1124141094, 1124206620, 1124206622, 1124206626, 1124206628, 1124206630,
+    1124206648, 1122764856, 1122895928, 1124272184, 1124206648, 1124141112, 1124272156, 1124272158,
+    1124272162, 1124272164, 1124272166, 1124272184, 526387256, 1123420216, 3576, 1124272184,
+    1124272184, 1123354680, 3640, 526387256, 1124337692, 1124337694, 1124337698, 1124337700,
+    1124337702, 1124337720, 1123747896, 1124337720, 1124730936, 1122895928, 1122175032, 3576,
+    1124730936, 1124403228, 1124403230, 1124403234, 1124403236, 1124403238, 1124468762, 1124468764,
+    1124468766, 1124468770, 1124468772, 1124468774, 1124468770, 3524, 1124468792, 1122764856,
+    1122895928, 1124534298, 1124534300, 1124534302, 1124534306, 1124534310, 1124534306, 3524,
+    1124599834, 1124599836, 1124599838, 1124599842, 1124599846, 1124599842, 3524, 1124665370,
+    1124665372, 1124665374, 1124665378, 1124665380, 1124665382, 1124665378, 3524, 1124730908,
+    1124730910, 1124730914, 1124730916, 1124796420, 1124861956, 1124927492, 1124993028, 1125058564,
+    1125124100, 1125189636, 1125255172, 1125320708, 1125386244, 1125451780, 1125517316, 1125582852,
+    1125648388, 1125713924, 1125779460, 1125844996, 1125910532, 1125976068, 1126041604, 1126107140,
+    1126172676, 1126238212, 1126303748, 1126369284, 1126434820, 1126500356, 1126565892, 1126631428,
+    1126696964, 1126762500, 1126828036, 1126893572, 1126959108, 1127024644, 1127090180, 1127155716,
+    1127221252, 1127286788, 1127352324, 1127417860, 1127483396, 1127548932, 1127614468, 1127680004,
+    1127745540, 1127811076, 1127876612, 1127942148, 1128007684, 1128073220, 1128138756, 1128204292,
+    1128269828, 1128335364, 1128400900, 1128466436, 1128531972, 1128597508, 1128663044, 1128728580,
+    1128794116, 1128859652, 1128925188, 1128990724, 1129056260, 1129121796, 1129187332, 1129252868,
+    1129318404, 1129383940, 1129449476, 1129515012, 1129580548, 1129646084, 1129711620, 1129777156,
+    1129842692, 1129908228, 1129973764, 1130039300, 1130104836, 1130170372, 1130235908, 1130301444,
+    1130366980, 1130432516, 1130498052, 1130563588, 1130629124, 1130694660, 1130760196, 1130825732,
+    1130891268, 1130956804, 1131022340, 1131087876, 1131153412, 1131218948, 1131284484, 1131350020,
+    1131415556, 1131481092, 1131546628, 1131612164, 1131677700, 1131743236, 1131808772, 1131874308,
+    1131939844, 1132005380, 1132070916, 1132136452, 1132201988, 1132267524, 1132333060, 1132398596,
+    1132464132, 1132529668, 1132595204, 1132660740, 1132726276, 1132791812, 1132857348, 1132922884,
+    1132988420, 1133053956, 1133119492, 1133185028, 1133250564, 1133316100, 1133381636, 1133447172,
+    1133512708, 1133578244, 1133643780, 1133709316, 1133774852, 1133840388, 1133905924, 1133971460,
+    1134036996, 1134102532, 1134168068, 1134233604, 1134299140, 1134364676, 1134430212, 1134495748,
+    1134561284, 1134626820, 1134692356, 1134757892, 1134823428, 1134888964, 1134954500, 1135020036,
+    1135085572, 1135151108, 1135216644, 1135282180, 1135347716, 1135413252, 1135478788, 1135544324,
+    1135609860, 1135675396, 1135740932, 1135806468, 1135872004, 1135937540, 1136003076, 1136068612,
+    1136134148, 1136199684, 1136265220, 1136330756, 1136396292, 1136461828, 1136527364, 1136592900,
+    1136658436, 1136723972, 1136789508, 1136855044, 1136920580, 1136986116, 1137051652, 1137117188,
+    1137182724, 1137248260, 1137313796, 1137379332, 1137444868, 1137510404, 1137575940, 1137641476,
+    1137707012, 1137772548, 1137838084, 1137903620, 1137969156, 1138034692, 1138100228, 1138165764,
+    1138231300, 1138296836, 1138362372, 1138427908, 1138493444, 1138558980, 1138624516, 1138690052,
+    1138755588, 1138821124, 1138886660, 1138952196, 1139017732, 1139083268, 1139148804, 1139214340,
+    1139279876, 1139345412, 1139410948, 1139476484, 1139542020, 1139607556, 1139673092, 1139738628,
+    1139804164, 1139869700, 1139935236, 1140000772, 1140066308, 1140131844, 1140197380, 1140262916,
+    1140328452, 1140393988, 1140459524, 1140525060, 1140590596, 1140656132, 1140721668, 1140787204,
+    1140852740, 1140918276, 1140983812, 1141049348, 1141114884, 1141180420, 1141245956, 1141311492,
+    1141377028, 1141442564, 1141508100, 1141573636, 1141639172, 1141704708, 1141770244, 1141835780,
+    1141901316, 1141966852, 1142032388, 1142097924, 1142163460, 1142228996, 1142294532, 1142360068,
+    1142425604, 1142491140, 1142556676, 1142622212, 1142687748, 1142753284, 1142818820, 1142884356,
+    1142949892, 1143015428, 1143080964, 1143146500, 1143212036, 1143277572, 1143343108, 1143408644,
+    1143474180, 1143539716, 1143539720, 17992, 1143605252, 1143605298, 1143670788, 1143736324,
+    1143801860, 1143867396, 1143932932, 1143998468, 1143998514, 1144064004, 1144129540, 1144195076,
+    1144260612, 1144260658, 1144260616, 17992, 1144326148, 1144326194, 1144391684, 1144457220,
+    1144522756, 1144522802, 1144588292, 1144588296, 17992, 1144653828, 1144719364, 1144784900,
+    1144850436, 1144915972, 1144981508, 1145047044, 1145112580, 1145178116, 1145243652, 1145243656,
+    17992, 1145309188, 1145374724, 1145440260, 1145505796, 1145571332, 1145636868, 1145636872,
+    17992, 1145702404, 1145702408, 17992, 1145767940, 1145833476, 1145833480, 1145899012,
+    1145964548, 1145964552, 17992, 1146030084, 1146030088, 17992, 1146095620, 1146161156,
+    1146161160, 17992, 1146226692, 1146292228, 1146357764, 1146423300, 1146488836, 1146554372,
+    1146619908, 1146685444, 1146750980, 1146816516, 1146816520, 17992, 1146816556, 18028,
+    1146882052, 1146882056, 17992, 1146882056, 18056, 1146947588, 1147013124, 1147078660,
+    1147144196, 1147209732, 1147275268, 1147340804, 1147406340, 1147471876, 1147537412, 1147602948,
+    1147668484, 1147734020, 1147799556, 1147865092, 1147930628, 1147996164, 1148061700, 1148127236,
+    1148192772, 1148258308, 1148323844, 1148389380, 1148454916, 1148520452, 1148585988, 1148651524,
+    1148717060, 1148782596, 1148848132, 1148913668, 1148979204, 1149044740, 1149110276, 1149175812,
+    1149241348, 1149306884, 1149372420, 1149437956, 1149503492, 1149569028, 1149634564, 1149700100,
+    1149765636, 1149831172, 1149896708, 1149962244, 1150027780, 1150093316, 1150158852, 1150224388,
+    1150289924, 1150355460, 1150420996, 1150486532, 1150552068, 1150617604, 1150683140, 1150748676,
+    1150814212, 1150879748, 1150945284, 1151010820, 1151076356, 1151141892, 1151207428, 1151272964,
+    1151338500, 1151404036, 1151469572, 1151535108, 1151600644, 1151666180, 1151731716, 1151797252,
+    1151862788, 1151928324, 1151993860, 1152059396, 1152124932, 1152190468, 1152256004, 1152321540,
+    1152387076, 1152452612, 1152518148, 1152583684, 1152649220, 1152714756, 1152780292, 1152845828,
+    1152911364, 1152976900, 1153042436, 1153107972, 1153173508, 1153239044, 1153304580, 1153370116,
+    1153435652, 1153501188, 1153566724, 1153632260, 1153697796, 1153763332, 1153828868, 1153894404,
+    1153959940, 1154025476, 1154091012, 1154156548, 1154222084, 1154287620, 1154353156, 1154418692,
+    1154484228, 1154549764, 1154615300, 1154680836, 1154746372, 1154811908, 1154877444, 1154942980,
+    1155008516, 1155074052, 1155139588, 1155205124, 1155270660, 1155336196, 1155401732, 1155467268,
+    1155532804, 1155598340, 1155663876, 1155729412, 1155794948, 1155860484, 1155926020, 1155991556,
+    1156057092, 1156122628, 1156188164, 1156253700, 1156319236, 1156384772, 1156450308, 1156515844,
+    1156581380, 1156646916, 1156712452, 1156777988, 1156843524, 1156909060, 1156974596, 1157040132,
+    1157105668, 1157171204, 1157236740, 1157302276, 1157367812, 1157433348, 1157498884, 1157564420,
+    1157629956, 1157695492, 1157761028, 1157826564, 1157892100, 1157957636, 1158023172, 1158088708,
+    1158154244, 1158219780, 1158285316, 1158350852, 1158416388, 1158481924, 1158547460, 1158612996,
+    1158678532, 1158744068, 1158809604, 1158875140, 1158940676, 1159006212, 1159071748, 1159137284,
+    1159202820, 1159268356, 1159333892, 1159399428, 1159464964, 1159530500, 1159596036, 1159661572,
+    1159727108, 1159792644, 1159858180, 1159923716, 1159989252, 1160054788, 1160120324, 1160185860,
+    1160251396, 1160316932, 1160382468, 1160448004, 1160513540, 1160579076, 1160644612, 1160710148,
+    1160775684, 1160841220, 1160906756, 1160972292, 1161037828, 1161103364, 1161168900, 1161234436,
+    1161299972, 1161365508, 1161431044, 1161496580, 1161562116, 1161627652, 1161693188, 1161758724,
+    1161824260, 1161889796, 1161955332, 1162020868, 1162086404, 1162151940, 1162217476, 1162283012,
+    1162348548, 1162414084, 1162479620, 1162545156, 1162610692, 1162676228, 1162741764, 1162807300,
+    1162872836, 1162938372, 1163003908, 1163069444, 1163134980, 1163200516, 1163266052, 1163331588,
+    1163397124, 1163462660, 1163528196, 1163593732, 1163659268, 1163724804, 1163790340, 1163855876,
+    1163921412, 1163986948, 1164052484, 1164118020, 1164183556, 1164249092, 1164314628, 1164380164,
+    1164445700, 1164511236, 1164576772, 1164642308, 1164707844, 1164773380, 1164838916, 1164904452,
+    1164969988, 1165035524, 1165101060, 1165166596, 1165232132, 1165297668, 1165363204, 1165428740,
+    1165494276, 1165559812, 1165625348, 1165690884, 1165756420, 1165821956, 1165887492, 1165953028,
+    1166018564, 1166084100, 1166149636, 1166215172, 1166280708, 1166346244, 1166411780, 1166477316,
+    1166542852, 1166608388, 1166673924, 1166739460, 1166804996, 1166870532, 1166936068, 1167001604,
+    1167067140, 1167132676, 1167198212, 1167263748, 1167329284, 1167394820, 1167460356, 1167525892,
+    1167591428, 1167656964, 1167722500, 1167788036, 1167853572, 1167919108, 1167984644, 1168050180,
+    1168115716, 1168181252, 1168246788, 1168312324, 1168377860, 1168443396, 1168508932, 1168574468,
+    1168640004, 1168705540, 1168771076, 1168836612, 1168902148, 1168967684, 1169033220, 1169098756,
+    1169164292, 1169229828, 1169295364, 1169360900, 1169426436, 1169491972, 1169557508, 1169623044,
+    1169688580, 1169754116, 1169819652, 1169885188, 1169950724, 1170016260, 1170081796, 1170147332,
+    1170212868, 1170278404, 1170343940, 1170409476, 1170475012, 1170540548, 1170606084, 1170671620,
+    1170737156, 1170802692, 1170868228, 1170933764, 1170999300, 1171064836, 1171130372, 1171195908,
+    1171261444, 1171326980, 1171392516, 1171458052, 1171523588, 1171589124, 1171654660, 1171720196,
+    1171785732, 1171851268, 1171916804, 1171982340, 1172047876, 1172113412, 1172178948, 1172244484,
+    1172310020, 1172375556, 1172441092, 1172506628, 1172572164, 1172637700, 1172703236, 1172768772,
+    1172834308, 1172899844, 1172965380, 1173030916, 1173096452, 1173161988, 1173227524, 1173293060,
+    1173358596, 1173424132, 1173489668, 1173555204, 1173620740, 1173686276, 1173751812, 1173817348,
+    1173882884, 1173948420, 1174013956, 1174079492, 1174145028, 1174210564, 1174276100, 1174341636,
+    1174407172, 1174472708, 1174538244, 1174603780, 1174669316, 1174734852, 1174800388, 1174865924,
+    1174931460, 1174996996, 1175062532, 1175128068, 1175193604, 1175259140, 1175324676, 1175390212,
+    1175455748, 1175521284, 1175586820, 1175652356, 1175717892, 1175783428, 1175848964, 1175914500,
+    1175980036, 1176045572, 1176111108, 1176176644, 1176242180, 1176307716, 1176373252, 1176438788,
+    1176504324, 1176569860, 1176635396, 1176700932, 1176766468, 1176832004, 1176897540, 1176963076,
+    1177028612, 1177094148, 1177159684, 1177225220, 1177290756, 1177356292, 1177421828, 1177487364,
+    1177552900, 1177618436, 1177683972, 1177749508, 1177815044, 1177880580, 1177946116, 1178011652,
+    1178077188, 1178142724, 1178208260, 1178273796, 1178339332, 1178404868, 1178470404, 1178535940,
+    1178601476, 1178667012, 1178732548, 1178798084, 1178863620, 1178929156, 1178994692, 1179060228,
+    1179125764, 1179191300, 1179256836, 1179322372, 1179387908, 1179453444, 1179518980, 1179584516,
+    1179650052, 1179715588, 1179781124, 1179846660, 1179912196, 1179977732, 1180043268, 1180108804,
+    1180174340, 1180239876, 1180305412, 1180370948, 1180436484, 1180502020, 1180567556, 1180633092,
+    1180698628, 1180764164, 1180829700, 1180895236, 1180960772, 1181026308, 1181091844, 1181157380,
+    1181222916, 1181288452, 1181353988, 1181419524, 1181485060, 1181550596, 1181616132, 1181681668,
+    1181747204, 1181812740, 1181878276, 1181943812, 1182009348, 1182074884, 1182140420, 1182205956,
+    1182271492, 1182337028, 1182402564, 1182468100, 1182533636, 1182599172, 1182664708, 1182730244,
+    1182795780, 1182861316, 1182926852, 1182992388, 1183057924, 1183123460, 1183188996, 1183254532,
+    1183320068, 1183385604, 1183451140, 1183516676, 1183582212, 1183647748, 1183713284, 1183778820,
+    1183844356, 1183909892, 1183975428, 1184040964, 1184106500, 1184172036, 1184237572, 1184303108,
+    1184368644, 1184434180, 1184499716, 1184565252, 1184630788, 1184696324, 1184761860, 1184827396,
+    1184892932, 1184958468, 1185024004, 1185089540, 1185155076, 1185220612, 1185286148, 1185351684,
+    1185417220, 1185482756, 1185548292, 1185613828, 1185679364, 1185744900, 1185810436, 1185875972,
+    1185941508, 1186007044, 1186072580, 1186138116, 1186203652, 1186269188, 1186334724, 1186400260,
+    1186465796, 1186531332, 1186596868, 1186662404, 1186727940, 1186793476, 1186859012, 1186924548,
+    1186990084, 1187055620, 1187121156, 1187186692, 1187252228, 1187317764, 1187383300, 1187448836,
+    1187514372, 1187579908, 1187645444, 1187710980, 1187776516, 1187842052, 1187907588, 1187973124,
+    1188038660, 1188104196, 1188169732, 1188235268, 1188300804, 1188366340, 1188431876, 1188497412,
+    1188562948, 1188628484, 1188694020, 1188759556, 1188825092, 1188890628, 1188956164, 1189021700,
+    1189087236, 1189152772, 1189218308, 1189283844, 1189349380, 1189414916, 1189480452, 1189545988,
+    1189611524, 1189677060, 1189742596, 1189808132, 1189873668, 1189939204, 1190004740, 1190070276,
+    1190135812, 1190201348, 1190266884, 1190332420, 1190397956, 1190463492, 1190529028, 1190594564,
+    1190660100, 1190725636, 1190791172, 1190856708, 1190922244, 1190987780, 1191053316, 1191118852,
+    1191184388, 1191249924, 1191315460, 1191380996, 1191446532, 1191512068, 1191577604, 1191643140,
+    1191708676, 1191774212, 1191839748, 1191905284, 1191970820, 1192036356, 1192101892, 1192167428,
+    1192232964, 1192298500, 1192364036, 1192429572, 1192495108, 1192560644, 1192626180, 1192691716,
+    1192757252, 1192822788, 1192888324, 1192953860, 1193019396, 1193084932, 1193150468, 1193216004,
+    1193281540, 1193347076, 1193412612, 1193478148, 1193543684, 1193609220, 1193674756, 1193740292,
+    1193805828, 1193871364, 1193936900, 1194002436, 1194067972, 1194133508, 1194199044, 1194264580,
+    1194330116, 1194395652, 1194461188, 1194526724, 1194592260, 1194657796, 1194723332, 1194788868,
+    1194854404, 1194919940, 1194985476, 1195051012, 1195116548, 1195182084, 1195247620, 1195313156,
+    1195378692, 1195444228, 1195509764, 1195575300, 1195640836, 1195706372, 1195771908, 1195837444,
+    1195902980, 1195968516, 1196034052, 1196099588, 1196165124, 1196230660, 1196296196, 1196361732,
+    1196427268, 1196492804, 1196558340, 1196623876, 1196689412, 1196754948, 1196820484, 1196886020,
+    1196951556, 1197017092, 1197082628, 1197148164, 1197213700, 1197279236, 1197344772, 1197410308,
+    1197475844, 1197541380, 1197606916, 1197672452, 1197737988, 1197803524, 1197869060, 1197934596,
+    1198000132, 1198065668, 1198131204, 1198196740, 1198262276, 1198327812, 1198393348, 1198458884,
+    1198524420, 1198589956, 1198655492, 1198721028, 1198786564, 1198852100, 1198917636, 1198983172,
+    1199048708, 1199114244, 1199179780, 1199245316, 1199310852, 1199376388, 1199441924, 1199507460,
+    1199572996, 1199638532, 1199704068, 1199769604, 1199835140, 1199900676, 1199966212, 1200031748,
+    1200097284, 1200162820, 1200228356, 1200293892, 1200359428, 1200424964, 1200490500, 1200556036,
+    1200621572, 1200687108, 1200752644, 1200818180, 1200883716, 1200949252, 1201014788, 1201080324,
+    1201145860, 1201211396, 1201276932, 1201342468, 1201408004, 1201473540, 1201539076, 1201604612,
+    1201670148, 1201735684, 1201801220, 1201866756, 1201932292, 1201997828, 1202063364, 1202128900,
+    1202194436, 1202259972, 1202325508, 1202391044, 1202456580, 1202522116, 1202587652, 1202653188,
+    1202718724, 1202784260, 1202849796, 1202915332, 1202980868, 1203046404, 1203111940, 1203177476,
+    1203243012, 1203308548, 1203374084, 1203439620, 1203505156, 1203570692, 1203636228, 1203701764,
+    1203767300, 1203832836, 1203898372, 1203963908, 1204029444, 1204094980, 1204160516, 1204226052,
+    1204291588, 1204357124, 1204422660, 1204488196, 1204553732, 1204619268, 1204684804, 1204750340,
+    1204815876, 1204881412, 1204946948, 1205012484, 1205078020, 1205143556, 1205209092, 1205274628,
+    1205340164, 1205405700, 1205471236, 1205536772, 1205602308, 1205667844, 1205733380, 1205798916,
+    1205864452, 1205929988, 1205995524, 1206061060, 1206126596, 1206192132, 1206257668, 1206323204,
+    1206388740, 1206454276, 1206519812, 1206585348, 1206650884, 1206716420, 1206781956, 1206847492,
+    1206913028, 1206978564, 1207044100, 1207109636, 1207175172, 1207240708, 1207306244, 1207371780,
+    1207437316, 1207502852, 1207568388, 1207633924, 1207699460, 1207764996, 1207830532, 1207896068,
+    1207961604, 1208027140, 1208092676, 1208158212, 1208223748, 1208289284, 1208354820, 1208420356,
+    1208485892, 1208551428, 1208616964, 1208682500, 1208748036, 1208813572, 1208879108, 1208944644,
+    1209010180, 1209075716, 1209141252, 1209206788, 1209272324, 1209337860, 1209403396, 1209468932,
+    1209534468, 1209600004, 1209665540, 1209731076, 1209796612, 1209862148, 1209927684, 1209993220,
+    1210058756, 1210124292, 1210189828, 1210255364, 1210320900, 1210386436, 1210451972, 1210517508,
+    1210583044, 1210648580, 1210714116, 1210779652, 1210845188, 1210910724, 1210976260, 1211041796,
+    1211107332, 1211172868, 1211238404, 1211303940, 1211369476, 1211435012, 1211500548, 1211566084,
+    1211631620, 1211697156, 1211762692, 1211828228, 1211893764, 1211959300, 1212024836, 1212090372,
+    1212155908, 1212221444, 1212286980, 1212352516, 1212418052, 1212483588, 1212549124, 1212614660,
+    1212680196, 1212745732, 1212811268, 1212876804, 1212942340, 1213007876, 1213073412, 1213138948,
+    1213204484, 1213270020, 1213335556, 1213401092, 1213466628, 1213532164, 1213597700, 1213663236,
+    1213728772, 1213794308, 1213859844, 1213925380, 1213990916, 1214056452, 1214121988, 1214187524,
+    1214253060, 1214318596, 1214384132, 1214449668, 1214515204, 1214580740, 1214646276, 1214711812,
+    1214777348, 1214842884, 1214908420, 1214973956, 1215039492, 1215105028, 1215170564, 1215236100,
+    1215301636, 1215367172, 1215432708, 1215498244, 1215563780, 1215629316, 1215694852, 1215760388,
+    1215825924, 1215891460, 1215956996, 1216022532, 1216088068, 1216153604, 1216219140, 1216284676,
+    1216350212, 1216415748, 1216481284, 1216546820, 1216612356, 1216677892, 1216743428, 1216808964,
+    1216874500, 1216940036, 1217005572, 1217071108, 1217136644, 1217202180, 1217267716, 1217333252,
+    1217398788, 1217464324, 1217529860, 1217595396, 1217660932, 1217726468, 1217792004, 1217857540,
+    1217923076, 1217988612, 1218054148, 1218119684, 1218185220, 1218250756, 1218316292, 1218381828,
+    1218447364, 1218512900, 1218578436, 1218643972, 1218709508, 1218775044, 1218840580, 1218906116,
+    1218971652, 1219037188, 1219102724, 1219168260, 1219233796, 1219299332, 1219364868, 1219430404,
+    1219495940, 1219561476, 1219627012, 1219692548, 1219758084, 1219823620, 1219889156, 1219954692,
+    1220020228, 1220085764, 1220151300, 1220216836, 1220282372, 1220347908, 1220413444, 1220478980,
+    1220544516, 1220610052, 1220675588, 1220741124, 1220806660, 1220872196, 1220937732, 1221003268,
+    1221068804, 1221134340, 1221199876, 1221265412, 1221330948, 1221396484, 1221462020, 1221527556,
+    1221593092, 1221658628, 1221724164, 1221789700, 1221855236, 1221920772, 1221986308, 1222051844,
+    1222117380, 1222182916, 1222248452, 1222313988, 1222379524, 1222445060, 1222510596, 1222576132,
+    1222641668, 1222707204, 1222772740, 1222838276, 1222903812, 1222969348, 1223034884, 1223100420,
+    1223165956, 1223231492, 1223297028, 1223362564, 1223428100, 1223493636, 1223559172, 1223624708,
+    1223690244, 1223755780, 1223821316, 1223886852, 1223952388, 1224017924, 1224083460, 1224148996,
+    1224214532, 1224280068, 1224345604, 1224411140, 1224476676, 1224542212, 1224607748, 1224673284,
+    1224738820, 1224804356, 1224869892, 1224935428, 1225000964, 1225066500, 1225132036, 1225197572,
+    1225263108, 1225328644, 1225394180, 1225459716, 1225525252, 1225590788, 1225656324, 1225721860,
+    1225787396, 1225852932, 1225918468, 1225984004, 1226049540, 1226115076, 1226180612, 1226246148,
+    1226311684, 1226377220, 1226442756, 1226508292, 1226573828, 1226639364, 1226704900, 1226770436,
+    1226835972, 1226901508, 1226967044, 1226967048, 1227032580, 1227098116, 1227163652, 1227229188,
+    1227294724, 1227360260, 1227425796, 1227491332, 1227556868, 1227622404, 1227687940, 1227753476,
+    1227819012, 1227819016, 1227884548, 1227950084, 1228015620, 1228081156, 1228146692, 1228212228,
+    1228277764, 1228343300, 1228408836, 1228474372, 1228539908, 1228605444, 1228670980, 1228736516,
+    1228802052, 1228867588, 1228933124, 1228998660, 1228998664, 1229064196, 1229129732, 1229195268,
+    1229260804, 1229326340, 1229391876, 1229457412, 1229522948, 1229588484, 1229654020, 1229719556,
+    1229785092, 1229850628, 1229916164, 1229981700, 1230047236, 1230112772, 1230178308, 1230243844,
+    1230309380, 1230374916, 1230440452, 1230505988, 1230571524, 1230637060, 1230702596, 1230768132,
+    1230833668, 1230833672, 1230899204, 1230964740, 1231030276, 1231095812, 1231161348, 1231226884,
+    1231292420, 1231357956, 1231423492, 1231489028, 1231554564, 1231620100, 1231685636, 1231751172,
+    1231816708, 1231882244, 1231947780, 1232013316, 1232078852, 1232144388, 1232209924, 1232275460,
+    1232340996, 1232406532, 1232472068, 1232537604, 1232603140, 1232668676, 1232734212, 1232799748,
+    1232865284, 1232930820, 1232996356, 1233061892, 1233127428, 1233192964, 1233258500, 1233324036,
+    1233389572, 1233455108, 1233520644, 1233586180, 1233651716, 1233717252, 1233782788, 1233848324,
+    1233913860, 1233979396, 1234044932, 1234110468, 1234176004, 1234241540, 1234307076, 1234372612,
+    1234438148, 1234503684, 1234569220, 1234634756, 1234700292, 1234765828, 1234831364, 1234896900,
+    1234962436, 1235027972, 1235093508, 1235159044, 1235224580, 1235290116, 1235355652, 1235421188,
+    1235486724, 1235552260, 1235617796, 1235683332, 1235748868, 1235814404, 1235879940, 1235945476,
+    1236011012, 1236076548, 1236142084, 1236207620, 1236207632, 1236273156, 1236273168, 1236338692,
+    1236338704, 1236404228, 1236404240, 1236469764, 1236469776, 1236535300, 1236535312, 1236600836,
+    1236600848, 1236666372, 1236666384, 1236731908, 1236731920, 1236797444, 1236797456, 1236862980,
+    1236862992, 1236928516, 1236928528, 1236994052, 1236994064, 1237059588, 1237059600, 1237125124,
+    1237125136, 1237190660, 1237190672, 1237256196, 1237256208, 1237321732, 1237321744, 1237387268,
+    1237387280, 1237452804, 1237452816, 1237518340, 1237518352, 1237583876, 1237583888, 1237649412,
+    1237649424, 1237714948, 1237714960, 1237780484, 1237780496, 1237846020, 1237846032, 1237911556,
+    1237911568, 1237977092, 1237977104, 1238042628, 1238042640, 1238108164, 1238108176, 1238173700,
+    1238173712, 1238239236, 1238239248, 1238304772, 1238370308, 1238435844, 1238501380, 1238566916,
+    1238632452, 1238697988, 1238763524, 1238829060, 1238894596, 1238960132, 1239025668, 1239091204,
+    1239156740, 1239222276, 1239287812, 1239353348, 1239418884, 1239484420, 1239549956, 1239615492,
+    1239681028, 1239746564, 1239812100, 1239877636, 1239943172, 1240008708, 1240074244, 1240139780,
+    1240205316, 1240270852, 1240336388, 1240401924, 1240467460, 1240532996, 1240598532, 1240664068,
+    1240729604, 1240795140, 1240860676, 1240926212, 1240991748, 1241057284, 1241122820, 1241188356,
+    1241253892, 1241319428, 1241384964, 1241450500, 1241516036, 1241581572, 1241647108, 1241712644,
+    1241778180, 1241843716, 1241909252, 1241974788, 1242040324, 1242105860, 1242171396, 1242236932,
+    1242302468, 1242368004, 1242433540, 1242499076, 1242564612, 1242630148, 1242695684, 1242761220,
+    1242826756, 1242892292, 1242957828, 1243023364, 1243088900, 1243154436, 1243219972, 1243285508,
+    1243351044, 1243416580, 1243482116, 1243547652, 1243613188, 1243678724, 1243744260, 1243809796,
+    1243875332, 1243940868, 1244006404, 1244071940, 1244137476, 1244203012, 1244268548, 1244334084,
+    1244399620, 1244465156, 1244530692, 1244596228, 1244661764, 1244727300, 1244792836, 1244858372,
+    1244923908, 1244989444, 1245054980, 1245120516, 1245186052, 1245251588, 1245317124, 1245382660,
+    1245448196, 1245513732, 1245579268, 1245644804, 1245710340, 1245775876, 1245841412, 1245906948,
+    1245972484, 1246038020, 1246103556, 1246169092, 1246234628, 1246300164, 1246365700, 1246431236,
+    1246496772, 1246562308, 1246627844, 1246693380, 1246758916, 1246824452, 1246889988, 1246955524,
+    1247021060, 1247086596, 1247152132, 1247217668, 1247283204, 1247348740, 1247414276, 1247479812,
+    1247545348, 1247610884, 1247676420, 1247741956, 1247807492, 1247873028, 1247938564, 1248004100,
+    1248069636, 1248135172, 1248200708, 1248266244, 1248331780, 1248397316, 1248462852, 1248528388,
+    1248593924, 1248659460, 1248724996, 1248790532, 1248856068, 1248921604, 1248987140, 1249052676,
+    1249118212, 1249183748, 1249249284, 1249314820, 1249380356, 1249445892, 1249511428, 1249576964,
+    1249642500, 1249708036, 1249773572, 1249839108, 1249904644, 1249970180, 1250035716, 1250101252,
+    1250166788, 1250232324, 1250297860, 1250363396, 1250428932, 1250494468, 1250560004, 1250625540,
+    1250691076, 1250756612, 1250822148, 1250887684, 1250953220, 1251018756, 1251084292, 1251149828,
+    1251215364, 1251280900, 1251346436, 1251411972, 1251477508, 1251543044, 1251608580, 1251674116,
+    1251739652, 1251805188, 1251870724, 1251936260, 1252001796, 1252067332, 1252132868, 1252198404,
+    1252263940, 1252329476, 1252395012, 1252460548, 1252526084, 1252591620, 1252657156, 1252722692,
+    1252788228, 1252853764, 1252919300, 1252984836, 1253050372, 1253115908, 1253181444, 1253246980,
+    1253312516, 1253378052, 1253443588, 1253509124, 1253574660, 1253640196, 1253705732, 1253771268,
+    1253836804, 1253902340, 1253967876, 1254033412, 1254098948, 1254164484, 1254230020, 1254295556,
+    1254361092, 1254426628, 1254492164, 1254557700, 1254623236, 1254688772, 1254754308, 1254819844,
+    1254885380, 1254950916, 1255016452, 1255081988, 1255147524, 1255213060, 1255278596, 1255344132,
+    1255409668, 1255475204, 1255540740, 1255606276, 1255671812, 1255737348, 1255802884, 1255868420,
+    1255933956, 1255999492, 1256065028, 1256130564, 1256196100, 1256261636, 1256327172, 1256392708,
+    1256458244, 1256523780, 1256589316, 1256654852, 1256720388, 1256785924, 1256851460, 1256916996,
+    1256982532, 1257048068, 1257113604, 1257179140, 1257244676, 1257310212, 1257375748, 1257441284,
+    1257506820, 1257572356, 1257637892, 1257703428, 1257768964, 1257834500, 1257900036, 1257965572,
+    1258031108, 1258096644, 1258162180, 1258227716, 1258293252, 1258358788, 1258424324, 1258489860,
+    1258555396, 1258620932, 1258686468, 1258752004, 1258817540, 1258883076, 1258948612, 1259014148,
+    1259079684, 1259145220, 1259210756, 1259276292, 1259341828, 1259407364, 1259472900, 1259538436,
+    1259603972, 1259669508, 1259735044, 1259800580, 1259866116, 1259931652, 1259997188, 1260062724,
+    1260128260, 1260193796, 1260259332, 1260324868, 1260390404, 1260455940, 1260521476, 1260587012,
+    1260652548, 1260718084, 1260783620, 1260849156, 1260914692, 1260980228, 1261045764, 1261111300,
+    1261176836, 1261242372, 1261307908, 1261373444, 1261438980, 1261504516, 1261570052, 1261635588,
+    1261701124, 1261766660, 1261832196, 1261897732, 1261963268, 1262028804, 1262094340, 1262159876,
+    1262225412, 1262290948, 1262356484, 1262422020, 1262487556, 1262553092, 1262618628, 1262684164,
+    1262749700, 1262815236, 1262880772, 1262946308, 1263011844, 1263077380, 1263142916, 1263208452,
+    1263273988, 1263339524, 1263405060, 1263470596, 1263536132, 1263601668, 1263667204, 1263732740,
+    1263798276, 1263863812, 1263929348, 1263994884, 1264060420, 1264125956, 1264191492, 1264257028,
+    1264322564, 1264388100, 1264453636, 1264519172, 1264584708, 1264650244, 1264715780, 1264781316,
+    1264846852, 1264912388, 1264977924, 1265043460, 1265043472, 1265108996, 1265109008, 1265174532,
+    1265174544, 1265240068, 1265240080, 1265305604, 1265305616, 1265371140, 1265371152, 1265436676,
+    1265436688, 1265502212, 1265502224, 1265567748, 1265567760, 1265633284, 1265633296, 1265698820,
+    1265698832, 1265764356, 1265764368, 1265829892, 1265829904, 1265895428, 1265895440, 1265960964,
+    1265960976, 1266026500, 1266026512, 1266092036, 1266092048, 1266157572, 1266157584, 1266223108,
+    1266223120, 1266288644, 1266288656, 1266354180, 1266354192, 1266419716, 1266419728, 1266485252,
+    1266485264, 1266550788, 1266550800, 1266616324, 1266616336, 1266681860, 1266681872, 1266747396,
+    1266747408, 1266812932, 1266812944, 1266878468, 1266878480, 1266944004, 1266944016, 1267009540,
+    1267009552, 1267075076, 1267075088, 1267140612, 1267140624, 1267206148, 1267206160, 1267271684,
+    1267271696, 1267337220, 1267337232, 1267402756, 1267402768, 1267468292, 1267468304, 1267533828,
+    1267533840, 1267599364, 1267599376, 1267664900, 1267730436, 1267795972, 1267861508, 1267927044,
+    1267992580, 1268058116, 1268123652, 1268189188, 1268254724, 1268320260, 1268385796, 1268451332,
+    1268516868, 1268582404, 1268647940, 1268713476, 1268779012, 1268844548, 1268910084, 1268975620,
+    1269041156, 1269106692, 1269172228, 1269237764, 1269303300, 1269368836, 1269434372, 1269499908,
+    1269565444, 1269630980, 1269696516, 1269762052, 1269827588, 1269893124, 1269958660, 1270024196,
+    1270089732, 1270155268, 1270220804, 1270286340, 1270351876, 1270417412, 1270482948, 1270548484,
+    1270614020, 1270679556, 1270745092, 1270810628, 1270876164, 1270941700, 1271007236, 1271072772,
+    1271138308, 1271203844, 1271269380, 1271334916, 1271400452, 1271465988, 1271531524, 1271597060,
+    1271662596, 1271728132, 1271793668, 1271859204, 1271924740, 1271990276, 1272055812, 1272121348,
+    1272186884, 1272252420, 1272317956, 1272383492, 1272449028, 1272514564, 1272580100, 1272645636,
+    1272711172, 1272776708, 1272842244, 1272907780, 1272973316, 1273038852, 1273104388, 1273169924,
+    1273235460, 1273300996, 1273366532, 1273432068, 1273497604, 1273563140, 1273628676, 1273694212,
+    1273759748, 1273825284, 1273890820, 1273956356, 1274021892, 1274087428, 1274152964, 1274218500,
+    1274284036, 1274349572, 1274415108, 1274480644, 1274546180, 1274611716, 1274677252, 1274742788,
+    1274808324, 1274873860, 1274939396, 1275004932, 1275070468, 1275136004, 1275201540, 1275267076,
+    1275332612, 1275398148, 1275463684, 1275529220, 1275594756, 1275660292, 1275725828, 1275791364,
+    1275856900, 1275922436, 1275987972, 1276053508, 1276119044, 1276184580, 1276250116, 1276315652,
+    1276381188, 1276446724, 1276512260, 1276577796, 1276643332, 1276708868, 1276774404, 1276839940,
+    1276905476, 1276971012, 1277036548, 1277102084, 1277167620, 1277233156, 1277298692, 1277364228,
+    1277429764, 1277495300, 1277560836, 1277626372, 1277691908, 1277757444, 1277822980, 1277888516,
+    1277954052, 1278019588, 1278085124, 1278150660, 1278216196, 1278281732, 1278347268, 1278412804,
+    1278478340, 1278543876, 1278609412, 1278674948, 1278740484, 1278806020, 1278871556, 1278937092,
+    1279002628, 1279068164, 1279133700, 1279199236, 1279264772, 1279330308, 1279395844, 1279461380,
+    1279526916, 1279592452, 1279657988, 1279723524, 1279789060, 1279854596, 1279920132, 1279985668,
+    1280051204, 1280116740, 1280182276, 1280247812, 1280313348, 1280378884, 1280444420, 1280509956,
+    1280575492, 1280641028, 1280706564, 1280772100, 1280837636, 1280903172, 1280968708, 1281034244,
+    1281099780, 1281165316, 1281230852, 1281296388, 1281361924, 1281427460, 1281492996, 1281558532,
+    1281624068, 1281689604, 1281755140, 1281820676, 1281886212, 1281951748, 1282017284, 1282082820,
+    1282148356, 1282213892, 1282279428, 1282344964, 1282410500, 1282476036, 1282541572, 1282607108,
+    1282672644, 1282738180, 1282803716, 1282869252, 1282934788, 1283000324, 1283065860, 1283131396,
+    1283196932, 1283262468, 1283328004, 1283393540, 1283459076, 1283524612, 1283590148, 1283655684,
+    1283721220, 1283786756, 1283852292, 1283917828, 1283983364, 1284048900, 1284114436, 1284179972,
+    1284245508, 1284311044, 1284376580, 1284442116, 1284507652, 1284573188, 1284638724, 1284704260,
+    1284769796, 1284835332, 1284900868, 1284966404, 1285031940, 1285097476, 1285163012, 1285228548,
+    1285294084, 1285359620, 1285425156, 1285490692, 1285556228, 1285621764, 1285687300, 1285752836,
+    1285818372, 1285883908, 1285949444, 1286014980, 1286080516, 1286146052, 1286211588, 1286277124,
+    1286342660, 1286408196, 1286473732, 1286539268, 1286604804, 1286670340, 1286735876, 1286801412,
+    1286866948, 1286932484, 1286998020, 1287063556, 1287129092, 1287194628, 1287260164, 1287325700,
+    1287391236, 1287456772, 1287522308, 1287587844, 1287653380, 1287718916, 1287784452, 1287849988,
+    1287915524, 1287981060, 1288046596, 1288112132, 1288177668, 1288243204, 1288308740, 1288374276,
+    1288439812, 1288505348, 1288570884, 1288636420, 1288701956, 1288767492, 1288833028, 1288898564,
+    1288964100, 1289029636, 1289095172, 1289160708, 1289226244, 1289291780, 1289357316, 1289422852,
+    1289488388, 1289553924, 1289619460, 1289684996, 1289750532, 1289816068, 1289881604, 1289947140,
+    1290012676, 1290078212, 1290143748, 1290209284, 1290274820, 1290340356, 1290405892, 1290471428,
+    1290536964, 1290602500, 1290668036, 1290733572, 1290799108, 1290864644, 1290930180, 1290995716,
+    1291061252, 1291126788, 1291192324, 1291257860, 1291323396, 1291388932, 1291454468, 1291520004,
+    1291585540, 1291651076, 1291716612, 1291782148, 1291847684, 1291913220, 1291978756, 1292044292,
+    1292109828, 1292175364, 1292240900, 1292306436, 1292371972, 1292437508, 1292503044, 1292568580,
+    1292634116, 1292699652, 1292765188, 1292830724, 1292896260, 1292961796, 1293027332, 1293092868,
+    1293158404, 1293223940, 1293289476, 1293355012, 1293420548, 1293486084, 1293551620, 1293617156,
+    1293682692, 1293748228, 1293813764, 1293879300, 1293944836, 1294010372, 1294075908, 1294141444,
+    1294206980, 1294272516, 1294338052, 1294403588, 1294469124, 1294534660, 1294600196, 1294665732,
+    1294731268, 1294796804, 1294862340, 1294927876, 1294993412, 1295058948, 1295124484, 1295190020,
+    1295255556, 1295321092, 1295386628, 1295452164, 1295517700, 1295583236, 1295648772, 1295714308,
+    1295779844, 1295845380, 1295910916, 1295976452, 1296041988, 1296107524, 1296173060, 1296238596,
+    1296304132, 1296369668, 1296435204, 1296500740, 1296566276, 1296631812, 1296697348, 1296762884,
+    1296828420, 1296893956, 1296959492, 1297025028, 1297090564, 1297156100, 1297221636, 1297287172,
+    1297352708, 1297418244, 1297483780, 1297549316, 1297614852, 1297680388, 1297745924, 1297811460,
+    1297876996, 1297942532, 1298008068, 1298073604, 1298139140, 1298204676, 1298270212, 1298335748,
+    1298401284, 1298466820, 1298532356, 1298597892, 1298663428, 1298728964, 1298794500, 1298860036,
+    1298925572, 1298991108, 1299056644, 1299122180, 1299187716, 1299253252, 1299318788, 1299384324,
+    1299449860, 1299515396, 1299580932, 1299646468, 1299712004, 1299777540, 1299843076, 1299908612,
+    1299974148, 1300039684, 1300105220, 1300170756, 1300236292, 1300301828, 1300367364, 1300432900,
+    1300498436, 1300563972, 1300629508, 1300695044, 1300760580, 1300826116, 1300891652, 1300957188,
+    1301022724, 1301088260, 1301153796, 1301219332, 1301284868, 1301350404, 1301415940, 1301481476,
+    1301547012, 1301612548, 1301678084, 1301743620, 1301809156, 1301874692, 1301940228, 1302005764,
+    1302071300, 1302136836, 1302202372, 1302267908, 1302333444, 1302398980, 1302464516, 1302530052,
+    1302595588, 1302661124, 1302726660, 1302792196, 1302857732, 1302923268, 1302988804, 1303054340,
+    1303119876, 1303185412, 1303250948, 1303316484, 1303382020, 1303447556, 1303513092, 1303578628,
+    1303644164, 1303709700, 1303775236, 1303840772, 1303906308, 1303971844, 1304037380, 1304102916,
+    1304168452, 1304233988, 1304299524, 1304365060, 1304430596, 1304496132, 1304561668, 1304627204,
+    1304692740, 1304758276, 1304823812, 1304889348, 1304954884, 1305020420, 1305085956, 1305151492,
+    1305217028, 1305282564, 1305348100, 1305413636, 1305479172, 1305544708, 1305610244, 1305675780,
+    1305741316, 1305806852, 1305872388, 1305937924, 1306003460, 1306068996, 1306134532, 1306200068,
+    1306265604, 1306331140, 1306396676, 1306462212, 1306527748, 1306593284, 1306658820, 1306724356,
+    1306789892, 1306855428, 1306920964, 1306986500, 1307052036, 1307117572, 1307183108, 1307248644,
+    1307314180, 1307379716, 1307445252, 1307510788, 1307576324, 1307641860, 1307707396, 1307772932,
+    1307838468, 1307904004, 1307969540, 1308035076, 1308100612, 1308166148, 1308231684, 1308297220,
+    1308362756, 1308428292, 1308493828, 1308559364, 1308624900, 1308690436, 1308755972, 1308821508,
+    1308887044, 1308952580, 1309018116, 1309083652, 1309149188, 1309214724, 1309280260, 1309345796,
+    1309411332, 1309476868, 1309542404, 1309607940, 1309673476, 1309739012, 1309804548, 1309870084,
+    1309935620, 1310001156, 1310066692, 1310132228, 1310197764, 1310263300, 1310328836, 1310394372,
+    1310459908, 1310525444, 1310590980, 1310656516, 1310722052, 1310787588, 1310853124, 1310918660,
+    1310984196, 1311049732, 1311115268, 1311180804, 1311246340, 1311311876, 1311377412, 1311442948,
+    1311508484, 1311574020, 1311639556, 1311705092, 1311770628, 1311836164, 1311901700, 1311967236,
+    1312032772, 1312098308, 1312163844, 1312229380, 1312294916, 1312360452, 1312425988, 1312491524,
+    1312557060, 1312622596, 1312688132, 1312753668, 1312819204, 1312884740, 1312950276, 1313015812,
+    1313081348, 1313146884, 1313212420, 1313277956, 1313343492, 1313409028, 1313474564, 1313540100,
+    1313605636, 1313671172, 1313736708, 1313802244, 1313867780, 1313933316, 1313998852, 1314064388,
+    1314129924, 1314195460, 1314260996, 1314326532, 1314392068, 1314457604, 1314523140, 1314588676,
+    1314654212, 1314719748, 1314785284, 1314850820, 1314916356, 1314981892, 1315047428, 1315112964,
+    1315178500, 1315244036, 1315309572, 1315375108, 1315440644, 1315506180, 1315571716, 1315637252,
+    1315702788, 1315768324, 1315833860, 1315899396, 1315964932, 1316030468, 1316096004, 1316161540,
+    1316227076, 1316292612, 1316358148, 1316423684, 1316489220, 1316554756, 1316620292, 1316685828,
+    1316751364, 1316816900, 1316882436, 1316947972, 1317013508, 1317079044, 1317144580, 1317210116,
+    1317275652, 1317341188, 1317406724, 1317472260, 1317537796, 1317603332, 1317668868, 1317734404,
+    1317799940, 1317865476, 1317931012, 1317996548, 1318062084, 1318127620, 1318193156, 1318258692,
+    1318324228, 1318389764, 1318455300, 1318520836, 1318586372, 1318651908, 1318717444, 1318782980,
+    1318848516, 1318914052, 1318979588, 1319045124, 1319110660, 1319176196, 1319241732, 1319307268,
+    1319372804, 1319438340, 1319503876, 1319569412, 1319634948, 1319700484, 1319766020, 1319831556,
+    1319897092, 1319962628, 1320028164, 1320093700, 1320159236, 1320224772, 1320290308, 1320355844,
+    1320421380, 1320486916, 1320552452, 1320617988, 1320683524, 1320749060, 1320814596, 1320880132,
+    1320945668, 1321011204, 1321076740, 1321142276, 1321207812, 1321273348, 1321338884, 1321404420,
+    1321469956, 1321535492, 1321601028, 1321666564, 1321732100, 1321797636, 1321863172, 1321928708,
+    1321994244, 1322059780, 1322125316, 1322190852, 1322256388, 1322321924, 1322387460, 1322452996,
+    1322518532, 1322584068, 1322649604, 1322715140, 1322780676, 1322846212, 1322911748, 1322977284,
+    1323042820, 1323108356, 1323173892, 1323239428, 1323304964, 1323370500, 1323436036, 1323501572,
+    1323567108, 1323632644, 1323698180, 1323763716, 1323829252, 1323894788, 1323960324, 1324025860,
+    1324091396, 1324156932, 1324222468, 1324288004, 1324353540, 1324419076, 1324484612, 1324550148,
+    1324615684, 1324681220, 1324746756, 1324812292, 1324877828, 1324943364, 1325008900, 1325074436,
+    1325139972, 1325205508, 1325271044, 1325336580, 1325402116, 1325467652, 1325533188, 1325598724,
+    1325664260, 1325729796, 1325795332, 1325860868, 1325926404, 1325991940, 1326057476, 1326123012,
+    1326188548, 1326254084, 1326319620, 1326385156, 1326450692, 1326516228, 1326581764, 1326647300,
+    1326712836, 1326778372, 1326843908, 1326909444, 1326974980, 1327040516, 1327106052, 1327171588,
+    1327237124, 1327302660, 1327368196, 1327433732, 1327499268, 1327564804, 1327630340, 1327695876,
+    1327761412, 1327826948, 1327892484, 1327958020, 1328023556, 1328089092, 1328154628, 1328220164,
+    1328285700, 1328351236, 1328416772, 1328482308, 1328547844, 1328613380, 1328678916, 1328744452,
+    1328809988, 1328875524, 1328941060, 1329006596, 1329072132, 1329137668, 1329203204, 1329268740,
+    1329334276, 1329399812, 1329465348, 1329530884, 1329596420, 1329661956, 1329727492, 1329793028,
+    1329858564, 1329924100, 1329989636, 1330055172, 1330120708, 1330186244, 1330251780, 1330317316,
+    1330382852, 1330448388, 1330513924, 1330579460, 1330644996, 1330710532, 1330776068, 1330841604,
+    1330907140, 1330972676, 1331038212, 1331103748, 1331169284, 1331234820, 1331300356, 1331365892,
+    1331431428, 1331496964, 1331562500, 1331628036, 1331693572, 1331759108, 1331824644, 1331890180,
+    1331955716, 1332021252, 1332086788, 1332152324, 1332217860, 1332283396, 1332348932, 1332414468,
+    1332480004, 1332545540, 1332611076, 1332676612, 1332742148, 1332807684, 1332873220, 1332938756,
+    1333004292, 1333069828, 1333135364, 1333200900, 1333266436, 1333331972, 1333397508, 1333463044,
+    1333528580, 1333594116, 1333659652, 1333725188, 1333790724, 1333856260, 1333921796, 1333987332,
+    1334052868, 1334118404, 1334183940, 1334249476, 1334315012, 1334380548, 1334446084, 1334511620,
+    1334577156, 1334642692, 1334708228, 1334773764, 1334839300, 1334904836, 1334970372, 1335035908,
+    1335101444, 1335166980, 1335232516, 1335298052, 1335363588, 1335429124, 1335494660, 1335560196,
+    1335625732, 1335691268, 1335756804, 1335822340, 1335887876, 1335953412, 1336018948, 1336084484,
+    1336150020, 1336215556, 1336281092, 1336346628, 1336412164, 1336477700, 1336543236, 1336608772,
+    1336674308, 1336739844, 1336805380, 1336870916, 1336936452, 1337001988, 1337067524, 1337133060,
+    1337198596, 1337264132, 1337329668, 1337395204, 1337460740, 1337526276, 1337591812, 1337657348,
+    1337722884, 1337788420, 1337853956, 1337919492, 1337985028, 1338050564, 1338116100, 1338116104,
+    17928, 1338181636, 1338247172, 1338312708, 1338378244, 1338443780, 1338509316, 1338574852,
+    1338640388, 1338705924, 1338771460, 1338836996, 1338902532, 1338968068, 1339033604, 1339099140,
+    1339164676, 1339230212, 1339295748, 1339361284, 1339426820, 1339492356, 1339492402, 1339557892,
+    1339623428, 1339688964, 1339754500, 1339820036, 1339885572, 1339951108, 1340016644, 1340082180,
+    1340082226, 1340147716, 1340147762, 1340213252, 1340278788, 1340344324, 1340344370, 1340409860,
+    1340475396, 1340540932, 1340606468, 1340672004, 1340672050, 1340737540, 1340737586, 1340803076,
+    1340803122, 1340868612, 1340868658, 1340934148, 1340934194, 1340999684, 1341065220, 1341130756,
+    1341196292, 1341261828, 1341327364, 1341392900, 1341392946, 1341458436, 1341523972, 1341589508,
+    1341655044, 1341720580, 1341786116, 1341851652, 1341917188, 1341982724, 1342048260, 1342113796,
+    1342179332, 1342244868, 1342310404, 1342375940, 1342441476, 1342507012, 1342572548, 1342638084,
+    1342703620, 1342769156, 1342834692, 1342900228, 1342965764, 1343031300, 1343096836, 1343162372,
+    1343227908, 1343293444, 1343358980, 1343424516, 1343490052, 1343555588, 1343621124, 1343686660,
+    1343752196, 1343817732, 1343883268, 1343948804, 1344014340, 1344079876, 1344145412, 1344210948,
+    1344276484, 1344342020, 1344407556, 1344473092, 1344538628, 1344604164, 1344669700, 1344735236,
+    1344800772, 1344866308, 1344931844, 1344997380, 1345062916, 1345128452, 1345193988, 1345259524,
+    1345325060, 1345390596, 1345456132, 1345521668, 1345587204, 1345652740, 1345718276, 1345783812,
+    1345849348, 1345914884, 1345980420, 1346045956, 1346111492, 1346177028, 1346242564, 1346308100,
+    1346373636, 1346439172, 1346504708, 1346570244, 1346635780, 1346701316, 1346766852, 1346832388,
+    1346897924, 1346963460, 1347028996, 1347094532, 1347160068, 1347225604, 1347291140, 1347356676,
+    1347422212, 1347487748, 1347553284, 1347618820, 1347684356, 1347749892, 1347815428, 1347880964,
+    1347946500, 1348012036, 1348077572, 1348143108, 1348208644, 1348274180, 1348339716, 1348405252,
+    1348470788, 1348536324, 1348601860, 1348601864, 1348798472, 1348667396, 1348732932, 1348798468,
+    1348864004, 1348929540, 1348995076, 1349060612, 1349126148, 1349191684, 1349257220, 1349322756,
+    1349388292, 1349453828, 1349519364, 1349584900, 1349650436, 1349715972, 1349781508, 1349847044,
+    1349912580, 1349978116, 1350043652, 1350109188, 1350109192, 17992, 1350174724, 1350240260,
+    1350305796, 1350371332, 1350436868, 1350502404, 1350567940, 1350633476, 1350699012, 1350764548,
+    1350830084, 1350895620, 1350961156, 1351026692, 1351092228, 1351157764, 1351223300, 1351288836,
+    1351354372, 1351419908, 1351485444, 1351550980, 1351616516, 1351682052, 1351747588, 1351813124,
+    1351878660, 1351944196, 1352009732, 1352009778, 1352075268, 1352075314, 1352140804, 1352206340,
+    1352206386, 1352271876, 1352337412, 1352402948, 1352468484, 1352534020, 1352599556, 1352665092,
+    1352730628, 1352730674, 1352730632, 17992, 1352796164, 1352861700, 1352861704, 17992,
+    1352861704, 1353058312, 1352927236, 1352992772, 1352992818, 1352992776, 17992, 1353058308,
+    1353123844, 1353189380, 1353189426, 1353189384, 17992, 1353254916, 1353320452, 1353385988,
+    1353451524, 1353517060, 1353582596, 1353648132, 1353713668, 1353779204, 1353844740, 1353910276,
+    1353975812, 1354041348, 1354106884, 1354172420, 1354237956, 1354303492, 1354369028, 1354369032,
+    17992, 1354434564, 1354500100, 1354565636, 1354631172, 1354696708, 1354762244, 1354827780,
+    1354893316, 1354958852, 1355024388, 1355089924, 1355155460, 1355220996, 1355286532, 1355352068,
+    1355417604, 1355483140, 1355548676, 1355614212, 1355679748, 1355745284, 1355810820, 1355876356,
+    1355941892, 1356007428, 1356072964, 1356138500, 1356204036, 1356269572, 1356335108, 1356400644,
+    1356466180, 1356531716, 1356597252, 1356662788, 1356728324, 1356793860, 1356859396, 1356924932,
+    1356990468, 1357056004, 1357121540, 1357187076, 1357252612, 1357318148, 1357383684, 1357449220,
+    1357514756, 1357580292, 1357645828, 1357711364, 1357776900, 1357842436, 1357907972, 1357973508,
+    1358039044, 1358104580, 1358170116, 1358235652, 1358301188, 1358366724, 1358432260, 1358497796,
+    1358563332, 1358628868, 1358694404, 1358759940, 1358825476, 1358891012, 1358956548, 1359022084,
+    1359087620, 1359153156, 1359218692, 1359284228, 1359349764, 1359415300, 1359480836, 1359546372,
+    1359611908, 1359677444, 1359742980, 1359808516, 1359874052, 1359939588, 1360005124, 1360070660,
+    1360136196, 1360201732, 1360267268, 1360332804, 1360398340, 1360463876, 1360529412, 1360594948,
+    1360660484, 1360726020, 1360791556, 1360857092, 1360922628, 1360988164, 1361053700, 1361119236,
+    1361184772, 1361250308, 1361315844, 1361381380, 1361446916, 1361512452, 1361577988, 1361643524,
+    1361709060, 1361774596, 1361840132, 1361905668, 1361971204, 1362036740, 1362102276, 1362167812,
+    1362233348, 1362298884, 1362364420, 1362429956, 1362495492, 1362561028, 1362626564, 1362692100,
+    1362757636, 1362823172, 1362888708, 1362954244, 1363019780, 1363085316, 1363150852, 1363216388,
+    1363281924, 1363347460, 1363412996, 1363478532, 1363544068, 1363609604, 1363675140, 1363740676,
+    1363806212, 1363871748, 1363937284, 1364002820, 1364068356, 1364133892, 1364199428, 1364264964,
+    1364330500, 1364396036, 1364461572, 1364527108, 1364592644, 1364658180, 1364723716, 1364789252,
+    1364854788, 1364920324, 1364985860, 1365051396, 1365116932, 1365182468, 1365248004, 1365313540,
+    1365379076, 1365444612, 1365510148, 1365575684, 1365641220, 1365706756, 1365772292, 1365837828,
+    1365903364, 1365968900, 1366034436, 1366099972, 1366165508, 1366231044, 1366296580, 1366362116,
+    1366427652, 1366493188, 1366558724, 1366624260, 1366689796, 1366755332, 1366820868, 1366886404,
+    1366951940, 1367017476, 1367083012, 1367148548, 1367214084, 1367279620, 1367345156, 1367410692,
+    1367476228, 1367541764, 1367607300, 1367672836, 1367738372, 1367803908, 1367869444, 1367934980,
+    1368000516, 1368066052, 1368131588, 1368197124, 1368262660, 1368328196, 1368393732, 1368459268,
+    1368524804, 1368590340, 1368655876, 1368721412, 1368786948, 1368852484, 1368918020, 1368983556,
+    1369049092, 1369114628, 1369180164, 1369245700, 1369311236, 1369376772, 1369442308, 1369507844,
+    1369573380, 1369638916, 1369704452, 1369769988, 1369835524, 1369901060, 1369966596, 1370032132,
+    1370097668, 1370163204, 1370228740, 1370294276, 1370359812, 1370425348, 1370490884, 1370556420,
+    1370621956, 1370687492, 1370753028, 1370818564, 1370884100, 1370949636, 1371015172, 1371080708,
+    1371146244, 1371211780, 1371277316, 1371342852, 1371408388, 1371473924, 1371539460, 1371604996,
+    1371670532, 1371736068, 1371801604, 1371867140, 1371932676, 1371998212, 1372063748, 1372129284,
+    1372194820, 1372260356, 1372325892, 1372391428, 1372456964, 1372522500, 1372588036, 1372653572,
+    1372719108, 1372784644, 1372850180, 1372915716, 1372981252, 1373046788, 1373112324, 1373177860,
+    1373243396, 1373308932, 1373374468, 1373440004, 1373505540, 1373571076, 1373636612, 1373702148,
+    1373767684, 1373833220, 1373898756, 1373964292, 1374029828, 1374095364, 1374160900, 1374226436,
+    1374291972, 1374357508, 1374423044, 1374488580, 1374554116, 1374619652, 1374685188, 1374750724,
+    1374816260, 1374881796, 1374947332, 1375012868, 1375078404, 1375143940, 1375209476, 1375275012,
+    1375340548, 1375406084, 1375471620, 1375537156, 1375602692, 1375668228, 1375733764, 1375799300,
+    1375864836, 1375930372, 1375995908, 1376061444, 1376126980, 1376192516, 1376258052, 1376323588,
+    1376389124, 1376454660, 1376520196, 1376585732, 1376651268, 1376716804, 1376782340, 1376847876,
+    1376913412, 1376978948, 1377044484, 1377110020, 1377175556, 1377241092, 1377306628, 1377372164,
+    1377437700, 1377503236, 1377568772, 1377634308, 1377699844, 1377765380, 1377830916, 1377896452,
+    1377961988, 1378027524, 1378093060, 1378158596, 1378224132, 1378289668, 1378355204, 1378420740,
+    1378486276, 1378551812, 1378617348, 1378682884, 1378748420, 1378813956, 1378879492, 1378945028,
+    1379010564, 1379076100, 1379141636, 1379207172, 1379272708, 1379338244, 1379403780, 1379469316,
+    1379534852, 1379600388, 1379665924, 1379731460, 1379796996, 1379862532, 1379928068, 1379993604,
+    1380059140, 1380124676, 1380190212, 1380255748, 1380321284, 1380386820, 1380452356, 1380517892,
+    1380583428, 1380648964, 1380714500, 1380780036, 1380845572, 1380911108, 1380976644, 1381042180,
+    1381107716, 1381173252, 1381238788, 1381304324, 1381369860, 1381435396, 1381500932, 1381566468,
+    1381632004, 1381697540, 1381763076, 1381828612, 1381894148, 1381959684, 1382025220, 1382090756,
+    1382156292, 1382221828, 1382287364, 1382352900, 1382418436, 1382483972, 1382549508, 1382615044,
+    1382680580, 1382746116, 1382811652, 1382877188, 1382942724, 1383008260, 1383073796, 1383139332,
+    1383204868, 1383270404, 1383335940, 1383401476, 1383467012, 1383532548, 1383598084, 1383663620,
+    1383729156, 1383794692, 1383860228, 1383925764, 1383991300, 1384056836, 1384122372, 1384187908,
+    1384253444, 1384318980, 1384384516, 1384450052, 1384515588, 1384581124, 1384646660, 1384712196,
+    1384777732, 1384843268, 1384908804, 1384974340, 1385039876, 1385105412, 1385170948, 1385236484,
+    1385302020, 1385367556, 1385433092, 1385498628, 1385564164, 1385629700, 1385695236, 1385760772,
+    1385826308, 1385891844, 1385957380, 1386022916, 1386088452, 1386153988, 1386219524, 1386285060,
+    1386350596, 1386416132, 1386481668, 1386547204, 1386612740, 1386678276, 1386743812, 1386809348,
+    1386874884, 1386940420, 1387005956, 1387071492, 1387137028, 1387202564, 1387268100, 1387333636,
+    1387399172, 1387464708, 1387530244, 1387595780, 1387661316, 1387726852, 1387792388, 1387857924,
+    1387923460, 1387988996, 1388054532, 1388120068, 1388185604, 1388251140, 1388316676, 1388382212,
+    1388447748, 1388513284, 1388578820, 1388644356, 1388709892, 1388775428, 1388840964, 1388906500,
+    1388972036, 1389037572, 1389103108, 1389168644, 1389234180, 1389299716, 1389365252, 1389430788,
+    1389496324, 1389561860, 1389627396, 1389692932, 1389758468, 1389824004, 1389889540, 1389955076,
+    1390020612, 1390086148, 1390151684, 1390217220, 1390282756, 1390348292, 1390413828, 1390479364,
+    1390544900, 1390610436, 1390675972, 1390741508, 1390807044, 1390872580, 1390938116, 1391003652,
+    1391069188, 1391134724, 1391200260, 1391265796, 1391331332, 1391396868, 1391462404, 1391527940,
+    1391593476, 1391659012, 1391724548, 1391790084, 1391855620, 1391921156, 1391986692, 1392052228,
+    1392117764, 1392183300, 1392248836, 1392314372, 1392379908, 1392445444, 1392510980, 1392576516,
+    1392642052, 1392707588, 1392773124, 1392838660, 1392904196, 1392969732, 1393035268, 1393100804,
+    1393166340, 1393231876, 1393297412, 1393362948, 1393428484, 1393494020, 1393559556, 1393625092,
+    1393690628, 1393756164, 1393821700, 1393887236, 1393952772, 1394018308, 1394083844, 1394149380,
+    1394214916, 1394280452, 1394345988, 1394411524, 1394477060, 1394542596, 1394608132, 1394673668,
+    1394739204, 1394804740, 1394870276, 1394935812, 1395001348, 1395066884, 1395132420, 1395197956,
+    1395263492, 1395329028, 1395394564, 1395460100, 1395525636, 1395591172, 1395656708, 1395722244,
+    1395787780, 1395853316, 1395918852, 1395984388, 1396049924, 1396115460, 1396180996, 1396246532,
+    1396312068, 1396377604, 1396443140, 1396508676, 1396574212, 1396639748, 1396705284, 1396770820,
+    1396836356, 1396901892, 1396967428, 1397032964, 1397098500, 1397164036, 1397229572, 1397295108,
+    1397360644, 1397426180, 1397491716, 1397557252, 1397622788, 1397688324, 1397753860, 1397819396,
+    1397884932, 1397950468, 1398016004, 1398081540, 1398147076, 1398212612, 1398278148, 1398343684,
+    1398409220, 1398474756, 1398540292, 1398605828, 1398671364, 1398736900, 1398802436, 1398867972,
+    1398933508, 1398999044, 1399064580, 1399130116, 1399195652, 1399261188, 1399326724, 1399392260,
+    1399457796, 1399523332, 1399588868, 1399654404, 1399719940, 1399785476, 1399851012, 1399916548,
+    1399982084, 1400047620, 1400113156, 1400178692, 1400244228, 1400309764, 1400375300, 1400440836,
+    1400506372, 1400571908, 1400637444, 1400702980, 1400768516, 1400834052, 1400899588, 1400965124,
+    1401030660, 1401096196, 1401161732, 1401227268, 1401292804, 1401358340, 1401423876, 1401489412,
+    1401554948, 1401620484, 1401686020, 1401751556, 1401817092, 1401882628, 1401948164, 1402013700,
+    1402079236, 1402144772, 1402210308, 1402275844, 1402341380, 1402406916, 1402472452, 1402537988,
+    1402603524, 1402669060, 1402734596, 1402800132, 1402865668, 1402931204, 1402996740, 1403062276,
+    1403127812, 1403193348, 1403258884, 1403324420, 1403389956, 1403455492, 1403521028, 1403586564,
+    1403652100, 1403717636, 1403783172, 1403848708, 1403914244, 1403979780, 1404045316, 1404110852,
+    1404176388, 1404241924, 1404307460, 1404372996, 1404438532, 1404504068, 1404569604, 1404635140,
+    1404700676, 1404766212, 1404831748, 1404897284, 1404962820, 1405028356, 1405093892, 1405159428,
+    1405224964, 1405290500, 1405356036, 1405421572, 1405487108, 1405552644, 1405618180, 1405683716,
+    1405749252, 1405814788, 1405880324, 1405945860, 1406011396, 1406076932, 1406142468, 1406208004,
+    1406273540, 1406339076, 1406404612, 1406470148, 1406535684, 1406601220, 1406666756, 1406732292,
+    1406797828, 1406863364, 1406928900, 1406994436, 1407059972, 1407125508, 1407191044, 1407256580,
+    1407322116, 1407387652, 1407453188, 1407518724, 1407584260, 1407649796, 1407715332, 1407780868,
+    1407846404, 1407911940, 1407977476, 1408043012, 1408108548, 1408174084, 1408239620, 1408305156,
+    1408370692, 1408436228, 1408501764, 1408567300, 1408632836, 1408698372, 1408763908, 1408829444,
+    1408894980, 1408960516, 1409026052, 1409091588, 1409157124, 1409222660, 1409288196, 1409353732,
+    1409419268, 1409484804, 1409550340, 1409615876, 1409681412, 1409746948, 1409812484, 1409878020,
+    1409943556, 1410009092, 1410074628, 1410140164, 1410205700, 1410271236, 1410336772, 1410402308,
+    1410467844, 1410533380, 1410598916, 1410664452, 1410729988, 1410795524, 1410861060, 1410926596,
+    1410992132, 1411057668, 1411123204, 1411188740, 1411254276, 1411319812, 1411385348, 1411450884,
+    1411516420, 1411581956, 1411647492, 1411713028, 1411778564, 1411844100, 1411909636, 1411975172,
+    1412040708, 1412106244, 1412171780, 1412237316, 1412302852, 1412368388, 1412433924, 1412499460,
+    1412564996, 1412630532, 1412696068, 1412761604, 1412827140, 1412892676, 1412958212, 1413023748,
+    1413089284, 1413154820, 1413220356, 1413285892, 1413351428, 1413416964, 1413482500, 1413548036,
+    1413613572, 1413679108, 1413744644, 1413810180, 1413875716, 1413941252, 1414006788, 1414072324,
+    1414137860, 1414203396, 1414268932, 1414334468, 1414400004, 1414465540, 1414531076, 1414596612,
+    1414662148, 1414727684, 1414793220, 1414858756, 1414924292, 1414989828, 1415055364, 1415120900,
+    1415186436, 1415251972, 1415317508, 1415383044, 1415448580, 1415514116, 1415579652, 1415645188,
+    1415710724, 1415776260, 1415841796, 1415907332, 1415972868, 1416038404, 1416103940, 1416169476,
+    1416235012, 1416300548, 1416366084, 1416431620, 1416497156, 1416562692, 1416628228, 1416693764,
+    1416759300, 1416824836, 1416890372, 1416955908, 1417021444, 1417086980, 1417152516, 1417218052,
+    1417283588, 1417349124, 1417414660, 1417480196, 1417545732, 1417611268, 1417676804, 1417742340,
+    1417807876, 1417873412, 1417938948, 1418004484, 1418070020, 1418135556, 1418201092, 1418266628,
+    1418332164, 1418397700, 1418463236, 1418528772, 1418594308, 1418659844, 1418725380, 1418790916,
+    1418856452, 1418921988, 1418987524, 1419053060, 1419118596, 1419184132, 1419249668, 1419315204,
+    1419380740, 1419446276, 1419511812, 1419577348, 1419642884, 1419708420, 1419773956, 1419839492,
+    1419905028, 1419970564, 1420036100, 1420101636, 1420167172, 1420232708, 1420298244, 1420363780,
+    1420429316, 1420494852, 1420560388, 1420625924, 1420691460, 1420756996, 1420822532, 1420888068,
+    1420953604, 1421019140, 1421084676, 1421150212, 1421215748, 1421281284, 1421346820, 1421412356,
+    1421477892, 1421543428, 1421608964, 1421674500, 1421740036, 1421805572, 1421871108, 1421936644,
+    1422002180, 1422067716, 1422133252, 1422198788, 1422264324, 1422329860, 1422395396, 1422460932,
+    1422526468, 1422592004, 1422657540, 1422723076, 1422788612, 1422854148, 1422919684, 1422985220,
+    1423050756, 1423116292, 1423181828, 1423247364, 1423312900, 1423378436, 1423443972, 1423509508,
+    1423575044, 1423640580, 1423706116, 1423771652, 1423837188, 1423902724, 1423968260, 1424033796,
+    1424099332, 1424164868, 1424230404, 1424295940, 1424361476, 1424427012, 1424492548, 1424558084,
+    1424623620, 1424689156, 1424754692, 1424820228, 1424885764, 1424951300, 1425016836, 1425082372,
+    1425147908, 1425213444, 1425278980, 1425344516, 1425410052, 1425475588, 1425541124, 1425606660,
+    1425672196, 1425737732, 1425803268, 1425868804, 1425934340, 1425999876, 1426065412, 1426130948,
+    1426196484, 1426262020, 1426327556, 1426393092, 1426458628, 1426524164, 1426589700, 1426655236,
+    1426720772, 1426786308, 1426851844, 1426917380, 1426982916, 1427048452, 1427113988, 1427179524,
+    1427245060, 1427310596, 1427376132, 1427441668, 1427507204, 1427572740, 1427638276, 1427703812,
+    1427769348, 1427834884, 1427900420, 1427965956, 1428031492, 1428097028, 1428162564, 1428228100,
+    1428293636, 1428359172, 1428424708, 1428490244, 1428555780, 1428621316, 1428686852, 1428752388,
+    1428817924, 1428883460, 1428948996, 1429014532, 1429080068, 1429145604, 1429211140, 1429276676,
+    1429342212, 1429407748, 1429473284, 1429538820, 1429604356, 1429669892, 1429735428, 1429800964,
+    1429866500, 1429932036, 1429997572, 1430063108, 1430128644, 1430194180, 1430259716, 1430325252,
+    1430390788, 1430456324, 1430521860, 1430587396, 1430652932, 1430718468, 1430784004, 1430849540,
+    1430915076, 1430980612, 1431046148, 1431111684, 1431177220, 1431242756, 1431308292, 1431373828,
+    1431439364, 1431504900, 1431570436, 1431635972, 1431701508, 1431767044, 1431832580, 1431898116,
+    1431963652, 1432029188, 1432094724, 1432160260, 1432225796, 1432291332, 1432356868, 1432422404,
+    1432487940, 1432553476, 1432619012, 1432684548, 1432750084, 1432815620, 1432881156, 1432946692,
+    1433012228, 1433077764, 1433143300, 1433208836, 1433274372, 1433339908, 1433405444, 1433470980,
+    1433536516, 1433602052, 1433667588, 1433733124, 1433798660, 1433864196, 1433929732, 1433995268,
+    1434060804, 1434126340, 1434191876, 1434257412, 1434322948, 1434388484, 1434454020, 1434519556,
+    1434585092, 1434650628, 1434716164, 1434781700, 1434847236, 1434912772, 1434978308, 1435043844,
+    1435109380, 1435174916, 1435240452, 1435305988, 1435371524, 1435437060, 1435502596, 1435568132,
+    1435633668, 1435699204, 1435764740, 1435830276, 1435895812, 1435961348, 1436026884, 1436092420,
+    1436157956, 1436223492, 1436289028, 1436354564, 1436420100, 1436485636, 1436551172, 1436616708,
+    1436682244, 1436747780, 1436813316, 1436878852, 1436944388, 1437009924, 1437075460, 1437140996,
+    1437206532, 1437272068, 1437337604, 1437403140, 1437468676, 1437534212, 1437599748, 1437665284,
+    1437730820, 1437796356, 1437861892, 1437927428, 1437992964, 1438058500, 1438124036, 1438189572,
+    1438255108, 1438320644, 1438386180, 1438451716, 1438517252, 1438582788, 1438648324, 1438713860,
+    1438779396, 1438844932, 1438910468, 1438976004, 1439041540, 1439107076, 1439172612, 1439238148,
+    1439303684, 1439369220, 1439434756, 1439500292, 1439565828, 1439631364, 1439696900, 1439762436,
+    1439827972, 1439893508, 1439959044, 1440024580, 1440090116, 1440155652, 1440221188, 1440286724,
+    1440352260, 1440417796, 1440483332, 1440548868, 1440614404, 1440679940, 1440745476, 1440811012,
+    1440876548, 1440942084, 1441007620, 1441073156, 1441138692, 1441204228, 1441269764, 1441335300,
+    1441400836, 1441466372, 1441531908, 1441597444, 1441662980, 1441728516, 1441794052, 1441859588,
+    1441925124, 1441990660, 1442056196, 1442121732, 1442187268, 1442252804, 1442318340, 1442383876,
+    1442449412, 1442514948, 1442580484, 1442646020, 1442711556, 1442777092, 1442842628, 1442908164,
+    1442973700, 1443039236, 1443104772, 1443170308, 1443235844, 1443301380, 1443366916, 1443432452,
+    1443497988, 1443563524, 1443629060, 1443694596, 1443760132, 1443825668, 1443891204, 1443956740,
+    1444022276, 1444087812, 1444153348, 1444218884, 1444284420, 1444349956, 1444415492, 1444481028,
+    1444546564, 1444612100, 1444677636, 1444743172, 1444808708, 1444874244, 1444939780, 1445005316,
+    1445070852, 1445136388, 1445201924, 1445267460, 1445332996, 1445398532, 1445464068, 1445529604,
+    1445595140, 1445660676, 1445726212, 1445791748, 1445857284, 1445922820, 1445988356, 1446053892,
+    1446119428, 1446184964, 1446250500, 1446316036, 1446381572, 1446447108, 1446512644, 1446578180,
+    1446643716, 1446709252, 1446774788, 1446840324, 1446905860, 1446971396, 1447036932, 1447102468,
+    1447168004, 1447233540, 1447299076, 1447364612, 1447430148, 1447495684, 1447561220, 1447626756,
+    1447692292, 1447757828, 1447823364, 1447888900, 1447954436, 1448019972, 1448085508, 1448151044,
+    1448216580, 1448282116, 1448347652, 1448413188, 1448478724, 1448544260, 1448609796, 1448675332,
+    1448740868, 1448806404, 1448871940, 1448937476, 1449003012, 1449068548, 1449134084, 1449199620,
+    1449265156, 1449330692, 1449396228, 1449461764, 1449527300, 1449592836, 1449658372, 1449723908,
+    1449789444, 1449854980, 1449920516, 1449986052, 1450051588, 1450117124, 1450182660, 1450248196,
+    1450313732, 1450379268, 1450444804, 1450510340, 1450575876, 1450641412, 1450706948, 1450772484,
+    1450838020, 1450903556, 1450969092, 1451034628, 1451100164, 1451165700, 1451231236, 1451296772,
+    1451362308, 1451427844, 1451493380, 1451558916, 1451624452, 1451689988, 1451755524, 1451821060,
+    1451886596, 1451952132, 1452017668, 1452083204, 1452148740, 1452214276, 1452279812, 1452345348,
+    1452410884, 1452476420, 1452541956, 1452607492, 1452673028, 1452738564, 1452804100, 1452869636,
+    1452935172, 1453000708, 1453066244, 1453131780, 1453197316, 1453262852, 1453328388, 1453393924,
+    1453459460, 1453524996, 1453590532, 1453656068, 1453721604, 1453787140, 1453852676, 1453918212,
+    1453983748, 1454049284, 1454114820, 1454180356, 1454245892, 1454311428, 1454376964, 1454442500,
+    1454508036, 1454573572, 1454639108, 1454704644, 1454770180, 1454835716, 1454901252, 1454966788,
+    1455032324, 1455097860, 1455163396, 1455228932, 1455294468, 1455360004, 1455425540, 1455491076,
+    1455556612, 1455622148, 1455687684, 1455753220, 1455818756, 1455884292, 1455949828, 1456015364,
+    1456080900, 1456146436, 1456211972, 1456277508, 1456343044, 1456408580, 1456474116, 1456539652,
+    1456605188, 1456670724, 1456736260, 1456801796, 1456867332, 1456932868, 1456998404, 1457063940,
+    1457129476, 1457195012, 1457260548, 1457326084, 1457391620, 1457457156, 1457522692, 1457588228,
+    1457653764, 1457719300, 1457784836, 1457850372, 1457915908, 1457981444, 1458046980, 1458112516,
+    1458178052, 1458243588, 1458309124, 1458374660, 1458440196, 1458505732, 1458571268, 1458636804,
+    1458702340, 1458767876, 1458833412, 1458898948, 1458964484, 1459030020, 1459095556, 1459161092,
+    1459226628, 1459292164, 1459357700, 1459423236, 1459488772, 1459554308, 1459619844, 1459685380,
+    1459750916, 1459816452, 1459881988, 1459947524, 1460013060, 1460078596, 1460144132, 1460209668,
+    1460275204, 1460340740, 1460406276, 1460471812, 1460537348, 1460602884, 1460668420, 1460733956,
+    1460799492, 1460865028, 1460930564, 1460996100, 1461061636, 1461127172, 1461192708, 1461258244,
+    1461323780, 1461389316, 1461454852, 1461520388, 1461585924, 1461651460, 1461716996, 1461782532,
+    1461848068, 1461913604, 1461979140, 1462044676, 1462110212, 1462175748, 1462241284, 1462306820,
+    1462372356, 1462437892, 1462503428, 1462568964, 1462634500, 1462700036, 1462765572, 1462831108,
+    1462896644, 1462962180, 1463027716, 1463093252, 1463158788, 1463224324, 1463289860, 1463355396,
+    1463420932, 1463486468, 1463552004, 1463617540, 1463683076, 1463748612, 1463814148, 1463879684,
+    1463945220, 1464010756, 1464076292, 1464141828, 1464207364, 1464272900, 1464338436, 1464403972,
+    1464469508, 1464535044, 1464600580, 1464666116, 1464731652, 1464797188, 1464862724, 1464928260,
+    1464993796, 1465059332, 1465124868, 1465190404, 1465255940, 1465321476, 1465387012, 1465452548,
+    1465518084, 1465583620, 1465649156, 1465714692, 1465780228, 1465845764, 1465911300, 1465976836,
+    1466042372, 1466107908, 1466173444, 1466238980, 1466304516, 1466370052, 1466435588, 1466501124,
+    1466566660, 1466632196, 1466697732, 1466763268, 1466828804, 1466894340, 1466959876, 1467025412,
+    1467090948, 1467156484, 1467222020, 1467287556, 1467353092, 1467418628, 1467484164, 1467549700,
+    1467615236, 1467680772, 1467746308, 1467811844, 1467877380, 1467942916, 1468008452, 1468073988,
+    1468139524, 1468205060, 1468270596, 1468336132, 1468401668, 1468467204, 1468532740, 1468598276,
+    1468663812, 1468729348, 1468794884, 1468860420, 1468925956, 1468991492, 1469057028, 1469122564,
+    1469188100, 1469253636, 1469319172, 1469384708, 1469450244, 1469515780, 1469581316, 1469646852,
+    1469712388, 1469777924, 1469843460, 1469908996, 1469974532, 1470040068, 1470105604, 1470171140,
+    1470236676, 1470302212, 1470367748, 1470433284, 1470498820, 1470564356, 1470629892, 1470695428,
+    1470760964, 1470826500, 1470892036, 1470957572, 1471023108, 1471088644, 1471154180, 1471219716,
+    1471285252, 1471350788, 1471416324, 1471481860, 1471547396, 1471612932, 1471678468, 1471744004,
+    1471809540, 1471875076, 1471940612, 1472006148, 1472071684, 1472137220, 1472202756, 1472268292,
+    1472333828, 1472399364, 1472464900, 1472530436, 1472595972, 1472661508, 1472727044, 1472792580,
+    1472858116, 1472923652, 1472989188, 1473054724, 1473120260, 1473185796, 1473251332, 1473316868,
+    1473382404, 1473447940, 1473513476, 1473579012, 1473644548, 1473710084, 1473775620, 1473841156,
+    1473906692, 1473972228, 1474037764, 1474103300, 1474168836, 1474234372, 1474299908, 1474365444,
+    1474430980, 1474496516, 1474562052, 1474627588, 1474693124, 1474758660, 1474824196, 1474889732,
+    1474955268, 1475020804, 1475086340, 1475151876, 1475217412, 1475282948, 1475348484, 1475414020,
+    1475479556, 1475545092, 1475610628, 1475676164, 1475741700, 1475807236, 1475872772, 1475938308,
+    1476003844, 1476069380, 1476134916, 1476200452, 1476265988, 1476331524, 1476397060, 1476462596,
+    1476528132, 1476593668, 1476659204, 1476724740, 1476790276, 1476855812, 1476921348, 1476986884,
+    1477052420, 1477117956, 1477183492, 1477249028, 1477314564, 1477380100, 1477445636, 1477511172,
+    1477576708, 1477642244, 1477707780, 1477773316, 1477838852, 1477904388, 1477969924, 1478035460,
+    1478100996, 1478166532, 1478232068, 1478297604, 1478363140, 1478428676, 1478494212, 1478559748,
+    1478625284, 1478690820, 1478756356, 1478821892, 1478887428, 1478952964, 1479018500, 1479084036,
+    1479149572, 1479215108, 1479280644, 1479346180, 1479411716, 1479477252, 1479542788, 1479608324,
+    1479673860, 1479739396, 1479804932, 1479870468, 1479936004, 1480001540, 1480067076, 1480132612,
+    1480198148, 1480263684, 1480329220, 1480394756, 1480460292, 1480525828, 1480591364, 1480656900,
+    1480722436, 1480787972, 1480853508, 1480919044, 1480984580, 1481050116, 1481115652, 1481181188,
+    1481246724, 1481312260, 1481377796, 1481443332, 1481508868, 1481574404, 1481639940, 1481705476,
+    1481771012, 1481836548, 1481902084, 1481967620, 1482033156, 1482098692, 1482164228, 1482229764,
+    1482295300, 1482360836, 1482426372, 1482491908, 1482557444, 1482622980, 1482688516, 1482754052,
+    1482819588, 1482885124, 1482950660, 1483016196, 1483081732, 1483147268, 1483212804, 1483278340,
+    1483343876, 1483409412, 1483474948, 1483540484, 1483606020, 1483671556, 1483737092, 1483802628,
+    1483868164, 1483933700, 1483999236, 1484064772, 1484130308, 1484195844, 1484261380, 1484326916,
+    1484392452, 1484457988, 1484523524, 1484589060, 1484654596, 1484720132, 1484785668, 1484851204,
+    1484916740, 1484982276, 1485047812, 1485113348, 1485178884, 1485244420, 1485309956, 1485375492,
+    1485441028, 1485506564, 1485572100, 1485637636, 1485703172, 1485768708, 1485834244, 1485899780,
+    1485965316, 1486030852, 1486096388, 1486161924, 1486227460, 1486292996, 1486358532, 1486424068,
+    1486489604, 1486555140, 1486620676, 1486686212, 1486751748, 1486817284, 1486882820, 1486948356,
+    1487013892, 1487079428, 1487144964, 1487210500, 1487276036, 1487341572, 1487407108, 1487472644,
+    1487538180, 1487603716, 1487669252, 1487734788, 1487800324, 1487865860, 1487931396, 1487996932,
+    1488062468, 1488128004, 1488193540, 1488259076, 1488324612, 1488390148, 1488455684, 1488521220,
+    1488586756, 1488652292, 1488717828, 1488783364, 1488848900, 1488914436, 1488979972, 1489045508,
+    1489111044, 1489176580, 1489242116, 1489307652, 1489373188, 1489438724, 1489504260, 1489569796,
+    1489635332, 1489700868, 1489766404, 1489831940, 1489897476, 1489963012, 1490028548, 1490094084,
+    1490159620, 1490225156, 1490290692, 1490356228, 1490421764, 1490487300, 1490552836, 1490618372,
+    1490683908, 1490749444, 1490814980, 1490880516, 1490946052, 1491011588, 1491077124, 1491142660,
+    1491208196, 1491273732, 1491339268, 1491404804, 1491470340, 1491535876, 1491601412, 1491666948,
+    1491732484, 1491798020, 1491863556, 1491929092, 1491994628, 1492060164, 1492125700, 1492191236,
+    1492256772, 1492322308, 1492387844, 1492453380, 1492518916, 1492584452, 1492649988, 1492715524,
+    1492781060, 1492846596, 1492912132, 1492977668, 1493043204, 1493108740, 1493174276, 1493239812,
+    1493305348, 1493370884, 1493436420, 1493501956, 1493567492, 1493633028, 1493698564, 1493764100,
+    1493829636, 1493895172, 1493960708, 1494026244, 1494091780, 1494157316, 1494222852, 1494288388,
+    1494353924, 1494419460, 1494484996, 1494550532, 1494616068, 1494681604, 1494747140, 1494812676,
+    1494878212, 1494943748, 1495009284, 1495074820, 1495140356, 1495205892, 1495271428, 1495336964,
+    1495402500, 1495468036, 1495533572, 1495599108, 1495664644, 1495730180, 1495795716, 1495861252,
+    1495926788, 1495992324, 1496057860, 1496123396, 1496188932, 1496254468, 1496320004, 1496385540,
+    1496451076, 1496516612, 1496582148, 1496647684, 1496713220, 1496778756, 1496844292, 1496909828,
+    1496975364, 1497040900, 1497106436, 1497171972, 1497237508, 1497303044, 1497368580, 1497434116,
+    1497499652, 1497565188, 1497630724, 1497696260, 1497761796, 1497827332, 1497892868, 1497958404,
+    1498023940, 1498089476, 1498155012, 1498220548, 1498286084, 1498351620, 1498417156, 1498482692,
+    1498548228, 1498613764, 1498679300, 1498744836, 1498810372, 1498875908, 1498941444, 1499006980,
+    1499072516, 1499138052, 1499203588, 1499269124, 1499334660, 1499400196, 1499465732, 1499531268,
+    1499596804, 1499662340, 1499727876, 1499793412, 1499858948, 1499924484, 1499990020, 1500055556,
+    1500121092, 1500186628, 1500252164, 1500317700, 1500383236, 1500448772, 1500514308, 1500579844,
+    1500645380, 1500710916, 1500776452, 1500841988, 1500907524, 1500973060, 1501038596, 1501104132,
+    1501169668, 1501235204, 1501300740, 1501366276, 1501431812, 1501497348, 1501562884, 1501628420,
+    1501693956, 1501759492, 1501825028, 1501890564, 1501956100, 1502021636, 1502087172, 1502152708,
+    1502218244, 1502283780, 1502349316, 1502414852, 1502480388, 1502545924, 1502611460, 1502676996,
+    1502742532, 1502808068, 1502873604, 1502939140, 1503004676, 1503070212, 1503135748, 1503201284,
+    1503266820, 1503332356, 1503397892, 1503463428, 1503528964, 1503594500, 1503660036, 1503725572,
+    1503791108, 1503856644, 1503922180, 1503987716, 1504053252, 1504118788, 1504184324, 1504249860,
+    1504315396, 1504380932, 1504446468, 1504512004, 1504577540, 1504643076, 1504708612, 1504774148,
+    1504839684, 1504905220, 1504970756, 1505036292, 1505101828, 1505167364, 1505232900, 1505298436,
+    1505363972, 1505429508, 1505495044, 1505560580, 1505626116, 1505691652, 1505757188, 1505822724,
+    1505888260, 1505953796, 1506019332, 1506084868, 1506150404, 1506215940, 1506281476, 1506347012,
+    1506412548, 1506478084, 1506543620, 1506609156, 1506674692, 1506740228, 1506805764, 1506871300,
+    1506936836, 1507002372, 1507067908, 1507133444, 1507198980, 1507198984, 17928, 1507264516,
+    1507264520, 17928, 1507330052, 1507330056, 17928, 1507395588, 1507395592, 17928,
+    1507461124, 1507461128, 17928, 1507526660, 1507526664, 17928, 1507592196, 1507592200,
+    17928, 1507592200, 17992, 1507657732, 1507657736, 17928, 1507723268, 1507723272,
+    17928, 1507788804, 1507788808, 17928, 1507788808, 17992, 1507854340, 1507854344,
+    17928, 1507854344, 17992, 1507919876, 1507919880, 17928, 1507919880, 17992,
+    1507985412, 1507985416, 17928, 1508050948, 1508050952, 17928, 1508116484, 1508116488,
+    17928, 1508182020, 1508182024, 17928, 1508182024, 17992, 1508182024, 18056,
+    1508247556, 1508247560, 17928, 1508313092, 1508313096, 17928, 1508378628, 1508378632,
+    17928, 1508444164, 1508444168, 17928, 1508444168, 17992, 1508509700, 1508509704,
+    17928, 1508509704, 17992, 1508575236, 1508575240, 17928, 1508640772, 1508640776,
+    17928, 1508706308, 1508771844, 1508837380, 1508902916, 1508968452, 1509033988, 1509099524,
+    1509165060, 1509230596, 1509296132, 1509361668, 1509427204, 1509492740, 1509558276, 1509623812,
+    1509689348, 1509754884, 1509820420, 1509885956, 1509951492, 1510017028, 1510082564, 1510148100,
+    1510213636, 1510279172, 1510344708, 1510410244, 1510475780, 1510541316, 1510606852, 1510672388,
+    1510737924, 1510803460, 1510868996, 1510934532, 1511000068, 1511065604, 1511131140, 1511196676,
+    1511262212, 1511327748, 1511393284, 1511458820, 1511524356, 1511589892, 1511655428, 1511720964,
+    1511786500, 1511852036, 1511917572, 1511983108, 1512048644, 1512114180, 1512179716, 1512245252,
+    1512310788, 1512376324, 1512441860, 1512507396, 1512572932, 1512638468, 1512704004, 1512769540,
+    1512835076, 1512900612, 1512966148, 1513031684, 1513097220, 1513162756, 1513228292, 1513293828,
+    1513359364, 1513424900, 1513490436, 1513555972, 1513621508, 1513687044, 1513752580, 1513818116,
+    1513883652, 1513949188, 1514014724, 1514080260, 1514145796, 1514211332, 1514276868, 1514342404,
+    1514407940, 1514473476, 1514539012, 1514604548, 1514670084, 1514735620, 1514801156, 1514866692,
+    1514932228, 1514997764, 1515063300, 1515128836, 1515194372, 1515259908, 1515325444, 1515390980,
+    1515456516, 1515522052, 1515587588, 1515653124, 1515718660, 1515784196, 1515849732, 1515915268,
+    1515980804, 1516046340, 1516111876, 1516177412, 1516242948, 1516308484, 1516374020, 1516439556,
+    1516505092, 1516570628, 1516636164, 1516701700, 1516767236, 1516832772, 1516898308, 1516963844,
+    1517029380, 1517094916, 1517160452, 1517225988, 1517291524, 1517357060, 1517422596, 1517488132,
+    1517553668, 1517619204, 1517684740, 1517750276, 1517815812, 1517881348, 1517946884, 1518012420,
+    1518077956, 1518143492, 1518209028, 1518274564, 1518340100, 1518405636, 1518471172, 1518536708,
+    1518602244, 1518667780, 1518733316, 1518798852, 1518864388, 1518929924, 1518995460, 1519060996,
+    1519126532, 1519192068, 1519257604, 1519323140, 1519388676, 1519454212, 1519519748, 1519585284,
+    1519650820, 1519716356, 1519781892, 1519847428, 1519912964, 1519978500, 1520044036, 1520109572,
+    1520175108, 1520240644, 1520306180, 1520371716, 1520437252, 1520502788, 1520568324, 1520633860,
+    1520699396, 1520764932, 1520830468, 1520896004, 1520961540, 1521027076, 1521092612, 1521158148,
+    1521223684, 1521289220, 1521354756, 1521420292, 1521485828, 1521551364, 1521616900, 1521682436,
+    1521747972, 1521813508, 1521879044, 1521944580, 1522010116, 1522075652, 1522141188, 1522206724,
+    1522272260, 1522337796, 1522403332, 1522468868, 1522534404, 1522599940, 1522665476, 1522731012,
+    1522796548, 1522862084, 1522927620, 1522993156, 1523058692, 1523124228, 1523189764, 1523255300,
+    1523320836, 1523386372, 1523451908, 1523517444, 1523582980, 1523648516, 1523714052, 1523779588,
+    1523845124, 1523910660, 1523976196, 1524041732, 1524107268, 1524172804, 1524238340, 1524303876,
+    1524369412, 1524434948, 1524500484, 1524566020, 1524631556, 1524697092, 1524762628, 1524828164,
+    1524893700, 1524959236, 1525024772, 1525090308, 1525155844, 1525221380, 1525286916, 1525352452,
+    1525417988, 1525483524, 1525549060, 1525614596, 1525680132, 1525745668, 1525811204, 1525876740,
+    1525942276, 1526007812, 1526073348, 1526138884, 1526204420, 1526269956, 1526335492, 1526401028,
+    1526466564, 1526532100, 1526597636, 1526663172, 1526728708, 1526794244, 1526859780, 1526925316,
+    1526990852, 1527056388, 1527121924, 1527187460, 1527252996, 1527318532, 1527384068, 1527449604,
+    1527515140, 1527580676, 1527646212, 1527711748, 1527777284, 1527842820, 1527908356, 1527973892,
+    1528039428, 1528104964, 1528170500, 1528236036, 1528301572, 1528367108, 1528432644, 1528498180,
+    1528563716, 1528629252, 1528694788, 1528760324, 1528825860, 1528891396, 1528956932, 1529022468,
+    1529088004, 1529153540, 1529219076, 1529284612, 1529350148, 1529415684, 1529481220, 1529546756,
+    1529612292, 1529677828, 1529743364, 1529808900, 1529874436, 1529939972, 1530005508, 1530071044,
+    1530136580, 1530202116, 1530267652, 1530333188, 1530398724, 1530464260, 1530529796, 1530595332,
+    1530660868, 1530726404, 1530791940, 1530857476, 1530923012, 1530988548, 1531054084, 1531119620,
+    1531185156, 1531250692, 1531316228, 1531381764, 1531447300, 1531512836, 1531578372, 1531643908,
+    1531709444, 1531774980, 1531840516, 1531906052, 1531971588, 1532037124, 1532102660, 1532168196,
+    1532233732, 1532299268, 1532364804, 1532430340, 1532495876, 1532561412, 1532626948, 1532692484,
+    1532758020, 1532823556, 1532889092, 1532954628, 1533020164, 1533085700, 1533151236, 1533216772,
+    1533282308, 1533347844, 1533413380, 1533478916, 1533544452, 1533609988, 1533675524, 1533741060,
+    1533806596, 1533872132, 1533937668, 1534003204, 1534068740, 1534134276, 1534199812, 1534265348,
+    1534330884, 1534396420, 1534461956, 1534527492, 1534593028, 1534658564, 1534724100, 1534789636,
+    1534855172, 1534920708, 1534986244, 1535051780, 1535117316, 1535182852, 1535248388, 1535313924,
+    1535379460, 1535444996, 1535510532, 1535576068, 1535641604, 1535707140, 1535772676, 1535838212,
+    1535903748, 1535969284, 1536034820, 1536100356, 1536165892, 1536231428, 1536296964, 1536362500,
+    1536428036, 1536493572, 1536559108, 1536624644, 1536690180, 1536755716, 1536821252, 1536886788,
+    1536952324, 1537017860, 1537083396, 1537148932, 1537214468, 1537280004, 1537345540, 1537411076,
+    1537476612, 1537542148, 1537607684, 1537673220, 1537738756, 1537804292, 1537869828, 1537935364,
+    1538000900, 1538066436, 1538131972, 1538197508, 1538263044, 1538328580, 1538394116, 1538459652,
+    1538525188, 1538590724, 1538656260, 1538721796, 1538787332, 1538852868, 1538918404, 1538983940,
+    1539049476, 1539115012, 1539180548, 1539246084, 1539311620, 1539377156, 1539442692, 1539508228,
+    1539573764, 1539639300, 1539704836, 1539770372, 1539835908, 1539901444, 1539966980, 1540032516,
+    1540098052, 1540163588, 1540229124, 1540294660, 1540360196, 1540425732, 1540491268, 1540556804,
+    1540622340, 1540687876, 1540753412, 1540818948, 1540884484, 1540950020, 1541015556, 1541081092,
+    1541146628, 1541212164, 1541277700, 1541343236, 1541408772, 1541474308, 1541539844, 1541605380,
+    1541670916, 1541736452, 1541801988, 1541867524, 1541933060, 1541998596, 1542064132, 1542129668,
+    1542195204, 1542260740, 1542326276, 1542391812, 1542457348, 1542522884, 1542588420, 1542653956,
+    1542719492, 1542785028, 1542850564, 1542916100, 1542981636, 1543047172, 1543112708, 1543178244,
+    1543243780, 1543309316, 1543374852, 1543440388, 1543505924, 1543571460, 1543636996, 1543702532,
+    1543768068, 1543833604, 1543899140, 1543964676, 1544030212, 1544095748, 1544161284, 1544226820,
+    1544292356, 1544357892, 1544423428, 1544488964, 1544554500, 1544620036, 1544685572, 1544751108,
+    1544816644, 1544882180, 1544947716, 1545013252, 1545078788, 1545144324, 1545209860, 1545275396,
+    1545340932, 1545406468, 1545472004, 1545537540, 1545603076, 1545668612, 1545734148, 1545799684,
+    1545865220, 1545930756, 1545996292, 1546061828, 1546127364, 1546192900, 1546258436, 1546323972,
+    1546389508, 1546455044, 1546520580, 1546586116, 1546651652, 1546717188, 1546782724, 1546848260,
+    1546913796, 1546979332, 1547044868, 1547110404, 4215277576, 3456106496, 52955145, 4215277576,
+    3456106496, 53020681, 4215277580, 3456106496, 4215277608, 3456106496, 4215277624, 3456106496,
+    4215277608, 3456172032, 52955145, 4215277576, 3456303104, 53020681, 4215277580, 3456303104,
+    52955145, 4215277576, 3456696320, 53020681, 59377673, 4215277576, 3456696320, 59443209,
+    4215277580, 3456696320, 4215277608, 3456696320, 4215277624, 3456696320, 4215277580, 3456761856,
+    4215277608, 3456761856, 4215277580, 3456827392, 4215277608, 3456827392, 4215277572, 3456958464,
+    4215277608, 3457744896, 4215277572, 3458596864, 4215277576, 3458727936, 4215277576, 3458990080,
+    4215277580, 3459055616, 4215277608, 3459055616, 4215277624, 3459055616, 4215277572, 3459383296,
+    4215277576, 3459645440, 4215277576, 3459645440, 17928, 4215277572, 3459776512, 4215277572,
+    3459842048, 4215277572, 3460104192, 4215277576, 3460235264, 4215277572, 3460366336, 4215277576,
+    3461939200, 4215277608, 3461939200, 4215277576, 3461939200, 17928, 4215277576, 3462004736,
+    4215277576, 3462070272, 52955145, 4215277576, 3462201344, 53020681, 4215277580, 3462201344,
+    4215277572, 3464626176, 4215277576, 3464822784, 4215277572, 3464888320, 4215277576, 3465281536,
+    52955145, 4215277576, 3465281536, 53020681, 59377673, 4215277576, 3465281536, 59443209,
+    4215277580, 3465281536, 4215277608, 3465281536, 4215277624, 3465281536, 52955145, 4215277576,
+    3465805824, 53020681, 4215277580, 3465805824, 4215277576, 3466592256, 4215277624, 3466854400,
+    4215277572, 3467509760, 4215277576, 3468296192, 4215277608, 3468296192, 4215277576, 3468361728,
+    4215277572, 3468689408, 4215277572, 3469475840, 52955145, 4215277576, 3470983168, 53020681,
+    4215277572, 3471048704, 4215277624, 3471048704, 4215277624, 3565944832, 52955145, 4215277576,
+    3472949248, 53020681, 4215277580, 3472949248, 52955145, 4215277576, 3473997824, 53020681,
+    4215277580, 3473997824, 4215277572, 3479175168, 4215277572, 3481272320, 4215277572, 3481665536,
+    4215277572, 3481993216, 4215277572, 3484286976, 4215277572, 3485138944, 4215277572, 3485401088,
+    4215277572, 3489792000, 4215277572, 3492478976, 4215277572, 3497656320, 4215277572, 3499687936,
+    4215277572, 3503226880, 4215277572, 3503947776, 4215277572, 3504799744, 4215277580, 3509190656,
+    4215277576, 3510566912, 4215277572, 3510632448, 4215277572, 3510960128, 4215277572, 3511484416,
+    4215277572, 3511943168, 4215277572, 3512991744, 4215277576, 3513057280, 4215277572, 3513188352,
+    4215277572, 3513253888, 4215277572, 3513319424, 4215277576, 3513450496, 52955145, 4215277576,
+    3513450496, 53020681, 4215277580, 3513450496, 4215277572, 3513581568, 52955145, 4215277576,
+    3513581568, 53020681, 4215277580, 3513581568, 4215277572, 3514236928, 4215277572, 3514826752,
+    4215277576, 3514957824, 4215277576, 3514957824, 17928, 4215277572, 3515678720, 4215277624,
+    3515678720, 4215277572, 3516006400, 4215277572, 3516203008, 4215277576, 3516268544, 4215277572,
+    3516334080, 4215277580, 3516465152, 4215277572, 3517186048, 4215277576, 3517644800, 4215277572,
+    3517710336, 4215277572, 3518300160, 4215277572, 3518431232, 4215277572, 3519610880, 4215277572,
+    3519807488, 4215277572, 3520856064, 4215277572, 3520987136, 4215277576, 3521118208, 4215277576,
+    3521118208, 17928, 4215277572, 3522494464, 4215277576, 3522494464, 4215277576, 3523215360,
+    4215277576, 3523215360, 17928, 4215277576, 3523346432, 4215277572, 3523411968, 4215277572,
+    3523674112, 4215277572, 3524722688, 4215277624, 3525115904, 4215277572, 3525902336, 4215277572,
+    3527016448, 4215277572, 3527081984, 4215277572, 3527802880, 4215277624, 3528261632, 4215277572,
+    3530686464, 4215277624, 3530686464, 4215277572, 3531014144, 4215277572, 3532193792, 4215277572,
+    3533373440, 4215277576, 3533373440, 4215277572, 3533897728, 4215277572, 3534946304, 52955145,
+    4215277576, 3535011840, 53020681, 4215277580, 3535011840, 4215277572, 3536257024, 4215277572,
+    3536388096, 4215277572, 3536977920, 59377673, 4215277576, 3537698816, 59443209, 4215277572,
+    3537764352, 4215277572, 3538157568, 4215277572, 3539271680, 4215277576, 3539533824, 4215277572,
+    3539599360, 4215277572, 3540320256, 4215277572, 3540385792, 4215277576, 3541368832, 4215277572,
+    3541499904, 4215277576, 3541696512, 4215277576, 3543662592, 4215277580, 3543859200, 4215277572,
+    3544121344, 4215277576, 3544252416, 52955145, 4215277576, 3544252416, 53020681, 4215277580,
+    3544252416, 4215277576, 3544449024, 4215277576, 3544514560, 4215277572, 3544776704, 4215277572,
+    3545300992, 52955145, 4215277576, 3545497600, 53020681, 4215277580, 3545497600, 4215277572,
+    3545890816, 4215277576, 3546021888, 4215277576, 3546021888, 17928, 4215277576, 3546873856,
+    4215277576, 3546873856, 17928, 4215277580, 3547332608, 4215277572, 3547529216, 4215277572,
+    3547660288, 4215277572, 3548184576, 4215277572, 3548315648, 4215277576, 3548512256, 4215277576,
+    3548512256, 17928, 4215277576, 3551920128, 4215277572, 3552772096, 4215277576, 3553099776,
+    4215277572, 3553230848, 4215277624, 3553361920, 4215277572, 3554607104, 4215277576, 3554869248,
+    4215277572, 3555000320, 4215277572, 3555393536, 4215277580, 3555655680, 4215277572, 3555786752,
+    4215277580, 3555917824, 4215277624, 3555917824, 4215277572, 3557163008, 4215277624, 3557294080,
+    52955145, 4215277576, 3557621760, 53020681, 4215277580, 3557621760, 4215277572, 3557752832,
+    4215277572, 3558670336, 4215277572, 3560439808, 4215277624, 3560505344, 4215277572, 3561095168,
+    4215277572, 3561488384, 4215277572, 3563585536, 52955145, 4215277576, 3564896256, 53020681,
+    4215277572, 3567124480, 4215277572, 3567386624, 4215277572, 3569156096, 4215277572, 3572891648,
+    4215277572, 3574595584, 4215277580, 3578724352, 4215277572, 3578986496, 4215277572, 3579117568,
+    4215277572, 3580035072, 4215277572, 3582197760, 4215277572, 3582394368, 4215277572, 3583574016,
+    4215277572, 3583836160, 4215277572, 3584753664, 4215277572, 3585277952, 4215277624, 3585474560,
+    4215277572, 3586129920, 4215277572, 3586260992, 4215277572, 3588358144, 4215277572, 3590717440,
+    4215277572, 3595632640, 4215277572, 3597139968, 4215277572, 3597926400, 4215277576, 3604414464,
+    52955145, 4215277576, 3604676608, 53020681, 4215277580, 3604676608, 4215277608, 3604676608,
+    4215277572, 3606642688, 4215277572, 3608543232, 4215277572, 3608608768, 4215277576, 3609133056,
+    52955145, 4215277576, 3609133056, 53020681, 4215277580, 3609133056, 4215277608, 3610247168,
+    4215277572, 3616210944, 4215277572, 3620601856, 4215277572, 3623092224, 4215277572, 3624730624,
+    4215277572, 3627089920, 4215277572, 3627155456, 4215277572, 3628072960, 4215277572, 3629776896,
+    4215277572, 3630039040, 4215277572, 3634888704, 4215277572, 3635150848, 4215277572, 3635609600,
+    4215277572, 3638034432, 4215277572, 3638493184, 4215277576, 3639279616, 4215277572, 3639476224,
+    4215277624, 3639607296, 4215277572, 3639738368, 4215277572, 3640066048, 4215277576, 3640786944,
+    4215277572, 3641049088, 4215277576, 3641311232, 4215277576, 3642032128, 4215277572, 3642359808,
+    4215277624, 3642359808, 4215277580, 3642490880, 4215277572, 3642884096, 4215277576, 3643211776,
+    4215277624, 3643211776, 4215277624, 3949133824, 4215277608, 3643342848, 4215277624, 3643342848,
+    4215277572, 3645112320, 4215277572, 3645374464, 4215277572, 3645964288, 4215277572, 3646160896,
+    4215277572, 3647078400, 4215277572, 3648192512, 4215277576, 3648192512, 4215277580, 3648192512,
+    4215277572, 3654811648, 4215277572, 3656122368, 4215277572, 3659202560, 4215277572, 3659988992,
+    4215277572, 3663855616, 4215277572, 3664117760, 4215277572, 3669295104, 4215277572, 3674734592,
+    4215277572, 3676831744, 4215277572, 3678273536, 4215277576, 3679453184, 4215277624, 3679911936,
+    52955145, 4215277576, 3680894976, 53020681, 4215277580, 3680894976, 4215277576, 3682598912,
+    4215277572, 3682926592, 59377673, 4215277576, 3683188736, 59443209, 4215277580, 3684106240,
+    4215277572, 3686989824, 4215277572, 3688366080, 4215277572, 3689349120, 4215277572, 3689807872,
+    4215277572, 3690135552, 4215277576, 3690463232, 4215277572, 3690921984, 4215277572, 3691380736,
+    4215277576, 3691970560, 4215277576, 3691970560, 17928, 4215277576, 3691970560, 17992,
+    4215277572, 3693215744, 4215277576, 3693215744, 4215277576, 3693215744, 17928, 4215277576,
+    3693281280, 4215277576, 3693281280, 17928, 4215277576, 3694657536, 4215277572, 3695116288,
+    4215277572, 3697278976, 4215277572, 3697410048, 4215277572, 3697541120, 4215277572, 3697606656,
+    4215277572, 3698196480, 4215277576, 3698196480, 4215277576, 3698393088, 4215277572, 3700228096,
+    4215277572, 3703570432, 4215277572, 3709403136, 4215277572, 3712155648, 4215277572, 3713007616,
+    4215277572, 3714777088, 4215277572, 3714973696, 4215277572, 3715891200, 4215277572, 3719430144,
+    4215277572, 3719954432, 4215277576, 3722117120, 4215277572, 3722510336, 4215277572, 3722575872,
+    4215277576, 3722772480, 4215277580, 3722838016, 4215277624, 3722838016, 4215277576, 3723558912,
+    4215277576, 3723689984, 4215277572, 3724345344, 4215277576, 3724410880, 4215277572, 3727163392,
+    4215277572, 3728539648, 4215277572, 3731423232, 4215277576, 3732013056, 4215277624, 3732078592,
+    4215277624, 3792699392, 4215277572, 3732144128, 4215277576, 3732537344, 4215277580, 3732668416,
+    4215277576, 3732865024, 4215277572, 3735420928, 4215277572, 3736076288, 4215277572, 3736272896,
+    4215277572, 3736469504, 4215277572, 3737714688, 4215277572, 3737780224, 4215277572, 3738304512,
+    4215277572, 3738370048, 4215277572, 3738763264, 4215277572, 3740008448, 4215277576, 3740532736,
+    4215277572, 3741188096, 4215277576, 3741188096, 4215277572, 3741581312, 4215277576, 3742040064,
+    4215277576, 3742564352, 4215277572, 3743547392, 4215277576, 3746562048, 4215277576, 3746562048,
+    17928, 4215277576, 3746627584, 4215277572, 3746758656, 4215277576, 3747676160, 4215277572,
+    3747741696, 4215277572, 3748200448, 4215277572, 3748331520, 4215277576, 3748855808, 4215277572,
+    3750428672, 4215277624, 3750494208, 4215277580, 3751215104, 4215277572, 3751411712, 4215277572,
+    3752394752, 4215277572, 3752656896, 4215277576, 3754098688, 4215277576, 3754098688, 17928,
+    4215277576, 3754164224, 4215277572, 3754754048, 4215277572, 3755409408, 4215277572, 3757375488,
+    4215277572, 3757637632, 4215277572, 3759276032, 4215277572, 3759931392, 4215277572, 3765764096,
+    4215277572, 3766550528, 4215277572, 3767795712, 4215277572, 3771138048, 4215277572, 3772252160,
+    4215277572, 3772841984, 4215277572, 3775397888, 4215277572, 3779330048, 4215277572, 3779592192,
+    4215277572, 3779854336, 4215277572, 3779985408, 4215277572, 3781165056, 4215277572, 3781689344,
+    4215277572, 3782868992, 4215277572, 3784179712, 4215277572, 3784310784, 4215277572, 3785621504,
+    4215277572, 3786342400, 4215277572, 3786539008, 4215277572, 3789422592, 4215277572, 3790733312,
+    4215277572, 3790995456, 4215277572, 3791650816, 4215277576, 3792175104, 4215277572, 3792699392,
+    4215277572, 3793420288, 4215277572, 3794665472, 4215277572, 3795058688, 4215277576, 3795189760,
+    4215277576, 3796566016, 4215277624, 3796566016, 4215277576, 3796631552, 59377673, 4215277576,
+    3797090304, 59443209, 4215277624, 3797090304, 4215277572, 3797745664, 4215277624, 3801415680,
+    4215277572, 3803250688, 4215277572, 3804823552, 4215277572, 3805216768, 4215277572, 3805478912,
+    4215277572, 3805544448, 4215277572, 3808165888, 4215277572, 3808296960, 4215277624, 3808886784,
+    4215277572, 3812425728, 4215277572, 3813670912, 4215277624, 3813998592, 4215277572, 3815243776,
+    4215277572, 3816488960, 4215277572, 3817013248, 4215277572, 3818913792, 4215277572, 3819503616,
+    4215277572, 3821273088, 4215277572, 3821338624, 4215277572, 3823370240, 4215277572, 3827040256,
+    4215277572, 3827433472, 4215277572, 3830579200, 4215277572, 3832086528, 4215277572, 3833004032,
+    4215277572, 3833462784, 4215277572, 3835297792, 4215277572, 3835494400, 4215277572, 3838050304,
+    4215277576, 3845062656, 4215277576, 3845390336, 4215277576, 3845455872, 4215277572, 3847159808,
+    4215277572, 3847618560, 59377673, 4215277576, 3847684096, 59443209, 4215277572, 3849060352,
+    4215277572, 3849846784, 4215277576, 3850829824, 4215277580, 3850829824, 4215277576, 3851878400,
+    4215277572, 3852009472, 4215277624, 3852009472, 4215277576, 3852730368, 4215277624, 3853516800,
+    4215277576, 3854106624, 4215277572, 3854893056, 4215277576, 3856662528, 4215277576, 3856728064,
+    4215277572, 3856793600, 4215277572, 3856859136, 4215277576, 3856990208, 52955145, 4215277576,
+    3856990208, 53020681, 4215277580, 3856990208, 4215277576, 3856990208, 17928, 4215277624,
+    3859677184, 4215277624, 3971678208, 4215277572, 3860004864, 4215277624, 3860856832, 4215277624,
+    3861708800, 4215277624, 3565944832, 4215277572, 3863543808, 4215277572, 3866361856, 4215277572,
+    3867672576, 4215277572, 3868262400, 4215277572, 3868983296, 4215277572, 3870556160, 4215277572,
+    3871735808, 4215277576, 3874488320, 4215277572, 3874750464, 4215277572, 3875012608, 4215277572,
+    3875536896, 4215277576, 3876061184, 52955145, 4215277576, 3876061184, 53020681, 4215277580,
+    3876061184, 4215277624, 3876061184, 4215277576, 3876061184, 17928, 52955145, 4215277576,
+    3876126720, 53020681, 4215277580, 3876126720, 4215277624, 3876126720, 4215277572, 3877044224,
+    4215277572, 3877306368, 4215277572, 3877699584, 4215277576, 3878158336, 52955145, 4215277576,
+    3878158336, 53020681, 4215277580, 3878158336, 59377673, 4215277576, 3878420480, 59443209,
+    4215277572, 3880648704, 4215277572, 3880976384, 4215277572, 3881172992, 4215277572, 3881697280,
+    4215277572, 3883597824, 4215277572, 3884253184, 4215277572, 3885432832, 4215277572, 3891462144,
+    4215277572, 3891920896, 4215277572, 3893821440, 4215277572, 3894345728, 52955145, 4215277576,
+    3895066624, 53020681, 4215277580, 3895066624, 4215277624, 3895066624, 4215277624, 3742302208,
+    4215277624, 3474587648, 4215277624, 4181590016, 4215277572, 3897688064, 4215277572, 3900768256,
+    4215277572, 3901030400, 4215277572, 3901620224, 4215277572, 3903324160, 4215277572, 3910402048,
+    4215277572, 3913416704, 4215277572, 3919773696, 4215277572, 3924426752, 4215277572, 3925999616,
+    4215277572, 3927113728, 4215277572, 3936878592, 4215277572, 3939696640, 4215277572, 3940220928,
+    4215277572, 3942907904, 4215277576, 3944742912, 4215277572, 3944808448, 4215277572, 3948150784,
+    4215277576, 3949068288, 4215277580, 3949133824, 4215277572, 3950116864, 4215277572, 3950444544,
+    4215277572, 3950575616, 4215277576, 3950575616, 4215277576, 3950641152, 17928, 4215277572,
+    3953065984, 4215277572, 3954049024, 4215277576, 3954376704, 4215277572, 3954835456, 4215277572,
+    3954900992, 4215277576, 3955949568, 4215277576, 3956080640, 4215277576, 3956539392, 4215277576,
+    3956998144, 4215277576, 3960406016, 4215277576, 3960537088, 4215277576, 3960733696, 4215277576,
+    3962830848, 52955145, 4215277576, 3962830848, 53020681, 4215277580, 3962830848, 4215277576,
+    3962896384, 4215277576, 3963224064, 4215277572, 3964534784, 4215277572, 3966173184, 4215277572,
+    3968335872, 4215277572, 3971940352, 4215277572, 3972792320, 4215277572, 3972857856, 4215277572,
+    3974430720, 4215277580, 3974627328, 4215277572, 3977641984, 4215277572, 3977969664, 4215277572,
+    3978166272, 4215277572, 3979608064, 4215277572, 3980263424, 4215277572, 3980460032, 4215277572,
+    3983081472, 4215277572, 3983147008, 4215277572, 3983998976, 4215277572, 3984064512, 4215277572,
+    3984916480, 4215277572, 3989504000, 4215277572, 3990487040, 4215277572, 3991535616, 4215277572,
+    3992518656, 4215277572, 3994681344, 4215277572, 3996057600, 4215277572, 4000186368, 4215277624,
+    4001366016, 4215277572, 4003201024, 4215277572, 4005167104, 4215277572, 4006019072, 4215277572,
+    4006281216, 4215277572, 4006674432, 4215277572, 4007329792, 4215277572, 4010737664, 4215277624,
+    4011065344, 4215277572, 4011982848, 4215277572, 4012048384, 4215277572, 4016963584, 4215277572,
+    4022730752, 4215277572, 4025155584, 4215277572, 4026400768, 4215277572, 4028301312, 4215277572,
+    4028497920, 4215277572, 4030267392, 4215277572, 4031381504, 4215277576, 4033544192, 52955145,
+    4215277576, 4033544192, 53020681, 4215277580, 4033544192, 4215277576, 4033609728, 4215277572,
+    4033871872, 4215277572, 4034330624, 4215277572, 4034723840, 4215277572, 4036558848, 4215277572,
+    4037869568, 59377673, 4215277576, 4038656000, 59443209, 4215277572, 4039639040, 4215277572,
+    4040753152, 4215277624, 4045471744, 4215277572, 4047831040, 4215277572, 4048093184, 4215277572,
+    4050518016, 4215277572, 4053532672, 4215277572, 4056809472, 4215277572, 4056940544, 4215277572,
+    4061134848, 4215277572, 4061855744, 4215277572, 4062707712, 4215277576, 4062838784, 4215277572,
+    4062904320, 4215277576, 4062904320, 4215277576, 4062904320, 17928, 4215277572, 4063559680,
+    4215277576, 4063625216, 4215277576, 4063952896, 4215277576, 4064215040, 4215277576, 4064739328,
+    4215277572, 4065329152, 4215277576, 4065918976, 4215277576, 4066050048, 4215277576, 4066050048,
+    17928, 4215277572, 4066508800, 52955145, 4215277576, 4068016128, 53020681, 4215277580,
+    4068016128, 4215277572, 4068474880, 4215277572, 4069851136, 4215277576, 4071358464, 4215277576,
+    4071424000, 4215277572, 4071555072, 4215277572, 4072669184, 4215277572, 4076601344, 4215277572,
+    4079616000, 4215277572, 4084531200, 4215277572, 4084858880, 4215277576, 4085514240, 4215277572,
+    4085710848, 4215277576, 4085841920, 4215277572, 4085972992, 4215277576, 4085972992, 17928,
+    4215277572, 4087676928, 4215277572, 4088528896, 4215277572, 4091412480, 4215277572, 4094033920,
+    4215277572, 4094230528, 4215277572, 4095868928, 4215277572, 4098293760, 4215277572, 4099670016,
+    4215277572, 4100521984, 4215277572, 4101046272, 4215277572, 4102356992, 4215277572, 4102619136,
+    4215277572, 4103602176, 4215277572, 4106878976, 4215277576, 4108058624, 4215277576, 4108713984,
+    4215277572, 4110811136, 4215277576, 4111990784, 4215277576, 4112449536, 4215277624, 4112449536,
+    4215277572, 4112777216, 4215277576, 4113039360, 4215277576, 4113563648, 4215277608, 4113694720,
+    4215277624, 4113760256, 4215277580, 4114022400, 4215277572, 4114284544, 4215277572, 4114481152,
+    4215277572, 4116250624, 4215277572, 4117037056, 4215277572, 4117757952, 4215277576, 4119527424,
+    4215277576, 4119527424, 17928, 4215277576, 4119986176, 4215277572, 4125229056, 4215277572,
+    4128243712, 4215277572, 4129095680, 4215277572, 4129226752, 4215277572, 4131520512, 4215277572,
+    4134076416, 4215277576, 4134928384, 4215277576, 4135387136, 4215277576, 4138598400, 4215277576,
+    4139712512, 4215277572, 4140433408, 59377673, 4215277576, 4141285376, 59443209, 4215277572,
+    4141547520, 52955145, 4215277576, 4142071808, 53020681, 4215277580, 4142071808, 4215277572,
+    4142333952, 4215277576, 4142792704, 4215277576, 4142792704, 17928, 4215277572, 4143185920,
+    4215277572, 4144037888, 4215277572, 4145938432, 4215277572, 4146003968, 4215277572, 4148166656,
+    4215277572, 4148822016, 4215277572, 4153081856, 4215277572, 4154916864, 4215277576, 4158324736,
+    4215277576, 4158783488, 4215277576, 4159897600, 4215277572, 4165861376, 4215277572, 4167761920,
+    4215277572, 4169924608, 4215277572, 4170252288, 4215277572, 4173987840, 4215277572, 4174118912,
+    4215277572, 4177199104, 4215277572, 4180279296, 4215277576, 4181327872, 4215277576, 4181327872,
+    17928, 4215277576, 4181393408, 4215277572, 4181458944, 4215277572, 4181590016, 52955145,
+    4215277576, 4181590016, 53020681, 4215277580, 4181590016, 4215277572, 4182245376, 4215277572,
+    4182310912, 4215277572, 4182769664, 4215277572, 4183162880, 4215277572, 4183621632, 52955145,
+    4215277576, 4183621632, 53020681, 4215277580, 4183621632, 4215277572, 4183687168, 4215277572,
+    4184145920, 52955145, 4215277576, 4184670208, 53020681, 4215277572, 4185849856, 4215277624,
+    4185980928, 4215277572, 4186767360, 4215277572, 4186832896, 4215277572, 4186898432, 4215277572,
+    4188930048, 4215277576, 4189585408, 4215277576, 4189978624, 4215277572, 4190765056, 4215277580,
+    4191682560, 4215277572, 4192927744, 4215277572, 4196139008, 4215277572, 4198498304, 4215277572,
+    4199153664, 4215277572, 4199481344, 4215277576, 4201906176, 4215277624, 4202299392, 4215277572,
+    4202758144, 4215277572, 4205903872, 4215277572, 4207607808, 4215277576, 4207607808, 4215277572,
+    4209901568, 4215277576, 4210622464, 4215277576, 4210622464, 17928, 4215277572, 4213178368,
+    4215277580, 4220452864, 4215277572, 4223664128, 4215277572, 4224057344, 4215277572, 4224253952,
+    4215277572, 4231921664, 4215277572, 4234149888, 4215277576, 4235395072, 4215277572, 4235919360,
+    4215277572, 4237426688, 4215277572, 4240310272, 4215277572, 4241620992, 4215277572, 4241883136,
+    4215277572, 4242735104, 4215277572, 4242997248, 4215277572, 4243062784, 4215277576, 4244111360,
+    4215277576, 4244176896, 4215277572, 4244635648, 4215277572, 4245684224, 4215277572, 4246863872,
+    4215277572, 4247715840, 4215277624, 4248961024, 4215277572, 4250599424, 4215277572, 4251123712,
+    4215277572, 4255121408, 4215277572, 4257087488, 4215277572, 4257677312, 4215277572, 4260626432,
+    4215277572, 4261543936, 4215277572, 4262002688, 4215277572, 4265017344, 4215277572, 4265672704,
+    4215277572, 4265934848, 4215277576, 4271833088, 4215277576, 4281729024, 4215277572, 4282253312,
+    4215277576, 4283498496, 4215277576, 4283564032, 4215277576, 4283564032, 17928, 4215277576,
+    4283629568, 4215277576, 4283629568, 17928, 4215277576, 4283629568, 17992, 4215277572,
+    4285661184, 4215277572, 4286119936, 4215277572, 4286185472, 4215277572, 4286906368, 4215277576,
+    4287234048, 4215277576, 4287234048, 17928, 4215277576, 4287234048, 17992, 4215277576,
+    4287299584, 4215277572, 4287954944, 4215277572, 4288282624, 4215277572, 4290576384, 4215277576,
+    4290576384, 4215277572, 4294574080, 4215343108, 2147549184, 4215343112, 2147549184, 4215343112,
+    2147614720, 4215343108, 2147811328, 4215343112, 2148270080, 4215343112, 2148663296, 4215343112,
+    2150825984, 4215343108, 2152071168, 4215343108, 2153775104, 4215343108, 2154758144, 4215343108,
+    2154823680, 4215343108, 2155741184, 4215343112, 2155806720, 4215343112, 2155806720, 17928,
+    4215343112, 2155872256, 4215343112, 2156462080, 4215343112, 2156462080, 17928, 4215343108,
+    2156593152, 4215343108, 2158821376, 4215343108, 2159149056, 4215343108, 2164457472, 4215343108,
+    2168324096, 4215343108, 2178416640, 4215343112, 2179137536, 4215343108, 2179465216, 4215343112,
+    2179596288, 52955145, 4215343112, 2179596288, 53020681, 4215343108, 2179792896, 4215343112,
+    2180186112, 52955145, 4215343112, 2180186112, 53020681, 4215343112, 2180775936, 4215343112,
+    2180775936, 17928, 4215343108, 2181103616, 4215343108, 2181300224, 4215343112, 2181824512,
+    4215343108, 2182610944, 4215343112, 2182807552, 4215343112, 2183069696, 4215343112, 2188247040,
+    4215343108, 2188312576, 4215343112, 2188509184, 4215343112, 2188902400, 4215343108, 2188967936,
+    4215343112, 2188967936, 4215343112, 2188967936, 17928, 4215343112, 2188967936, 17992,
+    4215343108, 2190147584, 4215343108, 2190540800, 4215343108, 2191327232, 4215343108, 2192637952,
+    4215343108, 2192769024, 4215343108, 2193424384, 4215343108, 2196045824, 4215343108, 2196111360,
+    4215343108, 2199715840, 4215343108, 2200109056, 4215343108, 2201354240, 4215343108, 2203189248,
+    4215343108, 2203254784, 4215343108, 2204303360, 4215343108, 2209153024, 4215343108, 2210201600,
+    4215343108, 2210988032, 4215343108, 2211053568, 4215343108, 2211184640, 4215343108, 2212233216,
+    4215343108, 2212954112, 4215343108, 2213478400, 4215343108, 2213609472, 4215343108, 2218590208,
+    4215343108, 2219376640, 4215343108, 2220294144, 4215343108, 2230190080, 4215343108, 2230386688,
+    4215343108, 2230517760, 4215343108, 2231107584, 4215343108, 2232811520, 4215343108, 2237923328,
+    4215343108, 2244804608, 4215343108, 2247753728, 4215343108, 2248540160, 4215343108, 2249326592,
+    4215343108, 2251096064, 4215343108, 2252275712, 4215343112, 2253193216, 4215343112, 2253258752,
+    4215343108, 2253389824, 4215343108, 2254176256, 4215343108, 2254897152, 4215343108, 2255028224,
+    4215343112, 2255159296, 4215343108, 2257059840, 4215343108, 2259222528, 4215343108, 2262958080,
+    4215343108, 2265841664, 4215343108, 2267545600, 4215343108, 2271936512, 4215343108, 2272854016,
+    4215343108, 2273705984, 4215343108, 2277113856, 4215343108, 2279669760, 4215343108, 2281766912,
+    4215343108, 2283732992, 4215343112, 2285895680, 4215343108, 2286682112, 4215343112, 2286682112,
+    4215343108, 2287992832, 4215343108, 2288189440, 4215343112, 2288189440, 4215343112, 2288254976,
+    4215343108, 2294415360, 4215343108, 2295267328, 4215343108, 2295791616, 4215343108, 2296250368,
+    4215343108, 2296446976, 4215343108, 2297954304, 4215343108, 2298085376, 4215343108, 2299527168,
+    4215343108, 2302738432, 4215343108, 2305032192, 4215343112, 2306736128, 4215343112, 2306801664,
+    4215343112, 2306867200, 4215343108, 2307260416, 4215343108, 2307588096, 4215343112, 2307588096,
+    4215343108, 2308308992, 4215343112, 2311127040, 4215343112, 2312241152, 4215343112, 2312241152,
+    17928, 4215343160, 2313355264, 4215343112, 2315255808, 4215343108, 2325741568, 4215343108,
+    2326396928, 4215343108, 2327773184, 4215343108, 2328559616, 4215343108, 2329018368, 4215343108,
+    2329280512, 4215343108, 2330787840, 4215343108, 2331508736, 4215343108, 2331901952, 4215343108,
+    2332098560, 4215343108, 2335768576, 4215343108, 2337800192, 4215343108, 2340421632, 4215343108,
+    2341076992, 4215343112, 2342518784, 4215343112, 2352414720, 4215343112, 2353397760, 4215343108,
+    2353528832, 4215343108, 2354380800, 4215343112, 2354380800, 4215343112, 2356674560, 4215343112,
+    2359099392, 52955145, 4215343112, 2359361536, 53020681, 4215343116, 2359361536, 4215343160,
+    2359885824, 4215343108, 2360016896, 4215343108, 2361458688, 4215343108, 2361524224, 52955145,
+    4215343112, 2361851904, 53020681, 4215343116, 2361851904, 4215343108, 2361917440, 4215343108,
+    2362638336, 4215343108, 2366111744, 4215343108, 2367356928, 4215343112, 2367488000, 4215343112,
+    2372141056, 4215343112, 2372927488, 4215343160, 2372927488, 4215343108, 2373386240, 4215343112,
+    2377318400, 4215343112, 2377318400, 17928, 4215343108, 2377908224, 4215343108, 2378891264,
+    4215343108, 2381250560, 4215343108, 2381316096, 4215343112, 2393571328, 4215343108, 2395602944,
+    4215343112, 2395602944, 4215343108, 2396258304, 4215343108, 2401632256, 4215343108, 2401894400,
+    4215343108, 2402811904, 4215343108, 2403008512, 4215343108, 2405564416, 4215343112, 2405826560,
+    4215343112, 2409299968, 4215343108, 2409496576, 4215343108, 2410676224, 4215343112, 2410676224,
+    4215343112, 2411003904, 4215343108, 2411069440, 4215343112, 2411069440, 4215343112, 2411069440,
+    17928, 4215343112, 2411069440, 17992, 4215343108, 2418212864, 4215343108, 2419589120,
+    4215343160, 2420768768, 4215343116, 2422800384, 4215343108, 2423390208, 4215343108, 2424045568,
+    4215343108, 2425290752, 4215343112, 2425421824, 4215343112, 2425421824, 17928, 4215343108,
+    2425618432, 4215343108, 2429419520, 4215343108, 2430468096, 4215343108, 2431713280, 4215343108,
+    2432499712, 4215343108, 2433810432, 4215343108, 2434465792, 4215343112, 2437480448, 4215343160,
+    2437742592, 4215343108, 2439643136, 4215343108, 2442723328, 4215343108, 2444492800, 4215343112,
+    2445672448, 4215343108, 2446065664, 4215343112, 2446065664, 4215343108, 2446262272, 4215343108,
+    2446393344, 4215343112, 2446393344, 52955145, 4215343112, 2446393344, 53020681, 4215343116,
+    2446393344, 4215343108, 2452881408, 4215343108, 2453143552, 4215343108, 2457206784, 4215343108,
+    2457600000, 4215343108, 2463563776, 4215343108, 2463629312, 4215343108, 2466512896, 4215343108,
+    2471100416, 4215343108, 2482569216, 4215343108, 2484404224, 4215343112, 2491744256, 4215343112,
+    2507603968, 4215343112, 2507669504, 4215343112, 2508128256, 4215343112, 2508193792, 4215343108,
+    2508914688, 4215343108, 2511142912, 4215343108, 2511798272, 4215343112, 2515009536, 4215343112,
+    2518417408, 4215343112, 2518417408, 17928, 4215343112, 2518482944, 4215343108, 2519597056,
+    4215343108, 2521497600, 4215343108, 2521628672, 4215343108, 2524250112, 4215343108, 2524446720,
+    4215343108, 2524708864, 4215343108, 2525364224, 4215343108, 2527264768, 4215343112, 2528509952,
+    4215343108, 2528575488, 4215343108, 2528641024, 4215343112, 2528706560, 4215343108, 2529361920,
+    4215343108, 2531393536, 4215343108, 2531459072, 4215343112, 2531786752, 4215343112, 2531786752,
+    17928, 4215343108, 2532704256, 4215343108, 2532769792, 4215343108, 2535653376, 4215343108,
+    2536636416, 4215343108, 2538078208, 4215343112, 2538668032, 4215343112, 2538733568, 4215343108,
+    2538995712, 4215343112, 2539520000, 4215343112, 2539782144, 4215343112, 2540240896, 4215343112,
+    2546663424, 4215343108, 2547712000, 4215343108, 2548039680, 4215343112, 2548432896, 4215343112,
+    2548891648, 4215343112, 2549284864, 4215343108, 2550071296, 4215343112, 2550202368, 4215343116,
+    2550464512, 4215343108, 2550857728, 4215343108, 2551709696, 4215343108, 2552823808, 4215343108,
+    2554003456, 4215343108, 2556297216, 4215343112, 2557804544, 4215343112, 2561146880, 4215343112,
+    2563637248, 4215343112, 2564489216, 4215343112, 2564685824, 4215343112, 2564751360, 4215343112,
+    2564816896, 4215343112, 2564816896, 17928, 4215343108, 2564947968, 4215343108, 2565799936,
+    4215343108, 2566651904, 4215343108, 2569535488, 4215343108, 2569601024, 4215343112, 2573402112,
+    4215343112, 2576744448, 4215343112, 2576744448, 17928, 4215343112, 2576941056, 4215343108,
+    2577858560, 4215343112, 2578186240, 4215343108, 2579628032, 4215343108, 2582708224, 4215343108,
+    2583560192, 4215343108, 2590638080, 4215343112, 2590769152, 4215343112, 2594701312, 4215343112,
+    2594701312, 17928, 4215343112, 2597847040, 4215343112, 2598305792, 4215343108, 2601648128,
+    4215343112, 2602893312, 4215343112, 2603548672, 4215343112, 2603745280, 4215343112, 2604400640,
+    4215343112, 2604400640, 17928, 4215343112, 2606366720, 4215343108, 2607742976, 4215343108,
+    2621440000, 4215343108, 2622947328, 4215343112, 2625372160, 4215343112, 2632253440, 4215343108,
+    2633826304, 4215343108, 2640773120, 4215343108, 2645819392, 4215343108, 2650406912, 4215343108,
+    2652766208, 4215343112, 2652831744, 4215343112, 2658467840, 4215343112, 2658467840, 17928,
+    4215343108, 2659123200, 4215343112, 2659123200, 4215343108, 2660696064, 4215343108, 2661220352,
+    4215343112, 2661613568, 4215343112, 2661679104, 4215343108, 2663055360, 4215343112, 2663055360,
+    4215343112, 2663579648, 4215343112, 2663645184, 4215343112, 2664235008, 4215343108, 2664300544,
+    4215343112, 2664497152, 4215343108, 2667118592, 4215343112, 2667118592, 4215343112, 2667380736,
+    4215343108, 2667446272, 4215343112, 2667446272, 4215343108, 2667905024, 4215343112, 2668494848,
+    4215343108, 2668560384, 4215343112, 2668822528, 4215343108, 2669019136, 4215343112, 2669674496,
+    4215343108, 2671443968, 4215343112, 2671443968, 4215343108, 2671968256, 4215343112, 2672427008,
+    4215343112, 2672427008, 17928, 4215343112, 2672820224, 4215343112, 2672951296, 4215343112,
+    2672951296, 17928, 4215343112, 2675900416, 4215343108, 2676817920, 4215343112, 2676817920,
+    4215343112, 2676817920, 17928, 4215343108, 2676883456, 4215343112, 2677604352, 4215343108,
+    2677800960, 4215343112, 2677800960, 4215343112, 2677800960, 17928, 4215343112, 2677800960,
+    17992, 4215343112, 2677997568, 4215343112, 2678063104, 4215343108, 4195221504, 4215343108,
+    4195287040, 4215343108, 4195418112, 4215343108, 4195549184, 4215343108, 4195614720, 4215343108,
+    4196335616, 4215343108, 4196466688, 4215343108, 4196597760, 4215343108, 4196663296, 4215343108,
+    4196859904, 4215343108, 4196925440, 4215343108, 4196990976, 4219471876, 3030253568, 4219471876,
+    3032023040, 4219471876, 3032154112, 4219471876, 3034513408, 4219471876, 3038052352, 4219471876,
+    3069050880, 4219471876, 3069968384, 4219471876, 3078684672, 4219471876, 3090087936, 4219471876,
+    3093430272, 4219471876, 3095134208, 4219471876, 3100049408, 4219471876, 3101884416, 4219471876,
+    3105619968, 4219471876, 3107586048, 4219471876, 3123576832, 4219471876, 3127640064, 4219471876,
+    3135504384, 4219471876, 3137863680, 4219471876, 3138977792, 4219471876, 3142123520, 4219471876,
+    3147628544, 4219471876, 3155689472, 4219471876, 3159228416, 4219471876, 3174236160, 4219471876,
+    3180724224, 4219471876, 3198943232, 4219471876, 3199729664, 4219471876, 3206217728, 4219471876,
+    3220963328, 4219471876, 3221749760, 4219471876, 3222798336, 4219471876, 3224961024, 4219471876,
+    3225812992, 4219471876, 3231055872, 4219471876, 3236102144, 4219471876, 3241082880, 4219471876,
+    3254910976, 4219471876, 3257335808, 4219471876, 3265265664, 4219471876, 3271622656, 4219471876,
+    3274964992, 4219471876, 3277389824, 4219471876, 3285516288, 4219471876, 3285778432, 4219471876,
+    3289055232, 4219471876, 3295346688, 4219471876, 3307929600, 4219471876, 3311206400, 4219471876,
+    3311468544, 4219471876, 3312123904, 4219471876, 3319201792, 4219471876, 3321430016, 4219471876,
+    3325362176, 4219471876, 3334340608, 4219471876, 3334930432, 4219471876, 3381985280, 4219471876,
+    3387293696, 4219471876, 3396206592, 4219471876, 3396730880, 4219471876, 3400663040, 4219471876,
+    3409117184, 4219471876, 3419275264, 4219471876, 3436052480, 4219471876, 3438084096, 4219471876,
+    3438804992, 4219471876, 3444965376, 4219734020, 2166489088, 4219734020, 2233204736, 4219734020,
+    2233794560, 4219734020, 2236284928, 4219734020, 2251948032, 4219734020, 2281963520, 4219734020,
+    2296250368, 4219734020, 2318139392, 4219734020, 2338521088, 4219734020, 2497970176, 4219734020,
+    2527592448, 4219734020, 2531917824, 4219734020, 2580021248, 4219734020, 2602041344, 4219734020,
+    2634743808, 4219734020, 2648965120, 4219734020, 2649096192, 4219734020, 2709716992, 4219734020,
+    2711552000, 4219734020, 2737897472, 4219734020, 2798911488, 4219734020, 2823028736, 4219734020,
+    2823421952, 4219734020, 2869690368, 4219734020, 2884698112, 4219734020, 2953445376, 4219734020,
+    2998403072, 4219734020, 3009347584, 4219734020, 3012755456, 4219734020, 3013345280, 4219734020,
+    3015901184, 4219734020, 3017080832, 4219734020, 3027042304, 4219734020, 3064135680, 4219734020,
+    3097952256, 4219734020, 3129802752, 4219734020, 3136946176, 4219734020, 3166437376, 4219734020,
+    3172859904, 4219734020, 3201368064, 4219734020, 3210608640, 4219734020, 3213754368, 4219734020,
+    3261267968, 4219734020, 3270377472, 4219734020, 3282763776, 4219734020, 3322413056, 4219734020,
+    3342139392, 4219734020, 3356753920, 4219734020, 3426091008, 4219734020, 3432120320, 4219734020,
+    3483435008, 4219734020, 3484942336, 4219734020, 3494117376, 4219734020, 3505520640, 4219734020,
+    3505586176, 4219734020, 3508076544, 4219734020, 3509780480, 4219734020, 3527999488, 4219734020,
+    3558670336, 4219734020, 3592814592, 4219734020, 3600416768, 4219734020, 3603234816, 4219734020,
+    3648782336, 4219734020, 3668377600, 4219734020, 3685416960, 4219734020, 3699376128, 4219734020,
+    3704619008, 4219734020, 3750100992, 4219734020, 3789160448, 4219734020, 3794272256, 4219734020,
+    3796303872, 4219734020, 3805872128, 4219734020, 3812491264, 4219734020, 3839492096, 4219734020,
+    3844276224, 4219734020, 3852992512, 4219734020, 3886481408, 4219734020, 3887398912, 4219734020,
+    3946577920, 4219734020, 3962961920, 4219734020, 3973382144, 4219734020, 3983212544, 4219734020,
+    4012638208, 4219734020, 4021354496, 4219734020, 4040294400, 4219734020, 4090101760, 4219734020,
+    4133945344, 4219734020, 4172152832, 4219734020, 4184211456, 4219734020, 4238868480, 4219734020,
+    4275240960, 4219734020, 4281270272, 4219799556, 2245132288, 4219799556, 2246901760, 4219799556,
+    2267938816, 4219799556, 2348417024, 4219799556, 2373386240, 4219799556, 2437218304, 4219799556,
+    2447310848, 4219799556, 2451177472, 4219799556, 2483683328, 4219799556, 2492858368, 4219799556,
+    2511732736, 4219799556, 2603614208, 4219799556, 2697854976, 4219799556, 2701459456, 4219799556,
+    2718826496, 4219799556, 2727411712, 4219799556, 2744254464, 4219799556, 2785017856, 4294772740,
+    840370180, 844171268, 840435716, 844171268, 840501252, 844171268, 840566788, 844171268,
+    840632324, 844171268, 840697860, 844171268, 840763396, 844171268, 840828932, 844171268,
+    840894468, 844171268, 840960004, 844171268, 841025540, 844171268, 841091076, 844171268,
+    841156612, 844171268, 841222148, 844171268, 841287684, 844171268, 841353220, 844171268,
+    841418756, 844171268, 841484292, 844171268, 841549828, 844171268, 841615364, 844171268,
+    841680900, 844171268, 841746436, 844171268, 841811972, 844171268, 841877508, 844171268,
+    841943044, 844171268, 842008580, 844171268, 842074116, 844171268, 842139652, 844171268,
+    842205188, 844171268, 842270724, 844171268, 842336260, 844171268, 842401796, 844171268,
+    842467332, 844171268, 842532868, 844171268, 842598404, 844171268, 842663940, 844171268,
+    842729476, 844171268, 842795012, 844171268, 842860548, 844171268, 842926084, 844171268,
+    842991620, 844171268, 843057156, 844171268, 843122692, 844171268, 843188228, 844171268,
+    843253764, 844171268, 843319300, 844171268, 840370180, 844236804, 840435716, 844236804,
+    840501252, 844236804, 840566788, 844236804, 840632324, 844236804, 840697860, 844236804,
+    840763396, 844236804, 840828932, 844236804, 840894468, 844236804, 840960004, 844236804,
+    841025540, 844236804, 841091076, 844236804, 841156612, 844236804, 841222148, 844236804,
+    841287684, 844236804, 841353220, 844236804, 841418756, 844236804, 841484292, 844236804,
+    841549828, 844236804, 841615364, 844236804, 841680900, 844236804, 841746436, 844236804,
+    841811972, 844236804, 841877508, 844236804, 841943044, 844236804, 842008580, 844236804,
+    842074116, 844236804, 842139652, 844236804, 842205188, 844236804, 842270724, 844236804,
+    842336260, 844236804, 842401796, 844236804, 842467332, 844236804, 842532868, 844236804,
+    842598404, 844236804, 842663940, 844236804, 842729476, 844236804, 842795012, 844236804,
+    842860548, 844236804, 842926084, 844236804, 842991620, 844236804, 843057156, 844236804,
+    843122692, 844236804, 843188228, 844236804, 843253764, 844236804, 843319300, 844236804,
+    840370180, 844302340, 840435716, 844302340, 840501252, 844302340, 840566788, 844302340,
+    840632324, 844302340, 840697860, 844302340, 840763396, 844302340, 840828932, 844302340,
+    840894468, 844302340, 840960004, 844302340, 841025540, 844302340, 841091076, 844302340,
+    841156612, 844302340, 841222148, 844302340, 841287684, 844302340, 841353220, 844302340,
+    841418756, 844302340, 841484292, 844302340, 841549828, 844302340, 841615364, 844302340,
+    841680900, 844302340, 841746436, 844302340, 841811972, 844302340, 841877508, 844302340,
+    841943044, 844302340, 842008580, 844302340, 842074116, 844302340, 842139652, 844302340,
+    842205188, 844302340, 842270724, 844302340, 842336260, 844302340, 842401796, 844302340,
+    842467332, 844302340, 842532868, 844302340, 842598404, 844302340, 842663940, 844302340,
+    842729476, 844302340, 842795012, 844302340, 842860548, 844302340, 842926084, 844302340,
+    842991620, 844302340, 843057156, 844302340, 843122692, 844302340, 843188228, 844302340,
+    843253764, 844302340, 843319300, 844302340, 840370180, 844367876, 840435716, 844367876,
+    840501252, 844367876, 840566788, 844367876, 840632324, 844367876, 840697860, 844367876,
+    840763396, 844367876, 840828932, 844367876, 840894468, 844367876, 840960004, 844367876,
+    841025540, 844367876, 841091076, 844367876, 841156612, 844367876, 841222148, 844367876,
+    841287684, 844367876, 841353220, 844367876, 841418756, 844367876, 841484292, 844367876,
+    841549828, 844367876, 841615364, 844367876, 841680900, 844367876, 841746436, 844367876,
+    841811972, 844367876, 841877508, 844367876, 841943044, 844367876, 842008580, 844367876,
+    842074116, 844367876, 842139652, 844367876, 842205188, 844367876, 842270724, 844367876,
+    842336260, 844367876, 842401796, 844367876, 842467332, 844367876, 842532868, 844367876,
+    842598404, 844367876, 842663940, 844367876, 842729476, 844367876, 842795012, 844367876,
+    842860548, 844367876, 842926084, 844367876, 842991620, 844367876, 843057156, 844367876,
+    843122692, 844367876, 843188228, 844367876, 843253764, 844367876, 843319300, 844367876,
+    840370180, 844433412, 840435716, 844433412, 840501252, 844433412, 840566788, 844433412,
+    840632324, 844433412, 840697860, 844433412, 840763396, 844433412, 840828932, 844433412,
+    840894468, 844433412, 840960004, 844433412, 841025540, 844433412, 841091076, 844433412,
+    841156612, 844433412, 841222148, 844433412, 841287684, 844433412, 841353220, 844433412,
+    841418756, 844433412, 841484292, 844433412, 841549828, 844433412, 841615364, 844433412,
+    841680900, 844433412, 841746436, 844433412, 841811972, 844433412, 841877508, 844433412,
+    841943044, 844433412, 842008580, 844433412, 842074116, 844433412, 842139652, 844433412,
+    842205188, 844433412, 842270724, 844433412, 842336260, 844433412, 842401796, 844433412,
+    842467332, 844433412, 842532868, 844433412, 842598404, 844433412, 842663940, 844433412,
+    842729476, 844433412, 842795012, 844433412, 842860548, 844433412, 842926084, 844433412,
+    842991620, 844433412, 843057156, 844433412, 843122692, 844433412, 843188228, 844433412,
+    843253764, 844433412, 843319300, 844433412, 844564484, 848365572, 844630020, 848365572,
+    844695556, 848365572, 844761092, 848365572, 844826628, 848365572, 844892164, 848365572,
+    844957700, 848365572, 845023236, 848365572, 845088772, 848365572, 845154308, 848365572,
+    845219844, 848365572, 845285380, 848365572, 845350916, 848365572, 845416452, 848365572,
+    845481988, 848365572, 845547524, 848365572, 845613060, 848365572, 845678596, 848365572,
+    845744132, 848365572, 845809668, 848365572, 845875204, 848365572, 845940740, 848365572,
+    846006276, 848365572, 846071812, 848365572, 846137348, 848365572, 846202884, 848365572,
+    846268420, 848365572, 846333956, 848365572, 846399492, 848365572, 846465028, 848365572,
+    846530564, 848365572, 846596100, 848365572, 846661636, 848365572, 846727172, 848365572,
+    846792708, 848365572, 846858244, 848365572, 846923780, 848365572, 846989316, 848365572,
+    847054852, 848365572, 847120392, 846137352, 848365572, 847120392, 846661640, 848365572,
+    847120388, 848365572, 847185924, 848365572, 847251460, 848365572, 847316996, 848365572,
+    844564484, 848431108, 844630020, 848431108, 844695556, 848431108, 844761092, 848431108,
+    844826628, 848431108, 844892164, 848431108, 844957700, 848431108, 845023236, 848431108,
+    845088772, 848431108, 845154308, 848431108, 845219844, 848431108, 845285380, 848431108,
+    845350916, 848431108, 845416452, 848431108, 845481988, 848431108, 845547524, 848431108,
+    845613060, 848431108, 845678596, 848431108, 845744132, 848431108, 845809668, 848431108,
+    845875204, 848431108, 845940740, 848431108, 846006276, 848431108, 846071812, 848431108,
+    846137348, 848431108, 846202884, 848431108, 846268420, 848431108, 846333956, 848431108,
+    846399492, 848431108, 846465028, 848431108, 846530564, 848431108, 846596100, 848431108,
+    846661636, 848431108, 846727172, 848431108, 846792708, 848431108, 846858244, 848431108,
+    846923780, 848431108, 846989316, 848431108, 847054852, 848431108, 847120392, 846137352,
+    848431108, 847120392, 846661640, 848431108, 847120388, 848431108, 847185924, 848431108,
+    847251460, 848431108, 847316996, 848431108, 844564484, 848496644, 844630020, 848496644,
+    844695556, 848496644, 844761092, 848496644, 844826628, 848496644, 844892164, 848496644,
+    844957700, 848496644, 845023236, 848496644, 845088772, 848496644, 845154308, 848496644,
+    845219844, 848496644, 845285380, 848496644, 845350916, 848496644, 845416452, 848496644,
+    845481988, 848496644, 845547524, 848496644, 845613060, 848496644, 845678596, 848496644,
+    845744132, 848496644, 845809668, 848496644, 845875204, 848496644, 845940740, 848496644,
+    846006276, 848496644, 846071812, 848496644, 846137348, 848496644, 846202884, 848496644,
+    846268420, 848496644, 846333956, 848496644, 846399492, 848496644, 846465028, 848496644,
+    846530564, 848496644, 846596100, 848496644, 846661636, 848496644, 846727172, 848496644,
+    846792708, 848496644, 846858244, 848496644, 846923780, 848496644, 846989316, 848496644,
+    847054852, 848496644, 847120392, 846137352, 848496644, 847120392, 846661640, 848496644,
+    847120388, 848496644, 847185924, 848496644, 847251460, 848496644, 847316996, 848496644,
+    844564484, 848562180, 844630020, 848562180, 844695556, 848562180, 844761092, 848562180,
+    844826628, 848562180, 844892164, 848562180, 844957700, 848562180, 845023236, 848562180,
+    845088772, 848562180, 845154308, 848562180, 845219844, 848562180, 845285380, 848562180,
+    845350916, 848562180, 845416452, 848562180, 845481988, 848562180, 845547524, 848562180,
+    845613060, 848562180, 845678596, 848562180, 845744132, 848562180, 845809668, 848562180,
+    845875204, 848562180, 845940740, 848562180, 846006276, 848562180, 846071812, 848562180,
+    846137348, 848562180, 846202884, 848562180, 846268420, 848562180, 846333956, 848562180,
+    846399492, 848562180, 846465028, 848562180, 846530564, 848562180, 846596100, 848562180,
+    846661636, 848562180, 846727172, 848562180, 846792708, 848562180, 846858244, 848562180,
+    846923780, 848562180, 846989316, 848562180, 847054852, 848562180, 847120392, 846137352,
+    848562180, 847120392, 846661640, 848562180, 847120388, 848562180, 847185924, 848562180,
+    847251460, 848562180, 847316996, 848562180, 844564484, 848627716, 844630020, 848627716,
+    844695556, 848627716, 844761092, 848627716, 844826628, 848627716, 844892164, 848627716,
+    844957700, 848627716, 845023236, 848627716, 845088772, 848627716, 845154308, 848627716,
+    845219844, 848627716, 845285380, 848627716, 845350916, 848627716, 845416452, 848627716,
+    845481988, 848627716, 845547524, 848627716, 845613060, 848627716, 845678596, 848627716,
+    845744132, 848627716, 845809668, 848627716, 845875204, 848627716, 845940740, 848627716,
+    846006276, 848627716, 846071812, 848627716, 846137348, 848627716, 846202884, 848627716,
+    846268420, 848627716, 846333956, 848627716, 846399492, 848627716, 846465028, 848627716,
+    846530564, 848627716, 846596100, 848627716, 846661636, 848627716, 846727172, 848627716,
+    846792708, 848627716, 846858244, 848627716, 846923780, 848627716, 846989316, 848627716,
+    847054852, 848627716, 847120392, 846137352, 848627716, 847120392, 846661640, 848627716,
+    847120388, 848627716, 847185924, 848627716, 847251460, 848627716, 847316996, 848627716,
+    920520708, 923731972, 920586244, 923731972, 920651780, 923731972, 920717316, 923731972,
+    920782852, 923731972, 920848388, 923731972, 920913924, 923731972, 920979460, 923731972,
+    921044996, 923731972, 921110532, 923731972, 921176068, 923731972, 921241604, 923731972,
+    921307140, 923731972, 921372676, 923731972, 921438212, 923731972, 921503748, 923731972,
+    921569284, 923731972, 921634820, 923731972, 921700356, 923731972, 921765892, 923731972,
+    921831428, 923731972, 921896964, 923731972, 921962500, 923731972, 922028036, 923731972,
+    922093572, 923731972, 922159108, 923731972, 922224644, 923731972, 922290180, 923731972,
+    922355716, 923731972, 922421252, 923731972, 922486788, 923731972, 922552324, 923731972,
+    922617860, 923731972, 922683396, 923731972, 922748932, 923731972, 922814468, 923731972,
+    922880004, 923731972, 922945540, 923731972, 923011076, 923731972, 923076612, 923731972,
+    923142148, 923731972, 923207684, 923731972, 923273220, 923731972, 923338756, 923731972,
+    920520708, 923797508, 920586244, 923797508, 920651780, 923797508, 920717316, 923797508,
+    920782852, 923797508, 920848388, 923797508, 920913924, 923797508, 920979460, 923797508,
+    921044996, 923797508, 921110532, 923797508, 921176068, 923797508, 921241604, 923797508,
+    921307140, 923797508, 921372676, 923797508, 921438212, 923797508, 921503748, 923797508,
+    921569284, 923797508, 921634820, 923797508, 921700356, 923797508, 921765892, 923797508,
+    921831428, 923797508, 921896964, 923797508, 921962500, 923797508, 922028036, 923797508,
+    922093572, 923797508, 922159108, 923797508, 922224644, 923797508, 922290180, 923797508,
+    922355716, 923797508, 922421252, 923797508, 922486788, 923797508, 922552324, 923797508,
+    922617860, 923797508, 922683396, 923797508, 922748932, 923797508, 922814468, 923797508,
+    922880004, 923797508, 922945540, 923797508, 923011076, 923797508, 923076612, 923797508,
+    923142148, 923797508, 923207684, 923797508, 923273220, 923797508, 923338756, 923797508,
+    920520708, 923863044, 920586244, 923863044, 920651780, 923863044, 920717316, 923863044,
+    920782852, 923863044, 920848388, 923863044, 920913924, 923863044, 920979460, 923863044,
+    921044996, 923863044, 921110532, 923863044, 921176068, 923863044, 921241604, 923863044,
+    921307140, 923863044, 921372676, 923863044, 921438212, 923863044, 921503748, 923863044,
+    921569284, 923863044, 921634820, 923863044, 921700356, 923863044, 921765892, 923863044,
+    921831428, 923863044, 921896964, 923863044, 921962500, 923863044, 922028036, 923863044,
+    922093572, 923863044, 922159108, 923863044, 922224644, 923863044, 922290180, 923863044,
+    922355716, 923863044, 922421252, 923863044, 922486788, 923863044, 922552324, 923863044,
+    922617860, 923863044, 922683396, 923863044, 922748932, 923863044, 922814468, 923863044,
+    922880004, 923863044, 922945540, 923863044, 923011076, 923863044, 923076612, 923863044,
+    923142148, 923863044, 923207684, 923863044, 923273220, 923863044, 923338756, 923863044,
+    920520708, 924059652, 920586244, 924059652, 920651780, 924059652, 920717316, 924059652,
+    920782852, 924059652, 920848388, 924059652, 920913924, 924059652, 920979460, 924059652,
+    921044996, 924059652, 921110532, 924059652, 921176068, 924059652, 921241604, 924059652,
+    921307140, 924059652, 921372676, 924059652, 921438212, 924059652, 921503748, 924059652,
+    921569284, 924059652, 921634820, 924059652, 921700356, 924059652, 921765892, 924059652,
+    921831428, 924059652, 921896964, 924059652, 921962500, 924059652, 922028036, 924059652,
+    922093572, 924059652, 922159108, 924059652, 922224644, 924059652, 922290180, 924059652,
+    922355716, 924059652, 922421252, 924059652, 922486788, 924059652, 922552324, 924059652,
+    922617860, 924059652, 922683396, 924059652, 922748932, 924059652, 922814468, 924059652,
+    922880004, 924059652, 922945540, 924059652, 923011076, 924059652, 923076612, 924059652,
+    923142148, 924059652, 923207684, 924059652, 923273220, 924059652, 923338756, 924059652,
+    848693252, 852166660, 848758788, 852166660, 848824324, 852166660, 848889860, 852166660,
+    848955396, 852166660, 849020932, 852166660, 849086468, 852166660, 849152004, 852166660,
+    849217540, 852166660, 849283076, 852166660, 849348612, 852166660, 849414148, 852166660,
+    849479684, 852166660, 849545220, 852166660, 849610756, 852166660, 849676292, 852166660,
+    849741828, 852166660, 849807364, 852166660, 849872900, 852166660, 849938436, 852166660,
+    850003972, 852166660, 850069508, 852166660, 850135044, 852166660, 850200580, 852166660,
+    850266116, 852166660, 850331652, 852166660, 850397188, 852166660, 850462724, 852166660,
+    850528260, 852166660, 850593796, 852166660, 850659332, 852166660, 850724868, 852166660,
+    850790404, 852166660, 850855940, 852166660, 850921476, 852166660, 850987012, 852166660,
+    851052548, 852166660, 851118084, 852166660, 851183620, 852166660, 851249156, 852166660,
+    851314692, 852166660, 851380228, 852166660, 851445764, 852166660, 851511300, 852166660,
+    851576836, 852166660, 851642372, 852166660, 851707908, 852166660, 851773444, 852166660,
+    848693252, 852232196, 848758788, 852232196, 848824324, 852232196, 848889860, 852232196,
+    848955396, 852232196, 849020932, 852232196, 849086468, 852232196, 849152004, 852232196,
+    849217540, 852232196, 849283076, 852232196, 849348612, 852232196, 849414148, 852232196,
+    849479684, 852232196, 849545220, 852232196, 849610756, 852232196, 849676292, 852232196,
+    849741828, 852232196, 849807364, 852232196, 849872900, 852232196, 849938436, 852232196,
+    850003972, 852232196, 850069508, 852232196, 850135044, 852232196, 850200580, 852232196,
+    850266116, 852232196, 850331652, 852232196, 850397188, 852232196, 850462724, 852232196,
+    850528260, 852232196, 850593796, 852232196, 850659332, 852232196, 850724868, 852232196,
+    850790404, 852232196, 850855940, 852232196, 850921476, 852232196, 850987012, 852232196,
+    851052548, 852232196, 851118084, 852232196, 851183620, 852232196, 851249156, 852232196,
+    851314692, 852232196, 851380228, 852232196, 851445764, 852232196, 851511300, 852232196,
+    851576836, 852232196, 851642372, 852232196, 851707908, 852232196, 851773444, 852232196,
+    848693252, 852428804, 848758788, 852428804, 848824324, 852428804, 848889860, 852428804,
+    848955396, 852428804, 849020932, 852428804, 849086468, 852428804, 849152004, 852428804,
+    849217540, 852428804, 849283076, 852428804, 849348612, 852428804, 849414148, 852428804,
+    849479684, 852428804, 849545220, 852428804, 849610756, 852428804, 849676292, 852428804,
+    849741828, 852428804, 849807364, 852428804, 849872900, 852428804, 849938436, 852428804,
+    850003972, 852428804, 850069508, 852428804, 850135044, 852428804, 850200580, 852428804,
+    850266116, 852428804, 850331652, 852428804, 850397188, 852428804, 850462724, 852428804,
+    850528260, 852428804, 850593796, 852428804, 850659332, 852428804, 850724868, 852428804,
+    850790404, 852428804, 850855940, 852428804, 850921476, 852428804, 850987012, 852428804,
+    851052548, 852428804, 851118084, 852428804, 851183620, 852428804, 851249156, 852428804,
+    851314692, 852428804, 851380228, 852428804, 851445764, 852428804, 851511300, 852428804,
+    851576836, 852428804, 851642372, 852428804, 851707908, 852428804, 851773444, 852428804,
+    848693252, 852559876, 848758788, 852559876, 848824324, 852559876, 848889860, 852559876,
+    848955396, 852559876, 849020932, 852559876, 849086468, 852559876, 849152004, 852559876,
+    849217540, 852559876, 849283076, 852559876, 849348612, 852559876, 849414148, 852559876,
+    849479684, 852559876, 849545220, 852559876, 849610756, 852559876, 849676292, 852559876,
+    849741828, 852559876, 849807364, 852559876, 849872900, 852559876, 849938436, 852559876,
+    850003972, 852559876, 850069508, 852559876, 850135044, 852559876, 850200580, 852559876,
+    850266116, 852559876, 850331652, 852559876, 850397188, 852559876, 850462724, 852559876,
+    850528260, 852559876, 850593796, 852559876, 850659332, 852559876, 850724868, 852559876,
+    850790404, 852559876, 850855940, 852559876, 850921476, 852559876, 850987012, 852559876,
+    851052548, 852559876, 851118084, 852559876, 851183620, 852559876, 851249156, 852559876,
+    851314692, 852559876, 851380228, 852559876, 851445764, 852559876, 851511300, 852559876,
+    851576836, 852559876, 851642372, 852559876, 851707908, 852559876, 851773444, 852559876,
+    848693252, 852625412, 848758788, 852625412, 848824324, 852625412, 848889860, 852625412,
+    848955396, 852625412, 849020932, 852625412, 849086468, 852625412, 849152004, 852625412,
+    849217540, 852625412, 849283076, 852625412, 849348612, 852625412, 849414148, 852625412,
+    849479684, 852625412, 849545220, 852625412, 849610756, 852625412, 849676292, 852625412,
+    849741828, 852625412, 849807364, 852625412, 849872900, 852625412, 849938436, 852625412,
+    850003972, 852625412, 850069508, 852625412, 850135044, 852625412, 850200580, 852625412,
+    850266116, 852625412, 850331652, 852625412, 850397188, 852625412, 850462724, 852625412,
+    850528260, 852625412, 850593796, 852625412, 850659332, 852625412, 850724868, 852625412,
+    850790404, 852625412, 850855940, 852625412, 850921476, 852625412, 850987012, 852625412,
+    851052548, 852625412, 851118084, 852625412, 851183620, 852625412, 851249156, 852625412,
+    851314692, 852625412, 851380228, 852625412, 851445764, 852625412, 851511300, 852625412,
+    851576836, 852625412, 851642372, 852625412, 851707908, 852625412, 851773444, 852625412,
+};
+
+inline constexpr std::uint32_t collation_contractions[] = {
+    321537, 2, 1, 183, 323042, 1, 903, 323042,
+    321281, 2, 1, 183, 322978, 1, 903, 322978,
+    406689, 1, 1, 774, 407521, 406625, 1, 1,
+    774, 407489, 440289, 3, 1, 1619, 437249, 1,
+    1620, 437345, 1, 1621, 437665, 484225, 1, 1,
+    1620, 437569, 485793, 1, 1, 1620, 437857, 516545,
+    2, 1, 2494, 516609, 1, 2519, 516641, 523233,
+    3, 1, 2902, 523265, 1, 2878, 523297, 1,
+    2903, 523329, 523777, 1, 1, 3031, 523841, 524801,
+    2, 1, 3006, 524897, 1, 3031, 524961, 524833,
+    1, 1, 3006, 524929, 527137, 1, 1, 3158,
+    527201, 529249, 1, 1, 3285, 529281, 529505, 4,
+    2, 3266, 3285, 529633, 1, 3285, 529537, 1,
+    3286, 529569, 1, 3266, 529601, 529601, 1, 1,
+    3285, 529633, 532481, 2, 1, 3390, 532577, 1,
+    3415, 532641, 532513, 1, 1, 3390, 532609, 535009,
+    4, 2, 3535, 3530, 535137, 1, 3530, 535041,
+    1, 3535, 535105, 1, 3551, 535169, 535105, 1,
+    1, 3530, 535137, 582881, 46, 1, 3585, 1076226,
+    1, 3586, 1076290, 1, 3587, 1076354, 1, 3588,
+    1076418, 1, 3589, 1076482, 1, 3590, 1076546, 1,
+    3591, 1076610, 1, 3592, 1076674, 1, 3593, 1076738,
+    1, 3594, 1076802, 1, 3595, 1076866, 1, 3596,
+    1076930, 1, 3597, 1076994, 1, 3598, 1077058, 1,
+    3599, 1077122, 1, 3600, 1077186, 1, 3601, 1077250,
+    1, 3602, 1077314, 1, 3603, 1077378, 1, 3604,
+    1077442, 1, 3605, 1077506, 1, 3606, 1077570, 1,
+    3607, 1077634, 1, 3608, 1077698, 1, 3609, 1077762,
+    1, 3610, 1077826, 1, 3611, 1077890, 1, 3612,
+    1077954, 1, 3613, 1078018, 1, 3614, 1078082, 1,
+    3615, 1078146, 1, 3616, 1078210, 1, 3617, 1078274,
+    1, 3618, 1078338, 1, 3619, 1078402, 1, 3620,
+    1078466, 1, 3621, 1078530, 1, 3622, 1078594, 1,
+    3623, 1078658, 1, 3624, 1078722, 1, 3625, 1078786,
+    1, 3626, 1078850, 1, 3627, 1078914, 1, 3628,
+    1078978, 1, 3629, 1079042, 1, 3630, 1079106, 582913,
+    46, 1, 3585, 1079170, 1, 3586, 1079234, 1,
+    3587, 1079298, 1, 3588, 1079362, 1, 3589, 1079426,
+    1, 3590, 1079490, 1, 3591, 1079554, 1, 3592,
+    1079618, 1, 3593, 1079682, 1, 3594, 1079746, 1,
+    3595, 1079810, 1, 3596, 1079874, 1, 3597, 1079938,
+    1, 3598, 1080002, 1, 3599, 1080066, 1, 3600,
+    1080130, 1, 3601, 1080194, 1, 3602, 1080258, 1,
+    3603, 1080322, 1, 3604, 1080386, 1, 3605, 1080450,
+    1, 3606, 1080514, 1, 3607, 1080578, 1, 3608,
+    1080642, 1, 3609, 1080706, 1, 3610, 1080770, 1,
+    3611, 1080834, 1, 3612, 1080898, 1, 3613, 1080962,
+    1, 3614, 1081026, 1, 3615, 1081090, 1, 3616,
+    1081154, 1, 3617, 1081218, 1, 3618, 1081282, 1,
+    3619, 1081346, 1, 3620, 1081410, 1, 3621, 1081474,
+    1, 3622, 1081538, 1, 3623, 1081602, 1, 3624,
+    1081666, 1, 3625, 1081730, 1, 3626, 1081794, 1,
+    3627, 1081858, 1, 3628, 1081922, 1, 3629, 1081986,
+    1, 3630, 1082050, 582945, 46, 1, 3585, 1082114,
+    1, 3586, 1082178, 1, 3587, 1082242, 1, 3588,
+    1082306, 1, 3589, 1082370, 1, 3590, 1082434, 1,
+    3591, 1082498, 1, 3592, 1082562, 1, 3593, 1082626,
+    1, 3594, 1082690, 1, 3595, 1082754, 1, 3596,
+    1082818, 1, 3597, 1082882, 1, 3598, 1082946, 1,
+    3599, 1083010, 1, 3600, 1083074, 1, 3601, 1083138,
+    1, 3602, 1083202, 1, 3603, 1083266, 1, 3604,
+    1083330, 1, 3605, 1083394, 1, 3606, 1083458, 1,
+    3607, 1083522, 1, 3608, 1083586, 1, 3609, 1083650,
+    1, 3610, 1083714, 1, 3611, 1083778, 1, 3612,
+    1083842, 1, 3613, 1083906, 1, 3614, 1083970, 1,
+    3615, 1084034, 1, 3616, 1084098, 1, 3617, 1084162,
+    1, 3618, 1084226, 1, 3619, 1084290, 1, 3620,
+    1084354, 1, 3621, 1084418, 1, 3622, 1084482, 1,
+    3623, 1084546, 1, 3624, 1084610, 1, 3625, 1084674,
+    1, 3626, 1084738, 1, 3627, 1084802, 1, 3628,
+    1084866, 1, 3629, 1084930, 1, 3630, 1084994, 582977,
+    46, 1, 3585, 1085058, 1, 3586, 1085122, 1,
+    3587, 1085186, 1, 3588, 1085250, 1, 3589, 1085314,
+    1, 3590, 1085378, 1, 3591, 1085442, 1, 3592,
+    1085506, 1, 3593, 1085570, 1, 3594, 1085634, 1,
+    3595, 1085698, 1, 3596, 1085762, 1, 3597, 1085826,
+    1, 3598, 1085890, 1, 3599, 1085954, 1, 3600,
+    1086018, 1, 3601, 1086082, 1, 3602, 1086146, 1,
+    3603, 1086210, 1, 3604, 1086274, 1, 3605, 1086338,
+    1, 3606, 1086402, 1, 3607, 1086466, 1, 3608,
+    1086530, 1, 3609, 1086594, 1, 3610, 1086658, 1,
+    3611, 1086722, 1, 3612, 1086786, 1, 3613, 1086850,
+    1, 3614, 1086914, 1, 3615, 1086978, 1, 3616,
+    1087042, 1, 3617, 1087106, 1, 3618, 1087170, 1,
+    3619, 1087234, 1, 3620, 1087298, 1, 3621, 1087362,
+    1, 3622, 1087426, 1, 3623, 1087490, 1, 3624,
+    1087554, 1, 3625, 1087618, 1, 3626, 1087682, 1,
+    3627, 1087746, 1, 3628, 1087810, 1, 3629, 1087874,
+    1, 3630, 1087938, 583009, 46, 1, 3585, 1088002,
+    1, 3586, 1088066, 1, 3587, 1088130, 1, 3588,
+    1088194, 1, 3589, 1088258, 1, 3590, 1088322, 1,
+    3591, 1088386, 1, 3592, 1088450, 1, 3593, 1088514,
+    1, 3594, 1088578, 1, 3595, 1088642, 1, 3596,
+    1088706, 1, 3597, 1088770, 1, 3598, 1088834, 1,
+    3599, 1088898, 1, 3600, 1088962, 1, 3601, 1089026,
+    1, 3602, 1089090, 1, 3603, 1089154, 1, 3604,
+    1089218, 1, 3605, 1089282, 1, 3606, 1089346, 1,
+    3607, 1089410, 1, 3608, 1089474, 1, 3609, 1089538,
+    1, 3610, 1089602, 1, 3611, 1089666, 1, 3612,
+    1089730, 1, 3613, 1089794, 1, 3614, 1089858, 1,
+    3615, 1089922, 1, 3616, 1089986, 1, 3617, 1090050,
+    1, 3618, 1090114, 1, 3619, 1090178, 1, 3620,
+    1090242, 1, 3621, 1090306, 1, 3622, 1090370, 1,
+    3623, 1090434, 1, 3624, 1090498, 1, 3625, 1090562,
+    1, 3626, 1090626, 1, 3627, 1090690, 1, 3628,
+    1090754, 1, 3629, 1090818, 1, 3630, 1090882, 256641,
+    1, 1, 3634, 582625, 585057, 45, 1, 3806,
+    1090946, 1, 3713, 1091010, 1, 3714, 1091074, 1,
+    3716, 1091138, 1, 3718, 1091202, 1, 3719, 1091266,
+    1, 3720, 1091330, 1, 3721, 1091394, 1, 3754,
+    1091458, 1, 3722, 1091522, 1, 3724, 1091586, 1,
+    3726, 1091650, 1, 3807, 1091714, 1, 3725, 1091778,
+    1, 3727, 1091842, 1, 3728, 1091906, 1, 3729,
+    1091970, 1, 3730, 1092034, 1, 3731, 1092098, 1,
+    3732, 1092162, 1, 3733, 1092226, 1, 3734, 1092290,
+    1, 3735, 1092354, 1, 3736, 1092418, 1, 3737,
+    1092482, 1, 3738, 1092546, 1, 3739, 1092610, 1,
+    3740, 1092674, 1, 3741, 1092738, 1, 3742, 1092802,
+    1, 3743, 1092866, 1, 3744, 1092930, 1, 3745,
+    1092994, 1, 3746, 1093058, 1, 3747, 1093122, 1,
+    3749, 1093186, 1, 3751, 1093250, 1, 3752, 1093314,
+    1, 3753, 1093378, 1, 3804, 1093443, 1, 3805,
+    1093539, 1, 3755, 1093634, 1, 3756, 1093698, 1,
+    3757, 1093762, 1, 3758, 1093826, 585089, 45, 1,
+    3806, 1093890, 1, 3713, 1093954, 1, 3714, 1094018,
+    1, 3716, 1094082, 1, 3718, 1094146, 1, 3719,
+    1094210, 1, 3720, 1094274, 1, 3721, 1094338, 1,
+    3754, 1094402, 1, 3722, 1094466, 1, 3724, 1094530,
+    1, 3726, 1094594, 1, 3807, 1094658, 1, 3725,
+    1094722, 1, 3727, 1094786, 1, 3728, 1094850, 1,
+    3729, 1094914, 1, 3730, 1094978, 1, 3731, 1095042,
+    1, 3732, 1095106, 1, 3733, 1095170, 1, 3734,
+    1095234, 1, 3735, 1095298, 1, 3736, 1095362, 1,
+    3737, 1095426, 1, 3738, 1095490, 1, 3739, 1095554,
+    1, 3740, 1095618, 1, 3741, 1095682, 1, 3742,
+    1095746, 1, 3743, 1095810, 1, 3744, 1095874, 1,
+    3745, 1095938, 1, 3746, 1096002, 1, 3747, 1096066,
+    1, 3749, 1096130, 1, 3751, 1096194, 1, 3752,
+    1096258, 1, 3753, 1096322, 1, 3804, 1096387, 1,
+    3805, 1096483, 1, 3755, 1096578, 1, 3756, 1096642,
+    1, 3757, 1096706, 1, 3758, 1096770, 585121, 45,
+    1, 3806, 1096834, 1, 3713, 1096898, 1, 3714,
+    1096962, 1, 3716, 1097026, 1, 3718, 1097090, 1,
+    3719, 1097154, 1, 3720, 1097218, 1, 3721, 1097282,
+    1, 3754, 1097346, 1, 3722, 1097410, 1, 3724,
+    1097474, 1, 3726, 1097538, 1, 3807, 1097602, 1,
+    3725, 1097666, 1, 3727, 1097730, 1, 3728, 1097794,
+    1, 3729, 1097858, 1, 3730, 1097922, 1, 3731,
+    1097986, 1, 3732, 1098050, 1, 3733, 1098114, 1,
+    3734, 1098178, 1, 3735, 1098242, 1, 3736, 1098306,
+    1, 3737, 1098370, 1, 3738, 1098434, 1, 3739,
+    1098498, 1, 3740, 1098562, 1, 3741, 1098626, 1,
+    3742, 1098690, 1, 3743, 1098754, 1, 3744, 1098818,
+    1, 3745, 1098882, 1, 3746, 1098946, 1, 3747,
+    1099010, 1, 3749, 1099074, 1, 3751, 1099138, 1,
+    3752, 1099202, 1, 3753, 1099266, 1, 3804, 1099331,
+    1, 3805, 1099427, 1, 3755, 1099522, 1, 3756,
+    1099586, 1, 3757, 1099650, 1, 3758, 1099714, 585153,
+    45, 1, 3806, 1099778, 1, 3713, 1099842, 1,
+    3714, 1099906, 1, 3716, 1099970, 1, 3718, 1100034,
+    1, 3719, 1100098, 1, 3720, 1100162, 1, 3721,
+    1100226, 1, 3754, 1100290, 1, 3722, 1100354, 1,
+    3724, 1100418, 1, 3726, 1100482, 1, 3807, 1100546,
+    1, 3725, 1100610, 1, 3727, 1100674, 1, 3728,
+    1100738, 1, 3729, 1100802, 1, 3730, 1100866, 1,
+    3731, 1100930, 1, 3732, 1100994, 1, 3733, 1101058,
+    1, 3734, 1101122, 1, 3735, 1101186, 1, 3736,
+    1101250, 1, 3737, 1101314, 1, 3738, 1101378, 1,
+    3739, 1101442, 1, 3740, 1101506, 1, 3741, 1101570,
+    1, 3742, 1101634, 1, 3743, 1101698, 1, 3744,
+    1101762, 1, 3745, 1101826, 1, 3746, 1101890, 1,
+    3747, 1101954, 1, 3749, 1102018, 1, 3751, 1102082,
+    1, 3752, 1102146, 1, 3753, 1102210, 1, 3804,
+    1102275, 1, 3805, 1102371, 1, 3755, 1102466, 1,
+    3756, 1102530, 1, 3757, 1102594, 1, 3758, 1102658,
+    585185, 45, 1, 3806, 1102722, 1, 3713, 1102786,
+    1, 3714, 1102850, 1, 3716, 1102914, 1, 3718,
+    1102978, 1, 3719, 1103042, 1, 3720, 1103106, 1,
+    3721, 1103170, 1, 3754, 1103234, 1, 3722, 1103298,
+    1, 3724, 1103362, 1, 3726, 1103426, 1, 3807,
+    1103490, 1, 3725, 1103554, 1, 3727, 1103618, 1,
+    3728, 1103682, 1, 3729, 1103746, 1, 3730, 1103810,
+    1, 3731, 1103874, 1, 3732, 1103938, 1, 3733,
+    1104002, 1, 3734, 1104066, 1, 3735, 1104130, 1,
+    3736, 1104194, 1, 3737, 1104258, 1, 3738, 1104322,
+    1, 3739, 1104386, 1, 3740, 1104450, 1, 3741,
+    1104514, 1, 3742, 1104578, 1, 3743, 1104642, 1,
+    3744, 1104706, 1, 3745, 1104770, 1, 3746, 1104834,
+    1, 3747, 1104898, 1, 3749, 1104962, 1, 3751,
+    1105026, 1, 3752, 1105090, 1, 3753, 1105154, 1,
+    3804, 1105219, 1, 3805, 1105315, 1, 3755, 1105410,
+    1, 3756, 1105474, 1, 3757, 1105538, 1, 3758,
+    1105602, 256833, 1, 1, 3762, 584705, 591041, 3,
+    1, 3954, 591105, 1, 3968, 591169, 1, 3956,
+    591233, 590177, 3, 2, 3953, 3968, 591297, 1,
+    3968, 591265, 1, 3969, 591297, 590337, 3, 2,
+    3953, 3968, 591361, 1, 3968, 591329, 1, 3969,
+    591361, 614593, 1, 1, 4142, 614625, 624609, 44,
+    1, 6528, 1105666, 1, 6529, 1105730, 1, 6530,
+    1105794, 1, 6531, 1105858, 1, 6532, 1105922, 1,
+    6533, 1105986, 1, 6534, 1106050, 1, 6535, 1106114,
+    1, 6536, 1106178, 1, 6537, 1106242, 1, 6538,
+    1106306, 1, 6539, 1106370, 1, 6540, 1106434, 1,
+    6541, 1106498, 1, 6542, 1106562, 1, 6543, 1106626,
+    1, 6544, 1106690, 1, 6545, 1106754, 1, 6546,
+    1106818, 1, 6547, 1106882, 1, 6548, 1106946, 1,
+    6549, 1107010, 1, 6550, 1107074, 1, 6551, 1107138,
+    1, 6552, 1107202, 1, 6553, 1107266, 1, 6554,
+    1107330, 1, 6555, 1107394, 1, 6556, 1107458, 1,
+    6557, 1107522, 1, 6558, 1107586, 1, 6559, 1107650,
+    1, 6560, 1107714, 1, 6561, 1107778, 1, 6562,
+    1107842, 1, 6563, 1107906, 1, 6564, 1107970, 1,
+    6565, 1108034, 1, 6566, 1108098, 1, 6567, 1108162,
+    1, 6568, 1108226, 1, 6569, 1108290, 1, 6570,
+    1108354, 1, 6571, 1108418, 624641, 44, 1, 6528,
+    1108482, 1, 6529, 1108546, 1, 6530, 1108610, 1,
+    6531, 1108674, 1, 6532, 1108738, 1, 6533, 1108802,
+    1, 6534, 1108866, 1, 6535, 1108930, 1, 6536,
+    1108994, 1, 6537, 1109058, 1, 6538, 1109122, 1,
+    6539, 1109186, 1, 6540, 1109250, 1, 6541, 1109314,
+    1, 6542, 1109378, 1, 6543, 1109442, 1, 6544,
+    1109506, 1, 6545, 1109570, 1, 6546, 1109634, 1,
+    6547, 1109698, 1, 6548, 1109762, 1, 6549, 1109826,
+    1, 6550, 1109890, 1, 6551, 1109954, 1, 6552,
+    1110018, 1, 6553, 1110082, 1, 6554, 1110146, 1,
+    6555, 1110210, 1, 6556, 1110274, 1, 6557, 1110338,
+    1, 6558, 1110402, 1, 6559, 1110466, 1, 6560,
+    1110530, 1, 6561, 1110594, 1, 6562, 1110658, 1,
+    6563, 1110722, 1, 6564, 1110786, 1, 6565, 1110850,
+    1, 6566, 1110914, 1, 6567, 1110978, 1, 6568,
+    1111042, 1, 6569, 1111106, 1, 6570, 1111170, 1,
+    6571, 1111234, 624673, 44, 1, 6528, 1111298, 1,
+    6529, 1111362, 1, 6530, 1111426, 1, 6531, 1111490,
+    1, 6532, 1111554, 1, 6533, 1111618, 1, 6534,
+    1111682, 1, 6535, 1111746, 1, 6536, 1111810, 1,
+    6537, 1111874, 1, 6538, 1111938, 1, 6539, 1112002,
+    1, 6540, 1112066, 1, 6541, 1112130, 1, 6542,
+    1112194, 1, 6543, 1112258, 1, 6544, 1112322, 1,
+    6545, 1112386, 1, 6546, 1112450, 1, 6547, 1112514,
+    1, 6548, 1112578, 1, 6549, 1112642, 1, 6550,
+    1112706, 1, 6551, 1112770, 1, 6552, 1112834, 1,
+    6553, 1112898, 1, 6554, 1112962, 1, 6555, 1113026,
+    1, 6556, 1113090, 1, 6557, 1113154, 1, 6558,
+    1113218, 1, 6559, 1113282, 1, 6560, 1113346, 1,
+    6561, 1113410, 1, 6562, 1113474, 1, 6563, 1113538,
+    1, 6564, 1113602, 1, 6565, 1113666, 1, 6566,
+    1113730, 1, 6567, 1113794, 1, 6568, 1113858, 1,
+    6569, 1113922, 1, 6570, 1113986, 1, 6571, 1114050,
+    624769, 44, 1, 6528, 1114114, 1, 6529, 1114178,
+    1, 6530, 1114242, 1, 6531, 1114306, 1, 6532,
+    1114370, 1, 6533, 1114434, 1, 6534, 1114498, 1,
+    6535, 1114562, 1, 6536, 1114626, 1, 6537, 1114690,
+    1, 6538, 1114754, 1, 6539, 1114818, 1, 6540,
+    1114882, 1, 6541, 1114946, 1, 6542, 1115010, 1,
+    6543, 1115074, 1, 6544, 1115138, 1, 6545, 1115202,
+    1, 6546, 1115266, 1, 6547, 1115330, 1, 6548,
+    1115394, 1, 6549, 1115458, 1, 6550, 1115522, 1,
+    6551, 1115586, 1, 6552, 1115650, 1, 6553, 1115714,
+    1, 6554, 1115778, 1, 6555, 1115842, 1, 6556,
+    1115906, 1, 6557, 1115970, 1, 6558, 1116034, 1,
+    6559, 1116098, 1, 6560, 1116162, 1, 6561, 1116226,
+    1, 6562, 1116290, 1, 6563, 1116354, 1, 6564,
+    1116418, 1, 6565, 1116482, 1, 6566, 1116546, 1,
+    6567, 1116610, 1, 6568, 1116674, 1, 6569, 1116738,
+    1, 6570, 1116802, 1, 6571, 1116866, 630145, 1,
+    1, 6965, 630177, 630209, 1, 1, 6965, 630241,
+    630273, 1, 1, 6965, 630305, 630337, 1, 1,
+    6965, 630369, 630401, 1, 1, 6965, 630433, 630529,
+    1, 1, 6965, 630561, 632033, 1, 1, 6965,
+    632065, 632097, 1, 1, 6965, 632129, 632161, 1,
+    1, 6965, 632225, 632193, 1, 1, 6965, 632257,
+    632289, 1, 1, 6965, 632321, 586913, 48, 1,
+    43648, 1116930, 1, 43649, 1116994, 1, 43650, 1117058,
+    1, 43651, 1117122, 1, 43652, 1117186, 1, 43653,
+    1117250, 1, 43654, 1117314, 1, 43655, 1117378, 1,
+    43656, 1117442, 1, 43657, 1117506, 1, 43658, 1117570,
+    1, 43659, 1117634, 1, 43660, 1117698, 1, 43661,
+    1117762, 1, 43662, 1117826, 1, 43663, 1117890, 1,
+    43664, 1117954, 1, 43665, 1118018, 1, 43666, 1118082,
+    1, 43667, 1118146, 1, 43668, 1118210, 1, 43669,
+    1118274, 1, 43670, 1118338, 1, 43671, 1118402, 1,
+    43672, 1118466, 1, 43673, 1118530, 1, 43674, 1118594,
+    1, 43675, 1118658, 1, 43676, 1118722, 1, 43677,
+    1118786, 1, 43678, 1118850, 1, 43679, 1118914, 1,
+    43680, 1118978, 1, 43681, 1119042, 1, 43682, 1119106,
+    1, 43683, 1119170, 1, 43684, 1119234, 1, 43685,
+    1119298, 1, 43686, 1119362, 1, 43687, 1119426, 1,
+    43688, 1119490, 1, 43689, 1119554, 1, 43690, 1119618,
+    1, 43691, 1119682, 1, 43692, 1119746, 1, 43693,
+    1119810, 1, 43694, 1119874, 1, 43695, 1119938, 586945,
+    48, 1, 43648, 1120002, 1, 43649, 1120066, 1,
+    43650, 1120130, 1, 43651, 1120194, 1, 43652, 1120258,
+    1, 43653, 1120322, 1, 43654, 1120386, 1, 43655,
+    1120450, 1, 43656, 1120514, 1, 43657, 1120578, 1,
+    43658, 1120642, 1, 43659, 1120706, 1, 43660, 1120770,
+    1, 43661, 1120834, 1, 43662, 1120898, 1, 43663,
+    1120962, 1, 43664, 1121026, 1, 43665, 1121090, 1,
+    43666, 1121154, 1, 43667, 1121218, 1, 43668, 1121282,
+    1, 43669, 1121346, 1, 43670, 1121410, 1, 43671,
+    1121474, 1, 43672, 1121538, 1, 43673, 1121602, 1,
+    43674, 1121666, 1, 43675, 1121730, 1, 43676, 1121794,
+    1, 43677, 1121858, 1, 43678, 1121922, 1, 43679,
+    1121986, 1, 43680, 1122050, 1, 43681, 1122114, 1,
+    43682, 1122178, 1, 43683, 1122242, 1, 43684, 1122306,
+    1, 43685, 1122370, 1, 43686, 1122434, 1, 43687,
+    1122498, 1, 43688, 1122562, 1, 43689, 1122626, 1,
+    43690, 1122690, 1, 43691, 1122754, 1, 43692, 1122818,
+    1, 43693, 1122882, 1, 43694, 1122946, 1, 43695,
+    1123010, 587041, 48, 1, 43648, 1123074, 1, 43649,
+    1123138, 1, 43650, 1123202, 1, 43651, 1123266, 1,
+    43652, 1123330, 1, 43653, 1123394, 1, 43654, 1123458,
+    1, 43655, 1123522, 1, 43656, 1123586, 1, 43657,
+    1123650, 1, 43658, 1123714, 1, 43659, 1123778, 1,
+    43660, 1123842, 1, 43661, 1123906, 1, 43662, 1123970,
+    1, 43663, 1124034, 1, 43664, 1124098, 1, 43665,
+    1124162, 1, 43666, 1124226, 1, 43667, 1124290, 1,
+    43668, 1124354, 1, 43669, 1124418, 1, 43670, 1124482,
+    1, 43671, 1124546, 1, 43672, 1124610, 1, 43673,
+    1124674, 1, 43674, 1124738, 1, 43675, 1124802, 1,
+    43676, 1124866, 1, 43677, 1124930, 1, 43678, 1124994,
+    1, 43679, 1125058, 1, 43680, 1125122, 1, 43681,
+    1125186, 1, 43682, 1125250, 1, 43683, 1125314, 1,
+    43684, 1125378, 1, 43685, 1125442, 1, 43686, 1125506,
+    1, 43687, 1125570, 1, 43688, 1125634, 1, 43689,
+    1125698, 1, 43690, 1125762, 1, 43691, 1125826, 1,
+    43692, 1125890, 1, 43693, 1125954, 1, 43694, 1126018,
+    1, 43695, 1126082, 587105, 48, 1, 43648, 1126146,
+    1, 43649, 1126210, 1, 43650, 1126274, 1, 43651,
+    1126338, 1, 43652, 1126402, 1, 43653, 1126466, 1,
+    43654, 1126530, 1, 43655, 1126594, 1, 43656, 1126658,
+    1, 43657, 1126722, 1, 43658, 1126786, 1, 43659,
+    1126850, 1, 43660, 1126914, 1, 43661, 1126978, 1,
+    43662, 1127042, 1, 43663, 1127106, 1, 43664, 1127170,
+    1, 43665, 1127234, 1, 43666, 1127298, 1, 43667,
+    1127362, 1, 43668, 1127426, 1, 43669, 1127490, 1,
+    43670, 1127554, 1, 43671, 1127618, 1, 43672, 1127682,
+    1, 43673, 1127746, 1, 43674, 1127810, 1, 43675,
+    1127874, 1, 43676, 1127938, 1, 43677, 1128002, 1,
+    43678, 1128066, 1, 43679, 1128130, 1, 43680, 1128194,
+    1, 43681, 1128258, 1, 43682, 1128322, 1, 43683,
+    1128386, 1, 43684, 1128450, 1, 43685, 1128514, 1,
+    43686, 1128578, 1, 43687, 1128642, 1, 43688, 1128706,
+    1, 43689, 1128770, 1, 43690, 1128834, 1, 43691,
+    1128898, 1, 43692, 1128962, 1, 43693, 1129026, 1,
+    43694, 1129090, 1, 43695, 1129154, 587137, 48, 1,
+    43648, 1129218, 1, 43649, 1129282, 1, 43650, 1129346,
+    1, 43651, 1129410, 1, 43652, 1129474, 1, 43653,
+    1129538, 1, 43654, 1129602, 1, 43655, 1129666, 1,
+    43656, 1129730, 1, 43657, 1129794, 1, 43658, 1129858,
+    1, 43659, 1129922, 1, 43660, 1129986, 1, 43661,
+    1130050, 1, 43662, 1130114, 1, 43663, 1130178, 1,
+    43664, 1130242, 1, 43665, 1130306, 1, 43666, 1130370,
+    1, 43667, 1130434, 1, 43668, 1130498, 1, 43669,
+    1130562, 1, 43670, 1130626, 1, 43671, 1130690, 1,
+    43672, 1130754, 1, 43673, 1130818, 1, 43674, 1130882,
+    1, 43675, 1130946, 1, 43676, 1131010, 1, 43677,
+    1131074, 1, 43678, 1131138, 1, 43679, 1131202, 1,
+    43680, 1131266, 1, 43681, 1131330, 1, 43682, 1131394,
+    1, 43683, 1131458, 1, 43684, 1131522, 1, 43685,
+    1131586, 1, 43686, 1131650, 1, 43687, 1131714, 1,
+    43688, 1131778, 1, 43689, 1131842, 1, 43690, 1131906,
+    1, 43691, 1131970, 1, 43692, 1132034, 1, 43693,
+    1132098, 1, 43694, 1132162, 1, 43695, 1132226, 619329,
+    1, 1, 69927, 619233, 619361, 1, 1, 69927,
+    619265, 552513, 2, 1, 70462, 552577, 1, 70487,
+    552609, 557025, 3, 1, 70842, 557089, 1, 70832,
+    557121, 1, 70845, 557185, 559361, 1, 1, 71087,
+    559425, 559393, 1, 1, 71087, 559457, 564897, 1,
+    1, 71984, 564961,
+};
+
+inline constexpr std::uint32_t collation_contraction_members[] = {
+    183, 774, 903, 1619, 1620, 1621, 2494, 2519,
+    2878, 2902, 2903, 3006, 3031, 3158, 3266, 3285,
+    3286, 3390, 3415, 3530, 3535, 3551, 3585, 3586,
+    3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594,
+    3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602,
+    3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610,
+    3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618,
+    3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626,
+    3627, 3628, 3629, 3630, 3634, 3713, 3714, 3716,
+    3718, 3719, 3720, 3721, 3722, 3724, 3725, 3726,
+    3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734,
+    3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742,
+    3743, 3744, 3745, 3746, 3747, 3749, 3751, 3752,
+    3753, 3754, 3755, 3756, 3757, 3758, 3762, 3804,
+    3805, 3806, 3807, 3953, 3954, 3956, 3968, 3969,
+    4142, 6528, 6529, 6530, 6531, 6532, 6533, 6534,
+    6535, 6536, 6537, 6538, 6539, 6540, 6541, 6542,
+    6543, 6544, 6545, 6546, 6547, 6548, 6549, 6550,
+    6551, 6552, 6553, 6554, 6555, 6556, 6557, 6558,
+    6559, 6560, 6561, 6562, 6563, 6564, 6565, 6566,
+    6567, 6568, 6569, 6570, 6571, 6965, 43648, 43649,
+    43650, 43651, 43652, 43653, 43654, 43655, 43656, 43657,
+    43658, 43659, 43660, 43661, 43662, 43663, 43664, 43665,
+    43666, 43667, 43668, 43669, 43670, 43671, 43672, 43673,
+    43674, 43675, 43676, 43677, 43678, 43679, 43680, 43681,
+    43682, 43683, 43684, 43685, 43686, 43687, 43688, 43689,
+    43690, 43691, 43692, 43693, 43694, 43695, 69927, 70462,
+    70487, 70832, 70842, 70845, 71087, 71984,
+};
+
+inline constexpr std::uint32_t collation_implicit_firsts[] = {
+    13312, 19968, 64014, 64017, 64019, 64031, 64033, 64035,
+    64039, 94208, 101120, 101632, 110960, 131072, 173824, 177984,
+    178208, 183984, 196608,
+};
+
+inline constexpr std::uint32_t collation_implicit_lasts[] = {
+    19903, 40959, 64015, 64017, 64020, 64031, 64033, 64036,
+    64041, 101119, 101631, 101775, 111359, 173791, 177976, 178205,
+    183969, 191456, 201546,
+};
+
+inline constexpr std::uint32_t collation_implicit_bases[] = {
+    64384, 64320, 64320, 64320, 64320, 64320, 64320, 64320,
+    64320, 64256, 64258, 64256, 64257, 64384, 64384, 64384,
+    64384, 64384, 64384,
+};
+
+inline constexpr std::uint32_t collation_implicit_origins[] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 94208, 101120, 94208, 110960, 0, 0, 0,
+    0, 0, 0,
+};
+
+} /* namespace tables */
+
+} /* namespace utf8pp */
+
+#endif /* PETER_LENKEFI_UTF8PP_COLLATION_TABLES_HPP */
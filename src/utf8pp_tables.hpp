@@ -0,0 +1,6225 @@
+/**
+ * utf8pp_tables.hpp
+ *
+ * @description This file is generated by generate.py from the unicode character
+ * databases, do not edit it by hand.
+ * @license MIT
+ */
+
+#ifndef PETER_LENKEFI_UTF8PP_TABLES_HPP
+#define PETER_LENKEFI_UTF8PP_TABLES_HPP
+
+#include <cstdint>
+
+namespace utf8pp {
+namespace tables {
+
+inline constexpr std::uint32_t reverse_block_size = 64;
+
+/**
+ * Grapheme_Cluster_Break property values.
+ */
+enum class grapheme_break : std::uint8_t {
+    other,
+    cr,
+    lf,
+    control,
+    extend,
+    zwj,
+    regional_indicator,
+    prepend,
+    spacing_mark,
+    l,
+    v,
+    t,
+    lv,
+    lvt,
+    extended_pictographic,
+};
+
+inline constexpr std::uint32_t grapheme_break_starts[] = {
+    0, 10, 11, 13, 14, 32, 127, 160,
+    169, 170, 173, 174, 175, 768, 880, 1155,
+    1162, 1425, 1470, 1471, 1472, 1473, 1475, 1476,
+    1478, 1479, 1480, 1536, 1542, 1552, 1563, 1564,
+    1565, 1611, 1632, 1648, 1649, 1750, 1757, 1758,
+    1759, 1765, 1767, 1769, 1770, 1774, 1807, 1808,
+    1809, 1810, 1840, 1867, 1958, 1969, 2027, 2036,
+    2045, 2046, 2070, 2074, 2075, 2084, 2085, 2088,
+    2089, 2094, 2137, 2140, 2192, 2194, 2200, 2208,
+    2250, 2274, 2275, 2307, 2308, 2362, 2363, 2364,
+    2365, 2366, 2369, 2377, 2381, 2382, 2384, 2385,
+    2392, 2402, 2404, 2433, 2434, 2436, 2492, 2493,
+    2494, 2495, 2497, 2501, 2503, 2505, 2507, 2509,
+    2510, 2519, 2520, 2530, 2532, 2558, 2559, 2561,
+    2563, 2564, 2620, 2621, 2622, 2625, 2627, 2631,
+    2633, 2635, 2638, 2641, 2642, 2672, 2674, 2677,
+    2678, 2689, 2691, 2692, 2748, 2749, 2750, 2753,
+    2758, 2759, 2761, 2762, 2763, 2765, 2766, 2786,
+    2788, 2810, 2816, 2817, 2818, 2820, 2876, 2877,
+    2878, 2880, 2881, 2885, 2887, 2889, 2891, 2893,
+    2894, 2901, 2904, 2914, 2916, 2946, 2947, 3006,
+    3007, 3008, 3009, 3011, 3014, 3017, 3018, 3021,
+    3022, 3031, 3032, 3072, 3073, 3076, 3077, 3132,
+    3133, 3134, 3137, 3141, 3142, 3145, 3146, 3150,
+    3157, 3159, 3170, 3172, 3201, 3202, 3204, 3260,
+    3261, 3262, 3263, 3264, 3266, 3267, 3269, 3270,
+    3271, 3273, 3274, 3276, 3278, 3285, 3287, 3298,
+    3300, 3328, 3330, 3332, 3387, 3389, 3390, 3391,
+    3393, 3397, 3398, 3401, 3402, 3405, 3406, 3407,
+    3415, 3416, 3426, 3428, 3457, 3458, 3460, 3530,
+    3531, 3535, 3536, 3538, 3541, 3542, 3543, 3544,
+    3551, 3552, 3570, 3572, 3633, 3634, 3635, 3636,
+    3643, 3655, 3663, 3761, 3762, 3763, 3764, 3773,
+    3784, 3790, 3864, 3866, 3893, 3894, 3895, 3896,
+    3897, 3898, 3902, 3904, 3953, 3967, 3968, 3973,
+    3974, 3976, 3981, 3992, 3993, 4029, 4038, 4039,
+    4141, 4145, 4146, 4152, 4153, 4155, 4157, 4159,
+    4182, 4184, 4186, 4190, 4193, 4209, 4213, 4226,
+    4227, 4228, 4229, 4231, 4237, 4238, 4253, 4254,
+    4352, 4448, 4520, 4608, 4957, 4960, 5906, 5909,
+    5910, 5938, 5940, 5941, 5970, 5972, 6002, 6004,
+    6068, 6070, 6071, 6078, 6086, 6087, 6089, 6100,
+    6109, 6110, 6155, 6158, 6159, 6160, 6277, 6279,
+    6313, 6314, 6432, 6435, 6439, 6441, 6444, 6448,
+    6450, 6451, 6457, 6460, 6679, 6681, 6683, 6684,
+    6741, 6742, 6743, 6744, 6751, 6752, 6753, 6754,
+    6755, 6757, 6765, 6771, 6781, 6783, 6784, 6832,
+    6863, 6912, 6916, 6917, 6964, 6971, 6972, 6973,
+    6978, 6979, 6981, 7019, 7028, 7040, 7042, 7043,
+    7073, 7074, 7078, 7080, 7082, 7083, 7086, 7142,
+    7143, 7144, 7146, 7149, 7150, 7151, 7154, 7156,
+    7204, 7212, 7220, 7222, 7224, 7376, 7379, 7380,
+    7393, 7394, 7401, 7405, 7406, 7412, 7413, 7415,
+    7416, 7418, 7616, 7680, 8203, 8204, 8205, 8206,
+    8208, 8232, 8239, 8252, 8253, 8265, 8266, 8288,
+    8304, 8400, 8433, 8482, 8483, 8505, 8506, 8596,
+    8602, 8617, 8619, 8986, 8988, 9000, 9001, 9096,
+    9097, 9167, 9168, 9193, 9204, 9208, 9211, 9410,
+    9411, 9642, 9644, 9654, 9655, 9664, 9665, 9723,
+    9727, 9728, 9734, 9735, 9747, 9748, 9862, 9872,
+    9990, 9992, 10003, 10004, 10005, 10006, 10007, 10013,
+    10014, 10017, 10018, 10024, 10025, 10035, 10037, 10052,
+    10053, 10055, 10056, 10060, 10061, 10062, 10063, 10067,
+    10070, 10071, 10072, 10083, 10088, 10133, 10136, 10145,
+    10146, 10160, 10161, 10175, 10176, 10548, 10550, 11013,
+    11016, 11035, 11037, 11088, 11089, 11093, 11094, 11503,
+    11506, 11647, 11648, 11744, 11776, 12330, 12336, 12337,
+    12349, 12350, 12441, 12443, 12951, 12952, 12953, 12954,
+    42607, 42611, 42612, 42622, 42654, 42656, 42736, 42738,
+    43010, 43011, 43014, 43015, 43019, 43020, 43043, 43045,
+    43047, 43048, 43052, 43053, 43136, 43138, 43188, 43204,
+    43206, 43232, 43250, 43263, 43264, 43302, 43310, 43335,
+    43346, 43348, 43360, 43389, 43392, 43395, 43396, 43443,
+    43444, 43446, 43450, 43452, 43454, 43457, 43493, 43494,
+    43561, 43567, 43569, 43571, 43573, 43575, 43587, 43588,
+    43596, 43597, 43598, 43644, 43645, 43696, 43697, 43698,
+    43701, 43703, 43705, 43710, 43712, 43713, 43714, 43755,
+    43756, 43758, 43760, 43765, 43766, 43767, 44003, 44005,
+    44006, 44008, 44009, 44011, 44012, 44013, 44014, 44032,
+    44033, 44060, 44061, 44088, 44089, 44116, 44117, 44144,
+    44145, 44172, 44173, 44200, 44201, 44228, 44229, 44256,
+    44257, 44284, 44285, 44312, 44313, 44340, 44341, 44368,
+    44369, 44396, 44397, 44424, 44425, 44452, 44453, 44480,
+    44481, 44508, 44509, 44536, 44537, 44564, 44565, 44592,
+    44593, 44620, 44621, 44648, 44649, 44676, 44677, 44704,
+    44705, 44732, 44733, 44760, 44761, 44788, 44789, 44816,
+    44817, 44844, 44845, 44872, 44873, 44900, 44901, 44928,
+    44929, 44956, 44957, 44984, 44985, 45012, 45013, 45040,
+    45041, 45068, 45069, 45096, 45097, 45124, 45125, 45152,
+    45153, 45180, 45181, 45208, 45209, 45236, 45237, 45264,
+    45265, 45292, 45293, 45320, 45321, 45348, 45349, 45376,
+    45377, 45404, 45405, 45432, 45433, 45460, 45461, 45488,
+    45489, 45516, 45517, 45544, 45545, 45572, 45573, 45600,
+    45601, 45628, 45629, 45656, 45657, 45684, 45685, 45712,
+    45713, 45740, 45741, 45768, 45769, 45796, 45797, 45824,
+    45825, 45852, 45853, 45880, 45881, 45908, 45909, 45936,
+    45937, 45964, 45965, 45992, 45993, 46020, 46021, 46048,
+    46049, 46076, 46077, 46104, 46105, 46132, 46133, 46160,
+    46161, 46188, 46189, 46216, 46217, 46244, 46245, 46272,
+    46273, 46300, 46301, 46328, 46329, 46356, 46357, 46384,
+    46385, 46412, 46413, 46440, 46441, 46468, 46469, 46496,
+    46497, 46524, 46525, 46552, 46553, 46580, 46581, 46608,
+    46609, 46636, 46637, 46664, 46665, 46692, 46693, 46720,
+    46721, 46748, 46749, 46776, 46777, 46804, 46805, 46832,
+    46833, 46860, 46861, 46888, 46889, 46916, 46917, 46944,
+    46945, 46972, 46973, 47000, 47001, 47028, 47029, 47056,
+    47057, 47084, 47085, 47112, 47113, 47140, 47141, 47168,
+    47169, 47196, 47197, 47224, 47225, 47252, 47253, 47280,
+    47281, 47308, 47309, 47336, 47337, 47364, 47365, 47392,
+    47393, 47420, 47421, 47448, 47449, 47476, 47477, 47504,
+    47505, 47532, 47533, 47560, 47561, 47588, 47589, 47616,
+    47617, 47644, 47645, 47672, 47673, 47700, 47701, 47728,
+    47729, 47756, 47757, 47784, 47785, 47812, 47813, 47840,
+    47841, 47868, 47869, 47896, 47897, 47924, 47925, 47952,
+    47953, 47980, 47981, 48008, 48009, 48036, 48037, 48064,
+    48065, 48092, 48093, 48120, 48121, 48148, 48149, 48176,
+    48177, 48204, 48205, 48232, 48233, 48260, 48261, 48288,
+    48289, 48316, 48317, 48344, 48345, 48372, 48373, 48400,
+    48401, 48428, 48429, 48456, 48457, 48484, 48485, 48512,
+    48513, 48540, 48541, 48568, 48569, 48596, 48597, 48624,
+    48625, 48652, 48653, 48680, 48681, 48708, 48709, 48736,
+    48737, 48764, 48765, 48792, 48793, 48820, 48821, 48848,
+    48849, 48876, 48877, 48904, 48905, 48932, 48933, 48960,
+    48961, 48988, 48989, 49016, 49017, 49044, 49045, 49072,
+    49073, 49100, 49101, 49128, 49129, 49156, 49157, 49184,
+    49185, 49212, 49213, 49240, 49241, 49268, 49269, 49296,
+    49297, 49324, 49325, 49352, 49353, 49380, 49381, 49408,
+    49409, 49436, 49437, 49464, 49465, 49492, 49493, 49520,
+    49521, 49548, 49549, 49576, 49577, 49604, 49605, 49632,
+    49633, 49660, 49661, 49688, 49689, 49716, 49717, 49744,
+    49745, 49772, 49773, 49800, 49801, 49828, 49829, 49856,
+    49857, 49884, 49885, 49912, 49913, 49940, 49941, 49968,
+    49969, 49996, 49997, 50024, 50025, 50052, 50053, 50080,
+    50081, 50108, 50109, 50136, 50137, 50164, 50165, 50192,
+    50193, 50220, 50221, 50248, 50249, 50276, 50277, 50304,
+    50305, 50332, 50333, 50360, 50361, 50388, 50389, 50416,
+    50417, 50444, 50445, 50472, 50473, 50500, 50501, 50528,
+    50529, 50556, 50557, 50584, 50585, 50612, 50613, 50640,
+    50641, 50668, 50669, 50696, 50697, 50724, 50725, 50752,
+    50753, 50780, 50781, 50808, 50809, 50836, 50837, 50864,
+    50865, 50892, 50893, 50920, 50921, 50948, 50949, 50976,
+    50977, 51004, 51005, 51032, 51033, 51060, 51061, 51088,
+    51089, 51116, 51117, 51144, 51145, 51172, 51173, 51200,
+    51201, 51228, 51229, 51256, 51257, 51284, 51285, 51312,
+    51313, 51340, 51341, 51368, 51369, 51396, 51397, 51424,
+    51425, 51452, 51453, 51480, 51481, 51508, 51509, 51536,
+    51537, 51564, 51565, 51592, 51593, 51620, 51621, 51648,
+    51649, 51676, 51677, 51704, 51705, 51732, 51733, 51760,
+    51761, 51788, 51789, 51816, 51817, 51844, 51845, 51872,
+    51873, 51900, 51901, 51928, 51929, 51956, 51957, 51984,
+    51985, 52012, 52013, 52040, 52041, 52068, 52069, 52096,
+    52097, 52124, 52125, 52152, 52153, 52180, 52181, 52208,
+    52209, 52236, 52237, 52264, 52265, 52292, 52293, 52320,
+    52321, 52348, 52349, 52376, 52377, 52404, 52405, 52432,
+    52433, 52460, 52461, 52488, 52489, 52516, 52517, 52544,
+    52545, 52572, 52573, 52600, 52601, 52628, 52629, 52656,
+    52657, 52684, 52685, 52712, 52713, 52740, 52741, 52768,
+    52769, 52796, 52797, 52824, 52825, 52852, 52853, 52880,
+    52881, 52908, 52909, 52936, 52937, 52964, 52965, 52992,
+    52993, 53020, 53021, 53048, 53049, 53076, 53077, 53104,
+    53105, 53132, 53133, 53160, 53161, 53188, 53189, 53216,
+    53217, 53244, 53245, 53272, 53273, 53300, 53301, 53328,
+    53329, 53356, 53357, 53384, 53385, 53412, 53413, 53440,
+    53441, 53468, 53469, 53496, 53497, 53524, 53525, 53552,
+    53553, 53580, 53581, 53608, 53609, 53636, 53637, 53664,
+    53665, 53692, 53693, 53720, 53721, 53748, 53749, 53776,
+    53777, 53804, 53805, 53832, 53833, 53860, 53861, 53888,
+    53889, 53916, 53917, 53944, 53945, 53972, 53973, 54000,
+    54001, 54028, 54029, 54056, 54057, 54084, 54085, 54112,
+    54113, 54140, 54141, 54168, 54169, 54196, 54197, 54224,
+    54225, 54252, 54253, 54280, 54281, 54308, 54309, 54336,
+    54337, 54364, 54365, 54392, 54393, 54420, 54421, 54448,
+    54449, 54476, 54477, 54504, 54505, 54532, 54533, 54560,
+    54561, 54588, 54589, 54616, 54617, 54644, 54645, 54672,
+    54673, 54700, 54701, 54728, 54729, 54756, 54757, 54784,
+    54785, 54812, 54813, 54840, 54841, 54868, 54869, 54896,
+    54897, 54924, 54925, 54952, 54953, 54980, 54981, 55008,
+    55009, 55036, 55037, 55064, 55065, 55092, 55093, 55120,
+    55121, 55148, 55149, 55176, 55177, 55204, 55216, 55239,
+    55243, 55292, 64286, 64287, 65024, 65040, 65056, 65072,
+    65279, 65280, 65438, 65440, 65520, 65532, 66045, 66046,
+    66272, 66273, 66422, 66427, 68097, 68100, 68101, 68103,
+    68108, 68112, 68152, 68155, 68159, 68160, 68325, 68327,
+    68900, 68904, 69291, 69293, 69446, 69457, 69506, 69510,
+    69632, 69633, 69634, 69635, 69688, 69703, 69744, 69745,
+    69747, 69749, 69759, 69762, 69763, 69808, 69811, 69815,
+    69817, 69819, 69821, 69822, 69826, 69827, 69837, 69838,
+    69888, 69891, 69927, 69932, 69933, 69941, 69957, 69959,
+    70003, 70004, 70016, 70018, 70019, 70067, 70070, 70079,
+    70081, 70082, 70084, 70089, 70093, 70094, 70095, 70096,
+    70188, 70191, 70194, 70196, 70197, 70198, 70200, 70206,
+    70207, 70367, 70368, 70371, 70379, 70400, 70402, 70404,
+    70459, 70461, 70462, 70463, 70464, 70465, 70469, 70471,
+    70473, 70475, 70478, 70487, 70488, 70498, 70500, 70502,
+    70509, 70512, 70517, 70709, 70712, 70720, 70722, 70725,
+    70726, 70727, 70750, 70751, 70832, 70833, 70835, 70841,
+    70842, 70843, 70845, 70846, 70847, 70849, 70850, 70852,
+    71087, 71088, 71090, 71094, 71096, 71100, 71102, 71103,
+    71105, 71132, 71134, 71216, 71219, 71227, 71229, 71230,
+    71231, 71233, 71339, 71340, 71341, 71342, 71344, 71350,
+    71351, 71352, 71453, 71456, 71458, 71462, 71463, 71468,
+    71724, 71727, 71736, 71737, 71739, 71984, 71985, 71990,
+    71991, 71993, 71995, 71997, 71998, 71999, 72000, 72001,
+    72002, 72003, 72004, 72145, 72148, 72152, 72154, 72156,
+    72160, 72161, 72164, 72165, 72193, 72203, 72243, 72249,
+    72250, 72251, 72255, 72263, 72264, 72273, 72279, 72281,
+    72284, 72324, 72330, 72343, 72344, 72346, 72751, 72752,
+    72759, 72760, 72766, 72767, 72768, 72850, 72872, 72873,
+    72874, 72881, 72882, 72884, 72885, 72887, 73009, 73015,
+    73018, 73019, 73020, 73022, 73023, 73030, 73031, 73032,
+    73098, 73103, 73104, 73106, 73107, 73109, 73110, 73111,
+    73112, 73459, 73461, 73463, 78896, 78905, 92912, 92917,
+    92976, 92983, 94031, 94032, 94033, 94088, 94095, 94099,
+    94180, 94181, 94192, 94194, 113821, 113823, 113824, 113828,
+    118528, 118574, 118576, 118599, 119141, 119142, 119143, 119146,
+    119149, 119150, 119155, 119163, 119171, 119173, 119180, 119210,
+    119214, 119362, 119365, 121344, 121399, 121403, 121453, 121461,
+    121462, 121476, 121477, 121499, 121504, 121505, 121520, 122880,
+    122887, 122888, 122905, 122907, 122914, 122915, 122917, 122918,
+    122923, 123184, 123191, 123566, 123567, 123628, 123632, 125136,
+    125143, 125252, 125259, 126976, 127232, 127245, 127248, 127279,
+    127280, 127340, 127346, 127358, 127360, 127374, 127375, 127377,
+    127387, 127405, 127462, 127488, 127489, 127504, 127514, 127515,
+    127535, 127536, 127538, 127547, 127548, 127552, 127561, 127995,
+    128000, 128318, 128326, 128592, 128640, 128768, 128884, 128896,
+    128981, 129024, 129036, 129040, 129096, 129104, 129114, 129120,
+    129160, 129168, 129198, 129280, 129292, 129339, 129340, 129350,
+    129351, 129792, 130048, 131070, 917504, 917536, 917632, 917760,
+    918000, 921600,
+};
+
+inline constexpr std::uint8_t grapheme_break_values[] = {
+    3, 2, 3, 1, 3, 0, 3, 0, 14, 0, 3, 14, 0, 4, 0, 4,
+    0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 7, 0, 4, 0, 3,
+    0, 4, 0, 4, 0, 4, 7, 0, 4, 0, 4, 0, 4, 0, 7, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 7, 0, 4, 0, 4, 7, 4, 8, 0, 4, 8, 4,
+    0, 8, 4, 8, 4, 8, 0, 4, 0, 4, 0, 4, 8, 0, 4, 0,
+    4, 8, 4, 0, 8, 0, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+    8, 0, 4, 0, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+    0, 4, 8, 0, 4, 0, 8, 4, 0, 4, 8, 0, 8, 4, 0, 4,
+    0, 4, 0, 4, 8, 0, 4, 0, 4, 8, 4, 0, 8, 0, 8, 4,
+    0, 4, 0, 4, 0, 4, 0, 4, 8, 4, 8, 0, 8, 0, 8, 4,
+    0, 4, 0, 4, 8, 4, 0, 4, 0, 4, 8, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 8, 0, 4, 0, 8, 4, 8, 4, 8, 0, 4,
+    8, 0, 8, 4, 0, 4, 0, 4, 0, 4, 8, 0, 4, 0, 4, 8,
+    4, 0, 8, 0, 8, 4, 7, 0, 4, 0, 4, 0, 4, 8, 0, 4,
+    0, 4, 8, 4, 0, 4, 0, 8, 4, 0, 8, 0, 4, 0, 8, 4,
+    0, 4, 0, 4, 0, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 8, 0, 4, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 8, 4, 0, 4, 8, 4, 0, 8, 4, 0, 4, 0, 4, 0, 4,
+    0, 8, 4, 0, 4, 0, 4, 0, 9, 10, 11, 0, 4, 0, 4, 8,
+    0, 4, 8, 0, 4, 0, 4, 0, 4, 8, 4, 8, 4, 8, 4, 0,
+    4, 0, 4, 3, 4, 0, 4, 0, 4, 0, 4, 8, 4, 8, 0, 8,
+    4, 8, 4, 0, 4, 8, 4, 0, 8, 4, 8, 4, 0, 4, 0, 4,
+    0, 4, 8, 4, 0, 4, 0, 4, 0, 4, 8, 0, 4, 8, 4, 8,
+    4, 8, 0, 4, 0, 4, 8, 0, 8, 4, 8, 4, 8, 4, 0, 4,
+    8, 4, 8, 4, 8, 4, 8, 0, 8, 4, 8, 4, 0, 4, 0, 4,
+    8, 4, 0, 4, 0, 4, 0, 8, 4, 0, 4, 0, 3, 4, 5, 3,
+    0, 3, 0, 14, 0, 14, 0, 3, 0, 4, 0, 14, 0, 14, 0, 14,
+    0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+    0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+    0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+    0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+    0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 4,
+    0, 4, 0, 4, 0, 4, 14, 0, 14, 0, 4, 0, 14, 0, 14, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 8, 4,
+    8, 0, 4, 0, 8, 0, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+    8, 0, 9, 0, 4, 8, 0, 4, 8, 4, 8, 4, 8, 0, 4, 0,
+    4, 8, 4, 8, 4, 0, 4, 0, 4, 8, 0, 4, 0, 4, 0, 4,
+    0, 4, 0, 4, 0, 4, 0, 8, 4, 8, 0, 8, 4, 0, 8, 4,
+    8, 4, 8, 0, 8, 4, 0, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 0, 10, 0, 11, 0, 4, 0, 4, 0, 4, 0,
+    3, 0, 4, 0, 3, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    8, 4, 8, 0, 4, 0, 4, 0, 4, 0, 4, 8, 0, 8, 4, 8,
+    4, 0, 7, 0, 4, 0, 7, 0, 4, 0, 4, 8, 4, 0, 8, 0,
+    4, 0, 4, 8, 0, 8, 4, 8, 0, 7, 0, 4, 0, 8, 4, 0,
+    8, 4, 8, 4, 8, 4, 0, 4, 0, 4, 8, 4, 0, 4, 8, 0,
+    4, 0, 4, 8, 4, 8, 0, 8, 0, 8, 0, 4, 0, 8, 0, 4,
+    0, 4, 0, 8, 4, 8, 4, 8, 4, 0, 4, 0, 4, 8, 4, 8,
+    4, 8, 4, 8, 4, 8, 4, 0, 4, 8, 4, 0, 8, 4, 8, 4,
+    0, 4, 0, 8, 4, 8, 4, 8, 4, 0, 4, 8, 4, 8, 4, 8,
+    4, 0, 4, 0, 4, 8, 4, 0, 8, 4, 8, 4, 0, 4, 8, 0,
+    8, 0, 4, 8, 4, 7, 8, 7, 8, 4, 0, 8, 4, 0, 4, 8,
+    4, 0, 8, 0, 4, 0, 4, 8, 7, 4, 0, 4, 0, 4, 8, 4,
+    0, 7, 4, 8, 4, 0, 8, 4, 0, 4, 8, 4, 0, 4, 0, 8,
+    4, 8, 4, 8, 4, 0, 4, 0, 4, 0, 4, 0, 4, 7, 4, 0,
+    8, 0, 4, 0, 8, 4, 8, 4, 0, 4, 8, 0, 3, 0, 4, 0,
+    4, 0, 4, 0, 8, 0, 4, 0, 4, 0, 8, 0, 4, 0, 3, 0,
+    4, 0, 4, 0, 4, 8, 4, 0, 8, 4, 3, 4, 0, 4, 0, 4,
+    0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+    0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+    0, 4, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14,
+    0, 14, 6, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 4,
+    14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0,
+    14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 3, 4, 3, 4,
+    3, 0,
+};
+
+/**
+ * General_Category property values.
+ */
+enum class general_category : std::uint8_t {
+    unassigned,
+    uppercase_letter,
+    lowercase_letter,
+    titlecase_letter,
+    modifier_letter,
+    other_letter,
+    nonspacing_mark,
+    spacing_mark,
+    enclosing_mark,
+    decimal_number,
+    letter_number,
+    other_number,
+    connector_punctuation,
+    dash_punctuation,
+    open_punctuation,
+    close_punctuation,
+    initial_punctuation,
+    final_punctuation,
+    other_punctuation,
+    math_symbol,
+    currency_symbol,
+    modifier_symbol,
+    other_symbol,
+    space_separator,
+    line_separator,
+    paragraph_separator,
+    control,
+    format,
+    surrogate,
+    private_use,
+};
+
+inline constexpr std::uint32_t general_category_starts[] = {
+    0, 32, 33, 36, 37, 40, 41, 42,
+    43, 44, 45, 46, 48, 58, 60, 63,
+    65, 91, 92, 93, 94, 95, 96, 97,
+    123, 124, 125, 126, 127, 160, 161, 162,
+    166, 167, 168, 169, 170, 171, 172, 173,
+    174, 175, 176, 177, 178, 180, 181, 182,
+    184, 185, 186, 187, 188, 191, 192, 215,
+    216, 223, 247, 248, 256, 257, 258, 259,
+    260, 261, 262, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 275,
+    276, 277, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 290, 291,
+    292, 293, 294, 295, 296, 297, 298, 299,
+    300, 301, 302, 303, 304, 305, 306, 307,
+    308, 309, 310, 311, 313, 314, 315, 316,
+    317, 318, 319, 320, 321, 322, 323, 324,
+    325, 326, 327, 328, 330, 331, 332, 333,
+    334, 335, 336, 337, 338, 339, 340, 341,
+    342, 343, 344, 345, 346, 347, 348, 349,
+    350, 351, 352, 353, 354, 355, 356, 357,
+    358, 359, 360, 361, 362, 363, 364, 365,
+    366, 367, 368, 369, 370, 371, 372, 373,
+    374, 375, 376, 378, 379, 380, 381, 382,
+    385, 387, 388, 389, 390, 392, 393, 396,
+    398, 402, 403, 405, 406, 409, 412, 414,
+    415, 417, 418, 419, 420, 421, 422, 424,
+    425, 426, 428, 429, 430, 432, 433, 436,
+    437, 438, 439, 441, 443, 444, 445, 448,
+    452, 453, 454, 455, 456, 457, 458, 459,
+    460, 461, 462, 463, 464, 465, 466, 467,
+    468, 469, 470, 471, 472, 473, 474, 475,
+    476, 478, 479, 480, 481, 482, 483, 484,
+    485, 486, 487, 488, 489, 490, 491, 492,
+    493, 494, 495, 497, 498, 499, 500, 501,
+    502, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 518, 519,
+    520, 521, 522, 523, 524, 525, 526, 527,
+    528, 529, 530, 531, 532, 533, 534, 535,
+    536, 537, 538, 539, 540, 541, 542, 543,
+    544, 545, 546, 547, 548, 549, 550, 551,
+    552, 553, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 570, 572, 573, 575,
+    577, 578, 579, 583, 584, 585, 586, 587,
+    588, 589, 590, 591, 660, 661, 688, 706,
+    710, 722, 736, 741, 748, 749, 750, 751,
+    768, 880, 881, 882, 883, 884, 885, 886,
+    887, 888, 890, 891, 894, 895, 896, 900,
+    902, 903, 904, 907, 908, 909, 910, 912,
+    913, 930, 931, 940, 975, 976, 978, 981,
+    984, 985, 986, 987, 988, 989, 990, 991,
+    992, 993, 994, 995, 996, 997, 998, 999,
+    1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+    1012, 1013, 1014, 1015, 1016, 1017, 1019, 1021,
+    1072, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
+    1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
+    1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
+    1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150,
+    1151, 1152, 1153, 1154, 1155, 1160, 1162, 1163,
+    1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171,
+    1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179,
+    1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187,
+    1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+    1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
+    1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211,
+    1212, 1213, 1214, 1215, 1216, 1218, 1219, 1220,
+    1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
+    1229, 1230, 1232, 1233, 1234, 1235, 1236, 1237,
+    1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
+    1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
+    1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261,
+    1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269,
+    1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+    1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285,
+    1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293,
+    1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301,
+    1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+    1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
+    1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+    1326, 1327, 1328, 1329, 1367, 1369, 1370, 1376,
+    1417, 1418, 1419, 1421, 1423, 1424, 1425, 1470,
+    1471, 1472, 1473, 1475, 1476, 1478, 1479, 1480,
+    1488, 1515, 1519, 1523, 1525, 1536, 1542, 1545,
+    1547, 1548, 1550, 1552, 1563, 1564, 1565, 1568,
+    1600, 1601, 1611, 1632, 1642, 1646, 1648, 1649,
+    1748, 1749, 1750, 1757, 1758, 1759, 1765, 1767,
+    1769, 1770, 1774, 1776, 1786, 1789, 1791, 1792,
+    1806, 1807, 1808, 1809, 1810, 1840, 1867, 1869,
+    1958, 1969, 1970, 1984, 1994, 2027, 2036, 2038,
+    2039, 2042, 2043, 2045, 2046, 2048, 2070, 2074,
+    2075, 2084, 2085, 2088, 2089, 2094, 2096, 2111,
+    2112, 2137, 2140, 2142, 2143, 2144, 2155, 2160,
+    2184, 2185, 2191, 2192, 2194, 2200, 2208, 2249,
+    2250, 2274, 2275, 2307, 2308, 2362, 2363, 2364,
+    2365, 2366, 2369, 2377, 2381, 2382, 2384, 2385,
+    2392, 2402, 2404, 2406, 2416, 2417, 2418, 2433,
+    2434, 2436, 2437, 2445, 2447, 2449, 2451, 2473,
+    2474, 2481, 2482, 2483, 2486, 2490, 2492, 2493,
+    2494, 2497, 2501, 2503, 2505, 2507, 2509, 2510,
+    2511, 2519, 2520, 2524, 2526, 2527, 2530, 2532,
+    2534, 2544, 2546, 2548, 2554, 2555, 2556, 2557,
+    2558, 2559, 2561, 2563, 2564, 2565, 2571, 2575,
+    2577, 2579, 2601, 2602, 2609, 2610, 2612, 2613,
+    2615, 2616, 2618, 2620, 2621, 2622, 2625, 2627,
+    2631, 2633, 2635, 2638, 2641, 2642, 2649, 2653,
+    2654, 2655, 2662, 2672, 2674, 2677, 2678, 2679,
+    2689, 2691, 2692, 2693, 2702, 2703, 2706, 2707,
+    2729, 2730, 2737, 2738, 2740, 2741, 2746, 2748,
+    2749, 2750, 2753, 2758, 2759, 2761, 2762, 2763,
+    2765, 2766, 2768, 2769, 2784, 2786, 2788, 2790,
+    2800, 2801, 2802, 2809, 2810, 2816, 2817, 2818,
+    2820, 2821, 2829, 2831, 2833, 2835, 2857, 2858,
+    2865, 2866, 2868, 2869, 2874, 2876, 2877, 2878,
+    2879, 2880, 2881, 2885, 2887, 2889, 2891, 2893,
+    2894, 2901, 2903, 2904, 2908, 2910, 2911, 2914,
+    2916, 2918, 2928, 2929, 2930, 2936, 2946, 2947,
+    2948, 2949, 2955, 2958, 2961, 2962, 2966, 2969,
+    2971, 2972, 2973, 2974, 2976, 2979, 2981, 2984,
+    2987, 2990, 3002, 3006, 3008, 3009, 3011, 3014,
+    3017, 3018, 3021, 3022, 3024, 3025, 3031, 3032,
+    3046, 3056, 3059, 3065, 3066, 3067, 3072, 3073,
+    3076, 3077, 3085, 3086, 3089, 3090, 3113, 3114,
+    3130, 3132, 3133, 3134, 3137, 3141, 3142, 3145,
+    3146, 3150, 3157, 3159, 3160, 3163, 3165, 3166,
+    3168, 3170, 3172, 3174, 3184, 3191, 3192, 3199,
+    3200, 3201, 3202, 3204, 3205, 3213, 3214, 3217,
+    3218, 3241, 3242, 3252, 3253, 3258, 3260, 3261,
+    3262, 3263, 3264, 3269, 3270, 3271, 3273, 3274,
+    3276, 3278, 3285, 3287, 3293, 3295, 3296, 3298,
+    3300, 3302, 3312, 3313, 3315, 3328, 3330, 3332,
+    3341, 3342, 3345, 3346, 3387, 3389, 3390, 3393,
+    3397, 3398, 3401, 3402, 3405, 3406, 3407, 3408,
+    3412, 3415, 3416, 3423, 3426, 3428, 3430, 3440,
+    3449, 3450, 3456, 3457, 3458, 3460, 3461, 3479,
+    3482, 3506, 3507, 3516, 3517, 3518, 3520, 3527,
+    3530, 3531, 3535, 3538, 3541, 3542, 3543, 3544,
+    3552, 3558, 3568, 3570, 3572, 3573, 3585, 3633,
+    3634, 3636, 3643, 3647, 3648, 3654, 3655, 3663,
+    3664, 3674, 3676, 3713, 3715, 3716, 3717, 3718,
+    3723, 3724, 3748, 3749, 3750, 3751, 3761, 3762,
+    3764, 3773, 3774, 3776, 3781, 3782, 3783, 3784,
+    3790, 3792, 3802, 3804, 3808, 3840, 3841, 3844,
+    3859, 3860, 3861, 3864, 3866, 3872, 3882, 3892,
+    3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900,
+    3901, 3902, 3904, 3912, 3913, 3949, 3953, 3967,
+    3968, 3973, 3974, 3976, 3981, 3992, 3993, 4029,
+    4030, 4038, 4039, 4045, 4046, 4048, 4053, 4057,
+    4059, 4096, 4139, 4141, 4145, 4146, 4152, 4153,
+    4155, 4157, 4159, 4160, 4170, 4176, 4182, 4184,
+    4186, 4190, 4193, 4194, 4197, 4199, 4206, 4209,
+    4213, 4226, 4227, 4229, 4231, 4237, 4238, 4239,
+    4240, 4250, 4253, 4254, 4256, 4294, 4295, 4296,
+    4301, 4302, 4304, 4347, 4348, 4349, 4352, 4681,
+    4682, 4686, 4688, 4695, 4696, 4697, 4698, 4702,
+    4704, 4745, 4746, 4750, 4752, 4785, 4786, 4790,
+    4792, 4799, 4800, 4801, 4802, 4806, 4808, 4823,
+    4824, 4881, 4882, 4886, 4888, 4955, 4957, 4960,
+    4969, 4989, 4992, 5008, 5018, 5024, 5110, 5112,
+    5118, 5120, 5121, 5741, 5742, 5743, 5760, 5761,
+    5787, 5788, 5789, 5792, 5867, 5870, 5873, 5881,
+    5888, 5906, 5909, 5910, 5919, 5938, 5940, 5941,
+    5943, 5952, 5970, 5972, 5984, 5997, 5998, 6001,
+    6002, 6004, 6016, 6068, 6070, 6071, 6078, 6086,
+    6087, 6089, 6100, 6103, 6104, 6107, 6108, 6109,
+    6110, 6112, 6122, 6128, 6138, 6144, 6150, 6151,
+    6155, 6158, 6159, 6160, 6170, 6176, 6211, 6212,
+    6265, 6272, 6277, 6279, 6313, 6314, 6315, 6320,
+    6390, 6400, 6431, 6432, 6435, 6439, 6441, 6444,
+    6448, 6450, 6451, 6457, 6460, 6464, 6465, 6468,
+    6470, 6480, 6510, 6512, 6517, 6528, 6572, 6576,
+    6602, 6608, 6618, 6619, 6622, 6656, 6679, 6681,
+    6683, 6684, 6686, 6688, 6741, 6742, 6743, 6744,
+    6751, 6752, 6753, 6754, 6755, 6757, 6765, 6771,
+    6781, 6783, 6784, 6794, 6800, 6810, 6816, 6823,
+    6824, 6830, 6832, 6846, 6847, 6863, 6912, 6916,
+    6917, 6964, 6965, 6966, 6971, 6972, 6973, 6978,
+    6979, 6981, 6989, 6992, 7002, 7009, 7019, 7028,
+    7037, 7039, 7040, 7042, 7043, 7073, 7074, 7078,
+    7080, 7082, 7083, 7086, 7088, 7098, 7142, 7143,
+    7144, 7146, 7149, 7150, 7151, 7154, 7156, 7164,
+    7168, 7204, 7212, 7220, 7222, 7224, 7227, 7232,
+    7242, 7245, 7248, 7258, 7288, 7294, 7296, 7305,
+    7312, 7355, 7357, 7360, 7368, 7376, 7379, 7380,
+    7393, 7394, 7401, 7405, 7406, 7412, 7413, 7415,
+    7416, 7418, 7419, 7424, 7468, 7531, 7544, 7545,
+    7579, 7616, 7680, 7681, 7682, 7683, 7684, 7685,
+    7686, 7687, 7688, 7689, 7690, 7691, 7692, 7693,
+    7694, 7695, 7696, 7697, 7698, 7699, 7700, 7701,
+    7702, 7703, 7704, 7705, 7706, 7707, 7708, 7709,
+    7710, 7711, 7712, 7713, 7714, 7715, 7716, 7717,
+    7718, 7719, 7720, 7721, 7722, 7723, 7724, 7725,
+    7726, 7727, 7728, 7729, 7730, 7731, 7732, 7733,
+    7734, 7735, 7736, 7737, 7738, 7739, 7740, 7741,
+    7742, 7743, 7744, 7745, 7746, 7747, 7748, 7749,
+    7750, 7751, 7752, 7753, 7754, 7755, 7756, 7757,
+    7758, 7759, 7760, 7761, 7762, 7763, 7764, 7765,
+    7766, 7767, 7768, 7769, 7770, 7771, 7772, 7773,
+    7774, 7775, 7776, 7777, 7778, 7779, 7780, 7781,
+    7782, 7783, 7784, 7785, 7786, 7787, 7788, 7789,
+    7790, 7791, 7792, 7793, 7794, 7795, 7796, 7797,
+    7798, 7799, 7800, 7801, 7802, 7803, 7804, 7805,
+    7806, 7807, 7808, 7809, 7810, 7811, 7812, 7813,
+    7814, 7815, 7816, 7817, 7818, 7819, 7820, 7821,
+    7822, 7823, 7824, 7825, 7826, 7827, 7828, 7829,
+    7838, 7839, 7840, 7841, 7842, 7843, 7844, 7845,
+    7846, 7847, 7848, 7849, 7850, 7851, 7852, 7853,
+    7854, 7855, 7856, 7857, 7858, 7859, 7860, 7861,
+    7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869,
+    7870, 7871, 7872, 7873, 7874, 7875, 7876, 7877,
+    7878, 7879, 7880, 7881, 7882, 7883, 7884, 7885,
+    7886, 7887, 7888, 7889, 7890, 7891, 7892, 7893,
+    7894, 7895, 7896, 7897, 7898, 7899, 7900, 7901,
+    7902, 7903, 7904, 7905, 7906, 7907, 7908, 7909,
+    7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917,
+    7918, 7919, 7920, 7921, 7922, 7923, 7924, 7925,
+    7926, 7927, 7928, 7929, 7930, 7931, 7932, 7933,
+    7934, 7935, 7944, 7952, 7958, 7960, 7966, 7968,
+    7976, 7984, 7992, 8000, 8006, 8008, 8014, 8016,
+    8024, 8025, 8026, 8027, 8028, 8029, 8030, 8031,
+    8032, 8040, 8048, 8062, 8064, 8072, 8080, 8088,
+    8096, 8104, 8112, 8117, 8118, 8120, 8124, 8125,
+    8126, 8127, 8130, 8133, 8134, 8136, 8140, 8141,
+    8144, 8148, 8150, 8152, 8156, 8157, 8160, 8168,
+    8173, 8176, 8178, 8181, 8182, 8184, 8188, 8189,
+    8191, 8192, 8203, 8208, 8214, 8216, 8217, 8218,
+    8219, 8221, 8222, 8223, 8224, 8232, 8233, 8234,
+    8239, 8240, 8249, 8250, 8251, 8255, 8257, 8260,
+    8261, 8262, 8263, 8274, 8275, 8276, 8277, 8287,
+    8288, 8293, 8294, 8304, 8305, 8306, 8308, 8314,
+    8317, 8318, 8319, 8320, 8330, 8333, 8334, 8335,
+    8336, 8349, 8352, 8385, 8400, 8413, 8417, 8418,
+    8421, 8433, 8448, 8450, 8451, 8455, 8456, 8458,
+    8459, 8462, 8464, 8467, 8468, 8469, 8470, 8472,
+    8473, 8478, 8484, 8485, 8486, 8487, 8488, 8489,
+    8490, 8494, 8495, 8496, 8500, 8501, 8505, 8506,
+    8508, 8510, 8512, 8517, 8518, 8522, 8523, 8524,
+    8526, 8527, 8528, 8544, 8579, 8580, 8581, 8585,
+    8586, 8588, 8592, 8597, 8602, 8604, 8608, 8609,
+    8611, 8612, 8614, 8615, 8622, 8623, 8654, 8656,
+    8658, 8659, 8660, 8661, 8692, 8960, 8968, 8969,
+    8970, 8971, 8972, 8992, 8994, 9001, 9002, 9003,
+    9084, 9085, 9115, 9140, 9180, 9186, 9255, 9280,
+    9291, 9312, 9372, 9450, 9472, 9655, 9656, 9665,
+    9666, 9720, 9728, 9839, 9840, 10088, 10089, 10090,
+    10091, 10092, 10093, 10094, 10095, 10096, 10097, 10098,
+    10099, 10100, 10101, 10102, 10132, 10176, 10181, 10182,
+    10183, 10214, 10215, 10216, 10217, 10218, 10219, 10220,
+    10221, 10222, 10223, 10224, 10240, 10496, 10627, 10628,
+    10629, 10630, 10631, 10632, 10633, 10634, 10635, 10636,
+    10637, 10638, 10639, 10640, 10641, 10642, 10643, 10644,
+    10645, 10646, 10647, 10648, 10649, 10712, 10713, 10714,
+    10715, 10716, 10748, 10749, 10750, 11008, 11056, 11077,
+    11079, 11085, 11124, 11126, 11158, 11159, 11264, 11312,
+    11360, 11361, 11362, 11365, 11367, 11368, 11369, 11370,
+    11371, 11372, 11373, 11377, 11378, 11379, 11381, 11382,
+    11388, 11390, 11393, 11394, 11395, 11396, 11397, 11398,
+    11399, 11400, 11401, 11402, 11403, 11404, 11405, 11406,
+    11407, 11408, 11409, 11410, 11411, 11412, 11413, 11414,
+    11415, 11416, 11417, 11418, 11419, 11420, 11421, 11422,
+    11423, 11424, 11425, 11426, 11427, 11428, 11429, 11430,
+    11431, 11432, 11433, 11434, 11435, 11436, 11437, 11438,
+    11439, 11440, 11441, 11442, 11443, 11444, 11445, 11446,
+    11447, 11448, 11449, 11450, 11451, 11452, 11453, 11454,
+    11455, 11456, 11457, 11458, 11459, 11460, 11461, 11462,
+    11463, 11464, 11465, 11466, 11467, 11468, 11469, 11470,
+    11471, 11472, 11473, 11474, 11475, 11476, 11477, 11478,
+    11479, 11480, 11481, 11482, 11483, 11484, 11485, 11486,
+    11487, 11488, 11489, 11490, 11491, 11493, 11499, 11500,
+    11501, 11502, 11503, 11506, 11507, 11508, 11513, 11517,
+    11518, 11520, 11558, 11559, 11560, 11565, 11566, 11568,
+    11624, 11631, 11632, 11633, 11647, 11648, 11671, 11680,
+    11687, 11688, 11695, 11696, 11703, 11704, 11711, 11712,
+    11719, 11720, 11727, 11728, 11735, 11736, 11743, 11744,
+    11776, 11778, 11779, 11780, 11781, 11782, 11785, 11786,
+    11787, 11788, 11789, 11790, 11799, 11800, 11802, 11803,
+    11804, 11805, 11806, 11808, 11809, 11810, 11811, 11812,
+    11813, 11814, 11815, 11816, 11817, 11818, 11823, 11824,
+    11834, 11836, 11840, 11841, 11842, 11843, 11856, 11858,
+    11861, 11862, 11863, 11864, 11865, 11866, 11867, 11868,
+    11869, 11870, 11904, 11930, 11931, 12020, 12032, 12246,
+    12272, 12284, 12288, 12289, 12292, 12293, 12294, 12295,
+    12296, 12297, 12298, 12299, 12300, 12301, 12302, 12303,
+    12304, 12305, 12306, 12308, 12309, 12310, 12311, 12312,
+    12313, 12314, 12315, 12316, 12317, 12318, 12320, 12321,
+    12330, 12334, 12336, 12337, 12342, 12344, 12347, 12348,
+    12349, 12350, 12352, 12353, 12439, 12441, 12443, 12445,
+    12447, 12448, 12449, 12539, 12540, 12543, 12544, 12549,
+    12592, 12593, 12687, 12688, 12690, 12694, 12704, 12736,
+    12772, 12784, 12800, 12831, 12832, 12842, 12872, 12880,
+    12881, 12896, 12928, 12938, 12977, 12992, 13312, 19904,
+    19968, 40981, 40982, 42125, 42128, 42183, 42192, 42232,
+    42238, 42240, 42508, 42509, 42512, 42528, 42538, 42540,
+    42560, 42561, 42562, 42563, 42564, 42565, 42566, 42567,
+    42568, 42569, 42570, 42571, 42572, 42573, 42574, 42575,
+    42576, 42577, 42578, 42579, 42580, 42581, 42582, 42583,
+    42584, 42585, 42586, 42587, 42588, 42589, 42590, 42591,
+    42592, 42593, 42594, 42595, 42596, 42597, 42598, 42599,
+    42600, 42601, 42602, 42603, 42604, 42605, 42606, 42607,
+    42608, 42611, 42612, 42622, 42623, 42624, 42625, 42626,
+    42627, 42628, 42629, 42630, 42631, 42632, 42633, 42634,
+    42635, 42636, 42637, 42638, 42639, 42640, 42641, 42642,
+    42643, 42644, 42645, 42646, 42647, 42648, 42649, 42650,
+    42651, 42652, 42654, 42656, 42726, 42736, 42738, 42744,
+    42752, 42775, 42784, 42786, 42787, 42788, 42789, 42790,
+    42791, 42792, 42793, 42794, 42795, 42796, 42797, 42798,
+    42799, 42802, 42803, 42804, 42805, 42806, 42807, 42808,
+    42809, 42810, 42811, 42812, 42813, 42814, 42815, 42816,
+    42817, 42818, 42819, 42820, 42821, 42822, 42823, 42824,
+    42825, 42826, 42827, 42828, 42829, 42830, 42831, 42832,
+    42833, 42834, 42835, 42836, 42837, 42838, 42839, 42840,
+    42841, 42842, 42843, 42844, 42845, 42846, 42847, 42848,
+    42849, 42850, 42851, 42852, 42853, 42854, 42855, 42856,
+    42857, 42858, 42859, 42860, 42861, 42862, 42863, 42864,
+    42865, 42873, 42874, 42875, 42876, 42877, 42879, 42880,
+    42881, 42882, 42883, 42884, 42885, 42886, 42887, 42888,
+    42889, 42891, 42892, 42893, 42894, 42895, 42896, 42897,
+    42898, 42899, 42902, 42903, 42904, 42905, 42906, 42907,
+    42908, 42909, 42910, 42911, 42912, 42913, 42914, 42915,
+    42916, 42917, 42918, 42919, 42920, 42921, 42922, 42927,
+    42928, 42933, 42934, 42935, 42936, 42937, 42938, 42939,
+    42940, 42941, 42942, 42943, 42944, 42945, 42946, 42947,
+    42948, 42952, 42953, 42954, 42955, 42960, 42961, 42962,
+    42963, 42964, 42965, 42966, 42967, 42968, 42969, 42970,
+    42994, 42997, 42998, 42999, 43000, 43002, 43003, 43010,
+    43011, 43014, 43015, 43019, 43020, 43043, 43045, 43047,
+    43048, 43052, 43053, 43056, 43062, 43064, 43065, 43066,
+    43072, 43124, 43128, 43136, 43138, 43188, 43204, 43206,
+    43214, 43216, 43226, 43232, 43250, 43256, 43259, 43260,
+    43261, 43263, 43264, 43274, 43302, 43310, 43312, 43335,
+    43346, 43348, 43359, 43360, 43389, 43392, 43395, 43396,
+    43443, 43444, 43446, 43450, 43452, 43454, 43457, 43470,
+    43471, 43472, 43482, 43486, 43488, 43493, 43494, 43495,
+    43504, 43514, 43519, 43520, 43561, 43567, 43569, 43571,
+    43573, 43575, 43584, 43587, 43588, 43596, 43597, 43598,
+    43600, 43610, 43612, 43616, 43632, 43633, 43639, 43642,
+    43643, 43644, 43645, 43646, 43696, 43697, 43698, 43701,
+    43703, 43705, 43710, 43712, 43713, 43714, 43715, 43739,
+    43741, 43742, 43744, 43755, 43756, 43758, 43760, 43762,
+    43763, 43765, 43766, 43767, 43777, 43783, 43785, 43791,
+    43793, 43799, 43808, 43815, 43816, 43823, 43824, 43867,
+    43868, 43872, 43881, 43882, 43884, 43888, 43968, 44003,
+    44005, 44006, 44008, 44009, 44011, 44012, 44013, 44014,
+    44016, 44026, 44032, 55204, 55216, 55239, 55243, 55292,
+    55296, 57344, 63744, 64110, 64112, 64218, 64256, 64263,
+    64275, 64280, 64285, 64286, 64287, 64297, 64298, 64311,
+    64312, 64317, 64318, 64319, 64320, 64322, 64323, 64325,
+    64326, 64434, 64451, 64467, 64830, 64831, 64832, 64848,
+    64912, 64914, 64968, 64975, 64976, 65008, 65020, 65021,
+    65024, 65040, 65047, 65048, 65049, 65050, 65056, 65072,
+    65073, 65075, 65077, 65078, 65079, 65080, 65081, 65082,
+    65083, 65084, 65085, 65086, 65087, 65088, 65089, 65090,
+    65091, 65092, 65093, 65095, 65096, 65097, 65101, 65104,
+    65107, 65108, 65112, 65113, 65114, 65115, 65116, 65117,
+    65118, 65119, 65122, 65123, 65124, 65127, 65128, 65129,
+    65130, 65132, 65136, 65141, 65142, 65277, 65279, 65280,
+    65281, 65284, 65285, 65288, 65289, 65290, 65291, 65292,
+    65293, 65294, 65296, 65306, 65308, 65311, 65313, 65339,
+    65340, 65341, 65342, 65343, 65344, 65345, 65371, 65372,
+    65373, 65374, 65375, 65376, 65377, 65378, 65379, 65380,
+    65382, 65392, 65393, 65438, 65440, 65471, 65474, 65480,
+    65482, 65488, 65490, 65496, 65498, 65501, 65504, 65506,
+    65507, 65508, 65509, 65511, 65512, 65513, 65517, 65519,
+    65529, 65532, 65534, 65536, 65548, 65549, 65575, 65576,
+    65595, 65596, 65598, 65599, 65614, 65616, 65630, 65664,
+    65787, 65792, 65795, 65799, 65844, 65847, 65856, 65909,
+    65913, 65930, 65932, 65935, 65936, 65949, 65952, 65953,
+    66000, 66045, 66046, 66176, 66205, 66208, 66257, 66272,
+    66273, 66300, 66304, 66336, 66340, 66349, 66369, 66370,
+    66378, 66379, 66384, 66422, 66427, 66432, 66462, 66463,
+    66464, 66500, 66504, 66512, 66513, 66518, 66560, 66600,
+    66640, 66718, 66720, 66730, 66736, 66772, 66776, 66812,
+    66816, 66856, 66864, 66916, 66927, 66928, 66939, 66940,
+    66955, 66956, 66963, 66964, 66966, 66967, 66978, 66979,
+    66994, 66995, 67002, 67003, 67005, 67072, 67383, 67392,
+    67414, 67424, 67432, 67456, 67462, 67463, 67505, 67506,
+    67515, 67584, 67590, 67592, 67593, 67594, 67638, 67639,
+    67641, 67644, 67645, 67647, 67670, 67671, 67672, 67680,
+    67703, 67705, 67712, 67743, 67751, 67760, 67808, 67827,
+    67828, 67830, 67835, 67840, 67862, 67868, 67871, 67872,
+    67898, 67903, 67904, 67968, 68024, 68028, 68030, 68032,
+    68048, 68050, 68096, 68097, 68100, 68101, 68103, 68108,
+    68112, 68116, 68117, 68120, 68121, 68150, 68152, 68155,
+    68159, 68160, 68169, 68176, 68185, 68192, 68221, 68223,
+    68224, 68253, 68256, 68288, 68296, 68297, 68325, 68327,
+    68331, 68336, 68343, 68352, 68406, 68409, 68416, 68438,
+    68440, 68448, 68467, 68472, 68480, 68498, 68505, 68509,
+    68521, 68528, 68608, 68681, 68736, 68787, 68800, 68851,
+    68858, 68864, 68900, 68904, 68912, 68922, 69216, 69247,
+    69248, 69290, 69291, 69293, 69294, 69296, 69298, 69376,
+    69405, 69415, 69416, 69424, 69446, 69457, 69461, 69466,
+    69488, 69506, 69510, 69514, 69552, 69573, 69580, 69600,
+    69623, 69632, 69633, 69634, 69635, 69688, 69703, 69710,
+    69714, 69734, 69744, 69745, 69747, 69749, 69750, 69759,
+    69762, 69763, 69808, 69811, 69815, 69817, 69819, 69821,
+    69822, 69826, 69827, 69837, 69838, 69840, 69865, 69872,
+    69882, 69888, 69891, 69927, 69932, 69933, 69941, 69942,
+    69952, 69956, 69957, 69959, 69960, 69968, 70003, 70004,
+    70006, 70007, 70016, 70018, 70019, 70067, 70070, 70079,
+    70081, 70085, 70089, 70093, 70094, 70095, 70096, 70106,
+    70107, 70108, 70109, 70112, 70113, 70133, 70144, 70162,
+    70163, 70188, 70191, 70194, 70196, 70197, 70198, 70200,
+    70206, 70207, 70272, 70279, 70280, 70281, 70282, 70286,
+    70287, 70302, 70303, 70313, 70314, 70320, 70367, 70368,
+    70371, 70379, 70384, 70394, 70400, 70402, 70404, 70405,
+    70413, 70415, 70417, 70419, 70441, 70442, 70449, 70450,
+    70452, 70453, 70458, 70459, 70461, 70462, 70464, 70465,
+    70469, 70471, 70473, 70475, 70478, 70480, 70481, 70487,
+    70488, 70493, 70498, 70500, 70502, 70509, 70512, 70517,
+    70656, 70709, 70712, 70720, 70722, 70725, 70726, 70727,
+    70731, 70736, 70746, 70748, 70749, 70750, 70751, 70754,
+    70784, 70832, 70835, 70841, 70842, 70843, 70847, 70849,
+    70850, 70852, 70854, 70855, 70856, 70864, 70874, 71040,
+    71087, 71090, 71094, 71096, 71100, 71102, 71103, 71105,
+    71128, 71132, 71134, 71168, 71216, 71219, 71227, 71229,
+    71230, 71231, 71233, 71236, 71237, 71248, 71258, 71264,
+    71277, 71296, 71339, 71340, 71341, 71342, 71344, 71350,
+    71351, 71352, 71353, 71354, 71360, 71370, 71424, 71451,
+    71453, 71456, 71458, 71462, 71463, 71468, 71472, 71482,
+    71484, 71487, 71488, 71495, 71680, 71724, 71727, 71736,
+    71737, 71739, 71740, 71840, 71872, 71904, 71914, 71923,
+    71935, 71943, 71945, 71946, 71948, 71956, 71957, 71959,
+    71960, 71984, 71990, 71991, 71993, 71995, 71997, 71998,
+    71999, 72000, 72001, 72002, 72003, 72004, 72007, 72016,
+    72026, 72096, 72104, 72106, 72145, 72148, 72152, 72154,
+    72156, 72160, 72161, 72162, 72163, 72164, 72165, 72192,
+    72193, 72203, 72243, 72249, 72250, 72251, 72255, 72263,
+    72264, 72272, 72273, 72279, 72281, 72284, 72330, 72343,
+    72344, 72346, 72349, 72350, 72355, 72368, 72441, 72704,
+    72713, 72714, 72751, 72752, 72759, 72760, 72766, 72767,
+    72768, 72769, 72774, 72784, 72794, 72813, 72816, 72818,
+    72848, 72850, 72872, 72873, 72874, 72881, 72882, 72884,
+    72885, 72887, 72960, 72967, 72968, 72970, 72971, 73009,
+    73015, 73018, 73019, 73020, 73022, 73023, 73030, 73031,
+    73032, 73040, 73050, 73056, 73062, 73063, 73065, 73066,
+    73098, 73103, 73104, 73106, 73107, 73109, 73110, 73111,
+    73112, 73113, 73120, 73130, 73440, 73459, 73461, 73463,
+    73465, 73648, 73649, 73664, 73685, 73693, 73697, 73714,
+    73727, 73728, 74650, 74752, 74863, 74864, 74869, 74880,
+    75076, 77712, 77809, 77811, 77824, 78895, 78896, 78905,
+    82944, 83527, 92160, 92729, 92736, 92767, 92768, 92778,
+    92782, 92784, 92863, 92864, 92874, 92880, 92910, 92912,
+    92917, 92918, 92928, 92976, 92983, 92988, 92992, 92996,
+    92997, 92998, 93008, 93018, 93019, 93026, 93027, 93048,
+    93053, 93072, 93760, 93792, 93824, 93847, 93851, 93952,
+    94027, 94031, 94032, 94033, 94088, 94095, 94099, 94112,
+    94176, 94178, 94179, 94180, 94181, 94192, 94194, 94208,
+    100344, 100352, 101590, 101632, 101641, 110576, 110580, 110581,
+    110588, 110589, 110591, 110592, 110883, 110928, 110931, 110948,
+    110952, 110960, 111356, 113664, 113771, 113776, 113789, 113792,
+    113801, 113808, 113818, 113820, 113821, 113823, 113824, 113828,
+    118528, 118574, 118576, 118599, 118608, 118724, 118784, 119030,
+    119040, 119079, 119081, 119141, 119143, 119146, 119149, 119155,
+    119163, 119171, 119173, 119180, 119210, 119214, 119275, 119296,
+    119362, 119365, 119366, 119520, 119540, 119552, 119639, 119648,
+    119673, 119808, 119834, 119860, 119886, 119893, 119894, 119912,
+    119938, 119964, 119965, 119966, 119968, 119970, 119971, 119973,
+    119975, 119977, 119981, 119982, 119990, 119994, 119995, 119996,
+    119997, 120004, 120005, 120016, 120042, 120068, 120070, 120071,
+    120075, 120077, 120085, 120086, 120093, 120094, 120120, 120122,
+    120123, 120127, 120128, 120133, 120134, 120135, 120138, 120145,
+    120146, 120172, 120198, 120224, 120250, 120276, 120302, 120328,
+    120354, 120380, 120406, 120432, 120458, 120486, 120488, 120513,
+    120514, 120539, 120540, 120546, 120571, 120572, 120597, 120598,
+    120604, 120629, 120630, 120655, 120656, 120662, 120687, 120688,
+    120713, 120714, 120720, 120745, 120746, 120771, 120772, 120778,
+    120779, 120780, 120782, 120832, 121344, 121399, 121403, 121453,
+    121461, 121462, 121476, 121477, 121479, 121484, 121499, 121504,
+    121505, 121520, 122624, 122634, 122635, 122655, 122880, 122887,
+    122888, 122905, 122907, 122914, 122915, 122917, 122918, 122923,
+    123136, 123181, 123184, 123191, 123198, 123200, 123210, 123214,
+    123215, 123216, 123536, 123566, 123567, 123584, 123628, 123632,
+    123642, 123647, 123648, 124896, 124903, 124904, 124908, 124909,
+    124911, 124912, 124927, 124928, 125125, 125127, 125136, 125143,
+    125184, 125218, 125252, 125259, 125260, 125264, 125274, 125278,
+    125280, 126065, 126124, 126125, 126128, 126129, 126133, 126209,
+    126254, 126255, 126270, 126464, 126468, 126469, 126496, 126497,
+    126499, 126500, 126501, 126503, 126504, 126505, 126515, 126516,
+    126520, 126521, 126522, 126523, 126524, 126530, 126531, 126535,
+    126536, 126537, 126538, 126539, 126540, 126541, 126544, 126545,
+    126547, 126548, 126549, 126551, 126552, 126553, 126554, 126555,
+    126556, 126557, 126558, 126559, 126560, 126561, 126563, 126564,
+    126565, 126567, 126571, 126572, 126579, 126580, 126584, 126585,
+    126589, 126590, 126591, 126592, 126602, 126603, 126620, 126625,
+    126628, 126629, 126634, 126635, 126652, 126704, 126706, 126976,
+    127020, 127024, 127124, 127136, 127151, 127153, 127168, 127169,
+    127184, 127185, 127222, 127232, 127245, 127406, 127462, 127491,
+    127504, 127548, 127552, 127561, 127568, 127570, 127584, 127590,
+    127744, 127995, 128000, 128728, 128733, 128749, 128752, 128765,
+    128768, 128884, 128896, 128985, 128992, 129004, 129008, 129009,
+    129024, 129036, 129040, 129096, 129104, 129114, 129120, 129160,
+    129168, 129198, 129200, 129202, 129280, 129620, 129632, 129646,
+    129648, 129653, 129656, 129661, 129664, 129671, 129680, 129709,
+    129712, 129723, 129728, 129734, 129744, 129754, 129760, 129768,
+    129776, 129783, 129792, 129939, 129940, 129995, 130032, 130042,
+    131072, 173792, 173824, 177977, 177984, 178206, 178208, 183970,
+    183984, 191457, 194560, 195102, 196608, 201547, 917505, 917506,
+    917536, 917632, 917760, 918000, 983040, 1048574, 1048576, 1114110,
+};
+
+inline constexpr std::uint8_t general_category_values[] = {
+    26, 23, 18, 20, 18, 14, 15, 18, 19, 18, 13, 18, 9, 18, 19, 18,
+    1, 14, 18, 15, 21, 12, 21, 2, 14, 19, 15, 19, 26, 23, 18, 20,
+    22, 18, 21, 22, 5, 16, 19, 27, 22, 21, 22, 19, 11, 21, 2, 18,
+    21, 11, 5, 17, 11, 18, 1, 19, 1, 2, 19, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 1, 2, 5,
+    1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 2, 4, 21,
+    4, 21, 4, 21, 4, 21, 4, 21, 6, 1, 2, 1, 2, 4, 21, 1,
+    2, 0, 4, 2, 18, 1, 0, 21, 1, 18, 1, 0, 1, 0, 1, 2,
+    1, 0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 19, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 22, 6, 8, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 0, 1, 0, 4, 18, 2, 18, 13, 0, 22, 20, 0, 6, 13,
+    6, 18, 6, 18, 6, 18, 6, 0, 5, 0, 5, 18, 0, 27, 19, 18,
+    20, 18, 22, 6, 18, 27, 18, 5, 4, 5, 6, 9, 18, 5, 6, 5,
+    18, 5, 6, 27, 22, 6, 4, 6, 22, 6, 5, 9, 5, 22, 5, 18,
+    0, 27, 5, 6, 5, 6, 0, 5, 6, 5, 0, 9, 5, 6, 4, 22,
+    18, 4, 0, 6, 20, 5, 6, 4, 6, 4, 6, 4, 6, 0, 18, 0,
+    5, 6, 0, 18, 0, 5, 0, 5, 21, 5, 0, 27, 0, 6, 5, 4,
+    6, 27, 6, 7, 5, 6, 7, 6, 5, 7, 6, 7, 6, 7, 5, 6,
+    5, 6, 18, 9, 18, 4, 5, 6, 7, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 6, 5, 7, 6, 0, 7, 0, 7, 6, 5,
+    0, 7, 0, 5, 0, 5, 6, 0, 9, 5, 20, 11, 22, 20, 5, 18,
+    6, 0, 6, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 6, 0, 7, 6, 0, 6, 0, 6, 0, 6, 0, 5, 0,
+    5, 0, 9, 6, 5, 6, 18, 0, 6, 7, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 6, 5, 7, 6, 0, 6, 7, 0, 7,
+    6, 0, 5, 0, 5, 6, 0, 9, 18, 20, 0, 5, 6, 0, 6, 7,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 6, 5, 7,
+    6, 7, 6, 0, 7, 0, 7, 6, 0, 6, 7, 0, 5, 0, 5, 6,
+    0, 9, 22, 5, 11, 0, 6, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 7, 6, 7, 0, 7,
+    0, 7, 6, 0, 5, 0, 7, 0, 9, 11, 22, 20, 22, 0, 6, 7,
+    6, 5, 0, 5, 0, 5, 0, 5, 0, 6, 5, 6, 7, 0, 6, 0,
+    6, 0, 6, 0, 5, 0, 5, 0, 5, 6, 0, 9, 0, 18, 11, 22,
+    5, 6, 7, 18, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 6, 5,
+    7, 6, 7, 0, 6, 7, 0, 7, 6, 0, 7, 0, 5, 0, 5, 6,
+    0, 9, 0, 5, 0, 6, 7, 5, 0, 5, 0, 5, 6, 5, 7, 6,
+    0, 7, 0, 7, 6, 5, 22, 0, 5, 7, 11, 5, 6, 0, 9, 11,
+    22, 5, 0, 6, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    6, 0, 7, 6, 0, 6, 0, 7, 0, 9, 0, 7, 18, 0, 5, 6,
+    5, 6, 0, 20, 5, 4, 6, 18, 9, 18, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 6, 5, 6, 5, 0, 5, 0, 4, 0, 6,
+    0, 9, 0, 5, 0, 5, 22, 18, 22, 18, 22, 6, 22, 9, 11, 22,
+    6, 22, 6, 22, 6, 14, 15, 14, 15, 7, 5, 0, 5, 0, 6, 7,
+    6, 18, 6, 5, 6, 0, 6, 0, 22, 6, 22, 0, 22, 18, 22, 18,
+    0, 5, 7, 6, 7, 6, 7, 6, 7, 6, 5, 9, 18, 5, 7, 6,
+    5, 6, 5, 7, 5, 7, 5, 6, 5, 6, 7, 6, 7, 6, 5, 7,
+    9, 7, 6, 22, 1, 0, 1, 0, 1, 0, 2, 18, 4, 2, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 6, 18,
+    11, 0, 5, 22, 0, 1, 0, 2, 0, 13, 5, 22, 18, 5, 23, 5,
+    14, 15, 0, 5, 18, 10, 5, 0, 5, 6, 7, 0, 5, 6, 7, 18,
+    0, 5, 6, 0, 5, 0, 5, 0, 6, 0, 5, 6, 7, 6, 7, 6,
+    7, 6, 18, 4, 18, 20, 5, 6, 0, 9, 0, 11, 0, 18, 13, 18,
+    6, 27, 6, 9, 0, 5, 4, 5, 0, 5, 6, 5, 6, 5, 0, 5,
+    0, 5, 0, 6, 7, 6, 7, 0, 7, 6, 7, 6, 0, 22, 0, 18,
+    9, 5, 0, 5, 0, 5, 0, 5, 0, 9, 11, 0, 22, 5, 6, 7,
+    6, 0, 18, 5, 7, 6, 7, 6, 0, 6, 7, 6, 7, 6, 7, 6,
+    0, 6, 9, 0, 9, 0, 18, 4, 18, 0, 6, 8, 6, 0, 6, 7,
+    5, 6, 7, 6, 7, 6, 7, 6, 7, 5, 0, 9, 18, 22, 6, 22,
+    18, 0, 6, 7, 5, 7, 6, 7, 6, 7, 6, 5, 9, 5, 6, 7,
+    6, 7, 6, 7, 6, 7, 0, 18, 5, 7, 6, 7, 6, 0, 18, 9,
+    0, 5, 9, 5, 4, 18, 2, 0, 1, 0, 1, 18, 0, 6, 18, 6,
+    7, 6, 5, 6, 5, 6, 5, 7, 6, 5, 0, 2, 4, 2, 4, 2,
+    4, 6, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 1, 0, 2,
+    1, 2, 1, 2, 0, 1, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1,
+    2, 1, 2, 0, 2, 3, 2, 3, 2, 3, 2, 0, 2, 1, 3, 21,
+    2, 21, 2, 0, 2, 1, 3, 21, 2, 0, 2, 1, 0, 21, 2, 1,
+    21, 0, 2, 0, 2, 1, 3, 21, 0, 23, 27, 13, 18, 16, 17, 14,
+    16, 17, 14, 16, 18, 24, 25, 27, 23, 18, 16, 17, 18, 12, 18, 19,
+    14, 15, 18, 19, 18, 12, 18, 23, 27, 0, 27, 11, 4, 0, 11, 19,
+    14, 15, 4, 11, 19, 14, 15, 0, 4, 0, 20, 0, 6, 8, 6, 8,
+    6, 0, 22, 1, 22, 1, 22, 2, 1, 2, 1, 2, 22, 1, 22, 19,
+    1, 22, 1, 22, 1, 22, 1, 22, 1, 22, 2, 1, 2, 5, 2, 22,
+    2, 1, 19, 1, 2, 22, 19, 22, 2, 22, 11, 10, 1, 2, 10, 11,
+    22, 0, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22, 19, 22,
+    19, 22, 19, 22, 19, 22, 14, 15, 14, 15, 22, 19, 22, 14, 15, 22,
+    19, 22, 19, 22, 19, 22, 0, 22, 0, 11, 22, 11, 22, 19, 22, 19,
+    22, 19, 22, 19, 22, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 11, 22, 19, 14, 15, 19, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 19, 22, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 19, 14, 15, 14,
+    15, 19, 14, 15, 19, 22, 19, 22, 19, 22, 0, 22, 0, 22, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 22, 1, 2, 1, 2, 6, 1, 2, 0, 18, 11,
+    18, 2, 0, 2, 0, 2, 0, 5, 0, 4, 18, 0, 6, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 6,
+    18, 16, 17, 16, 17, 18, 16, 17, 18, 16, 17, 18, 13, 18, 13, 18,
+    16, 17, 18, 16, 17, 14, 15, 14, 15, 14, 15, 14, 15, 18, 4, 18,
+    13, 18, 13, 18, 14, 18, 22, 18, 14, 15, 14, 15, 14, 15, 14, 15,
+    13, 0, 22, 0, 22, 0, 22, 0, 22, 0, 23, 18, 22, 4, 5, 10,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 22, 14, 15, 14, 15, 14,
+    15, 14, 15, 13, 14, 15, 22, 10, 6, 7, 13, 4, 22, 10, 4, 5,
+    18, 22, 0, 5, 0, 6, 21, 4, 5, 13, 5, 18, 4, 5, 0, 5,
+    0, 5, 0, 22, 11, 22, 5, 22, 0, 5, 22, 0, 11, 22, 11, 22,
+    11, 22, 11, 22, 11, 22, 5, 22, 5, 4, 5, 0, 22, 0, 5, 4,
+    18, 5, 4, 18, 5, 9, 5, 0, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 5, 6, 8, 18, 6, 18, 4, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 4, 6, 5, 10, 6, 18, 0,
+    21, 4, 21, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 4,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 4,
+    21, 1, 2, 1, 2, 5, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 0, 1, 2, 0, 2, 0, 2, 1, 2, 1, 2, 0,
+    4, 1, 2, 5, 4, 2, 5, 6, 5, 6, 5, 6, 5, 7, 6, 7,
+    22, 6, 0, 11, 22, 20, 22, 0, 5, 18, 0, 7, 5, 7, 6, 0,
+    18, 9, 0, 6, 5, 18, 5, 18, 5, 6, 9, 5, 6, 18, 5, 6,
+    7, 0, 18, 5, 0, 6, 7, 5, 6, 7, 6, 7, 6, 7, 18, 0,
+    4, 9, 0, 18, 5, 6, 4, 5, 9, 5, 0, 5, 6, 7, 6, 7,
+    6, 0, 5, 6, 5, 6, 7, 0, 9, 0, 18, 5, 4, 5, 22, 5,
+    7, 6, 7, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 0, 5,
+    4, 18, 5, 7, 6, 7, 18, 5, 4, 7, 6, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 2, 21, 4, 2, 4, 21, 0, 2, 5, 7,
+    6, 7, 6, 7, 18, 7, 6, 0, 9, 0, 5, 0, 5, 0, 5, 0,
+    28, 29, 5, 0, 5, 0, 2, 0, 2, 0, 5, 6, 5, 19, 5, 0,
+    5, 0, 5, 0, 5, 0, 5, 0, 5, 21, 0, 5, 15, 14, 22, 5,
+    0, 5, 0, 22, 0, 5, 20, 22, 6, 18, 14, 15, 18, 0, 6, 18,
+    13, 12, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 18, 14, 15, 18, 12, 18, 0, 18, 13, 14, 15, 14, 15, 14,
+    15, 18, 19, 13, 19, 0, 18, 20, 18, 0, 5, 0, 5, 0, 27, 0,
+    18, 20, 18, 14, 15, 18, 19, 18, 13, 18, 9, 18, 19, 18, 1, 14,
+    18, 15, 21, 12, 21, 2, 14, 19, 15, 19, 14, 15, 18, 14, 15, 18,
+    5, 4, 5, 4, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 20, 19,
+    21, 22, 20, 0, 22, 19, 22, 0, 27, 22, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 18, 0, 11, 0, 22, 10, 11,
+    22, 11, 22, 0, 22, 0, 22, 0, 22, 6, 0, 5, 0, 5, 0, 6,
+    11, 0, 5, 11, 0, 5, 10, 5, 10, 0, 5, 6, 0, 5, 0, 18,
+    5, 0, 5, 18, 10, 0, 1, 2, 5, 0, 9, 0, 1, 0, 2, 0,
+    5, 0, 5, 0, 18, 1, 0, 1, 0, 1, 0, 1, 0, 2, 0, 2,
+    0, 2, 0, 2, 0, 5, 0, 5, 0, 5, 0, 4, 0, 4, 0, 4,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 18, 11, 5,
+    22, 11, 5, 0, 11, 0, 5, 0, 5, 0, 11, 5, 11, 0, 18, 5,
+    0, 18, 0, 5, 0, 11, 5, 11, 0, 11, 5, 6, 0, 6, 0, 6,
+    5, 0, 5, 0, 5, 0, 6, 0, 6, 11, 0, 18, 0, 5, 11, 18,
+    5, 11, 0, 5, 22, 5, 6, 0, 11, 18, 0, 5, 0, 18, 5, 0,
+    11, 5, 0, 11, 5, 0, 18, 0, 11, 0, 5, 0, 1, 0, 2, 0,
+    11, 5, 6, 0, 9, 0, 11, 0, 5, 0, 6, 13, 0, 5, 0, 5,
+    11, 5, 0, 5, 6, 11, 18, 0, 5, 6, 18, 0, 5, 11, 0, 5,
+    0, 7, 6, 7, 5, 6, 18, 0, 11, 9, 6, 5, 6, 5, 0, 6,
+    7, 5, 7, 6, 7, 6, 18, 27, 18, 6, 0, 27, 0, 5, 0, 9,
+    0, 6, 5, 6, 7, 6, 0, 9, 18, 5, 7, 5, 0, 5, 6, 18,
+    5, 0, 6, 7, 5, 7, 6, 7, 5, 18, 6, 18, 7, 6, 9, 5,
+    18, 5, 18, 0, 11, 0, 5, 0, 5, 7, 6, 7, 6, 7, 6, 18,
+    6, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 18, 0, 5, 6, 7,
+    6, 0, 9, 0, 6, 7, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 6, 5, 7, 6, 7, 0, 7, 0, 7, 0, 5, 0, 7,
+    0, 5, 7, 0, 6, 0, 6, 0, 5, 7, 6, 7, 6, 7, 6, 5,
+    18, 9, 18, 0, 18, 6, 5, 0, 5, 7, 6, 7, 6, 7, 6, 7,
+    6, 5, 18, 5, 0, 9, 0, 5, 7, 6, 0, 7, 6, 7, 6, 18,
+    5, 6, 0, 5, 7, 6, 7, 6, 7, 6, 18, 5, 0, 9, 0, 18,
+    0, 5, 6, 7, 6, 7, 6, 7, 6, 5, 18, 0, 9, 0, 5, 0,
+    6, 7, 6, 7, 6, 0, 9, 11, 18, 22, 5, 0, 5, 7, 6, 7,
+    6, 18, 0, 1, 2, 9, 11, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 7, 0, 7, 0, 6, 7, 6, 5, 7, 5, 7, 6, 18, 0, 9,
+    0, 5, 0, 5, 7, 6, 0, 6, 7, 6, 5, 18, 5, 7, 0, 5,
+    6, 5, 6, 7, 5, 6, 18, 6, 0, 5, 6, 7, 6, 5, 6, 7,
+    6, 18, 5, 18, 0, 5, 0, 5, 0, 5, 7, 6, 0, 6, 7, 6,
+    5, 18, 0, 9, 11, 0, 18, 5, 0, 6, 0, 7, 6, 7, 6, 7,
+    6, 0, 5, 0, 5, 0, 5, 6, 0, 6, 0, 6, 0, 6, 5, 6,
+    0, 9, 0, 5, 0, 5, 0, 5, 7, 0, 6, 0, 7, 6, 7, 6,
+    5, 0, 9, 0, 5, 6, 7, 18, 0, 5, 0, 11, 22, 20, 22, 0,
+    18, 5, 0, 10, 0, 18, 0, 5, 0, 5, 18, 0, 5, 0, 27, 0,
+    5, 0, 5, 0, 5, 0, 9, 0, 18, 5, 0, 9, 0, 5, 0, 6,
+    18, 0, 5, 6, 18, 22, 4, 18, 22, 0, 9, 0, 11, 0, 5, 0,
+    5, 0, 1, 2, 11, 18, 0, 5, 0, 6, 5, 7, 0, 6, 4, 0,
+    4, 18, 4, 6, 0, 7, 0, 5, 0, 5, 0, 5, 0, 4, 0, 4,
+    0, 4, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 22, 6, 18, 27, 0, 6, 0, 6, 0, 22, 0, 22, 0,
+    22, 0, 22, 7, 6, 22, 7, 27, 6, 22, 6, 22, 6, 22, 0, 22,
+    6, 22, 0, 11, 0, 22, 0, 11, 0, 1, 2, 1, 2, 0, 2, 1,
+    2, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 0, 2, 0,
+    2, 0, 2, 1, 2, 1, 0, 1, 0, 1, 0, 1, 0, 2, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 0, 1, 19, 2, 19, 2, 1, 19, 2, 19, 2,
+    1, 19, 2, 19, 2, 1, 19, 2, 19, 2, 1, 19, 2, 19, 2, 1,
+    2, 0, 9, 22, 6, 22, 6, 22, 6, 22, 6, 22, 18, 0, 6, 0,
+    6, 0, 2, 5, 2, 0, 6, 0, 6, 0, 6, 0, 6, 0, 6, 0,
+    5, 0, 6, 4, 0, 9, 0, 5, 22, 0, 5, 6, 0, 5, 6, 9,
+    0, 20, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 11, 6, 0,
+    1, 2, 6, 4, 0, 9, 0, 18, 0, 11, 22, 11, 20, 11, 0, 11,
+    22, 11, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+    0, 5, 0, 5, 0, 19, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22,
+    0, 22, 0, 11, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+    22, 21, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+    22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+    22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22, 0,
+    22, 0, 22, 0, 22, 0, 9, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+    5, 0, 5, 0, 5, 0, 27, 0, 27, 0, 6, 0, 29, 0, 29, 0,
+};
+
+inline constexpr char const* general_category_short_names[] = {
+    "Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc",
+    "Me", "Nd", "Nl", "No", "Pc", "Pd", "Ps", "Pe",
+    "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So", "Zs",
+    "Zl", "Zp", "Cc", "Cf", "Cs", "Co",
+};
+
+inline constexpr char const* general_category_long_names[] = {
+    "Unassigned", "UppercaseLetter", "LowercaseLetter", "TitlecaseLetter",
+    "ModifierLetter", "OtherLetter", "NonspacingMark", "SpacingMark",
+    "EnclosingMark", "DecimalNumber", "LetterNumber", "OtherNumber",
+    "ConnectorPunctuation", "DashPunctuation", "OpenPunctuation", "ClosePunctuation",
+    "InitialPunctuation", "FinalPunctuation", "OtherPunctuation", "MathSymbol",
+    "CurrencySymbol", "ModifierSymbol", "OtherSymbol", "SpaceSeparator",
+    "LineSeparator", "ParagraphSeparator", "Control", "Format",
+    "Surrogate", "PrivateUse",
+};
+
+inline constexpr std::uint32_t decimal_digit_zeros[] = {
+    48, 1632, 1776, 1984, 2406, 2534, 2662, 2790,
+    2918, 3046, 3174, 3302, 3430, 3558, 3664, 3792,
+    3872, 4160, 4240, 6112, 6160, 6470, 6608, 6784,
+    6800, 6992, 7088, 7232, 7248, 42528, 43216, 43264,
+    43472, 43504, 43600, 44016, 65296, 66720, 68912, 69734,
+    69872, 69942, 70096, 70384, 70736, 70864, 71248, 71360,
+    71472, 71904, 72016, 72784, 73040, 73120, 92768, 92864,
+    93008, 120782, 120792, 120802, 120812, 120822, 123200, 123632,
+    125264, 130032,
+};
+
+/**
+ * IDNA (UTS #46) mapping statuses.
+ */
+enum class idna_status : std::uint8_t {
+    disallowed,
+    valid,
+    ignored,
+    mapped,
+};
+
+inline constexpr std::uint32_t idna_sequence_flag = 0x80000000;
+
+inline constexpr std::uint32_t idna_starts[] = {
+    0, 45, 47, 48, 58, 65, 91, 97,
+    123, 170, 171, 173, 174, 178, 180, 181,
+    182, 185, 186, 187, 192, 215, 216, 223,
+    247, 248, 256, 257, 258, 259, 260, 261,
+    262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 276, 277,
+    278, 279, 280, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293,
+    294, 295, 296, 297, 298, 299, 300, 301,
+    302, 303, 304, 305, 306, 308, 309, 310,
+    311, 313, 314, 315, 316, 317, 318, 319,
+    321, 322, 323, 324, 325, 326, 327, 328,
+    329, 330, 331, 332, 333, 334, 335, 336,
+    337, 338, 339, 340, 341, 342, 343, 344,
+    345, 346, 347, 348, 349, 350, 351, 352,
+    353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368,
+    369, 370, 371, 372, 373, 374, 375, 376,
+    377, 378, 379, 380, 381, 382, 383, 384,
+    385, 386, 387, 388, 389, 390, 391, 392,
+    393, 395, 396, 398, 399, 400, 401, 402,
+    403, 404, 405, 406, 407, 408, 409, 412,
+    413, 414, 415, 416, 417, 418, 419, 420,
+    421, 422, 423, 424, 425, 426, 428, 429,
+    430, 431, 432, 433, 435, 436, 437, 438,
+    439, 440, 441, 444, 445, 452, 455, 458,
+    461, 462, 463, 464, 465, 466, 467, 468,
+    469, 470, 471, 472, 473, 474, 475, 476,
+    478, 479, 480, 481, 482, 483, 484, 485,
+    486, 487, 488, 489, 490, 491, 492, 493,
+    494, 495, 497, 500, 501, 502, 503, 504,
+    505, 506, 507, 508, 509, 510, 511, 512,
+    513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528,
+    529, 530, 531, 532, 533, 534, 535, 536,
+    537, 538, 539, 540, 541, 542, 543, 544,
+    545, 546, 547, 548, 549, 550, 551, 552,
+    553, 554, 555, 556, 557, 558, 559, 560,
+    561, 562, 563, 570, 571, 572, 573, 574,
+    575, 577, 578, 579, 580, 581, 582, 583,
+    584, 585, 586, 587, 588, 589, 590, 591,
+    688, 689, 690, 691, 692, 693, 694, 695,
+    696, 697, 706, 710, 722, 736, 737, 738,
+    739, 740, 741, 748, 749, 750, 751, 768,
+    832, 834, 835, 836, 837, 838, 847, 848,
+    880, 881, 882, 883, 884, 885, 886, 887,
+    888, 891, 894, 895, 896, 902, 903, 904,
+    907, 908, 909, 910, 912, 913, 930, 931,
+    940, 975, 976, 977, 978, 979, 980, 981,
+    982, 983, 984, 985, 986, 987, 988, 989,
+    990, 991, 992, 993, 994, 995, 996, 997,
+    998, 999, 1000, 1001, 1002, 1003, 1004, 1005,
+    1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013,
+    1014, 1015, 1016, 1017, 1018, 1019, 1021, 1024,
+    1040, 1072, 1120, 1121, 1122, 1123, 1124, 1125,
+    1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
+    1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
+    1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+    1150, 1151, 1152, 1153, 1154, 1155, 1162, 1163,
+    1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171,
+    1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179,
+    1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187,
+    1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+    1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
+    1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211,
+    1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219,
+    1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227,
+    1228, 1229, 1230, 1232, 1233, 1234, 1235, 1236,
+    1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+    1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+    1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260,
+    1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268,
+    1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
+    1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
+    1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292,
+    1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
+    1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308,
+    1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
+    1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324,
+    1325, 1326, 1327, 1328, 1329, 1367, 1369, 1370,
+    1376, 1415, 1416, 1417, 1425, 1470, 1471, 1472,
+    1473, 1475, 1476, 1478, 1479, 1480, 1488, 1515,
+    1519, 1523, 1552, 1563, 1564, 1565, 1568, 1642,
+    1646, 1653, 1654, 1655, 1656, 1657, 1748, 1749,
+    1757, 1759, 1769, 1770, 1789, 1791, 1792, 1808,
+    1867, 1869, 1970, 1984, 2038, 2042, 2043, 2045,
+    2046, 2048, 2094, 2112, 2140, 2144, 2155, 2160,
+    2184, 2185, 2191, 2200, 2274, 2275, 2392, 2393,
+    2394, 2395, 2396, 2397, 2398, 2399, 2400, 2404,
+    2406, 2416, 2417, 2436, 2437, 2445, 2447, 2449,
+    2451, 2473, 2474, 2481, 2482, 2483, 2486, 2490,
+    2492, 2501, 2503, 2505, 2507, 2511, 2519, 2520,
+    2524, 2525, 2526, 2527, 2528, 2532, 2534, 2546,
+    2548, 2554, 2556, 2557, 2558, 2559, 2561, 2564,
+    2565, 2571, 2575, 2577, 2579, 2601, 2602, 2609,
+    2610, 2611, 2612, 2613, 2614, 2615, 2616, 2618,
+    2620, 2621, 2622, 2627, 2631, 2633, 2635, 2638,
+    2641, 2642, 2649, 2650, 2651, 2652, 2653, 2654,
+    2655, 2662, 2678, 2689, 2692, 2693, 2702, 2703,
+    2706, 2707, 2729, 2730, 2737, 2738, 2740, 2741,
+    2746, 2748, 2758, 2759, 2762, 2763, 2766, 2768,
+    2769, 2784, 2788, 2790, 2800, 2809, 2816, 2817,
+    2820, 2821, 2829, 2831, 2833, 2835, 2857, 2858,
+    2865, 2866, 2868, 2869, 2874, 2876, 2885, 2887,
+    2889, 2891, 2894, 2901, 2904, 2908, 2909, 2910,
+    2911, 2916, 2918, 2928, 2929, 2936, 2946, 2948,
+    2949, 2955, 2958, 2961, 2962, 2966, 2969, 2971,
+    2972, 2973, 2974, 2976, 2979, 2981, 2984, 2987,
+    2990, 3002, 3006, 3011, 3014, 3017, 3018, 3022,
+    3024, 3025, 3031, 3032, 3046, 3059, 3072, 3085,
+    3086, 3089, 3090, 3113, 3114, 3130, 3132, 3141,
+    3142, 3145, 3146, 3150, 3157, 3159, 3160, 3163,
+    3165, 3166, 3168, 3172, 3174, 3184, 3192, 3199,
+    3200, 3204, 3205, 3213, 3214, 3217, 3218, 3241,
+    3242, 3252, 3253, 3258, 3260, 3269, 3270, 3273,
+    3274, 3278, 3285, 3287, 3293, 3295, 3296, 3300,
+    3302, 3312, 3313, 3315, 3328, 3341, 3342, 3345,
+    3346, 3397, 3398, 3401, 3402, 3407, 3412, 3428,
+    3430, 3449, 3450, 3456, 3457, 3460, 3461, 3479,
+    3482, 3506, 3507, 3516, 3517, 3518, 3520, 3527,
+    3530, 3531, 3535, 3541, 3542, 3543, 3544, 3552,
+    3558, 3568, 3570, 3572, 3585, 3635, 3636, 3643,
+    3648, 3663, 3664, 3674, 3713, 3715, 3716, 3717,
+    3718, 3723, 3724, 3748, 3749, 3750, 3751, 3763,
+    3764, 3774, 3776, 3781, 3782, 3783, 3784, 3790,
+    3792, 3802, 3804, 3805, 3806, 3808, 3840, 3841,
+    3864, 3866, 3872, 3892, 3893, 3894, 3895, 3896,
+    3897, 3898, 3902, 3907, 3908, 3912, 3913, 3917,
+    3918, 3922, 3923, 3927, 3928, 3932, 3933, 3945,
+    3946, 3949, 3953, 3955, 3956, 3957, 3958, 3959,
+    3960, 3961, 3962, 3969, 3970, 3973, 3974, 3987,
+    3988, 3992, 3993, 3997, 3998, 4002, 4003, 4007,
+    4008, 4012, 4013, 4025, 4026, 4029, 4038, 4039,
+    4096, 4170, 4176, 4254, 4256, 4294, 4295, 4296,
+    4301, 4302, 4304, 4347, 4348, 4349, 4447, 4449,
+    4681, 4682, 4686, 4688, 4695, 4696, 4697, 4698,
+    4702, 4704, 4745, 4746, 4750, 4752, 4785, 4786,
+    4790, 4792, 4799, 4800, 4801, 4802, 4806, 4808,
+    4823, 4824, 4881, 4882, 4886, 4888, 4955, 4957,
+    4960, 4969, 4989, 4992, 5008, 5024, 5110, 5112,
+    5118, 5121, 5741, 5743, 5760, 5761, 5787, 5792,
+    5867, 5870, 5881, 5888, 5910, 5919, 5941, 5952,
+    5972, 5984, 5997, 5998, 6001, 6002, 6004, 6016,
+    6068, 6070, 6100, 6103, 6104, 6108, 6110, 6112,
+    6122, 6128, 6138, 6155, 6160, 6170, 6176, 6265,
+    6272, 6315, 6320, 6390, 6400, 6431, 6432, 6444,
+    6448, 6460, 6470, 6510, 6512, 6517, 6528, 6572,
+    6576, 6602, 6608, 6619, 6656, 6684, 6688, 6751,
+    6752, 6781, 6783, 6794, 6800, 6810, 6823, 6824,
+    6832, 6863, 6912, 6989, 6992, 7002, 7019, 7028,
+    7040, 7156, 7168, 7224, 7232, 7242, 7245, 7294,
+    7296, 7297, 7298, 7299, 7302, 7303, 7304, 7305,
+    7312, 7355, 7357, 7360, 7376, 7379, 7380, 7419,
+    7424, 7468, 7469, 7470, 7471, 7472, 7474, 7475,
+    7483, 7484, 7485, 7486, 7487, 7488, 7490, 7491,
+    7492, 7494, 7495, 7496, 7498, 7499, 7501, 7502,
+    7503, 7504, 7505, 7506, 7507, 7508, 7510, 7511,
+    7513, 7514, 7515, 7516, 7517, 7520, 7522, 7523,
+    7524, 7526, 7528, 7529, 7531, 7544, 7545, 7579,
+    7580, 7581, 7582, 7583, 7584, 7585, 7586, 7587,
+    7588, 7591, 7592, 7593, 7594, 7595, 7596, 7597,
+    7598, 7602, 7603, 7605, 7606, 7608, 7609, 7611,
+    7612, 7615, 7616, 7680, 7681, 7682, 7683, 7684,
+    7685, 7686, 7687, 7688, 7689, 7690, 7691, 7692,
+    7693, 7694, 7695, 7696, 7697, 7698, 7699, 7700,
+    7701, 7702, 7703, 7704, 7705, 7706, 7707, 7708,
+    7709, 7710, 7711, 7712, 7713, 7714, 7715, 7716,
+    7717, 7718, 7719, 7720, 7721, 7722, 7723, 7724,
+    7725, 7726, 7727, 7728, 7729, 7730, 7731, 7732,
+    7733, 7734, 7735, 7736, 7737, 7738, 7739, 7740,
+    7741, 7742, 7743, 7744, 7745, 7746, 7747, 7748,
+    7749, 7750, 7751, 7752, 7753, 7754, 7755, 7756,
+    7757, 7758, 7759, 7760, 7761, 7762, 7763, 7764,
+    7765, 7766, 7767, 7768, 7769, 7770, 7771, 7772,
+    7773, 7774, 7775, 7776, 7777, 7778, 7779, 7780,
+    7781, 7782, 7783, 7784, 7785, 7786, 7787, 7788,
+    7789, 7790, 7791, 7792, 7793, 7794, 7795, 7796,
+    7797, 7798, 7799, 7800, 7801, 7802, 7803, 7804,
+    7805, 7806, 7807, 7808, 7809, 7810, 7811, 7812,
+    7813, 7814, 7815, 7816, 7817, 7818, 7819, 7820,
+    7821, 7822, 7823, 7824, 7825, 7826, 7827, 7828,
+    7829, 7834, 7835, 7836, 7838, 7839, 7840, 7841,
+    7842, 7843, 7844, 7845, 7846, 7847, 7848, 7849,
+    7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857,
+    7858, 7859, 7860, 7861, 7862, 7863, 7864, 7865,
+    7866, 7867, 7868, 7869, 7870, 7871, 7872, 7873,
+    7874, 7875, 7876, 7877, 7878, 7879, 7880, 7881,
+    7882, 7883, 7884, 7885, 7886, 7887, 7888, 7889,
+    7890, 7891, 7892, 7893, 7894, 7895, 7896, 7897,
+    7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905,
+    7906, 7907, 7908, 7909, 7910, 7911, 7912, 7913,
+    7914, 7915, 7916, 7917, 7918, 7919, 7920, 7921,
+    7922, 7923, 7924, 7925, 7926, 7927, 7928, 7929,
+    7930, 7931, 7932, 7933, 7934, 7935, 7944, 7952,
+    7958, 7960, 7966, 7968, 7976, 7984, 7992, 8000,
+    8006, 8008, 8014, 8016, 8024, 8025, 8026, 8027,
+    8028, 8029, 8030, 8031, 8032, 8040, 8048, 8049,
+    8050, 8051, 8052, 8053, 8054, 8055, 8056, 8057,
+    8058, 8059, 8060, 8061, 8062, 8064, 8065, 8066,
+    8067, 8068, 8069, 8070, 8071, 8072, 8073, 8074,
+    8075, 8076, 8077, 8078, 8079, 8080, 8081, 8082,
+    8083, 8084, 8085, 8086, 8087, 8088, 8089, 8090,
+    8091, 8092, 8093, 8094, 8095, 8096, 8097, 8098,
+    8099, 8100, 8101, 8102, 8103, 8104, 8105, 8106,
+    8107, 8108, 8109, 8110, 8111, 8112, 8114, 8115,
+    8116, 8117, 8118, 8119, 8120, 8122, 8123, 8124,
+    8125, 8126, 8127, 8130, 8131, 8132, 8133, 8134,
+    8135, 8136, 8137, 8138, 8139, 8140, 8141, 8144,
+    8147, 8148, 8150, 8152, 8154, 8155, 8156, 8160,
+    8163, 8164, 8168, 8170, 8171, 8172, 8173, 8178,
+    8179, 8180, 8181, 8182, 8183, 8184, 8185, 8186,
+    8187, 8188, 8189, 8203, 8204, 8206, 8208, 8228,
+    8229, 8234, 8239, 8288, 8293, 8294, 8304, 8305,
+    8306, 8308, 8314, 8319, 8320, 8330, 8336, 8337,
+    8338, 8339, 8340, 8341, 8342, 8346, 8347, 8349,
+    8360, 8361, 8400, 8433, 8450, 8451, 8455, 8456,
+    8458, 8463, 8464, 8466, 8468, 8469, 8470, 8471,
+    8473, 8478, 8480, 8481, 8482, 8483, 8484, 8485,
+    8486, 8487, 8488, 8489, 8490, 8491, 8492, 8494,
+    8495, 8498, 8499, 8500, 8501, 8505, 8506, 8507,
+    8508, 8509, 8511, 8512, 8517, 8520, 8522, 8526,
+    8527, 8544, 8545, 8546, 8547, 8548, 8549, 8550,
+    8551, 8552, 8553, 8554, 8555, 8556, 8557, 8559,
+    8560, 8561, 8562, 8563, 8564, 8565, 8566, 8567,
+    8568, 8569, 8570, 8571, 8572, 8573, 8575, 8576,
+    8579, 8580, 8585, 9312, 9321, 9322, 9323, 9324,
+    9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332,
+    9398, 9424, 9450, 9451, 9472, 10102, 10132, 11264,
+    11312, 11360, 11361, 11362, 11363, 11364, 11365, 11367,
+    11368, 11369, 11370, 11371, 11372, 11373, 11374, 11375,
+    11376, 11377, 11378, 11379, 11381, 11382, 11388, 11389,
+    11390, 11392, 11393, 11394, 11395, 11396, 11397, 11398,
+    11399, 11400, 11401, 11402, 11403, 11404, 11405, 11406,
+    11407, 11408, 11409, 11410, 11411, 11412, 11413, 11414,
+    11415, 11416, 11417, 11418, 11419, 11420, 11421, 11422,
+    11423, 11424, 11425, 11426, 11427, 11428, 11429, 11430,
+    11431, 11432, 11433, 11434, 11435, 11436, 11437, 11438,
+    11439, 11440, 11441, 11442, 11443, 11444, 11445, 11446,
+    11447, 11448, 11449, 11450, 11451, 11452, 11453, 11454,
+    11455, 11456, 11457, 11458, 11459, 11460, 11461, 11462,
+    11463, 11464, 11465, 11466, 11467, 11468, 11469, 11470,
+    11471, 11472, 11473, 11474, 11475, 11476, 11477, 11478,
+    11479, 11480, 11481, 11482, 11483, 11484, 11485, 11486,
+    11487, 11488, 11489, 11490, 11491, 11493, 11499, 11500,
+    11501, 11502, 11506, 11507, 11508, 11517, 11518, 11520,
+    11558, 11559, 11560, 11565, 11566, 11568, 11624, 11631,
+    11632, 11647, 11671, 11680, 11687, 11688, 11695, 11696,
+    11703, 11704, 11711, 11712, 11719, 11720, 11727, 11728,
+    11735, 11736, 11743, 11744, 11776, 11823, 11824, 11935,
+    11936, 12019, 12020, 12032, 12033, 12034, 12035, 12036,
+    12037, 12038, 12039, 12040, 12041, 12042, 12043, 12044,
+    12045, 12046, 12047, 12048, 12049, 12050, 12051, 12052,
+    12053, 12054, 12055, 12056, 12057, 12058, 12059, 12060,
+    12061, 12062, 12063, 12064, 12065, 12066, 12067, 12068,
+    12069, 12070, 12071, 12072, 12073, 12074, 12075, 12076,
+    12077, 12078, 12079, 12080, 12081, 12082, 12083, 12084,
+    12085, 12086, 12087, 12088, 12089, 12090, 12091, 12092,
+    12093, 12094, 12095, 12096, 12097, 12098, 12099, 12100,
+    12101, 12102, 12103, 12104, 12105, 12106, 12107, 12108,
+    12109, 12110, 12111, 12112, 12113, 12114, 12115, 12116,
+    12117, 12118, 12119, 12120, 12121, 12122, 12123, 12124,
+    12125, 12126, 12127, 12128, 12129, 12130, 12131, 12132,
+    12133, 12134, 12135, 12136, 12137, 12138, 12139, 12140,
+    12141, 12142, 12143, 12144, 12145, 12146, 12147, 12148,
+    12149, 12150, 12151, 12152, 12153, 12154, 12155, 12156,
+    12157, 12158, 12159, 12160, 12161, 12162, 12163, 12164,
+    12165, 12166, 12167, 12168, 12169, 12170, 12171, 12172,
+    12173, 12174, 12175, 12176, 12177, 12178, 12179, 12180,
+    12181, 12182, 12183, 12184, 12185, 12186, 12187, 12188,
+    12189, 12190, 12191, 12192, 12193, 12194, 12195, 12196,
+    12197, 12198, 12199, 12200, 12201, 12202, 12203, 12204,
+    12205, 12206, 12207, 12208, 12209, 12210, 12211, 12212,
+    12213, 12214, 12215, 12216, 12217, 12218, 12219, 12220,
+    12221, 12222, 12223, 12224, 12225, 12226, 12227, 12228,
+    12229, 12230, 12231, 12232, 12233, 12234, 12235, 12236,
+    12237, 12238, 12239, 12240, 12241, 12242, 12243, 12244,
+    12245, 12246, 12290, 12291, 12293, 12296, 12321, 12336,
+    12337, 12342, 12344, 12345, 12347, 12349, 12353, 12439,
+    12441, 12443, 12445, 12447, 12448, 12449, 12539, 12540,
+    12543, 12544, 12549, 12592, 12593, 12595, 12596, 12597,
+    12599, 12602, 12608, 12609, 12612, 12613, 12623, 12644,
+    12645, 12647, 12649, 12650, 12651, 12652, 12653, 12654,
+    12655, 12656, 12657, 12659, 12660, 12662, 12663, 12664,
+    12669, 12670, 12671, 12672, 12673, 12674, 12676, 12679,
+    12681, 12682, 12684, 12685, 12686, 12687, 12690, 12691,
+    12692, 12693, 12694, 12695, 12696, 12697, 12698, 12699,
+    12700, 12701, 12702, 12703, 12704, 12736, 12784, 12800,
+    12868, 12869, 12870, 12871, 12872, 12880, 12881, 12882,
+    12883, 12884, 12885, 12886, 12887, 12888, 12889, 12890,
+    12891, 12892, 12893, 12894, 12895, 12896, 12897, 12899,
+    12902, 12903, 12905, 12910, 12911, 12912, 12913, 12914,
+    12915, 12916, 12917, 12918, 12919, 12920, 12921, 12922,
+    12923, 12924, 12925, 12926, 12927, 12928, 12929, 12930,
+    12931, 12932, 12933, 12934, 12935, 12936, 12937, 12938,
+    12939, 12940, 12941, 12942, 12943, 12944, 12945, 12946,
+    12947, 12948, 12949, 12950, 12951, 12952, 12953, 12954,
+    12955, 12956, 12957, 12958, 12959, 12960, 12961, 12962,
+    12963, 12964, 12965, 12966, 12967, 12968, 12969, 12970,
+    12971, 12972, 12973, 12974, 12975, 12976, 12977, 12978,
+    12979, 12980, 12981, 12982, 12983, 12984, 12985, 12986,
+    12987, 12988, 12989, 12990, 12991, 12992, 12993, 12994,
+    12995, 12996, 12997, 12998, 12999, 13000, 13001, 13002,
+    13003, 13004, 13005, 13006, 13007, 13008, 13009, 13010,
+    13011, 13012, 13014, 13015, 13016, 13017, 13018, 13019,
+    13020, 13021, 13022, 13023, 13024, 13025, 13026, 13027,
+    13028, 13034, 13035, 13036, 13037, 13038, 13043, 13044,
+    13045, 13051, 13055, 13056, 13057, 13058, 13059, 13060,
+    13061, 13062, 13063, 13064, 13065, 13066, 13067, 13068,
+    13069, 13070, 13071, 13072, 13073, 13074, 13075, 13076,
+    13077, 13078, 13079, 13080, 13081, 13082, 13083, 13084,
+    13085, 13086, 13087, 13088, 13089, 13090, 13091, 13092,
+    13093, 13094, 13095, 13096, 13097, 13098, 13099, 13100,
+    13101, 13102, 13103, 13104, 13105, 13106, 13107, 13108,
+    13109, 13110, 13111, 13112, 13113, 13114, 13115, 13116,
+    13117, 13118, 13119, 13120, 13121, 13122, 13123, 13124,
+    13125, 13126, 13127, 13128, 13129, 13130, 13131, 13132,
+    13133, 13134, 13135, 13136, 13137, 13138, 13139, 13140,
+    13141, 13142, 13143, 13144, 13145, 13146, 13147, 13148,
+    13149, 13150, 13151, 13152, 13153, 13154, 13155, 13156,
+    13157, 13158, 13159, 13160, 13161, 13162, 13163, 13164,
+    13165, 13166, 13167, 13168, 13169, 13170, 13171, 13172,
+    13173, 13174, 13175, 13176, 13177, 13178, 13179, 13180,
+    13181, 13182, 13183, 13184, 13185, 13186, 13187, 13188,
+    13189, 13190, 13191, 13192, 13193, 13194, 13195, 13196,
+    13197, 13198, 13199, 13200, 13201, 13202, 13203, 13204,
+    13205, 13206, 13207, 13208, 13209, 13210, 13211, 13212,
+    13213, 13214, 13215, 13216, 13217, 13218, 13219, 13220,
+    13221, 13222, 13223, 13225, 13226, 13227, 13228, 13229,
+    13230, 13232, 13233, 13234, 13235, 13236, 13237, 13238,
+    13239, 13240, 13241, 13242, 13243, 13244, 13245, 13246,
+    13247, 13248, 13249, 13250, 13251, 13252, 13253, 13254,
+    13256, 13257, 13258, 13259, 13260, 13261, 13262, 13263,
+    13264, 13265, 13266, 13267, 13268, 13269, 13270, 13271,
+    13272, 13273, 13274, 13275, 13276, 13277, 13278, 13280,
+    13281, 13282, 13283, 13284, 13285, 13286, 13287, 13288,
+    13289, 13290, 13291, 13292, 13293, 13294, 13295, 13296,
+    13297, 13298, 13299, 13300, 13301, 13302, 13303, 13304,
+    13305, 13306, 13307, 13308, 13309, 13310, 13311, 13312,
+    19904, 19968, 42125, 42192, 42238, 42240, 42509, 42512,
+    42540, 42560, 42561, 42562, 42563, 42564, 42565, 42566,
+    42567, 42568, 42569, 42570, 42571, 42572, 42573, 42574,
+    42575, 42576, 42577, 42578, 42579, 42580, 42581, 42582,
+    42583, 42584, 42585, 42586, 42587, 42588, 42589, 42590,
+    42591, 42592, 42593, 42594, 42595, 42596, 42597, 42598,
+    42599, 42600, 42601, 42602, 42603, 42604, 42605, 42611,
+    42612, 42622, 42623, 42624, 42625, 42626, 42627, 42628,
+    42629, 42630, 42631, 42632, 42633, 42634, 42635, 42636,
+    42637, 42638, 42639, 42640, 42641, 42642, 42643, 42644,
+    42645, 42646, 42647, 42648, 42649, 42650, 42651, 42652,
+    42653, 42654, 42738, 42775, 42784, 42786, 42787, 42788,
+    42789, 42790, 42791, 42792, 42793, 42794, 42795, 42796,
+    42797, 42798, 42799, 42802, 42803, 42804, 42805, 42806,
+    42807, 42808, 42809, 42810, 42811, 42812, 42813, 42814,
+    42815, 42816, 42817, 42818, 42819, 42820, 42821, 42822,
+    42823, 42824, 42825, 42826, 42827, 42828, 42829, 42830,
+    42831, 42832, 42833, 42834, 42835, 42836, 42837, 42838,
+    42839, 42840, 42841, 42842, 42843, 42844, 42845, 42846,
+    42847, 42848, 42849, 42850, 42851, 42852, 42853, 42854,
+    42855, 42856, 42857, 42858, 42859, 42860, 42861, 42862,
+    42863, 42864, 42865, 42873, 42874, 42875, 42876, 42877,
+    42878, 42879, 42880, 42881, 42882, 42883, 42884, 42885,
+    42886, 42887, 42889, 42891, 42892, 42893, 42894, 42896,
+    42897, 42898, 42899, 42902, 42903, 42904, 42905, 42906,
+    42907, 42908, 42909, 42910, 42911, 42912, 42913, 42914,
+    42915, 42916, 42917, 42918, 42919, 42920, 42921, 42922,
+    42923, 42924, 42925, 42926, 42927, 42928, 42929, 42930,
+    42931, 42932, 42933, 42934, 42935, 42936, 42937, 42938,
+    42939, 42940, 42941, 42942, 42943, 42944, 42945, 42946,
+    42947, 42948, 42949, 42950, 42951, 42952, 42953, 42954,
+    42955, 42960, 42961, 42962, 42963, 42964, 42965, 42966,
+    42967, 42968, 42969, 42970, 42994, 42995, 42996, 42997,
+    42998, 43000, 43001, 43002, 43048, 43052, 43053, 43056,
+    43062, 43072, 43124, 43136, 43206, 43216, 43226, 43232,
+    43256, 43259, 43260, 43261, 43310, 43312, 43348, 43360,
+    43389, 43392, 43457, 43471, 43482, 43488, 43519, 43520,
+    43575, 43584, 43598, 43600, 43610, 43616, 43639, 43642,
+    43715, 43739, 43742, 43744, 43760, 43762, 43767, 43777,
+    43783, 43785, 43791, 43793, 43799, 43808, 43815, 43816,
+    43823, 43824, 43867, 43868, 43869, 43870, 43871, 43872,
+    43881, 43882, 43888, 43968, 44011, 44012, 44014, 44016,
+    44026, 44032, 55204, 55216, 55239, 55243, 55292, 63744,
+    63745, 63746, 63747, 63748, 63749, 63750, 63751, 63753,
+    63754, 63755, 63756, 63757, 63758, 63759, 63760, 63761,
+    63762, 63763, 63764, 63765, 63766, 63767, 63768, 63769,
+    63770, 63771, 63772, 63773, 63774, 63775, 63776, 63777,
+    63778, 63779, 63780, 63781, 63782, 63783, 63784, 63785,
+    63786, 63787, 63788, 63789, 63790, 63791, 63792, 63793,
+    63794, 63795, 63796, 63797, 63798, 63799, 63800, 63801,
+    63802, 63803, 63804, 63805, 63806, 63807, 63808, 63809,
+    63810, 63811, 63812, 63813, 63814, 63815, 63816, 63817,
+    63818, 63819, 63820, 63821, 63822, 63823, 63824, 63825,
+    63826, 63827, 63828, 63829, 63830, 63831, 63832, 63833,
+    63834, 63835, 63836, 63837, 63838, 63839, 63840, 63841,
+    63842, 63843, 63844, 63845, 63846, 63847, 63848, 63849,
+    63850, 63851, 63852, 63853, 63854, 63855, 63856, 63857,
+    63858, 63859, 63860, 63861, 63862, 63863, 63864, 63865,
+    63866, 63867, 63868, 63869, 63870, 63871, 63872, 63873,
+    63874, 63875, 63876, 63877, 63878, 63879, 63880, 63881,
+    63882, 63883, 63884, 63885, 63886, 63887, 63888, 63889,
+    63890, 63891, 63892, 63893, 63894, 63895, 63896, 63897,
+    63898, 63899, 63900, 63901, 63902, 63903, 63904, 63905,
+    63906, 63907, 63908, 63909, 63910, 63911, 63912, 63913,
+    63914, 63915, 63916, 63917, 63918, 63919, 63920, 63921,
+    63922, 63923, 63924, 63925, 63926, 63927, 63928, 63929,
+    63930, 63931, 63932, 63933, 63934, 63935, 63936, 63937,
+    63938, 63939, 63940, 63941, 63942, 63943, 63944, 63945,
+    63946, 63947, 63948, 63949, 63950, 63951, 63952, 63953,
+    63954, 63955, 63956, 63957, 63958, 63959, 63960, 63961,
+    63962, 63963, 63964, 63965, 63966, 63967, 63968, 63969,
+    63970, 63971, 63972, 63973, 63974, 63975, 63976, 63977,
+    63978, 63979, 63980, 63981, 63982, 63983, 63984, 63985,
+    63986, 63987, 63988, 63989, 63990, 63991, 63992, 63993,
+    63994, 63995, 63996, 63997, 63998, 63999, 64000, 64001,
+    64002, 64003, 64004, 64005, 64006, 64007, 64008, 64009,
+    64010, 64011, 64012, 64013, 64014, 64016, 64017, 64018,
+    64019, 64021, 64022, 64023, 64024, 64025, 64026, 64027,
+    64028, 64029, 64030, 64031, 64032, 64033, 64034, 64035,
+    64037, 64038, 64039, 64042, 64043, 64044, 64045, 64046,
+    64047, 64048, 64049, 64050, 64051, 64052, 64053, 64054,
+    64055, 64056, 64057, 64058, 64059, 64060, 64061, 64062,
+    64063, 64064, 64065, 64066, 64067, 64068, 64069, 64070,
+    64071, 64072, 64073, 64074, 64075, 64076, 64077, 64078,
+    64079, 64080, 64081, 64082, 64084, 64085, 64086, 64087,
+    64088, 64089, 64090, 64091, 64092, 64093, 64095, 64096,
+    64097, 64098, 64099, 64100, 64101, 64102, 64103, 64104,
+    64105, 64106, 64107, 64108, 64109, 64110, 64112, 64113,
+    64114, 64115, 64116, 64117, 64118, 64119, 64120, 64121,
+    64122, 64123, 64124, 64125, 64126, 64127, 64128, 64129,
+    64130, 64131, 64132, 64133, 64134, 64135, 64136, 64137,
+    64138, 64139, 64140, 64141, 64142, 64143, 64144, 64145,
+    64146, 64147, 64148, 64149, 64150, 64151, 64152, 64153,
+    64154, 64155, 64156, 64157, 64158, 64159, 64160, 64161,
+    64162, 64163, 64164, 64165, 64166, 64167, 64168, 64169,
+    64170, 64171, 64172, 64173, 64174, 64175, 64176, 64177,
+    64178, 64179, 64180, 64181, 64182, 64183, 64184, 64185,
+    64186, 64187, 64188, 64189, 64190, 64191, 64192, 64193,
+    64194, 64195, 64196, 64197, 64198, 64199, 64200, 64201,
+    64202, 64203, 64204, 64205, 64206, 64207, 64208, 64209,
+    64210, 64211, 64212, 64213, 64214, 64215, 64216, 64217,
+    64218, 64256, 64257, 64258, 64259, 64260, 64261, 64263,
+    64275, 64276, 64277, 64278, 64279, 64280, 64285, 64286,
+    64287, 64288, 64289, 64290, 64292, 64295, 64296, 64297,
+    64298, 64299, 64300, 64301, 64302, 64303, 64304, 64305,
+    64306, 64307, 64308, 64309, 64310, 64311, 64312, 64313,
+    64314, 64315, 64316, 64317, 64318, 64319, 64320, 64321,
+    64322, 64323, 64324, 64325, 64326, 64327, 64328, 64329,
+    64330, 64331, 64332, 64333, 64334, 64335, 64336, 64338,
+    64342, 64346, 64350, 64354, 64358, 64362, 64366, 64370,
+    64374, 64378, 64386, 64388, 64390, 64392, 64394, 64396,
+    64398, 64402, 64406, 64410, 64414, 64420, 64426, 64430,
+    64434, 64467, 64471, 64473, 64475, 64477, 64478, 64480,
+    64482, 64484, 64488, 64490, 64492, 64494, 64496, 64498,
+    64500, 64502, 64505, 64508, 64512, 64513, 64514, 64515,
+    64516, 64517, 64518, 64519, 64520, 64521, 64522, 64523,
+    64524, 64525, 64526, 64527, 64528, 64529, 64530, 64531,
+    64532, 64533, 64534, 64535, 64536, 64537, 64538, 64539,
+    64540, 64541, 64542, 64543, 64544, 64545, 64546, 64547,
+    64548, 64549, 64550, 64551, 64552, 64553, 64554, 64555,
+    64556, 64557, 64558, 64559, 64560, 64561, 64562, 64563,
+    64564, 64565, 64566, 64567, 64568, 64569, 64570, 64571,
+    64572, 64573, 64574, 64575, 64576, 64577, 64578, 64579,
+    64580, 64581, 64582, 64583, 64584, 64585, 64586, 64587,
+    64588, 64589, 64590, 64591, 64592, 64593, 64594, 64595,
+    64596, 64597, 64598, 64599, 64600, 64601, 64602, 64603,
+    64604, 64605, 64606, 64612, 64613, 64614, 64615, 64616,
+    64617, 64618, 64619, 64620, 64621, 64622, 64623, 64624,
+    64625, 64626, 64627, 64628, 64629, 64630, 64631, 64632,
+    64633, 64634, 64635, 64636, 64637, 64638, 64639, 64640,
+    64641, 64642, 64643, 64644, 64645, 64646, 64647, 64648,
+    64649, 64650, 64651, 64652, 64653, 64654, 64655, 64656,
+    64657, 64658, 64659, 64660, 64661, 64662, 64663, 64664,
+    64665, 64666, 64667, 64668, 64669, 64670, 64671, 64672,
+    64673, 64674, 64675, 64676, 64677, 64678, 64679, 64680,
+    64681, 64682, 64683, 64684, 64685, 64686, 64687, 64688,
+    64689, 64690, 64691, 64692, 64693, 64694, 64695, 64696,
+    64697, 64698, 64699, 64700, 64701, 64702, 64703, 64704,
+    64705, 64706, 64707, 64708, 64709, 64710, 64711, 64712,
+    64713, 64714, 64715, 64716, 64717, 64718, 64719, 64720,
+    64721, 64722, 64723, 64724, 64725, 64726, 64727, 64728,
+    64729, 64730, 64731, 64732, 64733, 64734, 64735, 64736,
+    64737, 64738, 64739, 64740, 64741, 64742, 64743, 64744,
+    64745, 64746, 64747, 64748, 64749, 64750, 64751, 64752,
+    64753, 64754, 64755, 64756, 64757, 64758, 64759, 64760,
+    64761, 64762, 64763, 64764, 64765, 64766, 64767, 64768,
+    64769, 64770, 64771, 64772, 64773, 64774, 64775, 64776,
+    64777, 64778, 64779, 64780, 64781, 64782, 64783, 64784,
+    64785, 64786, 64787, 64788, 64789, 64790, 64791, 64792,
+    64793, 64794, 64795, 64796, 64797, 64798, 64799, 64800,
+    64801, 64802, 64803, 64804, 64805, 64806, 64807, 64808,
+    64809, 64810, 64811, 64812, 64813, 64814, 64815, 64816,
+    64817, 64818, 64819, 64820, 64821, 64822, 64823, 64824,
+    64825, 64826, 64827, 64828, 64830, 64848, 64849, 64851,
+    64852, 64853, 64854, 64855, 64856, 64858, 64859, 64860,
+    64861, 64862, 64863, 64865, 64866, 64868, 64870, 64871,
+    64873, 64874, 64876, 64878, 64879, 64881, 64883, 64884,
+    64885, 64886, 64888, 64889, 64890, 64891, 64892, 64894,
+    64895, 64896, 64897, 64898, 64899, 64901, 64903, 64905,
+    64906, 64907, 64908, 64909, 64910, 64911, 64912, 64914,
+    64915, 64916, 64917, 64918, 64919, 64921, 64922, 64923,
+    64924, 64926, 64927, 64928, 64929, 64930, 64931, 64932,
+    64933, 64934, 64935, 64936, 64937, 64938, 64939, 64940,
+    64941, 64942, 64943, 64944, 64945, 64946, 64947, 64948,
+    64949, 64950, 64951, 64952, 64953, 64954, 64955, 64956,
+    64957, 64958, 64959, 64960, 64961, 64962, 64963, 64964,
+    64965, 64966, 64967, 64968, 65008, 65009, 65010, 65011,
+    65012, 65013, 65014, 65015, 65016, 65017, 65018, 65020,
+    65021, 65024, 65040, 65056, 65072, 65106, 65107, 65123,
+    65124, 65137, 65138, 65139, 65140, 65143, 65144, 65145,
+    65146, 65147, 65148, 65149, 65150, 65151, 65152, 65233,
+    65269, 65271, 65273, 65275, 65277, 65279, 65280, 65293,
+    65295, 65296, 65306, 65313, 65339, 65345, 65371, 65377,
+    65378, 65382, 65383, 65384, 65385, 65386, 65387, 65388,
+    65389, 65390, 65391, 65392, 65393, 65394, 65395, 65396,
+    65397, 65399, 65400, 65401, 65402, 65403, 65404, 65405,
+    65406, 65407, 65408, 65409, 65410, 65411, 65412, 65413,
+    65419, 65420, 65421, 65422, 65423, 65428, 65429, 65430,
+    65436, 65437, 65438, 65440, 65441, 65443, 65444, 65445,
+    65447, 65450, 65456, 65457, 65460, 65461, 65471, 65474,
+    65480, 65482, 65488, 65490, 65496, 65498, 65501, 65536,
+    65548, 65549, 65575, 65576, 65595, 65596, 65598, 65599,
+    65614, 65616, 65630, 65664, 65787, 65799, 65844, 65856,
+    65913, 65930, 65932, 66045, 66046, 66176, 66205, 66208,
+    66257, 66272, 66300, 66304, 66340, 66349, 66379, 66384,
+    66427, 66432, 66462, 66464, 66500, 66504, 66512, 66513,
+    66518, 66560, 66600, 66718, 66720, 66730, 66736, 66772,
+    66776, 66812, 66816, 66856, 66864, 66916, 66928, 66939,
+    66940, 66955, 66956, 66963, 66964, 66966, 66967, 66978,
+    66979, 66994, 66995, 67002, 67003, 67005, 67072, 67383,
+    67392, 67414, 67424, 67432, 67456, 67457, 67459, 67460,
+    67461, 67462, 67463, 67464, 67465, 67466, 67467, 67469,
+    67470, 67471, 67472, 67473, 67474, 67475, 67476, 67477,
+    67478, 67479, 67480, 67481, 67483, 67484, 67485, 67486,
+    67487, 67488, 67489, 67490, 67491, 67493, 67494, 67495,
+    67496, 67498, 67499, 67500, 67501, 67502, 67503, 67504,
+    67505, 67506, 67507, 67509, 67510, 67513, 67514, 67515,
+    67584, 67590, 67592, 67593, 67594, 67638, 67639, 67641,
+    67644, 67645, 67647, 67670, 67672, 67703, 67705, 67743,
+    67751, 67760, 67808, 67827, 67828, 67830, 67835, 67868,
+    67872, 67898, 67968, 68024, 68028, 68048, 68050, 68100,
+    68101, 68103, 68108, 68116, 68117, 68120, 68121, 68150,
+    68152, 68155, 68159, 68169, 68192, 68223, 68224, 68256,
+    68288, 68296, 68297, 68327, 68331, 68336, 68352, 68406,
+    68416, 68438, 68440, 68467, 68472, 68498, 68521, 68528,
+    68608, 68681, 68736, 68787, 68800, 68851, 68858, 68904,
+    68912, 68922, 69216, 69247, 69248, 69290, 69291, 69293,
+    69296, 69298, 69376, 69416, 69424, 69461, 69488, 69510,
+    69552, 69580, 69600, 69623, 69632, 69703, 69714, 69750,
+    69759, 69819, 69826, 69827, 69840, 69865, 69872, 69882,
+    69888, 69941, 69942, 69952, 69956, 69960, 69968, 70004,
+    70006, 70007, 70016, 70085, 70089, 70093, 70094, 70107,
+    70108, 70109, 70113, 70133, 70144, 70162, 70163, 70200,
+    70206, 70207, 70272, 70279, 70280, 70281, 70282, 70286,
+    70287, 70302, 70303, 70313, 70320, 70379, 70384, 70394,
+    70400, 70404, 70405, 70413, 70415, 70417, 70419, 70441,
+    70442, 70449, 70450, 70452, 70453, 70458, 70459, 70469,
+    70471, 70473, 70475, 70478, 70480, 70481, 70487, 70488,
+    70493, 70500, 70502, 70509, 70512, 70517, 70656, 70731,
+    70736, 70746, 70750, 70754, 70784, 70854, 70855, 70856,
+    70864, 70874, 71040, 71094, 71096, 71105, 71128, 71134,
+    71168, 71233, 71236, 71237, 71248, 71258, 71296, 71353,
+    71360, 71370, 71424, 71451, 71453, 71468, 71472, 71484,
+    71488, 71495, 71680, 71739, 71840, 71872, 71923, 71935,
+    71943, 71945, 71946, 71948, 71956, 71957, 71959, 71960,
+    71990, 71991, 71993, 71995, 72004, 72016, 72026, 72096,
+    72104, 72106, 72152, 72154, 72162, 72163, 72165, 72192,
+    72255, 72263, 72264, 72272, 72346, 72349, 72350, 72368,
+    72441, 72704, 72713, 72714, 72759, 72760, 72769, 72784,
+    72813, 72818, 72848, 72850, 72872, 72873, 72887, 72960,
+    72967, 72968, 72970, 72971, 73015, 73018, 73019, 73020,
+    73022, 73023, 73032, 73040, 73050, 73056, 73062, 73063,
+    73065, 73066, 73103, 73104, 73106, 73107, 73113, 73120,
+    73130, 73440, 73463, 73648, 73649, 73664, 73685, 73728,
+    74650, 74752, 74863, 74880, 75076, 77712, 77809, 77824,
+    78895, 82944, 83527, 92160, 92729, 92736, 92767, 92768,
+    92778, 92784, 92863, 92864, 92874, 92880, 92910, 92912,
+    92917, 92928, 92983, 92992, 92996, 93008, 93018, 93019,
+    93026, 93027, 93048, 93053, 93072, 93760, 93792, 93847,
+    93952, 94027, 94031, 94088, 94095, 94112, 94176, 94178,
+    94179, 94181, 94192, 94194, 94208, 100344, 100352, 101590,
+    101632, 101641, 110576, 110580, 110581, 110588, 110589, 110591,
+    110592, 110883, 110928, 110931, 110948, 110952, 110960, 111356,
+    113664, 113771, 113776, 113789, 113792, 113801, 113808, 113818,
+    113821, 113823, 113824, 113828, 118528, 118574, 118576, 118599,
+    119141, 119146, 119149, 119155, 119163, 119171, 119173, 119180,
+    119210, 119214, 119362, 119365, 119520, 119540, 119648, 119673,
+    119808, 119834, 119860, 119886, 119893, 119894, 119912, 119938,
+    119964, 119965, 119966, 119968, 119970, 119971, 119973, 119975,
+    119977, 119981, 119982, 119990, 119994, 119995, 119996, 119997,
+    120004, 120005, 120016, 120042, 120068, 120070, 120071, 120075,
+    120077, 120085, 120086, 120093, 120094, 120120, 120122, 120123,
+    120127, 120128, 120133, 120134, 120135, 120138, 120145, 120146,
+    120172, 120198, 120224, 120250, 120276, 120302, 120328, 120354,
+    120380, 120406, 120432, 120458, 120484, 120485, 120486, 120488,
+    120505, 120506, 120513, 120514, 120531, 120539, 120540, 120541,
+    120542, 120543, 120544, 120545, 120546, 120563, 120564, 120571,
+    120572, 120589, 120597, 120598, 120599, 120600, 120601, 120602,
+    120603, 120604, 120621, 120622, 120629, 120630, 120647, 120655,
+    120656, 120657, 120658, 120659, 120660, 120661, 120662, 120679,
+    120680, 120687, 120688, 120705, 120713, 120714, 120715, 120716,
+    120717, 120718, 120719, 120720, 120737, 120738, 120745, 120746,
+    120763, 120771, 120772, 120773, 120774, 120775, 120776, 120777,
+    120778, 120780, 120782, 120792, 120802, 120812, 120822, 120832,
+    121344, 121399, 121403, 121453, 121461, 121462, 121476, 121477,
+    121499, 121504, 121505, 121520, 122624, 122655, 122880, 122887,
+    122888, 122905, 122907, 122914, 122915, 122917, 122918, 122923,
+    123136, 123181, 123184, 123198, 123200, 123210, 123214, 123215,
+    123536, 123567, 123584, 123642, 124896, 124903, 124904, 124908,
+    124909, 124911, 124912, 124927, 124928, 125125, 125127, 125143,
+    125184, 125218, 125260, 125264, 125274, 126065, 126124, 126125,
+    126128, 126129, 126133, 126209, 126254, 126255, 126270, 126464,
+    126466, 126467, 126468, 126469, 126470, 126471, 126472, 126473,
+    126474, 126478, 126479, 126480, 126481, 126482, 126483, 126484,
+    126485, 126487, 126488, 126489, 126490, 126491, 126492, 126493,
+    126494, 126495, 126496, 126497, 126498, 126499, 126500, 126501,
+    126503, 126504, 126505, 126506, 126510, 126511, 126512, 126513,
+    126514, 126515, 126516, 126517, 126519, 126520, 126521, 126522,
+    126523, 126524, 126530, 126531, 126535, 126536, 126537, 126538,
+    126539, 126540, 126541, 126542, 126543, 126544, 126545, 126546,
+    126547, 126548, 126549, 126551, 126552, 126553, 126554, 126555,
+    126556, 126557, 126558, 126559, 126560, 126561, 126562, 126563,
+    126564, 126565, 126567, 126568, 126569, 126570, 126571, 126572,
+    126574, 126575, 126576, 126577, 126578, 126579, 126580, 126581,
+    126583, 126584, 126585, 126586, 126587, 126588, 126589, 126590,
+    126591, 126592, 126594, 126595, 126596, 126598, 126599, 126600,
+    126601, 126602, 126603, 126606, 126607, 126608, 126609, 126610,
+    126611, 126612, 126613, 126615, 126616, 126617, 126618, 126619,
+    126620, 126625, 126626, 126627, 126628, 126629, 126630, 126631,
+    126632, 126633, 126634, 126635, 126638, 126639, 126640, 126641,
+    126642, 126643, 126644, 126645, 126647, 126648, 126649, 126650,
+    126651, 126652, 127243, 127245, 127275, 127276, 127277, 127278,
+    127279, 127280, 127306, 127307, 127308, 127309, 127310, 127311,
+    127312, 127338, 127339, 127340, 127341, 127376, 127377, 127488,
+    127489, 127490, 127491, 127504, 127505, 127506, 127507, 127508,
+    127509, 127510, 127511, 127512, 127513, 127514, 127515, 127516,
+    127517, 127518, 127519, 127520, 127521, 127522, 127523, 127524,
+    127525, 127526, 127527, 127528, 127529, 127530, 127531, 127532,
+    127533, 127534, 127535, 127536, 127537, 127538, 127539, 127540,
+    127541, 127542, 127543, 127544, 127545, 127546, 127547, 127548,
+    127568, 127569, 127570, 130032, 130042, 131072, 173792, 173824,
+    177977, 177984, 178206, 178208, 183970, 183984, 191457, 194560,
+    194561, 194562, 194563, 194564, 194565, 194566, 194567, 194568,
+    194569, 194570, 194571, 194572, 194573, 194574, 194575, 194576,
+    194577, 194578, 194579, 194580, 194581, 194582, 194583, 194584,
+    194585, 194586, 194587, 194588, 194589, 194590, 194591, 194592,
+    194593, 194594, 194595, 194596, 194597, 194598, 194599, 194600,
+    194601, 194603, 194604, 194605, 194606, 194607, 194608, 194609,
+    194612, 194613, 194614, 194615, 194616, 194617, 194618, 194619,
+    194620, 194621, 194622, 194623, 194624, 194625, 194626, 194627,
+    194628, 194629, 194631, 194632, 194633, 194634, 194635, 194636,
+    194637, 194638, 194639, 194640, 194641, 194642, 194643, 194644,
+    194645, 194646, 194647, 194648, 194649, 194650, 194651, 194652,
+    194653, 194654, 194655, 194656, 194657, 194658, 194659, 194660,
+    194661, 194662, 194663, 194664, 194665, 194666, 194668, 194669,
+    194670, 194671, 194672, 194673, 194674, 194675, 194676, 194677,
+    194678, 194679, 194680, 194681, 194682, 194683, 194684, 194685,
+    194686, 194687, 194688, 194689, 194691, 194692, 194693, 194694,
+    194695, 194696, 194697, 194698, 194699, 194700, 194701, 194702,
+    194703, 194704, 194705, 194707, 194708, 194710, 194711, 194712,
+    194713, 194714, 194715, 194716, 194717, 194718, 194719, 194720,
+    194721, 194722, 194723, 194724, 194725, 194726, 194727, 194728,
+    194729, 194730, 194731, 194732, 194733, 194734, 194735, 194736,
+    194737, 194738, 194739, 194740, 194741, 194742, 194743, 194744,
+    194745, 194746, 194747, 194748, 194749, 194750, 194751, 194752,
+    194753, 194754, 194755, 194756, 194757, 194758, 194759, 194760,
+    194761, 194762, 194763, 194764, 194765, 194766, 194767, 194768,
+    194769, 194770, 194771, 194772, 194773, 194774, 194775, 194776,
+    194777, 194778, 194779, 194780, 194781, 194782, 194783, 194784,
+    194785, 194786, 194787, 194788, 194789, 194790, 194791, 194792,
+    194793, 194794, 194795, 194796, 194797, 194798, 194799, 194800,
+    194801, 194802, 194803, 194804, 194805, 194807, 194808, 194809,
+    194810, 194811, 194812, 194813, 194814, 194815, 194816, 194817,
+    194818, 194819, 194820, 194821, 194822, 194823, 194824, 194825,
+    194826, 194827, 194828, 194829, 194830, 194831, 194832, 194833,
+    194834, 194835, 194836, 194837, 194838, 194839, 194840, 194841,
+    194842, 194843, 194844, 194845, 194846, 194847, 194848, 194849,
+    194850, 194851, 194852, 194853, 194854, 194855, 194856, 194857,
+    194858, 194859, 194860, 194862, 194863, 194864, 194865, 194866,
+    194867, 194868, 194869, 194870, 194871, 194872, 194873, 194874,
+    194875, 194876, 194877, 194878, 194879, 194880, 194881, 194882,
+    194883, 194884, 194885, 194888, 194889, 194890, 194891, 194892,
+    194893, 194894, 194895, 194896, 194897, 194898, 194899, 194900,
+    194901, 194902, 194903, 194904, 194905, 194906, 194907, 194908,
+    194909, 194911, 194912, 194913, 194914, 194915, 194916, 194917,
+    194918, 194919, 194920, 194921, 194922, 194923, 194924, 194925,
+    194926, 194927, 194928, 194929, 194930, 194931, 194932, 194933,
+    194934, 194935, 194936, 194937, 194938, 194939, 194940, 194941,
+    194942, 194943, 194944, 194945, 194946, 194947, 194948, 194949,
+    194950, 194951, 194952, 194953, 194954, 194955, 194956, 194957,
+    194958, 194959, 194960, 194961, 194962, 194963, 194964, 194965,
+    194966, 194967, 194968, 194969, 194970, 194971, 194972, 194973,
+    194974, 194975, 194976, 194977, 194978, 194979, 194980, 194981,
+    194982, 194983, 194984, 194985, 194986, 194987, 194988, 194989,
+    194990, 194991, 194992, 194993, 194994, 194995, 194996, 194997,
+    194998, 194999, 195000, 195001, 195002, 195003, 195004, 195005,
+    195006, 195007, 195008, 195009, 195010, 195011, 195012, 195013,
+    195014, 195015, 195016, 195017, 195018, 195019, 195020, 195021,
+    195022, 195023, 195024, 195025, 195026, 195027, 195028, 195029,
+    195030, 195031, 195032, 195033, 195034, 195035, 195036, 195037,
+    195038, 195039, 195040, 195041, 195042, 195043, 195044, 195045,
+    195046, 195047, 195048, 195050, 195051, 195052, 195053, 195054,
+    195055, 195056, 195057, 195058, 195059, 195060, 195061, 195062,
+    195063, 195064, 195065, 195066, 195067, 195068, 195069, 195070,
+    195072, 195073, 195074, 195075, 195076, 195077, 195078, 195079,
+    195080, 195081, 195082, 195083, 195084, 195085, 195086, 195087,
+    195088, 195089, 195090, 195091, 195092, 195093, 195094, 195095,
+    195096, 195097, 195098, 195099, 195100, 195101, 195102, 196608,
+    201547, 917505, 917506, 917536, 917632, 917760, 918000,
+};
+
+inline constexpr std::uint8_t idna_values[] = {
+    0, 1, 0, 1, 0, 3, 0, 1, 0, 3, 0, 2, 0, 3, 0, 3,
+    0, 3, 3, 0, 3, 0, 3, 1, 0, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 0, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 3, 1, 3, 1, 3, 3, 1,
+    3, 3, 1, 3, 3, 3, 3, 1, 3, 3, 1, 3, 3, 3, 1, 3,
+    3, 1, 3, 3, 1, 3, 1, 3, 1, 3, 3, 1, 3, 1, 3, 1,
+    3, 3, 1, 3, 3, 1, 3, 1, 3, 3, 1, 3, 1, 3, 3, 3,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 3, 1, 3, 3, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 3, 1, 3, 3, 1, 3, 1, 3, 3, 3, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 1, 0, 1, 0, 3, 3, 3, 3, 3, 0, 1, 0, 1, 0, 1,
+    3, 1, 3, 3, 3, 1, 2, 1, 3, 1, 3, 1, 3, 0, 3, 1,
+    0, 1, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 1, 3, 0, 3,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 3, 3, 1, 3, 3, 0, 3, 1, 3, 3, 1, 3, 3,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 0, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 3, 0, 1, 0,
+    1, 3, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 2, 0, 1, 0, 1, 3, 3, 3, 3, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 3,
+    3, 3, 3, 3, 3, 3, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    3, 3, 0, 3, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 0, 1, 3, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3, 3, 3, 1, 0, 3,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 3, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3, 3, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 1, 0, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 1, 3, 1, 3, 3, 3,
+    3, 3, 1, 3, 1, 0, 1, 3, 1, 0, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 0, 1, 0, 1, 0, 1, 0, 3, 0, 3, 0,
+    3, 0, 1, 0, 3, 1, 2, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 2, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 2, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 3, 3, 3, 3, 3, 3, 3, 0,
+    3, 0, 3, 0, 1, 0, 1, 0, 1, 3, 3, 3, 1, 3, 3, 3,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1,
+    0, 3, 0, 1, 3, 1, 3, 1, 0, 3, 0, 1, 0, 3, 0, 3,
+    0, 3, 0, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 1, 3, 3, 3, 0, 1, 3, 3, 3, 3, 3,
+    0, 3, 0, 3, 3, 3, 0, 1, 3, 3, 3, 3, 3, 3, 0, 1,
+    3, 0, 1, 3, 3, 3, 0, 1, 3, 1, 3, 3, 3, 3, 0, 3,
+    3, 3, 0, 1, 3, 3, 3, 3, 3, 3, 0, 2, 1, 2, 0, 3,
+    0, 2, 0, 2, 0, 2, 3, 3, 0, 3, 0, 3, 3, 0, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 0, 1, 0, 3, 0, 3, 0,
+    3, 3, 3, 3, 0, 3, 3, 0, 3, 0, 3, 3, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 0, 3,
+    3, 3, 3, 0, 3, 3, 0, 1, 0, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 1, 3, 1, 0, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 1, 0, 1, 0, 3,
+    1, 3, 1, 3, 3, 3, 1, 3, 1, 3, 1, 3, 1, 3, 3, 3,
+    3, 1, 3, 1, 3, 1, 3, 3, 3, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 3, 1,
+    3, 1, 3, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 3, 0, 3, 0, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 3, 0, 1, 0, 1, 0, 1, 0, 3, 3, 1, 0, 1, 0,
+    1, 0, 1, 3, 0, 1, 0, 1, 3, 0, 1, 0, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 1, 0, 1, 0, 3, 3, 3, 3, 1, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3,
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 0, 1, 0, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 3, 1, 0, 1, 0, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 0, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 1, 3, 1, 3, 1, 3, 3, 3, 3, 3, 1, 3, 3, 3,
+    3, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3, 1, 3,
+    1, 3, 3, 3, 3, 1, 3, 1, 0, 3, 1, 0, 1, 0, 1, 3,
+    1, 3, 1, 0, 3, 3, 3, 3, 1, 3, 3, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 3, 3, 3, 3, 1, 3, 0, 3, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 1, 3, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 1, 3, 1, 3, 1, 3, 3, 1, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 0,
+    3, 3, 3, 3, 3, 0, 3, 1, 3, 3, 3, 3, 3, 3, 3, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3,
+    3, 3, 3, 0, 3, 0, 3, 3, 0, 3, 3, 0, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3,
+    0, 2, 0, 1, 0, 3, 0, 3, 0, 3, 0, 1, 0, 3, 0, 3,
+    0, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 2, 0, 3,
+    0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3,
+    0, 3, 0, 3, 0, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 3, 1, 0, 1, 0, 3, 0, 1, 0, 1, 0, 1, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 3, 3, 3, 3, 3, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 0, 1, 0, 3, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 2, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 3, 3, 3, 3, 0, 3, 3, 3,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 3, 0, 3, 0, 3,
+    0, 3, 3, 3, 3, 0, 3, 0, 3, 0, 3, 0, 3, 3, 0, 3,
+    0, 3, 0, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 0, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 0, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3,
+    3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+    3, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+    3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 0, 3, 0,
+    3, 0, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 0,
+    3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 3, 3, 0, 3, 3,
+    0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 3, 0,
+    3, 0, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 0, 3, 3,
+    3, 0, 3, 3, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 3, 3, 3, 0, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 1, 0, 3, 3, 3, 3,
+    0, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 0, 3,
+    3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+    3, 3, 0, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 1,
+    0, 2, 0, 2, 0, 2, 0,
+};
+
+inline constexpr std::uint32_t idna_mapping[] = {
+    0, 0, 0, 0, 0, 97, 0, 0,
+    0, 97, 0, 0, 0, 50, 0, 956,
+    0, 49, 111, 0, 224, 0, 248, 0,
+    0, 0, 257, 0, 259, 0, 261, 0,
+    263, 0, 265, 0, 267, 0, 269, 0,
+    271, 0, 273, 0, 275, 0, 277, 0,
+    279, 0, 281, 0, 283, 0, 285, 0,
+    287, 0, 289, 0, 291, 0, 293, 0,
+    295, 0, 297, 0, 299, 0, 301, 0,
+    303, 0, 2147483648, 0, 2147483652, 309, 0, 311,
+    0, 314, 0, 316, 0, 318, 0, 0,
+    322, 0, 324, 0, 326, 0, 328, 0,
+    2147483655, 331, 0, 333, 0, 335, 0, 337,
+    0, 339, 0, 341, 0, 343, 0, 345,
+    0, 347, 0, 349, 0, 351, 0, 353,
+    0, 355, 0, 357, 0, 359, 0, 361,
+    0, 363, 0, 365, 0, 367, 0, 369,
+    0, 371, 0, 373, 0, 375, 0, 255,
+    378, 0, 380, 0, 382, 0, 115, 0,
+    595, 387, 0, 389, 0, 596, 392, 0,
+    598, 396, 0, 477, 601, 603, 402, 0,
+    608, 611, 0, 617, 616, 409, 0, 623,
+    626, 0, 629, 417, 0, 419, 0, 421,
+    0, 640, 424, 0, 643, 0, 429, 0,
+    648, 432, 0, 650, 436, 0, 438, 0,
+    658, 441, 0, 445, 0, 2147483659, 2147483663, 2147483666,
+    462, 0, 464, 0, 466, 0, 468, 0,
+    470, 0, 472, 0, 474, 0, 476, 0,
+    479, 0, 481, 0, 483, 0, 485, 0,
+    487, 0, 489, 0, 491, 0, 493, 0,
+    495, 0, 2147483669, 501, 0, 405, 447, 505,
+    0, 507, 0, 509, 0, 511, 0, 513,
+    0, 515, 0, 517, 0, 519, 0, 521,
+    0, 523, 0, 525, 0, 527, 0, 529,
+    0, 531, 0, 533, 0, 535, 0, 537,
+    0, 539, 0, 541, 0, 543, 0, 414,
+    0, 547, 0, 549, 0, 551, 0, 553,
+    0, 555, 0, 557, 0, 559, 0, 561,
+    0, 563, 0, 11365, 572, 0, 410, 11366,
+    0, 578, 0, 384, 649, 652, 583, 0,
+    585, 0, 587, 0, 589, 0, 591, 0,
+    104, 614, 106, 114, 633, 635, 641, 119,
+    121, 0, 0, 0, 0, 611, 108, 115,
+    120, 661, 0, 0, 0, 0, 0, 0,
+    768, 0, 787, 2147483672, 953, 0, 0, 0,
+    881, 0, 883, 0, 697, 0, 887, 0,
+    0, 0, 0, 1011, 0, 940, 0, 941,
+    0, 972, 0, 973, 0, 945, 0, 963,
+    0, 983, 946, 952, 965, 973, 971, 966,
+    960, 0, 985, 0, 987, 0, 989, 0,
+    991, 0, 993, 0, 995, 0, 997, 0,
+    999, 0, 1001, 0, 1003, 0, 1005, 0,
+    1007, 0, 954, 961, 963, 0, 952, 949,
+    0, 1016, 0, 963, 1019, 0, 891, 1104,
+    1072, 0, 1121, 0, 1123, 0, 1125, 0,
+    1127, 0, 1129, 0, 1131, 0, 1133, 0,
+    1135, 0, 1137, 0, 1139, 0, 1141, 0,
+    1143, 0, 1145, 0, 1147, 0, 1149, 0,
+    1151, 0, 1153, 0, 0, 0, 1163, 0,
+    1165, 0, 1167, 0, 1169, 0, 1171, 0,
+    1173, 0, 1175, 0, 1177, 0, 1179, 0,
+    1181, 0, 1183, 0, 1185, 0, 1187, 0,
+    1189, 0, 1191, 0, 1193, 0, 1195, 0,
+    1197, 0, 1199, 0, 1201, 0, 1203, 0,
+    1205, 0, 1207, 0, 1209, 0, 1211, 0,
+    1213, 0, 1215, 0, 1231, 1218, 0, 1220,
+    0, 1222, 0, 1224, 0, 1226, 0, 1228,
+    0, 1230, 0, 1233, 0, 1235, 0, 1237,
+    0, 1239, 0, 1241, 0, 1243, 0, 1245,
+    0, 1247, 0, 1249, 0, 1251, 0, 1253,
+    0, 1255, 0, 1257, 0, 1259, 0, 1261,
+    0, 1263, 0, 1265, 0, 1267, 0, 1269,
+    0, 1271, 0, 1273, 0, 1275, 0, 1277,
+    0, 1279, 0, 1281, 0, 1283, 0, 1285,
+    0, 1287, 0, 1289, 0, 1291, 0, 1293,
+    0, 1295, 0, 1297, 0, 1299, 0, 1301,
+    0, 1303, 0, 1305, 0, 1307, 0, 1309,
+    0, 1311, 0, 1313, 0, 1315, 0, 1317,
+    0, 1319, 0, 1321, 0, 1323, 0, 1325,
+    0, 1327, 0, 0, 1377, 0, 0, 0,
+    0, 2147483677, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2147483682, 2147483687, 2147483692, 2147483697, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2147483702, 2147483709,
+    2147483716, 2147483723, 2147483730, 2147483737, 2147483744, 2147483751, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2147483758, 2147483765, 0, 2147483772, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2147483779, 0, 0, 2147483786, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2147483793, 2147483800, 2147483807, 0, 0, 2147483814,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2147483821, 2147483828, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2147483835, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2147483842,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2147483849, 2147483856, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2147483863, 0, 0, 0, 2147483870,
+    0, 2147483877, 0, 2147483884, 0, 2147483891, 0, 2147483898,
+    0, 0, 0, 2147483905, 0, 2147483912, 2147483919, 2147483926,
+    2147483936, 2147483943, 0, 2147483953, 0, 0, 0, 2147483960,
+    0, 0, 0, 2147483967, 0, 2147483974, 0, 2147483981,
+    0, 2147483988, 0, 2147483995, 0, 0, 0, 0,
+    0, 0, 0, 0, 11520, 0, 11559, 0,
+    11565, 0, 0, 0, 4316, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5104,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1074, 1076, 1086, 1089, 1098, 1123, 42571, 0,
+    4304, 0, 4349, 0, 0, 0, 0, 0,
+    0, 97, 230, 98, 0, 100, 477, 103,
+    0, 111, 547, 112, 114, 116, 119, 97,
+    592, 7426, 98, 100, 601, 603, 103, 0,
+    107, 109, 331, 111, 596, 7446, 112, 116,
+    7453, 623, 118, 7461, 946, 966, 105, 114,
+    117, 946, 961, 966, 0, 1085, 0, 594,
+    99, 597, 240, 604, 102, 607, 609, 613,
+    616, 7547, 669, 621, 7557, 671, 625, 624,
+    626, 632, 642, 427, 649, 7452, 651, 122,
+    656, 952, 0, 7681, 0, 7683, 0, 7685,
+    0, 7687, 0, 7689, 0, 7691, 0, 7693,
+    0, 7695, 0, 7697, 0, 7699, 0, 7701,
+    0, 7703, 0, 7705, 0, 7707, 0, 7709,
+    0, 7711, 0, 7713, 0, 7715, 0, 7717,
+    0, 7719, 0, 7721, 0, 7723, 0, 7725,
+    0, 7727, 0, 7729, 0, 7731, 0, 7733,
+    0, 7735, 0, 7737, 0, 7739, 0, 7741,
+    0, 7743, 0, 7745, 0, 7747, 0, 7749,
+    0, 7751, 0, 7753, 0, 7755, 0, 7757,
+    0, 7759, 0, 7761, 0, 7763, 0, 7765,
+    0, 7767, 0, 7769, 0, 7771, 0, 7773,
+    0, 7775, 0, 7777, 0, 7779, 0, 7781,
+    0, 7783, 0, 7785, 0, 7787, 0, 7789,
+    0, 7791, 0, 7793, 0, 7795, 0, 7797,
+    0, 7799, 0, 7801, 0, 7803, 0, 7805,
+    0, 7807, 0, 7809, 0, 7811, 0, 7813,
+    0, 7815, 0, 7817, 0, 7819, 0, 7821,
+    0, 7823, 0, 7825, 0, 7827, 0, 7829,
+    0, 2147484002, 7777, 0, 2147484006, 0, 7841, 0,
+    7843, 0, 7845, 0, 7847, 0, 7849, 0,
+    7851, 0, 7853, 0, 7855, 0, 7857, 0,
+    7859, 0, 7861, 0, 7863, 0, 7865, 0,
+    7867, 0, 7869, 0, 7871, 0, 7873, 0,
+    7875, 0, 7877, 0, 7879, 0, 7881, 0,
+    7883, 0, 7885, 0, 7887, 0, 7889, 0,
+    7891, 0, 7893, 0, 7895, 0, 7897, 0,
+    7899, 0, 7901, 0, 7903, 0, 7905, 0,
+    7907, 0, 7909, 0, 7911, 0, 7913, 0,
+    7915, 0, 7917, 0, 7919, 0, 7921, 0,
+    7923, 0, 7925, 0, 7927, 0, 7929, 0,
+    7931, 0, 7933, 0, 7935, 0, 7936, 0,
+    0, 7952, 0, 0, 7968, 0, 7984, 0,
+    0, 8000, 0, 0, 0, 8017, 0, 8019,
+    0, 8021, 0, 8023, 0, 8032, 0, 940,
+    0, 941, 0, 942, 0, 943, 0, 972,
+    0, 973, 0, 974, 0, 2147484009, 2147484015, 2147484021,
+    2147484027, 2147484033, 2147484039, 2147484045, 2147484051, 2147484009, 2147484015, 2147484021,
+    2147484027, 2147484033, 2147484039, 2147484045, 2147484051, 2147484057, 2147484063, 2147484069,
+    2147484075, 2147484081, 2147484087, 2147484093, 2147484099, 2147484057, 2147484063, 2147484069,
+    2147484075, 2147484081, 2147484087, 2147484093, 2147484099, 2147484105, 2147484111, 2147484117,
+    2147484123, 2147484129, 2147484135, 2147484141, 2147484147, 2147484105, 2147484111, 2147484117,
+    2147484123, 2147484129, 2147484135, 2147484141, 2147484147, 0, 2147484153, 2147484159,
+    2147484164, 0, 0, 2147484169, 8112, 8048, 940, 2147484159,
+    0, 953, 0, 2147484175, 2147484181, 2147484186, 0, 0,
+    2147484191, 8050, 941, 8052, 942, 2147484181, 0, 0,
+    912, 0, 0, 8144, 8054, 943, 0, 0,
+    944, 0, 8160, 8058, 973, 8165, 0, 2147484197,
+    2147484203, 2147484208, 0, 0, 2147484213, 8056, 972, 8060,
+    974, 2147484203, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 0, 0, 48, 105,
+    0, 52, 0, 110, 48, 0, 97, 101,
+    111, 120, 601, 104, 107, 112, 115, 0,
+    2147484219, 0, 0, 0, 99, 0, 603, 0,
+    103, 295, 105, 108, 0, 110, 2147484222, 0,
+    112, 0, 2147484225, 2147484228, 2147484232, 0, 122, 0,
+    969, 0, 122, 0, 107, 229, 98, 0,
+    101, 8526, 109, 111, 1488, 105, 0, 2147484235,
+    960, 947, 960, 0, 100, 105, 0, 0,
+    0, 105, 2147484239, 2147484242, 2147484246, 118, 2147484249, 2147484252,
+    2147484256, 2147484261, 120, 2147484264, 2147484267, 108, 99, 109,
+    105, 2147484239, 2147484242, 2147484246, 118, 2147484249, 2147484252, 2147484256,
+    2147484261, 120, 2147484264, 2147484267, 108, 99, 109, 0,
+    8580, 0, 0, 49, 2147484271, 2147484274, 2147484277, 2147484280,
+    2147484283, 2147484286, 2147484289, 2147484292, 2147484295, 2147484298, 2147484301, 0,
+    97, 97, 48, 0, 0, 0, 0, 11312,
+    0, 11361, 0, 619, 7549, 637, 0, 11368,
+    0, 11370, 0, 11372, 0, 593, 625, 592,
+    594, 0, 11379, 0, 11382, 0, 106, 118,
+    575, 11393, 0, 11395, 0, 11397, 0, 11399,
+    0, 11401, 0, 11403, 0, 11405, 0, 11407,
+    0, 11409, 0, 11411, 0, 11413, 0, 11415,
+    0, 11417, 0, 11419, 0, 11421, 0, 11423,
+    0, 11425, 0, 11427, 0, 11429, 0, 11431,
+    0, 11433, 0, 11435, 0, 11437, 0, 11439,
+    0, 11441, 0, 11443, 0, 11445, 0, 11447,
+    0, 11449, 0, 11451, 0, 11453, 0, 11455,
+    0, 11457, 0, 11459, 0, 11461, 0, 11463,
+    0, 11465, 0, 11467, 0, 11469, 0, 11471,
+    0, 11473, 0, 11475, 0, 11477, 0, 11479,
+    0, 11481, 0, 11483, 0, 11485, 0, 11487,
+    0, 11489, 0, 11491, 0, 0, 11500, 0,
+    11502, 0, 11507, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 11617,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 27597,
+    0, 40863, 0, 19968, 20008, 20022, 20031, 20057,
+    20101, 20108, 20128, 20154, 20799, 20837, 20843, 20866,
+    20886, 20907, 20960, 20981, 20992, 21147, 21241, 21269,
+    21274, 21304, 21313, 21340, 21353, 21378, 21430, 21448,
+    21475, 22231, 22303, 22763, 22786, 22794, 22805, 22823,
+    22899, 23376, 23424, 23544, 23567, 23586, 23608, 23662,
+    23665, 24027, 24037, 24049, 24062, 24178, 24186, 24191,
+    24308, 24318, 24331, 24339, 24400, 24417, 24435, 24515,
+    25096, 25142, 25163, 25903, 25908, 25991, 26007, 26020,
+    26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490,
+    27513, 27571, 27595, 27604, 27611, 27663, 27668, 27700,
+    28779, 29226, 29238, 29243, 29247, 29255, 29273, 29275,
+    29356, 29572, 29577, 29916, 29926, 29976, 29983, 29992,
+    30000, 30091, 30098, 30326, 30333, 30382, 30399, 30446,
+    30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435,
+    31481, 31859, 31992, 32566, 32593, 32650, 32701, 32769,
+    32780, 32786, 32819, 32895, 32905, 33251, 33258, 33267,
+    33276, 33292, 33307, 33311, 33390, 33394, 33400, 34381,
+    34411, 34880, 34892, 34915, 35198, 35211, 35282, 35328,
+    35895, 35910, 35925, 35960, 35997, 36196, 36208, 36275,
+    36523, 36554, 36763, 36784, 36789, 37009, 37193, 37318,
+    37324, 37329, 38263, 38272, 38428, 38582, 38585, 38632,
+    38737, 38750, 38754, 38761, 38859, 38893, 38899, 38913,
+    39080, 39131, 39135, 39318, 39321, 39340, 39592, 39640,
+    39647, 39717, 39727, 39730, 39740, 39770, 40165, 40565,
+    40575, 40613, 40635, 40643, 40653, 40657, 40697, 40701,
+    40718, 40723, 40736, 40763, 40778, 40786, 40845, 40860,
+    40864, 0, 46, 0, 0, 0, 0, 0,
+    0, 0, 21313, 21316, 0, 0, 0, 0,
+    0, 0, 0, 2147484304, 0, 0, 0, 0,
+    2147484311, 0, 0, 0, 4352, 4522, 4354, 4524,
+    4355, 4528, 4378, 4358, 4385, 4361, 4449, 0,
+    4372, 4551, 4556, 4558, 4563, 4567, 4569, 4380,
+    4573, 4575, 4381, 4384, 4386, 4391, 4393, 4395,
+    4402, 4406, 4416, 4423, 4428, 4593, 4439, 4484,
+    4488, 4497, 4500, 4510, 4513, 0, 19968, 20108,
+    19977, 22235, 19978, 20013, 19979, 30002, 20057, 19993,
+    19969, 22825, 22320, 20154, 0, 0, 0, 0,
+    21839, 24188, 25991, 31631, 0, 2147484318, 2147484322, 2147484325,
+    2147484328, 2147484331, 2147484334, 2147484337, 2147484340, 2147484343, 2147484346, 2147484349,
+    2147484352, 2147484355, 2147484358, 2147484361, 2147484364, 4352, 4354, 4357,
+    4361, 4363, 4366, 44032, 45208, 45796, 46972, 47560,
+    48148, 49324, 50500, 51088, 52264, 52852, 53440, 54028,
+    54616, 2147484367, 2147484374, 50864, 0, 19968, 20108, 19977,
+    22235, 20116, 20845, 19971, 20843, 20061, 21313, 26376,
+    28779, 27700, 26408, 37329, 22303, 26085, 26666, 26377,
+    31038, 21517, 29305, 36001, 31069, 21172, 31192, 30007,
+    22899, 36969, 20778, 21360, 27880, 38917, 20241, 20889,
+    27491, 19978, 20013, 19979, 24038, 21491, 21307, 23447,
+    23398, 30435, 20225, 36039, 21332, 22812, 2147484381, 2147484384,
+    2147484387, 2147484390, 2147484393, 2147484396, 2147484399, 2147484402, 2147484405, 2147484408,
+    2147484411, 2147484414, 2147484417, 2147484420, 2147484423, 2147484426, 2147484431, 2147484436,
+    2147484441, 2147484446, 2147484451, 2147484456, 2147484461, 2147484466, 2147484471, 2147484477,
+    2147484483, 2147484489, 2147484492, 2147484496, 2147484499, 12450, 12452, 12454,
+    12456, 12458, 12461, 12463, 12465, 12467, 12469, 12471,
+    12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488,
+    12490, 12498, 12501, 12504, 12507, 12510, 12516, 12518,
+    12520, 12527, 2147484503, 2147484510, 2147484523, 2147484536, 2147484549, 2147484559,
+    2147484572, 2147484582, 2147484592, 2147484608, 2147484621, 2147484631, 2147484641, 2147484651,
+    2147484664, 2147484677, 2147484687, 2147484697, 2147484704, 2147484714, 2147484727, 2147484740,
+    2147484747, 2147484763, 2147484782, 2147484798, 2147484808, 2147484824, 2147484840, 2147484853,
+    2147484863, 2147484873, 2147484883, 2147484896, 2147484912, 2147484925, 2147484935, 2147484945,
+    2147484955, 2147484962, 2147484969, 2147484976, 2147484983, 2147484993, 2147485003, 2147485019,
+    2147485029, 2147485042, 2147485058, 2147485068, 2147485075, 2147485082, 2147485098, 2147485111,
+    2147485127, 2147485137, 2147485153, 2147485160, 2147485170, 2147485180, 2147485190, 2147485200,
+    2147485210, 2147485223, 2147485233, 2147485240, 2147485250, 2147485260, 2147485270, 2147485283,
+    2147485293, 2147485303, 2147485313, 2147485329, 2147485342, 2147485349, 2147485365, 2147485372,
+    2147485385, 2147485398, 2147485408, 2147485418, 2147485428, 2147485441, 2147485448, 2147485458,
+    2147485471, 2147485478, 2147485494, 2147485504, 2147485509, 2147485514, 2147485519, 2147485524,
+    2147485529, 2147485534, 2147485539, 2147485544, 2147485549, 2147485554, 2147485560, 2147485566,
+    2147485572, 2147485578, 2147485584, 2147485590, 2147485596, 2147485602, 2147485608, 2147485614,
+    2147485620, 2147485626, 2147485632, 2147485638, 2147485644, 2147485648, 2147485651, 2147485654,
+    2147485658, 2147485661, 2147485664, 2147485667, 2147485671, 2147485675, 2147485678, 2147485685,
+    2147485692, 2147485699, 2147485706, 2147485719, 2147485722, 2147485725, 2147485729, 2147485732,
+    2147485735, 2147485738, 2147485741, 2147485744, 2147485748, 2147485753, 2147485756, 2147485759,
+    2147485763, 2147485767, 2147485770, 2147485773, 2147485776, 2147485780, 2147485784, 2147485788,
+    2147485792, 2147485796, 2147485799, 2147485802, 2147485805, 2147485808, 2147485811, 2147485815,
+    2147485818, 2147485821, 2147485824, 2147485828, 2147485832, 2147485835, 2147485839, 2147485843,
+    2147485847, 2147485850, 0, 2147485719, 2147485854, 2147485858, 2147485862, 2147485866,
+    0, 2147485870, 2147485873, 2147485876, 2147485880, 2147485883, 2147485886, 2147485889,
+    2147485893, 2147485896, 2147485893, 2147485899, 2147485902, 2147485905, 2147485909, 2147485912,
+    2147485909, 2147485915, 2147485919, 0, 2147485923, 2147485926, 2147485929, 0,
+    2147485932, 2147485935, 2147485938, 2147485941, 2147485944, 2147485947, 2147485821, 2147485950,
+    2147485953, 2147485956, 2147485959, 2147485963, 2147485738, 2147485966, 2147485970, 2147485974,
+    0, 2147485977, 2147485981, 2147485984, 2147485987, 2147485990, 0, 2147485993,
+    2147485998, 2147486003, 2147486008, 2147486013, 2147486018, 2147486023, 2147486028, 2147486033,
+    2147486038, 2147486044, 2147486050, 2147486056, 2147486062, 2147486068, 2147486074, 2147486080,
+    2147486086, 2147486092, 2147486098, 2147486104, 2147486110, 2147486116, 2147486122, 2147486128,
+    2147486134, 2147486140, 2147486146, 2147486152, 2147486158, 2147486164, 2147486170, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 42561, 0, 42563, 0, 42565, 0, 42567,
+    0, 42569, 0, 42571, 0, 42573, 0, 42575,
+    0, 42577, 0, 42579, 0, 42581, 0, 42583,
+    0, 42585, 0, 42587, 0, 42589, 0, 42591,
+    0, 42593, 0, 42595, 0, 42597, 0, 42599,
+    0, 42601, 0, 42603, 0, 42605, 0, 0,
+    0, 0, 0, 42625, 0, 42627, 0, 42629,
+    0, 42631, 0, 42633, 0, 42635, 0, 42637,
+    0, 42639, 0, 42641, 0, 42643, 0, 42645,
+    0, 42647, 0, 42649, 0, 42651, 0, 1098,
+    1100, 0, 0, 0, 0, 42787, 0, 42789,
+    0, 42791, 0, 42793, 0, 42795, 0, 42797,
+    0, 42799, 0, 42803, 0, 42805, 0, 42807,
+    0, 42809, 0, 42811, 0, 42813, 0, 42815,
+    0, 42817, 0, 42819, 0, 42821, 0, 42823,
+    0, 42825, 0, 42827, 0, 42829, 0, 42831,
+    0, 42833, 0, 42835, 0, 42837, 0, 42839,
+    0, 42841, 0, 42843, 0, 42845, 0, 42847,
+    0, 42849, 0, 42851, 0, 42853, 0, 42855,
+    0, 42857, 0, 42859, 0, 42861, 0, 42863,
+    0, 42863, 0, 42874, 0, 42876, 0, 7545,
+    42879, 0, 42881, 0, 42883, 0, 42885, 0,
+    42887, 0, 0, 42892, 0, 613, 0, 42897,
+    0, 42899, 0, 42903, 0, 42905, 0, 42907,
+    0, 42909, 0, 42911, 0, 42913, 0, 42915,
+    0, 42917, 0, 42919, 0, 42921, 0, 614,
+    604, 609, 620, 618, 0, 670, 647, 669,
+    43859, 42933, 0, 42935, 0, 42937, 0, 42939,
+    0, 42941, 0, 42943, 0, 42945, 0, 42947,
+    0, 42900, 642, 7566, 42952, 0, 42954, 0,
+    0, 42961, 0, 0, 0, 0, 0, 42967,
+    0, 42969, 0, 0, 99, 102, 113, 42998,
+    0, 295, 339, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 42791, 43831, 619, 43858, 0,
+    653, 0, 5024, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 35912,
+    26356, 36554, 36040, 28369, 20018, 21477, 40860, 22865,
+    37329, 21895, 22856, 25078, 30313, 32645, 34367, 34746,
+    35064, 37007, 27138, 27931, 28889, 29662, 33853, 37226,
+    39409, 20098, 21365, 27396, 29211, 34349, 40478, 23888,
+    28651, 34253, 35172, 25289, 33240, 34847, 24266, 26391,
+    28010, 29436, 37070, 20358, 20919, 21214, 25796, 27347,
+    29200, 30439, 32769, 34310, 34396, 36335, 38706, 39791,
+    40442, 30860, 31103, 32160, 33737, 37636, 40575, 35542,
+    22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647,
+    22744, 23650, 27155, 28122, 28431, 32047, 32311, 38475,
+    21202, 32907, 20956, 20940, 31260, 32190, 33777, 38517,
+    35712, 25295, 27138, 35582, 20025, 23527, 24594, 29575,
+    30064, 21271, 30971, 20415, 24489, 19981, 27852, 25976,
+    32034, 21443, 22622, 30465, 33865, 35498, 27578, 36784,
+    27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937,
+    26753, 31975, 33391, 35538, 37327, 21237, 21570, 22899,
+    24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654,
+    21147, 26310, 27511, 36706, 24180, 24976, 25088, 25754,
+    28451, 29001, 29833, 31178, 32244, 32879, 36646, 34030,
+    36899, 37706, 21015, 21155, 21693, 28872, 35010, 35498,
+    24265, 24565, 25467, 27566, 31806, 29557, 20196, 22265,
+    23527, 23994, 24604, 29618, 29801, 32666, 32838, 37428,
+    38646, 38728, 38936, 20363, 31150, 37300, 38584, 24801,
+    20102, 20698, 23534, 23615, 26009, 27138, 29134, 30274,
+    34044, 36988, 40845, 26248, 38446, 21129, 26491, 26611,
+    27969, 28316, 29705, 30041, 30827, 32016, 39006, 20845,
+    25134, 38520, 20523, 23833, 28138, 36650, 24459, 24900,
+    26647, 29575, 38534, 21033, 21519, 23653, 26131, 26446,
+    26792, 27877, 29702, 30178, 32633, 35023, 35041, 37324,
+    38626, 21311, 28346, 21533, 29136, 29848, 34298, 38563,
+    40023, 40607, 26519, 28107, 33256, 31435, 31520, 31890,
+    29376, 28825, 35672, 20160, 33590, 21050, 20999, 24230,
+    25299, 31958, 23429, 27934, 26292, 36667, 34892, 38477,
+    35211, 24275, 20800, 21952, 0, 22618, 0, 26228,
+    0, 20958, 29482, 30410, 31036, 31070, 31077, 31119,
+    38742, 31934, 32701, 0, 34322, 0, 35576, 0,
+    36920, 37117, 0, 39151, 39164, 39208, 40372, 37086,
+    38583, 20398, 20711, 20813, 21193, 21220, 21329, 21917,
+    22022, 22120, 22592, 22696, 23652, 23662, 24724, 24936,
+    24974, 25074, 25935, 26082, 26257, 26757, 28023, 28186,
+    28450, 29038, 29227, 29730, 30865, 31038, 31049, 31048,
+    31056, 31062, 31069, 31117, 31296, 31361, 31680, 32244,
+    32265, 32321, 32626, 32773, 33261, 33401, 33879, 35088,
+    35222, 35585, 35641, 36051, 36104, 36790, 36920, 38627,
+    38911, 38971, 24693, 148206, 33304, 0, 20006, 20917,
+    20840, 20352, 20805, 20864, 21191, 21242, 21917, 21845,
+    21913, 21986, 22618, 22707, 22852, 22868, 23138, 23336,
+    24274, 24281, 24425, 24493, 24792, 24910, 24840, 24974,
+    24928, 25074, 25140, 25540, 25628, 25682, 25942, 26228,
+    26391, 26395, 26454, 27513, 27578, 27969, 28379, 28363,
+    28450, 28702, 29038, 30631, 29237, 29359, 29482, 29809,
+    29958, 30011, 30237, 30239, 30410, 30427, 30452, 30538,
+    30528, 30924, 31409, 31680, 31867, 32091, 32244, 32574,
+    32773, 33618, 33775, 34681, 35137, 35206, 35222, 35519,
+    35576, 35531, 35585, 35582, 35565, 35641, 35722, 36104,
+    36664, 36978, 37273, 37494, 38524, 38627, 38742, 38875,
+    38911, 38923, 38971, 39698, 40860, 141386, 141380, 144341,
+    15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846,
+    0, 2147486174, 2147486177, 2147486180, 2147486183, 2147486187, 2147486191, 0,
+    2147486194, 2147486199, 2147486204, 2147486209, 2147486214, 0, 2147486219, 0,
+    2147486224, 1506, 1488, 1491, 1499, 1512, 1514, 0,
+    2147486229, 2147486234, 2147486239, 2147486246, 2147486253, 2147486258, 2147486263, 2147486268,
+    2147486273, 2147486278, 2147486283, 2147486288, 2147486293, 0, 2147486298, 2147486303,
+    2147486308, 2147486313, 2147486318, 0, 2147486323, 0, 2147486328, 2147486333,
+    0, 2147486338, 2147486343, 0, 2147486348, 2147486353, 2147486358, 2147486363,
+    2147486368, 2147486373, 2147486378, 2147486383, 2147486388, 2147486393, 1649, 1659,
+    1662, 1664, 1658, 1663, 1657, 1700, 1702, 1668,
+    1667, 1670, 1677, 1676, 1678, 1672, 1688, 1681,
+    1705, 1711, 1715, 1713, 1722, 1728, 1726, 1746,
+    0, 1709, 1735, 1734, 1736, 2147483692, 1739, 1733,
+    1737, 1744, 1609, 2147486398, 2147486403, 2147486408, 2147486413, 2147486418,
+    2147486423, 2147486428, 2147486433, 1740, 2147486438, 2147486443, 2147486448, 2147486433,
+    2147486453, 2147486458, 2147486463, 2147486468, 2147486473, 2147486478, 2147486483, 2147486488,
+    2147486493, 2147486498, 2147486503, 2147486508, 2147486513, 2147486518, 2147486523, 2147486528,
+    2147486533, 2147486538, 2147486543, 2147486548, 2147486553, 2147486558, 2147486563, 2147486568,
+    2147486573, 2147486578, 2147486583, 2147486588, 2147486593, 2147486598, 2147486603, 2147486608,
+    2147486613, 2147486618, 2147486623, 2147486628, 2147486633, 2147486638, 2147486643, 2147486648,
+    2147486653, 2147486658, 2147486663, 2147486668, 2147486673, 2147486678, 2147486683, 2147486688,
+    2147486693, 2147486698, 2147486703, 2147486708, 2147486713, 2147486718, 2147486723, 2147486728,
+    2147486733, 2147486738, 2147486743, 2147486748, 2147486753, 2147486758, 2147486763, 2147486768,
+    2147486773, 2147486778, 2147486783, 2147486788, 2147486793, 2147486798, 2147486803, 2147486808,
+    2147486813, 2147486818, 2147486823, 2147486828, 2147486833, 2147486838, 2147486843, 2147486848,
+    2147486853, 2147486858, 2147486863, 2147486868, 2147486873, 2147486878, 2147486883, 2147486888,
+    2147486893, 2147486898, 0, 2147486903, 2147486908, 2147486448, 2147486913, 2147486433,
+    2147486453, 2147486918, 2147486923, 2147486473, 2147486928, 2147486478, 2147486483, 2147486933,
+    2147486938, 2147486503, 2147486943, 2147486508, 2147486513, 2147486948, 2147486953, 2147486523,
+    2147486958, 2147486528, 2147486533, 2147486678, 2147486683, 2147486698, 2147486703, 2147486708,
+    2147486728, 2147486733, 2147486738, 2147486743, 2147486763, 2147486768, 2147486773, 2147486963,
+    2147486793, 2147486968, 2147486973, 2147486823, 2147486978, 2147486828, 2147486833, 2147486898,
+    2147486983, 2147486988, 2147486873, 2147486993, 2147486878, 2147486883, 2147486438, 2147486443,
+    2147486998, 2147486448, 2147487003, 2147486458, 2147486463, 2147486468, 2147486473, 2147487008,
+    2147486488, 2147486493, 2147486498, 2147486503, 2147487013, 2147486523, 2147486538, 2147486543,
+    2147486548, 2147486553, 2147486558, 2147486568, 2147486573, 2147486578, 2147486583, 2147486588,
+    2147486593, 2147487018, 2147486598, 2147486603, 2147486608, 2147486613, 2147486618, 2147486623,
+    2147486633, 2147486638, 2147486643, 2147486648, 2147486653, 2147486658, 2147486663, 2147486668,
+    2147486673, 2147486688, 2147486693, 2147486713, 2147486718, 2147486723, 2147486728, 2147486733,
+    2147486748, 2147486753, 2147486758, 2147486763, 2147487023, 2147486778, 2147486783, 2147486788,
+    2147486793, 2147486808, 2147486813, 2147486818, 2147486823, 2147487028, 2147486838, 2147486843,
+    2147487033, 2147486858, 2147486863, 2147486868, 2147486873, 2147487038, 2147486448, 2147487003,
+    2147486473, 2147487008, 2147486503, 2147487013, 2147486523, 2147487043, 2147486588, 2147487048,
+    2147487053, 2147487058, 2147486728, 2147486733, 2147486763, 2147486823, 2147487028, 2147486873,
+    2147487038, 2147487063, 2147487070, 2147487077, 2147487084, 2147487089, 2147487094, 2147487099,
+    2147487104, 2147487109, 2147487114, 2147487119, 2147487124, 2147487129, 2147487134, 2147487139,
+    2147487144, 2147487149, 2147487154, 2147487159, 2147487164, 2147487169, 2147487174, 2147487179,
+    2147487184, 2147487189, 2147487194, 2147487053, 2147487199, 2147487204, 2147487209, 2147487214,
+    2147487084, 2147487089, 2147487094, 2147487099, 2147487104, 2147487109, 2147487114, 2147487119,
+    2147487124, 2147487129, 2147487134, 2147487139, 2147487144, 2147487149, 2147487154, 2147487159,
+    2147487164, 2147487169, 2147487174, 2147487179, 2147487184, 2147487189, 2147487194, 2147487053,
+    2147487199, 2147487204, 2147487209, 2147487214, 2147487184, 2147487189, 2147487194, 2147487053,
+    2147487048, 2147487058, 2147486628, 2147486573, 2147486578, 2147486583, 2147487184, 2147487189,
+    2147487194, 2147486628, 2147486633, 2147487219, 0, 2147487224, 2147487231, 2147487238,
+    2147487245, 2147487252, 2147487259, 2147487266, 2147487273, 2147487280, 2147487287, 2147487294,
+    2147487301, 2147487308, 2147487315, 2147487322, 2147487329, 2147487336, 2147487343, 2147487350,
+    2147487357, 2147487364, 2147487371, 2147487378, 2147487385, 2147487392, 2147487399, 2147487406,
+    2147487413, 2147487420, 2147487427, 2147487434, 2147487441, 2147487448, 2147487455, 2147487462,
+    2147487469, 2147487476, 2147487483, 2147487490, 2147487497, 2147487504, 2147487511, 2147487518,
+    2147487525, 2147487532, 2147487539, 2147487546, 2147487553, 2147487560, 0, 2147487567,
+    2147487574, 2147487581, 2147487588, 2147487595, 2147487602, 2147487609, 2147487616, 2147487623,
+    2147487630, 2147487637, 2147487644, 2147487651, 2147487658, 2147487665, 2147487672, 2147487679,
+    2147487686, 2147487693, 2147487700, 2147487707, 2147487714, 2147487721, 2147487728, 2147487735,
+    2147487742, 2147487749, 2147487756, 2147487763, 2147487770, 2147487777, 2147487784, 2147487462,
+    2147487476, 2147487791, 2147487798, 2147487805, 2147487812, 2147487819, 2147487826, 2147487819,
+    2147487805, 2147487833, 2147487840, 2147487847, 2147487854, 2147487861, 2147487826, 2147487413,
+    2147487343, 2147487868, 2147487875, 0, 2147487882, 2147487889, 2147487896, 2147487905,
+    2147487914, 2147487923, 2147487932, 2147487941, 2147487950, 2147487959, 0, 2147487966,
+    0, 0, 0, 0, 0, 46, 0, 45,
+    0, 2147487975, 0, 0, 0, 2147487980, 0, 2147487985,
+    0, 2147487990, 0, 2147487995, 0, 2147488000, 1569, 1601,
+    2147488005, 2147488010, 2147488015, 2147488020, 0, 0, 0, 45,
+    0, 48, 0, 97, 0, 97, 0, 46,
+    0, 12530, 12449, 12451, 12453, 12455, 12457, 12515,
+    12517, 12519, 12483, 12540, 12450, 12452, 12454, 12456,
+    12458, 12461, 12463, 12465, 12467, 12469, 12471, 12473,
+    12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490,
+    12498, 12501, 12504, 12507, 12510, 12516, 12518, 12520,
+    12527, 12531, 12441, 0, 4352, 4522, 4354, 4524,
+    4355, 4528, 4378, 4358, 4385, 4361, 0, 4449,
+    0, 4455, 0, 4461, 0, 4467, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 66600, 0, 0, 0, 0, 66776, 0,
+    0, 0, 0, 0, 0, 0, 66967, 0,
+    66979, 0, 66995, 0, 67003, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 720, 230, 665,
+    595, 0, 675, 43878, 677, 676, 598, 7569,
+    600, 606, 681, 612, 610, 608, 667, 295,
+    668, 615, 644, 682, 620, 122628, 42894, 622,
+    122629, 654, 122630, 248, 630, 113, 634, 122632,
+    637, 640, 680, 678, 43879, 679, 648, 11377,
+    0, 655, 673, 664, 448, 122634, 122654, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 68800, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 71872, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 93792, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 0, 105, 97, 97,
+    97, 0, 99, 0, 103, 0, 106, 0,
+    110, 0, 115, 97, 0, 102, 0, 104,
+    0, 112, 97, 97, 97, 0, 100, 0,
+    106, 0, 115, 0, 97, 97, 0, 100,
+    0, 105, 0, 111, 0, 115, 0, 97,
+    97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 305, 567, 0, 945,
+    952, 963, 0, 945, 963, 0, 949, 952,
+    954, 966, 961, 960, 945, 952, 963, 0,
+    945, 963, 0, 949, 952, 954, 966, 961,
+    960, 945, 952, 963, 0, 945, 963, 0,
+    949, 952, 954, 966, 961, 960, 945, 952,
+    963, 0, 945, 963, 0, 949, 952, 954,
+    966, 961, 960, 945, 952, 963, 0, 945,
+    963, 0, 949, 952, 954, 966, 961, 960,
+    989, 0, 48, 48, 48, 48, 48, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    125218, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1575,
+    1580, 1583, 0, 1608, 1586, 1581, 1591, 1610,
+    1603, 1587, 1593, 1601, 1589, 1602, 1585, 1588,
+    1578, 1582, 1584, 1590, 1592, 1594, 1646, 1722,
+    1697, 1647, 0, 1576, 1580, 0, 1607, 0,
+    1581, 0, 1610, 1603, 1587, 1593, 1601, 1589,
+    1602, 0, 1588, 1578, 1582, 0, 1590, 0,
+    1594, 0, 1580, 0, 1581, 0, 1610, 0,
+    1604, 0, 1606, 1587, 1593, 0, 1589, 1602,
+    0, 1588, 0, 1582, 0, 1590, 0, 1594,
+    0, 1722, 0, 1647, 0, 1576, 1580, 0,
+    1607, 0, 1581, 1591, 1610, 1603, 0, 1605,
+    1587, 1593, 1601, 1589, 1602, 0, 1588, 1578,
+    1582, 0, 1590, 1592, 1594, 1646, 0, 1697,
+    0, 1575, 1580, 1583, 1607, 1586, 1581, 1591,
+    1610, 0, 1604, 1587, 1593, 1601, 1589, 1602,
+    1585, 1588, 1578, 1582, 1584, 1590, 1592, 1594,
+    0, 1576, 1580, 1583, 0, 1608, 1586, 1581,
+    1591, 1610, 0, 1604, 1587, 1593, 1601, 1589,
+    1602, 1585, 1588, 1578, 1582, 1584, 1590, 1592,
+    1594, 0, 0, 0, 99, 114, 2147485929, 2147488025,
+    0, 97, 2147488028, 2147485893, 2147488031, 2147484006, 2147488034, 2147488038,
+    0, 2147488041, 2147488044, 2147488047, 0, 2147488050, 0, 2147488053,
+    2147488060, 12469, 0, 25163, 23383, 21452, 12487, 20108,
+    22810, 35299, 22825, 20132, 26144, 28961, 26009, 21069,
+    24460, 20877, 26032, 21021, 32066, 29983, 36009, 22768,
+    21561, 28436, 25237, 25429, 19968, 19977, 36938, 24038,
+    20013, 21491, 25351, 36208, 25171, 31105, 31354, 21512,
+    28288, 26377, 26376, 30003, 21106, 21942, 37197, 0,
+    24471, 21487, 0, 48, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 20029,
+    20024, 20033, 131362, 20320, 20398, 20411, 20482, 20602,
+    20633, 20711, 20687, 13470, 132666, 20813, 20820, 20836,
+    20855, 132380, 13497, 20839, 20877, 132427, 20887, 20900,
+    20172, 20908, 20917, 168415, 20981, 20995, 13535, 21051,
+    21062, 21106, 21111, 13589, 21191, 21193, 21220, 21242,
+    21253, 21271, 21321, 21329, 21338, 21363, 21373, 21375,
+    133676, 28784, 21450, 21471, 133987, 21483, 21489, 21510,
+    21662, 21560, 21576, 21608, 21666, 21750, 21776, 21843,
+    21859, 21892, 21913, 21931, 21939, 21954, 22294, 22022,
+    22295, 22097, 22132, 20999, 22766, 22478, 22516, 22541,
+    22411, 22578, 22577, 22700, 136420, 22770, 22775, 22790,
+    22810, 22818, 22882, 136872, 136938, 23020, 23067, 23079,
+    23000, 23142, 14062, 14076, 23304, 23358, 137672, 23491,
+    23512, 23527, 23539, 138008, 23551, 23558, 24403, 23586,
+    14209, 23648, 23662, 23744, 23693, 138724, 23875, 138726,
+    23918, 23915, 23932, 24033, 14383, 24061, 24104, 24125,
+    24169, 14434, 139651, 14460, 24240, 24243, 24246, 24266,
+    172946, 24318, 140081, 33281, 24354, 14535, 144056, 156122,
+    24418, 24427, 14563, 24474, 24525, 24535, 24569, 24705,
+    14650, 14620, 24724, 141012, 24775, 24904, 24908, 24910,
+    24908, 24954, 24974, 25010, 24996, 25007, 25054, 25074,
+    25078, 25104, 25115, 25181, 25265, 25300, 25424, 142092,
+    25405, 25340, 25448, 25475, 25572, 142321, 25634, 25541,
+    25513, 14894, 25705, 25726, 25757, 25719, 14956, 25935,
+    25964, 143370, 26083, 26360, 26185, 15129, 26257, 15112,
+    15076, 20882, 20885, 26368, 26268, 32941, 17369, 26391,
+    26395, 26401, 26462, 26451, 144323, 15177, 26618, 26501,
+    26706, 26757, 144493, 26766, 26655, 26900, 15261, 26946,
+    27043, 27114, 27304, 145059, 27355, 15384, 27425, 145575,
+    27476, 15438, 27506, 27551, 27578, 146061, 138507, 146170,
+    27726, 146620, 27839, 27853, 27751, 27926, 27966, 28023,
+    27969, 28009, 28024, 28037, 146718, 27956, 28207, 28270,
+    15667, 28363, 28359, 147153, 28153, 28526, 147294, 147342,
+    28614, 28729, 28702, 28699, 15766, 28746, 28797, 28791,
+    28845, 132389, 28997, 148067, 29084, 148395, 29224, 29237,
+    29264, 149000, 29312, 29333, 149301, 149524, 29562, 29579,
+    16044, 29605, 16056, 29767, 29788, 29809, 29829, 29898,
+    16155, 29988, 150582, 30014, 150674, 30064, 139679, 30224,
+    151457, 151480, 151620, 16380, 16392, 30452, 151795, 151794,
+    151833, 151859, 30494, 30538, 16441, 30603, 16454, 16534,
+    152605, 30798, 30860, 30924, 16611, 153126, 31062, 153242,
+    153285, 31119, 31211, 16687, 31296, 31306, 31311, 153980,
+    154279, 31470, 16898, 154539, 31686, 31689, 16935, 154752,
+    31954, 17056, 31976, 31971, 32000, 155526, 32099, 17153,
+    32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377,
+    32634, 156478, 32661, 32762, 32773, 156890, 156963, 32864,
+    157096, 32880, 144223, 17365, 32946, 33027, 17419, 33086,
+    23221, 157607, 157621, 144275, 144284, 33281, 33284, 36766,
+    17515, 33425, 33419, 33437, 21171, 33457, 33459, 33469,
+    33510, 158524, 33509, 33565, 33635, 33709, 33571, 33725,
+    33767, 33879, 33619, 33738, 33740, 33756, 158774, 159083,
+    158933, 17707, 34033, 34035, 34070, 160714, 34148, 159532,
+    17757, 17761, 159665, 159954, 17771, 34384, 34396, 34407,
+    34409, 34473, 34440, 34574, 34530, 34681, 34600, 34667,
+    34694, 17879, 34785, 34817, 17913, 34912, 34915, 161383,
+    35031, 35038, 17973, 35066, 13499, 161966, 162150, 18110,
+    18119, 35488, 35565, 35722, 35925, 162984, 36011, 36033,
+    36123, 36215, 163631, 133124, 36299, 36284, 36336, 133342,
+    36564, 36664, 165330, 165357, 37012, 37105, 37137, 165678,
+    37147, 37432, 37591, 37500, 37881, 37909, 166906, 38283,
+    18837, 38327, 167287, 18918, 38595, 23986, 38691, 168261,
+    168474, 19054, 19062, 38880, 168970, 19122, 169110, 38923,
+    38953, 169398, 39138, 19251, 39209, 39335, 39362, 39422,
+    19406, 170800, 39698, 40000, 40189, 19662, 19693, 40295,
+    172238, 19704, 172293, 172558, 172689, 40635, 19798, 40697,
+    40702, 40709, 40719, 40726, 40763, 173568, 0, 0,
+    0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint8_t idna_sequences[] = {
+    3, 105, 204, 135, 2, 105, 106, 3, 202, 188, 110, 3, 100, 197, 190, 2,
+    108, 106, 2, 110, 106, 2, 100, 122, 4, 204, 136, 204, 129, 4, 213, 165,
+    214, 130, 4, 216, 167, 217, 180, 4, 217, 136, 217, 180, 4, 219, 135, 217,
+    180, 4, 217, 138, 217, 180, 6, 224, 164, 149, 224, 164, 188, 6, 224, 164,
+    150, 224, 164, 188, 6, 224, 164, 151, 224, 164, 188, 6, 224, 164, 156, 224,
+    164, 188, 6, 224, 164, 161, 224, 164, 188, 6, 224, 164, 162, 224, 164, 188,
+    6, 224, 164, 171, 224, 164, 188, 6, 224, 164, 175, 224, 164, 188, 6, 224,
+    166, 161, 224, 166, 188, 6, 224, 166, 162, 224, 166, 188, 6, 224, 166, 175,
+    224, 166, 188, 6, 224, 168, 178, 224, 168, 188, 6, 224, 168, 184, 224, 168,
+    188, 6, 224, 168, 150, 224, 168, 188, 6, 224, 168, 151, 224, 168, 188, 6,
+    224, 168, 156, 224, 168, 188, 6, 224, 168, 171, 224, 168, 188, 6, 224, 172,
+    161, 224, 172, 188, 6, 224, 172, 162, 224, 172, 188, 6, 224, 185, 141, 224,
+    184, 178, 6, 224, 187, 141, 224, 186, 178, 6, 224, 186, 171, 224, 186, 153,
+    6, 224, 186, 171, 224, 186, 161, 6, 224, 189, 130, 224, 190, 183, 6, 224,
+    189, 140, 224, 190, 183, 6, 224, 189, 145, 224, 190, 183, 6, 224, 189, 150,
+    224, 190, 183, 6, 224, 189, 155, 224, 190, 183, 6, 224, 189, 128, 224, 190,
+    181, 6, 224, 189, 177, 224, 189, 178, 6, 224, 189, 177, 224, 189, 180, 6,
+    224, 190, 178, 224, 190, 128, 9, 224, 190, 178, 224, 189, 177, 224, 190, 128,
+    6, 224, 190, 179, 224, 190, 128, 9, 224, 190, 179, 224, 189, 177, 224, 190,
+    128, 6, 224, 189, 177, 224, 190, 128, 6, 224, 190, 146, 224, 190, 183, 6,
+    224, 190, 156, 224, 190, 183, 6, 224, 190, 161, 224, 190, 183, 6, 224, 190,
+    166, 224, 190, 183, 6, 224, 190, 171, 224, 190, 183, 6, 224, 190, 144, 224,
+    190, 181, 3, 97, 202, 190, 2, 115, 115, 5, 225, 188, 128, 206, 185, 5,
+    225, 188, 129, 206, 185, 5, 225, 188, 130, 206, 185, 5, 225, 188, 131, 206,
+    185, 5, 225, 188, 132, 206, 185, 5, 225, 188, 133, 206, 185, 5, 225, 188,
+    134, 206, 185, 5, 225, 188, 135, 206, 185, 5, 225, 188, 160, 206, 185, 5,
+    225, 188, 161, 206, 185, 5, 225, 188, 162, 206, 185, 5, 225, 188, 163, 206,
+    185, 5, 225, 188, 164, 206, 185, 5, 225, 188, 165, 206, 185, 5, 225, 188,
+    166, 206, 185, 5, 225, 188, 167, 206, 185, 5, 225, 189, 160, 206, 185, 5,
+    225, 189, 161, 206, 185, 5, 225, 189, 162, 206, 185, 5, 225, 189, 163, 206,
+    185, 5, 225, 189, 164, 206, 185, 5, 225, 189, 165, 206, 185, 5, 225, 189,
+    166, 206, 185, 5, 225, 189, 167, 206, 185, 5, 225, 189, 176, 206, 185, 4,
+    206, 177, 206, 185, 4, 206, 172, 206, 185, 5, 225, 190, 182, 206, 185, 5,
+    225, 189, 180, 206, 185, 4, 206, 183, 206, 185, 4, 206, 174, 206, 185, 5,
+    225, 191, 134, 206, 185, 5, 225, 189, 188, 206, 185, 4, 207, 137, 206, 185,
+    4, 207, 142, 206, 185, 5, 225, 191, 182, 206, 185, 2, 114, 115, 2, 110,
+    111, 2, 115, 109, 3, 116, 101, 108, 2, 116, 109, 3, 102, 97, 120, 2,
+    105, 105, 3, 105, 105, 105, 2, 105, 118, 2, 118, 105, 3, 118, 105, 105,
+    4, 118, 105, 105, 105, 2, 105, 120, 2, 120, 105, 3, 120, 105, 105, 2,
+    49, 48, 2, 49, 49, 2, 49, 50, 2, 49, 51, 2, 49, 52, 2, 49,
+    53, 2, 49, 54, 2, 49, 55, 2, 49, 56, 2, 49, 57, 2, 50, 48,
+    6, 227, 130, 136, 227, 130, 138, 6, 227, 130, 179, 227, 131, 136, 3, 112,
+    116, 101, 2, 50, 49, 2, 50, 50, 2, 50, 51, 2, 50, 52, 2, 50,
+    53, 2, 50, 54, 2, 50, 55, 2, 50, 56, 2, 50, 57, 2, 51, 48,
+    2, 51, 49, 2, 51, 50, 2, 51, 51, 2, 51, 52, 2, 51, 53, 6,
+    236, 176, 184, 234, 179, 160, 6, 236, 163, 188, 236, 157, 152, 2, 51, 54,
+    2, 51, 55, 2, 51, 56, 2, 51, 57, 2, 52, 48, 2, 52, 49, 2,
+    52, 50, 2, 52, 51, 2, 52, 52, 2, 52, 53, 2, 52, 54, 2, 52,
+    55, 2, 52, 56, 2, 52, 57, 2, 53, 48, 4, 49, 230, 156, 136, 4,
+    50, 230, 156, 136, 4, 51, 230, 156, 136, 4, 52, 230, 156, 136, 4, 53,
+    230, 156, 136, 4, 54, 230, 156, 136, 4, 55, 230, 156, 136, 4, 56, 230,
+    156, 136, 4, 57, 230, 156, 136, 5, 49, 48, 230, 156, 136, 5, 49, 49,
+    230, 156, 136, 5, 49, 50, 230, 156, 136, 2, 104, 103, 3, 101, 114, 103,
+    2, 101, 118, 3, 108, 116, 100, 6, 228, 187, 164, 229, 146, 140, 12, 227,
+    130, 162, 227, 131, 145, 227, 131, 188, 227, 131, 136, 12, 227, 130, 162, 227,
+    131, 171, 227, 131, 149, 227, 130, 161, 12, 227, 130, 162, 227, 131, 179, 227,
+    131, 154, 227, 130, 162, 9, 227, 130, 162, 227, 131, 188, 227, 131, 171, 12,
+    227, 130, 164, 227, 131, 139, 227, 131, 179, 227, 130, 176, 9, 227, 130, 164,
+    227, 131, 179, 227, 131, 129, 9, 227, 130, 166, 227, 130, 169, 227, 131, 179,
+    15, 227, 130, 168, 227, 130, 185, 227, 130, 175, 227, 131, 188, 227, 131, 137,
+    12, 227, 130, 168, 227, 131, 188, 227, 130, 171, 227, 131, 188, 9, 227, 130,
+    170, 227, 131, 179, 227, 130, 185, 9, 227, 130, 170, 227, 131, 188, 227, 131,
+    160, 9, 227, 130, 171, 227, 130, 164, 227, 131, 170, 12, 227, 130, 171, 227,
+    131, 169, 227, 131, 131, 227, 131, 136, 12, 227, 130, 171, 227, 131, 173, 227,
+    131, 170, 227, 131, 188, 9, 227, 130, 172, 227, 131, 173, 227, 131, 179, 9,
+    227, 130, 172, 227, 131, 179, 227, 131, 158, 6, 227, 130, 174, 227, 130, 172,
+    9, 227, 130, 174, 227, 131, 139, 227, 131, 188, 12, 227, 130, 173, 227, 131,
+    165, 227, 131, 170, 227, 131, 188, 12, 227, 130, 174, 227, 131, 171, 227, 131,
+    128, 227, 131, 188, 6, 227, 130, 173, 227, 131, 173, 15, 227, 130, 173, 227,
+    131, 173, 227, 130, 176, 227, 131, 169, 227, 131, 160, 18, 227, 130, 173, 227,
+    131, 173, 227, 131, 161, 227, 131, 188, 227, 131, 136, 227, 131, 171, 15, 227,
+    130, 173, 227, 131, 173, 227, 131, 175, 227, 131, 131, 227, 131, 136, 9, 227,
+    130, 176, 227, 131, 169, 227, 131, 160, 15, 227, 130, 176, 227, 131, 169, 227,
+    131, 160, 227, 131, 136, 227, 131, 179, 15, 227, 130, 175, 227, 131, 171, 227,
+    130, 188, 227, 130, 164, 227, 131, 173, 12, 227, 130, 175, 227, 131, 173, 227,
+    131, 188, 227, 131, 141, 9, 227, 130, 177, 227, 131, 188, 227, 130, 185, 9,
+    227, 130, 179, 227, 131, 171, 227, 131, 138, 9, 227, 130, 179, 227, 131, 188,
+    227, 131, 157, 12, 227, 130, 181, 227, 130, 164, 227, 130, 175, 227, 131, 171,
+    15, 227, 130, 181, 227, 131, 179, 227, 131, 129, 227, 131, 188, 227, 131, 160,
+    12, 227, 130, 183, 227, 131, 170, 227, 131, 179, 227, 130, 176, 9, 227, 130,
+    187, 227, 131, 179, 227, 131, 129, 9, 227, 130, 187, 227, 131, 179, 227, 131,
+    136, 9, 227, 131, 128, 227, 131, 188, 227, 130, 185, 6, 227, 131, 135, 227,
+    130, 183, 6, 227, 131, 137, 227, 131, 171, 6, 227, 131, 136, 227, 131, 179,
+    6, 227, 131, 138, 227, 131, 142, 9, 227, 131, 142, 227, 131, 131, 227, 131,
+    136, 9, 227, 131, 143, 227, 130, 164, 227, 131, 132, 15, 227, 131, 145, 227,
+    131, 188, 227, 130, 187, 227, 131, 179, 227, 131, 136, 9, 227, 131, 145, 227,
+    131, 188, 227, 131, 132, 12, 227, 131, 144, 227, 131, 188, 227, 131, 172, 227,
+    131, 171, 15, 227, 131, 148, 227, 130, 162, 227, 130, 185, 227, 131, 136, 227,
+    131, 171, 9, 227, 131, 148, 227, 130, 175, 227, 131, 171, 6, 227, 131, 148,
+    227, 130, 179, 6, 227, 131, 147, 227, 131, 171, 15, 227, 131, 149, 227, 130,
+    161, 227, 131, 169, 227, 131, 131, 227, 131, 137, 12, 227, 131, 149, 227, 130,
+    163, 227, 131, 188, 227, 131, 136, 15, 227, 131, 150, 227, 131, 131, 227, 130,
+    183, 227, 130, 167, 227, 131, 171, 9, 227, 131, 149, 227, 131, 169, 227, 131,
+    179, 15, 227, 131, 152, 227, 130, 175, 227, 130, 191, 227, 131, 188, 227, 131,
+    171, 6, 227, 131, 154, 227, 130, 189, 9, 227, 131, 154, 227, 131, 139, 227,
+    131, 146, 9, 227, 131, 152, 227, 131, 171, 227, 131, 132, 9, 227, 131, 154,
+    227, 131, 179, 227, 130, 185, 9, 227, 131, 154, 227, 131, 188, 227, 130, 184,
+    9, 227, 131, 153, 227, 131, 188, 227, 130, 191, 12, 227, 131, 157, 227, 130,
+    164, 227, 131, 179, 227, 131, 136, 9, 227, 131, 156, 227, 131, 171, 227, 131,
+    136, 6, 227, 131, 155, 227, 131, 179, 9, 227, 131, 157, 227, 131, 179, 227,
+    131, 137, 9, 227, 131, 155, 227, 131, 188, 227, 131, 171, 9, 227, 131, 155,
+    227, 131, 188, 227, 131, 179, 12, 227, 131, 158, 227, 130, 164, 227, 130, 175,
+    227, 131, 173, 9, 227, 131, 158, 227, 130, 164, 227, 131, 171, 9, 227, 131,
+    158, 227, 131, 131, 227, 131, 143, 9, 227, 131, 158, 227, 131, 171, 227, 130,
+    175, 15, 227, 131, 158, 227, 131, 179, 227, 130, 183, 227, 131, 167, 227, 131,
+    179, 12, 227, 131, 159, 227, 130, 175, 227, 131, 173, 227, 131, 179, 6, 227,
+    131, 159, 227, 131, 170, 15, 227, 131, 159, 227, 131, 170, 227, 131, 144, 227,
+    131, 188, 227, 131, 171, 6, 227, 131, 161, 227, 130, 172, 12, 227, 131, 161,
+    227, 130, 172, 227, 131, 136, 227, 131, 179, 12, 227, 131, 161, 227, 131, 188,
+    227, 131, 136, 227, 131, 171, 9, 227, 131, 164, 227, 131, 188, 227, 131, 137,
+    9, 227, 131, 164, 227, 131, 188, 227, 131, 171, 9, 227, 131, 166, 227, 130,
+    162, 227, 131, 179, 12, 227, 131, 170, 227, 131, 131, 227, 131, 136, 227, 131,
+    171, 6, 227, 131, 170, 227, 131, 169, 9, 227, 131, 171, 227, 131, 148, 227,
+    131, 188, 12, 227, 131, 171, 227, 131, 188, 227, 131, 150, 227, 131, 171, 6,
+    227, 131, 172, 227, 131, 160, 15, 227, 131, 172, 227, 131, 179, 227, 131, 136,
+    227, 130, 178, 227, 131, 179, 9, 227, 131, 175, 227, 131, 131, 227, 131, 136,
+    4, 48, 231, 130, 185, 4, 49, 231, 130, 185, 4, 50, 231, 130, 185, 4,
+    51, 231, 130, 185, 4, 52, 231, 130, 185, 4, 53, 231, 130, 185, 4, 54,
+    231, 130, 185, 4, 55, 231, 130, 185, 4, 56, 231, 130, 185, 4, 57, 231,
+    130, 185, 5, 49, 48, 231, 130, 185, 5, 49, 49, 231, 130, 185, 5, 49,
+    50, 231, 130, 185, 5, 49, 51, 231, 130, 185, 5, 49, 52, 231, 130, 185,
+    5, 49, 53, 231, 130, 185, 5, 49, 54, 231, 130, 185, 5, 49, 55, 231,
+    130, 185, 5, 49, 56, 231, 130, 185, 5, 49, 57, 231, 130, 185, 5, 50,
+    48, 231, 130, 185, 5, 50, 49, 231, 130, 185, 5, 50, 50, 231, 130, 185,
+    5, 50, 51, 231, 130, 185, 5, 50, 52, 231, 130, 185, 3, 104, 112, 97,
+    2, 100, 97, 2, 97, 117, 3, 98, 97, 114, 2, 111, 118, 2, 112, 99,
+    2, 100, 109, 3, 100, 109, 50, 3, 100, 109, 51, 2, 105, 117, 6, 229,
+    185, 179, 230, 136, 144, 6, 230, 152, 173, 229, 146, 140, 6, 229, 164, 167,
+    230, 173, 163, 6, 230, 152, 142, 230, 178, 187, 12, 230, 160, 170, 229, 188,
+    143, 228, 188, 154, 231, 164, 190, 2, 112, 97, 2, 110, 97, 3, 206, 188,
+    97, 2, 109, 97, 2, 107, 97, 2, 107, 98, 2, 109, 98, 2, 103, 98,
+    3, 99, 97, 108, 4, 107, 99, 97, 108, 2, 112, 102, 2, 110, 102, 3,
+    206, 188, 102, 3, 206, 188, 103, 2, 109, 103, 2, 107, 103, 2, 104, 122,
+    3, 107, 104, 122, 3, 109, 104, 122, 3, 103, 104, 122, 3, 116, 104, 122,
+    3, 206, 188, 108, 2, 109, 108, 2, 100, 108, 2, 107, 108, 2, 102, 109,
+    2, 110, 109, 3, 206, 188, 109, 2, 109, 109, 2, 99, 109, 2, 107, 109,
+    3, 109, 109, 50, 3, 99, 109, 50, 2, 109, 50, 3, 107, 109, 50, 3,
+    109, 109, 51, 3, 99, 109, 51, 2, 109, 51, 3, 107, 109, 51, 3, 107,
+    112, 97, 3, 109, 112, 97, 3, 103, 112, 97, 3, 114, 97, 100, 2, 112,
+    115, 2, 110, 115, 3, 206, 188, 115, 2, 109, 115, 2, 112, 118, 2, 110,
+    118, 3, 206, 188, 118, 2, 109, 118, 2, 107, 118, 2, 112, 119, 2, 110,
+    119, 3, 206, 188, 119, 2, 109, 119, 2, 107, 119, 3, 107, 207, 137, 3,
+    109, 207, 137, 2, 98, 113, 2, 99, 99, 2, 99, 100, 2, 100, 98, 2,
+    103, 121, 2, 104, 97, 2, 104, 112, 2, 105, 110, 2, 107, 107, 2, 107,
+    116, 2, 108, 109, 2, 108, 110, 3, 108, 111, 103, 2, 108, 120, 3, 109,
+    105, 108, 3, 109, 111, 108, 2, 112, 104, 3, 112, 112, 109, 2, 112, 114,
+    2, 115, 114, 2, 115, 118, 2, 119, 98, 4, 49, 230, 151, 165, 4, 50,
+    230, 151, 165, 4, 51, 230, 151, 165, 4, 52, 230, 151, 165, 4, 53, 230,
+    151, 165, 4, 54, 230, 151, 165, 4, 55, 230, 151, 165, 4, 56, 230, 151,
+    165, 4, 57, 230, 151, 165, 5, 49, 48, 230, 151, 165, 5, 49, 49, 230,
+    151, 165, 5, 49, 50, 230, 151, 165, 5, 49, 51, 230, 151, 165, 5, 49,
+    52, 230, 151, 165, 5, 49, 53, 230, 151, 165, 5, 49, 54, 230, 151, 165,
+    5, 49, 55, 230, 151, 165, 5, 49, 56, 230, 151, 165, 5, 49, 57, 230,
+    151, 165, 5, 50, 48, 230, 151, 165, 5, 50, 49, 230, 151, 165, 5, 50,
+    50, 230, 151, 165, 5, 50, 51, 230, 151, 165, 5, 50, 52, 230, 151, 165,
+    5, 50, 53, 230, 151, 165, 5, 50, 54, 230, 151, 165, 5, 50, 55, 230,
+    151, 165, 5, 50, 56, 230, 151, 165, 5, 50, 57, 230, 151, 165, 5, 51,
+    48, 230, 151, 165, 5, 51, 49, 230, 151, 165, 3, 103, 97, 108, 2, 102,
+    102, 2, 102, 105, 2, 102, 108, 3, 102, 102, 105, 3, 102, 102, 108, 2,
+    115, 116, 4, 213, 180, 213, 182, 4, 213, 180, 213, 165, 4, 213, 180, 213,
+    171, 4, 213, 190, 213, 182, 4, 213, 180, 213, 173, 4, 215, 153, 214, 180,
+    4, 215, 178, 214, 183, 4, 215, 169, 215, 129, 4, 215, 169, 215, 130, 6,
+    215, 169, 214, 188, 215, 129, 6, 215, 169, 214, 188, 215, 130, 4, 215, 144,
+    214, 183, 4, 215, 144, 214, 184, 4, 215, 144, 214, 188, 4, 215, 145, 214,
+    188, 4, 215, 146, 214, 188, 4, 215, 147, 214, 188, 4, 215, 148, 214, 188,
+    4, 215, 149, 214, 188, 4, 215, 150, 214, 188, 4, 215, 152, 214, 188, 4,
+    215, 153, 214, 188, 4, 215, 154, 214, 188, 4, 215, 155, 214, 188, 4, 215,
+    156, 214, 188, 4, 215, 158, 214, 188, 4, 215, 160, 214, 188, 4, 215, 161,
+    214, 188, 4, 215, 163, 214, 188, 4, 215, 164, 214, 188, 4, 215, 166, 214,
+    188, 4, 215, 167, 214, 188, 4, 215, 168, 214, 188, 4, 215, 169, 214, 188,
+    4, 215, 170, 214, 188, 4, 215, 149, 214, 185, 4, 215, 145, 214, 191, 4,
+    215, 155, 214, 191, 4, 215, 164, 214, 191, 4, 215, 144, 215, 156, 4, 216,
+    166, 216, 167, 4, 216, 166, 219, 149, 4, 216, 166, 217, 136, 4, 216, 166,
+    219, 135, 4, 216, 166, 219, 134, 4, 216, 166, 219, 136, 4, 216, 166, 219,
+    144, 4, 216, 166, 217, 137, 4, 216, 166, 216, 172, 4, 216, 166, 216, 173,
+    4, 216, 166, 217, 133, 4, 216, 166, 217, 138, 4, 216, 168, 216, 172, 4,
+    216, 168, 216, 173, 4, 216, 168, 216, 174, 4, 216, 168, 217, 133, 4, 216,
+    168, 217, 137, 4, 216, 168, 217, 138, 4, 216, 170, 216, 172, 4, 216, 170,
+    216, 173, 4, 216, 170, 216, 174, 4, 216, 170, 217, 133, 4, 216, 170, 217,
+    137, 4, 216, 170, 217, 138, 4, 216, 171, 216, 172, 4, 216, 171, 217, 133,
+    4, 216, 171, 217, 137, 4, 216, 171, 217, 138, 4, 216, 172, 216, 173, 4,
+    216, 172, 217, 133, 4, 216, 173, 216, 172, 4, 216, 173, 217, 133, 4, 216,
+    174, 216, 172, 4, 216, 174, 216, 173, 4, 216, 174, 217, 133, 4, 216, 179,
+    216, 172, 4, 216, 179, 216, 173, 4, 216, 179, 216, 174, 4, 216, 179, 217,
+    133, 4, 216, 181, 216, 173, 4, 216, 181, 217, 133, 4, 216, 182, 216, 172,
+    4, 216, 182, 216, 173, 4, 216, 182, 216, 174, 4, 216, 182, 217, 133, 4,
+    216, 183, 216, 173, 4, 216, 183, 217, 133, 4, 216, 184, 217, 133, 4, 216,
+    185, 216, 172, 4, 216, 185, 217, 133, 4, 216, 186, 216, 172, 4, 216, 186,
+    217, 133, 4, 217, 129, 216, 172, 4, 217, 129, 216, 173, 4, 217, 129, 216,
+    174, 4, 217, 129, 217, 133, 4, 217, 129, 217, 137, 4, 217, 129, 217, 138,
+    4, 217, 130, 216, 173, 4, 217, 130, 217, 133, 4, 217, 130, 217, 137, 4,
+    217, 130, 217, 138, 4, 217, 131, 216, 167, 4, 217, 131, 216, 172, 4, 217,
+    131, 216, 173, 4, 217, 131, 216, 174, 4, 217, 131, 217, 132, 4, 217, 131,
+    217, 133, 4, 217, 131, 217, 137, 4, 217, 131, 217, 138, 4, 217, 132, 216,
+    172, 4, 217, 132, 216, 173, 4, 217, 132, 216, 174, 4, 217, 132, 217, 133,
+    4, 217, 132, 217, 137, 4, 217, 132, 217, 138, 4, 217, 133, 216, 172, 4,
+    217, 133, 216, 173, 4, 217, 133, 216, 174, 4, 217, 133, 217, 133, 4, 217,
+    133, 217, 137, 4, 217, 133, 217, 138, 4, 217, 134, 216, 172, 4, 217, 134,
+    216, 173, 4, 217, 134, 216, 174, 4, 217, 134, 217, 133, 4, 217, 134, 217,
+    137, 4, 217, 134, 217, 138, 4, 217, 135, 216, 172, 4, 217, 135, 217, 133,
+    4, 217, 135, 217, 137, 4, 217, 135, 217, 138, 4, 217, 138, 216, 172, 4,
+    217, 138, 216, 173, 4, 217, 138, 216, 174, 4, 217, 138, 217, 133, 4, 217,
+    138, 217, 137, 4, 217, 138, 217, 138, 4, 216, 176, 217, 176, 4, 216, 177,
+    217, 176, 4, 217, 137, 217, 176, 4, 216, 166, 216, 177, 4, 216, 166, 216,
+    178, 4, 216, 166, 217, 134, 4, 216, 168, 216, 177, 4, 216, 168, 216, 178,
+    4, 216, 168, 217, 134, 4, 216, 170, 216, 177, 4, 216, 170, 216, 178, 4,
+    216, 170, 217, 134, 4, 216, 171, 216, 177, 4, 216, 171, 216, 178, 4, 216,
+    171, 217, 134, 4, 217, 133, 216, 167, 4, 217, 134, 216, 177, 4, 217, 134,
+    216, 178, 4, 217, 134, 217, 134, 4, 217, 138, 216, 177, 4, 217, 138, 216,
+    178, 4, 217, 138, 217, 134, 4, 216, 166, 216, 174, 4, 216, 166, 217, 135,
+    4, 216, 168, 217, 135, 4, 216, 170, 217, 135, 4, 216, 181, 216, 174, 4,
+    217, 132, 217, 135, 4, 217, 134, 217, 135, 4, 217, 135, 217, 176, 4, 217,
+    138, 217, 135, 4, 216, 171, 217, 135, 4, 216, 179, 217, 135, 4, 216, 180,
+    217, 133, 4, 216, 180, 217, 135, 6, 217, 128, 217, 142, 217, 145, 6, 217,
+    128, 217, 143, 217, 145, 6, 217, 128, 217, 144, 217, 145, 4, 216, 183, 217,
+    137, 4, 216, 183, 217, 138, 4, 216, 185, 217, 137, 4, 216, 185, 217, 138,
+    4, 216, 186, 217, 137, 4, 216, 186, 217, 138, 4, 216, 179, 217, 137, 4,
+    216, 179, 217, 138, 4, 216, 180, 217, 137, 4, 216, 180, 217, 138, 4, 216,
+    173, 217, 137, 4, 216, 173, 217, 138, 4, 216, 172, 217, 137, 4, 216, 172,
+    217, 138, 4, 216, 174, 217, 137, 4, 216, 174, 217, 138, 4, 216, 181, 217,
+    137, 4, 216, 181, 217, 138, 4, 216, 182, 217, 137, 4, 216, 182, 217, 138,
+    4, 216, 180, 216, 172, 4, 216, 180, 216, 173, 4, 216, 180, 216, 174, 4,
+    216, 180, 216, 177, 4, 216, 179, 216, 177, 4, 216, 181, 216, 177, 4, 216,
+    182, 216, 177, 4, 216, 167, 217, 139, 6, 216, 170, 216, 172, 217, 133, 6,
+    216, 170, 216, 173, 216, 172, 6, 216, 170, 216, 173, 217, 133, 6, 216, 170,
+    216, 174, 217, 133, 6, 216, 170, 217, 133, 216, 172, 6, 216, 170, 217, 133,
+    216, 173, 6, 216, 170, 217, 133, 216, 174, 6, 216, 172, 217, 133, 216, 173,
+    6, 216, 173, 217, 133, 217, 138, 6, 216, 173, 217, 133, 217, 137, 6, 216,
+    179, 216, 173, 216, 172, 6, 216, 179, 216, 172, 216, 173, 6, 216, 179, 216,
+    172, 217, 137, 6, 216, 179, 217, 133, 216, 173, 6, 216, 179, 217, 133, 216,
+    172, 6, 216, 179, 217, 133, 217, 133, 6, 216, 181, 216, 173, 216, 173, 6,
+    216, 181, 217, 133, 217, 133, 6, 216, 180, 216, 173, 217, 133, 6, 216, 180,
+    216, 172, 217, 138, 6, 216, 180, 217, 133, 216, 174, 6, 216, 180, 217, 133,
+    217, 133, 6, 216, 182, 216, 173, 217, 137, 6, 216, 182, 216, 174, 217, 133,
+    6, 216, 183, 217, 133, 216, 173, 6, 216, 183, 217, 133, 217, 133, 6, 216,
+    183, 217, 133, 217, 138, 6, 216, 185, 216, 172, 217, 133, 6, 216, 185, 217,
+    133, 217, 133, 6, 216, 185, 217, 133, 217, 137, 6, 216, 186, 217, 133, 217,
+    133, 6, 216, 186, 217, 133, 217, 138, 6, 216, 186, 217, 133, 217, 137, 6,
+    217, 129, 216, 174, 217, 133, 6, 217, 130, 217, 133, 216, 173, 6, 217, 130,
+    217, 133, 217, 133, 6, 217, 132, 216, 173, 217, 133, 6, 217, 132, 216, 173,
+    217, 138, 6, 217, 132, 216, 173, 217, 137, 6, 217, 132, 216, 172, 216, 172,
+    6, 217, 132, 216, 174, 217, 133, 6, 217, 132, 217, 133, 216, 173, 6, 217,
+    133, 216, 173, 216, 172, 6, 217, 133, 216, 173, 217, 133, 6, 217, 133, 216,
+    173, 217, 138, 6, 217, 133, 216, 172, 216, 173, 6, 217, 133, 216, 172, 217,
+    133, 6, 217, 133, 216, 174, 216, 172, 6, 217, 133, 216, 174, 217, 133, 6,
+    217, 133, 216, 172, 216, 174, 6, 217, 135, 217, 133, 216, 172, 6, 217, 135,
+    217, 133, 217, 133, 6, 217, 134, 216, 173, 217, 133, 6, 217, 134, 216, 173,
+    217, 137, 6, 217, 134, 216, 172, 217, 133, 6, 217, 134, 216, 172, 217, 137,
+    6, 217, 134, 217, 133, 217, 138, 6, 217, 134, 217, 133, 217, 137, 6, 217,
+    138, 217, 133, 217, 133, 6, 216, 168, 216, 174, 217, 138, 6, 216, 170, 216,
+    172, 217, 138, 6, 216, 170, 216, 172, 217, 137, 6, 216, 170, 216, 174, 217,
+    138, 6, 216, 170, 216, 174, 217, 137, 6, 216, 170, 217, 133, 217, 138, 6,
+    216, 170, 217, 133, 217, 137, 6, 216, 172, 217, 133, 217, 138, 6, 216, 172,
+    216, 173, 217, 137, 6, 216, 172, 217, 133, 217, 137, 6, 216, 179, 216, 174,
+    217, 137, 6, 216, 181, 216, 173, 217, 138, 6, 216, 180, 216, 173, 217, 138,
+    6, 216, 182, 216, 173, 217, 138, 6, 217, 132, 216, 172, 217, 138, 6, 217,
+    132, 217, 133, 217, 138, 6, 217, 138, 216, 173, 217, 138, 6, 217, 138, 216,
+    172, 217, 138, 6, 217, 138, 217, 133, 217, 138, 6, 217, 133, 217, 133, 217,
+    138, 6, 217, 130, 217, 133, 217, 138, 6, 217, 134, 216, 173, 217, 138, 6,
+    216, 185, 217, 133, 217, 138, 6, 217, 131, 217, 133, 217, 138, 6, 217, 134,
+    216, 172, 216, 173, 6, 217, 133, 216, 174, 217, 138, 6, 217, 132, 216, 172,
+    217, 133, 6, 217, 131, 217, 133, 217, 133, 6, 216, 172, 216, 173, 217, 138,
+    6, 216, 173, 216, 172, 217, 138, 6, 217, 133, 216, 172, 217, 138, 6, 217,
+    129, 217, 133, 217, 138, 6, 216, 168, 216, 173, 217, 138, 6, 216, 179, 216,
+    174, 217, 138, 6, 217, 134, 216, 172, 217, 138, 6, 216, 181, 217, 132, 219,
+    146, 6, 217, 130, 217, 132, 219, 146, 8, 216, 167, 217, 132, 217, 132, 217,
+    135, 8, 216, 167, 217, 131, 216, 168, 216, 177, 8, 217, 133, 216, 173, 217,
+    133, 216, 175, 8, 216, 181, 217, 132, 216, 185, 217, 133, 8, 216, 177, 216,
+    179, 217, 136, 217, 132, 8, 216, 185, 217, 132, 217, 138, 217, 135, 8, 217,
+    136, 216, 179, 217, 132, 217, 133, 6, 216, 181, 217, 132, 217, 137, 8, 216,
+    177, 219, 140, 216, 167, 217, 132, 4, 217, 128, 217, 139, 4, 217, 128, 217,
+    142, 4, 217, 128, 217, 143, 4, 217, 128, 217, 144, 4, 217, 128, 217, 145,
+    4, 217, 128, 217, 146, 4, 217, 132, 216, 162, 4, 217, 132, 216, 163, 4,
+    217, 132, 216, 165, 4, 217, 132, 216, 167, 2, 119, 122, 2, 104, 118, 2,
+    115, 100, 3, 112, 112, 118, 2, 119, 99, 2, 109, 99, 2, 109, 100, 2,
+    109, 114, 2, 100, 106, 6, 227, 129, 187, 227, 129, 139, 6, 227, 130, 179,
+    227, 130, 179,
+};
+
+inline constexpr std::uint32_t case_fold_sequence_flag = 0x80000000;
+
+inline constexpr std::uint32_t case_fold_keys[] = {
+    65, 66, 67, 68, 69, 70, 71, 72,
+    73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88,
+    89, 90, 181, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204,
+    205, 206, 207, 208, 209, 210, 211, 212,
+    213, 214, 216, 217, 218, 219, 220, 221,
+    222, 223, 256, 258, 260, 262, 264, 266,
+    268, 270, 272, 274, 276, 278, 280, 282,
+    284, 286, 288, 290, 292, 294, 296, 298,
+    300, 302, 304, 306, 308, 310, 313, 315,
+    317, 319, 321, 323, 325, 327, 329, 330,
+    332, 334, 336, 338, 340, 342, 344, 346,
+    348, 350, 352, 354, 356, 358, 360, 362,
+    364, 366, 368, 370, 372, 374, 376, 377,
+    379, 381, 383, 385, 386, 388, 390, 391,
+    393, 394, 395, 398, 399, 400, 401, 403,
+    404, 406, 407, 408, 412, 413, 415, 416,
+    418, 420, 422, 423, 425, 428, 430, 431,
+    433, 434, 435, 437, 439, 440, 444, 452,
+    453, 455, 456, 458, 459, 461, 463, 465,
+    467, 469, 471, 473, 475, 478, 480, 482,
+    484, 486, 488, 490, 492, 494, 496, 497,
+    498, 500, 502, 503, 504, 506, 508, 510,
+    512, 514, 516, 518, 520, 522, 524, 526,
+    528, 530, 532, 534, 536, 538, 540, 542,
+    544, 546, 548, 550, 552, 554, 556, 558,
+    560, 562, 570, 571, 573, 574, 577, 579,
+    580, 581, 582, 584, 586, 588, 590, 837,
+    880, 882, 886, 895, 902, 904, 905, 906,
+    908, 910, 911, 912, 913, 914, 915, 916,
+    917, 918, 919, 920, 921, 922, 923, 924,
+    925, 926, 927, 928, 929, 931, 932, 933,
+    934, 935, 936, 937, 938, 939, 944, 962,
+    975, 976, 977, 981, 982, 984, 986, 988,
+    990, 992, 994, 996, 998, 1000, 1002, 1004,
+    1006, 1008, 1009, 1012, 1013, 1015, 1017, 1018,
+    1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+    1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+    1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
+    1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
+    1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068,
+    1069, 1070, 1071, 1120, 1122, 1124, 1126, 1128,
+    1130, 1132, 1134, 1136, 1138, 1140, 1142, 1144,
+    1146, 1148, 1150, 1152, 1162, 1164, 1166, 1168,
+    1170, 1172, 1174, 1176, 1178, 1180, 1182, 1184,
+    1186, 1188, 1190, 1192, 1194, 1196, 1198, 1200,
+    1202, 1204, 1206, 1208, 1210, 1212, 1214, 1216,
+    1217, 1219, 1221, 1223, 1225, 1227, 1229, 1232,
+    1234, 1236, 1238, 1240, 1242, 1244, 1246, 1248,
+    1250, 1252, 1254, 1256, 1258, 1260, 1262, 1264,
+    1266, 1268, 1270, 1272, 1274, 1276, 1278, 1280,
+    1282, 1284, 1286, 1288, 1290, 1292, 1294, 1296,
+    1298, 1300, 1302, 1304, 1306, 1308, 1310, 1312,
+    1314, 1316, 1318, 1320, 1322, 1324, 1326, 1329,
+    1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337,
+    1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345,
+    1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
+    1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
+    1362, 1363, 1364, 1365, 1366, 1415, 4256, 4257,
+    4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265,
+    4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273,
+    4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281,
+    4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289,
+    4290, 4291, 4292, 4293, 4295, 4301, 5112, 5113,
+    5114, 5115, 5116, 5117, 7296, 7297, 7298, 7299,
+    7300, 7301, 7302, 7303, 7304, 7312, 7313, 7314,
+    7315, 7316, 7317, 7318, 7319, 7320, 7321, 7322,
+    7323, 7324, 7325, 7326, 7327, 7328, 7329, 7330,
+    7331, 7332, 7333, 7334, 7335, 7336, 7337, 7338,
+    7339, 7340, 7341, 7342, 7343, 7344, 7345, 7346,
+    7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354,
+    7357, 7358, 7359, 7680, 7682, 7684, 7686, 7688,
+    7690, 7692, 7694, 7696, 7698, 7700, 7702, 7704,
+    7706, 7708, 7710, 7712, 7714, 7716, 7718, 7720,
+    7722, 7724, 7726, 7728, 7730, 7732, 7734, 7736,
+    7738, 7740, 7742, 7744, 7746, 7748, 7750, 7752,
+    7754, 7756, 7758, 7760, 7762, 7764, 7766, 7768,
+    7770, 7772, 7774, 7776, 7778, 7780, 7782, 7784,
+    7786, 7788, 7790, 7792, 7794, 7796, 7798, 7800,
+    7802, 7804, 7806, 7808, 7810, 7812, 7814, 7816,
+    7818, 7820, 7822, 7824, 7826, 7828, 7830, 7831,
+    7832, 7833, 7834, 7835, 7838, 7840, 7842, 7844,
+    7846, 7848, 7850, 7852, 7854, 7856, 7858, 7860,
+    7862, 7864, 7866, 7868, 7870, 7872, 7874, 7876,
+    7878, 7880, 7882, 7884, 7886, 7888, 7890, 7892,
+    7894, 7896, 7898, 7900, 7902, 7904, 7906, 7908,
+    7910, 7912, 7914, 7916, 7918, 7920, 7922, 7924,
+    7926, 7928, 7930, 7932, 7934, 7944, 7945, 7946,
+    7947, 7948, 7949, 7950, 7951, 7960, 7961, 7962,
+    7963, 7964, 7965, 7976, 7977, 7978, 7979, 7980,
+    7981, 7982, 7983, 7992, 7993, 7994, 7995, 7996,
+    7997, 7998, 7999, 8008, 8009, 8010, 8011, 8012,
+    8013, 8016, 8018, 8020, 8022, 8025, 8027, 8029,
+    8031, 8040, 8041, 8042, 8043, 8044, 8045, 8046,
+    8047, 8064, 8065, 8066, 8067, 8068, 8069, 8070,
+    8071, 8072, 8073, 8074, 8075, 8076, 8077, 8078,
+    8079, 8080, 8081, 8082, 8083, 8084, 8085, 8086,
+    8087, 8088, 8089, 8090, 8091, 8092, 8093, 8094,
+    8095, 8096, 8097, 8098, 8099, 8100, 8101, 8102,
+    8103, 8104, 8105, 8106, 8107, 8108, 8109, 8110,
+    8111, 8114, 8115, 8116, 8118, 8119, 8120, 8121,
+    8122, 8123, 8124, 8126, 8130, 8131, 8132, 8134,
+    8135, 8136, 8137, 8138, 8139, 8140, 8146, 8147,
+    8150, 8151, 8152, 8153, 8154, 8155, 8162, 8163,
+    8164, 8166, 8167, 8168, 8169, 8170, 8171, 8172,
+    8178, 8179, 8180, 8182, 8183, 8184, 8185, 8186,
+    8187, 8188, 8486, 8490, 8491, 8498, 8544, 8545,
+    8546, 8547, 8548, 8549, 8550, 8551, 8552, 8553,
+    8554, 8555, 8556, 8557, 8558, 8559, 8579, 9398,
+    9399, 9400, 9401, 9402, 9403, 9404, 9405, 9406,
+    9407, 9408, 9409, 9410, 9411, 9412, 9413, 9414,
+    9415, 9416, 9417, 9418, 9419, 9420, 9421, 9422,
+    9423, 11264, 11265, 11266, 11267, 11268, 11269, 11270,
+    11271, 11272, 11273, 11274, 11275, 11276, 11277, 11278,
+    11279, 11280, 11281, 11282, 11283, 11284, 11285, 11286,
+    11287, 11288, 11289, 11290, 11291, 11292, 11293, 11294,
+    11295, 11296, 11297, 11298, 11299, 11300, 11301, 11302,
+    11303, 11304, 11305, 11306, 11307, 11308, 11309, 11310,
+    11311, 11360, 11362, 11363, 11364, 11367, 11369, 11371,
+    11373, 11374, 11375, 11376, 11378, 11381, 11390, 11391,
+    11392, 11394, 11396, 11398, 11400, 11402, 11404, 11406,
+    11408, 11410, 11412, 11414, 11416, 11418, 11420, 11422,
+    11424, 11426, 11428, 11430, 11432, 11434, 11436, 11438,
+    11440, 11442, 11444, 11446, 11448, 11450, 11452, 11454,
+    11456, 11458, 11460, 11462, 11464, 11466, 11468, 11470,
+    11472, 11474, 11476, 11478, 11480, 11482, 11484, 11486,
+    11488, 11490, 11499, 11501, 11506, 42560, 42562, 42564,
+    42566, 42568, 42570, 42572, 42574, 42576, 42578, 42580,
+    42582, 42584, 42586, 42588, 42590, 42592, 42594, 42596,
+    42598, 42600, 42602, 42604, 42624, 42626, 42628, 42630,
+    42632, 42634, 42636, 42638, 42640, 42642, 42644, 42646,
+    42648, 42650, 42786, 42788, 42790, 42792, 42794, 42796,
+    42798, 42802, 42804, 42806, 42808, 42810, 42812, 42814,
+    42816, 42818, 42820, 42822, 42824, 42826, 42828, 42830,
+    42832, 42834, 42836, 42838, 42840, 42842, 42844, 42846,
+    42848, 42850, 42852, 42854, 42856, 42858, 42860, 42862,
+    42873, 42875, 42877, 42878, 42880, 42882, 42884, 42886,
+    42891, 42893, 42896, 42898, 42902, 42904, 42906, 42908,
+    42910, 42912, 42914, 42916, 42918, 42920, 42922, 42923,
+    42924, 42925, 42926, 42928, 42929, 42930, 42931, 42932,
+    42934, 42936, 42938, 42940, 42942, 42944, 42946, 42948,
+    42949, 42950, 42951, 42953, 42960, 42966, 42968, 42997,
+    43888, 43889, 43890, 43891, 43892, 43893, 43894, 43895,
+    43896, 43897, 43898, 43899, 43900, 43901, 43902, 43903,
+    43904, 43905, 43906, 43907, 43908, 43909, 43910, 43911,
+    43912, 43913, 43914, 43915, 43916, 43917, 43918, 43919,
+    43920, 43921, 43922, 43923, 43924, 43925, 43926, 43927,
+    43928, 43929, 43930, 43931, 43932, 43933, 43934, 43935,
+    43936, 43937, 43938, 43939, 43940, 43941, 43942, 43943,
+    43944, 43945, 43946, 43947, 43948, 43949, 43950, 43951,
+    43952, 43953, 43954, 43955, 43956, 43957, 43958, 43959,
+    43960, 43961, 43962, 43963, 43964, 43965, 43966, 43967,
+    64256, 64257, 64258, 64259, 64260, 64261, 64262, 64275,
+    64276, 64277, 64278, 64279, 65313, 65314, 65315, 65316,
+    65317, 65318, 65319, 65320, 65321, 65322, 65323, 65324,
+    65325, 65326, 65327, 65328, 65329, 65330, 65331, 65332,
+    65333, 65334, 65335, 65336, 65337, 65338, 66560, 66561,
+    66562, 66563, 66564, 66565, 66566, 66567, 66568, 66569,
+    66570, 66571, 66572, 66573, 66574, 66575, 66576, 66577,
+    66578, 66579, 66580, 66581, 66582, 66583, 66584, 66585,
+    66586, 66587, 66588, 66589, 66590, 66591, 66592, 66593,
+    66594, 66595, 66596, 66597, 66598, 66599, 66736, 66737,
+    66738, 66739, 66740, 66741, 66742, 66743, 66744, 66745,
+    66746, 66747, 66748, 66749, 66750, 66751, 66752, 66753,
+    66754, 66755, 66756, 66757, 66758, 66759, 66760, 66761,
+    66762, 66763, 66764, 66765, 66766, 66767, 66768, 66769,
+    66770, 66771, 66928, 66929, 66930, 66931, 66932, 66933,
+    66934, 66935, 66936, 66937, 66938, 66940, 66941, 66942,
+    66943, 66944, 66945, 66946, 66947, 66948, 66949, 66950,
+    66951, 66952, 66953, 66954, 66956, 66957, 66958, 66959,
+    66960, 66961, 66962, 66964, 66965, 68736, 68737, 68738,
+    68739, 68740, 68741, 68742, 68743, 68744, 68745, 68746,
+    68747, 68748, 68749, 68750, 68751, 68752, 68753, 68754,
+    68755, 68756, 68757, 68758, 68759, 68760, 68761, 68762,
+    68763, 68764, 68765, 68766, 68767, 68768, 68769, 68770,
+    68771, 68772, 68773, 68774, 68775, 68776, 68777, 68778,
+    68779, 68780, 68781, 68782, 68783, 68784, 68785, 68786,
+    71840, 71841, 71842, 71843, 71844, 71845, 71846, 71847,
+    71848, 71849, 71850, 71851, 71852, 71853, 71854, 71855,
+    71856, 71857, 71858, 71859, 71860, 71861, 71862, 71863,
+    71864, 71865, 71866, 71867, 71868, 71869, 71870, 71871,
+    93760, 93761, 93762, 93763, 93764, 93765, 93766, 93767,
+    93768, 93769, 93770, 93771, 93772, 93773, 93774, 93775,
+    93776, 93777, 93778, 93779, 93780, 93781, 93782, 93783,
+    93784, 93785, 93786, 93787, 93788, 93789, 93790, 93791,
+    125184, 125185, 125186, 125187, 125188, 125189, 125190, 125191,
+    125192, 125193, 125194, 125195, 125196, 125197, 125198, 125199,
+    125200, 125201, 125202, 125203, 125204, 125205, 125206, 125207,
+    125208, 125209, 125210, 125211, 125212, 125213, 125214, 125215,
+    125216, 125217,
+};
+
+inline constexpr std::uint32_t case_fold_values[] = {
+    97, 98, 99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 956, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236,
+    237, 238, 239, 240, 241, 242, 243, 244,
+    245, 246, 248, 249, 250, 251, 252, 253,
+    254, 2147483648, 257, 259, 261, 263, 265, 267,
+    269, 271, 273, 275, 277, 279, 281, 283,
+    285, 287, 289, 291, 293, 295, 297, 299,
+    301, 303, 2147483651, 307, 309, 311, 314, 316,
+    318, 320, 322, 324, 326, 328, 2147483654, 331,
+    333, 335, 337, 339, 341, 343, 345, 347,
+    349, 351, 353, 355, 357, 359, 361, 363,
+    365, 367, 369, 371, 373, 375, 255, 378,
+    380, 382, 115, 595, 387, 389, 596, 392,
+    598, 599, 396, 477, 601, 603, 402, 608,
+    611, 617, 616, 409, 623, 626, 629, 417,
+    419, 421, 640, 424, 643, 429, 648, 432,
+    650, 651, 436, 438, 658, 441, 445, 454,
+    454, 457, 457, 460, 460, 462, 464, 466,
+    468, 470, 472, 474, 476, 479, 481, 483,
+    485, 487, 489, 491, 493, 495, 2147483657, 499,
+    499, 501, 405, 447, 505, 507, 509, 511,
+    513, 515, 517, 519, 521, 523, 525, 527,
+    529, 531, 533, 535, 537, 539, 541, 543,
+    414, 547, 549, 551, 553, 555, 557, 559,
+    561, 563, 11365, 572, 410, 11366, 578, 384,
+    649, 652, 583, 585, 587, 589, 591, 953,
+    881, 883, 887, 1011, 940, 941, 942, 943,
+    972, 973, 974, 2147483660, 945, 946, 947, 948,
+    949, 950, 951, 952, 953, 954, 955, 956,
+    957, 958, 959, 960, 961, 963, 964, 965,
+    966, 967, 968, 969, 970, 971, 2147483664, 963,
+    983, 946, 952, 966, 960, 985, 987, 989,
+    991, 993, 995, 997, 999, 1001, 1003, 1005,
+    1007, 954, 961, 952, 949, 1016, 1010, 1019,
+    891, 892, 893, 1104, 1105, 1106, 1107, 1108,
+    1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116,
+    1117, 1118, 1119, 1072, 1073, 1074, 1075, 1076,
+    1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
+    1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+    1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100,
+    1101, 1102, 1103, 1121, 1123, 1125, 1127, 1129,
+    1131, 1133, 1135, 1137, 1139, 1141, 1143, 1145,
+    1147, 1149, 1151, 1153, 1163, 1165, 1167, 1169,
+    1171, 1173, 1175, 1177, 1179, 1181, 1183, 1185,
+    1187, 1189, 1191, 1193, 1195, 1197, 1199, 1201,
+    1203, 1205, 1207, 1209, 1211, 1213, 1215, 1231,
+    1218, 1220, 1222, 1224, 1226, 1228, 1230, 1233,
+    1235, 1237, 1239, 1241, 1243, 1245, 1247, 1249,
+    1251, 1253, 1255, 1257, 1259, 1261, 1263, 1265,
+    1267, 1269, 1271, 1273, 1275, 1277, 1279, 1281,
+    1283, 1285, 1287, 1289, 1291, 1293, 1295, 1297,
+    1299, 1301, 1303, 1305, 1307, 1309, 1311, 1313,
+    1315, 1317, 1319, 1321, 1323, 1325, 1327, 1377,
+    1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385,
+    1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+    1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
+    1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409,
+    1410, 1411, 1412, 1413, 1414, 2147483668, 11520, 11521,
+    11522, 11523, 11524, 11525, 11526, 11527, 11528, 11529,
+    11530, 11531, 11532, 11533, 11534, 11535, 11536, 11537,
+    11538, 11539, 11540, 11541, 11542, 11543, 11544, 11545,
+    11546, 11547, 11548, 11549, 11550, 11551, 11552, 11553,
+    11554, 11555, 11556, 11557, 11559, 11565, 5104, 5105,
+    5106, 5107, 5108, 5109, 1074, 1076, 1086, 1089,
+    1090, 1090, 1098, 1123, 42571, 4304, 4305, 4306,
+    4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314,
+    4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322,
+    4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330,
+    4331, 4332, 4333, 4334, 4335, 4336, 4337, 4338,
+    4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346,
+    4349, 4350, 4351, 7681, 7683, 7685, 7687, 7689,
+    7691, 7693, 7695, 7697, 7699, 7701, 7703, 7705,
+    7707, 7709, 7711, 7713, 7715, 7717, 7719, 7721,
+    7723, 7725, 7727, 7729, 7731, 7733, 7735, 7737,
+    7739, 7741, 7743, 7745, 7747, 7749, 7751, 7753,
+    7755, 7757, 7759, 7761, 7763, 7765, 7767, 7769,
+    7771, 7773, 7775, 7777, 7779, 7781, 7783, 7785,
+    7787, 7789, 7791, 7793, 7795, 7797, 7799, 7801,
+    7803, 7805, 7807, 7809, 7811, 7813, 7815, 7817,
+    7819, 7821, 7823, 7825, 7827, 7829, 2147483671, 2147483674,
+    2147483677, 2147483680, 2147483683, 7777, 2147483686, 7841, 7843, 7845,
+    7847, 7849, 7851, 7853, 7855, 7857, 7859, 7861,
+    7863, 7865, 7867, 7869, 7871, 7873, 7875, 7877,
+    7879, 7881, 7883, 7885, 7887, 7889, 7891, 7893,
+    7895, 7897, 7899, 7901, 7903, 7905, 7907, 7909,
+    7911, 7913, 7915, 7917, 7919, 7921, 7923, 7925,
+    7927, 7929, 7931, 7933, 7935, 7936, 7937, 7938,
+    7939, 7940, 7941, 7942, 7943, 7952, 7953, 7954,
+    7955, 7956, 7957, 7968, 7969, 7970, 7971, 7972,
+    7973, 7974, 7975, 7984, 7985, 7986, 7987, 7988,
+    7989, 7990, 7991, 8000, 8001, 8002, 8003, 8004,
+    8005, 2147483689, 2147483692, 2147483696, 2147483700, 8017, 8019, 8021,
+    8023, 8032, 8033, 8034, 8035, 8036, 8037, 8038,
+    8039, 2147483704, 2147483707, 2147483710, 2147483713, 2147483716, 2147483719, 2147483722,
+    2147483725, 2147483728, 2147483731, 2147483734, 2147483737, 2147483740, 2147483743, 2147483746,
+    2147483749, 2147483752, 2147483755, 2147483758, 2147483761, 2147483764, 2147483767, 2147483770,
+    2147483773, 2147483776, 2147483779, 2147483782, 2147483785, 2147483788, 2147483791, 2147483794,
+    2147483797, 2147483800, 2147483803, 2147483806, 2147483809, 2147483812, 2147483815, 2147483818,
+    2147483821, 2147483824, 2147483827, 2147483830, 2147483833, 2147483836, 2147483839, 2147483842,
+    2147483845, 2147483848, 2147483851, 2147483854, 2147483857, 2147483860, 8112, 8113,
+    8048, 8049, 2147483864, 953, 2147483867, 2147483870, 2147483873, 2147483876,
+    2147483879, 8050, 8051, 8052, 8053, 2147483883, 2147483886, 2147483890,
+    2147483894, 2147483897, 8144, 8145, 8054, 8055, 2147483901, 2147483905,
+    2147483909, 2147483912, 2147483915, 8160, 8161, 8058, 8059, 8165,
+    2147483919, 2147483922, 2147483925, 2147483928, 2147483931, 8056, 8057, 8060,
+    8061, 2147483935, 969, 107, 229, 8526, 8560, 8561,
+    8562, 8563, 8564, 8565, 8566, 8567, 8568, 8569,
+    8570, 8571, 8572, 8573, 8574, 8575, 8580, 9424,
+    9425, 9426, 9427, 9428, 9429, 9430, 9431, 9432,
+    9433, 9434, 9435, 9436, 9437, 9438, 9439, 9440,
+    9441, 9442, 9443, 9444, 9445, 9446, 9447, 9448,
+    9449, 11312, 11313, 11314, 11315, 11316, 11317, 11318,
+    11319, 11320, 11321, 11322, 11323, 11324, 11325, 11326,
+    11327, 11328, 11329, 11330, 11331, 11332, 11333, 11334,
+    11335, 11336, 11337, 11338, 11339, 11340, 11341, 11342,
+    11343, 11344, 11345, 11346, 11347, 11348, 11349, 11350,
+    11351, 11352, 11353, 11354, 11355, 11356, 11357, 11358,
+    11359, 11361, 619, 7549, 637, 11368, 11370, 11372,
+    593, 625, 592, 594, 11379, 11382, 575, 576,
+    11393, 11395, 11397, 11399, 11401, 11403, 11405, 11407,
+    11409, 11411, 11413, 11415, 11417, 11419, 11421, 11423,
+    11425, 11427, 11429, 11431, 11433, 11435, 11437, 11439,
+    11441, 11443, 11445, 11447, 11449, 11451, 11453, 11455,
+    11457, 11459, 11461, 11463, 11465, 11467, 11469, 11471,
+    11473, 11475, 11477, 11479, 11481, 11483, 11485, 11487,
+    11489, 11491, 11500, 11502, 11507, 42561, 42563, 42565,
+    42567, 42569, 42571, 42573, 42575, 42577, 42579, 42581,
+    42583, 42585, 42587, 42589, 42591, 42593, 42595, 42597,
+    42599, 42601, 42603, 42605, 42625, 42627, 42629, 42631,
+    42633, 42635, 42637, 42639, 42641, 42643, 42645, 42647,
+    42649, 42651, 42787, 42789, 42791, 42793, 42795, 42797,
+    42799, 42803, 42805, 42807, 42809, 42811, 42813, 42815,
+    42817, 42819, 42821, 42823, 42825, 42827, 42829, 42831,
+    42833, 42835, 42837, 42839, 42841, 42843, 42845, 42847,
+    42849, 42851, 42853, 42855, 42857, 42859, 42861, 42863,
+    42874, 42876, 7545, 42879, 42881, 42883, 42885, 42887,
+    42892, 613, 42897, 42899, 42903, 42905, 42907, 42909,
+    42911, 42913, 42915, 42917, 42919, 42921, 614, 604,
+    609, 620, 618, 670, 647, 669, 43859, 42933,
+    42935, 42937, 42939, 42941, 42943, 42945, 42947, 42900,
+    642, 7566, 42952, 42954, 42961, 42967, 42969, 42998,
+    5024, 5025, 5026, 5027, 5028, 5029, 5030, 5031,
+    5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039,
+    5040, 5041, 5042, 5043, 5044, 5045, 5046, 5047,
+    5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055,
+    5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063,
+    5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071,
+    5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079,
+    5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087,
+    5088, 5089, 5090, 5091, 5092, 5093, 5094, 5095,
+    5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103,
+    2147483938, 2147483941, 2147483944, 2147483947, 2147483951, 2147483955, 2147483958, 2147483961,
+    2147483964, 2147483967, 2147483970, 2147483973, 65345, 65346, 65347, 65348,
+    65349, 65350, 65351, 65352, 65353, 65354, 65355, 65356,
+    65357, 65358, 65359, 65360, 65361, 65362, 65363, 65364,
+    65365, 65366, 65367, 65368, 65369, 65370, 66600, 66601,
+    66602, 66603, 66604, 66605, 66606, 66607, 66608, 66609,
+    66610, 66611, 66612, 66613, 66614, 66615, 66616, 66617,
+    66618, 66619, 66620, 66621, 66622, 66623, 66624, 66625,
+    66626, 66627, 66628, 66629, 66630, 66631, 66632, 66633,
+    66634, 66635, 66636, 66637, 66638, 66639, 66776, 66777,
+    66778, 66779, 66780, 66781, 66782, 66783, 66784, 66785,
+    66786, 66787, 66788, 66789, 66790, 66791, 66792, 66793,
+    66794, 66795, 66796, 66797, 66798, 66799, 66800, 66801,
+    66802, 66803, 66804, 66805, 66806, 66807, 66808, 66809,
+    66810, 66811, 66967, 66968, 66969, 66970, 66971, 66972,
+    66973, 66974, 66975, 66976, 66977, 66979, 66980, 66981,
+    66982, 66983, 66984, 66985, 66986, 66987, 66988, 66989,
+    66990, 66991, 66992, 66993, 66995, 66996, 66997, 66998,
+    66999, 67000, 67001, 67003, 67004, 68800, 68801, 68802,
+    68803, 68804, 68805, 68806, 68807, 68808, 68809, 68810,
+    68811, 68812, 68813, 68814, 68815, 68816, 68817, 68818,
+    68819, 68820, 68821, 68822, 68823, 68824, 68825, 68826,
+    68827, 68828, 68829, 68830, 68831, 68832, 68833, 68834,
+    68835, 68836, 68837, 68838, 68839, 68840, 68841, 68842,
+    68843, 68844, 68845, 68846, 68847, 68848, 68849, 68850,
+    71872, 71873, 71874, 71875, 71876, 71877, 71878, 71879,
+    71880, 71881, 71882, 71883, 71884, 71885, 71886, 71887,
+    71888, 71889, 71890, 71891, 71892, 71893, 71894, 71895,
+    71896, 71897, 71898, 71899, 71900, 71901, 71902, 71903,
+    93792, 93793, 93794, 93795, 93796, 93797, 93798, 93799,
+    93800, 93801, 93802, 93803, 93804, 93805, 93806, 93807,
+    93808, 93809, 93810, 93811, 93812, 93813, 93814, 93815,
+    93816, 93817, 93818, 93819, 93820, 93821, 93822, 93823,
+    125218, 125219, 125220, 125221, 125222, 125223, 125224, 125225,
+    125226, 125227, 125228, 125229, 125230, 125231, 125232, 125233,
+    125234, 125235, 125236, 125237, 125238, 125239, 125240, 125241,
+    125242, 125243, 125244, 125245, 125246, 125247, 125248, 125249,
+    125250, 125251,
+};
+
+inline constexpr std::uint32_t case_fold_sequences[] = {
+    2, 115, 115, 2, 105, 775, 2, 700,
+    110, 2, 106, 780, 3, 953, 776, 769,
+    3, 965, 776, 769, 2, 1381, 1410, 2,
+    104, 817, 2, 116, 776, 2, 119, 778,
+    2, 121, 778, 2, 97, 702, 2, 115,
+    115, 2, 965, 787, 3, 965, 787, 768,
+    3, 965, 787, 769, 3, 965, 787, 834,
+    2, 7936, 953, 2, 7937, 953, 2, 7938,
+    953, 2, 7939, 953, 2, 7940, 953, 2,
+    7941, 953, 2, 7942, 953, 2, 7943, 953,
+    2, 7936, 953, 2, 7937, 953, 2, 7938,
+    953, 2, 7939, 953, 2, 7940, 953, 2,
+    7941, 953, 2, 7942, 953, 2, 7943, 953,
+    2, 7968, 953, 2, 7969, 953, 2, 7970,
+    953, 2, 7971, 953, 2, 7972, 953, 2,
+    7973, 953, 2, 7974, 953, 2, 7975, 953,
+    2, 7968, 953, 2, 7969, 953, 2, 7970,
+    953, 2, 7971, 953, 2, 7972, 953, 2,
+    7973, 953, 2, 7974, 953, 2, 7975, 953,
+    2, 8032, 953, 2, 8033, 953, 2, 8034,
+    953, 2, 8035, 953, 2, 8036, 953, 2,
+    8037, 953, 2, 8038, 953, 2, 8039, 953,
+    2, 8032, 953, 2, 8033, 953, 2, 8034,
+    953, 2, 8035, 953, 2, 8036, 953, 2,
+    8037, 953, 2, 8038, 953, 2, 8039, 953,
+    2, 8048, 953, 2, 945, 953, 2, 940,
+    953, 2, 945, 834, 3, 945, 834, 953,
+    2, 945, 953, 2, 8052, 953, 2, 951,
+    953, 2, 942, 953, 2, 951, 834, 3,
+    951, 834, 953, 2, 951, 953, 3, 953,
+    776, 768, 3, 953, 776, 769, 2, 953,
+    834, 3, 953, 776, 834, 3, 965, 776,
+    768, 3, 965, 776, 769, 2, 961, 787,
+    2, 965, 834, 3, 965, 776, 834, 2,
+    8060, 953, 2, 969, 953, 2, 974, 953,
+    2, 969, 834, 3, 969, 834, 953, 2,
+    969, 953, 2, 102, 102, 2, 102, 105,
+    2, 102, 108, 3, 102, 102, 105, 3,
+    102, 102, 108, 2, 115, 116, 2, 115,
+    116, 2, 1396, 1398, 2, 1396, 1381, 2,
+    1396, 1387, 2, 1406, 1398, 2, 1396, 1389,
+};
+
+inline constexpr std::uint64_t case_fold_ascii_targets[] = {
+    0, 187004121608355840,
+};
+
+inline constexpr std::uint32_t script_starts[] = {
+    0, 65, 91, 97, 123, 170, 171, 186,
+    187, 192, 215, 216, 247, 248, 697, 736,
+    741, 746, 748, 768, 880, 884, 885, 888,
+    890, 894, 895, 896, 900, 901, 902, 903,
+    904, 907, 908, 909, 910, 930, 931, 994,
+    1008, 1024, 1157, 1159, 1328, 1329, 1367, 1369,
+    1419, 1421, 1424, 1425, 1480, 1488, 1515, 1519,
+    1525, 1536, 1541, 1542, 1548, 1549, 1563, 1564,
+    1567, 1568, 1600, 1601, 1611, 1622, 1648, 1649,
+    1757, 1758, 1792, 1806, 1807, 1867, 1869, 1872,
+    1920, 1970, 1984, 2043, 2045, 2048, 2094, 2096,
+    2111, 2112, 2140, 2142, 2143, 2144, 2155, 2160,
+    2191, 2192, 2194, 2200, 2274, 2275, 2304, 2385,
+    2389, 2404, 2406, 2432, 2436, 2437, 2445, 2447,
+    2449, 2451, 2473, 2474, 2481, 2482, 2483, 2486,
+    2490, 2492, 2501, 2503, 2505, 2507, 2511, 2519,
+    2520, 2524, 2526, 2527, 2532, 2534, 2559, 2561,
+    2564, 2565, 2571, 2575, 2577, 2579, 2601, 2602,
+    2609, 2610, 2612, 2613, 2615, 2616, 2618, 2620,
+    2621, 2622, 2627, 2631, 2633, 2635, 2638, 2641,
+    2642, 2649, 2653, 2654, 2655, 2662, 2679, 2689,
+    2692, 2693, 2702, 2703, 2706, 2707, 2729, 2730,
+    2737, 2738, 2740, 2741, 2746, 2748, 2758, 2759,
+    2762, 2763, 2766, 2768, 2769, 2784, 2788, 2790,
+    2802, 2809, 2816, 2817, 2820, 2821, 2829, 2831,
+    2833, 2835, 2857, 2858, 2865, 2866, 2868, 2869,
+    2874, 2876, 2885, 2887, 2889, 2891, 2894, 2901,
+    2904, 2908, 2910, 2911, 2916, 2918, 2936, 2946,
+    2948, 2949, 2955, 2958, 2961, 2962, 2966, 2969,
+    2971, 2972, 2973, 2974, 2976, 2979, 2981, 2984,
+    2987, 2990, 3002, 3006, 3011, 3014, 3017, 3018,
+    3022, 3024, 3025, 3031, 3032, 3046, 3067, 3072,
+    3085, 3086, 3089, 3090, 3113, 3114, 3130, 3132,
+    3141, 3142, 3145, 3146, 3150, 3157, 3159, 3160,
+    3163, 3165, 3166, 3168, 3172, 3174, 3184, 3191,
+    3200, 3213, 3214, 3217, 3218, 3241, 3242, 3252,
+    3253, 3258, 3260, 3269, 3270, 3273, 3274, 3278,
+    3285, 3287, 3293, 3295, 3296, 3300, 3302, 3312,
+    3313, 3315, 3328, 3341, 3342, 3345, 3346, 3397,
+    3398, 3401, 3402, 3408, 3412, 3428, 3430, 3456,
+    3457, 3460, 3461, 3479, 3482, 3506, 3507, 3516,
+    3517, 3518, 3520, 3527, 3530, 3531, 3535, 3541,
+    3542, 3543, 3544, 3552, 3558, 3568, 3570, 3573,
+    3585, 3643, 3647, 3648, 3676, 3713, 3715, 3716,
+    3717, 3718, 3723, 3724, 3748, 3749, 3750, 3751,
+    3774, 3776, 3781, 3782, 3783, 3784, 3790, 3792,
+    3802, 3804, 3808, 3840, 3912, 3913, 3949, 3953,
+    3992, 3993, 4029, 4030, 4045, 4046, 4053, 4057,
+    4059, 4096, 4256, 4294, 4295, 4296, 4301, 4302,
+    4304, 4347, 4348, 4352, 4608, 4681, 4682, 4686,
+    4688, 4695, 4696, 4697, 4698, 4702, 4704, 4745,
+    4746, 4750, 4752, 4785, 4786, 4790, 4792, 4799,
+    4800, 4801, 4802, 4806, 4808, 4823, 4824, 4881,
+    4882, 4886, 4888, 4955, 4957, 4989, 4992, 5018,
+    5024, 5110, 5112, 5118, 5120, 5760, 5789, 5792,
+    5867, 5870, 5881, 5888, 5910, 5919, 5920, 5941,
+    5943, 5952, 5972, 5984, 5997, 5998, 6001, 6002,
+    6004, 6016, 6110, 6112, 6122, 6128, 6138, 6144,
+    6146, 6148, 6149, 6150, 6170, 6176, 6265, 6272,
+    6315, 6320, 6390, 6400, 6431, 6432, 6444, 6448,
+    6460, 6464, 6465, 6468, 6480, 6510, 6512, 6517,
+    6528, 6572, 6576, 6602, 6608, 6619, 6622, 6624,
+    6656, 6684, 6686, 6688, 6751, 6752, 6781, 6783,
+    6794, 6800, 6810, 6816, 6830, 6832, 6863, 6912,
+    6989, 6992, 7039, 7040, 7104, 7156, 7164, 7168,
+    7224, 7227, 7242, 7245, 7248, 7296, 7305, 7312,
+    7355, 7357, 7360, 7368, 7376, 7379, 7380, 7393,
+    7394, 7401, 7405, 7406, 7412, 7413, 7416, 7418,
+    7419, 7424, 7462, 7467, 7468, 7517, 7522, 7526,
+    7531, 7544, 7545, 7615, 7616, 7680, 7936, 7958,
+    7960, 7966, 7968, 8006, 8008, 8014, 8016, 8024,
+    8025, 8026, 8027, 8028, 8029, 8030, 8031, 8062,
+    8064, 8117, 8118, 8133, 8134, 8148, 8150, 8156,
+    8157, 8176, 8178, 8181, 8182, 8191, 8192, 8204,
+    8206, 8293, 8294, 8305, 8306, 8308, 8319, 8320,
+    8335, 8336, 8349, 8352, 8385, 8400, 8433, 8448,
+    8486, 8487, 8490, 8492, 8498, 8499, 8526, 8527,
+    8544, 8585, 8588, 8592, 9255, 9280, 9291, 9312,
+    10240, 10496, 11124, 11126, 11158, 11159, 11264, 11360,
+    11392, 11508, 11513, 11520, 11558, 11559, 11560, 11565,
+    11566, 11568, 11624, 11631, 11633, 11647, 11648, 11671,
+    11680, 11687, 11688, 11695, 11696, 11703, 11704, 11711,
+    11712, 11719, 11720, 11727, 11728, 11735, 11736, 11743,
+    11744, 11776, 11870, 11904, 11930, 11931, 12020, 12032,
+    12246, 12272, 12284, 12288, 12293, 12294, 12295, 12296,
+    12321, 12330, 12334, 12336, 12344, 12348, 12352, 12353,
+    12439, 12441, 12443, 12445, 12448, 12449, 12539, 12541,
+    12544, 12549, 12592, 12593, 12687, 12688, 12704, 12736,
+    12772, 12784, 12800, 12831, 12832, 12896, 12927, 13008,
+    13055, 13056, 13144, 13312, 19904, 19968, 40960, 42125,
+    42128, 42183, 42192, 42240, 42540, 42560, 42656, 42744,
+    42752, 42786, 42888, 42891, 42955, 42960, 42962, 42963,
+    42964, 42965, 42970, 42994, 43008, 43053, 43056, 43066,
+    43072, 43128, 43136, 43206, 43214, 43226, 43232, 43264,
+    43310, 43311, 43312, 43348, 43359, 43360, 43389, 43392,
+    43470, 43471, 43472, 43482, 43486, 43488, 43519, 43520,
+    43575, 43584, 43598, 43600, 43610, 43612, 43616, 43648,
+    43715, 43739, 43744, 43767, 43777, 43783, 43785, 43791,
+    43793, 43799, 43808, 43815, 43816, 43823, 43824, 43867,
+    43868, 43877, 43878, 43882, 43884, 43888, 43968, 44014,
+    44016, 44026, 44032, 55204, 55216, 55239, 55243, 55292,
+    63744, 64110, 64112, 64218, 64256, 64263, 64275, 64280,
+    64285, 64311, 64312, 64317, 64318, 64319, 64320, 64322,
+    64323, 64325, 64326, 64336, 64451, 64467, 64830, 64832,
+    64912, 64914, 64968, 64975, 64976, 65008, 65024, 65040,
+    65050, 65056, 65070, 65072, 65107, 65108, 65127, 65128,
+    65132, 65136, 65141, 65142, 65277, 65279, 65280, 65281,
+    65313, 65339, 65345, 65371, 65382, 65392, 65393, 65438,
+    65440, 65471, 65474, 65480, 65482, 65488, 65490, 65496,
+    65498, 65501, 65504, 65511, 65512, 65519, 65529, 65534,
+    65536, 65548, 65549, 65575, 65576, 65595, 65596, 65598,
+    65599, 65614, 65616, 65630, 65664, 65787, 65792, 65795,
+    65799, 65844, 65847, 65856, 65935, 65936, 65949, 65952,
+    65953, 66000, 66045, 66046, 66176, 66205, 66208, 66257,
+    66272, 66273, 66300, 66304, 66340, 66349, 66352, 66379,
+    66384, 66427, 66432, 66462, 66463, 66464, 66500, 66504,
+    66518, 66560, 66640, 66688, 66718, 66720, 66730, 66736,
+    66772, 66776, 66812, 66816, 66856, 66864, 66916, 66927,
+    66928, 66939, 66940, 66955, 66956, 66963, 66964, 66966,
+    66967, 66978, 66979, 66994, 66995, 67002, 67003, 67005,
+    67072, 67383, 67392, 67414, 67424, 67432, 67456, 67462,
+    67463, 67505, 67506, 67515, 67584, 67590, 67592, 67593,
+    67594, 67638, 67639, 67641, 67644, 67645, 67647, 67648,
+    67670, 67671, 67680, 67712, 67743, 67751, 67760, 67808,
+    67827, 67828, 67830, 67835, 67840, 67868, 67871, 67872,
+    67898, 67903, 67904, 67968, 68000, 68024, 68028, 68048,
+    68050, 68096, 68100, 68101, 68103, 68108, 68116, 68117,
+    68120, 68121, 68150, 68152, 68155, 68159, 68169, 68176,
+    68185, 68192, 68224, 68256, 68288, 68327, 68331, 68343,
+    68352, 68406, 68409, 68416, 68438, 68440, 68448, 68467,
+    68472, 68480, 68498, 68505, 68509, 68521, 68528, 68608,
+    68681, 68736, 68787, 68800, 68851, 68858, 68864, 68904,
+    68912, 68922, 69216, 69247, 69248, 69290, 69291, 69294,
+    69296, 69298, 69376, 69416, 69424, 69466, 69488, 69514,
+    69552, 69580, 69600, 69623, 69632, 69710, 69714, 69750,
+    69759, 69760, 69827, 69837, 69838, 69840, 69865, 69872,
+    69882, 69888, 69941, 69942, 69960, 69968, 70007, 70016,
+    70112, 70113, 70133, 70144, 70162, 70163, 70207, 70272,
+    70279, 70280, 70281, 70282, 70286, 70287, 70302, 70303,
+    70314, 70320, 70379, 70384, 70394, 70400, 70404, 70405,
+    70413, 70415, 70417, 70419, 70441, 70442, 70449, 70450,
+    70452, 70453, 70458, 70459, 70460, 70469, 70471, 70473,
+    70475, 70478, 70480, 70481, 70487, 70488, 70493, 70500,
+    70502, 70509, 70512, 70517, 70656, 70748, 70749, 70754,
+    70784, 70856, 70864, 70874, 71040, 71094, 71096, 71134,
+    71168, 71237, 71248, 71258, 71264, 71277, 71296, 71354,
+    71360, 71370, 71424, 71451, 71453, 71468, 71472, 71495,
+    71680, 71740, 71840, 71923, 71935, 71936, 71943, 71945,
+    71946, 71948, 71956, 71957, 71959, 71960, 71990, 71991,
+    71993, 71995, 72007, 72016, 72026, 72096, 72104, 72106,
+    72152, 72154, 72165, 72192, 72264, 72272, 72355, 72368,
+    72384, 72441, 72704, 72713, 72714, 72759, 72760, 72774,
+    72784, 72813, 72816, 72848, 72850, 72872, 72873, 72887,
+    72960, 72967, 72968, 72970, 72971, 73015, 73018, 73019,
+    73020, 73022, 73023, 73032, 73040, 73050, 73056, 73062,
+    73063, 73065, 73066, 73103, 73104, 73106, 73107, 73113,
+    73120, 73130, 73440, 73465, 73648, 73649, 73664, 73714,
+    73727, 73728, 74650, 74752, 74863, 74864, 74869, 74880,
+    75076, 77712, 77811, 77824, 78895, 78896, 78905, 82944,
+    83527, 92160, 92729, 92736, 92767, 92768, 92778, 92782,
+    92784, 92863, 92864, 92874, 92880, 92910, 92912, 92918,
+    92928, 92998, 93008, 93018, 93019, 93026, 93027, 93048,
+    93053, 93072, 93760, 93851, 93952, 94027, 94031, 94088,
+    94095, 94112, 94176, 94177, 94178, 94180, 94181, 94192,
+    94194, 94208, 100344, 100352, 101120, 101590, 101632, 101641,
+    110576, 110580, 110581, 110588, 110589, 110591, 110592, 110593,
+    110880, 110883, 110928, 110931, 110948, 110952, 110960, 111356,
+    113664, 113771, 113776, 113789, 113792, 113801, 113808, 113818,
+    113820, 113824, 113828, 118528, 118574, 118576, 118599, 118608,
+    118724, 118784, 119030, 119040, 119079, 119081, 119143, 119146,
+    119163, 119171, 119173, 119180, 119210, 119214, 119275, 119296,
+    119366, 119520, 119540, 119552, 119639, 119648, 119673, 119808,
+    119893, 119894, 119965, 119966, 119968, 119970, 119971, 119973,
+    119975, 119977, 119981, 119982, 119994, 119995, 119996, 119997,
+    120004, 120005, 120070, 120071, 120075, 120077, 120085, 120086,
+    120093, 120094, 120122, 120123, 120127, 120128, 120133, 120134,
+    120135, 120138, 120145, 120146, 120486, 120488, 120780, 120782,
+    120832, 121484, 121499, 121504, 121505, 121520, 122624, 122655,
+    122880, 122887, 122888, 122905, 122907, 122914, 122915, 122917,
+    122918, 122923, 123136, 123181, 123184, 123198, 123200, 123210,
+    123214, 123216, 123536, 123567, 123584, 123642, 123647, 123648,
+    124896, 124903, 124904, 124908, 124909, 124911, 124912, 124927,
+    124928, 125125, 125127, 125143, 125184, 125260, 125264, 125274,
+    125278, 125280, 126065, 126133, 126209, 126270, 126464, 126468,
+    126469, 126496, 126497, 126499, 126500, 126501, 126503, 126504,
+    126505, 126515, 126516, 126520, 126521, 126522, 126523, 126524,
+    126530, 126531, 126535, 126536, 126537, 126538, 126539, 126540,
+    126541, 126544, 126545, 126547, 126548, 126549, 126551, 126552,
+    126553, 126554, 126555, 126556, 126557, 126558, 126559, 126560,
+    126561, 126563, 126564, 126565, 126567, 126571, 126572, 126579,
+    126580, 126584, 126585, 126589, 126590, 126591, 126592, 126602,
+    126603, 126620, 126625, 126628, 126629, 126634, 126635, 126652,
+    126704, 126706, 126976, 127020, 127024, 127124, 127136, 127151,
+    127153, 127168, 127169, 127184, 127185, 127222, 127232, 127406,
+    127462, 127488, 127489, 127491, 127504, 127548, 127552, 127561,
+    127568, 127570, 127584, 127590, 127744, 128728, 128733, 128749,
+    128752, 128765, 128768, 128884, 128896, 128985, 128992, 129004,
+    129008, 129009, 129024, 129036, 129040, 129096, 129104, 129114,
+    129120, 129160, 129168, 129198, 129200, 129202, 129280, 129620,
+    129632, 129646, 129648, 129653, 129656, 129661, 129664, 129671,
+    129680, 129709, 129712, 129723, 129728, 129734, 129744, 129754,
+    129760, 129768, 129776, 129783, 129792, 129939, 129940, 129995,
+    130032, 130042, 131072, 173792, 173824, 177977, 177984, 178206,
+    178208, 183970, 183984, 191457, 194560, 195102, 196608, 201547,
+    917505, 917506, 917536, 917632, 917760, 918000,
+};
+
+inline constexpr std::uint8_t script_values[] = {
+    25, 70, 25, 70, 25, 70, 25, 70, 25, 70, 25, 70, 25, 70, 25, 70,
+    25, 13, 25, 56, 44, 25, 44, 0, 44, 25, 44, 0, 44, 25, 44, 25,
+    44, 0, 44, 0, 44, 0, 44, 26, 44, 30, 56, 30, 0, 5, 0, 5,
+    0, 5, 0, 53, 0, 53, 0, 53, 0, 4, 25, 4, 25, 4, 25, 4,
+    25, 4, 25, 4, 56, 4, 56, 4, 25, 4, 137, 0, 137, 0, 137, 4,
+    148, 0, 100, 0, 100, 125, 0, 125, 0, 81, 0, 81, 0, 137, 0, 4,
+    0, 4, 0, 4, 25, 4, 32, 56, 32, 25, 32, 11, 0, 11, 0, 11,
+    0, 11, 0, 11, 0, 11, 0, 11, 0, 11, 0, 11, 0, 11, 0, 11,
+    0, 11, 0, 11, 0, 11, 0, 47, 0, 47, 0, 47, 0, 47, 0, 47,
+    0, 47, 0, 47, 0, 47, 0, 47, 0, 47, 0, 47, 0, 47, 0, 47,
+    0, 47, 0, 47, 0, 47, 0, 45, 0, 45, 0, 45, 0, 45, 0, 45,
+    0, 45, 0, 45, 0, 45, 0, 45, 0, 45, 0, 45, 0, 45, 0, 45,
+    0, 45, 0, 114, 0, 114, 0, 114, 0, 114, 0, 114, 0, 114, 0, 114,
+    0, 114, 0, 114, 0, 114, 0, 114, 0, 114, 0, 114, 0, 114, 0, 144,
+    0, 144, 0, 144, 0, 144, 0, 144, 0, 144, 0, 144, 0, 144, 0, 144,
+    0, 144, 0, 144, 0, 144, 0, 144, 0, 144, 0, 144, 0, 144, 0, 147,
+    0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147,
+    0, 147, 0, 147, 0, 147, 0, 147, 61, 0, 61, 0, 61, 0, 61, 0,
+    61, 0, 61, 0, 61, 0, 61, 0, 61, 0, 61, 0, 61, 0, 61, 0,
+    61, 0, 80, 0, 80, 0, 80, 0, 80, 0, 80, 0, 80, 0, 80, 0,
+    131, 0, 131, 0, 131, 0, 131, 0, 131, 0, 131, 0, 131, 0, 131, 0,
+    131, 0, 131, 0, 131, 0, 131, 0, 149, 0, 25, 149, 0, 69, 0, 69,
+    0, 69, 0, 69, 0, 69, 0, 69, 0, 69, 0, 69, 0, 69, 0, 69,
+    0, 69, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 25, 150,
+    0, 95, 40, 0, 40, 0, 40, 0, 40, 25, 40, 49, 39, 0, 39, 0,
+    39, 0, 39, 0, 39, 0, 39, 0, 39, 0, 39, 0, 39, 0, 39, 0,
+    39, 0, 39, 0, 39, 0, 39, 0, 39, 0, 39, 0, 39, 0, 39, 0,
+    23, 0, 23, 0, 18, 103, 0, 124, 25, 124, 0, 138, 0, 138, 51, 25,
+    0, 17, 0, 139, 0, 139, 0, 139, 0, 66, 0, 66, 0, 66, 0, 92,
+    25, 92, 25, 92, 0, 92, 0, 92, 0, 18, 0, 72, 0, 72, 0, 72,
+    0, 72, 0, 72, 140, 0, 140, 0, 98, 0, 98, 0, 98, 0, 98, 66,
+    16, 0, 16, 141, 0, 141, 0, 141, 0, 141, 0, 141, 0, 56, 0, 7,
+    0, 7, 0, 135, 10, 0, 10, 71, 0, 71, 0, 71, 104, 30, 0, 40,
+    0, 40, 135, 0, 56, 25, 56, 25, 56, 25, 56, 25, 56, 25, 56, 25,
+    0, 70, 44, 30, 70, 44, 70, 44, 70, 30, 70, 44, 56, 70, 44, 0,
+    44, 0, 44, 0, 44, 0, 44, 0, 44, 0, 44, 0, 44, 0, 44, 0,
+    44, 0, 44, 0, 44, 0, 44, 0, 44, 0, 44, 0, 44, 0, 25, 56,
+    25, 0, 25, 70, 0, 25, 70, 25, 0, 70, 0, 25, 0, 56, 0, 25,
+    44, 25, 70, 25, 70, 25, 70, 25, 70, 25, 0, 25, 0, 25, 0, 25,
+    15, 25, 0, 25, 0, 25, 41, 70, 26, 0, 26, 40, 0, 40, 0, 40,
+    0, 151, 0, 151, 0, 151, 39, 0, 39, 0, 39, 0, 39, 0, 39, 0,
+    39, 0, 39, 0, 39, 0, 39, 0, 30, 25, 0, 48, 0, 48, 0, 48,
+    0, 25, 0, 25, 48, 25, 48, 25, 48, 56, 49, 25, 48, 25, 0, 54,
+    0, 56, 25, 54, 25, 62, 25, 62, 0, 13, 0, 49, 0, 25, 13, 25,
+    0, 62, 49, 0, 25, 49, 25, 62, 25, 62, 25, 48, 25, 48, 160, 0,
+    160, 0, 75, 155, 0, 30, 8, 0, 25, 70, 25, 70, 0, 70, 0, 70,
+    0, 70, 0, 70, 136, 0, 25, 0, 120, 0, 126, 0, 126, 0, 32, 63,
+    25, 63, 123, 0, 123, 49, 0, 59, 0, 25, 59, 0, 59, 95, 0, 22,
+    0, 22, 0, 22, 0, 22, 95, 142, 0, 142, 86, 0, 39, 0, 39, 0,
+    39, 0, 39, 0, 39, 0, 70, 25, 70, 44, 70, 25, 0, 23, 86, 0,
+    86, 0, 49, 0, 49, 0, 49, 0, 48, 0, 48, 0, 70, 0, 5, 0,
+    53, 0, 53, 0, 53, 0, 53, 0, 53, 0, 53, 4, 0, 4, 25, 4,
+    0, 4, 0, 4, 0, 4, 56, 25, 0, 56, 30, 25, 0, 25, 0, 25,
+    0, 4, 0, 4, 0, 25, 0, 25, 70, 25, 70, 25, 62, 25, 62, 25,
+    49, 0, 49, 0, 49, 0, 49, 0, 49, 0, 25, 0, 25, 0, 25, 0,
+    74, 0, 74, 0, 74, 0, 74, 0, 74, 0, 74, 0, 74, 0, 25, 0,
+    25, 0, 25, 44, 0, 25, 0, 44, 0, 25, 56, 0, 76, 0, 19, 0,
+    56, 25, 0, 106, 0, 106, 42, 0, 108, 0, 154, 0, 154, 109, 0, 109,
+    0, 31, 128, 116, 0, 116, 0, 115, 0, 115, 0, 37, 0, 20, 0, 20,
+    156, 0, 156, 0, 156, 0, 156, 0, 156, 0, 156, 0, 156, 0, 156, 0,
+    73, 0, 73, 0, 73, 0, 70, 0, 70, 0, 70, 0, 28, 0, 28, 0,
+    28, 0, 28, 0, 28, 0, 28, 55, 0, 55, 118, 96, 0, 96, 0, 52,
+    0, 52, 0, 52, 121, 0, 121, 77, 0, 77, 0, 89, 88, 0, 88, 0,
+    88, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64, 0, 64,
+    0, 111, 107, 0, 82, 0, 82, 0, 6, 0, 6, 58, 0, 58, 57, 0,
+    57, 122, 0, 122, 0, 122, 0, 112, 0, 105, 0, 105, 0, 105, 50, 0,
+    50, 0, 4, 0, 159, 0, 159, 0, 159, 0, 110, 0, 132, 0, 113, 0,
+    24, 0, 38, 0, 14, 0, 14, 0, 14, 60, 0, 60, 0, 133, 0, 133,
+    0, 21, 0, 21, 0, 78, 0, 127, 0, 131, 0, 67, 0, 67, 0, 94,
+    0, 94, 0, 94, 0, 94, 0, 94, 0, 68, 0, 68, 0, 43, 0, 43,
+    0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 56, 43, 0, 43, 0,
+    43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 43, 0, 99, 0, 99, 0,
+    152, 0, 152, 0, 129, 0, 129, 0, 91, 0, 91, 0, 92, 0, 143, 0,
+    143, 0, 2, 0, 2, 0, 2, 0, 34, 0, 158, 0, 158, 33, 0, 33,
+    0, 33, 0, 33, 0, 33, 0, 33, 0, 33, 0, 33, 0, 97, 0, 97,
+    0, 97, 0, 161, 0, 134, 0, 18, 119, 0, 12, 0, 12, 0, 12, 0,
+    12, 0, 83, 0, 83, 0, 83, 0, 84, 0, 84, 0, 84, 0, 84, 0,
+    84, 0, 84, 0, 84, 0, 46, 0, 46, 0, 46, 0, 46, 0, 46, 0,
+    46, 0, 79, 0, 75, 0, 144, 0, 144, 27, 0, 27, 0, 27, 0, 27,
+    0, 29, 0, 36, 0, 36, 0, 3, 0, 8, 0, 93, 0, 93, 0, 93,
+    145, 0, 145, 0, 9, 0, 9, 0, 117, 0, 117, 0, 117, 0, 117, 0,
+    117, 0, 85, 0, 90, 0, 90, 0, 90, 0, 146, 101, 48, 65, 0, 48,
+    0, 146, 0, 146, 65, 0, 146, 0, 62, 0, 62, 0, 62, 0, 62, 54,
+    62, 0, 54, 0, 62, 0, 101, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 25, 0, 56, 0, 56, 0, 25, 0, 25, 0, 25, 0, 25, 56, 25,
+    56, 25, 56, 25, 56, 25, 0, 44, 0, 25, 0, 25, 0, 25, 0, 25,
+    0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25,
+    0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25,
+    0, 25, 0, 25, 0, 25, 0, 25, 130, 0, 130, 0, 130, 0, 70, 0,
+    41, 0, 41, 0, 41, 0, 41, 0, 41, 0, 102, 0, 102, 0, 102, 0,
+    102, 0, 153, 0, 157, 0, 157, 0, 39, 0, 39, 0, 39, 0, 39, 0,
+    87, 0, 87, 0, 1, 0, 1, 0, 1, 0, 25, 0, 25, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0,
+    25, 54, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0,
+    25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0,
+    25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0,
+    25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25, 0,
+    25, 0, 48, 0, 48, 0, 48, 0, 48, 0, 48, 0, 48, 0, 48, 0,
+    25, 0, 25, 0, 56, 0,
+};
+
+inline constexpr char const* script_names[] = {
+    "Unknown", "Adlam", "Ahom", "Anatolian_Hieroglyphs",
+    "Arabic", "Armenian", "Avestan", "Balinese",
+    "Bamum", "Bassa_Vah", "Batak", "Bengali",
+    "Bhaiksuki", "Bopomofo", "Brahmi", "Braille",
+    "Buginese", "Buhid", "Canadian_Aboriginal", "Carian",
+    "Caucasian_Albanian", "Chakma", "Cham", "Cherokee",
+    "Chorasmian", "Common", "Coptic", "Cuneiform",
+    "Cypriot", "Cypro_Minoan", "Cyrillic", "Deseret",
+    "Devanagari", "Dives_Akuru", "Dogra", "Duployan",
+    "Egyptian_Hieroglyphs", "Elbasan", "Elymaic", "Ethiopic",
+    "Georgian", "Glagolitic", "Gothic", "Grantha",
+    "Greek", "Gujarati", "Gunjala_Gondi", "Gurmukhi",
+    "Han", "Hangul", "Hanifi_Rohingya", "Hanunoo",
+    "Hatran", "Hebrew", "Hiragana", "Imperial_Aramaic",
+    "Inherited", "Inscriptional_Pahlavi", "Inscriptional_Parthian", "Javanese",
+    "Kaithi", "Kannada", "Katakana", "Kayah_Li",
+    "Kharoshthi", "Khitan_Small_Script", "Khmer", "Khojki",
+    "Khudawadi", "Lao", "Latin", "Lepcha",
+    "Limbu", "Linear_A", "Linear_B", "Lisu",
+    "Lycian", "Lydian", "Mahajani", "Makasar",
+    "Malayalam", "Mandaic", "Manichaean", "Marchen",
+    "Masaram_Gondi", "Medefaidrin", "Meetei_Mayek", "Mende_Kikakui",
+    "Meroitic_Cursive", "Meroitic_Hieroglyphs", "Miao", "Modi",
+    "Mongolian", "Mro", "Multani", "Myanmar",
+    "Nabataean", "Nandinagari", "New_Tai_Lue", "Newa",
+    "Nko", "Nushu", "Nyiakeng_Puachue_Hmong", "Ogham",
+    "Ol_Chiki", "Old_Hungarian", "Old_Italic", "Old_North_Arabian",
+    "Old_Permic", "Old_Persian", "Old_Sogdian", "Old_South_Arabian",
+    "Old_Turkic", "Old_Uyghur", "Oriya", "Osage",
+    "Osmanya", "Pahawh_Hmong", "Palmyrene", "Pau_Cin_Hau",
+    "Phags_Pa", "Phoenician", "Psalter_Pahlavi", "Rejang",
+    "Runic", "Samaritan", "Saurashtra", "Sharada",
+    "Shavian", "Siddham", "SignWriting", "Sinhala",
+    "Sogdian", "Sora_Sompeng", "Soyombo", "Sundanese",
+    "Syloti_Nagri", "Syriac", "Tagalog", "Tagbanwa",
+    "Tai_Le", "Tai_Tham", "Tai_Viet", "Takri",
+    "Tamil", "Tangsa", "Tangut", "Telugu",
+    "Thaana", "Thai", "Tibetan", "Tifinagh",
+    "Tirhuta", "Toto", "Ugaritic", "Vai",
+    "Vithkuqi", "Wancho", "Warang_Citi", "Yezidi",
+    "Yi", "Zanabazar_Square",
+};
+
+/**
+ * iso_8859_2, generated from 8859-2.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_2_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 260, 728, 321, 164, 317, 346, 167,
+    168, 352, 350, 356, 377, 173, 381, 379,
+    176, 261, 731, 322, 180, 318, 347, 711,
+    184, 353, 351, 357, 378, 733, 382, 380,
+    340, 193, 194, 258, 196, 313, 262, 199,
+    268, 201, 280, 203, 282, 205, 206, 270,
+    272, 323, 327, 211, 212, 336, 214, 215,
+    344, 366, 218, 368, 220, 221, 354, 223,
+    341, 225, 226, 259, 228, 314, 263, 231,
+    269, 233, 281, 235, 283, 237, 238, 271,
+    273, 324, 328, 243, 244, 337, 246, 247,
+    345, 367, 250, 369, 252, 253, 355, 729,
+};
+
+inline constexpr std::uint32_t iso_8859_2_encode_limit = 768;
+
+inline constexpr std::uint8_t iso_8859_2_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 5,
+};
+
+inline constexpr std::uint8_t iso_8859_2_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 164, 0, 0, 167, 168, 0, 0, 0, 0, 173, 0, 0,
+    176, 0, 0, 0, 180, 0, 0, 0, 184, 0, 0, 0, 0, 0, 0, 0,
+    0, 193, 194, 0, 196, 0, 0, 199, 0, 201, 0, 203, 0, 205, 206, 0,
+    0, 0, 0, 211, 212, 0, 214, 215, 0, 0, 218, 0, 220, 221, 0, 223,
+    0, 225, 226, 0, 228, 0, 0, 231, 0, 233, 0, 235, 0, 237, 238, 0,
+    0, 0, 0, 243, 244, 0, 246, 247, 0, 0, 250, 0, 252, 253, 0, 0,
+    0, 0, 195, 227, 161, 177, 198, 230, 0, 0, 0, 0, 200, 232, 207, 239,
+    208, 240, 0, 0, 0, 0, 0, 0, 202, 234, 204, 236, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 229, 0, 0, 165, 181, 0,
+    0, 163, 179, 209, 241, 0, 0, 210, 242, 0, 0, 0, 0, 0, 0, 0,
+    213, 245, 0, 0, 192, 224, 0, 0, 216, 248, 166, 182, 0, 0, 170, 186,
+    169, 185, 222, 254, 171, 187, 0, 0, 0, 0, 0, 0, 0, 0, 217, 249,
+    219, 251, 0, 0, 0, 0, 0, 0, 0, 172, 188, 175, 191, 174, 190, 0,
+    0, 0, 0, 0, 0, 0, 0, 183, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 162, 255, 0, 178, 0, 189, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_3, generated from 8859-3.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_3_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 294, 728, 163, 164, 0, 292, 167,
+    168, 304, 350, 286, 308, 173, 0, 379,
+    176, 295, 178, 179, 180, 181, 293, 183,
+    184, 305, 351, 287, 309, 189, 0, 380,
+    192, 193, 194, 0, 196, 266, 264, 199,
+    200, 201, 202, 203, 204, 205, 206, 207,
+    0, 209, 210, 211, 212, 288, 214, 215,
+    284, 217, 218, 219, 220, 364, 348, 223,
+    224, 225, 226, 0, 228, 267, 265, 231,
+    232, 233, 234, 235, 236, 237, 238, 239,
+    0, 241, 242, 243, 244, 289, 246, 247,
+    285, 249, 250, 251, 252, 365, 349, 729,
+};
+
+inline constexpr std::uint32_t iso_8859_3_encode_limit = 768;
+
+inline constexpr std::uint8_t iso_8859_3_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 5,
+};
+
+inline constexpr std::uint8_t iso_8859_3_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 163, 164, 0, 0, 167, 168, 0, 0, 0, 0, 173, 0, 0,
+    176, 0, 178, 179, 180, 181, 0, 183, 184, 0, 0, 0, 0, 189, 0, 0,
+    192, 193, 194, 0, 196, 0, 0, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    0, 209, 210, 211, 212, 0, 214, 215, 0, 217, 218, 219, 220, 0, 0, 223,
+    224, 225, 226, 0, 228, 0, 0, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    0, 241, 242, 243, 244, 0, 246, 247, 0, 249, 250, 251, 252, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 198, 230, 197, 229, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 248, 171, 187,
+    213, 245, 0, 0, 166, 182, 161, 177, 0, 0, 0, 0, 0, 0, 0, 0,
+    169, 185, 0, 0, 172, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 254, 170, 186,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 221, 253, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 191, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 162, 255, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_4, generated from 8859-4.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_4_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 260, 312, 342, 164, 296, 315, 167,
+    168, 352, 274, 290, 358, 173, 381, 175,
+    176, 261, 731, 343, 180, 297, 316, 711,
+    184, 353, 275, 291, 359, 330, 382, 331,
+    256, 193, 194, 195, 196, 197, 198, 302,
+    268, 201, 280, 203, 278, 205, 206, 298,
+    272, 325, 332, 310, 212, 213, 214, 215,
+    216, 370, 218, 219, 220, 360, 362, 223,
+    257, 225, 226, 227, 228, 229, 230, 303,
+    269, 233, 281, 235, 279, 237, 238, 299,
+    273, 326, 333, 311, 244, 245, 246, 247,
+    248, 371, 250, 251, 252, 361, 363, 729,
+};
+
+inline constexpr std::uint32_t iso_8859_4_encode_limit = 768;
+
+inline constexpr std::uint8_t iso_8859_4_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 5,
+};
+
+inline constexpr std::uint8_t iso_8859_4_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 164, 0, 0, 167, 168, 0, 0, 0, 0, 173, 0, 175,
+    176, 0, 0, 0, 180, 0, 0, 0, 184, 0, 0, 0, 0, 0, 0, 0,
+    0, 193, 194, 195, 196, 197, 198, 0, 0, 201, 0, 203, 0, 205, 206, 0,
+    0, 0, 0, 0, 212, 213, 214, 215, 216, 0, 218, 219, 220, 0, 0, 223,
+    0, 225, 226, 227, 228, 229, 230, 0, 0, 233, 0, 235, 0, 237, 238, 0,
+    0, 0, 0, 0, 244, 245, 246, 247, 248, 0, 250, 251, 252, 0, 0, 0,
+    192, 224, 0, 0, 161, 177, 0, 0, 0, 0, 0, 0, 200, 232, 0, 0,
+    208, 240, 170, 186, 0, 0, 204, 236, 202, 234, 0, 0, 0, 0, 0, 0,
+    0, 0, 171, 187, 0, 0, 0, 0, 165, 181, 207, 239, 0, 0, 199, 231,
+    0, 0, 0, 0, 0, 0, 211, 243, 162, 0, 0, 166, 182, 0, 0, 0,
+    0, 0, 0, 0, 0, 209, 241, 0, 0, 0, 189, 191, 210, 242, 0, 0,
+    0, 0, 0, 0, 0, 0, 163, 179, 0, 0, 0, 0, 0, 0, 0, 0,
+    169, 185, 0, 0, 0, 0, 172, 188, 221, 253, 222, 254, 0, 0, 0, 0,
+    0, 0, 217, 249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174, 190, 0,
+    0, 0, 0, 0, 0, 0, 0, 183, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 178, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_5, generated from 8859-5.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_5_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 1025, 1026, 1027, 1028, 1029, 1030, 1031,
+    1032, 1033, 1034, 1035, 1036, 173, 1038, 1039,
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+    1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+    1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+    1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+    1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+    1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+    8470, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
+    1112, 1113, 1114, 1115, 1116, 167, 1118, 1119,
+};
+
+inline constexpr std::uint32_t iso_8859_5_encode_limit = 8512;
+
+inline constexpr std::uint8_t iso_8859_5_encode_stage1[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4,
+};
+
+inline constexpr std::uint8_t iso_8859_5_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 0, 0, 0, 253, 0, 0, 0, 0, 0, 173, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 0, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    0, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 0, 254, 255,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_6, generated from 8859-6.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_6_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 164, 0, 0, 0,
+    0, 0, 0, 0, 1548, 173, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1563, 0, 0, 0, 1567,
+    0, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
+    1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591,
+    1592, 1593, 1594, 0, 0, 0, 0, 0,
+    1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
+    1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+    1616, 1617, 1618, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint32_t iso_8859_6_encode_limit = 1664;
+
+inline constexpr std::uint8_t iso_8859_6_encode_stage1[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+};
+
+inline constexpr std::uint8_t iso_8859_6_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 0, 173, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 172, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 0, 0, 0, 191,
+    0, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 0, 0, 0, 0, 0,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_7, generated from 8859-7.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_7_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 8216, 8217, 163, 8364, 8367, 166, 167,
+    168, 169, 890, 171, 172, 173, 0, 8213,
+    176, 177, 178, 179, 900, 901, 902, 183,
+    904, 905, 906, 187, 908, 189, 910, 911,
+    912, 913, 914, 915, 916, 917, 918, 919,
+    920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 0, 931, 932, 933, 934, 935,
+    936, 937, 938, 939, 940, 941, 942, 943,
+    944, 945, 946, 947, 948, 949, 950, 951,
+    952, 953, 954, 955, 956, 957, 958, 959,
+    960, 961, 962, 963, 964, 965, 966, 967,
+    968, 969, 970, 971, 972, 973, 974, 0,
+};
+
+inline constexpr std::uint32_t iso_8859_7_encode_limit = 8384;
+
+inline constexpr std::uint8_t iso_8859_7_encode_stage1[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 6,
+};
+
+inline constexpr std::uint8_t iso_8859_7_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 163, 0, 0, 166, 167, 168, 169, 0, 171, 172, 173, 0, 0,
+    176, 177, 178, 179, 0, 0, 0, 183, 0, 0, 0, 187, 0, 189, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 180, 181, 182, 0, 184, 185, 186, 0, 188, 0, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 0, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 175, 0, 0, 161, 162, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 0, 0, 165,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_8, generated from 8859-8.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_8_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 162, 163, 164, 165, 166, 167,
+    168, 169, 215, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 247, 187, 188, 189, 190, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8215,
+    1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
+    1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+    1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511,
+    1512, 1513, 1514, 0, 0, 8206, 8207, 0,
+};
+
+inline constexpr std::uint32_t iso_8859_8_encode_limit = 8256;
+
+inline constexpr std::uint8_t iso_8859_8_encode_stage1[] = {
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4,
+};
+
+inline constexpr std::uint8_t iso_8859_8_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 162, 163, 164, 165, 166, 167, 168, 169, 0, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 0, 187, 188, 189, 190, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 254,
+    0, 0, 0, 0, 0, 0, 0, 223, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_9, generated from 8859-9.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_9_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207,
+    286, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 304, 350, 223,
+    224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239,
+    287, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 305, 351, 255,
+};
+
+inline constexpr std::uint32_t iso_8859_9_encode_limit = 384;
+
+inline constexpr std::uint8_t iso_8859_9_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4,
+};
+
+inline constexpr std::uint8_t iso_8859_9_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    0, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 0, 0, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    0, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 0, 0, 255,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    221, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_10, generated from 8859-10.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_10_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 260, 274, 290, 298, 296, 310, 167,
+    315, 272, 352, 358, 381, 173, 362, 330,
+    176, 261, 275, 291, 299, 297, 311, 183,
+    316, 273, 353, 359, 382, 8213, 363, 331,
+    256, 193, 194, 195, 196, 197, 198, 302,
+    268, 201, 280, 203, 278, 205, 206, 207,
+    208, 325, 332, 211, 212, 213, 214, 360,
+    216, 370, 218, 219, 220, 221, 222, 223,
+    257, 225, 226, 227, 228, 229, 230, 303,
+    269, 233, 281, 235, 279, 237, 238, 239,
+    240, 326, 333, 243, 244, 245, 246, 361,
+    248, 371, 250, 251, 252, 253, 254, 312,
+};
+
+inline constexpr std::uint32_t iso_8859_10_encode_limit = 8256;
+
+inline constexpr std::uint8_t iso_8859_10_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5,
+};
+
+inline constexpr std::uint8_t iso_8859_10_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 0, 0, 173, 0, 0,
+    176, 0, 0, 0, 0, 0, 0, 183, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 193, 194, 195, 196, 197, 198, 0, 0, 201, 0, 203, 0, 205, 206, 207,
+    208, 0, 0, 211, 212, 213, 214, 0, 216, 0, 218, 219, 220, 221, 222, 223,
+    0, 225, 226, 227, 228, 229, 230, 0, 0, 233, 0, 235, 0, 237, 238, 239,
+    240, 0, 0, 243, 244, 245, 246, 0, 248, 0, 250, 251, 252, 253, 254, 0,
+    192, 224, 0, 0, 161, 177, 0, 0, 0, 0, 0, 0, 200, 232, 0, 0,
+    169, 185, 162, 178, 0, 0, 204, 236, 202, 234, 0, 0, 0, 0, 0, 0,
+    0, 0, 163, 179, 0, 0, 0, 0, 165, 181, 164, 180, 0, 0, 199, 231,
+    0, 0, 0, 0, 0, 0, 166, 182, 255, 0, 0, 168, 184, 0, 0, 0,
+    0, 0, 0, 0, 0, 209, 241, 0, 0, 0, 175, 191, 210, 242, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    170, 186, 0, 0, 0, 0, 171, 187, 215, 247, 174, 190, 0, 0, 0, 0,
+    0, 0, 217, 249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 172, 188, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_11, generated from 8859-11.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_11_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 3585, 3586, 3587, 3588, 3589, 3590, 3591,
+    3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599,
+    3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607,
+    3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615,
+    3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623,
+    3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631,
+    3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639,
+    3640, 3641, 3642, 0, 0, 0, 0, 3647,
+    3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655,
+    3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663,
+    3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671,
+    3672, 3673, 3674, 3675, 0, 0, 0, 0,
+};
+
+inline constexpr std::uint32_t iso_8859_11_encode_limit = 3712;
+
+inline constexpr std::uint8_t iso_8859_11_encode_stage1[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+};
+
+inline constexpr std::uint8_t iso_8859_11_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 0, 0, 0, 0, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_13, generated from 8859-13.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_13_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 8221, 162, 163, 164, 8222, 166, 167,
+    216, 169, 342, 171, 172, 173, 174, 198,
+    176, 177, 178, 179, 8220, 181, 182, 183,
+    248, 185, 343, 187, 188, 189, 190, 230,
+    260, 302, 256, 262, 196, 197, 280, 274,
+    268, 201, 377, 278, 290, 310, 298, 315,
+    352, 323, 325, 211, 332, 213, 214, 215,
+    370, 321, 346, 362, 220, 379, 381, 223,
+    261, 303, 257, 263, 228, 229, 281, 275,
+    269, 233, 378, 279, 291, 311, 299, 316,
+    353, 324, 326, 243, 333, 245, 246, 247,
+    371, 322, 347, 363, 252, 380, 382, 8217,
+};
+
+inline constexpr std::uint32_t iso_8859_13_encode_limit = 8256;
+
+inline constexpr std::uint8_t iso_8859_13_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5,
+};
+
+inline constexpr std::uint8_t iso_8859_13_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 162, 163, 164, 0, 166, 167, 0, 169, 0, 171, 172, 173, 174, 0,
+    176, 177, 178, 179, 0, 181, 182, 183, 0, 185, 0, 187, 188, 189, 190, 0,
+    0, 0, 0, 0, 196, 197, 175, 0, 0, 201, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 211, 0, 213, 214, 215, 168, 0, 0, 0, 220, 0, 0, 223,
+    0, 0, 0, 0, 228, 229, 191, 0, 0, 233, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 243, 0, 245, 246, 247, 184, 0, 0, 0, 252, 0, 0, 0,
+    194, 226, 0, 0, 192, 224, 195, 227, 0, 0, 0, 0, 200, 232, 0, 0,
+    0, 0, 199, 231, 0, 0, 203, 235, 198, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 204, 236, 0, 0, 0, 0, 0, 0, 206, 238, 0, 0, 193, 225,
+    0, 0, 0, 0, 0, 0, 205, 237, 0, 0, 0, 207, 239, 0, 0, 0,
+    0, 217, 249, 209, 241, 210, 242, 0, 0, 0, 0, 0, 212, 244, 0, 0,
+    0, 0, 0, 0, 0, 0, 170, 186, 0, 0, 218, 250, 0, 0, 0, 0,
+    208, 240, 0, 0, 0, 0, 0, 0, 0, 0, 219, 251, 0, 0, 0, 0,
+    0, 0, 216, 248, 0, 0, 0, 0, 0, 202, 234, 221, 253, 222, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 180, 161, 165, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_14, generated from 8859-14.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_14_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 7682, 7683, 163, 266, 267, 7690, 167,
+    7808, 169, 7810, 7691, 7922, 173, 174, 376,
+    7710, 7711, 288, 289, 7744, 7745, 182, 7766,
+    7809, 7767, 7811, 7776, 7923, 7812, 7813, 7777,
+    192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207,
+    372, 209, 210, 211, 212, 213, 214, 7786,
+    216, 217, 218, 219, 220, 221, 374, 223,
+    224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239,
+    373, 241, 242, 243, 244, 245, 246, 7787,
+    248, 249, 250, 251, 252, 253, 375, 255,
+};
+
+inline constexpr std::uint32_t iso_8859_14_encode_limit = 7936;
+
+inline constexpr std::uint8_t iso_8859_14_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 7, 8,
+};
+
+inline constexpr std::uint8_t iso_8859_14_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 163, 0, 0, 0, 167, 0, 169, 0, 0, 0, 173, 174, 0,
+    0, 0, 0, 0, 0, 0, 182, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    0, 209, 210, 211, 212, 213, 214, 0, 216, 217, 218, 219, 220, 221, 0, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    0, 241, 242, 243, 244, 245, 246, 0, 248, 249, 250, 251, 252, 253, 0, 255,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 165, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    178, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 208, 240, 222, 254, 175, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 161, 162, 0, 0, 0, 0, 0, 0, 166, 171, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 176, 177,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    180, 181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 183, 185, 0, 0, 0, 0, 0, 0, 0, 0,
+    187, 191, 0, 0, 0, 0, 0, 0, 0, 0, 215, 247, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    168, 184, 170, 186, 189, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 172, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_15, generated from 8859-15.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_15_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 8364, 165, 352, 167,
+    353, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 381, 181, 182, 183,
+    382, 185, 186, 187, 338, 339, 376, 191,
+    192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255,
+};
+
+inline constexpr std::uint32_t iso_8859_15_encode_limit = 8384;
+
+inline constexpr std::uint8_t iso_8859_15_encode_stage1[] = {
+    0, 0, 1, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4,
+};
+
+inline constexpr std::uint8_t iso_8859_15_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 0, 165, 0, 167, 0, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 0, 181, 182, 183, 0, 185, 186, 187, 0, 0, 0, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 188, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    166, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 190, 0, 0, 0, 0, 180, 184, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * iso_8859_16, generated from 8859-16.TXT.
+ */
+inline constexpr std::uint16_t iso_8859_16_decode[] = {
+    128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159,
+    160, 260, 261, 321, 8364, 8222, 352, 167,
+    353, 169, 536, 171, 377, 173, 378, 379,
+    176, 177, 268, 322, 381, 8221, 182, 183,
+    382, 269, 537, 187, 338, 339, 376, 380,
+    192, 193, 194, 258, 196, 262, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207,
+    272, 323, 210, 211, 212, 336, 214, 346,
+    368, 217, 218, 219, 220, 280, 538, 223,
+    224, 225, 226, 259, 228, 263, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239,
+    273, 324, 242, 243, 244, 337, 246, 347,
+    369, 249, 250, 251, 252, 281, 539, 255,
+};
+
+inline constexpr std::uint32_t iso_8859_16_encode_limit = 8384;
+
+inline constexpr std::uint8_t iso_8859_16_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 0, 7,
+};
+
+inline constexpr std::uint8_t iso_8859_16_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 0, 0, 0, 0, 0, 0, 167, 0, 169, 0, 171, 0, 173, 0, 0,
+    176, 177, 0, 0, 0, 0, 182, 183, 0, 0, 0, 187, 0, 0, 0, 0,
+    192, 193, 194, 0, 196, 0, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    0, 0, 210, 211, 212, 0, 214, 0, 0, 217, 218, 219, 220, 0, 0, 223,
+    224, 225, 226, 0, 228, 0, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    0, 0, 242, 243, 244, 0, 246, 0, 0, 249, 250, 251, 252, 0, 0, 255,
+    0, 0, 195, 227, 161, 162, 197, 229, 0, 0, 0, 0, 178, 185, 0, 0,
+    208, 240, 0, 0, 0, 0, 0, 0, 221, 253, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 163, 179, 209, 241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    213, 245, 188, 189, 0, 0, 0, 0, 0, 0, 215, 247, 0, 0, 0, 0,
+    166, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    216, 248, 0, 0, 0, 0, 0, 0, 190, 172, 174, 175, 191, 180, 184, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 170, 186, 222, 254, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 181, 165, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * koi8_r, generated from KOI8-R.TXT.
+ */
+inline constexpr std::uint16_t koi8_r_decode[] = {
+    9472, 9474, 9484, 9488, 9492, 9496, 9500, 9508,
+    9516, 9524, 9532, 9600, 9604, 9608, 9612, 9616,
+    9617, 9618, 9619, 8992, 9632, 8729, 8730, 8776,
+    8804, 8805, 160, 8993, 176, 178, 183, 247,
+    9552, 9553, 9554, 1105, 9555, 9556, 9557, 9558,
+    9559, 9560, 9561, 9562, 9563, 9564, 9565, 9566,
+    9567, 9568, 9569, 1025, 9570, 9571, 9572, 9573,
+    9574, 9575, 9576, 9577, 9578, 9579, 9580, 169,
+    1102, 1072, 1073, 1094, 1076, 1077, 1092, 1075,
+    1093, 1080, 1081, 1082, 1083, 1084, 1085, 1086,
+    1087, 1103, 1088, 1089, 1090, 1091, 1078, 1074,
+    1100, 1099, 1079, 1096, 1101, 1097, 1095, 1098,
+    1070, 1040, 1041, 1062, 1044, 1045, 1060, 1043,
+    1061, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+    1055, 1071, 1056, 1057, 1058, 1059, 1046, 1042,
+    1068, 1067, 1047, 1064, 1069, 1065, 1063, 1066,
+};
+
+inline constexpr std::uint32_t koi8_r_encode_limit = 9664;
+
+inline constexpr std::uint8_t koi8_r_encode_stage1[] = {
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 8, 9, 10,
+};
+
+inline constexpr std::uint8_t koi8_r_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    154, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0,
+    156, 0, 157, 0, 0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    225, 226, 247, 231, 228, 229, 246, 250, 233, 234, 235, 236, 237, 238, 239, 240,
+    242, 243, 244, 245, 230, 232, 227, 254, 251, 253, 255, 249, 248, 252, 224, 241,
+    193, 194, 215, 199, 196, 197, 214, 218, 201, 202, 203, 204, 205, 206, 207, 208,
+    210, 211, 212, 213, 198, 200, 195, 222, 219, 221, 223, 217, 216, 220, 192, 209,
+    0, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 150, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 151, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 152, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    147, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 0, 0, 0,
+    131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0, 134, 0, 0, 0,
+    0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0,
+    0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 161, 162, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+    177, 178, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    139, 0, 0, 0, 140, 0, 0, 0, 141, 0, 0, 0, 142, 0, 0, 0,
+    143, 144, 145, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * koi8_u, generated from KOI8-U.TXT.
+ */
+inline constexpr std::uint16_t koi8_u_decode[] = {
+    9472, 9474, 9484, 9488, 9492, 9496, 9500, 9508,
+    9516, 9524, 9532, 9600, 9604, 9608, 9612, 9616,
+    9617, 9618, 9619, 8992, 9632, 8729, 8730, 8776,
+    8804, 8805, 160, 8993, 176, 178, 183, 247,
+    9552, 9553, 9554, 1105, 1108, 9556, 1110, 1111,
+    9559, 9560, 9561, 9562, 9563, 1169, 9565, 9566,
+    9567, 9568, 9569, 1025, 1028, 9571, 1030, 1031,
+    9574, 9575, 9576, 9577, 9578, 1168, 9580, 169,
+    1102, 1072, 1073, 1094, 1076, 1077, 1092, 1075,
+    1093, 1080, 1081, 1082, 1083, 1084, 1085, 1086,
+    1087, 1103, 1088, 1089, 1090, 1091, 1078, 1074,
+    1100, 1099, 1079, 1096, 1101, 1097, 1095, 1098,
+    1070, 1040, 1041, 1062, 1044, 1045, 1060, 1043,
+    1061, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+    1055, 1071, 1056, 1057, 1058, 1059, 1046, 1042,
+    1068, 1067, 1047, 1064, 1069, 1065, 1063, 1066,
+};
+
+inline constexpr std::uint32_t koi8_u_encode_limit = 9664;
+
+inline constexpr std::uint8_t koi8_u_encode_stage1[] = {
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 0, 0, 8, 0, 0, 0,
+    0, 0, 0, 0, 9, 10, 11,
+};
+
+inline constexpr std::uint8_t koi8_u_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    154, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0,
+    156, 0, 157, 0, 0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 179, 0, 0, 180, 0, 182, 183, 0, 0, 0, 0, 0, 0, 0, 0,
+    225, 226, 247, 231, 228, 229, 246, 250, 233, 234, 235, 236, 237, 238, 239, 240,
+    242, 243, 244, 245, 230, 232, 227, 254, 251, 253, 255, 249, 248, 252, 224, 241,
+    193, 194, 215, 199, 196, 197, 214, 218, 201, 202, 203, 204, 205, 206, 207, 208,
+    210, 211, 212, 213, 198, 200, 195, 222, 219, 221, 223, 217, 216, 220, 192, 209,
+    0, 163, 0, 0, 164, 0, 166, 167, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    189, 173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 150, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 151, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 152, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    147, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 0, 0, 0,
+    131, 0, 0, 0, 132, 0, 0, 0, 133, 0, 0, 0, 134, 0, 0, 0,
+    0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0,
+    0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 161, 162, 0, 165, 0, 0, 168, 169, 170, 171, 172, 0, 174, 175, 176,
+    177, 178, 0, 181, 0, 0, 184, 185, 186, 187, 188, 0, 190, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    139, 0, 0, 0, 140, 0, 0, 0, 141, 0, 0, 0, 142, 0, 0, 0,
+    143, 144, 145, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1250, generated from CP1250.TXT.
+ */
+inline constexpr std::uint16_t windows_1250_decode[] = {
+    8364, 0, 8218, 0, 8222, 8230, 8224, 8225,
+    0, 8240, 352, 8249, 346, 356, 381, 377,
+    0, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    0, 8482, 353, 8250, 347, 357, 382, 378,
+    160, 711, 728, 321, 164, 260, 166, 167,
+    168, 169, 350, 171, 172, 173, 174, 379,
+    176, 177, 731, 322, 180, 181, 182, 183,
+    184, 261, 351, 187, 317, 733, 318, 380,
+    340, 193, 194, 258, 196, 313, 262, 199,
+    268, 201, 280, 203, 282, 205, 206, 270,
+    272, 323, 327, 211, 212, 336, 214, 215,
+    344, 366, 218, 368, 220, 221, 354, 223,
+    341, 225, 226, 259, 228, 314, 263, 231,
+    269, 233, 281, 235, 283, 237, 238, 271,
+    273, 324, 328, 243, 244, 337, 246, 247,
+    345, 367, 250, 369, 252, 253, 355, 729,
+};
+
+inline constexpr std::uint32_t windows_1250_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1250_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 0, 7, 0, 8,
+};
+
+inline constexpr std::uint8_t windows_1250_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 0, 0, 0, 164, 0, 166, 167, 168, 169, 0, 171, 172, 173, 174, 0,
+    176, 177, 0, 0, 180, 181, 182, 183, 184, 0, 0, 187, 0, 0, 0, 0,
+    0, 193, 194, 0, 196, 0, 0, 199, 0, 201, 0, 203, 0, 205, 206, 0,
+    0, 0, 0, 211, 212, 0, 214, 215, 0, 0, 218, 0, 220, 221, 0, 223,
+    0, 225, 226, 0, 228, 0, 0, 231, 0, 233, 0, 235, 0, 237, 238, 0,
+    0, 0, 0, 243, 244, 0, 246, 247, 0, 0, 250, 0, 252, 253, 0, 0,
+    0, 0, 195, 227, 165, 185, 198, 230, 0, 0, 0, 0, 200, 232, 207, 239,
+    208, 240, 0, 0, 0, 0, 0, 0, 202, 234, 204, 236, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 229, 0, 0, 188, 190, 0,
+    0, 163, 179, 209, 241, 0, 0, 210, 242, 0, 0, 0, 0, 0, 0, 0,
+    213, 245, 0, 0, 192, 224, 0, 0, 216, 248, 140, 156, 0, 0, 170, 186,
+    138, 154, 222, 254, 141, 157, 0, 0, 0, 0, 0, 0, 0, 0, 217, 249,
+    219, 251, 0, 0, 0, 0, 0, 0, 0, 143, 159, 175, 191, 142, 158, 0,
+    0, 0, 0, 0, 0, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 162, 255, 0, 178, 0, 189, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1251, generated from CP1251.TXT.
+ */
+inline constexpr std::uint16_t windows_1251_decode[] = {
+    1026, 1027, 8218, 1107, 8222, 8230, 8224, 8225,
+    8364, 8240, 1033, 8249, 1034, 1036, 1035, 1039,
+    1106, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    0, 8482, 1113, 8250, 1114, 1116, 1115, 1119,
+    160, 1038, 1118, 1032, 164, 1168, 166, 167,
+    1025, 169, 1028, 171, 172, 173, 174, 1031,
+    176, 177, 1030, 1110, 1169, 181, 182, 183,
+    1105, 8470, 1108, 187, 1112, 1029, 1109, 1111,
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+    1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+    1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+    1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+    1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+    1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+};
+
+inline constexpr std::uint32_t windows_1251_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1251_encode_stage1[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 6, 0, 7,
+};
+
+inline constexpr std::uint8_t windows_1251_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 0, 0, 0, 164, 0, 166, 167, 0, 169, 0, 171, 172, 173, 174, 0,
+    176, 177, 0, 0, 0, 181, 182, 183, 0, 0, 0, 187, 0, 0, 0, 0,
+    0, 168, 128, 129, 170, 189, 178, 175, 163, 138, 140, 142, 141, 0, 161, 143,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    0, 184, 144, 131, 186, 190, 179, 191, 188, 154, 156, 158, 157, 0, 162, 159,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    165, 180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 185, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1252, generated from CP1252.TXT.
+ */
+inline constexpr std::uint16_t windows_1252_decode[] = {
+    8364, 0, 8218, 402, 8222, 8230, 8224, 8225,
+    710, 8240, 352, 8249, 338, 0, 381, 0,
+    0, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    732, 8482, 353, 8250, 339, 0, 382, 376,
+    160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255,
+};
+
+inline constexpr std::uint32_t windows_1252_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1252_encode_stage1[] = {
+    0, 0, 1, 2, 0, 3, 4, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 0, 7, 0, 8,
+};
+
+inline constexpr std::uint8_t windows_1252_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 140, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    138, 154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0, 142, 158, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1253, generated from CP1253.TXT.
+ */
+inline constexpr std::uint16_t windows_1253_decode[] = {
+    8364, 0, 8218, 402, 8222, 8230, 8224, 8225,
+    0, 8240, 0, 8249, 0, 0, 0, 0,
+    0, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    0, 8482, 0, 8250, 0, 0, 0, 0,
+    160, 901, 902, 163, 164, 165, 166, 167,
+    168, 169, 0, 171, 172, 173, 174, 8213,
+    176, 177, 178, 179, 900, 181, 182, 183,
+    904, 905, 906, 187, 908, 189, 910, 911,
+    912, 913, 914, 915, 916, 917, 918, 919,
+    920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 0, 931, 932, 933, 934, 935,
+    936, 937, 938, 939, 940, 941, 942, 943,
+    944, 945, 946, 947, 948, 949, 950, 951,
+    952, 953, 954, 955, 956, 957, 958, 959,
+    960, 961, 962, 963, 964, 965, 966, 967,
+    968, 969, 970, 971, 972, 973, 974, 0,
+};
+
+inline constexpr std::uint32_t windows_1253_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1253_encode_stage1[] = {
+    0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 6, 0, 7,
+};
+
+inline constexpr std::uint8_t windows_1253_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 0, 0, 163, 164, 165, 166, 167, 168, 169, 0, 171, 172, 173, 174, 0,
+    176, 177, 178, 179, 0, 181, 182, 183, 0, 0, 0, 187, 0, 189, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 180, 161, 162, 0, 184, 185, 186, 0, 188, 0, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 0, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 150, 151, 175, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1254, generated from CP1254.TXT.
+ */
+inline constexpr std::uint16_t windows_1254_decode[] = {
+    8364, 0, 8218, 402, 8222, 8230, 8224, 8225,
+    710, 8240, 352, 8249, 338, 0, 0, 0,
+    0, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    732, 8482, 353, 8250, 339, 0, 0, 376,
+    160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207,
+    286, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 304, 350, 223,
+    224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239,
+    287, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 305, 351, 255,
+};
+
+inline constexpr std::uint32_t windows_1254_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1254_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 0, 8, 0, 9,
+};
+
+inline constexpr std::uint8_t windows_1254_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    0, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 0, 0, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    0, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 0, 0, 255,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    221, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 140, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 254,
+    138, 154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1255, generated from CP1255.TXT.
+ */
+inline constexpr std::uint16_t windows_1255_decode[] = {
+    8364, 0, 8218, 402, 8222, 8230, 8224, 8225,
+    710, 8240, 0, 8249, 0, 0, 0, 0,
+    0, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    732, 8482, 0, 8250, 0, 0, 0, 0,
+    160, 161, 162, 163, 8362, 165, 166, 167,
+    168, 169, 215, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 247, 187, 188, 189, 190, 191,
+    1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463,
+    1464, 1465, 0, 1467, 1468, 1469, 1470, 1471,
+    1472, 1473, 1474, 1475, 1520, 1521, 1522, 1523,
+    1524, 0, 0, 0, 0, 0, 0, 0,
+    1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
+    1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+    1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511,
+    1512, 1513, 1514, 0, 0, 8206, 8207, 0,
+};
+
+inline constexpr std::uint32_t windows_1255_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1255_encode_stage1[] = {
+    0, 0, 1, 2, 0, 0, 3, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 0, 8, 0, 9,
+};
+
+inline constexpr std::uint8_t windows_1255_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 161, 162, 163, 0, 165, 166, 167, 168, 169, 0, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 0, 187, 188, 189, 190, 191,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 0, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 0, 0, 0, 0, 0,
+    212, 213, 214, 215, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 254,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1256, generated from CP1256.TXT.
+ */
+inline constexpr std::uint16_t windows_1256_decode[] = {
+    8364, 1662, 8218, 402, 8222, 8230, 8224, 8225,
+    710, 8240, 1657, 8249, 338, 1670, 1688, 1672,
+    1711, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    1705, 8482, 1681, 8250, 339, 8204, 8205, 1722,
+    160, 1548, 162, 163, 164, 165, 166, 167,
+    168, 169, 1726, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 1563, 187, 188, 189, 190, 1567,
+    1729, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
+    1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1586, 1587, 1588, 1589, 1590, 215,
+    1591, 1592, 1593, 1594, 1600, 1601, 1602, 1603,
+    224, 1604, 226, 1605, 1606, 1607, 1608, 231,
+    232, 233, 234, 235, 1609, 1610, 238, 239,
+    1611, 1612, 1613, 1614, 244, 1615, 1616, 247,
+    1617, 249, 1618, 251, 252, 8206, 8207, 1746,
+};
+
+inline constexpr std::uint32_t windows_1256_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1256_encode_stage1[] = {
+    0, 0, 1, 2, 0, 3, 4, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 8, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 0, 11, 0, 12,
+};
+
+inline constexpr std::uint8_t windows_1256_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 0, 162, 163, 164, 165, 166, 167, 168, 169, 0, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 0, 187, 188, 189, 190, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0,
+    224, 0, 226, 0, 0, 0, 0, 231, 232, 233, 234, 235, 0, 0, 238, 239,
+    0, 0, 0, 0, 244, 0, 0, 247, 0, 249, 0, 251, 252, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 140, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 191,
+    0, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 216, 217, 218, 219, 0, 0, 0, 0, 0,
+    220, 221, 222, 223, 225, 227, 228, 229, 230, 236, 237, 240, 241, 242, 243, 245,
+    246, 248, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 0, 129, 0,
+    0, 0, 0, 0, 0, 0, 141, 0, 143, 0, 0, 0, 0, 0, 0, 0,
+    0, 154, 0, 0, 0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0, 0, 0, 144,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 170, 0,
+    0, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 158, 253, 254,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1257, generated from CP1257.TXT.
+ */
+inline constexpr std::uint16_t windows_1257_decode[] = {
+    8364, 0, 8218, 0, 8222, 8230, 8224, 8225,
+    0, 8240, 0, 8249, 0, 168, 711, 184,
+    0, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    0, 8482, 0, 8250, 0, 175, 731, 0,
+    160, 0, 162, 163, 164, 0, 166, 167,
+    216, 169, 342, 171, 172, 173, 174, 198,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    248, 185, 343, 187, 188, 189, 190, 230,
+    260, 302, 256, 262, 196, 197, 280, 274,
+    268, 201, 377, 278, 290, 310, 298, 315,
+    352, 323, 325, 211, 332, 213, 214, 215,
+    370, 321, 346, 362, 220, 379, 381, 223,
+    261, 303, 257, 263, 228, 229, 281, 275,
+    269, 233, 378, 279, 291, 311, 299, 316,
+    353, 324, 326, 243, 333, 245, 246, 247,
+    371, 322, 347, 363, 252, 380, 382, 729,
+};
+
+inline constexpr std::uint32_t windows_1257_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1257_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 0, 7, 0, 8,
+};
+
+inline constexpr std::uint8_t windows_1257_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 0, 162, 163, 164, 0, 166, 167, 141, 169, 0, 171, 172, 173, 174, 157,
+    176, 177, 178, 179, 180, 181, 182, 183, 143, 185, 0, 187, 188, 189, 190, 0,
+    0, 0, 0, 0, 196, 197, 175, 0, 0, 201, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 211, 0, 213, 214, 215, 168, 0, 0, 0, 220, 0, 0, 223,
+    0, 0, 0, 0, 228, 229, 191, 0, 0, 233, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 243, 0, 245, 246, 247, 184, 0, 0, 0, 252, 0, 0, 0,
+    194, 226, 0, 0, 192, 224, 195, 227, 0, 0, 0, 0, 200, 232, 0, 0,
+    0, 0, 199, 231, 0, 0, 203, 235, 198, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 204, 236, 0, 0, 0, 0, 0, 0, 206, 238, 0, 0, 193, 225,
+    0, 0, 0, 0, 0, 0, 205, 237, 0, 0, 0, 207, 239, 0, 0, 0,
+    0, 217, 249, 209, 241, 210, 242, 0, 0, 0, 0, 0, 212, 244, 0, 0,
+    0, 0, 0, 0, 0, 0, 170, 186, 0, 0, 218, 250, 0, 0, 0, 0,
+    208, 240, 0, 0, 0, 0, 0, 0, 0, 0, 219, 251, 0, 0, 0, 0,
+    0, 0, 216, 248, 0, 0, 0, 0, 0, 202, 234, 221, 253, 222, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 158, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * windows_1258, generated from CP1258.TXT.
+ */
+inline constexpr std::uint16_t windows_1258_decode[] = {
+    8364, 0, 8218, 402, 8222, 8230, 8224, 8225,
+    710, 8240, 0, 8249, 338, 0, 0, 0,
+    0, 8216, 8217, 8220, 8221, 8226, 8211, 8212,
+    732, 8482, 0, 8250, 339, 0, 0, 376,
+    160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 258, 196, 197, 198, 199,
+    200, 201, 202, 203, 768, 205, 206, 207,
+    272, 209, 777, 211, 212, 416, 214, 215,
+    216, 217, 218, 219, 220, 431, 771, 223,
+    224, 225, 226, 259, 228, 229, 230, 231,
+    232, 233, 234, 235, 769, 237, 238, 239,
+    273, 241, 803, 243, 244, 417, 246, 247,
+    248, 249, 250, 251, 252, 432, 8363, 255,
+};
+
+inline constexpr std::uint32_t windows_1258_encode_limit = 8512;
+
+inline constexpr std::uint8_t windows_1258_encode_stage1[] = {
+    0, 0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 6, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 0, 9, 0, 10,
+};
+
+inline constexpr std::uint8_t windows_1258_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 0, 196, 197, 198, 199, 200, 201, 202, 203, 0, 205, 206, 207,
+    0, 209, 0, 211, 212, 0, 214, 215, 216, 217, 218, 219, 220, 0, 0, 223,
+    224, 225, 226, 0, 228, 229, 230, 231, 232, 233, 234, 235, 0, 237, 238, 239,
+    0, 241, 0, 243, 244, 0, 246, 247, 248, 249, 250, 251, 252, 0, 0, 255,
+    0, 0, 195, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    208, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 140, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    213, 245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 221,
+    253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    204, 236, 0, 222, 0, 0, 0, 0, 0, 210, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 150, 151, 0, 0, 0, 145, 146, 130, 0, 147, 148, 132, 0,
+    134, 135, 149, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 139, 155, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * cp437, generated from CP437.TXT.
+ */
+inline constexpr std::uint16_t cp437_decode[] = {
+    199, 252, 233, 226, 228, 224, 229, 231,
+    234, 235, 232, 239, 238, 236, 196, 197,
+    201, 230, 198, 244, 246, 242, 251, 249,
+    255, 214, 220, 162, 163, 165, 8359, 402,
+    225, 237, 243, 250, 241, 209, 170, 186,
+    191, 8976, 172, 189, 188, 161, 171, 187,
+    9617, 9618, 9619, 9474, 9508, 9569, 9570, 9558,
+    9557, 9571, 9553, 9559, 9565, 9564, 9563, 9488,
+    9492, 9524, 9516, 9500, 9472, 9532, 9566, 9567,
+    9562, 9556, 9577, 9574, 9568, 9552, 9580, 9575,
+    9576, 9572, 9573, 9561, 9560, 9554, 9555, 9579,
+    9578, 9496, 9484, 9608, 9604, 9612, 9616, 9600,
+    945, 223, 915, 960, 931, 963, 181, 964,
+    934, 920, 937, 948, 8734, 966, 949, 8745,
+    8801, 177, 8805, 8804, 8992, 8993, 247, 8776,
+    176, 8729, 183, 8730, 8319, 178, 9632, 160,
+};
+
+inline constexpr std::uint32_t cp437_encode_limit = 9664;
+
+inline constexpr std::uint8_t cp437_encode_stage1[] = {
+    0, 0, 1, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 4, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 7, 0, 0, 0, 0, 0, 8, 9, 0, 0, 10, 0, 0, 0,
+    0, 0, 0, 0, 11, 12, 13,
+};
+
+inline constexpr std::uint8_t cp437_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255, 173, 155, 156, 0, 157, 0, 0, 0, 0, 166, 174, 170, 0, 0, 0,
+    248, 241, 253, 0, 0, 230, 0, 250, 0, 0, 167, 175, 172, 171, 0, 168,
+    0, 0, 0, 0, 142, 143, 146, 128, 0, 144, 0, 0, 0, 0, 0, 0,
+    0, 165, 0, 0, 0, 0, 153, 0, 0, 0, 0, 0, 154, 0, 0, 225,
+    133, 160, 131, 0, 132, 134, 145, 135, 138, 130, 136, 137, 141, 161, 140, 139,
+    0, 164, 149, 162, 147, 0, 148, 246, 0, 151, 163, 150, 129, 0, 0, 152,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 226, 0, 0, 0, 0, 233, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 228, 0, 0, 232, 0, 0, 234, 0, 0, 0, 0, 0, 0,
+    0, 224, 0, 0, 235, 238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    227, 0, 0, 229, 231, 0, 237, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 252,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 251, 0, 0, 0, 236, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 247, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 240, 0, 0, 243, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    244, 245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    196, 0, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 0, 0, 0,
+    191, 0, 0, 0, 192, 0, 0, 0, 217, 0, 0, 0, 195, 0, 0, 0,
+    0, 0, 0, 0, 180, 0, 0, 0, 0, 0, 0, 0, 194, 0, 0, 0,
+    0, 0, 0, 0, 193, 0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    205, 186, 213, 214, 201, 184, 183, 187, 212, 211, 200, 190, 189, 188, 198, 199,
+    204, 181, 182, 185, 209, 210, 203, 207, 208, 202, 216, 215, 206, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    223, 0, 0, 0, 220, 0, 0, 0, 219, 0, 0, 0, 221, 0, 0, 0,
+    222, 176, 177, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * cp850, generated from CP850.TXT.
+ */
+inline constexpr std::uint16_t cp850_decode[] = {
+    199, 252, 233, 226, 228, 224, 229, 231,
+    234, 235, 232, 239, 238, 236, 196, 197,
+    201, 230, 198, 244, 246, 242, 251, 249,
+    255, 214, 220, 248, 163, 216, 215, 402,
+    225, 237, 243, 250, 241, 209, 170, 186,
+    191, 174, 172, 189, 188, 161, 171, 187,
+    9617, 9618, 9619, 9474, 9508, 193, 194, 192,
+    169, 9571, 9553, 9559, 9565, 162, 165, 9488,
+    9492, 9524, 9516, 9500, 9472, 9532, 227, 195,
+    9562, 9556, 9577, 9574, 9568, 9552, 9580, 164,
+    240, 208, 202, 203, 200, 305, 205, 206,
+    207, 9496, 9484, 9608, 9604, 166, 204, 9600,
+    211, 223, 212, 210, 245, 213, 181, 254,
+    222, 218, 219, 217, 253, 221, 175, 180,
+    173, 177, 8215, 190, 182, 167, 247, 184,
+    176, 168, 183, 185, 179, 178, 9632, 160,
+};
+
+inline constexpr std::uint32_t cp850_encode_limit = 9664;
+
+inline constexpr std::uint8_t cp850_encode_stage1[] = {
+    0, 0, 1, 2, 3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 7, 8,
+};
+
+inline constexpr std::uint8_t cp850_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255, 173, 189, 156, 207, 190, 221, 245, 249, 184, 166, 174, 170, 240, 169, 238,
+    248, 241, 253, 252, 239, 230, 244, 250, 247, 251, 167, 175, 172, 171, 243, 168,
+    183, 181, 182, 199, 142, 143, 146, 128, 212, 144, 210, 211, 222, 214, 215, 216,
+    209, 165, 227, 224, 226, 229, 153, 158, 157, 235, 233, 234, 154, 237, 232, 225,
+    133, 160, 131, 198, 132, 134, 145, 135, 138, 130, 136, 137, 141, 161, 140, 139,
+    208, 164, 149, 162, 147, 228, 148, 246, 155, 151, 163, 150, 129, 236, 231, 152,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 242, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    196, 0, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 0, 0, 0,
+    191, 0, 0, 0, 192, 0, 0, 0, 217, 0, 0, 0, 195, 0, 0, 0,
+    0, 0, 0, 0, 180, 0, 0, 0, 0, 0, 0, 0, 194, 0, 0, 0,
+    0, 0, 0, 0, 193, 0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    205, 186, 0, 0, 201, 0, 0, 187, 0, 0, 200, 0, 0, 188, 0, 0,
+    204, 0, 0, 185, 0, 0, 203, 0, 0, 202, 0, 0, 206, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    223, 0, 0, 0, 220, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 0,
+    0, 176, 177, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * cp866, generated from CP866.TXT.
+ */
+inline constexpr std::uint16_t cp866_decode[] = {
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+    1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+    1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+    1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+    1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+    1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+    9617, 9618, 9619, 9474, 9508, 9569, 9570, 9558,
+    9557, 9571, 9553, 9559, 9565, 9564, 9563, 9488,
+    9492, 9524, 9516, 9500, 9472, 9532, 9566, 9567,
+    9562, 9556, 9577, 9574, 9568, 9552, 9580, 9575,
+    9576, 9572, 9573, 9561, 9560, 9554, 9555, 9579,
+    9578, 9496, 9484, 9608, 9604, 9612, 9616, 9600,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+    1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+    1025, 1105, 1028, 1108, 1031, 1111, 1038, 1118,
+    176, 8729, 183, 8730, 8470, 164, 9632, 160,
+};
+
+inline constexpr std::uint32_t cp866_encode_limit = 9664;
+
+inline constexpr std::uint8_t cp866_encode_stage1[] = {
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 7, 8,
+};
+
+inline constexpr std::uint8_t cp866_encode_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    255, 0, 0, 0, 253, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    248, 0, 0, 0, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 240, 0, 0, 242, 0, 0, 244, 0, 0, 0, 0, 0, 0, 246, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    0, 241, 0, 0, 243, 0, 0, 245, 0, 0, 0, 0, 0, 0, 247, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 251, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    196, 0, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 0, 0, 0,
+    191, 0, 0, 0, 192, 0, 0, 0, 217, 0, 0, 0, 195, 0, 0, 0,
+    0, 0, 0, 0, 180, 0, 0, 0, 0, 0, 0, 0, 194, 0, 0, 0,
+    0, 0, 0, 0, 193, 0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    205, 186, 213, 214, 201, 184, 183, 187, 212, 211, 200, 190, 189, 188, 198, 199,
+    204, 181, 182, 185, 209, 210, 203, 207, 208, 202, 216, 215, 206, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    223, 0, 0, 0, 220, 0, 0, 0, 219, 0, 0, 0, 221, 0, 0, 0,
+    222, 176, 177, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+} /* namespace tables */
+
+namespace codepage {
+
+struct iso_8859_2 {
+    static constexpr auto const& decode = tables::iso_8859_2_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_2_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_2_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_2_encode_stage2;
+};
+
+struct iso_8859_3 {
+    static constexpr auto const& decode = tables::iso_8859_3_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_3_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_3_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_3_encode_stage2;
+};
+
+struct iso_8859_4 {
+    static constexpr auto const& decode = tables::iso_8859_4_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_4_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_4_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_4_encode_stage2;
+};
+
+struct iso_8859_5 {
+    static constexpr auto const& decode = tables::iso_8859_5_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_5_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_5_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_5_encode_stage2;
+};
+
+struct iso_8859_6 {
+    static constexpr auto const& decode = tables::iso_8859_6_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_6_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_6_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_6_encode_stage2;
+};
+
+struct iso_8859_7 {
+    static constexpr auto const& decode = tables::iso_8859_7_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_7_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_7_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_7_encode_stage2;
+};
+
+struct iso_8859_8 {
+    static constexpr auto const& decode = tables::iso_8859_8_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_8_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_8_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_8_encode_stage2;
+};
+
+struct iso_8859_9 {
+    static constexpr auto const& decode = tables::iso_8859_9_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_9_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_9_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_9_encode_stage2;
+};
+
+struct iso_8859_10 {
+    static constexpr auto const& decode = tables::iso_8859_10_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_10_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_10_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_10_encode_stage2;
+};
+
+struct iso_8859_11 {
+    static constexpr auto const& decode = tables::iso_8859_11_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_11_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_11_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_11_encode_stage2;
+};
+
+struct iso_8859_13 {
+    static constexpr auto const& decode = tables::iso_8859_13_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_13_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_13_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_13_encode_stage2;
+};
+
+struct iso_8859_14 {
+    static constexpr auto const& decode = tables::iso_8859_14_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_14_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_14_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_14_encode_stage2;
+};
+
+struct iso_8859_15 {
+    static constexpr auto const& decode = tables::iso_8859_15_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_15_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_15_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_15_encode_stage2;
+};
+
+struct iso_8859_16 {
+    static constexpr auto const& decode = tables::iso_8859_16_decode;
+    static constexpr auto const& encode_limit = tables::iso_8859_16_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::iso_8859_16_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::iso_8859_16_encode_stage2;
+};
+
+struct koi8_r {
+    static constexpr auto const& decode = tables::koi8_r_decode;
+    static constexpr auto const& encode_limit = tables::koi8_r_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::koi8_r_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::koi8_r_encode_stage2;
+};
+
+struct koi8_u {
+    static constexpr auto const& decode = tables::koi8_u_decode;
+    static constexpr auto const& encode_limit = tables::koi8_u_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::koi8_u_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::koi8_u_encode_stage2;
+};
+
+struct windows_1250 {
+    static constexpr auto const& decode = tables::windows_1250_decode;
+    static constexpr auto const& encode_limit = tables::windows_1250_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1250_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1250_encode_stage2;
+};
+
+struct windows_1251 {
+    static constexpr auto const& decode = tables::windows_1251_decode;
+    static constexpr auto const& encode_limit = tables::windows_1251_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1251_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1251_encode_stage2;
+};
+
+struct windows_1252 {
+    static constexpr auto const& decode = tables::windows_1252_decode;
+    static constexpr auto const& encode_limit = tables::windows_1252_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1252_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1252_encode_stage2;
+};
+
+struct windows_1253 {
+    static constexpr auto const& decode = tables::windows_1253_decode;
+    static constexpr auto const& encode_limit = tables::windows_1253_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1253_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1253_encode_stage2;
+};
+
+struct windows_1254 {
+    static constexpr auto const& decode = tables::windows_1254_decode;
+    static constexpr auto const& encode_limit = tables::windows_1254_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1254_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1254_encode_stage2;
+};
+
+struct windows_1255 {
+    static constexpr auto const& decode = tables::windows_1255_decode;
+    static constexpr auto const& encode_limit = tables::windows_1255_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1255_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1255_encode_stage2;
+};
+
+struct windows_1256 {
+    static constexpr auto const& decode = tables::windows_1256_decode;
+    static constexpr auto const& encode_limit = tables::windows_1256_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1256_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1256_encode_stage2;
+};
+
+struct windows_1257 {
+    static constexpr auto const& decode = tables::windows_1257_decode;
+    static constexpr auto const& encode_limit = tables::windows_1257_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1257_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1257_encode_stage2;
+};
+
+struct windows_1258 {
+    static constexpr auto const& decode = tables::windows_1258_decode;
+    static constexpr auto const& encode_limit = tables::windows_1258_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::windows_1258_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::windows_1258_encode_stage2;
+};
+
+struct cp437 {
+    static constexpr auto const& decode = tables::cp437_decode;
+    static constexpr auto const& encode_limit = tables::cp437_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::cp437_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::cp437_encode_stage2;
+};
+
+struct cp850 {
+    static constexpr auto const& decode = tables::cp850_decode;
+    static constexpr auto const& encode_limit = tables::cp850_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::cp850_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::cp850_encode_stage2;
+};
+
+struct cp866 {
+    static constexpr auto const& decode = tables::cp866_decode;
+    static constexpr auto const& encode_limit = tables::cp866_encode_limit;
+    static constexpr auto const& encode_stage1 = tables::cp866_encode_stage1;
+    static constexpr auto const& encode_stage2 = tables::cp866_encode_stage2;
+};
+
+} /* namespace codepage */
+
+} /* namespace utf8pp */
+
+#endif /* PETER_LENKEFI_UTF8PP_TABLES_HPP */
@@ -0,0 +1,196 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+using convert_fn = utf8pp::convert_result (*)(utf8pp::utf8_byte const*,
+    utf8pp::utf8_usize, utf8pp::utf8_byte*);
+
+static bytes_t convert(convert_fn fn, bytes_t const& src) {
+    bytes_t dst(src.size() * 4 + 16);
+    auto res = fn(src.data(), src.size(), dst.data());
+    REQUIRE(res.error == 0);
+    REQUIRE(res.read == src.size());
+    dst.resize(res.written);
+    return dst;
+}
+
+static void check_known(convert_fn decode, convert_fn encode,
+    std::string const& legacy, std::string const& utf8) {
+    REQUIRE(convert(decode, to_bytes(legacy)) == to_bytes(utf8));
+    REQUIRE(convert(encode, to_bytes(utf8)) == to_bytes(legacy));
+}
+
+/**
+ * Decodes every two-byte sequence from the first lead, then checks that
+ * encoding the result decodes to the same codepoint again.
+ */
+static std::size_t check_pairs(convert_fn decode, convert_fn encode,
+    int first_lead = 0x81) {
+    std::size_t mapped = 0;
+    for (int lead = first_lead; lead < 0x100; ++lead) {
+        for (int trail = 0x40; trail < 0x100; ++trail) {
+            bytes_t src = {utf8pp::utf8_byte(lead), utf8pp::utf8_byte(trail)};
+            bytes_t utf8(16);
+            auto res = decode(src.data(), src.size(), utf8.data());
+            if (res.error != 0 || res.read != 2) continue;
+            utf8.resize(res.written);
+            REQUIRE(convert(decode, convert(encode, utf8)) == utf8);
+            ++mapped;
+        }
+    }
+    return mapped;
+}
+
+TEST_CASE("convert Shift_JIS to and from UTF8", "[shift_jis]") {
+    check_known(utf8pp::shift_jis_to_utf8, utf8pp::utf8_to_shift_jis,
+        "a\x93\xfa\x96\x7b\x8c\xea\xb6\xc5",
+        "a\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xef\xbd\xb6\xef\xbe\x85");
+    // NEC row 13 and U+0080
+    check_known(utf8pp::shift_jis_to_utf8, utf8pp::utf8_to_shift_jis,
+        "\x87\x40\x80", "\xe2\x91\xa0\xc2\x80");
+    // The NEC selected IBM extensions encode to the IBM extensions
+    REQUIRE(convert(utf8pp::shift_jis_to_utf8, to_bytes("\xed\x40"))
+        == to_bytes("\xe7\xba\x8a"));
+    REQUIRE(convert(utf8pp::utf8_to_shift_jis, to_bytes("\xe7\xba\x8a"))
+        == to_bytes("\xfa\x5c"));
+    REQUIRE(convert(utf8pp::utf8_to_shift_jis, to_bytes("\xc2\xa5"))
+        == to_bytes("\x5c"));
+    REQUIRE(check_pairs(utf8pp::shift_jis_to_utf8,
+        utf8pp::utf8_to_shift_jis) > 7000);
+}
+
+TEST_CASE("convert EUC-JP to and from UTF8", "[euc_jp]") {
+    check_known(utf8pp::euc_jp_to_utf8, utf8pp::utf8_to_euc_jp,
+        "\xc6\xfc\xcb\xdc\xb8\xec\x8e\xb6\x8e\xc5",
+        "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xef\xbd\xb6\xef\xbe\x85");
+    // JIS X 0212 is decoded, but never encoded
+    REQUIRE(convert(utf8pp::euc_jp_to_utf8, to_bytes("\x8f\xb0\xa1"))
+        == to_bytes("\xe4\xb8\x82"));
+    bytes_t dst(16);
+    auto src = to_bytes("\xe4\xb8\x82");
+    REQUIRE(utf8pp::utf8_to_euc_jp(src.data(), src.size(), dst.data()).error
+        == utf8pp::error::unmappable);
+    // The WHATWG special cases of the encoder
+    REQUIRE(convert(utf8pp::utf8_to_euc_jp,
+        to_bytes("\xc2\xa5\xe2\x80\xbe\xe2\x88\x92"))
+        == to_bytes("\x5c\x7e\xa1\xdd"));
+    REQUIRE(check_pairs(utf8pp::euc_jp_to_utf8,
+        utf8pp::utf8_to_euc_jp) > 6000);
+}
+
+TEST_CASE("convert EUC-KR to and from UTF8", "[euc_kr]") {
+    check_known(utf8pp::euc_kr_to_utf8, utf8pp::utf8_to_euc_kr,
+        "\xc7\xd1\xb1\xb9\xbe\xee",
+        "\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4");
+    REQUIRE(check_pairs(utf8pp::euc_kr_to_utf8,
+        utf8pp::utf8_to_euc_kr) > 17000);
+}
+
+TEST_CASE("convert Big5 to and from UTF8", "[big5]") {
+    check_known(utf8pp::big5_to_utf8, utf8pp::utf8_to_big5,
+        "\xa4\xa4\xa4\xe5\xa6\x72", "\xe4\xb8\xad\xe6\x96\x87\xe5\xad\x97");
+    // HKSCS decodes, also to astral codepoints, but only encodes from 0xa1
+    REQUIRE(convert(utf8pp::big5_to_utf8, to_bytes("\x87\x40\x87\x45"))
+        == to_bytes("\xe4\x8f\xb0\xf0\xa7\x89\xa7"));
+    bytes_t dst(16);
+    auto hkscs = to_bytes("\xe4\x8f\xb0");
+    auto res = utf8pp::utf8_to_big5(hkscs.data(), hkscs.size(), dst.data());
+    REQUIRE(res.error == utf8pp::error::unmappable);
+    REQUIRE(check_pairs(utf8pp::big5_to_utf8, utf8pp::utf8_to_big5, 0xa1)
+        > 13000);
+}
+
+TEST_CASE("convert GB18030 to and from UTF8", "[gb18030]") {
+    check_known(utf8pp::gb18030_to_utf8, utf8pp::utf8_to_gb18030,
+        "\xd6\xd0\xce\xc4\xa2\xe3\x94\x39\xfc\x36",
+        "\xe4\xb8\xad\xe6\x96\x87\xe2\x82\xac\xf0\x9f\x98\x80");
+    // Four-byte BMP sequences go through the ranges
+    check_known(utf8pp::gb18030_to_utf8, utf8pp::utf8_to_gb18030,
+        "\x81\x30\x81\x30", "\xc2\x80");
+    check_known(utf8pp::gb18030_to_utf8, utf8pp::utf8_to_gb18030,
+        "\x84\x31\xa4\x39", "\xef\xbf\xbf");
+    // GB18030-2005 swapped U+E7C7 and U+1E3F
+    check_known(utf8pp::gb18030_to_utf8, utf8pp::utf8_to_gb18030,
+        "\x81\x35\xf4\x37\xa8\xbc", "\xee\x9f\x87\xe1\xb8\xbf");
+    REQUIRE(convert(utf8pp::gb18030_to_utf8, to_bytes("\x80"))
+        == to_bytes("\xe2\x82\xac"));
+    REQUIRE(check_pairs(utf8pp::gb18030_to_utf8,
+        utf8pp::utf8_to_gb18030) > 21000);
+
+    // Every BMP codepoint outside the surrogates round-trips
+    for (utf8pp::utf8_cp cp = 0x80; cp < 0x10000; ++cp) {
+        if (cp >= 0xd800 && cp < 0xe000) continue;
+        bytes_t utf8(4);
+        utf8.resize(utf8pp::utf8_usize(utf8pp::encode_cp(utf8.data(), cp)));
+        bytes_t gb(16);
+        auto res = utf8pp::utf8_to_gb18030(utf8.data(), utf8.size(),
+            gb.data());
+        REQUIRE(res.error == 0);
+        gb.resize(res.written);
+        REQUIRE(convert(utf8pp::gb18030_to_utf8, gb) == utf8);
+    }
+}
+
+TEST_CASE("report CJK conversion errors", "[cjk]") {
+    bytes_t dst(64);
+
+    SECTION("truncated input can be resumed") {
+        auto src = to_bytes("ab\x93");
+        auto res = utf8pp::shift_jis_to_utf8(src.data(), src.size(),
+            dst.data());
+        REQUIRE(res.error == utf8pp::error::incomplete);
+        REQUIRE(res.read == 2);
+        REQUIRE(res.written == 2);
+
+        src = to_bytes("\x94\x39\xfc");
+        res = utf8pp::gb18030_to_utf8(src.data(), src.size(), dst.data());
+        REQUIRE(res.error == utf8pp::error::incomplete);
+        REQUIRE(res.read == 0);
+
+        src = to_bytes("a\xe6\x97");
+        res = utf8pp::utf8_to_euc_jp(src.data(), src.size(), dst.data());
+        REQUIRE(res.error == utf8pp::error::incomplete);
+        REQUIRE(res.read == 1);
+    }
+
+    SECTION("invalid sequences") {
+        auto src = to_bytes("\x81\x20");
+        auto res = utf8pp::euc_kr_to_utf8(src.data(), src.size(), dst.data());
+        REQUIRE(res.error == utf8pp::error::invalid_sequence);
+        res = utf8pp::big5_to_utf8(src.data(), src.size(), dst.data());
+        REQUIRE(res.error == utf8pp::error::invalid_sequence);
+
+        src = to_bytes("\xff");
+        res = utf8pp::gb18030_to_utf8(src.data(), src.size(), dst.data());
+        REQUIRE(res.error == utf8pp::error::invalid_sequence);
+
+        src = to_bytes("\xff\xfe");
+        res = utf8pp::utf8_to_big5(src.data(), src.size(), dst.data());
+        REQUIRE(res.error == utf8pp::error::invalid_utf8);
+
+        // Codepoints above U+10FFFF, overlongs and surrogates
+        for (auto bad : { "\xf4\x90\x80\x80", "\xf7\xbf\xbf\xbf",
+            "\xc1\x81", "\xe0\x80\xaf", "\xed\xa0\x80" }) {
+            src = to_bytes(std::string("a") + bad);
+            res = utf8pp::utf8_to_gb18030(src.data(), src.size(), dst.data());
+            REQUIRE(res.error == utf8pp::error::invalid_utf8);
+            REQUIRE(res.read == 1);
+            REQUIRE(res.written == 1);
+            res = utf8pp::utf8_to_shift_jis(src.data(), src.size(),
+                dst.data());
+            REQUIRE(res.error == utf8pp::error::invalid_utf8);
+        }
+    }
+
+    SECTION("unmappable codepoints") {
+        // Hangul is not in Shift_JIS
+        auto src = to_bytes("x\xed\x95\x9c");
+        auto res = utf8pp::utf8_to_shift_jis(src.data(), src.size(),
+            dst.data());
+        REQUIRE(res.error == utf8pp::error::unmappable);
+        REQUIRE(res.read == 1);
+        REQUIRE(res.written == 1);
+    }
+}
@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+template <typename Codepage>
+static void check_round_trip(std::size_t undefined) {
+    bytes_t src;
+    for (int b = 0; b < 256; ++b) src.push_back(utf8pp::utf8_byte(b));
+
+    // Drop the undefined bytes
+    bytes_t defined;
+    std::size_t undefined_count = 0;
+    for (auto b : src) {
+        bytes_t utf8(3);
+        auto res = utf8pp::codepage_to_utf8<Codepage>(&b, 1, utf8.data());
+        if (res.error == utf8pp::error::unmappable) ++undefined_count;
+        else defined.push_back(b);
+    }
+    REQUIRE(undefined_count == undefined);
+
+    bytes_t utf8(defined.size() * 3);
+    auto res = utf8pp::codepage_to_utf8<Codepage>(defined.data(),
+        defined.size(), utf8.data());
+    REQUIRE(res.error == 0);
+    REQUIRE(res.read == defined.size());
+    utf8.resize(res.written);
+    REQUIRE(utf8pp::validate(utf8.data(), utf8.size()) == utf8.size());
+
+    bytes_t back(utf8.size());
+    res = utf8pp::utf8_to_codepage<Codepage>(utf8.data(), utf8.size(),
+        back.data());
+    REQUIRE(res.error == 0);
+    back.resize(res.written);
+    REQUIRE(back == defined);
+}
+
+TEST_CASE("round-trip single-byte codepages", "[codepage]") {
+    check_round_trip<utf8pp::codepage::iso_8859_2>(0);
+    check_round_trip<utf8pp::codepage::iso_8859_3>(7);
+    check_round_trip<utf8pp::codepage::iso_8859_15>(0);
+    check_round_trip<utf8pp::codepage::koi8_r>(0);
+    check_round_trip<utf8pp::codepage::windows_1251>(1);
+    check_round_trip<utf8pp::codepage::windows_1252>(5);
+    check_round_trip<utf8pp::codepage::cp437>(0);
+}
+
+TEST_CASE("convert text to and from codepages", "[codepage]") {
+    // "Привет" in KOI8-R
+    bytes_t koi8 = { 0xf0, 0xd2, 0xc9, 0xd7, 0xc5, 0xd4 };
+    std::string expected = u8"Привет";
+
+    bytes_t utf8(koi8.size() * 3);
+    auto res = utf8pp::codepage_to_utf8<utf8pp::codepage::koi8_r>(
+        koi8.data(), koi8.size(), utf8.data());
+    REQUIRE(res.error == 0);
+    REQUIRE(std::string(utf8.begin(), utf8.begin() + res.written) == expected);
+
+    // The euro sign is in ISO-8859-15, but not in ISO-8859-2
+    std::string text = u8"ab€";
+    auto src = bytes(text);
+    bytes_t dst(64);
+    res = utf8pp::utf8_to_codepage<utf8pp::codepage::iso_8859_15>(src,
+        text.size(), dst.data());
+    REQUIRE(res.error == 0);
+    REQUIRE(res.written == 3);
+    REQUIRE(dst[2] == 0xa4);
+
+    res = utf8pp::utf8_to_codepage<utf8pp::codepage::iso_8859_2>(src,
+        text.size(), dst.data());
+    REQUIRE(res.error == utf8pp::error::unmappable);
+    REQUIRE(res.read == 2);
+}
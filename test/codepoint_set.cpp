@@ -0,0 +1,285 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static std::string to_string(utf8pp::codepoint_set const& set) {
+    std::string result;
+    for (auto r : set.ranges()) {
+        result += std::to_string(r.first) + "-" + std::to_string(r.last) + " ";
+    }
+    return result;
+}
+
+static std::string to_string(std::vector<utf8pp::utf8_sequence> const& seqs) {
+    static char const hex[] = "0123456789ABCDEF";
+    std::string result;
+    for (auto const& seq : seqs) {
+        for (std::size_t i = 0; i < seq.length; ++i) {
+            auto r = seq.bytes[i];
+            result += '[';
+            result += { hex[r.first >> 4], hex[r.first & 15] };
+            if (r.first != r.last) {
+                result += { '-', hex[r.last >> 4], hex[r.last & 15] };
+            }
+            result += ']';
+        }
+        result += ' ';
+    }
+    return result;
+}
+
+TEST_CASE("combine codepoint sets", "[codepoint_set]") {
+    utf8pp::codepoint_set set;
+    REQUIRE(set.empty());
+    set.add(10, 20).add(30, 40).add(21).add(50, 60);
+    REQUIRE(to_string(set) == "10-21 30-40 50-60 ");
+    set.add(35, 52);
+    REQUIRE(to_string(set) == "10-21 30-60 ");
+    REQUIRE(set.contains(10));
+    REQUIRE(set.contains(45));
+    REQUIRE(!set.contains(25));
+    REQUIRE(!set.contains(61));
+
+    utf8pp::codepoint_set other(15, 35);
+    REQUIRE(to_string(set.unite(other)) == "10-60 ");
+    REQUIRE(to_string(set.intersect(other)) == "15-21 30-35 ");
+    REQUIRE(to_string(set.subtract(other)) == "10-14 36-60 ");
+    REQUIRE(to_string(set.complement()) == "0-9 22-29 61-1114111 ");
+    REQUIRE(to_string(set.complement().complement()) == to_string(set));
+    REQUIRE(to_string(utf8pp::codepoint_set().complement()) == "0-1114111 ");
+}
+
+TEST_CASE("convert codepoint sets to UTF8 sequences", "[codepoint_set]") {
+    auto all = utf8pp::codepoint_set().complement();
+    REQUIRE(to_string(all.to_utf8_sequences()) == "[00-7F] [C2-DF][80-BF] "
+        "[E0][A0-BF][80-BF] [E1-EC][80-BF][80-BF] [ED][80-9F][80-BF] "
+        "[EE-EF][80-BF][80-BF] [F0][90-BF][80-BF][80-BF] "
+        "[F1-F3][80-BF][80-BF][80-BF] [F4][80-8F][80-BF][80-BF] ");
+    REQUIRE(to_string(utf8pp::codepoint_set(0x10, 0x50).to_utf8_sequences())
+        == "[10-50] ");
+    REQUIRE(to_string(utf8pp::codepoint_set(0xe9, 0x3042).to_utf8_sequences())
+        == "[C3][A9-BF] [C4-DF][80-BF] [E0][A0-BF][80-BF] "
+        "[E1-E2][80-BF][80-BF] [E3][80][80-BF] [E3][81][80-82] ");
+    REQUIRE(utf8pp::codepoint_set(0xd800, 0xdfff).to_utf8_sequences().empty());
+
+    // The DFA of every codepoint is minimal
+    auto dfa = all.compile();
+    REQUIRE(dfa.state_count() == 10);
+    bytes_t invalid = { 0xc0, 0x80, 0xed, 0xa0, 0x80, 0xf4, 0x90, 0x80, 0x80,
+        0xe3, 0x81 };
+    for (std::size_t i = 0; i < invalid.size(); ++i) {
+        REQUIRE(dfa.match(invalid.data() + i,
+            invalid.data() + invalid.size()) == 0);
+    }
+}
+
+TEST_CASE("match codepoint sets with a DFA", "[codepoint_set]") {
+    std::mt19937 rng(44);
+    for (int round = 0; round < 2; ++round) {
+        // Random ranges of random sizes
+        utf8pp::codepoint_set set;
+        for (int i = 0; i < 200; ++i) {
+            auto first = utf8pp::utf8_cp(rng() % 0x110000);
+            auto size = utf8pp::utf8_cp(1) << (rng() % 14);
+            set.add(first, std::min(utf8pp::utf8_cp(first + rng() % size),
+                utf8pp::max_codepoint));
+        }
+        auto seqs = set.to_utf8_sequences();
+        auto dfa = set.compile();
+
+        utf8pp::utf8_byte buf[8] = {};
+        for (utf8pp::utf8_cp cp = 0; cp <= utf8pp::max_codepoint; ++cp) {
+            if (cp >= 0xd800 && cp <= 0xdfff) continue;
+            auto n = std::size_t(utf8pp::encode_cp(buf, cp));
+            auto expected = set.contains(cp) ? n : 0;
+            REQUIRE(dfa.match(buf, buf + n) == expected);
+            if (cp % 61 == 0) {
+                std::size_t matching = 0;
+                for (auto const& seq : seqs) {
+                    matching += seq.matches(buf, buf + n);
+                }
+                REQUIRE(matching == (expected ? 1 : 0));
+            }
+        }
+    }
+
+    // Skipping a run of letters
+    utf8pp::codepoint_set letters;
+    letters.add('a', 'z').add(0xe0, 0xff).add(0x3041, 0x3096);
+    auto dfa = letters.compile();
+    std::string text = "abc\xc3\xa9\xe3\x81\x93" "d-ef";
+    auto src = bytes(text);
+    REQUIRE(dfa.span(src, src + text.size()) == 9);
+    REQUIRE(dfa.span(src + 9, src + text.size()) == 0);
+    REQUIRE(dfa.span(src, src + 6) == 5);
+    REQUIRE(dfa.match(src + 3, src + text.size()) == 2);
+}
+
+TEST_CASE("frozen_codepoint_set contains", "[codepoint_set]") {
+    std::mt19937 rng(46);
+    utf8pp::codepoint_set set;
+    for (int i = 0; i < 300; ++i) {
+        auto first = utf8pp::utf8_cp(rng() % 0x110000);
+        if (i % 3 == 0) first %= 0x10000;
+        auto size = utf8pp::utf8_cp(1) << (rng() % 12);
+        set.add(first, std::min(utf8pp::utf8_cp(first + rng() % size),
+            utf8pp::max_codepoint));
+    }
+    utf8pp::frozen_codepoint_set frozen(set);
+    for (utf8pp::utf8_cp cp = 0; cp <= utf8pp::max_codepoint; ++cp) {
+        REQUIRE(frozen.contains(cp) == set.contains(cp));
+    }
+    REQUIRE(!utf8pp::frozen_codepoint_set().contains('a'));
+}
+
+TEST_CASE("frozen_codepoint_set scans", "[codepoint_set]") {
+    auto check = [](utf8pp::codepoint_set const& set, std::string const& s,
+        std::size_t not_in, std::size_t in) {
+        utf8pp::frozen_codepoint_set frozen(set);
+        auto src = bytes(s);
+        REQUIRE(frozen.find_first_not_in(src, s.size()) == not_in);
+        REQUIRE(frozen.find_first_in(src, s.size()) == in);
+        REQUIRE(frozen.all_of(src, s.size()) == (not_in == s.size()));
+        REQUIRE(frozen.any_of(src, s.size()) == (in != s.size()));
+    };
+
+    // ASCII as a single range
+    utf8pp::codepoint_set alnum;
+    alnum.add('a', 'z');
+    std::string text = "abcdefghijklmnopqrstuvwxyz";
+    check(alnum, text, text.size(), 0);
+    check(alnum, text + "!", text.size(), 0);
+    check(alnum, text + "\xc3\xa9", text.size(), 0);
+    check(alnum, "0123456789012345678x", 0, 19);
+    check(alnum, "", 0, 0);
+
+    // ASCII as a bitmap, plus non-ASCII
+    alnum.add('A', 'Z').add('0', '9').add(0xe9).add(0x1f600);
+    check(alnum, text + "AZ09\xc3\xa9" "\xf0\x9f\x98\x80", 36, 0);
+    check(alnum, "-- \xc3\xa9", 0, 3);
+    check(alnum, "\xc3\xa8\xc3\xa9", 0, 2);
+    check(alnum, "ab\xf0\x9f\x98\x81", 2, 0);
+
+    // Invalid bytes are never in the set
+    utf8pp::codepoint_set all(0, utf8pp::max_codepoint);
+    check(all, text + "\xc0\xaf" + text, 26, 0);
+    check(all, text + text + "\xed\xa0\x80", 52, 0);
+    check(all, "abc\xe3\x81", 3, 0);
+    check(utf8pp::codepoint_set(), "\xff\xc3\xa9", 0, 3);
+
+    // Every offset of a longer mixed buffer against decoding
+    std::mt19937 rng(7);
+    char const* pieces[] = {"a", "Z", "5", " ", "\xc3\xa9", "\xe3\x81\x93",
+        "\xf0\x9f\x98\x80", "\xff", "\xe3\x81"};
+    std::string buf;
+    for (int i = 0; i < 2000; ++i) buf += pieces[rng() % 9];
+    utf8pp::frozen_codepoint_set frozen(alnum);
+    auto src = bytes(buf);
+    for (std::size_t from = 0; from < buf.size(); from += 7) {
+        std::size_t expected = from;
+        while (expected < buf.size()) {
+            utf8pp::utf8_cp cp = 0;
+            auto n = utf8pp::read_next(src + expected, src + buf.size(), cp);
+            if (n <= 0 || !alnum.contains(cp)) break;
+            expected += std::size_t(n);
+        }
+        auto found = frozen.find_first_not_in(src + from, buf.size() - from);
+        REQUIRE(from + found == expected);
+    }
+}
+
+static utf8pp::codepoint_set parse(std::string const& pattern) {
+    utf8pp::codepoint_set set;
+    auto n = utf8pp::parse_codepoint_set(bytes(pattern), pattern.size(),
+        set);
+    REQUIRE(n == utf8pp::utf8_ssize(pattern.size()));
+    return set;
+}
+
+static utf8pp::utf8_ssize parse_error(std::string const& pattern) {
+    utf8pp::codepoint_set set;
+    return utf8pp::parse_codepoint_set(bytes(pattern), pattern.size(), set);
+}
+
+TEST_CASE("parse_codepoint_set", "[codepoint_set]") {
+    // Codepoints, ranges and escapes
+    REQUIRE(to_string(parse("[abc]")) == "97-99 ");
+    REQUIRE(to_string(parse("[a-c x-z]")) == "97-99 120-122 ");
+    REQUIRE(to_string(parse("[a - c]")) == "97-99 ");
+    REQUIRE(to_string(parse("[a-]")) == "45-45 97-97 ");
+    REQUIRE(to_string(parse("[\\- \\ ]")) == "32-32 45-45 ");
+    REQUIRE(to_string(parse("[\\u00e9-\\x{ff}\\U0001F600]"))
+        == "233-255 128512-128512 ");
+    REQUIRE(to_string(parse("[\xc3\xa9]")) == "233-233 ");
+    REQUIRE(to_string(parse("[^\\x00-\\x{10fffe}]")) == "1114111-1114111 ");
+    REQUIRE(parse("[]").empty());
+
+    // Properties
+    auto han = parse("\\p{Script=Han}");
+    REQUIRE(han.contains(0x4e00));
+    REQUIRE(han.contains(0x3007));
+    REQUIRE(!han.contains(0x3041));
+    REQUIRE(to_string(parse("[:Han:]")) == to_string(han));
+    REQUIRE(to_string(parse("[:sc=Han:]")) == to_string(han));
+    REQUIRE(to_string(parse("\\p{sc:han}")) == to_string(han));
+    REQUIRE(to_string(parse("[:^Han:]")) == to_string(han.complement()));
+    REQUIRE(to_string(parse("\\P{Han}")) == to_string(han.complement()));
+    auto lu = parse("[:Lu:]");
+    REQUIRE(lu.contains('A'));
+    REQUIRE(!lu.contains('a'));
+    REQUIRE(to_string(parse("[\\p{gc=Lu}]")) == to_string(lu));
+    REQUIRE(to_string(parse("[[:Lu:][:Ll:][:Lt:]]"))
+        == to_string(parse("\\p{LC}")));
+
+    // Set algebra, from left to right
+    auto set = parse("[\\p{Script=Han}&&[^\\p{Nd}]]");
+    REQUIRE(to_string(set) == to_string(han));
+    set = parse("[\\p{Script=Latin} & \\p{Lu}]");
+    REQUIRE(set.contains('A'));
+    REQUIRE(set.contains(0xc9));
+    REQUIRE(!set.contains('a'));
+    REQUIRE(!set.contains(0x391));
+    set = parse("[\\p{L}-[a-z]]");
+    REQUIRE(set.contains('A'));
+    REQUIRE(!set.contains('q'));
+    REQUIRE(set.contains(0xe9));
+    REQUIRE(to_string(parse("[a-z--[aeiou]&[a-f]]")) == "98-100 102-102 ");
+    REQUIRE(to_string(parse("[[a-z]&&[^[:L:]]]")) == "");
+    REQUIRE(to_string(parse("[a-c[x-z]]")) == "97-99 120-122 ");
+    REQUIRE(to_string(parse("[ab&[b]]")) == "98-98 ");
+    REQUIRE(to_string(parse("[^[^a]]")) == "97-97 ");
+
+    // Only the set at the start is parsed
+    utf8pp::codepoint_set prefix;
+    std::string text = " [ab] rest";
+    REQUIRE(utf8pp::parse_codepoint_set(bytes(text), text.size(), prefix)
+        == 5);
+    REQUIRE(to_string(prefix) == "97-98 ");
+
+    // Errors
+    REQUIRE(parse_error("") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("abc") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[abc") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[z-a]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[[a]&b]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[[a]&]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[&[a]]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[a-\\d]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[{ab}]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[\\x{41") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[\\x{41]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[:Nope:]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("\\p{Script=Lu}") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error("[\xff]") == utf8pp::error::invalid_pattern);
+    REQUIRE(parse_error(std::string(300, '[') + std::string(300, ']'))
+        == utf8pp::error::invalid_pattern);
+
+    // Frozen for lookups
+    utf8pp::frozen_codepoint_set frozen(parse("[\\p{Han}\\p{Hiragana}]"));
+    std::string jp = "\xe6\x97\xa5\xe6\x9c\xac\xe3\x81\x94";
+    REQUIRE(frozen.all_of(bytes(jp), jp.size()));
+}
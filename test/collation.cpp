@@ -0,0 +1,144 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static int collate(std::string const& a, std::string const& b,
+    utf8pp::collation_options const& options = {}) {
+    return utf8pp::collate(bytes(a), a.size(), bytes(b), b.size(), options);
+}
+
+static std::vector<utf8pp::utf8_byte> key(std::string const& s,
+    utf8pp::collation_options const& options = {}) {
+    return utf8pp::sort_key(bytes(s), s.size(), options);
+}
+
+// Checks that the strings are in strictly ascending order
+static void require_order(std::vector<std::string> const& strings,
+    utf8pp::collation_options const& options = {}) {
+    for (std::size_t i = 1; i < strings.size(); ++i) {
+        INFO(strings[i - 1] << " < " << strings[i]);
+        REQUIRE(collate(strings[i - 1], strings[i], options) < 0);
+        REQUIRE(collate(strings[i], strings[i - 1], options) > 0);
+        REQUIRE(key(strings[i - 1], options) < key(strings[i], options));
+    }
+}
+
+TEST_CASE("collate in DUCET order", "[collate]") {
+    require_order({ "a", "A", "\xc3\xa1", "\xc3\xa4", "b", "B" });
+    require_order({ "resume", "r\xc3\xa9sum\xc3\xa9", "resumes" });
+    require_order({ "cote", "cot\xc3\xa9", "c\xc3\xb4te",
+        "c\xc3\xb4t\xc3\xa9" });
+    require_order({ "1", "10", "2", "a" });
+    require_order({ "\xce\xb1", "\xce\x91", "\xce\xb2" });
+    require_order({ "\xd0\xb0", "\xd0\xb1", "\xd0\xb8", "\xd0\xb9" });
+
+    // Non-ignorable punctuation sorts before letters
+    require_order({ "de luge", "de-luge", "deluge", "deLuge" });
+
+    // Implicit weights: core Han, other Han, then unassigned, in codepoint
+    // order within each
+    require_order({ "\xe4\xb8\x80", "\xe4\xb8\x81", "\xe3\x90\x80",
+        "\xf0\xa0\x80\x80", "\xcd\xb8", "\xf4\x8f\xbf\xbf" });
+    // Han of Unicode 14 is not unassigned
+    require_order({ "\xe9\xbf\xbc", "\xe9\xbf\xbd", "\xe3\x90\x80",
+        "\xf0\xaa\x9b\x9f", "\xf0\xab\x9c\xb8", "\xcd\xb8" });
+    std::uint32_t implicit[2] = {};
+    utf8pp::detail::collation_implicit(0x9ffd, implicit);
+    REQUIRE(implicit[0] >> 16 == 0xfb41);
+    utf8pp::detail::collation_implicit(0x2b738, implicit);
+    REQUIRE(implicit[0] >> 16 == 0xfb85);
+    // Tangut before Han
+    require_order({ "\xf0\x97\x80\x80", "\xf0\x97\x80\x81", "\xe4\xb8\x80" });
+
+    // Contractions and their precomposed forms
+    REQUIRE(collate("\xd0\x99", "\xd0\x98\xcc\x86") == 0);
+    REQUIRE(collate("\xd0\x98\xcc\x86", "\xd0\x98") > 0);
+    require_order({ "l", "l\xc2\xb7", "la" });
+
+    // Invalid bytes are U+FFFD
+    REQUIRE(collate("a\xff", "a\xef\xbf\xbd") == 0);
+    REQUIRE(collate("", "") == 0);
+    REQUIRE(collate("", "a") < 0);
+    REQUIRE(key("") < key("a"));
+    REQUIRE(collate("\x01", "") == 0);
+}
+
+TEST_CASE("collate with strengths and variable weighting", "[collate]") {
+    utf8pp::collation_options primary;
+    primary.strength = utf8pp::collation_strength::primary;
+    REQUIRE(collate("a", "\xc3\x81", primary) == 0);
+    REQUIRE(collate("a", "b", primary) < 0);
+
+    utf8pp::collation_options secondary;
+    secondary.strength = utf8pp::collation_strength::secondary;
+    REQUIRE(collate("a", "A", secondary) == 0);
+    REQUIRE(collate("a", "\xc3\xa1", secondary) < 0);
+
+    utf8pp::collation_options shifted;
+    shifted.shifted = true;
+    REQUIRE(collate("de-luge", "deluge", shifted) == 0);
+    REQUIRE(collate("de luge", "de-luge", shifted) == 0);
+    REQUIRE(collate("de-luge", "deLuge", shifted) < 0);
+    // Accents after ignored punctuation are ignored too
+    REQUIRE(collate("a-\xcc\x81", "a-", shifted) == 0);
+
+    shifted.strength = utf8pp::collation_strength::quaternary;
+    require_order({ "de luge", "de-luge", "deluge", "deLuge" }, shifted);
+
+    // Without shifting, the quaternary level adds nothing
+    utf8pp::collation_options quaternary;
+    quaternary.strength = utf8pp::collation_strength::quaternary;
+    REQUIRE(key("ab", quaternary) == key("ab"));
+}
+
+TEST_CASE("sort keys agree with collation", "[sort_key]") {
+    static char const* pieces[] = { "a", "A", "b", "l", "-", " ", "1",
+        "\xc2\xb7", "\xc3\xa1", "\xcc\x81", "\xd0\x98", "\xcc\x86", "\xd0\x99",
+        "\xe4\xb8\x80", "\xe3\x90\x80", "\xe0\xb9\x80", "\xe0\xb8\x81",
+        "\xff", "\xef\xb7\xba" };
+    auto count = sizeof(pieces) / sizeof(pieces[0]);
+    std::mt19937 rng(49);
+    auto random_text = [&] {
+        std::string result;
+        auto n = rng() % 8;
+        for (std::size_t i = 0; i < n; ++i) result += pieces[rng() % count];
+        return result;
+    };
+    auto sign = [](int x) { return (x > 0) - (x < 0); };
+
+    for (int round = 0; round < 20000; ++round) {
+        // Sort keys never skip, so common prefixes test the skipping of
+        // equal bytes in collate
+        auto prefix = random_text();
+        auto a = prefix + random_text();
+        auto b = prefix + random_text();
+        utf8pp::collation_options options;
+        options.strength = utf8pp::collation_strength(1 + rng() % 4);
+        options.shifted = rng() % 2 == 0;
+
+        auto ka = key(a, options);
+        auto kb = key(b, options);
+        auto by_key = ka < kb ? -1 : kb < ka ? 1 : 0;
+        INFO(a << " <> " << b);
+        REQUIRE(sign(collate(a, b, options)) == by_key);
+        REQUIRE(sign(collate(b, a, options)) == -by_key);
+    }
+
+    // Sorting by keys is sorting by collation
+    std::vector<std::string> names;
+    for (int i = 0; i < 500; ++i) names.push_back(random_text());
+    auto by_collate = names;
+    std::stable_sort(by_collate.begin(), by_collate.end(),
+        [](std::string const& x, std::string const& y) {
+            return collate(x, y) < 0;
+        });
+    std::stable_sort(names.begin(), names.end(),
+        [](std::string const& x, std::string const& y) {
+            return key(x) < key(y);
+        });
+    REQUIRE(names == by_collate);
+}
@@ -0,0 +1,130 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <utf8pp.hpp>
+
+using utf8pp::encoding;
+
+static utf8pp::detection_result detect(std::string const& s,
+    utf8pp::utf8_usize limit = 1 << 16) {
+    return utf8pp::detect_encoding(bytes(s), s.size(), limit);
+}
+
+static void check_detected(encoding expected, std::string const& s) {
+    auto res = detect(s);
+    REQUIRE(res.detected == expected);
+    REQUIRE(res.confidence > 0.5f);
+    REQUIRE(res.bom == 0);
+}
+
+TEST_CASE("detect byte order marks", "[detect_encoding]") {
+    auto res = detect("\xef\xbb\xbf" "abc");
+    REQUIRE(res.detected == encoding::utf8);
+    REQUIRE(res.bom == 3);
+
+    res = detect(std::string("\xff\xfe\x00\x00" "a\x00\x00\x00", 8));
+    REQUIRE(res.detected == encoding::utf32le);
+    REQUIRE(res.bom == 4);
+
+    res = detect(std::string("\x00\x00\xfe\xff", 4));
+    REQUIRE(res.detected == encoding::utf32be);
+
+    res = detect("\xff\xfe" "a");
+    REQUIRE(res.detected == encoding::utf16le);
+    REQUIRE(res.bom == 2);
+
+    res = detect("\xfe\xff");
+    REQUIRE(res.detected == encoding::utf16be);
+    REQUIRE(res.confidence == 1);
+}
+
+TEST_CASE("detect Unicode without a byte order mark", "[detect_encoding]") {
+    auto res = detect("plain text");
+    REQUIRE(res.detected == encoding::utf8);
+    REQUIRE(res.confidence == 1);
+
+    res = detect("Gr\xc3\xbc\xc3\x9f" "e aus K\xc3\xb6ln");
+    REQUIRE(res.detected == encoding::utf8);
+    REQUIRE(res.confidence > 0.9f);
+
+    res = detect(std::string("H\x00" "e\x00l\x00l\x00o\x00", 10));
+    REQUIRE(res.detected == encoding::utf16le);
+    res = detect(std::string("\x00H\x00" "e\x00l\x00l\x00o", 10));
+    REQUIRE(res.detected == encoding::utf16be);
+
+    // Zero bytes without a pattern are binary
+    res = detect(std::string("\x00\x00\x01\x02\x00\x00\x03\x04", 8));
+    REQUIRE(res.detected == encoding::unknown);
+}
+
+TEST_CASE("detect legacy encodings", "[detect_encoding]") {
+    SECTION("Shift_JIS") {
+        check_detected(encoding::shift_jis,
+        "\x93\xfa\x96\x7b\x8c\xea\x82\xcc\x83\x65\x83\x4c\x83\x58\x83\x67"
+        "\x82\xc5\x82\xb7\x81\x42\x82\xb1\x82\xea\x82\xcd\x95\xb6\x8e\x9a"
+        "\x83\x52\x81\x5b\x83\x68\x82\xcc\x94\xbb\x92\xe8\x82\xf0\x82\xb7"
+        "\x82\xe9\x82\xbd\x82\xdf\x82\xcc\x83\x54\x83\x93\x83\x76\x83\x8b"
+        "\x82\xc5\x82\xb7\x81\x42");
+    }
+
+    SECTION("EUC-JP") {
+        check_detected(encoding::euc_jp,
+        "\xc6\xfc\xcb\xdc\xb8\xec\xa4\xce\xa5\xc6\xa5\xad\xa5\xb9\xa5\xc8"
+        "\xa4\xc7\xa4\xb9\xa1\xa3\xa4\xb3\xa4\xec\xa4\xcf\xca\xb8\xbb\xfa"
+        "\xa5\xb3\xa1\xbc\xa5\xc9\xa4\xce\xc8\xbd\xc4\xea\xa4\xf2\xa4\xb9"
+        "\xa4\xeb\xa4\xbf\xa4\xe1\xa4\xce\xa5\xb5\xa5\xf3\xa5\xd7\xa5\xeb"
+        "\xa4\xc7\xa4\xb9\xa1\xa3");
+    }
+
+    SECTION("EUC-KR") {
+        check_detected(encoding::euc_kr,
+        "\xc7\xd1\xb1\xb9\xbe\xee\x20\xc5\xd8\xbd\xba\xc6\xae\xc0\xd4\xb4"
+        "\xcf\xb4\xd9\x2e\x20\xc0\xcc\xb0\xcd\xc0\xba\x20\xb9\xae\xc0\xda"
+        "\x20\xc0\xce\xc4\xda\xb5\xf9\xc0\xbb\x20\xc6\xc7\xba\xb0\xc7\xcf"
+        "\xb1\xe2\x20\xc0\xa7\xc7\xd1\x20\xbf\xb9\xc1\xa6\xc0\xd4\xb4\xcf"
+        "\xb4\xd9\x2e");
+    }
+
+    SECTION("GB18030") {
+        check_detected(encoding::gb18030,
+        "\xd5\xe2\xca\xc7\xd2\xbb\xb8\xf6\xd3\xc3\xd3\xda\xbc\xec\xb2\xe2"
+        "\xd7\xd6\xb7\xfb\xb1\xe0\xc2\xeb\xb5\xc4\xd6\xd0\xce\xc4\xce\xc4"
+        "\xb1\xbe\xa1\xa3\xce\xd2\xc3\xc7\xd4\xda\xd5\xe2\xc0\xef\xd0\xb4"
+        "\xc1\xcb\xd2\xbb\xd0\xa9\xb3\xa3\xd3\xc3\xb5\xc4\xbe\xe4\xd7\xd3"
+        "\xa1\xa3");
+    }
+
+    SECTION("Big5") {
+        check_detected(encoding::big5,
+        "\xb3\x6f\xac\x4f\xa4\x40\xad\xd3\xa5\xce\xa9\xf3\xc0\xcb\xb4\xfa"
+        "\xa6\x72\xa4\xb8\xbd\x73\xbd\x58\xaa\xba\xa4\xa4\xa4\xe5\xa4\xe5"
+        "\xa5\xbb\xa1\x43\xa7\xda\xad\xcc\xa6\x62\xb3\x6f\xb8\xcc\xbc\x67"
+        "\xa4\x46\xa4\x40\xa8\xc7\xb1\x60\xa5\xce\xaa\xba\xa5\x79\xa4\x6c"
+        "\xa1\x43");
+    }
+
+    SECTION("Windows-1252") {
+        check_detected(encoding::windows_1252,
+        "\x4c\x65\x20\x63\x61\x66\xe9\x20\xe9\x74\x61\x69\x74\x20\x74\x72"
+        "\xe8\x73\x20\x62\x6f\x6e\x2c\x20\xe0\x20\x63\xf4\x74\xe9\x20\x64"
+        "\x65\x20\x6c\x92\x68\xf4\x74\x65\x6c\x20\xab\x20\xc9\x6c\x79\x73"
+        "\xe9\x65\x20\xbb\x2e");
+    }
+}
+
+TEST_CASE("detect from a prefix of the text", "[detect_encoding]") {
+    std::string text(100, 'a');
+    text += "\xe9t\xe9";
+
+    // Only the sampled prefix is looked at
+    auto res = detect(text, 64);
+    REQUIRE(res.detected == encoding::utf8);
+    REQUIRE(res.confidence == 1);
+    res = detect(text);
+    REQUIRE(res.detected == encoding::windows_1252);
+
+    // A sequence cut by the end of the prefix is still valid UTF8
+    text = std::string(63, 'a') + "\xc3\xa9";
+    res = detect(text, 64);
+    REQUIRE(res.detected == encoding::utf8);
+}
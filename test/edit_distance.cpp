@@ -0,0 +1,189 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static std::size_t distance(std::string const& a, std::string const& b) {
+    return utf8pp::edit_distance(bytes(a), a.size(), bytes(b), b.size());
+}
+
+static std::size_t damerau(std::string const& a, std::string const& b) {
+    return utf8pp::damerau_distance(bytes(a), a.size(), bytes(b), b.size());
+}
+
+// Splits into codepoints, or single invalid bytes
+static std::vector<std::string> split(std::string const& s) {
+    std::vector<std::string> result;
+    auto it = bytes(s);
+    auto end = it + s.size();
+    while (it != end) {
+        utf8pp::utf8_cp cp = 0;
+        auto n = utf8pp::read_next(it, end, cp);
+        if (n <= 0) n = 1;
+        result.emplace_back((char const*)it, std::size_t(n));
+        it += n;
+    }
+    return result;
+}
+
+// The textbook dynamic programming, with transpositions for the optimal
+// string alignment distance
+static std::size_t reference(std::string const& sa, std::string const& sb,
+    bool transpositions) {
+    auto a = split(sa);
+    auto b = split(sb);
+    std::vector<std::vector<std::size_t>> d(a.size() + 1,
+        std::vector<std::size_t>(b.size() + 1));
+    for (std::size_t i = 0; i <= a.size(); ++i) d[i][0] = i;
+    for (std::size_t j = 0; j <= b.size(); ++j) d[0][j] = j;
+    for (std::size_t i = 1; i <= a.size(); ++i) {
+        for (std::size_t j = 1; j <= b.size(); ++j) {
+            auto cost = a[i - 1] == b[j - 1] ? 0 : 1;
+            d[i][j] = std::min({ d[i - 1][j] + 1, d[i][j - 1] + 1,
+                d[i - 1][j - 1] + cost });
+            if (transpositions && i > 1 && j > 1 && a[i - 1] == b[j - 2]
+                && a[i - 2] == b[j - 1]) {
+                d[i][j] = std::min(d[i][j], d[i - 2][j - 2] + 1);
+            }
+        }
+    }
+    return d[a.size()][b.size()];
+}
+
+static std::string random_text(std::mt19937& rng, std::size_t max_length) {
+    static char const* pieces[] = { "a", "b", "c", "\xc3\xa9",
+        "\xe6\x97\xa5", "\xf0\x9f\x98\x80", "\xff" };
+    std::string result;
+    auto n = rng() % (max_length + 1);
+    for (std::size_t i = 0; i < n; ++i) result += pieces[rng() % 7];
+    return result;
+}
+
+TEST_CASE("compute edit distances", "[edit_distance]") {
+    REQUIRE(distance("", "") == 0);
+    REQUIRE(distance("", "abc") == 3);
+    REQUIRE(distance("kitten", "sitting") == 3);
+    REQUIRE(distance("flaw", "lawn") == 2);
+    REQUIRE(distance("ca", "ac") == 2);
+    REQUIRE(damerau("ca", "ac") == 1);
+    REQUIRE(damerau("ca", "abc") == 3);
+    REQUIRE(damerau("abcdef", "badcfe") == 3);
+
+    // Codepoints, not bytes
+    REQUIRE(distance("caf\xc3\xa9", "cafe") == 1);
+    REQUIRE(distance("\xc3\xa9", "\xc3\xa8") == 1);
+    REQUIRE(distance("\xe6\x97\xa5\xe6\x9c\xac", "\xe6\x97\xa5") == 1);
+    REQUIRE(damerau("\xc3\xa9" "a", "a\xc3\xa9") == 1);
+
+    // Invalid bytes only equal themselves
+    REQUIRE(distance("a\xff", "a\xff") == 0);
+    REQUIRE(distance("a\xff", "a\xfe") == 1);
+    REQUIRE(distance("\xc3", "\xc3\xa9") == 1);
+
+    // Bounded
+    auto a = std::string("kitten");
+    auto b = std::string("sitting");
+    REQUIRE(utf8pp::edit_distance(bytes(a), a.size(), bytes(b), b.size(), 3)
+        == 3);
+    REQUIRE(utf8pp::edit_distance(bytes(a), a.size(), bytes(b), b.size(), 2)
+        == utf8pp::not_found);
+    REQUIRE(utf8pp::edit_distance(bytes(a), 0, bytes(b), b.size(), 6)
+        == utf8pp::not_found);
+    REQUIRE(utf8pp::damerau_distance(bytes(a), a.size(), bytes(a), 0, 5)
+        == utf8pp::not_found);
+}
+
+TEST_CASE("compare edit distances against dynamic programming",
+    "[edit_distance]") {
+    std::mt19937 rng(48);
+    for (int round = 0; round < 3000; ++round) {
+        // Long queries take several words
+        auto max_length = round % 10 == 0 ? 200 : 12;
+        auto a = random_text(rng, std::size_t(max_length));
+        auto b = random_text(rng, std::size_t(max_length));
+        auto expected = reference(a, b, false);
+        REQUIRE(distance(a, b) == expected);
+        REQUIRE(damerau(a, b) == reference(a, b, true));
+
+        std::size_t max = rng() % 8;
+        auto bounded = utf8pp::edit_distance(bytes(a), a.size(), bytes(b),
+            b.size(), max);
+        REQUIRE(bounded == (expected <= max ? expected : utf8pp::not_found));
+    }
+}
+
+TEST_CASE("match with a Levenshtein automaton", "[levenshtein_automaton]") {
+    std::mt19937 rng(480);
+    for (int round = 0; round < 300; ++round) {
+        for (bool transpositions : { false, true }) {
+            auto query = random_text(rng, round % 10 == 0 ? 100 : 8);
+            utf8pp::levenshtein_automaton automaton(bytes(query),
+                query.size(), transpositions);
+            REQUIRE(automaton.length() == split(query).size());
+
+            // Stepping matches the distance of every prefix, and the lower
+            // bound holds for every extension
+            auto text = random_text(rng, 12);
+            auto cps = split(text);
+            auto state = automaton.start();
+            std::string prefix;
+            for (std::size_t i = 0; i <= cps.size(); ++i) {
+                REQUIRE(automaton.distance(state)
+                    == reference(query, prefix, transpositions));
+                auto bound = automaton.lower_bound(state);
+                for (int k = 0; k < 5; ++k) {
+                    auto longer = prefix + random_text(rng, 6);
+                    REQUIRE(bound <= reference(query, longer, transpositions));
+                }
+                if (i == cps.size()) break;
+                utf8pp::utf8_cp cp = 0;
+                auto n = utf8pp::read_next(bytes(cps[i]),
+                    bytes(cps[i]) + cps[i].size(), cp);
+                if (n <= 0) cp = utf8pp::max_codepoint + 1 + bytes(cps[i])[0];
+                automaton.step(state, cp);
+                prefix += cps[i];
+            }
+        }
+    }
+
+    // Filtering a sorted word list, sharing the states of common prefixes
+    std::vector<std::string> words = { "apple", "applet", "apply", "banana",
+        "bandana", "cabana", "\xc3\xa1ppel" };
+    auto query = std::string("appel");
+    utf8pp::levenshtein_automaton automaton(bytes(query), query.size(), true);
+    std::vector<std::string> found;
+    std::vector<utf8pp::levenshtein_automaton::state> states;
+    std::size_t visited = 0;
+    std::string last;
+    for (auto const& word : words) {
+        auto cps = split(word);
+        auto last_cps = split(last);
+        std::size_t common = 0;
+        while (common < cps.size() && common < last_cps.size()
+            && cps[common] == last_cps[common] && common < states.size()) {
+            ++common;
+        }
+        states.resize(common);
+        auto state = common == 0 ? automaton.start() : states.back();
+        bool pruned = false;
+        for (auto i = common; i < cps.size(); ++i) {
+            if (automaton.lower_bound(state) > 1) {
+                pruned = true;
+                break;
+            }
+            utf8pp::utf8_cp cp = 0;
+            utf8pp::read_next(bytes(cps[i]), bytes(cps[i]) + cps[i].size(),
+                cp);
+            automaton.step(state, cp);
+            states.push_back(state);
+            ++visited;
+        }
+        if (!pruned && automaton.distance(state) <= 1) found.push_back(word);
+        last = word;
+    }
+    REQUIRE(found == std::vector<std::string>{ "apple", "\xc3\xa1ppel" });
+    REQUIRE(visited < 30);
+}
@@ -0,0 +1,24 @@
+#ifndef UTF8PP_TEST_HELPERS_HPP
+#define UTF8PP_TEST_HELPERS_HPP
+
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+using bytes_t = std::vector<utf8pp::utf8_byte>;
+
+// The bytes of a string, for the functions taking byte pointers
+inline utf8pp::utf8_byte const* bytes(std::string const& s) {
+    return (utf8pp::utf8_byte const*)s.data();
+}
+
+// A copy of the bytes of a string. The spare capacity keeps GCC's
+// -Warray-bounds quiet about the block loops on short inputs.
+inline bytes_t to_bytes(std::string const& s) {
+    bytes_t result;
+    result.reserve(s.size() + 16);
+    result.assign(s.begin(), s.end());
+    return result;
+}
+
+#endif /* UTF8PP_TEST_HELPERS_HPP */
@@ -0,0 +1,119 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+using convert_fn = utf8pp::convert_result (*)(utf8pp::utf8_byte const*,
+    utf8pp::utf8_usize, utf8pp::utf8_byte*);
+
+static std::string convert(convert_fn fn, std::string const& s,
+    utf8pp::utf8_ssize error = 0) {
+    bytes_t dst(s.size() * 6 + 1024);
+    auto res = fn(bytes(s), s.size(), dst.data());
+    REQUIRE(res.error == error);
+    return std::string(dst.begin(), dst.begin() + long(res.written));
+}
+
+TEST_CASE("encode and decode Punycode", "[punycode]") {
+    std::pair<std::string, std::string> const samples[] = {
+        { "b\xc3\xbc" "cher", "bcher-kva" },
+        { "m\xc3\xbc" "nchen", "mnchen-3ya" },
+        { "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "wgv71a119e" },
+        // RFC 3492 sample (A), Arabic (Egyptian)
+        { "\xd9\x84\xd9\x8a\xd9\x87\xd9\x85\xd8\xa7\xd8\xa8\xd8\xaa\xd9\x83"
+          "\xd9\x84\xd9\x85\xd9\x88\xd8\xb4\xd8\xb9\xd8\xb1\xd8\xa8\xd9\x8a"
+          "\xd8\x9f", "egbpdaj6bu4bxfgehfvwxn" },
+        { "a-b", "a-b-" },
+        { "", "" },
+    };
+    for (auto const& [text, encoded] : samples) {
+        REQUIRE(convert(utf8pp::punycode_encode, text) == encoded);
+        REQUIRE(convert(utf8pp::punycode_decode, encoded) == text);
+    }
+
+    // Uppercase digits decode too
+    REQUIRE(convert(utf8pp::punycode_decode, "BCHER-KVA")
+        == "B\xc3\xbc" "CHER");
+
+    convert(utf8pp::punycode_encode, "\xff", utf8pp::error::invalid_utf8);
+    convert(utf8pp::punycode_decode, "a!", utf8pp::error::invalid_sequence);
+    convert(utf8pp::punycode_decode, "zz", utf8pp::error::invalid_sequence);
+    convert(utf8pp::punycode_decode, "99999999999",
+        utf8pp::error::invalid_sequence);
+}
+
+TEST_CASE("convert domain names to ASCII", "[idna_to_ascii]") {
+    auto to_ascii = [](std::string const& s,
+        utf8pp::utf8_ssize error = 0) {
+        return convert(utf8pp::idna_to_ascii, s, error);
+    };
+
+    SECTION("ASCII") {
+        REQUIRE(to_ascii("www.Example.COM") == "www.example.com");
+        REQUIRE(to_ascii("example.com.") == "example.com.");
+        REQUIRE(to_ascii("xn--bcher-kva.example")
+            == "xn--bcher-kva.example");
+    }
+
+    SECTION("mapping") {
+        REQUIRE(to_ascii("B\xc3\x9c" "cher.example")
+            == "xn--bcher-kva.example");
+        // Nontransitional, sharp s is kept
+        REQUIRE(to_ascii("fa\xc3\x9f.de") == "xn--fa-hia.de");
+        // Fullwidth letters and the ideographic full stop
+        REQUIRE(to_ascii("\xef\xbc\xa1\xef\xbc\xa2\xe3\x80\x82" "com")
+            == "ab.com");
+        // Soft hyphens are ignored
+        REQUIRE(to_ascii("ex\xc2\xad" "ample.com") == "example.com");
+    }
+
+    SECTION("errors") {
+        using utf8pp::error::invalid_label;
+        to_ascii("", invalid_label);
+        to_ascii("a..b", invalid_label);
+        to_ascii(".a", invalid_label);
+        to_ascii("-abc.com", invalid_label);
+        to_ascii("abc-.com", invalid_label);
+        to_ascii("ab--cd.com", invalid_label);
+        to_ascii("a b.com", invalid_label);
+        to_ascii("a_b.com", invalid_label);
+        to_ascii(std::string(64, 'a') + ".com", invalid_label);
+        // Invalid or non-canonical Punycode
+        to_ascii("xn--a.com", invalid_label);
+        to_ascii("xn--abc-.com", invalid_label);
+        // A leading combining mark
+        to_ascii("\xcc\x81" "a.com", invalid_label);
+        // Private use
+        to_ascii("\xee\x80\x80.com", invalid_label);
+        to_ascii("a\xc3", utf8pp::error::incomplete);
+    }
+
+    SECTION("length") {
+        std::string label(63, 'a');
+        std::string name = label + "." + label + "." + label + "."
+            + std::string(61, 'a');
+        REQUIRE(name.size() == 253);
+        REQUIRE(to_ascii(name) == name);
+        REQUIRE(to_ascii(name + ".") == name + ".");
+        to_ascii(name + "a", utf8pp::error::invalid_label);
+        to_ascii(name + ".a", utf8pp::error::invalid_label);
+    }
+
+    SECTION("error offset") {
+        std::string s = "ok.b\xc3\xbc" "cher.a_b";
+        bytes_t dst(256);
+        auto res = utf8pp::idna_to_ascii(bytes(s), s.size(), dst.data());
+        REQUIRE(res.error == utf8pp::error::invalid_label);
+        REQUIRE(res.read == 11);
+    }
+}
+
+TEST_CASE("convert domain names to Unicode", "[idna_to_unicode]") {
+    REQUIRE(convert(utf8pp::idna_to_unicode, "XN--BCHER-KVA.Example.")
+        == "b\xc3\xbc" "cher.example.");
+    REQUIRE(convert(utf8pp::idna_to_unicode, "M\xc3\x9c" "NCHEN.de")
+        == "m\xc3\xbc" "nchen.de");
+    convert(utf8pp::idna_to_unicode, "xn--a.com",
+        utf8pp::error::invalid_label);
+}
@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static std::string escape(std::string const& s,
+    utf8pp::utf8_ssize error = 0) {
+    bytes_t dst(s.size() * 6 + 16);
+    auto res = utf8pp::json_escape(bytes(s), s.size(), dst.data());
+    REQUIRE(res.error == error);
+    return std::string(dst.begin(), dst.begin() + long(res.written));
+}
+
+static std::string unescape(std::string const& s,
+    utf8pp::utf8_ssize error = 0) {
+    bytes_t dst(s.size() + 16);
+    auto res = utf8pp::json_unescape(bytes(s), s.size(), dst.data());
+    REQUIRE(res.error == error);
+    return std::string(dst.begin(), dst.begin() + long(res.written));
+}
+
+TEST_CASE("escape strings for JSON", "[json_escape]") {
+    REQUIRE(escape("plain") == "plain");
+    REQUIRE(escape("say \"hi\"\\") == "say \\\"hi\\\"\\\\");
+    REQUIRE(escape("a\nb\tc\x01") == "a\\nb\\tc\\u0001");
+    REQUIRE(escape(std::string("\0", 1)) == "\\u0000");
+    REQUIRE(escape("h\xc3\xa9 \xf0\x9f\x98\x80")
+        == "h\xc3\xa9 \xf0\x9f\x98\x80");
+
+    // Special bytes in and after whole blocks
+    std::string text = "0123456789abcdef\"0123456789abcdef\n0123456789abcdef";
+    REQUIRE(escape(text)
+        == "0123456789abcdef\\\"0123456789abcdef\\n0123456789abcdef");
+
+    // Validated in the same pass
+    escape("0123456789abcdef\xff", utf8pp::error::invalid_utf8);
+    escape("\xed\xa0\xbd", utf8pp::error::invalid_utf8);
+    escape("ab\xe2\x82", utf8pp::error::incomplete);
+}
+
+TEST_CASE("unescape JSON strings", "[json_unescape]") {
+    REQUIRE(unescape("plain") == "plain");
+    REQUIRE(unescape("say \\\"hi\\\"\\\\\\/") == "say \"hi\"\\/");
+    REQUIRE(unescape("\\b\\f\\n\\r\\t") == "\b\f\n\r\t");
+    REQUIRE(unescape("\\u00e9\\u20AC") == "\xc3\xa9\xe2\x82\xac");
+    REQUIRE(unescape("\\u0000") == std::string("\0", 1));
+    REQUIRE(unescape("0123456789abcdef\\ud83d\\ude00!")
+        == "0123456789abcdef\xf0\x9f\x98\x80!");
+    REQUIRE(unescape("h\xc3\xa9") == "h\xc3\xa9");
+
+    SECTION("errors") {
+        using namespace utf8pp;
+        unescape("\\x", error::invalid_sequence);
+        unescape("\\u12g4", error::invalid_sequence);
+        unescape("a\"b", error::invalid_sequence);
+        unescape("a\nb", error::invalid_sequence);
+        unescape("\xc3", error::incomplete);
+        unescape("\xff", error::invalid_utf8);
+        unescape("\\u12", error::incomplete);
+        unescape("\\ud83d", error::incomplete);
+        unescape("\\ud83d\\u", error::incomplete);
+        unescape("\\ud83dxxxxxx", error::invalid_codepoint);
+        unescape("\\ud83d\\u0041", error::invalid_codepoint);
+        unescape("\\ude00", error::invalid_codepoint);
+    }
+}
+
+TEST_CASE("round-trip strings through JSON escapes", "[json_escape]") {
+    std::string text;
+    for (int i = 0; i < 0x80; ++i) text += char(i);
+    text += "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+    REQUIRE(unescape(escape(text)) == text);
+}
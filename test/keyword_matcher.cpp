@@ -0,0 +1,137 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <utf8pp.hpp>
+
+using match_t = std::tuple<std::size_t, std::size_t, std::size_t>;
+
+static utf8pp::keyword_matcher compile(std::vector<std::string> const& kws,
+    bool ignore_case = false) {
+    utf8pp::keyword_matcher matcher(ignore_case);
+    for (auto const& kw : kws) matcher.add(bytes(kw), kw.size());
+    matcher.compile();
+    return matcher;
+}
+
+static std::set<match_t> find_all(utf8pp::keyword_matcher const& matcher,
+    std::string const& s) {
+    std::set<match_t> result;
+    for (auto m : matcher.find_all(bytes(s), s.size())) {
+        result.insert({ m.keyword, m.begin, m.end });
+    }
+    return result;
+}
+
+// Every occurrence of every keyword, with the same boundary rules
+static std::set<match_t> naive_find_all(std::vector<std::string> const& kws,
+    std::string const& s) {
+    std::set<match_t> result;
+    auto cont = [](char c) { return (c & 0xc0) == 0x80; };
+    for (std::size_t k = 0; k < kws.size(); ++k) {
+        auto const& n = kws[k];
+        if (n.empty()) continue;
+        for (std::size_t i = 0; i + n.size() <= s.size(); ++i) {
+            if (s.compare(i, n.size(), n) == 0 && !cont(s[i])
+                && (i + n.size() == s.size() || !cont(s[i + n.size()]))) {
+                result.insert({ k, i, i + n.size() });
+            }
+        }
+    }
+    return result;
+}
+
+TEST_CASE("match keywords", "[keyword_matcher]") {
+    std::vector<std::string> kws = { "he", "she", "his", "hers", "" };
+    auto matcher = compile(kws);
+    REQUIRE(matcher.keyword_count() == 5);
+    auto found = matcher.find_all(bytes("ushers"), 6);
+    REQUIRE(found.size() == 3);
+    // Ordered by end, longer matches first
+    REQUIRE(found[0].keyword == 1);
+    REQUIRE(found[0].begin == 1);
+    REQUIRE(found[1].keyword == 0);
+    REQUIRE(found[1].begin == 2);
+    REQUIRE(found[2].keyword == 3);
+    REQUIRE(found[2].end == 6);
+
+    // No matches in the middle of sequences
+    kws = { "\x98\x80", "\xc3\xa9", "\xf0\x9f\x98\x80" };
+    matcher = compile(kws);
+    std::string text = "\xf0\x9f\x98\x80 \xc3\xa9\x80 \xc3\xa9";
+    REQUIRE(find_all(matcher, text) == std::set<match_t>{ { 2, 0, 4 },
+        { 1, 9, 11 } });
+
+    // Random texts, with and without the prefilter
+    std::mt19937 rng(43);
+    std::string const alphabet[] = { "a", "b", "q", "#", "\xc3\xa9",
+        "\xe3\x81\x93", "\x80", " " };
+    auto random_text = [&](std::size_t n, std::size_t letters) {
+        std::string s;
+        for (std::size_t i = 0; i < n; ++i) s += alphabet[rng() % letters];
+        return s;
+    };
+    for (int round = 0; round < 200; ++round) {
+        std::vector<std::string> kws;
+        auto letters = round % 2 == 0 ? 8 : 4;
+        for (int i = 0, n = 1 + int(rng() % 6); i < n; ++i) {
+            kws.push_back(random_text(1 + rng() % 4, std::size_t(letters)));
+        }
+        auto matcher = compile(kws);
+        auto text = random_text(rng() % 300, 8);
+        REQUIRE(find_all(matcher, text) == naive_find_all(kws, text));
+    }
+}
+
+TEST_CASE("match keywords ignoring case", "[keyword_matcher]") {
+    std::vector<std::string> kws = { "STRASSE", "stra\xc3\x9f", "ss", "#1",
+        "\xc3\x89t\xc3\xa9" };
+    auto matcher = compile(kws, true);
+    std::string text = "Stra\xc3\x9f" "e, \xc3\xa9T\xc3\x89 #1";
+    REQUIRE(find_all(matcher, text) == std::set<match_t>{ { 0, 0, 7 },
+        { 1, 0, 6 }, { 2, 4, 6 }, { 4, 9, 14 }, { 3, 15, 17 } });
+    // Half of a folding doesn't match
+    kws = { "se" };
+    REQUIRE(compile(kws, true).find_all(bytes(text), text.size()).empty());
+
+    // Random texts, checked against find_ignore_case at every start
+    std::mt19937 rng(1043);
+    std::string const alphabet[] = { "a", "A", "s", "S", "\xc3\x9f",
+        "\xe1\xba\x9e", "\xe2\x84\xaa", "k", "#", "\xc3\xa9", "\xc3\x89" };
+    auto random_text = [&](std::size_t n) {
+        std::string s;
+        for (std::size_t i = 0; i < n; ++i) s += alphabet[rng() % 11];
+        return s;
+    };
+    for (int round = 0; round < 200; ++round) {
+        std::vector<std::string> kws;
+        for (int i = 0, n = 1 + int(rng() % 4); i < n; ++i) {
+            kws.push_back(random_text(1 + rng() % 3));
+        }
+        // Every other round, every keyword gets a rare byte for the
+        // prefilter
+        if (round % 2 == 0) {
+            for (auto& kw : kws) kw.insert(rng() % (kw.size() + 1), "#");
+        }
+        auto matcher = compile(kws, true);
+        auto text = random_text(rng() % 200);
+
+        std::set<std::pair<std::size_t, std::size_t>> found;
+        for (auto m : matcher.find_all(bytes(text), text.size())) {
+            found.insert({ m.keyword, m.begin });
+        }
+        std::set<std::pair<std::size_t, std::size_t>> expected;
+        for (std::size_t k = 0; k < kws.size(); ++k) {
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                auto m = utf8pp::find_ignore_case(bytes(text) + i,
+                    text.size() - i, bytes(kws[k]), kws[k].size());
+                if (m.offset == 0) expected.insert({ k, i });
+            }
+        }
+        REQUIRE(found == expected);
+    }
+}
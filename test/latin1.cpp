@@ -0,0 +1,117 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static bytes_t all_latin1() {
+    bytes_t result;
+    // Long enough to hit both the scalar and the block paths
+    for (int i = 0; i < 3; ++i) {
+        for (int b = 0; b < 256; ++b) result.push_back(utf8pp::utf8_byte(b));
+        result.insert(result.end(), 40, 'x');
+    }
+    return result;
+}
+
+TEST_CASE("convert Latin-1 to and from UTF8", "[latin1]") {
+    auto latin1 = all_latin1();
+    bytes_t utf8(latin1.size() * 2);
+    auto written = utf8pp::latin1_to_utf8(latin1.data(), latin1.size(),
+        utf8.data());
+    utf8.resize(written);
+
+    // Check against the generic encoder
+    bytes_t oracle;
+    for (auto b : latin1) {
+        utf8pp::utf8_byte buf[4];
+        auto n = utf8pp::encode_cp(buf, b);
+        oracle.insert(oracle.end(), buf, buf + n);
+    }
+    REQUIRE(utf8 == oracle);
+    REQUIRE(utf8pp::fits_in_latin1(utf8.data(), utf8.size()));
+
+    bytes_t back(utf8.size());
+    auto res = utf8pp::utf8_to_latin1(utf8.data(), utf8.size(), back.data());
+    REQUIRE(res.error == 0);
+    REQUIRE(res.read == utf8.size());
+    back.resize(res.written);
+    REQUIRE(back == latin1);
+}
+
+TEST_CASE("reject text that does not fit in Latin-1", "[latin1]") {
+    std::string text = std::string(20, 'a') + u8"Ā" + "b";
+    auto src = bytes(text);
+    REQUIRE(!utf8pp::fits_in_latin1(src, text.size()));
+
+    bytes_t dst(text.size());
+    auto res = utf8pp::utf8_to_latin1(src, text.size(), dst.data());
+    REQUIRE(res.error == utf8pp::error::unmappable);
+    REQUIRE(res.read == 20);
+    REQUIRE(res.written == 20);
+
+    text[21] = 'c';
+    src = bytes(text);
+    REQUIRE(!utf8pp::fits_in_latin1(src, text.size()));
+    res = utf8pp::utf8_to_latin1(src, text.size(), dst.data());
+    REQUIRE(res.error == utf8pp::error::invalid_utf8);
+    REQUIRE(res.read == 20);
+}
+
+TEST_CASE("convert Windows-1252 to and from UTF8", "[cp1252]") {
+    // The 5 undefined bytes are unmappable
+    bytes_t cp1252;
+    for (auto b : all_latin1()) {
+        if (b != 0x81 && b != 0x8d && b != 0x8f && b != 0x90 && b != 0x9d) {
+            cp1252.push_back(b);
+        }
+    }
+    bytes_t utf8(cp1252.size() * 3);
+    auto res = utf8pp::cp1252_to_utf8(cp1252.data(), cp1252.size(),
+        utf8.data());
+    REQUIRE(res.error == 0);
+    utf8.resize(res.written);
+
+    // U+20AC, the euro sign
+    REQUIRE(utf8[128] == 0xe2);
+    REQUIRE(utf8[129] == 0x82);
+    REQUIRE(utf8[130] == 0xac);
+
+    bytes_t back(utf8.size());
+    res = utf8pp::utf8_to_cp1252(utf8.data(), utf8.size(), back.data());
+    REQUIRE(res.error == 0);
+    back.resize(res.written);
+    REQUIRE(back == cp1252);
+
+    std::string text = u8"\u0081";
+    res = utf8pp::utf8_to_cp1252(bytes(text), text.size(), back.data());
+    REQUIRE(res.error == utf8pp::error::unmappable);
+}
+
+TEST_CASE("cp1252 converters agree with the codepage engine", "[cp1252]") {
+    using windows_1252 = utf8pp::codepage::windows_1252;
+    // Block sized buffers, the converters look ahead in blocks
+    utf8pp::utf8_byte src[16] = {};
+    utf8pp::utf8_byte fast[16] = {};
+    utf8pp::utf8_byte engine[16] = {};
+    for (int b = 0; b < 256; ++b) {
+        src[0] = utf8pp::utf8_byte(b);
+        auto res = utf8pp::cp1252_to_utf8(src, 1, fast);
+        auto expected = utf8pp::codepage_to_utf8<windows_1252>(src, 1,
+            engine);
+        REQUIRE(res.error == expected.error);
+        REQUIRE(res.written == expected.written);
+        REQUIRE(std::equal(fast, fast + res.written, engine));
+    }
+    for (utf8pp::utf8_cp cp = 0; cp < 0x2200; ++cp) {
+        if (cp >= 0xd800 && cp < 0xe000) continue;
+        auto n = utf8pp::utf8_usize(utf8pp::encode_cp(src, cp));
+        auto res = utf8pp::utf8_to_cp1252(src, n, fast);
+        auto expected = utf8pp::utf8_to_codepage<windows_1252>(src, n,
+            engine);
+        REQUIRE(res.error == expected.error);
+        REQUIRE(res.written == expected.written);
+        REQUIRE(fast[0] == engine[0]);
+    }
+}
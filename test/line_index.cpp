@@ -0,0 +1,70 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <utf8pp.hpp>
+
+using utf8pp::column_unit;
+
+TEST_CASE("convert between offsets and positions", "[line_index]") {
+    // Line 1 is U+61, U+190, U+1300, U+10080, U+62
+    std::string text = u8"first\r\naƐጀ\U00010080b\n\nlast";
+    utf8pp::line_index index(bytes(text), text.size());
+
+    REQUIRE(index.line_count() == 4);
+    REQUIRE(index.line_start(1) == 7);
+    REQUIRE(index.line_of(6) == 0);
+    REQUIRE(index.line_of(7) == 1);
+
+    // The position of 'b'
+    auto b_offset = text.find('b');
+    auto pos = index.to_position(bytes(text), text.size(), b_offset,
+        column_unit::bytes);
+    REQUIRE(pos.line == 1);
+    REQUIRE(pos.column == 10);
+    pos = index.to_position(bytes(text), text.size(), b_offset,
+        column_unit::codepoints);
+    REQUIRE(pos.column == 4);
+    pos = index.to_position(bytes(text), text.size(), b_offset,
+        column_unit::utf16);
+    REQUIRE(pos.column == 5);
+
+    REQUIRE(index.to_offset(bytes(text), text.size(), { 1, 5 },
+        column_unit::utf16) == b_offset);
+    REQUIRE(index.to_offset(bytes(text), text.size(), { 1, 4 },
+        column_unit::codepoints) == b_offset);
+    // In the middle of a surrogate pair
+    REQUIRE(index.to_offset(bytes(text), text.size(), { 1, 4 },
+        column_unit::utf16) == b_offset - 4);
+    // Clamped to the end of the line, before the "\r\n"
+    REQUIRE(index.to_offset(bytes(text), text.size(), { 0, 100 },
+        column_unit::utf16) == 5);
+    REQUIRE(index.to_offset(bytes(text), text.size(), { 3, 100 },
+        column_unit::bytes) == text.size());
+}
+
+TEST_CASE("incrementally update the line index", "[line_index]") {
+    std::string text;
+    for (int i = 0; i < 100; ++i) text += u8"line ጀ\n";
+    utf8pp::line_index index(bytes(text), text.size());
+
+    auto check = [&]() {
+        utf8pp::line_index fresh(bytes(text), text.size());
+        REQUIRE(index.line_count() == fresh.line_count());
+        for (std::size_t i = 0; i < fresh.line_count(); ++i) {
+            REQUIRE(index.line_start(i) == fresh.line_start(i));
+        }
+    };
+
+    std::string ins = u8"new\nlines\n\n";
+    text.insert(30, ins);
+    index.update(bytes(text), text.size(), 30, 0, ins.size());
+    check();
+
+    text.erase(20, 200);
+    index.update(bytes(text), text.size(), 20, 200, 0);
+    check();
+
+    text.replace(5, 40, u8"x\ny");
+    index.update(bytes(text), text.size(), 5, 40, 3);
+    check();
+}
@@ -0,0 +1,146 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <utf8pp.hpp>
+
+static int compare(std::string const& a, std::string const& b) {
+    return utf8pp::natural_compare(bytes(a), a.size(), bytes(b), b.size());
+}
+
+// Checks that the strings are in strictly ascending order
+static void require_order(std::vector<std::string> const& strings) {
+    for (std::size_t i = 1; i < strings.size(); ++i) {
+        INFO(strings[i - 1] << " < " << strings[i]);
+        REQUIRE(compare(strings[i - 1], strings[i]) < 0);
+        REQUIRE(compare(strings[i], strings[i - 1]) > 0);
+    }
+}
+
+// Splits into numbers, as their significant digit values keyed like '0', and
+// single codepoints, with invalid bytes after every codepoint
+using token = std::pair<std::uint32_t, std::string>;
+
+static std::vector<token> tokenize(std::string const& s) {
+    std::vector<token> result;
+    auto it = bytes(s);
+    auto end = it + s.size();
+    bool in_number = false;
+    while (it != end) {
+        utf8pp::utf8_cp cp = 0;
+        auto n = utf8pp::read_next(it, end, cp);
+        if (n <= 0) {
+            cp = utf8pp::max_codepoint + 1 + *it;
+            n = 1;
+        }
+        it += n;
+        auto digit = utf8pp::decimal_digit_value(cp);
+        if (digit < 0) {
+            result.emplace_back(cp, "");
+            in_number = false;
+            continue;
+        }
+        if (!in_number) result.emplace_back('0', "");
+        in_number = true;
+        auto& digits = result.back().second;
+        if (digits.empty() && digit == 0) continue;
+        digits += char('0' + digit);
+    }
+    return result;
+}
+
+static int reference(std::string const& a, std::string const& b) {
+    auto ta = tokenize(a);
+    auto tb = tokenize(b);
+    for (std::size_t i = 0; i < ta.size() && i < tb.size(); ++i) {
+        if (ta[i].first != tb[i].first) {
+            return ta[i].first < tb[i].first ? -1 : 1;
+        }
+        auto const& da = ta[i].second;
+        auto const& db = tb[i].second;
+        if (da.size() != db.size()) return da.size() < db.size() ? -1 : 1;
+        if (da != db) return da < db ? -1 : 1;
+    }
+    if (ta.size() != tb.size()) return ta.size() < tb.size() ? -1 : 1;
+    return a < b ? -1 : b < a ? 1 : 0;
+}
+
+TEST_CASE("look up decimal digit values", "[decimal_digit_value]") {
+    REQUIRE(utf8pp::decimal_digit_value('0') == 0);
+    REQUIRE(utf8pp::decimal_digit_value('9') == 9);
+    REQUIRE(utf8pp::decimal_digit_value('a') == -1);
+    REQUIRE(utf8pp::decimal_digit_value(0xff10) == 0);
+    REQUIRE(utf8pp::decimal_digit_value(0xff19) == 9);
+    REQUIRE(utf8pp::decimal_digit_value(0x663) == 3);
+    REQUIRE(utf8pp::decimal_digit_value(0x1d7ce) == 0);
+    REQUIRE(utf8pp::decimal_digit_value(0x2160) == -1);
+    REQUIRE(utf8pp::decimal_digit_value(0xb2) == -1);
+    REQUIRE(utf8pp::decimal_digit_value(utf8pp::max_codepoint) == -1);
+}
+
+TEST_CASE("compare in natural order", "[natural_compare]") {
+    require_order({ "file", "file1", "file2", "file9", "file10", "file11",
+        "file100", "filea" });
+    require_order({ "a1b2", "a1b10", "a2b1", "a10" });
+    require_order({ "1.9", "1.10", "2.0" });
+    require_order({ "99999999999999999999", "100000000000000000000" });
+
+    // Leading zeros only matter for ties, which go by bytes
+    require_order({ "a01", "a1", "a002", "a2", "a3" });
+    REQUIRE(compare("a1", "a1") == 0);
+    REQUIRE(compare("", "") == 0);
+    REQUIRE(compare("", "0") < 0);
+    REQUIRE(compare("0", "00") < 0);
+
+    // Digits of other scripts, full-width and Arabic-Indic
+    require_order({ "file9", "file\xef\xbc\x91\xef\xbc\x90", "file11" });
+    require_order({ "\xd9\xa3", "12", "1\xd9\xa3" });
+    REQUIRE(compare("x\xd9\xa1\xd9\xa0", "x10") != 0);
+    REQUIRE(compare("x\xd9\xa1\xd9\xa0", "x9") > 0);
+
+    // Numbers sort where ASCII digits would
+    require_order({ "a-", "a5", "a\xd9\xa5", "a10", "aa", "a\xc3\xa9" });
+
+    // Invalid bytes sort after every codepoint
+    require_order({ "a\xf4\x8f\xbf\xbf", "a\xff" });
+}
+
+TEST_CASE("compare natural order against tokenizing",
+    "[natural_compare]") {
+    static char const* pieces[] = { "a", "b", "-", "0", "1", "9", "00",
+        "\xef\xbc\x91", "\xd9\xa0", "\xd9\xa9", "\xc3\xa9", "\xff",
+        "\xe2\x85\xa0" };
+    auto count = sizeof(pieces) / sizeof(pieces[0]);
+    std::mt19937 rng(50);
+    auto random_text = [&] {
+        std::string result;
+        auto n = rng() % 7;
+        for (std::size_t i = 0; i < n; ++i) result += pieces[rng() % count];
+        return result;
+    };
+    auto sign = [](int x) { return (x > 0) - (x < 0); };
+
+    for (int round = 0; round < 50000; ++round) {
+        auto prefix = random_text();
+        auto a = prefix + random_text();
+        auto b = prefix + random_text();
+        INFO(a << " <> " << b);
+        auto expected = reference(a, b);
+        REQUIRE(sign(compare(a, b)) == expected);
+        REQUIRE(sign(compare(b, a)) == -expected);
+    }
+
+    // A strict weak ordering, usable for sorting
+    std::vector<std::string> names;
+    for (int i = 0; i < 1000; ++i) names.push_back(random_text());
+    std::sort(names.begin(), names.end(),
+        [](std::string const& x, std::string const& y) {
+            return compare(x, y) < 0;
+        });
+    for (std::size_t i = 1; i < names.size(); ++i) {
+        REQUIRE(compare(names[i - 1], names[i]) <= 0);
+    }
+}
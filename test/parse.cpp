@@ -1,4 +1,5 @@
 #include "catch.hpp"
+#include <vector>
 #include <utf8pp.hpp>
 
 utf8pp::utf8_ssize test_oracle(utf8pp::utf8_byte const* src) {
@@ -200,3 +201,64 @@ TEST_CASE("read CPs from utf8-encoded strings backwards", "[read_prev]") {
         REQUIRE(cp == '\0');
     }
 }
+
+TEST_CASE("read CPs from bounded utf8-encoded strings", "[read_next]") {
+    // U+0, U+939 and a truncated U+10000
+    utf8pp::utf8_byte const src[] = { 0x00, 0xe0, 0xa4, 0xb9, 0xf0, 0x90 };
+    utf8pp::utf8_byte const* end = src + sizeof(src);
+    utf8pp::utf8_cp cp = 0;
+
+    REQUIRE(utf8pp::read_next(src, end, cp) == 1);
+    REQUIRE(cp == 0);
+    REQUIRE(utf8pp::read_next(src + 1, end, cp) == 3);
+    REQUIRE(cp == 0x939);
+    REQUIRE(utf8pp::read_next(src + 4, end, cp) == utf8pp::error::invalid_utf8);
+    REQUIRE(utf8pp::read_next(end, end, cp) == 0);
+}
+
+TEST_CASE("align pointers to codepoint boundaries", "[align_to_boundary]") {
+    // U+61, U+10080, U+190, then an invalid run of 5 continuation bytes
+    utf8pp::utf8_byte const src[] = {
+        0x61, 0xf0, 0x90, 0x82, 0x80, 0xc6, 0x90,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x62,
+    };
+    auto begin = src;
+    auto end = src + sizeof(src);
+    auto fwd = utf8pp::direction::forward;
+    auto bwd = utf8pp::direction::backward;
+
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 1, fwd) == src + 1);
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 2, fwd) == src + 5);
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 4, bwd) == src + 1);
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 6, bwd) == src + 5);
+    REQUIRE(utf8pp::align_to_boundary(begin, end, end, bwd) == end);
+
+    // In the invalid run, the bytes after the first 3 are on boundaries
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 7, fwd) == src + 9);
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 8, bwd) == src + 5);
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 10, fwd) == src + 10);
+    REQUIRE(utf8pp::align_to_boundary(begin, end, src + 11, bwd) == src + 11);
+
+    // Aligned pointers don't move, in either direction
+    for (auto p = begin; p != end; ++p) {
+        for (auto dir : { fwd, bwd }) {
+            auto aligned = utf8pp::align_to_boundary(begin, end, p, dir);
+            REQUIRE(utf8pp::align_to_boundary(begin, end, aligned, fwd)
+                == aligned);
+            REQUIRE(utf8pp::align_to_boundary(begin, end, aligned, bwd)
+                == aligned);
+        }
+    }
+
+    // A buffer starting in a run of continuation bytes
+    std::vector<utf8pp::utf8_byte> garbage(100, 0x80);
+    garbage.push_back('x');
+    auto gbegin = garbage.data();
+    auto gend = gbegin + garbage.size();
+    REQUIRE(utf8pp::align_to_boundary(gbegin, gend, gbegin + 1, fwd)
+        == gbegin + 3);
+    REQUIRE(utf8pp::align_to_boundary(gbegin, gend, gbegin + 2, bwd)
+        == gbegin);
+    REQUIRE(utf8pp::align_to_boundary(gbegin, gend, gbegin + 50, fwd)
+        == gbegin + 50);
+}
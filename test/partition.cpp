@@ -0,0 +1,71 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <utf8pp.hpp>
+
+TEST_CASE("find grapheme cluster boundaries", "[next_boundary]") {
+    using gb = utf8pp::grapheme_break;
+    REQUIRE(utf8pp::get_grapheme_break('a') == gb::other);
+    REQUIRE(utf8pp::get_grapheme_break('\r') == gb::cr);
+    REQUIRE(utf8pp::get_grapheme_break(0x301) == gb::extend);
+    REQUIRE(utf8pp::get_grapheme_break(0x200d) == gb::zwj);
+    REQUIRE(utf8pp::get_grapheme_break(0x1f600) == gb::extended_pictographic);
+    REQUIRE(utf8pp::get_grapheme_break(0x1100) == gb::l);
+    REQUIRE(utf8pp::get_grapheme_break(0xac00) == gb::lv);
+    REQUIRE(utf8pp::get_grapheme_break(0x10ffff) == gb::other);
+
+    // e + U+301, U+1F468 U+200D U+1F469, U+1100 U+1161, "\r\n"
+    std::string text =
+        u8"e\u0301\U0001F468\u200D\U0001F469\u1100\u1161\r\nx";
+    auto begin = bytes(text);
+    auto end = begin + text.size();
+    auto kind = utf8pp::boundary_kind::grapheme;
+
+    REQUIRE(utf8pp::next_boundary(begin, end, begin, kind) == begin);
+    REQUIRE(utf8pp::next_boundary(begin, end, begin + 1, kind) == begin + 3);
+    REQUIRE(utf8pp::next_boundary(begin, end, begin + 4, kind) == begin + 14);
+    REQUIRE(utf8pp::next_boundary(begin, end, begin + 15, kind) == begin + 20);
+    REQUIRE(utf8pp::next_boundary(begin, end, begin + 21, kind) == begin + 22);
+    REQUIRE(utf8pp::next_boundary(begin, end, end, kind) == end);
+
+    // GB9c is not applied, the conjunct U+915 U+94D U+937 is split
+    std::string conjunct = u8"\u0915\u094D\u0937";
+    auto cbegin = bytes(conjunct);
+    auto cend = cbegin + conjunct.size();
+    REQUIRE(utf8pp::next_boundary(cbegin, cend, cbegin + 1, kind)
+        == cbegin + 6);
+}
+
+TEST_CASE("partition buffers at boundaries", "[partition]") {
+    std::string text;
+    for (int i = 0; i < 1000; ++i) {
+        text += u8"line e\u0301 \u1300 \U0001F468\u200D\U0001F469\n";
+    }
+    auto begin = bytes(text);
+
+    for (auto kind : { utf8pp::boundary_kind::codepoint,
+        utf8pp::boundary_kind::grapheme, utf8pp::boundary_kind::line }) {
+        auto chunks = utf8pp::partition(begin, text.size(), 7, kind);
+        REQUIRE(chunks.size() == 7);
+        REQUIRE(chunks.front().begin == begin);
+        REQUIRE(chunks.back().end == begin + text.size());
+        for (std::size_t i = 1; i < chunks.size(); ++i) {
+            auto cut = chunks[i].begin;
+            REQUIRE(chunks[i - 1].end == cut);
+            REQUIRE(utf8pp::next_boundary(begin, begin + text.size(), cut,
+                kind) == cut);
+            REQUIRE((*cut & 0xc0) != 0x80);
+            if (kind == utf8pp::boundary_kind::line) REQUIRE(cut[-1] == '\n');
+            if (kind == utf8pp::boundary_kind::grapheme) {
+                REQUIRE(*cut != 0xcc);
+                REQUIRE(cut[-1] != 0x8d);
+            }
+        }
+    }
+
+    // More chunks than lines
+    std::string two_lines = "a\nb\n";
+    auto chunks = utf8pp::partition(bytes(two_lines), two_lines.size(), 4,
+        utf8pp::boundary_kind::line);
+    REQUIRE(chunks.size() == 2);
+}
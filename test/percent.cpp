@@ -0,0 +1,88 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static std::string encode(std::string const& s,
+    utf8pp::percent_encode_set const& set, utf8pp::utf8_ssize error = 0) {
+    bytes_t dst(s.size() * 3 + 16);
+    auto res = utf8pp::percent_encode(bytes(s), s.size(), dst.data(), set);
+    REQUIRE(res.error == error);
+    return std::string(dst.begin(), dst.begin() + long(res.written));
+}
+
+static std::string decode(std::string const& s, bool plus_as_space = false,
+    utf8pp::utf8_ssize error = 0) {
+    bytes_t dst(s.size() + 16);
+    auto res = utf8pp::percent_decode(bytes(s), s.size(), dst.data(),
+        plus_as_space);
+    REQUIRE(res.error == error);
+    return std::string(dst.begin(), dst.begin() + long(res.written));
+}
+
+TEST_CASE("percent-encode text", "[percent_encode]") {
+    namespace sets = utf8pp::percent_sets;
+
+    REQUIRE(encode("/a b/c?d", sets::path) == "/a%20b/c%3Fd");
+    REQUIRE(encode("/a b/c?d", sets::query) == "/a%20b/c?d");
+    REQUIRE(encode("a/b&c=d", sets::component) == "a%2Fb%26c%3Dd");
+    REQUIRE(encode("a b+c~", sets::form) == "a+b%2Bc%7E");
+    REQUIRE(encode("\xe3\x81\x93", sets::c0_control) == "%E3%81%93");
+    REQUIRE(encode(std::string("\0\x7f", 2), sets::c0_control) == "%00%7F");
+
+    // A custom set
+    auto custom = sets::c0_control.with("ab");
+    REQUIRE(encode("abc", custom) == "%61%62c");
+
+    // Blocks, with and without escapes
+    REQUIRE(encode("0123456789abcdef/0123456789abcdef", sets::path)
+        == "0123456789abcdef/0123456789abcdef");
+    REQUIRE(encode("0123456789abcdef/0123456789abcdef", sets::component)
+        == "0123456789abcdef%2F0123456789abcdef");
+
+    encode("a\xff", sets::path, utf8pp::error::invalid_utf8);
+    encode("a\xe3\x81", sets::path, utf8pp::error::incomplete);
+}
+
+TEST_CASE("percent-decode text", "[percent_decode]") {
+    REQUIRE(decode("plain") == "plain");
+    REQUIRE(decode("%E3%81%93%e3%82%93") == "\xe3\x81\x93\xe3\x82\x93");
+    REQUIRE(decode("a%20b+c") == "a b+c");
+    REQUIRE(decode("a%20b+c", true) == "a b c");
+    REQUIRE(decode("0123456789abcdef%2F0123456789abcdef")
+        == "0123456789abcdef/0123456789abcdef");
+
+    // Raw and escaped bytes mixed in one sequence
+    REQUIRE(decode("%E3\x81%93") == "\xe3\x81\x93");
+
+    // Malformed escapes are kept
+    REQUIRE(decode("100%") == "100%");
+    REQUIRE(decode("%zz%4") == "%zz%4");
+
+    SECTION("validation") {
+        using namespace utf8pp;
+        decode("%FF", false, error::invalid_utf8);
+        decode("%C0%80", false, error::invalid_utf8);
+        decode("%ED%A0%80", false, error::invalid_utf8);
+        decode("%E3%81x", false, error::invalid_utf8);
+        decode("%E3%81", false, error::incomplete);
+        decode("\xe3\x81", false, error::incomplete);
+
+        std::string s = "ok%20then%FFrest";
+        bytes_t dst(s.size());
+        auto res = percent_decode(bytes(s), s.size(), dst.data());
+        REQUIRE(res.read == 9);
+        REQUIRE(res.written == 7);
+    }
+}
+
+TEST_CASE("round-trip text through percent encoding", "[percent_encode]") {
+    std::string text;
+    for (int i = 0; i < 0x80; ++i) text += char(i);
+    text += "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+    auto encoded = encode(text, utf8pp::percent_sets::component);
+    REQUIRE(decode(encoded) == text);
+    encoded = encode(text, utf8pp::percent_sets::form);
+    REQUIRE(decode(encoded, true) == text);
+}
@@ -0,0 +1,168 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <random>
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static utf8pp::regex compile(std::string const& pattern) {
+    utf8pp::regex re(bytes(pattern), pattern.size());
+    REQUIRE(re.error() == 0);
+    return re;
+}
+
+// The match as "begin-end", or "none"
+static std::string search(std::string const& pattern, std::string const& s) {
+    auto re = compile(pattern);
+    auto m = re.search(bytes(s), s.size());
+    if (m.begin == utf8pp::not_found) return "none";
+    return std::to_string(m.begin) + "-" + std::to_string(m.end);
+}
+
+static bool full_match(std::string const& pattern, std::string const& s) {
+    return compile(pattern).full_match(bytes(s), s.size());
+}
+
+static utf8pp::utf8_usize error_at(std::string const& pattern) {
+    utf8pp::regex re(bytes(pattern), pattern.size());
+    REQUIRE(re.error() == utf8pp::error::invalid_pattern);
+    return re.error_offset();
+}
+
+TEST_CASE("parse regex syntax", "[regex]") {
+    REQUIRE(search("abc", "xxabcxx") == "2-5");
+    REQUIRE(search("a.c", "abc") == "0-3");
+    REQUIRE(search("a.c", "a\nc") == "none");
+    REQUIRE(search("colou?r", "the color") == "4-9");
+    REQUIRE(search("(?:ab)+", "xababab") == "1-7");
+    REQUIRE(search("a{2,3}", "aaaa") == "0-3");
+    REQUIRE(search("a{2}", "abaa") == "2-4");
+    REQUIRE(search("a{2,}", "aaaaa") == "0-5");
+    REQUIRE(search("[a-c]+", "xxcabd") == "2-5");
+    REQUIRE(search("[^a-c]+", "abxyc") == "2-4");
+    REQUIRE(search("[]a]+", "x]a]") == "1-4");
+    REQUIRE(search("[a-]+", "x-a-") == "1-4");
+    REQUIRE(search("\\d+", "ab\xd9\xa3" "12") == "2-6");
+    REQUIRE(search("\\w+", "  na\xc3\xafve!") == "2-8");
+    REQUIRE(search("\\s+", "a\xe3\x80\x80\tb") == "1-5");
+    REQUIRE(search("[\\d.]+", "v1.25") == "1-5");
+    REQUIRE(search("\\x41\\x{e9}", "A\xc3\xa9") == "0-3");
+    REQUIRE(search("\\.\\*", "a.*") == "1-3");
+
+    // Unicode properties
+    REQUIRE(search("\\p{Lu}\\p{Ll}+", "hello World") == "6-11");
+    REQUIRE(search("\\p{L}+", "123\xce\xb1\xce\xb2\xce\xb3!") == "3-9");
+    REQUIRE(search("\\pN+", "ab\xe2\x85\xa0" "7") == "2-6");
+    REQUIRE(search("\\P{L}+", "ab12cd") == "2-4");
+    REQUIRE(search("\\p{Uppercase_Letter}", "abC") == "2-3");
+    REQUIRE(search("\\p{Script=Greek}+", "ab\xce\xb1\xce\xb2.") == "2-6");
+    REQUIRE(search("\\p{Cyrillic}\\p{gc=Ll}", "\xd0\x96\xd0\xb6") == "0-4");
+    REQUIRE(search("\\u00e9\\U0001F600", "\xc3\xa9\xf0\x9f\x98\x80") == "0-6");
+
+    // Anchors
+    REQUIRE(search("^ab", "abab") == "0-2");
+    REQUIRE(search("^b", "ab") == "none");
+    REQUIRE(search("ab$", "abab") == "2-4");
+    REQUIRE(search("^(?:a|b)+$", "abba") == "0-4");
+    REQUIRE(search("^(?:a|b)+$", "abca") == "none");
+    REQUIRE(search("^(a|b)$", "b") == "0-1");
+    REQUIRE(search("^(a|b)$", "ab") == "none");
+    REQUIRE(search("^(?:a|b)$", "a") == "0-1");
+    REQUIRE(search("^(?:a|b)", "bc") == "0-1");
+    REQUIRE(search("^(?:a|b)", "cb") == "none");
+    REQUIRE(search("(?:x|y)$", "xyx") == "2-3");
+    REQUIRE(search("(?:x|y)$", "xyz") == "none");
+
+    // Errors
+    REQUIRE(error_at("a(b") == 3);
+    REQUIRE(error_at("a)") == 1);
+    REQUIRE(error_at("*a") == 0);
+    REQUIRE(error_at("a{3,2}") == 5);
+    REQUIRE(error_at("a^") == 1);
+    REQUIRE(error_at("^a|b") == 4);
+    REQUIRE(error_at("a|b$") == 4);
+    REQUIRE(error_at("^(a)|b") == 6);
+    REQUIRE(error_at("\\p{Nope}") == 3);
+    REQUIRE(error_at("\\p{Script=Lu}") == 3);
+    REQUIRE(error_at("\\b") == 1);
+    REQUIRE(error_at("[a") == 2);
+    REQUIRE(error_at("\\x{41") == 3);
+    REQUIRE(error_at("[\\x{41") == 4);
+    REQUIRE(error_at("\xff") == 0);
+    // Limits on nesting and program size
+    REQUIRE(error_at("a" + std::string(200000, '*')) == 258);
+    REQUIRE(error_at("(?:(?:a{1000}){1000}){1000}") == 20);
+    REQUIRE(error_at(std::string(300, '(') + "a" + std::string(300, ')'))
+        == 256);
+    compile(std::string(255, '(') + "a" + std::string(255, ')') + "*");
+    compile("\\p{L}{100}");
+    utf8pp::regex none;
+    REQUIRE(none.error() == utf8pp::error::invalid_pattern);
+}
+
+TEST_CASE("match regexes", "[regex]") {
+    // Leftmost-first, like Perl
+    REQUIRE(search("a|ab", "ab") == "0-1");
+    REQUIRE(search("ab|a", "ab") == "0-2");
+    REQUIRE(search("abcd|c", "abcd") == "0-4");
+    REQUIRE(search("b|abc", "abc") == "0-3");
+    REQUIRE(search("a+?", "aaa") == "0-1");
+    REQUIRE(search("a*?", "aaa") == "0-0");
+    REQUIRE(search("a*", "baaa") == "0-0");
+    REQUIRE(search("x*y", "xxxy") == "0-4");
+    REQUIRE(search("(?:a|ab)(?:c|bcd)", "abcd") == "0-4");
+
+    // . is one whole codepoint, never a part or an invalid byte
+    REQUIRE(search("^.$", "\xf0\x9f\x98\x80") == "0-4");
+    REQUIRE(search("^..$", "\xf0\x9f\x98\x80") == "none");
+    REQUIRE(search(".", "\x80\xff\xc0\xaf\xed\xa0\x80" "a") == "7-8");
+    REQUIRE(search("a.b", "a\xe3\x81" "b") == "none");
+
+    REQUIRE(full_match("a|ab", "ab"));
+    REQUIRE(full_match("[a-z]+@[a-z]+", "me@example"));
+    REQUIRE(!full_match("[a-z]+", "abc1"));
+
+    // All matches
+    auto re = compile("\\p{L}+");
+    std::string text = "one, \xc4\x8d" "tyri; five";
+    auto all = re.find_all(bytes(text), text.size());
+    REQUIRE(all.size() == 3);
+    REQUIRE(all[1].begin == 5);
+    REQUIRE(all[1].end == 11);
+    re = compile("a*");
+    all = re.find_all(bytes("baa\xc3\xa9"), 5);
+    REQUIRE(all.size() == 4);
+    REQUIRE(all[1].begin == 1);
+    REQUIRE(all[1].end == 3);
+    REQUIRE(all[3].begin == 5);
+}
+
+TEST_CASE("search regexes with the prefilter and the DFA cache",
+    "[regex]") {
+    // The literal prefix skips ahead
+    std::string text(1000, 'x');
+    text += "error: disk 42 full";
+    auto re = compile("error: \\w+ \\d+");
+    auto m = re.search(bytes(text), text.size());
+    REQUIRE(m.begin == 1000);
+    REQUIRE(m.end == 1014);
+    REQUIRE(re.search(bytes(text), text.size(), 1001).begin
+        == utf8pp::not_found);
+
+    // Enough states to clear the cache several times
+    re = compile("[ab]*a[ab]{12}c");
+    std::mt19937 rng(45);
+    std::string random;
+    for (int i = 0; i < 20000; ++i) random += "ab"[rng() % 2];
+    REQUIRE(re.search(bytes(random), random.size()).begin
+        == utf8pp::not_found);
+    auto with_match = random + "aabababababab" "c";
+    m = re.search(bytes(with_match), with_match.size());
+    REQUIRE(m.begin == 0);
+    REQUIRE(m.end == with_match.size());
+
+    // Copies work on their own
+    auto copy = re;
+    REQUIRE(copy.search(bytes(with_match), with_match.size()).end
+        == with_match.size());
+}
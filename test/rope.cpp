@@ -0,0 +1,112 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <random>
+#include <string>
+#include <utf8pp.hpp>
+
+static std::string rope_string(utf8pp::rope const& r) {
+    std::string result(r.size(), '\0');
+    r.copy(0, r.size(), (utf8pp::utf8_byte*)&result[0]);
+    return result;
+}
+
+static utf8pp::rope make_rope(std::string const& s) {
+    return utf8pp::rope(bytes(s), s.size());
+}
+
+TEST_CASE("rope metrics", "[rope]") {
+    // U+61, U+A, U+190, U+1300, U+10080
+    std::string text = u8"a\nƐጀ\U00010080";
+    auto r = make_rope(text);
+
+    auto const& m = r.summary();
+    REQUIRE(m.bytes == text.size());
+    REQUIRE(m.codepoints == 5);
+    REQUIRE(m.newlines == 1);
+    REQUIRE(m.utf16 == 6);
+
+    REQUIRE(r.codepoint_to_byte(0) == 0);
+    REQUIRE(r.codepoint_to_byte(3) == 4);
+    REQUIRE(r.codepoint_to_byte(4) == 7);
+    REQUIRE(r.codepoint_to_byte(5) == text.size());
+    REQUIRE(r.line_to_byte(1) == 2);
+    REQUIRE(r.prefix(7).codepoints == 4);
+    REQUIRE(r.prefix(7).newlines == 1);
+}
+
+TEST_CASE("moved-from ropes are empty", "[rope]") {
+    std::string text = u8"a\nƐጀ";
+    auto r = make_rope(text);
+
+    utf8pp::rope m(std::move(r));
+    REQUIRE(rope_string(m) == text);
+    REQUIRE(r.size() == 0);
+    REQUIRE(r.summary().codepoints == 0);
+    r.insert(0, bytes("xy"), 2);
+    REQUIRE(rope_string(r) == "xy");
+
+    r = std::move(m);
+    REQUIRE(rope_string(r) == text);
+    REQUIRE(m.size() == 0);
+    m.insert(0, bytes("z"), 1);
+    REQUIRE(rope_string(m) == "z");
+}
+
+TEST_CASE("rope edits match a flat string", "[rope]") {
+    char const* pieces[] = { u8"a", u8"\n", u8"Ɛ", u8"ጀ", u8"\U00010080" };
+    std::mt19937 rng(42);
+    std::string oracle;
+    utf8pp::rope r;
+
+    auto random_boundary = [&]() -> std::size_t {
+        std::size_t pos = rng() % (oracle.size() + 1);
+        while (pos < oracle.size() && (oracle[pos] & 0xc0) == 0x80) ++pos;
+        return pos;
+    };
+
+    for (int step = 0; step < 2000; ++step) {
+        if (oracle.size() < 20000 && rng() % 3 != 0) {
+            std::string ins;
+            auto n = rng() % 600;
+            for (unsigned i = 0; i < n; ++i) ins += pieces[rng() % 5];
+            auto pos = random_boundary();
+            r.insert(pos, bytes(ins), ins.size());
+            oracle.insert(pos, ins);
+        }
+        else {
+            auto a = random_boundary();
+            auto b = random_boundary();
+            if (a > b) std::swap(a, b);
+            r.erase(a, b - a);
+            oracle.erase(a, b - a);
+        }
+    }
+
+    REQUIRE(rope_string(r) == oracle);
+
+    auto m = utf8pp::rope::metrics::of(bytes(oracle), oracle.size());
+    REQUIRE(r.summary().codepoints == m.codepoints);
+    REQUIRE(r.summary().newlines == m.newlines);
+    REQUIRE(r.summary().utf16 == m.utf16);
+
+    // Leaves never split a codepoint
+    r.for_each_chunk([](utf8pp::utf8_byte const* src, std::size_t) {
+        REQUIRE((src[0] & 0xc0) != 0x80);
+    });
+
+    // Seeking agrees with a linear scan
+    std::size_t cp = 0, line = 0;
+    for (std::size_t i = 0; i < oracle.size(); ++i) {
+        if ((oracle[i] & 0xc0) == 0x80) continue;
+        if (cp % 97 == 0) REQUIRE(r.codepoint_to_byte(cp) == i);
+        if (cp % 89 == 0) REQUIRE(r.prefix(i).codepoints == cp);
+        ++cp;
+        if (oracle[i] == '\n' && ++line % 13 == 0) {
+            REQUIRE(r.line_to_byte(line) == i + 1);
+        }
+    }
+
+    r.erase(0, r.size());
+    REQUIRE(r.size() == 0);
+    REQUIRE(r.summary().codepoints == 0);
+}
@@ -0,0 +1,187 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <random>
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static utf8pp::search_match find(std::string const& s, std::string const& n,
+    bool codepoints = false) {
+    return utf8pp::find(bytes(s), s.size(), bytes(n), n.size(), codepoints);
+}
+
+static utf8pp::search_match rfind(std::string const& s, std::string const& n,
+    bool codepoints = false) {
+    return utf8pp::rfind(bytes(s), s.size(), bytes(n), n.size(), codepoints);
+}
+
+// Byte search with the same boundary rules
+static std::vector<std::size_t> naive_find_all(std::string const& s,
+    std::string const& n) {
+    std::vector<std::size_t> result;
+    auto cont = [](char c) { return (c & 0xc0) == 0x80; };
+    for (std::size_t i = 0; i + n.size() <= s.size();) {
+        if (s.compare(i, n.size(), n) == 0 && !cont(s[i])
+            && (i + n.size() == s.size() || !cont(s[i + n.size()]))) {
+            result.push_back(i);
+            i += n.size();
+        }
+        else {
+            ++i;
+        }
+    }
+    return result;
+}
+
+TEST_CASE("find substrings", "[find]") {
+    auto const npos = utf8pp::not_found;
+
+    REQUIRE(find("hello world", "world").offset == 6);
+    REQUIRE(find("hello world", "o").offset == 4);
+    REQUIRE(rfind("hello world", "o").offset == 7);
+    REQUIRE(find("hello world", "x").offset == npos);
+    REQUIRE(rfind("hello world", "x").offset == npos);
+    REQUIRE(find("ab", "abc").offset == npos);
+    REQUIRE(find("abc", "").offset == 0);
+    REQUIRE(rfind("abc", "").offset == 3);
+
+    // Codepoint offsets
+    auto m = find("\xc3\xa9t\xc3\xa9 \xe3\x81\x93\xe3\x81\x93", "\xe3\x81\x93",
+        true);
+    REQUIRE(m.offset == 6);
+    REQUIRE(m.length == 3);
+    REQUIRE(m.codepoint == 4);
+    m = rfind("\xc3\xa9t\xc3\xa9 \xe3\x81\x93\xe3\x81\x93", "\xe3\x81\x93",
+        true);
+    REQUIRE(m.offset == 9);
+    REQUIRE(m.codepoint == 5);
+
+    // No matches in the middle of sequences
+    REQUIRE(find("\xf0\x9f\x98\x80", "\x98\x80").offset == npos);
+    REQUIRE(find("\xc3\xa9\x80", "\xc3\xa9").offset == npos);
+    REQUIRE(find("\xe3\x81\x93", "\xe3\x81").offset == npos);
+    std::string text = std::string(40, 'x') + "\xf0\x9f\x98\x80"
+        + std::string(40, 'y');
+    REQUIRE(find(text, "\x98\x80y").offset == npos);
+    REQUIRE(rfind(text, "\x98\x80y").offset == npos);
+    REQUIRE(find(text, "\xf0\x9f\x98\x80y").offset == 40);
+    REQUIRE(rfind(text, "x\xf0\x9f\x98\x80").offset == 39);
+}
+
+TEST_CASE("find all substrings", "[find_all]") {
+    std::string text = "one two one two one";
+    auto all = utf8pp::find_all(bytes(text), text.size(), bytes("one"), 3,
+        true);
+    REQUIRE(all.size() == 3);
+    REQUIRE(all[2].offset == 16);
+    REQUIRE(all[2].length == 3);
+    REQUIRE(all[2].codepoint == 16);
+    REQUIRE(utf8pp::find_all(bytes(text), text.size(), bytes(""), 0).empty());
+
+    // Non-overlapping
+    text = "aaaaa";
+    REQUIRE(utf8pp::find_all(bytes(text), text.size(), bytes("aa"), 2).size()
+        == 2);
+
+    // Random texts from a small alphabet, checked against a plain search
+    std::mt19937 rng(41);
+    std::string const alphabet[] = { "a", "b", "\xc3\xa9", "\xe3\x81\x93",
+        "\xf0\x9f\x98\x80", "\x80" };
+    auto random_text = [&](std::size_t n) {
+        std::string s;
+        for (std::size_t i = 0; i < n; ++i) s += alphabet[rng() % 6];
+        return s;
+    };
+    for (int round = 0; round < 300; ++round) {
+        auto hay = random_text(rng() % 200);
+        auto needle = random_text(1 + rng() % 3);
+        auto expected = naive_find_all(hay, needle);
+        auto found = utf8pp::find_all(bytes(hay), hay.size(), bytes(needle),
+            needle.size(), true);
+        REQUIRE(found.size() == expected.size());
+        for (std::size_t i = 0; i < found.size(); ++i) {
+            REQUIRE(found[i].offset == expected[i]);
+            REQUIRE(found[i].codepoint == utf8pp::count_codepoints(bytes(hay),
+                expected[i]));
+        }
+        auto first = find(hay, needle).offset;
+        REQUIRE(first == (expected.empty() ? utf8pp::not_found
+            : expected.front()));
+        // The last match may overlap the last non-overlapping one
+        auto last = rfind(hay, needle).offset;
+        if (expected.empty()) {
+            REQUIRE(last == utf8pp::not_found);
+        }
+        else {
+            REQUIRE(last >= expected.back());
+            REQUIRE(naive_find_all(hay.substr(last), needle).front() == 0);
+        }
+    }
+}
+
+static std::size_t ifind(std::string const& s, std::string const& n) {
+    return utf8pp::find_ignore_case(bytes(s), s.size(), bytes(n), n.size())
+        .offset;
+}
+
+TEST_CASE("find substrings ignoring case", "[find_ignore_case]") {
+    auto const npos = utf8pp::not_found;
+
+    REQUIRE(ifind("Hello World", "world") == 6);
+    REQUIRE(ifind("Hello World", "WORLD") == 6);
+    REQUIRE(ifind("Hello World", "o w") == 4);
+    REQUIRE(ifind("Hello World", "worlds") == npos);
+    REQUIRE(ifind("abc", "") == 0);
+    REQUIRE(ifind("", "a") == npos);
+
+    // Non-ASCII folds
+    REQUIRE(ifind("caf\xc3\x89!", "\xc3\xa9") == 3);
+    REQUIRE(ifind("\xce\xa3\xce\xbf\xcf\x86\xce\xaf\xce\xb1",
+        "\xcf\x83\xce\xbf\xcf\x86") == 0);
+    // KELVIN SIGN folds to k, LONG S to s
+    REQUIRE(ifind("300 \xe2\x84\xaa", "k") == 4);
+    REQUIRE(ifind("mi\xc5\xbft", "MIST") == 0);
+
+    // Length-changing folds, in both directions
+    REQUIRE(ifind("Stra\xc3\x9f" "e", "STRASSE") == 0);
+    REQUIRE(ifind("STRASSE", "stra\xc3\x9f" "e") == 0);
+    REQUIRE(ifind("Stra\xc3\x9f" "e", "ss") == 4);
+    // The matched length is in the haystack
+    std::string strasse = "Stra\xc3\x9f" "e!";
+    auto m = utf8pp::find_ignore_case(bytes(strasse), strasse.size(),
+        bytes("strasse"), 7);
+    REQUIRE(m.offset == 0);
+    REQUIRE(m.length == 7);
+    m = utf8pp::find_ignore_case(bytes(strasse), strasse.size(), bytes("SS"),
+        2);
+    REQUIRE(m.offset == 4);
+    REQUIRE(m.length == 2);
+    std::string kelvin = "300 \xe2\x84\xaa!";
+    m = utf8pp::find_ignore_case(bytes(kelvin), kelvin.size(), bytes("k"), 1);
+    REQUIRE(m.offset == 4);
+    REQUIRE(m.length == 3);
+    m = utf8pp::find_ignore_case(bytes("STRASSE"), 7,
+        bytes("stra\xc3\x9f" "e"), 7);
+    REQUIRE(m.length == 7);
+    m = utf8pp::find_ignore_case(bytes("xSSy"), 4, bytes("\xc3\x9f"), 2);
+    REQUIRE(m.offset == 1);
+    REQUIRE(m.length == 2);
+    // Half of a folding doesn't match
+    REQUIRE(ifind("Stra\xc3\x9f" "e", "se") == npos);
+    REQUIRE(ifind("Stra\xc3\x9f" "e", "stras") == npos);
+
+    // Matches past the vectorized blocks, with codepoint offsets
+    std::string text = std::string(50, '-') + "\xc3\xa9" + std::string(50, 'x')
+        + "\xe1\xba\x9e" + "Y";
+    m = utf8pp::find_ignore_case(bytes(text), text.size(), bytes("XssY"), 4,
+        true);
+    REQUIRE(m.offset == 101);
+    REQUIRE(m.length == 5);
+    REQUIRE(m.codepoint == 100);
+    REQUIRE(ifind(text, "\xc3\x89X") == 50);
+
+    // Invalid text and needles
+    REQUIRE(ifind("\xf0\x9f\x98\x80" "a", "\x98") == npos);
+    REQUIRE(ifind("a\xc3\xa9\x80", "A\xc3\x89") == npos);
+    REQUIRE(ifind("abc", "\xff") == npos);
+}
@@ -0,0 +1,81 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <random>
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static bytes_t escape(bytes_t const& src) {
+    bytes_t dst(src.size() * 3 + 16);
+    dst.resize(utf8pp::surrogate_escape(src.data(), src.size(), dst.data()));
+    return dst;
+}
+
+static bytes_t unescape(bytes_t const& src) {
+    bytes_t dst(src.size() + 16);
+    dst.resize(utf8pp::surrogate_unescape(src.data(), src.size(), dst.data()));
+    return dst;
+}
+
+TEST_CASE("escape invalid bytes as lone surrogates", "[surrogate_escape]") {
+    SECTION("valid UTF8 is copied") {
+        auto src = to_bytes("h\xc3\xa9llo \xf0\x9f\x98\x80");
+        REQUIRE(escape(src) == src);
+        REQUIRE(unescape(src) == src);
+    }
+
+    SECTION("invalid bytes are escaped") {
+        auto src = to_bytes("a\xff" "b\xc3");
+        REQUIRE(escape(src) == to_bytes("a\xed\xb3\xbf" "b\xed\xb3\x83"));
+        REQUIRE(unescape(escape(src)) == src);
+    }
+
+    SECTION("overlongs and surrogates are escaped byte by byte") {
+        // Otherwise they would be ambiguous with the escapes
+        auto src = to_bytes("\xc0\x80\xed\xb2\x80");
+        auto escaped = escape(src);
+        REQUIRE(escaped.size() == 15);
+        REQUIRE(unescape(escaped) == src);
+    }
+
+    SECTION("random bytes round-trip") {
+        std::mt19937 rng(36);
+        for (int i = 0; i < 200; ++i) {
+            bytes_t src(std::size_t(rng() % 100));
+            for (auto& b : src) {
+                // Mostly ASCII, so valid runs and blocks appear
+                b = utf8pp::utf8_byte(rng() % 4 == 0 ? rng() : rng() % 0x80);
+            }
+            auto escaped = escape(src);
+            REQUIRE(utf8pp::validate(escaped.data(), escaped.size())
+                == escaped.size());
+            REQUIRE(unescape(escaped) == src);
+        }
+    }
+}
+
+TEST_CASE("read and write escaped codepoints", "[read_next_escaped]") {
+    auto src = to_bytes("x\xe2\x82\xac\x80\xe2\x82");
+    auto end = src.data() + src.size();
+
+    std::vector<utf8pp::utf8_cp> cps;
+    utf8pp::utf8_cp cp = 0;
+    for (auto it = src.data(); it != end;) {
+        auto n = utf8pp::read_next_escaped(it, end, cp);
+        REQUIRE(n > 0);
+        cps.push_back(cp);
+        it += n;
+    }
+    REQUIRE(cps == std::vector<utf8pp::utf8_cp>{
+        'x', 0x20ac, 0xdc80, 0xdce2, 0xdc82 });
+    REQUIRE(utf8pp::read_next_escaped(end, end, cp) == 0);
+
+    bytes_t out(32);
+    utf8pp::utf8_usize written = 0;
+    for (auto c : cps) {
+        written += utf8pp::utf8_usize(
+            utf8pp::encode_cp_escaped(out.data() + written, c));
+    }
+    out.resize(written);
+    REQUIRE(out == src);
+}
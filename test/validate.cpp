@@ -0,0 +1,78 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <cstdio>
+#include <string>
+#include <utf8pp.hpp>
+
+static std::string big_text() {
+    std::string text;
+    // U+61, U+190, U+1300, U+10080, mixed with long ASCII runs
+    while (text.size() < (1 << 20)) {
+        text += u8"aƐጀ\U00010080";
+        text += std::string(text.size() % 37, 'x');
+    }
+    return text;
+}
+
+TEST_CASE("validate utf8 buffers", "[validate]") {
+    std::string text = std::string(u8"abc") + '\0' + u8"ƐጀƐ\U00010080"
+        + std::string(40, 'x');
+    REQUIRE(utf8pp::validate(bytes(text), text.size()) == text.size());
+    REQUIRE(utf8pp::count_codepoints(bytes(text), text.size()) == 48);
+
+    // Truncated sequence at the end
+    REQUIRE(utf8pp::validate(bytes(text), 7) == 6);
+    // Stray continuation byte after an ASCII block
+    text[30] = char(0x80);
+    REQUIRE(utf8pp::validate(bytes(text), text.size()) == 30);
+}
+
+TEST_CASE("validate and count in parallel", "[validate]") {
+    auto text = big_text();
+    auto cps = utf8pp::count_codepoints(bytes(text), text.size());
+    REQUIRE(utf8pp::validate(bytes(text), text.size()) == text.size());
+
+    for (std::size_t threads : { 1, 2, 3, 7, 16 }) {
+        REQUIRE(utf8pp::parallel_validate(bytes(text), text.size(), threads)
+            == text.size());
+        REQUIRE(utf8pp::parallel_count_codepoints(bytes(text), text.size(),
+            threads) == cps);
+    }
+
+    // Break the lead byte of a sequence around every split point, so that
+    // the orphaned continuation bytes start the next chunk
+    for (std::size_t threads : { 2, 3, 7, 16 }) {
+        auto broken = text;
+        auto pos = broken.size() / threads;
+        while ((unsigned char)broken[pos] < 0xc0) --pos;
+        broken[pos] = 'x';
+        REQUIRE(utf8pp::parallel_validate(bytes(broken), broken.size(),
+            threads) == utf8pp::validate(bytes(broken), broken.size()));
+    }
+}
+
+TEST_CASE("map a file into memory", "[mapped_file]") {
+    auto text = big_text();
+    auto path = "utf8pp_mapped_file_test.txt";
+    auto file = std::fopen(path, "wb");
+    REQUIRE(file != nullptr);
+    std::fwrite(text.data(), 1, text.size(), file);
+    std::fclose(file);
+
+    {
+        utf8pp::mapped_file mapped(path);
+        REQUIRE(mapped.is_open());
+        REQUIRE(mapped.size() == text.size());
+        REQUIRE(std::string(mapped.begin(), mapped.end()) == text);
+        REQUIRE(utf8pp::parallel_validate(mapped.data(), mapped.size())
+            == mapped.size());
+
+        auto moved = std::move(mapped);
+        REQUIRE(!mapped.is_open());
+        REQUIRE(moved.size() == text.size());
+    }
+    std::remove(path);
+
+    utf8pp::mapped_file missing("utf8pp_no_such_file.txt");
+    REQUIRE(!missing.is_open());
+}
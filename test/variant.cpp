@@ -0,0 +1,179 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+template <typename Variant>
+static utf8pp::convert_result to_utf8(std::string const& s, bytes_t& out) {
+    auto src = to_bytes(s);
+    out.assign(src.size() + 16, 0);
+    auto res = utf8pp::variant_to_utf8<Variant>(src.data(), src.size(),
+        out.data());
+    out.resize(res.written);
+    return res;
+}
+
+template <typename Variant>
+static utf8pp::convert_result from_utf8(std::string const& s, bytes_t& out) {
+    auto src = to_bytes(s);
+    out.assign(src.size() * 2 + 16, 0);
+    auto res = utf8pp::utf8_to_variant<Variant>(src.data(), src.size(),
+        out.data());
+    out.resize(res.written);
+    return res;
+}
+
+// U+1F600 in standard UTF8 and as a surrogate pair
+static std::string const emoji = "\xf0\x9f\x98\x80";
+static std::string const emoji_pair = "\xed\xa0\xbd\xed\xb8\x80";
+
+TEST_CASE("read codepoints from UTF8 variants", "[read_next]") {
+    using namespace utf8pp;
+
+    SECTION("CESU-8 pairs") {
+        auto src = to_bytes(emoji_pair);
+        utf8_cp cp = 0;
+        REQUIRE(read_next<variant::cesu8>(src.data(), src.data() + 6, cp)
+            == 6);
+        REQUIRE(cp == 0x1f600);
+
+        // A 4-byte sequence or half a pair is not CESU-8
+        src = to_bytes(emoji);
+        REQUIRE(read_next<variant::cesu8>(src.data(), src.data() + 4, cp)
+            == error::invalid_utf8);
+        REQUIRE(read_next<variant::cesu8>(src.data(), src.data() + 3, cp)
+            == error::invalid_utf8);
+    }
+
+    SECTION("Modified UTF8") {
+        auto src = to_bytes(std::string("\xc0\x80", 2));
+        utf8_cp cp = 1;
+        REQUIRE(read_next<variant::mutf8>(src.data(), src.data() + 2, cp)
+            == 2);
+        REQUIRE(cp == 0);
+
+        // Unpaired surrogates are allowed
+        src = to_bytes("\xed\xa0\xbd" "a");
+        REQUIRE(read_next<variant::mutf8>(src.data(), src.data() + 4, cp)
+            == 3);
+        REQUIRE(cp == 0xd83d);
+    }
+
+    SECTION("WTF-8") {
+        auto src = to_bytes(emoji);
+        utf8_cp cp = 0;
+        REQUIRE(read_next<variant::wtf8>(src.data(), src.data() + 4, cp)
+            == 4);
+        REQUIRE(cp == 0x1f600);
+
+        // Pairs must be written as one sequence
+        src = to_bytes(emoji_pair);
+        REQUIRE(read_next<variant::wtf8>(src.data(), src.data() + 6, cp)
+            == error::invalid_utf8);
+        REQUIRE(read_next<variant::wtf8>(src.data() + 3, src.data() + 6, cp)
+            == 3);
+        REQUIRE(cp == 0xde00);
+    }
+
+    SECTION("standard UTF8") {
+        auto src = to_bytes(emoji);
+        utf8_cp cp = 0;
+        REQUIRE(read_next<variant::utf8>(src.data(), src.data() + 4, cp)
+            == 4);
+        REQUIRE(cp == 0x1f600);
+    }
+}
+
+TEST_CASE("write codepoints in UTF8 variants", "[encode_cp]") {
+    using namespace utf8pp;
+    utf8_byte buf[8];
+
+    REQUIRE(encode_cp<variant::mutf8>(buf, 0) == 2);
+    REQUIRE(bytes_t(buf, buf + 2) == to_bytes(std::string("\xc0\x80", 2)));
+    REQUIRE(encode_cp<variant::cesu8>(buf, 0) == 1);
+    REQUIRE(buf[0] == 0);
+
+    REQUIRE(encode_cp<variant::cesu8>(buf, 0x1f600) == 6);
+    REQUIRE(bytes_t(buf, buf + 6) == to_bytes(emoji_pair));
+    REQUIRE(encode_cp<variant::wtf8>(buf, 0x1f600) == 4);
+    REQUIRE(bytes_t(buf, buf + 4) == to_bytes(emoji));
+}
+
+TEST_CASE("convert UTF8 variants to and from UTF8", "[variant]") {
+    using namespace utf8pp;
+    bytes_t out;
+    std::string text = std::string("Java\0", 5) + "\xc3\xa9" + emoji + "!";
+    std::string mutf8 = std::string("Java\xc0\x80") + "\xc3\xa9" + emoji_pair
+        + "!";
+
+    SECTION("round trips") {
+        REQUIRE(from_utf8<variant::mutf8>(text, out).error == 0);
+        REQUIRE(out == to_bytes(mutf8));
+        REQUIRE(to_utf8<variant::mutf8>(mutf8, out).error == 0);
+        REQUIRE(out == to_bytes(text));
+
+        REQUIRE(from_utf8<variant::cesu8>(text, out).error == 0);
+        REQUIRE(out == to_bytes(std::string("Java\0", 5) + "\xc3\xa9"
+            + emoji_pair + "!"));
+
+        REQUIRE(from_utf8<variant::wtf8>(text, out).error == 0);
+        REQUIRE(out == to_bytes(text));
+    }
+
+    SECTION("long ASCII runs with NUL") {
+        std::string ascii(40, 'x');
+        ascii[20] = '\0';
+        REQUIRE(from_utf8<variant::mutf8>(ascii, out).error == 0);
+        REQUIRE(out.size() == 41);
+        REQUIRE(out[20] == 0xc0);
+        REQUIRE(out[21] == 0x80);
+        REQUIRE(to_utf8<variant::mutf8>(std::string(out.begin(), out.end()),
+            out).error == 0);
+        REQUIRE(out == to_bytes(ascii));
+    }
+
+    SECTION("errors") {
+        // Unpaired surrogates have no standard UTF8 encoding
+        auto res = to_utf8<variant::wtf8>("ab\xed\xa0\xbd", out);
+        REQUIRE(res.error == error::invalid_codepoint);
+        REQUIRE(res.read == 2);
+
+        // Half a pair at the end can be resumed with the next chunk
+        res = to_utf8<variant::cesu8>("ab\xed\xa0\xbd\xed\xb8", out);
+        REQUIRE(res.error == error::incomplete);
+        REQUIRE(res.read == 2);
+
+        res = to_utf8<variant::mutf8>("ab\xed\xa0\xbd", out);
+        REQUIRE(res.error == error::incomplete);
+        REQUIRE(res.read == 2);
+        res = to_utf8<variant::mutf8>("ab\xed\xa0\xbd\xed", out);
+        REQUIRE(res.error == error::incomplete);
+        REQUIRE(res.read == 2);
+        // Unless the next codepoint is not a low surrogate
+        res = to_utf8<variant::mutf8>("ab\xed\xa0\xbd" "c", out);
+        REQUIRE(res.error == error::invalid_codepoint);
+
+        res = to_utf8<variant::cesu8>(emoji, out);
+        REQUIRE(res.error == error::invalid_utf8);
+
+        // Overlongs other than the C0 80 of Modified UTF8
+        res = to_utf8<variant::cesu8>("a\xc1\x81", out);
+        REQUIRE(res.error == error::invalid_utf8);
+        REQUIRE(res.read == 1);
+        res = to_utf8<variant::cesu8>(std::string("\xc0\x80", 2), out);
+        REQUIRE(res.error == error::invalid_utf8);
+        res = to_utf8<variant::mutf8>("\xe0\x81\x81", out);
+        REQUIRE(res.error == error::invalid_utf8);
+        res = to_utf8<variant::wtf8>("\xf0\x80\x81\x81", out);
+        REQUIRE(res.error == error::invalid_utf8);
+        res = to_utf8<variant::wtf8>("\xf4\x90\x80\x80", out);
+        REQUIRE(res.error == error::invalid_utf8);
+        res = from_utf8<variant::mutf8>("\xc1\x81", out);
+        REQUIRE(res.error == error::invalid_utf8);
+
+        // Surrogates are not standard UTF8
+        res = from_utf8<variant::mutf8>(emoji_pair, out);
+        REQUIRE(res.error == error::invalid_utf8);
+    }
+}
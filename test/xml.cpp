@@ -0,0 +1,105 @@
+#include "catch.hpp"
+#include "helpers.hpp"
+#include <string>
+#include <vector>
+#include <utf8pp.hpp>
+
+static std::string escape(std::string const& s,
+    utf8pp::xml_invalid invalid = utf8pp::xml_invalid::reject,
+    utf8pp::utf8_ssize error = 0, utf8pp::utf8_usize read = 0) {
+    bytes_t dst(s.size() * 6 + 16);
+    auto res = utf8pp::xml_escape(bytes(s), s.size(), dst.data(), invalid);
+    REQUIRE(res.error == error);
+    REQUIRE(res.read == (error ? read : s.size()));
+    return std::string(dst.begin(), dst.begin() + long(res.written));
+}
+
+static std::string unescape(std::string const& s,
+    utf8pp::utf8_ssize error = 0, utf8pp::utf8_usize read = 0) {
+    bytes_t dst(s.size() + 16);
+    auto res = utf8pp::xml_unescape(bytes(s), s.size(), dst.data());
+    REQUIRE(res.error == error);
+    REQUIRE(res.read == (error ? read : s.size()));
+    return std::string(dst.begin(), dst.begin() + long(res.written));
+}
+
+TEST_CASE("escape text for XML", "[xml_escape]") {
+    using utf8pp::xml_invalid;
+    namespace error = utf8pp::error;
+
+    REQUIRE(escape("") == "");
+    REQUIRE(escape("a<b>&\"'") == "a&lt;b&gt;&amp;&quot;&#39;");
+    REQUIRE(escape("tab\tlf\ncr\r") == "tab\tlf\ncr\r");
+    REQUIRE(escape("\xc3\xa9\xe3\x81\x93\xf0\x9f\x98\x80")
+        == "\xc3\xa9\xe3\x81\x93\xf0\x9f\x98\x80");
+
+    // Specials in and after long clean runs
+    std::string text = "the quick brown fox jumps over the lazy dog";
+    REQUIRE(escape(text + "<" + text) == text + "&lt;" + text);
+    REQUIRE(escape(text + "\xc3\xa9" + text) == text + "\xc3\xa9" + text);
+
+    // Codepoints outside the Char production
+    REQUIRE(escape("ab\x01" "c", xml_invalid::reject,
+        error::invalid_codepoint, 2) == "ab");
+    REQUIRE(escape(text + "\x1f", xml_invalid::reject,
+        error::invalid_codepoint, text.size()) == text);
+    REQUIRE(escape("a\xef\xbf\xbe", xml_invalid::reject,
+        error::invalid_codepoint, 1) == "a");
+    REQUIRE(escape("a\xef\xbf\xbf", xml_invalid::reject,
+        error::invalid_codepoint, 1) == "a");
+    REQUIRE(escape("a\xef\xbf\xbd") == "a\xef\xbf\xbd");
+    REQUIRE(escape("a\x01<\xef\xbf\xbe", xml_invalid::replace)
+        == "a\xef\xbf\xbd&lt;\xef\xbf\xbd");
+
+    // Invalid UTF8
+    REQUIRE(escape("ab\xc0\xaf", xml_invalid::reject, error::invalid_utf8, 2)
+        == "ab");
+    REQUIRE(escape("a\xed\xa0\x80", xml_invalid::reject, error::invalid_utf8,
+        1) == "a");
+    REQUIRE(escape("a\xe3\x81", xml_invalid::reject, error::invalid_utf8, 1)
+        == "a");
+    REQUIRE(escape("a\xff" "b\xe3\x81", xml_invalid::replace)
+        == "a\xef\xbf\xbd" "b\xef\xbf\xbd\xef\xbf\xbd");
+}
+
+TEST_CASE("unescape XML text", "[xml_unescape]") {
+    namespace error = utf8pp::error;
+
+    REQUIRE(unescape("") == "");
+    REQUIRE(unescape("a&lt;b&gt;&amp;&quot;&apos;") == "a<b>&\"'");
+    REQUIRE(unescape("&#65;&#x42;&#x10FFFF;&#233;")
+        == "AB\xf4\x8f\xbf\xbf\xc3\xa9");
+    REQUIRE(unescape("&#9;&#xd;&#xFFFD;") == "\t\r\xef\xbf\xbd");
+    REQUIRE(unescape("\xe3\x81\x93&amp;\xe3\x81\x93")
+        == "\xe3\x81\x93&\xe3\x81\x93");
+
+    // Round trip through a long text
+    std::string text = "<p class=\"x\">Tom & Jerry's \xc3\xa9t\xc3\xa9</p>";
+    text += text + text;
+    bytes_t dst(text.size() * 6 + 16);
+    auto res = utf8pp::xml_escape(bytes(text), text.size(), dst.data());
+    REQUIRE(res.error == 0);
+    std::string escaped(dst.begin(), dst.begin() + long(res.written));
+    REQUIRE(unescape(escaped) == text);
+
+    // Malformed references
+    REQUIRE(unescape("ab&lt", error::invalid_sequence, 2) == "ab");
+    REQUIRE(unescape("a&nbsp;", error::invalid_sequence, 1) == "a");
+    REQUIRE(unescape("a& b;", error::invalid_sequence, 1) == "a");
+    REQUIRE(unescape("a&#;", error::invalid_sequence, 1) == "a");
+    REQUIRE(unescape("a&#x;", error::invalid_sequence, 1) == "a");
+    REQUIRE(unescape("a&#12a;", error::invalid_sequence, 1) == "a");
+    REQUIRE(unescape("a&#xg;", error::invalid_sequence, 1) == "a");
+    REQUIRE(unescape("a&#1234567890123;", error::invalid_sequence, 1) == "a");
+
+    // References to codepoints that aren't characters
+    REQUIRE(unescape("a&#0;", error::invalid_codepoint, 1) == "a");
+    REQUIRE(unescape("a&#x1;", error::invalid_codepoint, 1) == "a");
+    REQUIRE(unescape("a&#xD800;", error::invalid_codepoint, 1) == "a");
+    REQUIRE(unescape("a&#xFFFE;", error::invalid_codepoint, 1) == "a");
+    REQUIRE(unescape("a&#x110000;", error::invalid_codepoint, 1) == "a");
+
+    // Invalid UTF8 in the raw text
+    REQUIRE(unescape("a\xc0\xaf", error::invalid_utf8, 1) == "a");
+    REQUIRE(unescape("a\xe3\x81", error::incomplete, 1) == "a");
+}